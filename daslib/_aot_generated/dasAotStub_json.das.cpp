@@ -0,0 +1,1113 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require json
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_2195075843105426692 {
+
+extern StructInfo __struct_info__61572b475354632e;
+extern StructInfo __struct_info__fcdd0f75d24b08d;
+extern TypeInfo __type_info__9b256933f6ab83b8;
+extern TypeInfo __type_info__94f292fe71b59ea3;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__90f4c07b5a6e390;
+extern TypeInfo __type_info__af63df4c8601f1a5;
+extern TypeInfo __type_info__af63ee4c86020b22;
+extern TypeInfo __type_info__8c48207b56753d8;
+extern TypeInfo __type_info__a0e5ef318774553c;
+extern TypeInfo __type_info__90f3d07b5a6ca13;
+extern TypeInfo __type_info__c86323b04fd92665;
+extern TypeInfo __type_info__af63d94c8601e773;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__b0329a9572555c32;
+extern TypeInfo __type_info__38850d126de4e5b1;
+extern TypeInfo __type_info__fca5b632243378fb;
+extern TypeInfo __type_info__90f5707b5a6f641;
+extern TypeInfo __type_info__f95678735cf0e442;
+extern TypeInfo __type_info__d8105ae0a96b94f9;
+extern TypeInfo __type_info__e1840320789b7099;
+extern TypeInfo __type_info__3e2a885481f71e6f;
+extern TypeInfo __type_info__90f5207b5a6edc2;
+extern VarInfo __var_info__e8d60c70bf488e4d;
+extern VarInfo __var_info__ed1e7512b750e578;
+extern VarInfo __var_info__a47a1ad71673c7b6;
+extern VarInfo __var_info__1acd07e3b47c5ccf;
+extern VarInfo __var_info__ed167369eb4ac7a6;
+extern VarInfo __var_info__c7cbeaf87c969bc2;
+extern VarInfo __var_info__affd6069c88e2852;
+extern VarInfo __var_info__d30c28fd02e5ca43;
+extern VarInfo __var_info__37c215ee4ef41c03;
+extern VarInfo __var_info__2ac8dae83b87af98;
+
+TypeInfo * __type_info__37c215ee4ef41c03_arg_types_var_7014122529993548590[6] = { &__type_info__3e2a885481f71e6f, &__type_info__fca5b632243378fb, &__type_info__af63ee4c86020b22, &__type_info__af63d94c8601e773, &__type_info__af63df4c8601f1a5, &__type_info__38850d126de4e5b1 };
+const char * __type_info__37c215ee4ef41c03_arg_names_var_7014122529993548590[6] = { "_object", "_array", "_string", "_number", "_bool", "_null" };
+VarInfo __struct_info__61572b475354632e_field_0 =  { Type::tVariant, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__37c215ee4ef41c03_arg_types_var_7014122529993548590, (char **)__type_info__37c215ee4ef41c03_arg_names_var_7014122529993548590, 6, 0, nullptr, 57346, 56, 0x37c215ee4ef41c03ul, "value", 0 };
+VarInfo * __struct_info__61572b475354632e_fields[1] =  { &__struct_info__61572b475354632e_field_0 };
+StructInfo __struct_info__61572b475354632e = {(char*)"JsonValue", (char*)"json", 28, __struct_info__61572b475354632e_fields, 1, 56, 0x0ul, nullptr, 0x61572b475354632eul };
+TypeInfo * __type_info__a47a1ad71673c7b6_arg_types_var_1138796041632788621[2] = { &__type_info__9b256933f6ab83b8, &__type_info__c86323b04fd92665 };
+VarInfo __struct_info__fcdd0f75d24b08d_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__a47a1ad71673c7b6_arg_types_var_1138796041632788621, nullptr, 2, 0, nullptr, 28, 8, 0xa47a1ad71673c7b6ul, "__lambda", 0 };
+TypeInfo * __type_info__d30c28fd02e5ca43_arg_types_var_1138796041632788621[1] = { &__type_info__b0329a9572555c32 };
+VarInfo __struct_info__fcdd0f75d24b08d_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__d30c28fd02e5ca43_arg_types_var_1138796041632788621, nullptr, 1, 0, nullptr, 28, 8, 0xd30c28fd02e5ca43ul, "__finalize", 8 };
+VarInfo __struct_info__fcdd0f75d24b08d_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xc7cbeaf87c969bc2ul, "__yield", 16 };
+VarInfo __struct_info__fcdd0f75d24b08d_field_3 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16516, 8, 0x1acd07e3b47c5ccful, "stext", 24 };
+VarInfo __struct_info__fcdd0f75d24b08d_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, 0xed167369eb4ac7a6ul, "tin", 32 };
+VarInfo __struct_info__fcdd0f75d24b08d_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0x2ac8dae83b87af98ul, "ahead", 40 };
+VarInfo __struct_info__fcdd0f75d24b08d_field_6 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__8c48207b56753d8, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, 0xaffd6069c88e2852ul, "str", 48 };
+VarInfo __struct_info__fcdd0f75d24b08d_field_7 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, 0xed1e7512b750e578ul, "__num_rename_at_119", 72 };
+VarInfo __struct_info__fcdd0f75d24b08d_field_8 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, 0xe8d60c70bf488e4dul, "__name_rename_at_128", 80 };
+VarInfo * __struct_info__fcdd0f75d24b08d_fields[9] =  { &__struct_info__fcdd0f75d24b08d_field_0, &__struct_info__fcdd0f75d24b08d_field_1, &__struct_info__fcdd0f75d24b08d_field_2, &__struct_info__fcdd0f75d24b08d_field_3, &__struct_info__fcdd0f75d24b08d_field_4, &__struct_info__fcdd0f75d24b08d_field_5, &__struct_info__fcdd0f75d24b08d_field_6, &__struct_info__fcdd0f75d24b08d_field_7, &__struct_info__fcdd0f75d24b08d_field_8 };
+StructInfo __struct_info__fcdd0f75d24b08d = {(char*)"_lambda_json_65_8_1", (char*)"json", 30, __struct_info__fcdd0f75d24b08d_fields, 9, 88, 0x0ul, nullptr, 0xfcdd0f75d24b08dul };
+TypeInfo __type_info__9b256933f6ab83b8 = { Type::tStructure, &__struct_info__fcdd0f75d24b08d, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 88, 0x9b256933f6ab83b8ul };
+TypeInfo __type_info__94f292fe71b59ea3 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d8105ae0a96b94f9, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, 0x94f292fe71b59ea3ul };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xaf63e44c8601fa24ul };
+TypeInfo __type_info__90f4c07b5a6e390 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 1, 0x90f4c07b5a6e390ul };
+TypeInfo __type_info__af63df4c8601f1a5 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, 0xaf63df4c8601f1a5ul };
+TypeInfo __type_info__af63ee4c86020b22 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, 0xaf63ee4c86020b22ul };
+TypeInfo __type_info__8c48207b56753d8 = { Type::tUInt8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, 0x8c48207b56753d8ul };
+TypeInfo __type_info__a0e5ef318774553c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d8105ae0a96b94f9, nullptr, nullptr, nullptr, 0, 0, nullptr, 24620, 8, 0xa0e5ef318774553cul };
+TypeInfo __type_info__90f3d07b5a6ca13 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, 0x90f3d07b5a6ca13ul };
+TypeInfo * __type_info__c86323b04fd92665_arg_types[6] = { &__type_info__af63ee4c86020b22, &__type_info__af63d94c8601e773, &__type_info__af63df4c8601f1a5, &__type_info__38850d126de4e5b1, &__type_info__af63e44c8601fa24, &__type_info__af63ee4c86020b22 };
+const char * __type_info__c86323b04fd92665_arg_names[6] = { "_string", "_number", "_bool", "_null", "_symbol", "_error" };
+TypeInfo __type_info__c86323b04fd92665 = { Type::tVariant, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__c86323b04fd92665_arg_types, (char **)__type_info__c86323b04fd92665_arg_names, 6, 0, nullptr, 24582, 16, 0xc86323b04fd92665ul };
+TypeInfo __type_info__af63d94c8601e773 = { Type::tDouble, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 8, 0xaf63d94c8601e773ul };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, 0xaf63eb4c86020609ul };
+TypeInfo __type_info__b0329a9572555c32 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9b256933f6ab83b8, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, 0xb0329a9572555c32ul };
+TypeInfo __type_info__38850d126de4e5b1 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0x38850d126de4e5b1ul };
+TypeInfo __type_info__fca5b632243378fb = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__94f292fe71b59ea3, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 24, 0xfca5b632243378fbul };
+TypeInfo __type_info__90f5707b5a6f641 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, 0x90f5707b5a6f641ul };
+TypeInfo __type_info__f95678735cf0e442 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~strings::StringBuilderWriter"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 288, 0xf95678735cf0e442ul };
+TypeInfo __type_info__d8105ae0a96b94f9 = { Type::tStructure, &__struct_info__61572b475354632e, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 56, 0xd8105ae0a96b94f9ul };
+TypeInfo * __type_info__e1840320789b7099_arg_types[6] = { &__type_info__af63ee4c86020b22, &__type_info__af63d94c8601e773, &__type_info__af63df4c8601f1a5, &__type_info__38850d126de4e5b1, &__type_info__af63e44c8601fa24, &__type_info__af63ee4c86020b22 };
+const char * __type_info__e1840320789b7099_arg_names[6] = { "_string", "_number", "_bool", "_null", "_symbol", "_error" };
+TypeInfo __type_info__e1840320789b7099 = { Type::tVariant, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__e1840320789b7099_arg_types, (char **)__type_info__e1840320789b7099_arg_names, 6, 0, nullptr, 24838, 16, 0xe1840320789b7099ul };
+TypeInfo __type_info__3e2a885481f71e6f = { Type::tTable, nullptr, nullptr, nullptr, &__type_info__af63ee4c86020b22, &__type_info__94f292fe71b59ea3, nullptr, nullptr, 0, 0, nullptr, 57346, 48, 0x3e2a885481f71e6ful };
+TypeInfo __type_info__90f5207b5a6edc2 = { Type::tDouble, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 8, 0x90f5207b5a6edc2ul };
+
+TypeInfo * __tinfo_0[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__af63ee4c86020b22 };
+TypeInfo * __tinfo_1[4] = { &__type_info__90f3d07b5a6ca13, &__type_info__af63ee4c86020b22, &__type_info__90f3d07b5a6ca13, &__type_info__af63e44c8601fa24 };
+TypeInfo * __tinfo_2[4] = { &__type_info__90f3d07b5a6ca13, &__type_info__c86323b04fd92665, &__type_info__90f3d07b5a6ca13, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_3[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__c86323b04fd92665, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_4[6] = { &__type_info__90f3d07b5a6ca13, &__type_info__c86323b04fd92665, &__type_info__90f3d07b5a6ca13, &__type_info__af63ee4c86020b22, &__type_info__90f3d07b5a6ca13, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_5[4] = { &__type_info__90f3d07b5a6ca13, &__type_info__af63ee4c86020b22, &__type_info__90f3d07b5a6ca13, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_6[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_7[4] = { &__type_info__90f3d07b5a6ca13, &__type_info__af63ee4c86020b22, &__type_info__90f3d07b5a6ca13, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_8[4] = { &__type_info__90f3d07b5a6ca13, &__type_info__af63ee4c86020b22, &__type_info__90f3d07b5a6ca13, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_9[1] = { &__type_info__e1840320789b7099 };
+TypeInfo * __tinfo_10[2] = { &__type_info__f95678735cf0e442, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_11[2] = { &__type_info__f95678735cf0e442, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_12[2] = { &__type_info__f95678735cf0e442, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_13[2] = { &__type_info__f95678735cf0e442, &__type_info__90f5207b5a6edc2 };
+TypeInfo * __tinfo_14[2] = { &__type_info__f95678735cf0e442, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_15[2] = { &__type_info__f95678735cf0e442, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_16[2] = { &__type_info__f95678735cf0e442, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_17[2] = { &__type_info__f95678735cf0e442, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_18[2] = { &__type_info__f95678735cf0e442, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_19[2] = { &__type_info__f95678735cf0e442, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_20[2] = { &__type_info__f95678735cf0e442, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_21[2] = { &__type_info__f95678735cf0e442, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_22[2] = { &__type_info__f95678735cf0e442, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_23[2] = { &__type_info__f95678735cf0e442, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_24[2] = { &__type_info__f95678735cf0e442, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_25[2] = { &__type_info__f95678735cf0e442, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_26[2] = { &__type_info__f95678735cf0e442, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_27[2] = { &__type_info__f95678735cf0e442, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_28[2] = { &__type_info__f95678735cf0e442, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_29[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__a0e5ef318774553c };
+namespace json { struct JsonValue; };
+namespace json { struct _lambda_json_65_8_1; };
+namespace json {
+
+struct JsonValue {
+	TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> value;
+};
+static_assert(sizeof(JsonValue)==56,"structure size mismatch with DAS");
+static_assert(offsetof(JsonValue,value)==0,"structure field offset mismatch with DAS");
+}
+namespace json {
+
+struct _lambda_json_65_8_1 {
+	Func DAS_COMMENT((bool,json::_lambda_json_65_8_1,TVariant<16,char *,double,bool,void *,int32_t,char *>)) __lambda;
+	Func DAS_COMMENT((void,json::_lambda_json_65_8_1 *)) __finalize;
+	int32_t __yield;
+	char * stext;
+	Sequence DAS_COMMENT((int32_t)) tin;
+	int32_t ahead;
+	TArray<uint8_t> str;
+	char * __num_rename_at_119;
+	char * __name_rename_at_128;
+};
+static_assert(sizeof(_lambda_json_65_8_1)==88,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_json_65_8_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_json_65_8_1,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_json_65_8_1,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_json_65_8_1,stext)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_json_65_8_1,tin)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_json_65_8_1,ahead)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_json_65_8_1,str)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_json_65_8_1,__num_rename_at_119)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_json_65_8_1,__name_rename_at_128)==80,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_finalize_7f972184337f6d1a ( Context * __context__, TArray<uint8_t> & __a_rename_at_293 );
+inline void finalize_f6eedda5c8622ae5 ( Context * __context__, json::_lambda_json_65_8_1 & ____this_rename_at_65 );
+inline Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) _Funcbuiltin_0x60_each_e8feb1f7b51f4d2c ( Context * __context__, Lambda DAS_COMMENT((bool,TVariant<16,char *,double,bool,void *,int32_t,char *>)) const  __lam_rename_at_374 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_930293dc0a86c983 ( Context * __context__, char * const  __str_rename_at_355 );
+inline bool _Funcbuiltin_0x60_next_6a3c01874ce3fb9a ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_325, int32_t & __value_rename_at_325 );
+inline void _Funcbuiltin_0x60_push_e5de83ceac06608f ( Context * __context__, TArray<uint8_t> & __Arr_rename_at_75, uint8_t __value_rename_at_75 );
+inline bool _Func_lambda_json_65_8_1_0x60_function_e1ee21994054cac5 ( Context * __context__, json::_lambda_json_65_8_1 & ____this_rename_at_65, TVariant<16,char *,double,bool,void *,int32_t,char *> & ___yield_65_rename_at_65 );
+inline void _Func_lambda_json_65_8_1_0x60_finalizer_726f2708e8e63a9a ( Context * __context__, json::_lambda_json_65_8_1 * ____this_rename_at_65 );
+inline bool _Funcbuiltin_0x60_next_111e5cd76980442a ( Context * __context__, Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) const  & __it_rename_at_325, TVariant<16,char *,double,bool,void *,int32_t,char *> & __value_rename_at_325 );
+inline void _Funcbuiltin_0x60_push_4554057434702220 ( Context * __context__, TArray<json::JsonValue *> & __Arr_rename_at_75, json::JsonValue * const  __value_rename_at_75 );
+inline bool _Funcbuiltin_0x60_key_exists_c934a184b60d3069 ( Context * __context__, TTable<char *,json::JsonValue *> const  & __Tab_rename_at_225, char * const  __at_rename_at_225 );
+inline Sequence DAS_COMMENT((char * const  &)) _Funcbuiltin_0x60_keys_94c2131db976b1fb ( Context * __context__, TTable<char *,json::JsonValue *> const  & __a_rename_at_270 );
+inline Sequence DAS_COMMENT((json::JsonValue * const  &)) _Funcbuiltin_0x60_values_bc20d784425b4a8c ( Context * __context__, TTable<char *,json::JsonValue *> const  & __a_rename_at_275 );
+inline json::JsonValue * JV_329cd26089c5824a ( Context * __context__, char * const  __v_rename_at_35 );
+inline json::JsonValue * JV_ee50ad9073b68df9 ( Context * __context__, double __v_rename_at_39 );
+inline json::JsonValue * JV_24a62d4c91875cf ( Context * __context__, bool __v_rename_at_42 );
+inline json::JsonValue * JVNull_f69e3effb8bc1460 ( Context * __context__ );
+inline json::JsonValue * JV_f17b12e37633850f ( Context * __context__, TTable<char *,json::JsonValue *> & __v_rename_at_49 );
+inline json::JsonValue * JV_bfd94f47b31832f5 ( Context * __context__, TArray<json::JsonValue *> & __v_rename_at_52 );
+inline Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) lexer_6f13366e445ec80f ( Context * __context__, char * const  __text_rename_at_55 );
+inline Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) lexer_7819f90db0d736a1 ( Context * __context__, TArray<uint8_t> const  & __text_rename_at_59 );
+inline Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) _lexer_a3d35dd07afab514 ( Context * __context__, char * __stext_rename_at_63 );
+inline bool expect_token_6b816d4d512abff2 ( Context * __context__, Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) & __itv_rename_at_149, TVariant<16,char *,double,bool,void *,int32_t,char *> & __ahead_rename_at_149, int32_t __vindex_rename_at_149, char * & __error_rename_at_149 );
+inline bool expect_symbol_7680dd81b760ae55 ( Context * __context__, Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) & __itv_rename_at_159, TVariant<16,char *,double,bool,void *,int32_t,char *> & __ahead_rename_at_159, int32_t __sym_rename_at_159, char * & __error_rename_at_159 );
+inline json::JsonValue * parse_value_a170a8a36281327e ( Context * __context__, Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) & __itv_rename_at_172, char * & __error_rename_at_172 );
+inline json::JsonValue * read_json_87a307c27c5414f4 ( Context * __context__, char * const  __text_rename_at_248, char * & __error_rename_at_248 );
+inline json::JsonValue * read_json_5ad42e6aecdc083b ( Context * __context__, TArray<uint8_t> const  & __text_rename_at_256, char * & __error_rename_at_256 );
+inline void write_value_96cf53d6e3bd6ab6 ( Context * __context__, StringBuilderWriter & __writer_rename_at_263, json::JsonValue * const  __jsv_rename_at_263, int32_t __depth_rename_at_263 );
+inline char * write_json_482d9d25c376b07e ( Context * __context__, json::JsonValue * const  __val_rename_at_317 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int32_t,0x7c22a2b76cc6a180>(__context__) = 0;/*Token_string*/
+	das_global<int32_t,0x3b9b6b6bf77ce383>(__context__) = 4;/*Token_symbol*/
+}
+
+inline void _Funcbuiltin_0x60_finalize_7f972184337f6d1a ( Context * __context__, TArray<uint8_t> &  __a_rename_at_293 )
+{
+	builtin_array_free(das_arg<TArray<uint8_t>>::pass(__a_rename_at_293),1,__context__);
+}
+
+inline void finalize_f6eedda5c8622ae5 ( Context * __context__, json::_lambda_json_65_8_1 &  ____this_rename_at_65 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_65.tin),__context__);
+	_Funcbuiltin_0x60_finalize_7f972184337f6d1a(__context__,das_arg<TArray<uint8_t>>::pass(____this_rename_at_65.str));
+	memset(&(____this_rename_at_65), 0, 88);
+}
+
+inline Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) _Funcbuiltin_0x60_each_e8feb1f7b51f4d2c ( Context * __context__, Lambda DAS_COMMENT((bool,TVariant<16,char *,double,bool,void *,int32_t,char *>)) const  __lam_rename_at_374 )
+{
+	Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) __it_rename_at_376; das_zero(__it_rename_at_376);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__it_rename_at_376),__lam_rename_at_374,16,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::cast(__it_rename_at_376);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_930293dc0a86c983 ( Context * __context__, char * const  __str_rename_at_355 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_356; das_zero(__it_rename_at_356);
+	builtin_make_string_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_356),__str_rename_at_355,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_356);
+}
+
+inline bool _Funcbuiltin_0x60_next_6a3c01874ce3fb9a ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_325, int32_t & __value_rename_at_325 )
+{
+	return das_auto_cast<bool>::cast(builtin_iterator_iterate(__it_rename_at_325,das_auto_cast<void * const >::cast(das_ref(__context__,__value_rename_at_325)),__context__));
+}
+
+inline void _Funcbuiltin_0x60_push_e5de83ceac06608f ( Context * __context__, TArray<uint8_t> &  __Arr_rename_at_75, uint8_t __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<uint8_t>>::pass(__Arr_rename_at_75),1,__context__),__context__),__value_rename_at_75);
+}
+
+inline bool _Func_lambda_json_65_8_1_0x60_function_e1ee21994054cac5 ( Context * __context__, json::_lambda_json_65_8_1 &  ____this_rename_at_65, TVariant<16,char *,double,bool,void *,int32_t,char *> &  ___yield_65_rename_at_65 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_67_32;
+	switch (____this_rename_at_65.__yield) {
+	case 0: goto label_0;
+	case 32: goto label_32;
+	case 1: goto label_1;
+	case 30: goto label_30;
+	case 7: goto label_7;
+	case 3: goto label_3;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	case 6: goto label_6;
+	case 8: goto label_8;
+	case 9: goto label_9;
+	case 10: goto label_10;
+	case 11: goto label_11;
+	case 28: goto label_28;
+	case 12: goto label_12;
+	case 26: goto label_26;
+	case 13: goto label_13;
+	case 21: goto label_21;
+	case 14: goto label_14;
+	case 19: goto label_19;
+	case 15: goto label_15;
+	case 17: goto label_17;
+	case 16: goto label_16;
+	case 18: goto label_18;
+	case 20: goto label_20;
+	case 22: goto label_22;
+	case 24: goto label_24;
+	case 23: goto label_23;
+	case 25: goto label_25;
+	case 27: goto label_27;
+	case 29: goto label_29;
+	case 31: goto label_31;
+	case 33: goto label_33;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	memset(&(____this_rename_at_65.tin), 0, 8);
+	das_move(____this_rename_at_65.tin,(_temp_make_local_67_32 = (_Funcbuiltin_0x60_each_930293dc0a86c983(__context__,____this_rename_at_65.stext))));
+	das_copy(____this_rename_at_65.ahead,32);
+	memset(&(____this_rename_at_65.str), 0, 24);
+	label_32:;;
+	if ( !!(builtin_iterator_empty(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_65.tin))) )
+	{
+		goto label_33;
+	};
+	while ( is_white_space(____this_rename_at_65.ahead) && _Funcbuiltin_0x60_next_6a3c01874ce3fb9a(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_65.tin),____this_rename_at_65.ahead) )
+	{
+	};
+	if ( builtin_iterator_empty(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_65.tin)) )
+	{
+		return das_auto_cast<bool>::cast(false);
+	};
+	if ( !((((((____this_rename_at_65.ahead == 91) || (____this_rename_at_65.ahead == 93)) || (____this_rename_at_65.ahead == 123)) || (____this_rename_at_65.ahead == 125)) || (____this_rename_at_65.ahead == 58)) || (____this_rename_at_65.ahead == 44)) )
+	{
+		goto label_30;
+	};
+	das_copy(___yield_65_rename_at_65,(([&]() -> TVariant<16,char *,double,bool,void *,int32_t,char *> {
+		TVariant<16,char *,double,bool,void *,int32_t,char *> __mkv_76;
+		das_get_variant_field<int32_t,8,4>::set(__mkv_76) = ____this_rename_at_65.ahead;
+		return __mkv_76;
+	})()));
+	das_copy(____this_rename_at_65.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	_Funcbuiltin_0x60_next_6a3c01874ce3fb9a(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_65.tin),____this_rename_at_65.ahead);
+	goto label_31;
+	label_30:;;
+	if ( !(____this_rename_at_65.ahead == 34) )
+	{
+		goto label_28;
+	};
+	label_7:;;
+	if ( !(_Funcbuiltin_0x60_next_6a3c01874ce3fb9a(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_65.tin),____this_rename_at_65.ahead) && (____this_rename_at_65.ahead != 34)) )
+	{
+		goto label_8;
+	};
+	if ( !(____this_rename_at_65.ahead == 92) )
+	{
+		goto label_5;
+	};
+	if ( !_Funcbuiltin_0x60_next_6a3c01874ce3fb9a(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_65.tin),____this_rename_at_65.ahead) )
+	{
+		goto label_3;
+	};
+	if ( ____this_rename_at_65.ahead == 98 )
+	{
+		das_copy(____this_rename_at_65.ahead,8);
+	} else if ( ____this_rename_at_65.ahead == 102 )
+	{
+		das_copy(____this_rename_at_65.ahead,12);
+	} else if ( ____this_rename_at_65.ahead == 110 )
+	{
+		das_copy(____this_rename_at_65.ahead,10);
+	} else if ( ____this_rename_at_65.ahead == 114 )
+	{
+		das_copy(____this_rename_at_65.ahead,13);
+	} else if ( ____this_rename_at_65.ahead == 116 )
+	{
+		das_copy(____this_rename_at_65.ahead,9);
+	};
+	_Funcbuiltin_0x60_push_e5de83ceac06608f(__context__,das_arg<TArray<uint8_t>>::pass(____this_rename_at_65.str),uint8_t(____this_rename_at_65.ahead));
+	goto label_4;
+	label_3:;;
+	das_copy(___yield_65_rename_at_65,(([&]() -> TVariant<16,char *,double,bool,void *,int32_t,char *> {
+		TVariant<16,char *,double,bool,void *,int32_t,char *> __mkv_94;
+		das_get_variant_field<char *,8,5>::set(__mkv_94) = ((char *) "string escape sequence exceeds text");
+		return __mkv_94;
+	})()));
+	das_copy(____this_rename_at_65.__yield,2);
+	return das_auto_cast<bool>::cast(true);
+	label_2:;;
+	return das_auto_cast<bool>::cast(false);
+	label_4:;;
+	goto label_6;
+	label_5:;;
+	_Funcbuiltin_0x60_push_e5de83ceac06608f(__context__,das_arg<TArray<uint8_t>>::pass(____this_rename_at_65.str),uint8_t(____this_rename_at_65.ahead));
+	label_6:;;
+	goto label_7;
+	label_8:;;
+	if ( !builtin_iterator_empty(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_65.tin)) )
+	{
+		goto label_10;
+	};
+	das_copy(___yield_65_rename_at_65,(([&]() -> TVariant<16,char *,double,bool,void *,int32_t,char *> {
+		TVariant<16,char *,double,bool,void *,int32_t,char *> __mkv_99;
+		das_get_variant_field<char *,8,5>::set(__mkv_99) = ((char *) "string exceeds text");
+		return __mkv_99;
+	})()));
+	das_copy(____this_rename_at_65.__yield,9);
+	return das_auto_cast<bool>::cast(true);
+	label_9:;;
+	return das_auto_cast<bool>::cast(false);
+	label_10:;;
+	das_copy(___yield_65_rename_at_65,(([&]() -> TVariant<16,char *,double,bool,void *,int32_t,char *> {
+		TVariant<16,char *,double,bool,void *,int32_t,char *> __mkv_101;
+		das_get_variant_field<char *,8,0>::set(__mkv_101) = ((char *)(builtin_string_from_array(das_arg<TArray<uint8_t>>::pass(____this_rename_at_65.str),__context__)));
+		return __mkv_101;
+	})()));
+	das_copy(____this_rename_at_65.__yield,11);
+	return das_auto_cast<bool>::cast(true);
+	label_11:;;
+	builtin_array_clear(das_arg<TArray<uint8_t>>::pass(____this_rename_at_65.str),__context__);
+	_Funcbuiltin_0x60_next_6a3c01874ce3fb9a(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_65.tin),____this_rename_at_65.ahead);
+	goto label_29;
+	label_28:;;
+	if ( !(((____this_rename_at_65.ahead == 43) || (____this_rename_at_65.ahead == 45)) || is_number(____this_rename_at_65.ahead)) )
+	{
+		goto label_26;
+	};
+	_Funcbuiltin_0x60_push_e5de83ceac06608f(__context__,das_arg<TArray<uint8_t>>::pass(____this_rename_at_65.str),uint8_t(____this_rename_at_65.ahead));
+	while ( _Funcbuiltin_0x60_next_6a3c01874ce3fb9a(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_65.tin),____this_rename_at_65.ahead) && is_number(____this_rename_at_65.ahead) )
+	{
+		_Funcbuiltin_0x60_push_e5de83ceac06608f(__context__,das_arg<TArray<uint8_t>>::pass(____this_rename_at_65.str),uint8_t(____this_rename_at_65.ahead));
+	};
+	if ( !(builtin_iterator_empty(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_65.tin))) && (____this_rename_at_65.ahead == 46) )
+	{
+		_Funcbuiltin_0x60_push_e5de83ceac06608f(__context__,das_arg<TArray<uint8_t>>::pass(____this_rename_at_65.str),uint8_t(____this_rename_at_65.ahead));
+		while ( _Funcbuiltin_0x60_next_6a3c01874ce3fb9a(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_65.tin),____this_rename_at_65.ahead) && is_number(____this_rename_at_65.ahead) )
+		{
+			_Funcbuiltin_0x60_push_e5de83ceac06608f(__context__,das_arg<TArray<uint8_t>>::pass(____this_rename_at_65.str),uint8_t(____this_rename_at_65.ahead));
+		};
+	};
+	if ( !(builtin_iterator_empty(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_65.tin))) && ((____this_rename_at_65.ahead == 101) || (____this_rename_at_65.ahead == 69)) )
+	{
+		_Funcbuiltin_0x60_push_e5de83ceac06608f(__context__,das_arg<TArray<uint8_t>>::pass(____this_rename_at_65.str),uint8_t(____this_rename_at_65.ahead));
+		_Funcbuiltin_0x60_next_6a3c01874ce3fb9a(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_65.tin),____this_rename_at_65.ahead);
+		if ( ((____this_rename_at_65.ahead == 43) || (____this_rename_at_65.ahead == 45)) || is_number(____this_rename_at_65.ahead) )
+		{
+			_Funcbuiltin_0x60_push_e5de83ceac06608f(__context__,das_arg<TArray<uint8_t>>::pass(____this_rename_at_65.str),uint8_t(____this_rename_at_65.ahead));
+		};
+		while ( _Funcbuiltin_0x60_next_6a3c01874ce3fb9a(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_65.tin),____this_rename_at_65.ahead) && is_number(____this_rename_at_65.ahead) )
+		{
+			_Funcbuiltin_0x60_push_e5de83ceac06608f(__context__,das_arg<TArray<uint8_t>>::pass(____this_rename_at_65.str),uint8_t(____this_rename_at_65.ahead));
+		};
+	};
+	das_copy(____this_rename_at_65.__num_rename_at_119,((char *)(builtin_string_from_array(das_arg<TArray<uint8_t>>::pass(____this_rename_at_65.str),__context__))));
+	das_copy(___yield_65_rename_at_65,(([&]() -> TVariant<16,char *,double,bool,void *,int32_t,char *> {
+		TVariant<16,char *,double,bool,void *,int32_t,char *> __mkv_120;
+		das_get_variant_field<double,8,1>::set(__mkv_120) = string_to_double(____this_rename_at_65.__num_rename_at_119,__context__);
+		return __mkv_120;
+	})()));
+	das_copy(____this_rename_at_65.__yield,12);
+	return das_auto_cast<bool>::cast(true);
+	label_12:;;
+	builtin_array_clear(das_arg<TArray<uint8_t>>::pass(____this_rename_at_65.str),__context__);
+	delete_string(____this_rename_at_65.__num_rename_at_119,__context__);
+	goto label_27;
+	label_26:;;
+	if ( !is_alpha(____this_rename_at_65.ahead) )
+	{
+		goto label_24;
+	};
+	_Funcbuiltin_0x60_push_e5de83ceac06608f(__context__,das_arg<TArray<uint8_t>>::pass(____this_rename_at_65.str),uint8_t(____this_rename_at_65.ahead));
+	while ( _Funcbuiltin_0x60_next_6a3c01874ce3fb9a(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_65.tin),____this_rename_at_65.ahead) && is_alpha(____this_rename_at_65.ahead) )
+	{
+		_Funcbuiltin_0x60_push_e5de83ceac06608f(__context__,das_arg<TArray<uint8_t>>::pass(____this_rename_at_65.str),uint8_t(____this_rename_at_65.ahead));
+	};
+	das_copy(____this_rename_at_65.__name_rename_at_128,((char *)(builtin_string_from_array(das_arg<TArray<uint8_t>>::pass(____this_rename_at_65.str),__context__))));
+	if ( !(SimPolicy<char *>::Equ(cast<char *>::from(____this_rename_at_65.__name_rename_at_128),cast<char *>::from(((char *) "true")),*__context__,nullptr)) )
+	{
+		goto label_21;
+	};
+	das_copy(___yield_65_rename_at_65,(([&]() -> TVariant<16,char *,double,bool,void *,int32_t,char *> {
+		TVariant<16,char *,double,bool,void *,int32_t,char *> __mkv_130;
+		das_get_variant_field<bool,8,2>::set(__mkv_130) = true;
+		return __mkv_130;
+	})()));
+	das_copy(____this_rename_at_65.__yield,13);
+	return das_auto_cast<bool>::cast(true);
+	label_13:;;
+	goto label_22;
+	label_21:;;
+	if ( !(SimPolicy<char *>::Equ(cast<char *>::from(____this_rename_at_65.__name_rename_at_128),cast<char *>::from(((char *) "false")),*__context__,nullptr)) )
+	{
+		goto label_19;
+	};
+	das_copy(___yield_65_rename_at_65,(([&]() -> TVariant<16,char *,double,bool,void *,int32_t,char *> {
+		TVariant<16,char *,double,bool,void *,int32_t,char *> __mkv_132;
+		das_get_variant_field<bool,8,2>::set(__mkv_132) = false;
+		return __mkv_132;
+	})()));
+	das_copy(____this_rename_at_65.__yield,14);
+	return das_auto_cast<bool>::cast(true);
+	label_14:;;
+	goto label_20;
+	label_19:;;
+	if ( !(SimPolicy<char *>::Equ(cast<char *>::from(____this_rename_at_65.__name_rename_at_128),cast<char *>::from(((char *) "null")),*__context__,nullptr)) )
+	{
+		goto label_17;
+	};
+	das_copy(___yield_65_rename_at_65,(([&]() -> TVariant<16,char *,double,bool,void *,int32_t,char *> {
+		TVariant<16,char *,double,bool,void *,int32_t,char *> __mkv_134;
+		das_get_variant_field<void *,8,3>::set(__mkv_134) = nullptr;
+		return __mkv_134;
+	})()));
+	das_copy(____this_rename_at_65.__yield,15);
+	return das_auto_cast<bool>::cast(true);
+	label_15:;;
+	goto label_18;
+	label_17:;;
+	das_copy(___yield_65_rename_at_65,(([&]() -> TVariant<16,char *,double,bool,void *,int32_t,char *> {
+		TVariant<16,char *,double,bool,void *,int32_t,char *> __mkv_136;
+		das_get_variant_field<char *,8,5>::set(__mkv_136) = das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_0, cast<char * const >::from(((char *) "invalid name ")), cast<char *>::from(____this_rename_at_65.__name_rename_at_128)));
+		return __mkv_136;
+	})()));
+	das_copy(____this_rename_at_65.__yield,16);
+	return das_auto_cast<bool>::cast(true);
+	label_16:;;
+	return das_auto_cast<bool>::cast(false);
+	label_18:;;
+	label_20:;;
+	label_22:;;
+	delete_string(____this_rename_at_65.__name_rename_at_128,__context__);
+	builtin_array_clear(das_arg<TArray<uint8_t>>::pass(____this_rename_at_65.str),__context__);
+	goto label_25;
+	label_24:;;
+	das_copy(___yield_65_rename_at_65,(([&]() -> TVariant<16,char *,double,bool,void *,int32_t,char *> {
+		TVariant<16,char *,double,bool,void *,int32_t,char *> __mkv_142;
+		das_get_variant_field<char *,8,5>::set(__mkv_142) = das_string_builder(__context__,SimNode_AotInterop<4>(__tinfo_1, cast<char * const >::from(((char *) "invalid character `")), cast<char *>::from(((char *)(to_string_char(____this_rename_at_65.ahead,__context__)))), cast<char * const >::from(((char *) "` aka ASCII ")), cast<int32_t>::from(____this_rename_at_65.ahead)));
+		return __mkv_142;
+	})()));
+	das_copy(____this_rename_at_65.__yield,23);
+	return das_auto_cast<bool>::cast(true);
+	label_23:;;
+	return das_auto_cast<bool>::cast(false);
+	label_25:;;
+	label_27:;;
+	label_29:;;
+	label_31:;;
+	goto label_32;
+	label_33:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_json_65_8_1_0x60_finalizer_726f2708e8e63a9a ( Context * __context__, json::_lambda_json_65_8_1 * ____this_rename_at_65 )
+{
+	delete_string(das_deref(__context__,____this_rename_at_65).stext,__context__);
+	finalize_f6eedda5c8622ae5(__context__,das_arg<json::_lambda_json_65_8_1>::pass(das_deref(__context__,____this_rename_at_65)));
+	das_delete_lambda_struct<json::_lambda_json_65_8_1 *>::clear(__context__,____this_rename_at_65);
+}
+
+inline bool _Funcbuiltin_0x60_next_111e5cd76980442a ( Context * __context__, Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) const  &  __it_rename_at_325, TVariant<16,char *,double,bool,void *,int32_t,char *> &  __value_rename_at_325 )
+{
+	return das_auto_cast<bool>::cast(builtin_iterator_iterate(__it_rename_at_325,das_auto_cast<void * const >::cast(das_ref(__context__,__value_rename_at_325)),__context__));
+}
+
+inline void _Funcbuiltin_0x60_push_4554057434702220 ( Context * __context__, TArray<json::JsonValue *> &  __Arr_rename_at_75, json::JsonValue * const  __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<json::JsonValue *>>::pass(__Arr_rename_at_75),8,__context__),__context__),__value_rename_at_75);
+}
+
+inline bool _Funcbuiltin_0x60_key_exists_c934a184b60d3069 ( Context * __context__, TTable<char *,json::JsonValue *> const  &  __Tab_rename_at_225, char * const  __at_rename_at_225 )
+{
+	return das_auto_cast<bool>::cast(__builtin_table_key_exists(__context__,__Tab_rename_at_225,__at_rename_at_225));
+}
+
+inline Sequence DAS_COMMENT((char * const  &)) _Funcbuiltin_0x60_keys_94c2131db976b1fb ( Context * __context__, TTable<char *,json::JsonValue *> const  &  __a_rename_at_270 )
+{
+	Sequence DAS_COMMENT((char * *)) __it_rename_at_271; das_zero(__it_rename_at_271);
+	builtin_table_keys(das_arg<Sequence DAS_COMMENT((char * const ))>::pass(__it_rename_at_271),__a_rename_at_270,8,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((char * const  &))>::cast(__it_rename_at_271);
+}
+
+inline Sequence DAS_COMMENT((json::JsonValue * const  &)) _Funcbuiltin_0x60_values_bc20d784425b4a8c ( Context * __context__, TTable<char *,json::JsonValue *> const  &  __a_rename_at_275 )
+{
+	Sequence DAS_COMMENT((json::JsonValue * *)) __it_rename_at_276; das_zero(__it_rename_at_276);
+	builtin_table_values(das_arg<Sequence DAS_COMMENT((json::JsonValue * const ))>::pass(__it_rename_at_276),__a_rename_at_275,8,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((json::JsonValue * const  &))>::cast(__it_rename_at_276);
+}
+
+inline json::JsonValue * JV_329cd26089c5824a ( Context * __context__, char * const  __v_rename_at_35 )
+{
+	return das_auto_cast<json::JsonValue *>::cast(das_ascend<json::JsonValue,json::JsonValue>::make(__context__,nullptr,(([&]() -> json::JsonValue {
+		json::JsonValue __mks_37;
+		das_zero(__mks_37);
+		das_move((__mks_37.value),((([&]() -> TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> {
+			TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> __mkv_37;
+			das_get_variant_field<char *,8,2>::set(__mkv_37) = __v_rename_at_35;
+			return __mkv_37;
+		})())));
+		return __mks_37;
+	})())));
+}
+
+inline json::JsonValue * JV_ee50ad9073b68df9 ( Context * __context__, double __v_rename_at_39 )
+{
+	return das_auto_cast<json::JsonValue *>::cast(das_ascend<json::JsonValue,json::JsonValue>::make(__context__,nullptr,(([&]() -> json::JsonValue {
+		json::JsonValue __mks_40;
+		das_zero(__mks_40);
+		das_move((__mks_40.value),((([&]() -> TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> {
+			TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> __mkv_40;
+			das_get_variant_field<double,8,3>::set(__mkv_40) = __v_rename_at_39;
+			return __mkv_40;
+		})())));
+		return __mks_40;
+	})())));
+}
+
+inline json::JsonValue * JV_24a62d4c91875cf ( Context * __context__, bool __v_rename_at_42 )
+{
+	return das_auto_cast<json::JsonValue *>::cast(das_ascend<json::JsonValue,json::JsonValue>::make(__context__,nullptr,(([&]() -> json::JsonValue {
+		json::JsonValue __mks_43;
+		das_zero(__mks_43);
+		das_move((__mks_43.value),((([&]() -> TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> {
+			TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> __mkv_43;
+			das_get_variant_field<bool,8,4>::set(__mkv_43) = __v_rename_at_42;
+			return __mkv_43;
+		})())));
+		return __mks_43;
+	})())));
+}
+
+inline json::JsonValue * JVNull_f69e3effb8bc1460 ( Context * __context__ )
+{
+	return das_auto_cast<json::JsonValue *>::cast(das_ascend<json::JsonValue,json::JsonValue>::make(__context__,nullptr,(([&]() -> json::JsonValue {
+		json::JsonValue __mks_47;
+		das_zero(__mks_47);
+		das_move((__mks_47.value),((([&]() -> TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> {
+			TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> __mkv_47;
+			das_get_variant_field<void *,8,5>::set(__mkv_47) = nullptr;
+			return __mkv_47;
+		})())));
+		return __mks_47;
+	})())));
+}
+
+inline json::JsonValue * JV_f17b12e37633850f ( Context * __context__, TTable<char *,json::JsonValue *> &  __v_rename_at_49 )
+{
+	return das_auto_cast<json::JsonValue *>::cast(das_ascend<json::JsonValue,json::JsonValue>::make(__context__,nullptr,(([&]() -> json::JsonValue {
+		json::JsonValue __mks_50;
+		das_zero(__mks_50);
+		das_move((__mks_50.value),((([&]() -> TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> {
+			TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> __mkv_50;
+			das_get_variant_field<TTable<char *,json::JsonValue *>,8,0>::set(__mkv_50) = __v_rename_at_49;
+			return __mkv_50;
+		})())));
+		return __mks_50;
+	})())));
+}
+
+inline json::JsonValue * JV_bfd94f47b31832f5 ( Context * __context__, TArray<json::JsonValue *> &  __v_rename_at_52 )
+{
+	return das_auto_cast<json::JsonValue *>::cast(das_ascend<json::JsonValue,json::JsonValue>::make(__context__,nullptr,(([&]() -> json::JsonValue {
+		json::JsonValue __mks_53;
+		das_zero(__mks_53);
+		das_move((__mks_53.value),((([&]() -> TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> {
+			TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> __mkv_53;
+			das_get_variant_field<TArray<json::JsonValue *>,8,1>::set(__mkv_53) = __v_rename_at_52;
+			return __mkv_53;
+		})())));
+		return __mks_53;
+	})())));
+}
+
+inline Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) lexer_6f13366e445ec80f ( Context * __context__, char * const  __text_rename_at_55 )
+{
+	char * __stext_rename_at_56 = ((char *)(char *)(((char *)(builtin_string_clone(__text_rename_at_55,__context__)))));
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::cast(_lexer_a3d35dd07afab514(__context__,__stext_rename_at_56));
+}
+
+inline Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) lexer_7819f90db0d736a1 ( Context * __context__, TArray<uint8_t> const  &  __text_rename_at_59 )
+{
+	char * __stext_rename_at_60 = ((char *)(char *)(((char *)(builtin_string_from_array(__text_rename_at_59,__context__)))));
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::cast(_lexer_a3d35dd07afab514(__context__,__stext_rename_at_60));
+}
+
+inline Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) _lexer_a3d35dd07afab514 ( Context * __context__, char * __stext_rename_at_63 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::cast(_Funcbuiltin_0x60_each_e8feb1f7b51f4d2c(__context__,das_ascend<bool,json::_lambda_json_65_8_1>::make(__context__,&__type_info__9b256933f6ab83b8,(([&]() -> json::_lambda_json_65_8_1 {
+		json::_lambda_json_65_8_1 __mks_64;
+		das_zero(__mks_64);
+		das_copy((__mks_64.__lambda),(Func(__context__->fnByMangledName(/*@json::_lambda_json_65_8_1`function XS<_lambda_json_65_8_1> Y<Token>N<_string;_number;_bool;_null;_symbol;_error>0<s;d;b;1<v>?;i;s>V*/ 3065920773459908460u))));
+		das_copy((__mks_64.__finalize),(Func(__context__->fnByMangledName(/*@json::_lambda_json_65_8_1`finalizer X1<S<_lambda_json_65_8_1>>?*/ 17660587823726684952u))));
+		das_copy((__mks_64.stext),(__stext_rename_at_63));
+		return __mks_64;
+	})()))));
+}
+
+inline bool expect_token_6b816d4d512abff2 ( Context * __context__, Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) &  __itv_rename_at_149, TVariant<16,char *,double,bool,void *,int32_t,char *> &  __ahead_rename_at_149, int32_t __vindex_rename_at_149, char * & __error_rename_at_149 )
+{
+	if ( !_Funcbuiltin_0x60_next_111e5cd76980442a(__context__,das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_149),das_arg<TVariant<16,char *,double,bool,void *,int32_t,char *>>::pass(__ahead_rename_at_149)) )
+	{
+		das_copy(__error_rename_at_149,((char *) "unexected eos"));
+		return das_auto_cast<bool>::cast(false);
+	} else if ( variant_index(das_arg<TVariant<16,char *,double,bool,void *,int32_t,char *>>::pass(__ahead_rename_at_149)) != __vindex_rename_at_149 )
+	{
+		das_copy(__error_rename_at_149,das_string_builder(__context__,SimNode_AotInterop<4>(__tinfo_2, cast<char * const >::from(((char *) "unexpected ")), cast<TVariant<16,char *,double,bool,void *,int32_t,char *> &>::from(__ahead_rename_at_149), cast<char * const >::from(((char *) ", expecting variant ")), cast<int32_t>::from(__vindex_rename_at_149))));
+		return das_auto_cast<bool>::cast(false);
+	} else {
+		return das_auto_cast<bool>::cast(true);
+	};
+}
+
+inline bool expect_symbol_7680dd81b760ae55 ( Context * __context__, Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) &  __itv_rename_at_159, TVariant<16,char *,double,bool,void *,int32_t,char *> &  __ahead_rename_at_159, int32_t __sym_rename_at_159, char * & __error_rename_at_159 )
+{
+	if ( !_Funcbuiltin_0x60_next_111e5cd76980442a(__context__,das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_159),das_arg<TVariant<16,char *,double,bool,void *,int32_t,char *>>::pass(__ahead_rename_at_159)) )
+	{
+		das_copy(__error_rename_at_159,((char *) "unexected eos"));
+		return das_auto_cast<bool>::cast(false);
+	} else if ( !das_get_variant_field<int32_t,8,4>::is(__ahead_rename_at_159) )
+	{
+		das_copy(__error_rename_at_159,das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_3, cast<char * const >::from(((char *) "unexpected ")), cast<TVariant<16,char *,double,bool,void *,int32_t,char *> &>::from(__ahead_rename_at_159), cast<char * const >::from(((char *) ", expecting symbol")))));
+		return das_auto_cast<bool>::cast(false);
+	} else if ( !(das_get_variant_field<int32_t,8,4>::as(__ahead_rename_at_159,__context__) == __sym_rename_at_159) )
+	{
+		das_copy(__error_rename_at_159,das_string_builder(__context__,SimNode_AotInterop<6>(__tinfo_4, cast<char * const >::from(((char *) "unexpected ")), cast<TVariant<16,char *,double,bool,void *,int32_t,char *> &>::from(__ahead_rename_at_159), cast<char * const >::from(((char *) ", expecting symbol `")), cast<char *>::from(((char *)(to_string_char(__sym_rename_at_159,__context__)))), cast<char * const >::from(((char *) "` aka ASCII ")), cast<int32_t>::from(__sym_rename_at_159))));
+		return das_auto_cast<bool>::cast(true);
+	} else {
+		return das_auto_cast<bool>::cast(true);
+	};
+}
+
+inline json::JsonValue * parse_value_a170a8a36281327e ( Context * __context__, Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) &  __itv_rename_at_172, char * & __error_rename_at_172 )
+{
+	TVariant<16,char *,double,bool,void *,int32_t,char *> __ahead_rename_at_173; das_zero(__ahead_rename_at_173);
+	if ( !_Funcbuiltin_0x60_next_111e5cd76980442a(__context__,das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_172),das_arg<TVariant<16,char *,double,bool,void *,int32_t,char *>>::pass(__ahead_rename_at_173)) )
+	{
+		return das_auto_cast<json::JsonValue *>::cast(nullptr);
+	} else {
+		if ( das_get_variant_field<int32_t,8,4>::is(__ahead_rename_at_173) )
+		{
+			int32_t __sym_rename_at_177 = ((int32_t)das_get_variant_field<int32_t,8,4>::as(__ahead_rename_at_173,__context__));
+			if ( __sym_rename_at_177 == 93 )
+			{
+				das_copy(__error_rename_at_172,((char *) "unexpected ]"));
+				return das_auto_cast<json::JsonValue *>::cast(nullptr);
+			} else {
+				if ( __sym_rename_at_177 == 91 )
+				{
+					TArray<json::JsonValue *> __arr_rename_at_182; das_zero(__arr_rename_at_182);
+					while ( !builtin_iterator_empty(das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_172)) )
+					{
+						json::JsonValue * __value_rename_at_184 = ((json::JsonValue *)parse_value_a170a8a36281327e(__context__,das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_172),__error_rename_at_172));
+						if ( __value_rename_at_184 == nullptr )
+						{
+							if ( (SimPolicy<char *>::Equ(cast<char *>::from(__error_rename_at_172),cast<char *>::from(((char *) "unexpected ]")),*__context__,nullptr)) && (builtin_array_size(das_arg<TArray<json::JsonValue *>>::pass(__arr_rename_at_182)) == 0) )
+							{
+								das_copy(__error_rename_at_172,nullptr);
+								return das_auto_cast<json::JsonValue *>::cast(JV_bfd94f47b31832f5(__context__,das_arg<TArray<json::JsonValue *>>::pass(__arr_rename_at_182)));
+							} else {
+								return das_auto_cast<json::JsonValue *>::cast(nullptr);
+							};
+						};
+						_Funcbuiltin_0x60_push_4554057434702220(__context__,das_arg<TArray<json::JsonValue *>>::pass(__arr_rename_at_182),__value_rename_at_184);
+						if ( !expect_token_6b816d4d512abff2(__context__,das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_172),das_arg<TVariant<16,char *,double,bool,void *,int32_t,char *>>::pass(__ahead_rename_at_173),4,__error_rename_at_172) )
+						{
+							return das_auto_cast<json::JsonValue *>::cast(nullptr);
+						} else {
+							int32_t __sepsym_rename_at_193 = ((int32_t)das_get_variant_field<int32_t,8,4>::as(__ahead_rename_at_173,__context__));
+							if ( __sepsym_rename_at_193 == 93 )
+							{
+								break;
+							} else if ( __sepsym_rename_at_193 != 44 )
+							{
+								das_copy(__error_rename_at_172,das_string_builder(__context__,SimNode_AotInterop<4>(__tinfo_5, cast<char * const >::from(((char *) "unsepected array seaprator symbol `")), cast<char *>::from(((char *)(to_string_char(__sepsym_rename_at_193,__context__)))), cast<char * const >::from(((char *) "` aka ASCII ")), cast<int32_t>::from(__sepsym_rename_at_193))));
+								return das_auto_cast<json::JsonValue *>::cast(nullptr);
+							};
+						};
+					};
+					if ( builtin_iterator_empty(das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_172)) )
+					{
+						das_copy(__error_rename_at_172,((char *) "unexpected eos"));
+						return das_auto_cast<json::JsonValue *>::cast(nullptr);
+					} else {
+						return das_auto_cast<json::JsonValue *>::cast(JV_bfd94f47b31832f5(__context__,das_arg<TArray<json::JsonValue *>>::pass(__arr_rename_at_182)));
+					};
+				} else if ( __sym_rename_at_177 == 123 )
+				{
+					TTable<char *,json::JsonValue *> __tab_rename_at_204; das_zero(__tab_rename_at_204);
+					while ( !builtin_iterator_empty(das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_172)) )
+					{
+						if ( !expect_token_6b816d4d512abff2(__context__,das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_172),das_arg<TVariant<16,char *,double,bool,void *,int32_t,char *>>::pass(__ahead_rename_at_173),0,__error_rename_at_172) )
+						{
+							if ( (das_get_variant_field<int32_t,8,4>::is(__ahead_rename_at_173) && (das_get_variant_field<int32_t,8,4>::as(__ahead_rename_at_173,__context__) == 125)) && (builtin_table_size(das_arg<TTable<char *,json::JsonValue *>>::pass(__tab_rename_at_204)) == 0) )
+							{
+								das_copy(__error_rename_at_172,nullptr);
+								return das_auto_cast<json::JsonValue *>::cast(JV_f17b12e37633850f(__context__,das_arg<TTable<char *,json::JsonValue *>>::pass(__tab_rename_at_204)));
+							} else {
+								return das_auto_cast<json::JsonValue *>::cast(nullptr);
+							};
+						};
+						char * __key_rename_at_211 = ((char *)(char *)(das_get_variant_field<char *,8,0>::as(__ahead_rename_at_173,__context__)));
+						if ( !expect_symbol_7680dd81b760ae55(__context__,das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_172),das_arg<TVariant<16,char *,double,bool,void *,int32_t,char *>>::pass(__ahead_rename_at_173),58,__error_rename_at_172) )
+						{
+							return das_auto_cast<json::JsonValue *>::cast(nullptr);
+						} else {
+							json::JsonValue * __value_rename_at_214 = ((json::JsonValue *)parse_value_a170a8a36281327e(__context__,das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_172),__error_rename_at_172));
+							if ( __value_rename_at_214 == nullptr )
+							{
+								return das_auto_cast<json::JsonValue *>::cast(nullptr);
+							} else {
+								if ( _Funcbuiltin_0x60_key_exists_c934a184b60d3069(__context__,das_arg<TTable<char *,json::JsonValue *>>::pass(__tab_rename_at_204),__key_rename_at_211) )
+								{
+									das_copy(__error_rename_at_172,das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_6, cast<char * const >::from(((char *) "duplicate key ")), cast<char * const >::from(__key_rename_at_211))));
+									return das_auto_cast<json::JsonValue *>::cast(nullptr);
+								} else {
+									das_copy(__tab_rename_at_204(__key_rename_at_211,__context__),__value_rename_at_214);
+									if ( !expect_token_6b816d4d512abff2(__context__,das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_172),das_arg<TVariant<16,char *,double,bool,void *,int32_t,char *>>::pass(__ahead_rename_at_173),4,__error_rename_at_172) )
+									{
+										return das_auto_cast<json::JsonValue *>::cast(nullptr);
+									} else {
+										int32_t __sepsym_rename_at_223 = ((int32_t)das_get_variant_field<int32_t,8,4>::as(__ahead_rename_at_173,__context__));
+										if ( __sepsym_rename_at_223 == 125 )
+										{
+											break;
+										} else if ( __sepsym_rename_at_223 != 44 )
+										{
+											das_copy(__error_rename_at_172,das_string_builder(__context__,SimNode_AotInterop<4>(__tinfo_7, cast<char * const >::from(((char *) "unsepected object seaprator symbol `")), cast<char *>::from(((char *)(to_string_char(__sepsym_rename_at_223,__context__)))), cast<char * const >::from(((char *) "` aka ASCII ")), cast<int32_t>::from(__sepsym_rename_at_223))));
+											return das_auto_cast<json::JsonValue *>::cast(nullptr);
+										};
+									};
+								};
+							};
+						};
+					};
+					if ( builtin_iterator_empty(das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_172)) )
+					{
+						das_copy(__error_rename_at_172,((char *) "unexpected eos"));
+						return das_auto_cast<json::JsonValue *>::cast(nullptr);
+					} else {
+						return das_auto_cast<json::JsonValue *>::cast(JV_f17b12e37633850f(__context__,das_arg<TTable<char *,json::JsonValue *>>::pass(__tab_rename_at_204)));
+					};
+				} else {
+					das_copy(__error_rename_at_172,das_string_builder(__context__,SimNode_AotInterop<4>(__tinfo_8, cast<char * const >::from(((char *) "unexpected symbol `")), cast<char *>::from(((char *)(to_string_char(__sym_rename_at_177,__context__)))), cast<char * const >::from(((char *) "` aka ASCII ")), cast<int32_t>::from(__sym_rename_at_177))));
+					return das_auto_cast<json::JsonValue *>::cast(nullptr);
+				};
+			};
+		} else if ( das_get_variant_field<char *,8,0>::is(__ahead_rename_at_173) )
+		{
+			return das_auto_cast<json::JsonValue *>::cast(JV_329cd26089c5824a(__context__,das_get_variant_field<char *,8,0>::as(__ahead_rename_at_173,__context__)));
+		} else if ( das_get_variant_field<double,8,1>::is(__ahead_rename_at_173) )
+		{
+			return das_auto_cast<json::JsonValue *>::cast(JV_ee50ad9073b68df9(__context__,das_get_variant_field<double,8,1>::as(__ahead_rename_at_173,__context__)));
+		} else if ( das_get_variant_field<bool,8,2>::is(__ahead_rename_at_173) )
+		{
+			return das_auto_cast<json::JsonValue *>::cast(JV_24a62d4c91875cf(__context__,das_get_variant_field<bool,8,2>::as(__ahead_rename_at_173,__context__)));
+		} else if ( das_get_variant_field<void *,8,3>::is(__ahead_rename_at_173) )
+		{
+			return das_auto_cast<json::JsonValue *>::cast(JVNull_f69e3effb8bc1460(__context__));
+		} else {
+			das_copy(__error_rename_at_172,das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_9, cast<TVariant<16,char *,double,bool,void *,int32_t,char *> &>::from(__ahead_rename_at_173))));
+			return das_auto_cast<json::JsonValue *>::cast(nullptr);
+		};
+	};
+}
+
+inline json::JsonValue * read_json_87a307c27c5414f4 ( Context * __context__, char * const  __text_rename_at_248, char * & __error_rename_at_248 )
+{
+	Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) __lex_rename_at_251; das_zero(__lex_rename_at_251); das_move(__lex_rename_at_251, lexer_6f13366e445ec80f(__context__,__text_rename_at_248));
+	json::JsonValue * __res_rename_at_252 = ((json::JsonValue *)parse_value_a170a8a36281327e(__context__,das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__lex_rename_at_251),__error_rename_at_248));
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__lex_rename_at_251),__context__);
+	return das_auto_cast<json::JsonValue *>::cast(__res_rename_at_252);
+}
+
+inline json::JsonValue * read_json_5ad42e6aecdc083b ( Context * __context__, TArray<uint8_t> const  &  __text_rename_at_256, char * & __error_rename_at_256 )
+{
+	Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) __lex_rename_at_257; das_zero(__lex_rename_at_257); das_move(__lex_rename_at_257, lexer_7819f90db0d736a1(__context__,__text_rename_at_256));
+	json::JsonValue * __res_rename_at_258 = ((json::JsonValue *)parse_value_a170a8a36281327e(__context__,das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__lex_rename_at_257),__error_rename_at_256));
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__lex_rename_at_257),__context__);
+	return das_auto_cast<json::JsonValue *>::cast(__res_rename_at_258);
+}
+
+inline void write_value_96cf53d6e3bd6ab6 ( Context * __context__, StringBuilderWriter &  __writer_rename_at_263, json::JsonValue * const  __jsv_rename_at_263, int32_t __depth_rename_at_263 )
+{
+	if ( __jsv_rename_at_263 == nullptr )
+	{
+		das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_10,cast<StringBuilderWriter &>::from(__writer_rename_at_263),cast<char * const >::from(((char *) "null"))));
+	} else if ( das_get_variant_field<char *,8,2>::is(__jsv_rename_at_263->value) )
+	{
+		das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_11,cast<StringBuilderWriter &>::from(__writer_rename_at_263),cast<char * const >::from(((char *) "\""))));
+		write_escape_string(das_arg<StringBuilderWriter>::pass(__writer_rename_at_263),das_get_variant_field<char *,8,2>::as(__jsv_rename_at_263->value,__context__));
+		das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_12,cast<StringBuilderWriter &>::from(__writer_rename_at_263),cast<char * const >::from(((char *) "\""))));
+	} else if ( das_get_variant_field<double,8,3>::is(__jsv_rename_at_263->value) )
+	{
+		das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_13,cast<StringBuilderWriter &>::from(__writer_rename_at_263),cast<double>::from(das_get_variant_field<double,8,3>::as(__jsv_rename_at_263->value,__context__))));
+	} else if ( das_get_variant_field<TArray<json::JsonValue *>,8,1>::is(__jsv_rename_at_263->value) )
+	{
+		if ( builtin_array_size(das_get_variant_field<TArray<json::JsonValue *>,8,1>::as(__jsv_rename_at_263->value,__context__)) == 0 )
+		{
+			das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_14,cast<StringBuilderWriter &>::from(__writer_rename_at_263),cast<char * const >::from(((char *) "[]"))));
+		} else {
+			das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_15,cast<StringBuilderWriter &>::from(__writer_rename_at_263),cast<char * const >::from(((char *) "[\n"))));
+			bool __first_rename_at_277 = true;
+			{
+				uint64_t __loop_count_278 = UINT64_MAX;
+				// elem : json::JsonValue? const&
+				das_iterator<TArray<json::JsonValue *> const > __elem_iterator(das_get_variant_field<TArray<json::JsonValue *>,8,1>::as(__jsv_rename_at_263->value,__context__));
+				json::JsonValue * const  * __elem_rename_at_278;
+				__loop_count_278 = das_loop_count(__loop_count_278,__elem_iterator.loop_begin(__context__,(__elem_rename_at_278)));
+				for ( ; __loop_count_278 ; --__loop_count_278, ++__elem_rename_at_278 )
+				{
+					if ( __first_rename_at_277 )
+					{
+						das_copy(__first_rename_at_277,false);
+					} else {
+						das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_16,cast<StringBuilderWriter &>::from(__writer_rename_at_263),cast<char * const >::from(((char *) ",\n"))));
+					};
+					write_string_chars(das_arg<StringBuilderWriter>::pass(__writer_rename_at_263),9,__depth_rename_at_263 + 1);
+					write_value_96cf53d6e3bd6ab6(__context__,das_arg<StringBuilderWriter>::pass(__writer_rename_at_263),(*__elem_rename_at_278),__depth_rename_at_263 + 1);
+				}
+				__elem_iterator.loop_end(__context__,(__elem_rename_at_278));
+			};
+			das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_17,cast<StringBuilderWriter &>::from(__writer_rename_at_263),cast<char * const >::from(((char *) "\n"))));
+			write_string_chars(das_arg<StringBuilderWriter>::pass(__writer_rename_at_263),9,__depth_rename_at_263);
+			das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_18,cast<StringBuilderWriter &>::from(__writer_rename_at_263),cast<char * const >::from(((char *) "]"))));
+		};
+	} else if ( das_get_variant_field<TTable<char *,json::JsonValue *>,8,0>::is(__jsv_rename_at_263->value) )
+	{
+		if ( builtin_table_size(das_get_variant_field<TTable<char *,json::JsonValue *>,8,0>::as(__jsv_rename_at_263->value,__context__)) == 0 )
+		{
+			das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_19,cast<StringBuilderWriter &>::from(__writer_rename_at_263),cast<char * const >::from(((char *) "{}"))));
+		} else {
+			Sequence DAS_COMMENT((char * *)) _temp_make_local_294_80;
+			Sequence DAS_COMMENT((json::JsonValue * *)) _temp_make_local_294_96;
+			das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_20,cast<StringBuilderWriter &>::from(__writer_rename_at_263),cast<char * const >::from(((char *) "{\n"))));
+			bool __first_rename_at_293 = true;
+			{
+				bool __need_loop_294 = true;
+				// elemK : string const&
+				das_iterator<Sequence DAS_COMMENT((char * const ))> __elemK_iterator((_temp_make_local_294_80 = (_Funcbuiltin_0x60_keys_94c2131db976b1fb(__context__,das_get_variant_field<TTable<char *,json::JsonValue *>,8,0>::as(__jsv_rename_at_263->value,__context__)))));
+				char * const  * __elemK_rename_at_294;
+				__need_loop_294 = __elemK_iterator.first(__context__,(__elemK_rename_at_294)) && __need_loop_294;
+				// elemV : json::JsonValue? const&
+				das_iterator<Sequence DAS_COMMENT((json::JsonValue * const ))> __elemV_iterator((_temp_make_local_294_96 = (_Funcbuiltin_0x60_values_bc20d784425b4a8c(__context__,das_get_variant_field<TTable<char *,json::JsonValue *>,8,0>::as(__jsv_rename_at_263->value,__context__)))));
+				json::JsonValue * const  * __elemV_rename_at_294;
+				__need_loop_294 = __elemV_iterator.first(__context__,(__elemV_rename_at_294)) && __need_loop_294;
+				for ( ; __need_loop_294 ; __need_loop_294 = __elemK_iterator.next(__context__,(__elemK_rename_at_294)) && __elemV_iterator.next(__context__,(__elemV_rename_at_294)) )
+				{
+					if ( __first_rename_at_293 )
+					{
+						das_copy(__first_rename_at_293,false);
+					} else {
+						das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_21,cast<StringBuilderWriter &>::from(__writer_rename_at_263),cast<char * const >::from(((char *) ",\n"))));
+					};
+					write_string_chars(das_arg<StringBuilderWriter>::pass(__writer_rename_at_263),9,__depth_rename_at_263 + 1);
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_22,cast<StringBuilderWriter &>::from(__writer_rename_at_263),cast<char * const >::from(((char *) "\""))));
+					write_escape_string(das_arg<StringBuilderWriter>::pass(__writer_rename_at_263),(*__elemK_rename_at_294));
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_23,cast<StringBuilderWriter &>::from(__writer_rename_at_263),cast<char * const >::from(((char *) "\" : "))));
+					write_value_96cf53d6e3bd6ab6(__context__,das_arg<StringBuilderWriter>::pass(__writer_rename_at_263),(*__elemV_rename_at_294),__depth_rename_at_263 + 1);
+				}
+				__elemK_iterator.close(__context__,(__elemK_rename_at_294));
+				__elemV_iterator.close(__context__,(__elemV_rename_at_294));
+			};
+			das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_24,cast<StringBuilderWriter &>::from(__writer_rename_at_263),cast<char * const >::from(((char *) "\n"))));
+			write_string_chars(das_arg<StringBuilderWriter>::pass(__writer_rename_at_263),9,__depth_rename_at_263);
+			das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_25,cast<StringBuilderWriter &>::from(__writer_rename_at_263),cast<char * const >::from(((char *) "}"))));
+		};
+	} else if ( das_get_variant_field<bool,8,4>::is(__jsv_rename_at_263->value) )
+	{
+		if ( das_get_variant_field<bool,8,4>::as(__jsv_rename_at_263->value,__context__) )
+		{
+			das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_26,cast<StringBuilderWriter &>::from(__writer_rename_at_263),cast<char * const >::from(((char *) "true"))));
+		} else {
+			das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_27,cast<StringBuilderWriter &>::from(__writer_rename_at_263),cast<char * const >::from(((char *) "false"))));
+		};
+	} else if ( das_get_variant_field<void *,8,5>::is(__jsv_rename_at_263->value) )
+	{
+		das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_28,cast<StringBuilderWriter &>::from(__writer_rename_at_263),cast<char * const >::from(((char *) "null"))));
+	} else {
+		builtin_throw(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_29, cast<char * const >::from(((char *) "unexpected ")), cast<json::JsonValue * const >::from(__jsv_rename_at_263))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	};
+}
+
+inline char * write_json_482d9d25c376b07e ( Context * __context__, json::JsonValue * const  __val_rename_at_317 )
+{
+	char * __st_rename_at_319 = ((char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_319)->void{
+		write_value_96cf53d6e3bd6ab6(__context__,das_arg<StringBuilderWriter>::pass(__writer_rename_at_319),__val_rename_at_317,0);
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))));
+	return das_auto_cast<char *>::cast(__st_rename_at_319);
+}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_finalize_7f972184337f6d1a
+	aotLib[0x561a74dd5f0a18cd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint8_t> &  ),&_Funcbuiltin_0x60_finalize_7f972184337f6d1a>>();
+	};
+	// finalize_f6eedda5c8622ae5
+	aotLib[0x6848035c713514cb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, json::_lambda_json_65_8_1 &  ),&finalize_f6eedda5c8622ae5>>();
+	};
+	// _Funcbuiltin_0x60_each_e8feb1f7b51f4d2c
+	aotLib[0xb360d952be0333f1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,TVariant<16,char *,double,bool,void *,int32_t,char *>)) const   ),&_Funcbuiltin_0x60_each_e8feb1f7b51f4d2c>>();
+	};
+	// _Funcbuiltin_0x60_each_930293dc0a86c983
+	aotLib[0x2968b028571ae799] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, char * const   ),&_Funcbuiltin_0x60_each_930293dc0a86c983>>();
+	};
+	// _Funcbuiltin_0x60_next_6a3c01874ce3fb9a
+	aotLib[0x858cb271b8b30095] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & , int32_t &  ),&_Funcbuiltin_0x60_next_6a3c01874ce3fb9a>>();
+	};
+	// _Funcbuiltin_0x60_push_e5de83ceac06608f
+	aotLib[0x301df73651096bd1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint8_t> & , uint8_t  ),&_Funcbuiltin_0x60_push_e5de83ceac06608f>>();
+	};
+	// _Func_lambda_json_65_8_1_0x60_function_e1ee21994054cac5
+	aotLib[0xe20092f9283cac2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, json::_lambda_json_65_8_1 & , TVariant<16,char *,double,bool,void *,int32_t,char *> &  ),&_Func_lambda_json_65_8_1_0x60_function_e1ee21994054cac5>>();
+	};
+	// _Func_lambda_json_65_8_1_0x60_finalizer_726f2708e8e63a9a
+	aotLib[0x82ec533c6c2c9814] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, json::_lambda_json_65_8_1 *  ),&_Func_lambda_json_65_8_1_0x60_finalizer_726f2708e8e63a9a>>();
+	};
+	// _Funcbuiltin_0x60_next_111e5cd76980442a
+	aotLib[0x827000f583a69705] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) const  & , TVariant<16,char *,double,bool,void *,int32_t,char *> &  ),&_Funcbuiltin_0x60_next_111e5cd76980442a>>();
+	};
+	// _Funcbuiltin_0x60_push_4554057434702220
+	aotLib[0xe5354b3d3764653d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<json::JsonValue *> & , json::JsonValue * const   ),&_Funcbuiltin_0x60_push_4554057434702220>>();
+	};
+	// _Funcbuiltin_0x60_key_exists_c934a184b60d3069
+	aotLib[0x2c503715ca55de6d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<char *,json::JsonValue *> const  & , char * const   ),&_Funcbuiltin_0x60_key_exists_c934a184b60d3069>>();
+	};
+	// _Funcbuiltin_0x60_keys_94c2131db976b1fb
+	aotLib[0x6a947dbba4eaa181] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((char * const  &)) (*) ( Context * __context__, TTable<char *,json::JsonValue *> const  &  ),&_Funcbuiltin_0x60_keys_94c2131db976b1fb>>();
+	};
+	// _Funcbuiltin_0x60_values_bc20d784425b4a8c
+	aotLib[0x437311998d7de839] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((json::JsonValue * const  &)) (*) ( Context * __context__, TTable<char *,json::JsonValue *> const  &  ),&_Funcbuiltin_0x60_values_bc20d784425b4a8c>>();
+	};
+	// JV_329cd26089c5824a
+	aotLib[0x1f7c2fe3543bf51] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<json::JsonValue * (*) ( Context * __context__, char * const   ),&JV_329cd26089c5824a>>();
+	};
+	// JV_ee50ad9073b68df9
+	aotLib[0xc016fe6e965ccaf5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<json::JsonValue * (*) ( Context * __context__, double  ),&JV_ee50ad9073b68df9>>();
+	};
+	// JV_24a62d4c91875cf
+	aotLib[0x2321ec94c7a94475] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<json::JsonValue * (*) ( Context * __context__, bool  ),&JV_24a62d4c91875cf>>();
+	};
+	// JVNull_f69e3effb8bc1460
+	aotLib[0xd098378fe88b722d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<json::JsonValue * (*) ( Context * __context__ ),&JVNull_f69e3effb8bc1460>>();
+	};
+	// JV_f17b12e37633850f
+	aotLib[0xd5124109bd7c8175] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<json::JsonValue * (*) ( Context * __context__, TTable<char *,json::JsonValue *> &  ),&JV_f17b12e37633850f>>();
+	};
+	// JV_bfd94f47b31832f5
+	aotLib[0x21e9b1e35f7128a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<json::JsonValue * (*) ( Context * __context__, TArray<json::JsonValue *> &  ),&JV_bfd94f47b31832f5>>();
+	};
+	// lexer_6f13366e445ec80f
+	aotLib[0xa4ca6c93ef0f9a6e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) (*) ( Context * __context__, char * const   ),&lexer_6f13366e445ec80f>>();
+	};
+	// lexer_7819f90db0d736a1
+	aotLib[0xf4fc34e47510627e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) (*) ( Context * __context__, TArray<uint8_t> const  &  ),&lexer_7819f90db0d736a1>>();
+	};
+	// _lexer_a3d35dd07afab514
+	aotLib[0xad2765ac5ba1b024] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) (*) ( Context * __context__, char *  ),&_lexer_a3d35dd07afab514>>();
+	};
+	// expect_token_6b816d4d512abff2
+	aotLib[0x3dd21e685181205a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) & , TVariant<16,char *,double,bool,void *,int32_t,char *> & , int32_t , char * &  ),&expect_token_6b816d4d512abff2>>();
+	};
+	// expect_symbol_7680dd81b760ae55
+	aotLib[0x658b5461efcd2266] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) & , TVariant<16,char *,double,bool,void *,int32_t,char *> & , int32_t , char * &  ),&expect_symbol_7680dd81b760ae55>>();
+	};
+	// parse_value_a170a8a36281327e
+	aotLib[0x31a3387a2f36d50a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<json::JsonValue * (*) ( Context * __context__, Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) & , char * &  ),&parse_value_a170a8a36281327e>>();
+	};
+	// read_json_87a307c27c5414f4
+	aotLib[0x7df09ab5250a5999] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<json::JsonValue * (*) ( Context * __context__, char * const  , char * &  ),&read_json_87a307c27c5414f4>>();
+	};
+	// read_json_5ad42e6aecdc083b
+	aotLib[0x1ec8a42933fdff65] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<json::JsonValue * (*) ( Context * __context__, TArray<uint8_t> const  & , char * &  ),&read_json_5ad42e6aecdc083b>>();
+	};
+	// write_value_96cf53d6e3bd6ab6
+	aotLib[0x7c678b83423624e8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, StringBuilderWriter & , json::JsonValue * const  , int32_t  ),&write_value_96cf53d6e3bd6ab6>>();
+	};
+	// write_json_482d9d25c376b07e
+	aotLib[0xd957577cac4068ee] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, json::JsonValue * const   ),&write_json_482d9d25c376b07e>>();
+	};
+	// [[ init script ]]
+	aotLib[0x6f5a3c0bb98592fe] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,208 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require random
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_9039956065963159497 {
+
+
+
+
+inline int4 random_seed_40d32f1495a9708e ( Context * __context__, int32_t __seed_rename_at_13 );
+inline float4 random_seed2D_ae989717cef1a9 ( Context * __context__, int4 & __seed_rename_at_17, int2 __co_rename_at_17, int32_t __cf_rename_at_17 );
+inline int32_t random_int_146f4cbc5aba3b21 ( Context * __context__, int4 & __seed_rename_at_23 );
+inline int32_t random_big_int_1121aa31acceffb7 ( Context * __context__, int4 & __seed_rename_at_28 );
+inline int4 random_int4_328b2382cfdb0a5d ( Context * __context__, int4 & __seed_rename_at_34 );
+inline float random_float_d52cfc74a117bcdc ( Context * __context__, int4 & __seed_rename_at_39 );
+inline float4 random_float4_8045f5bc0acfeef2 ( Context * __context__, int4 & __seed_rename_at_43 );
+inline float3 random_unit_vector_fbd4a09c103a1d75 ( Context * __context__, int4 & __seed_rename_at_47 );
+inline float3 random_in_unit_sphere_825789d047fbf19b ( Context * __context__, int4 & __seed_rename_at_57 );
+inline float3 random_in_unit_disk_d059eebe79cc7bca ( Context * __context__, int4 & __seed_rename_at_66 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int32_t,0x631b65186da051bd>(__context__) = 32767;/*LCG_RAND_MAX*/
+	das_global<int32_t,0x12e504fdf70159ba>(__context__) = 1073741823;/*LCG_RAND_MAX_BIG*/
+	das_global<float,0x4ad3ade19e4ca1c8>(__context__) = 3.05185094e-05f;/*LCG_IRAND_MAX_FLT*/
+}
+
+inline int4 random_seed_40d32f1495a9708e ( Context * __context__, int32_t __seed_rename_at_13 )
+{
+	return das_auto_cast<int4>::cast(int4(__seed_rename_at_13,__seed_rename_at_13 + 1,__seed_rename_at_13 + 2,__seed_rename_at_13 + 3));
+}
+
+inline float4 random_seed2D_ae989717cef1a9 ( Context * __context__, int4 & __seed_rename_at_17, int2 __co_rename_at_17, int32_t __cf_rename_at_17 )
+{
+	float __prnd_rename_at_19 = ((float)(SimPolicy<float>::Sin(dot2(cvt_ifloat2(das_swizzle_seq<int2,int2 const ,0>::swizzle(__co_rename_at_17) /*xy*/),v_make_vec4f(12.9898005f,78.2330017f,0.f,0.f)),*__context__,nullptr) * 43758.5469f));
+	das_copy(__seed_rename_at_17,random_seed_40d32f1495a9708e(__context__,int32_t(__prnd_rename_at_19) + __cf_rename_at_17));
+	return das_auto_cast<float4>::cast(random_float4_8045f5bc0acfeef2(__context__,__seed_rename_at_17));
+}
+
+inline int32_t random_int_146f4cbc5aba3b21 ( Context * __context__, int4 & __seed_rename_at_23 )
+{
+	das_copy(das_swizzle_ref<int32_t,int4,0>::swizzle(__seed_rename_at_23) /*x*/,(v_extract_xi(v_cast_vec4i(__seed_rename_at_23)) /*x*/ * 214013) + 2531011);
+	return das_auto_cast<int32_t>::cast(int32_t((v_extract_xi(v_cast_vec4i(__seed_rename_at_23)) /*x*/ >> 16) & 32767));
+}
+
+inline int32_t random_big_int_1121aa31acceffb7 ( Context * __context__, int4 & __seed_rename_at_28 )
+{
+	das_copy(__seed_rename_at_28,SimPolicy<int4>::Add((SimPolicy<int4>::Mul(int4(214013,214013,214013,214013),__seed_rename_at_28,*__context__,nullptr)),int4(2531011,2531011,2531011,2531011),*__context__,nullptr));
+	int2 __i12_rename_at_31 = ((int2)(SimPolicy<int2>::BinAnd((SimPolicy<int2>::BinShr(das_swizzle_seq<int2,int4,0>::swizzle(__seed_rename_at_28) /*xy*/,cast<int32_t>::from(16),*__context__,nullptr)),int2(32767,32767),*__context__,nullptr)));
+	return das_auto_cast<int32_t>::cast(v_extract_xi(v_cast_vec4i(__i12_rename_at_31)) /*x*/ + (v_extract_yi(v_cast_vec4i(__i12_rename_at_31)) /*y*/ * 32768));
+}
+
+inline int4 random_int4_328b2382cfdb0a5d ( Context * __context__, int4 & __seed_rename_at_34 )
+{
+	das_copy(__seed_rename_at_34,SimPolicy<int4>::Add((SimPolicy<int4>::Mul(int4(214013,214013,214013,214013),__seed_rename_at_34,*__context__,nullptr)),int4(2531011,2531011,2531011,2531011),*__context__,nullptr));
+	return das_auto_cast<int4>::cast(SimPolicy<int4>::BinAnd((SimPolicy<int4>::BinShr(__seed_rename_at_34,cast<int32_t>::from(16),*__context__,nullptr)),int4(32767,32767,32767,32767),*__context__,nullptr));
+}
+
+inline float random_float_d52cfc74a117bcdc ( Context * __context__, int4 & __seed_rename_at_39 )
+{
+	return das_auto_cast<float>::cast(float(random_int_146f4cbc5aba3b21(__context__,__seed_rename_at_39)) * 3.05185094e-05f);
+}
+
+inline float4 random_float4_8045f5bc0acfeef2 ( Context * __context__, int4 & __seed_rename_at_43 )
+{
+	return das_auto_cast<float4>::cast(SimPolicy<float4>::Mul(cvt_ifloat4(random_int4_328b2382cfdb0a5d(__context__,__seed_rename_at_43)),v_splats(3.05185094e-05f),*__context__,nullptr));
+}
+
+inline float3 random_unit_vector_fbd4a09c103a1d75 ( Context * __context__, int4 & __seed_rename_at_47 )
+{
+	float4 __zz_rename_at_49 = ((float4)random_float4_8045f5bc0acfeef2(__context__,__seed_rename_at_47));
+	float __z_rename_at_50 = ((float)((v_extract_x(__zz_rename_at_49) /*x*/ * 2.f) - 1.f));
+	float __a_rename_at_51 = ((float)(v_extract_y(__zz_rename_at_49) /*y*/ * 6.28318548f));
+	float __r_rename_at_52 = ((float)SimPolicy<float>::Sqrt(1.f - (__z_rename_at_50 * __z_rename_at_50),*__context__,nullptr));
+	float __x_rename_at_53 = 0; float __y_rename_at_53 = 0;
+	sincosF(__a_rename_at_51,__x_rename_at_53,__y_rename_at_53);
+	return das_auto_cast<float3>::cast(float3(__r_rename_at_52 * __x_rename_at_53,__r_rename_at_52 * __y_rename_at_53,__z_rename_at_50));
+}
+
+inline float3 random_in_unit_sphere_825789d047fbf19b ( Context * __context__, int4 & __seed_rename_at_57 )
+{
+	while ( true )
+	{
+		float3 __r_rename_at_60 = ((float3)das_swizzle_seq<float3,float4,0>::swizzle(random_float4_8045f5bc0acfeef2(__context__,__seed_rename_at_57)) /*xyz*/);
+		float3 __p_rename_at_61 = ((float3)(SimPolicy<float3>::Sub((SimPolicy<float3>::Mul(v_splats(2.f),__r_rename_at_60,*__context__,nullptr)),v_splats(1.f),*__context__,nullptr)));
+		if ( lengthSq3(__p_rename_at_61) <= 1.f )
+		{
+			return das_auto_cast<float3>::cast(__p_rename_at_61);
+		};
+	};
+	return das_auto_cast<float3>::cast(v_zero());
+}
+
+inline float3 random_in_unit_disk_d059eebe79cc7bca ( Context * __context__, int4 & __seed_rename_at_66 )
+{
+	while ( true )
+	{
+		float2 __R_rename_at_69 = ((float2)das_swizzle_seq<float2,float4,0>::swizzle(random_float4_8045f5bc0acfeef2(__context__,__seed_rename_at_66)) /*xy*/);
+		float3 __r_rename_at_70 = ((float3)float3(v_extract_x(__R_rename_at_69) /*x*/,v_extract_y(__R_rename_at_69) /*y*/,0.f));
+		float3 __p_rename_at_71 = ((float3)(SimPolicy<float3>::Sub((SimPolicy<float3>::Mul(v_splats(2.f),__r_rename_at_70,*__context__,nullptr)),v_make_vec4f(1.f,1.f,0.f,0.f),*__context__,nullptr)));
+		if ( lengthSq3(__p_rename_at_71) <= 1.f )
+		{
+			return das_auto_cast<float3>::cast(__p_rename_at_71);
+		};
+	};
+	return das_auto_cast<float3>::cast(v_zero());
+}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// random_seed_40d32f1495a9708e
+	aotLib[0xa88480072784083d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int4 (*) ( Context * __context__, int32_t  ),&random_seed_40d32f1495a9708e>>();
+	};
+	// random_seed2D_ae989717cef1a9
+	aotLib[0xa778f5b98b84cb5f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float4 (*) ( Context * __context__, int4 & , int2 , int32_t  ),&random_seed2D_ae989717cef1a9>>();
+	};
+	// random_int_146f4cbc5aba3b21
+	aotLib[0xf5dca9731782be0d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int4 &  ),&random_int_146f4cbc5aba3b21>>();
+	};
+	// random_big_int_1121aa31acceffb7
+	aotLib[0x6bb9cb8d4ef64d3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int4 &  ),&random_big_int_1121aa31acceffb7>>();
+	};
+	// random_int4_328b2382cfdb0a5d
+	aotLib[0x3dd1ad6cd8e12835] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int4 (*) ( Context * __context__, int4 &  ),&random_int4_328b2382cfdb0a5d>>();
+	};
+	// random_float_d52cfc74a117bcdc
+	aotLib[0x3f7c461c2a4651d6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, int4 &  ),&random_float_d52cfc74a117bcdc>>();
+	};
+	// random_float4_8045f5bc0acfeef2
+	aotLib[0x756fea66bd1726c2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float4 (*) ( Context * __context__, int4 &  ),&random_float4_8045f5bc0acfeef2>>();
+	};
+	// random_unit_vector_fbd4a09c103a1d75
+	aotLib[0xf43b622361dfa7d9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float3 (*) ( Context * __context__, int4 &  ),&random_unit_vector_fbd4a09c103a1d75>>();
+	};
+	// random_in_unit_sphere_825789d047fbf19b
+	aotLib[0xeda5e88ef87ec6f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float3 (*) ( Context * __context__, int4 &  ),&random_in_unit_sphere_825789d047fbf19b>>();
+	};
+	// random_in_unit_disk_d059eebe79cc7bca
+	aotLib[0xd431f41429660665] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float3 (*) ( Context * __context__, int4 &  ),&random_in_unit_disk_d059eebe79cc7bca>>();
+	};
+	// [[ init script ]]
+	aotLib[0xb10e493287e21043] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
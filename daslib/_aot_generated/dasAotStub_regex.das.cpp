@@ -0,0 +1,1979 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require regex
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_9878276369668962785 {
+
+extern StructInfo __struct_info__90edff79ff0df263;
+extern StructInfo __struct_info__290109a00f355a1d;
+extern TypeInfo __type_info__5bbf416596e6e12a;
+extern TypeInfo __type_info__e375858168db8b63;
+extern TypeInfo __type_info__8c48207b56753d8;
+extern TypeInfo __type_info__af63ee4c86020b22;
+extern TypeInfo __type_info__b3120c480d69888a;
+extern TypeInfo __type_info__90f3d07b5a6ca13;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__4ae00d463a05655b;
+extern TypeInfo __type_info__1dafad4a6313ad41;
+extern TypeInfo __type_info__90f5707b5a6f641;
+extern TypeInfo __type_info__a0ce46235c7fd6e1;
+extern TypeInfo __type_info__1c40a39445126ec1;
+extern TypeInfo __type_info__6ee471041d873632;
+extern TypeInfo __type_info__af63ef4c86020cd5;
+extern VarInfo __var_info__801eea2cbd01ab82;
+extern VarInfo __var_info__46c4aae68974013c;
+extern VarInfo __var_info__f125177ee5074a2c;
+extern VarInfo __var_info__aaae75eb4558282c;
+extern VarInfo __var_info__cba517eb5789f971;
+extern VarInfo __var_info__ca591566b6160624;
+extern VarInfo __var_info__6f2a8bb3467ac7d1;
+extern VarInfo __var_info__12d7fe1ad414e6f2;
+extern VarInfo __var_info__5a36e0359ac4e7fc;
+extern VarInfo __var_info__20ea36bbd9f9b28f;
+extern VarInfo __var_info__99c9e869cdf5f631;
+extern VarInfo __var_info__1e6cc86183fe900e;
+extern VarInfo __var_info__332d1622b8fd2ba3;
+extern VarInfo __var_info__e08612711dd137b5;
+extern VarInfo __var_info__d8f7c7f7e9d5352;
+extern VarInfo __var_info__ca6d1566b626af2e;
+extern VarInfo __var_info__1db89f878375c2fe;
+extern VarInfo __var_info__f875633c0f2dbe29;
+extern VarInfo __var_info__44afa437fceca048;
+extern VarInfo __var_info__ca521566b60fe776;
+extern FuncInfo __func_info__87bf23f355201ee1;
+extern EnumInfo __enum_info__c6a7b3ce425cb39a;
+
+EnumValueInfo __enum_info__c6a7b3ce425cb39a_value_0 = { (char*)"Char", 0 };
+EnumValueInfo __enum_info__c6a7b3ce425cb39a_value_1 = { (char*)"Set", 1 };
+EnumValueInfo __enum_info__c6a7b3ce425cb39a_value_2 = { (char*)"Any", 2 };
+EnumValueInfo __enum_info__c6a7b3ce425cb39a_value_3 = { (char*)"Eos", 3 };
+EnumValueInfo __enum_info__c6a7b3ce425cb39a_value_4 = { (char*)"Group", 4 };
+EnumValueInfo __enum_info__c6a7b3ce425cb39a_value_5 = { (char*)"Plus", 5 };
+EnumValueInfo __enum_info__c6a7b3ce425cb39a_value_6 = { (char*)"Star", 6 };
+EnumValueInfo __enum_info__c6a7b3ce425cb39a_value_7 = { (char*)"Question", 7 };
+EnumValueInfo __enum_info__c6a7b3ce425cb39a_value_8 = { (char*)"Concat", 8 };
+EnumValueInfo __enum_info__c6a7b3ce425cb39a_value_9 = { (char*)"Union", 9 };
+EnumValueInfo * __enum_info__c6a7b3ce425cb39a_values [] = { &__enum_info__c6a7b3ce425cb39a_value_0, &__enum_info__c6a7b3ce425cb39a_value_1, &__enum_info__c6a7b3ce425cb39a_value_2, &__enum_info__c6a7b3ce425cb39a_value_3, &__enum_info__c6a7b3ce425cb39a_value_4, &__enum_info__c6a7b3ce425cb39a_value_5, &__enum_info__c6a7b3ce425cb39a_value_6, &__enum_info__c6a7b3ce425cb39a_value_7, &__enum_info__c6a7b3ce425cb39a_value_8, &__enum_info__c6a7b3ce425cb39a_value_9 };
+EnumInfo __enum_info__c6a7b3ce425cb39a = { (char*)"ReOp", (char*)"regex", __enum_info__c6a7b3ce425cb39a_values, 10, 0xc6a7b3ce425cb39aul };
+VarInfo __struct_info__90edff79ff0df263_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4ae00d463a05655b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, 0x6f2a8bb3467ac7d1ul, "root", 0 };
+VarInfo __struct_info__90edff79ff0df263_field_1 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8c48207b56753d8, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0xd8f7c7f7e9d5352ul, "match", 8 };
+VarInfo __struct_info__90edff79ff0df263_field_2 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__5bbf416596e6e12a, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 24, 0xf875633c0f2dbe29ul, "groups", 16 };
+uint32_t __type_info__f125177ee5074a2c_dim_var_10443284010377278051[1] = { 8 };
+VarInfo __struct_info__90edff79ff0df263_field_3 =  { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 1, __type_info__f125177ee5074a2c_dim_var_10443284010377278051, 30, 32, 0xf125177ee5074a2cul, "earlyOut", 40 };
+VarInfo __struct_info__90edff79ff0df263_field_4 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, 0x46c4aae68974013cul, "canEarlyOut", 72 };
+VarInfo * __struct_info__90edff79ff0df263_fields[5] =  { &__struct_info__90edff79ff0df263_field_0, &__struct_info__90edff79ff0df263_field_1, &__struct_info__90edff79ff0df263_field_2, &__struct_info__90edff79ff0df263_field_3, &__struct_info__90edff79ff0df263_field_4 };
+StructInfo __struct_info__90edff79ff0df263 = {(char*)"Regex", (char*)"regex", 28, __struct_info__90edff79ff0df263_fields, 5, 80, 0x0ul, nullptr, 0x90edff79ff0df263ul };
+VarInfo __struct_info__290109a00f355a1d_field_0 =  { Type::tEnumeration, nullptr, &__enum_info__c6a7b3ce425cb39a, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xca591566b6160624ul, "op", 0 };
+VarInfo __struct_info__290109a00f355a1d_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xca521566b60fe776ul, "id", 4 };
+TypeInfo * __type_info__1e6cc86183fe900e_arg_types_var_2954653413586328093[3] = { &__type_info__1c40a39445126ec1, &__type_info__e375858168db8b63, &__type_info__a0ce46235c7fd6e1 };
+VarInfo __struct_info__290109a00f355a1d_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__b3120c480d69888a, nullptr, (TypeInfo **)__type_info__1e6cc86183fe900e_arg_types_var_2954653413586328093, nullptr, 3, 0, nullptr, 28, 8, 0x1e6cc86183fe900eul, "fun2", 8 };
+VarInfo __struct_info__290109a00f355a1d_field_3 =  { Type::tRange, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 8, 0xca6d1566b626af2eul, "at", 16 };
+VarInfo __struct_info__290109a00f355a1d_field_4 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, 0xaaae75eb4558282cul, "text", 24 };
+VarInfo __struct_info__290109a00f355a1d_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0x332d1622b8fd2ba3ul, "textLen", 32 };
+VarInfo __struct_info__290109a00f355a1d_field_6 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__e375858168db8b63, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 24, 0x1db89f878375c2feul, "all", 40 };
+VarInfo __struct_info__290109a00f355a1d_field_7 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4ae00d463a05655b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, 0x801eea2cbd01ab82ul, "left", 64 };
+VarInfo __struct_info__290109a00f355a1d_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4ae00d463a05655b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, 0x20ea36bbd9f9b28ful, "right", 72 };
+VarInfo __struct_info__290109a00f355a1d_field_9 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4ae00d463a05655b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, 0x5a36e0359ac4e7fcul, "subexpr", 80 };
+VarInfo __struct_info__290109a00f355a1d_field_10 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4ae00d463a05655b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, 0x12d7fe1ad414e6f2ul, "next", 88 };
+uint32_t __type_info__44afa437fceca048_dim_var_2954653413586328093[1] = { 8 };
+VarInfo __struct_info__290109a00f355a1d_field_11 =  { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 1, __type_info__44afa437fceca048_dim_var_2954653413586328093, 30, 32, 0x44afa437fceca048ul, "cset", 96 };
+VarInfo __struct_info__290109a00f355a1d_field_12 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0x99c9e869cdf5f631ul, "index", 128 };
+VarInfo __struct_info__290109a00f355a1d_field_13 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8c48207b56753d8, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0xcba517eb5789f971ul, "tail", 136 };
+VarInfo * __struct_info__290109a00f355a1d_fields[14] =  { &__struct_info__290109a00f355a1d_field_0, &__struct_info__290109a00f355a1d_field_1, &__struct_info__290109a00f355a1d_field_2, &__struct_info__290109a00f355a1d_field_3, &__struct_info__290109a00f355a1d_field_4, &__struct_info__290109a00f355a1d_field_5, &__struct_info__290109a00f355a1d_field_6, &__struct_info__290109a00f355a1d_field_7, &__struct_info__290109a00f355a1d_field_8, &__struct_info__290109a00f355a1d_field_9, &__struct_info__290109a00f355a1d_field_10, &__struct_info__290109a00f355a1d_field_11, &__struct_info__290109a00f355a1d_field_12, &__struct_info__290109a00f355a1d_field_13 };
+StructInfo __struct_info__290109a00f355a1d = {(char*)"ReNode", (char*)"regex", 28, __struct_info__290109a00f355a1d_fields, 14, 144, 0x0ul, nullptr, 0x290109a00f355a1dul };
+VarInfo __func_info__87bf23f355201ee1_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4ae00d463a05655b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, 0xe08612711dd137b5ul, "node", 0 };
+VarInfo * __func_info__87bf23f355201ee1_fields[1] =  { &__func_info__87bf23f355201ee1_field_0 };
+FuncInfo __func_info__87bf23f355201ee1 = {"invoke block<(node:regex::ReNode?):void> const", "", __func_info__87bf23f355201ee1_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,0x87bf23f355201ee1ul, 0x0 };
+TypeInfo * __type_info__5bbf416596e6e12a_arg_types[2] = { &__type_info__af63ef4c86020cd5, &__type_info__af63ee4c86020b22 };
+TypeInfo __type_info__5bbf416596e6e12a = { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__5bbf416596e6e12a_arg_types, nullptr, 2, 0, nullptr, 16390, 16, 0x5bbf416596e6e12aul };
+TypeInfo __type_info__e375858168db8b63 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4ae00d463a05655b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, 0xe375858168db8b63ul };
+TypeInfo __type_info__8c48207b56753d8 = { Type::tUInt8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, 0x8c48207b56753d8ul };
+TypeInfo __type_info__af63ee4c86020b22 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, 0xaf63ee4c86020b22ul };
+TypeInfo __type_info__b3120c480d69888a = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8c48207b56753d8, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0xb3120c480d69888aul };
+TypeInfo __type_info__90f3d07b5a6ca13 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, 0x90f3d07b5a6ca13ul };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, 0xaf63eb4c86020609ul };
+TypeInfo __type_info__4ae00d463a05655b = { Type::tStructure, &__struct_info__290109a00f355a1d, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 144, 0x4ae00d463a05655bul };
+TypeInfo __type_info__1dafad4a6313ad41 = { Type::tEnumeration, nullptr, &__enum_info__c6a7b3ce425cb39a, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0x1dafad4a6313ad41ul };
+TypeInfo __type_info__90f5707b5a6f641 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, 0x90f5707b5a6f641ul };
+TypeInfo __type_info__a0ce46235c7fd6e1 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8c48207b56753d8, nullptr, nullptr, nullptr, 0, 0, nullptr, 8236, 8, 0xa0ce46235c7fd6e1ul };
+TypeInfo __type_info__1c40a39445126ec1 = { Type::tStructure, &__struct_info__90edff79ff0df263, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 80, 0x1c40a39445126ec1ul };
+TypeInfo __type_info__6ee471041d873632 = { Type::tStructure, &__struct_info__90edff79ff0df263, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 80, 0x6ee471041d873632ul };
+TypeInfo __type_info__af63ef4c86020cd5 = { Type::tRange, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 8, 0xaf63ef4c86020cd5ul };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__6ee471041d873632 };
+TypeInfo * __tinfo_1[1] = { &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_2[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__1dafad4a6313ad41 };
+TypeInfo * __tinfo_3[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_4[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_5[1] = { &__type_info__af63ee4c86020b22 };
+TypeInfo * __tinfo_6[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_7[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_8[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_9[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_10[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__af63ee4c86020b22 };
+TypeInfo * __tinfo_11[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__af63ee4c86020b22 };
+TypeInfo * __tinfo_12[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__af63ee4c86020b22, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_13[1] = { &__type_info__af63ee4c86020b22 };
+TypeInfo * __tinfo_14[2] = { &__type_info__af63ee4c86020b22, &__type_info__90f3d07b5a6ca13 };
+namespace regex { struct ReNode; };
+namespace regex { struct Regex; };
+namespace regex {
+
+enum class ReOp : int32_t {
+	Char = int32_t(0),
+	Set = int32_t(1),
+	Any = int32_t(2),
+	Eos = int32_t(3),
+	Group = int32_t(4),
+	Plus = int32_t(5),
+	Star = int32_t(6),
+	Question = int32_t(7),
+	Concat = int32_t(8),
+	Union = int32_t(9),
+};
+}
+}
+template <> struct cast< das::_anon_9878276369668962785::regex::ReOp > : cast_enum < das::_anon_9878276369668962785::regex::ReOp > {};
+namespace _anon_9878276369668962785 {
+namespace regex {
+
+struct ReNode {
+	DAS_COMMENT(enum) regex::ReOp op;
+	int32_t id;
+	Func DAS_COMMENT((uint8_t *,regex::Regex,regex::ReNode *,uint8_t * const )) fun2;
+	range at;
+	char * text;
+	int32_t textLen;
+	TArray<regex::ReNode *> all;
+	regex::ReNode * left;
+	regex::ReNode * right;
+	regex::ReNode * subexpr;
+	regex::ReNode * next;
+	TDim<uint32_t,8> cset;
+	int32_t index;
+	uint8_t * tail;
+};
+static_assert(sizeof(ReNode)==144,"structure size mismatch with DAS");
+static_assert(offsetof(ReNode,op)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,id)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,fun2)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,at)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,text)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,textLen)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,all)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,left)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,right)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,subexpr)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,next)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,cset)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,index)==128,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,tail)==136,"structure field offset mismatch with DAS");
+}
+namespace regex {
+
+struct Regex {
+	regex::ReNode * root;
+	uint8_t * match;
+	TArray<TTuple<16,range,char *>> groups;
+	TDim<uint32_t,8> earlyOut;
+	bool canEarlyOut;
+};
+static_assert(sizeof(Regex)==80,"structure size mismatch with DAS");
+static_assert(offsetof(Regex,root)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Regex,match)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Regex,groups)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Regex,earlyOut)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(Regex,canEarlyOut)==72,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_resize_13e4a05653768251 ( Context * __context__, TArray<regex::ReNode *> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60_finalize_b7deb464a4f8e41c ( Context * __context__, TArray<regex::ReNode *> & __a_rename_at_293 );
+inline int32_t _Funcbuiltin_0x60_length_7938efcc1bc3eff1 ( Context * __context__, TDim<regex::ReNode *,2> const  & __a_rename_at_165 );
+inline void finalize_bbd896e678be00ff ( Context * __context__, regex::ReNode & ____this_rename_at_25 );
+inline void _Funcbuiltin_0x60_push_bd6055bce97bf09e ( Context * __context__, TArray<TTuple<16,range,char *>> & __Arr_rename_at_75, TTuple<16,range,char *> const  & __value_rename_at_75 );
+inline regex::Regex & _Funcbuiltin_0x60__return_with_lockcheck_48c386c3dcec1cdd ( Context * __context__, regex::Regex & __a_rename_at_42 );
+inline void finalize_6293242d2ef1254f ( Context * __context__, TVariant<16,regex::ReNode *,void *> & ____this_rename_at_254 );
+inline void finalize_98648ee1450a27e3 ( Context * __context__, regex::ReNode * & ____this_rename_at_329 );
+inline void _Funcbuiltin_0x60_push_5dc212b561cc93c2 ( Context * __context__, TArray<regex::ReNode *> & __Arr_rename_at_75, regex::ReNode * const  __value_rename_at_75 );
+inline TArray<regex::ReNode *> _Funcbuiltin_0x60_to_array_move_7c7ffb3d18c3d845 ( Context * __context__, TDim<regex::ReNode *,2> & __a_rename_at_412 );
+inline void trace_89f6695f8909b072 ( Context * __context__, char * const  __msg_rename_at_65, int32_t __offset_rename_at_65 );
+inline void note_89f6695f8909b072 ( Context * __context__, char * const  __msg_rename_at_70, int32_t __offset_rename_at_70 );
+inline void trace_backtrack_c77fe5b3ac1a6a7c ( Context * __context__ );
+inline void trace_value_4739abdd3b0a7208 ( Context * __context__, regex::ReNode * const  __value_rename_at_79 );
+inline TVariant<16,regex::ReNode *,void *> nada_5086bd0a540f8186 ( Context * __context__ );
+inline TVariant<16,regex::ReNode *,void *> maybe_d7a4f325999cb99b ( Context * __context__, regex::ReNode * const  __value_rename_at_90 );
+inline bool eos_dde6e11fd3802ac8 ( Context * __context__, char * const  __expr_rename_at_94, int32_t __offset_rename_at_94 );
+inline int32_t at_c9bade5ff7edd57d ( Context * __context__, char * const  __expr_rename_at_97, int32_t __offset_rename_at_97 );
+inline int32_t next_ae6766dbd0f788ec ( Context * __context__, TVariant<16,regex::ReNode *,void *> const  & __re_rename_at_112 );
+inline bool is_set_empty_fb12252b2129800d ( Context * __context__, TDim<uint32_t,8> const  & __cset_rename_at_118 );
+inline void set_or_char_471888d9ed78efab ( Context * __context__, TDim<uint32_t,8> & __cset_rename_at_124, int32_t __ch_rename_at_124 );
+inline void set_or_range_a7ad44e8ef1ec07c ( Context * __context__, TDim<uint32_t,8> & __cset_rename_at_127, range __bits_rename_at_127 );
+inline void set_invert_be791c77bc6b6a11 ( Context * __context__, TDim<uint32_t,8> & __cset_rename_at_131 );
+inline void set_or_set_9609a9e932b32815 ( Context * __context__, TDim<uint32_t,8> & __cset_rename_at_135, TDim<uint32_t,8> const  & __eset_rename_at_135 );
+inline void set_negative_7a1fcd94df7d5358 ( Context * __context__, TDim<uint32_t,8> & __cset_rename_at_139 );
+inline void set_meta_cc349e8f6f2b739 ( Context * __context__, TDim<uint32_t,8> & __cset_rename_at_143, int32_t __che_rename_at_143 );
+inline bool is_meta_character_24d3d25015b1373f ( Context * __context__, int32_t __ch_rename_at_172 );
+inline bool is_set_character_11f8fcca4329c870 ( Context * __context__, int32_t __ch_rename_at_175 );
+inline TVariant<16,regex::ReNode *,void *> re_char_99a4d28b0400d98b ( Context * __context__, char * const  __expr_rename_at_179, int32_t __offset_rename_at_179 );
+inline TVariant<16,regex::ReNode *,void *> re_set_items_f2bcd0927fa2c940 ( Context * __context__, char * const  __expr_rename_at_202, int32_t __offset_rename_at_202 );
+inline TVariant<16,regex::ReNode *,void *> re_set_6bf98af24a35a9ab ( Context * __context__, char * const  __expr_rename_at_241, int32_t __offset_rename_at_241 );
+inline TVariant<16,regex::ReNode *,void *> re_any_99be1211b087eb79 ( Context * __context__, char * const  __expr_rename_at_266, int32_t __offset_rename_at_266 );
+inline TVariant<16,regex::ReNode *,void *> re_eos_fc064f5c08d3ae96 ( Context * __context__, char * const  __expr_rename_at_275, int32_t __offset_rename_at_275 );
+inline TVariant<16,regex::ReNode *,void *> re_group_b0fc9ca2e5ea7489 ( Context * __context__, char * const  __expr_rename_at_284, int32_t __offset_rename_at_284 );
+inline TVariant<16,regex::ReNode *,void *> re_elementary_44bc08d3b62d065a ( Context * __context__, char * const  __expr_rename_at_299, int32_t __offset_rename_at_299 );
+inline regex::ReNode * mk_concat_b7a782885b2b6870 ( Context * __context__, regex::ReNode * __left_rename_at_320, regex::ReNode * __right_rename_at_320 );
+inline regex::ReNode * mk_union_60be9923d982281f ( Context * __context__, regex::ReNode * __left_rename_at_344, regex::ReNode * __right_rename_at_344 );
+inline TVariant<16,regex::ReNode *,void *> re_re_c65c8cbaa2bd5746 ( Context * __context__, char * const  __expr_rename_at_366, int32_t __offset_rename_at_366 );
+inline TVariant<16,regex::ReNode *,void *> re_basic_b4b0bffaf803ddc8 ( Context * __context__, char * const  __expr_rename_at_394, int32_t __offset_rename_at_394 );
+inline regex::ReNode * re_parse_3d6f9a305b851160 ( Context * __context__, char * const  __expr_rename_at_410 );
+inline void visit_top_down_ac4526f0a41e9d37 ( Context * __context__, regex::ReNode * __node_rename_at_420, Block DAS_COMMENT((void,regex::ReNode *)) const  & __blk_rename_at_420 );
+inline void re_assign_next_1e223575dac53267 ( Context * __context__, regex::Regex & __re_rename_at_431 );
+inline void re_assign_groups_929e731066f7c1e9 ( Context * __context__, regex::Regex & __re_rename_at_444 );
+inline void re_assign_match_functions_98136952e5810501 ( Context * __context__, regex::Regex & __re_rename_at_456 );
+inline uint8_t * re_match2_single_char_719b92c7ae28adab ( Context * __context__, regex::Regex & __regex_rename_at_490, regex::ReNode * __node_rename_at_490, uint8_t * const  __str_rename_at_490 );
+inline uint8_t * re_match2_char_3fc4bfa2fc1fedb5 ( Context * __context__, regex::Regex & __regex_rename_at_505, regex::ReNode * __node_rename_at_505, uint8_t * const  __str_rename_at_505 );
+inline uint8_t * re_match2_union_50b558c71c5a33b ( Context * __context__, regex::Regex & __regex_rename_at_522, regex::ReNode * __node_rename_at_522, uint8_t * const  __str_rename_at_522 );
+inline uint8_t * re_match2_set_5ff68104be60aa42 ( Context * __context__, regex::Regex & __regex_rename_at_533, regex::ReNode * __node_rename_at_533, uint8_t * const  __str_rename_at_533 );
+inline uint8_t * re_match2_any_2a47370c24660aa5 ( Context * __context__, regex::Regex & __regex_rename_at_548, regex::ReNode * __node_rename_at_548, uint8_t * const  __str_rename_at_548 );
+inline uint8_t * re_match2_concat_f320791e8feb9017 ( Context * __context__, regex::Regex & __regex_rename_at_563, regex::ReNode * __node_rename_at_563, uint8_t * const  __str_rename_at_563 );
+inline uint8_t * re_match2_eos_3c1a8603d243a154 ( Context * __context__, regex::Regex & __regex_rename_at_574, regex::ReNode * __node_rename_at_574, uint8_t * const  __str_rename_at_574 );
+inline uint8_t * re_match2_question_fbce93a964c27959 ( Context * __context__, regex::Regex & __regex_rename_at_587, regex::ReNode * __node_rename_at_587, uint8_t * const  __str_rename_at_587 );
+inline uint8_t * re_match2_plus_f4ed81922769b54d ( Context * __context__, regex::Regex & __regex_rename_at_602, regex::ReNode * __node_rename_at_602, uint8_t * const  __str_rename_at_602 );
+inline uint8_t * re_match2_plus_set_f34b624c2a935b9 ( Context * __context__, regex::Regex & __regex_rename_at_627, regex::ReNode * __node_rename_at_627, uint8_t * const  __str_rename_at_627 );
+inline uint8_t * re_match2_star_533ab88bf27eabb3 ( Context * __context__, regex::Regex & __regex_rename_at_657, regex::ReNode * __node_rename_at_657, uint8_t * const  __str_rename_at_657 );
+inline uint8_t * re_match2_group_1b52c8cbe220eede ( Context * __context__, regex::Regex & __regex_rename_at_680, regex::ReNode * __node_rename_at_680, uint8_t * const  __str_rename_at_680 );
+inline bool re_early_out_7af43e1fb0ced133 ( Context * __context__, TDim<uint32_t,8> & __cset_rename_at_694, regex::ReNode * const  __node_rename_at_694 );
+inline bool is_valid_f341200a6f682e5a ( Context * __context__, regex::Regex & __re_rename_at_733 );
+inline bool regex_compile_49466229404ec92e ( Context * __context__, regex::Regex & __re_rename_at_737, char * const  __expr_rename_at_737 );
+inline regex::Regex regex_compile_3ab3aff652051470 ( Context * __context__, char * const  __expr_rename_at_749 );
+inline regex::Regex regex_compile_34958ec809c4585e ( Context * __context__, regex::Regex & __re_rename_at_755 );
+inline int32_t regex_match_270cb942810fc6f1 ( Context * __context__, regex::Regex & __regex_rename_at_761, char * const  __str_rename_at_761, int32_t __offset_rename_at_761 );
+inline char * regex_group_1f825e4ecddcb4c9 ( Context * __context__, regex::Regex const  & __regex_rename_at_775, int32_t __index_rename_at_775, char * const  __match_rename_at_775 );
+inline void regex_foreach_15997c561ebb2761 ( Context * __context__, regex::Regex & __regex_rename_at_781, char * const  __str_rename_at_781, Block DAS_COMMENT((bool,range)) const  & __blk_rename_at_781 );
+inline void regex_debug_ceb0bfb647144f34 ( Context * __context__, regex::Regex const  & __regex_rename_at_820 );
+inline void debug_set_31f032942f694fa4 ( Context * __context__, TDim<uint32_t,8> const  & __cset_rename_at_833 );
+inline void debug_re_57e80c63d554e31c ( Context * __context__, regex::ReNode * const  __node_rename_at_842, int32_t __tab_rename_at_842 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<bool,0x5f00ae86cba54a79>(__context__) = false;/*log_parse_enabled*/
+	das_global<bool,0xe3b40eebb799db7>(__context__) = false;/*log_match_enabled*/
+	das_global<bool,0xdb2cb78f262cdc25>(__context__) = false;/*range_check_enabled*/
+	das_global<int32_t,0x7f437468b6b6a0da>(__context__) = 0;/*trace_tab*/
+	das_global<char *,0x810ab8027aecb8a9>(__context__) = ((char *) "\\+-*.()[]|^");/*meta*/
+	das_global<char *,0x2ebc2ae7102a7e3c>(__context__) = ((char *) "wWsSdD");/*meta_set*/
+}
+
+inline void _Funcbuiltin_0x60_resize_13e4a05653768251 ( Context * __context__, TArray<regex::ReNode *> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<regex::ReNode *>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_b7deb464a4f8e41c ( Context * __context__, TArray<regex::ReNode *> &  __a_rename_at_293 )
+{
+	{
+		uint64_t __loop_count_295 = UINT64_MAX;
+		// aV : regex::ReNode? aka TT&
+		das_iterator<TArray<regex::ReNode *>> __aV_iterator(__a_rename_at_293);
+		regex::ReNode * * __aV_rename_at_295;
+		__loop_count_295 = das_loop_count(__loop_count_295,__aV_iterator.loop_begin(__context__,(__aV_rename_at_295)));
+		for ( ; __loop_count_295 ; --__loop_count_295, ++__aV_rename_at_295 )
+		{
+			finalize_98648ee1450a27e3(__context__,(*__aV_rename_at_295));
+		}
+		__aV_iterator.loop_end(__context__,(__aV_rename_at_295));
+	};
+	builtin_array_free(das_arg<TArray<regex::ReNode *>>::pass(__a_rename_at_293),8,__context__);
+}
+
+inline int32_t _Funcbuiltin_0x60_length_7938efcc1bc3eff1 ( Context * __context__, TDim<regex::ReNode *,2> const  &  __a_rename_at_165 )
+{
+	return das_auto_cast<int32_t>::cast(2);
+}
+
+inline void finalize_bbd896e678be00ff ( Context * __context__, regex::ReNode &  ____this_rename_at_25 )
+{
+	_Funcbuiltin_0x60_finalize_b7deb464a4f8e41c(__context__,das_arg<TArray<regex::ReNode *>>::pass(____this_rename_at_25.all));
+	finalize_98648ee1450a27e3(__context__,____this_rename_at_25.left);
+	finalize_98648ee1450a27e3(__context__,____this_rename_at_25.right);
+	finalize_98648ee1450a27e3(__context__,____this_rename_at_25.subexpr);
+	memset(&(____this_rename_at_25), 0, 144);
+}
+
+inline void _Funcbuiltin_0x60_push_bd6055bce97bf09e ( Context * __context__, TArray<TTuple<16,range,char *>> &  __Arr_rename_at_75, TTuple<16,range,char *> const  &  __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<TTuple<16,range,char *>>>::pass(__Arr_rename_at_75),16,__context__),__context__),__value_rename_at_75);
+}
+
+inline regex::Regex & _Funcbuiltin_0x60__return_with_lockcheck_48c386c3dcec1cdd ( Context * __context__, regex::Regex &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<regex::Regex &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<regex::Regex &>::cast(__a_rename_at_42);
+}
+
+inline void finalize_6293242d2ef1254f ( Context * __context__, TVariant<16,regex::ReNode *,void *> &  ____this_rename_at_254 )
+{
+	if ( das_get_variant_field<regex::ReNode *,8,0>::is(____this_rename_at_254) )
+	{
+		finalize_98648ee1450a27e3(__context__,das_get_variant_field<regex::ReNode *,8,0>::get(____this_rename_at_254));
+	};
+	memset(&(____this_rename_at_254), 0, 16);
+}
+
+inline void finalize_98648ee1450a27e3 ( Context * __context__, regex::ReNode * & ____this_rename_at_329 )
+{
+	if ( ____this_rename_at_329 != nullptr )
+	{
+		finalize_bbd896e678be00ff(__context__,das_arg<regex::ReNode>::pass(das_deref(__context__,____this_rename_at_329)));
+		das_delete<regex::ReNode *>::clear(__context__,____this_rename_at_329);
+		das_copy(____this_rename_at_329,nullptr);
+	};
+}
+
+inline void _Funcbuiltin_0x60_push_5dc212b561cc93c2 ( Context * __context__, TArray<regex::ReNode *> &  __Arr_rename_at_75, regex::ReNode * const  __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<regex::ReNode *>>::pass(__Arr_rename_at_75),8,__context__),__context__),__value_rename_at_75);
+}
+
+inline TArray<regex::ReNode *> _Funcbuiltin_0x60_to_array_move_7c7ffb3d18c3d845 ( Context * __context__, TDim<regex::ReNode *,2> &  __a_rename_at_412 )
+{
+	TArray<regex::ReNode *> __arr_rename_at_413; das_zero(__arr_rename_at_413);
+	_Funcbuiltin_0x60_resize_13e4a05653768251(__context__,das_arg<TArray<regex::ReNode *>>::pass(__arr_rename_at_413),2);
+	das_copy(das_cast<TDim<regex::ReNode *,2>>::cast(das_ref(__context__,__arr_rename_at_413(0,__context__))),__a_rename_at_412);
+	return /* <- */ das_auto_cast_move<TArray<regex::ReNode *>>::cast(__arr_rename_at_413);
+}
+
+inline void trace_89f6695f8909b072 ( Context * __context__, char * const  __msg_rename_at_65, int32_t __offset_rename_at_65 )
+{
+}
+
+inline void note_89f6695f8909b072 ( Context * __context__, char * const  __msg_rename_at_70, int32_t __offset_rename_at_70 )
+{
+}
+
+inline void trace_backtrack_c77fe5b3ac1a6a7c ( Context * __context__ )
+{
+}
+
+inline void trace_value_4739abdd3b0a7208 ( Context * __context__, regex::ReNode * const  __value_rename_at_79 )
+{
+}
+
+inline TVariant<16,regex::ReNode *,void *> nada_5086bd0a540f8186 ( Context * __context__ )
+{
+	return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast((([&]() -> TVariant<16,regex::ReNode *,void *> {
+		TVariant<16,regex::ReNode *,void *> __mkv_88;
+		das_get_variant_field<void *,8,1>::set(__mkv_88) = nullptr;
+		return __mkv_88;
+	})()));
+}
+
+inline TVariant<16,regex::ReNode *,void *> maybe_d7a4f325999cb99b ( Context * __context__, regex::ReNode * const  __value_rename_at_90 )
+{
+	return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast((([&]() -> TVariant<16,regex::ReNode *,void *> {
+		TVariant<16,regex::ReNode *,void *> __mkv_92;
+		das_get_variant_field<regex::ReNode *,8,0>::set(__mkv_92) = __value_rename_at_90;
+		return __mkv_92;
+	})()));
+}
+
+inline bool eos_dde6e11fd3802ac8 ( Context * __context__, char * const  __expr_rename_at_94, int32_t __offset_rename_at_94 )
+{
+	return das_auto_cast<bool>::cast(__offset_rename_at_94 >= builtin_string_length(__expr_rename_at_94,__context__));
+}
+
+inline int32_t at_c9bade5ff7edd57d ( Context * __context__, char * const  __expr_rename_at_97, int32_t __offset_rename_at_97 )
+{
+	return das_auto_cast<int32_t>::cast(get_character_uat(__expr_rename_at_97,__offset_rename_at_97));
+}
+
+inline int32_t next_ae6766dbd0f788ec ( Context * __context__, TVariant<16,regex::ReNode *,void *> const  &  __re_rename_at_112 )
+{
+	if ( !das_get_variant_field<regex::ReNode *,8,0>::is(__re_rename_at_112) )
+	{
+		builtin_stackwalk(true,true,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+		builtin_throw(((char *) "expecting value"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	};
+	return das_auto_cast<int32_t>::cast(v_extract_yi(v_cast_vec4i(das_get_variant_field<regex::ReNode *,8,0>::as(__re_rename_at_112,__context__)->at)) /*y*/);
+}
+
+inline bool is_set_empty_fb12252b2129800d ( Context * __context__, TDim<uint32_t,8> const  &  __cset_rename_at_118 )
+{
+	{
+		uint64_t __loop_count_119 = UINT64_MAX;
+		// x : uint aka CharSet const&
+		das_iterator<TDim<uint32_t,8> const > __x_iterator(__cset_rename_at_118);
+		uint32_t const  * __x_rename_at_119;
+		__loop_count_119 = das_loop_count(__loop_count_119,__x_iterator.loop_begin(__context__,(__x_rename_at_119)));
+		for ( ; __loop_count_119 ; --__loop_count_119, ++__x_rename_at_119 )
+		{
+			if ( (*__x_rename_at_119) != 0x0u )
+			{
+				return das_auto_cast<bool>::cast(false);
+			};
+		}
+		__x_iterator.loop_end(__context__,(__x_rename_at_119));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline void set_or_char_471888d9ed78efab ( Context * __context__, TDim<uint32_t,8> &  __cset_rename_at_124, int32_t __ch_rename_at_124 )
+{
+	__cset_rename_at_124((__ch_rename_at_124 >> 5),__context__) |= uint32_t(1 << (__ch_rename_at_124 & 31));
+}
+
+inline void set_or_range_a7ad44e8ef1ec07c ( Context * __context__, TDim<uint32_t,8> &  __cset_rename_at_127, range __bits_rename_at_127 )
+{
+	{
+		uint64_t __loop_count_128 = UINT64_MAX;
+		// ch : int const
+		das_iterator<range> __ch_iterator(range(v_extract_xi(v_cast_vec4i(__bits_rename_at_127)) /*x*/,v_extract_yi(v_cast_vec4i(__bits_rename_at_127)) /*y*/ + 1));
+		int32_t __ch_rename_at_128;
+		__loop_count_128 = das_loop_count(__loop_count_128,__ch_iterator.loop_begin(__context__,(__ch_rename_at_128)));
+		for ( ; __loop_count_128 ; --__loop_count_128, ++__ch_rename_at_128 )
+		{
+			__cset_rename_at_127((__ch_rename_at_128 >> 5),__context__) |= uint32_t(1 << (__ch_rename_at_128 & 31));
+		}
+		__ch_iterator.loop_end(__context__,(__ch_rename_at_128));
+	};
+}
+
+inline void set_invert_be791c77bc6b6a11 ( Context * __context__, TDim<uint32_t,8> &  __cset_rename_at_131 )
+{
+	{
+		uint64_t __loop_count_132 = UINT64_MAX;
+		// x : uint aka CharSet& -const
+		das_iterator<TDim<uint32_t,8>> __x_iterator(__cset_rename_at_131);
+		uint32_t * __x_rename_at_132;
+		__loop_count_132 = das_loop_count(__loop_count_132,__x_iterator.loop_begin(__context__,(__x_rename_at_132)));
+		for ( ; __loop_count_132 ; --__loop_count_132, ++__x_rename_at_132 )
+		{
+			(*__x_rename_at_132) ^= 0xffffffffu;
+		}
+		__x_iterator.loop_end(__context__,(__x_rename_at_132));
+	};
+}
+
+inline void set_or_set_9609a9e932b32815 ( Context * __context__, TDim<uint32_t,8> &  __cset_rename_at_135, TDim<uint32_t,8> const  &  __eset_rename_at_135 )
+{
+	{
+		uint64_t __loop_count_136 = UINT64_MAX;
+		// x : uint aka CharSet& -const
+		das_iterator<TDim<uint32_t,8>> __x_iterator(__cset_rename_at_135);
+		uint32_t * __x_rename_at_136;
+		__loop_count_136 = das_loop_count(__loop_count_136,__x_iterator.loop_begin(__context__,(__x_rename_at_136)));
+		// y : uint aka CharSet const&
+		das_iterator<TDim<uint32_t,8> const > __y_iterator(__eset_rename_at_135);
+		uint32_t const  * __y_rename_at_136;
+		__loop_count_136 = das_loop_count(__loop_count_136,__y_iterator.loop_begin(__context__,(__y_rename_at_136)));
+		for ( ; __loop_count_136 ; --__loop_count_136, ++__x_rename_at_136, ++__y_rename_at_136 )
+		{
+			(*__x_rename_at_136) |= (*__y_rename_at_136);
+		}
+		__x_iterator.loop_end(__context__,(__x_rename_at_136));
+		__y_iterator.loop_end(__context__,(__y_rename_at_136));
+	};
+}
+
+inline void set_negative_7a1fcd94df7d5358 ( Context * __context__, TDim<uint32_t,8> &  __cset_rename_at_139 )
+{
+	{
+		uint64_t __loop_count_140 = UINT64_MAX;
+		// x : uint aka CharSet& -const
+		das_iterator<TDim<uint32_t,8>> __x_iterator(__cset_rename_at_139);
+		uint32_t * __x_rename_at_140;
+		__loop_count_140 = das_loop_count(__loop_count_140,__x_iterator.loop_begin(__context__,(__x_rename_at_140)));
+		for ( ; __loop_count_140 ; --__loop_count_140, ++__x_rename_at_140 )
+		{
+			das_copy((*__x_rename_at_140),~(*__x_rename_at_140));
+		}
+		__x_iterator.loop_end(__context__,(__x_rename_at_140));
+	};
+}
+
+inline void set_meta_cc349e8f6f2b739 ( Context * __context__, TDim<uint32_t,8> &  __cset_rename_at_143, int32_t __che_rename_at_143 )
+{
+	if ( __che_rename_at_143 == 119 )
+	{
+		set_or_range_a7ad44e8ef1ec07c(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_143),range(97,122));
+		set_or_range_a7ad44e8ef1ec07c(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_143),range(65,90));
+		set_or_range_a7ad44e8ef1ec07c(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_143),range(48,57));
+		set_or_char_471888d9ed78efab(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_143),95);
+	} else if ( __che_rename_at_143 == 87 )
+	{
+		TDim<uint32_t,8> __eset_rename_at_150; das_zero(__eset_rename_at_150);
+		set_meta_cc349e8f6f2b739(__context__,das_arg<TDim<uint32_t,8>>::pass(__eset_rename_at_150),119);
+		set_or_set_9609a9e932b32815(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_143),das_arg<TDim<uint32_t,8>>::pass(__eset_rename_at_150));
+	} else if ( __che_rename_at_143 == 115 )
+	{
+		set_or_char_471888d9ed78efab(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_143),32);
+		set_or_char_471888d9ed78efab(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_143),9);
+	} else if ( __che_rename_at_143 == 83 )
+	{
+		TDim<uint32_t,8> __eset_rename_at_157; das_zero(__eset_rename_at_157);
+		set_meta_cc349e8f6f2b739(__context__,das_arg<TDim<uint32_t,8>>::pass(__eset_rename_at_157),115);
+		set_or_set_9609a9e932b32815(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_143),das_arg<TDim<uint32_t,8>>::pass(__eset_rename_at_157));
+	} else if ( __che_rename_at_143 == 100 )
+	{
+		set_or_range_a7ad44e8ef1ec07c(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_143),range(48,57));
+	} else if ( __che_rename_at_143 == 68 )
+	{
+		TDim<uint32_t,8> __eset_rename_at_163; das_zero(__eset_rename_at_163);
+		set_meta_cc349e8f6f2b739(__context__,das_arg<TDim<uint32_t,8>>::pass(__eset_rename_at_163),100);
+		set_or_set_9609a9e932b32815(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_143),das_arg<TDim<uint32_t,8>>::pass(__eset_rename_at_163));
+	} else {
+		set_or_char_471888d9ed78efab(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_143),__che_rename_at_143);
+	};
+}
+
+inline bool is_meta_character_24d3d25015b1373f ( Context * __context__, int32_t __ch_rename_at_172 )
+{
+	return das_auto_cast<bool>::cast(builtin_find_first_char_of(((char *) "\\+-*.()[]|^"),__ch_rename_at_172,__context__) != -1);
+}
+
+inline bool is_set_character_11f8fcca4329c870 ( Context * __context__, int32_t __ch_rename_at_175 )
+{
+	return das_auto_cast<bool>::cast(builtin_find_first_char_of(((char *) "wWsSdD"),__ch_rename_at_175,__context__) != -1);
+}
+
+inline TVariant<16,regex::ReNode *,void *> re_char_99a4d28b0400d98b ( Context * __context__, char * const  __expr_rename_at_179, int32_t __offset_rename_at_179 )
+{
+	if ( eos_dde6e11fd3802ac8(__context__,__expr_rename_at_179,__offset_rename_at_179) )
+	{
+		return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+	} else {
+		int32_t __ch_rename_at_183 = ((int32_t)at_c9bade5ff7edd57d(__context__,__expr_rename_at_179,__offset_rename_at_179));
+		if ( __ch_rename_at_183 == 92 )
+		{
+			int32_t __ech_rename_at_185 = ((int32_t)at_c9bade5ff7edd57d(__context__,__expr_rename_at_179,__offset_rename_at_179 + 1));
+			if ( __ech_rename_at_185 == 0 )
+			{
+				return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+			} else {
+				if ( is_set_character_11f8fcca4329c870(__context__,__ech_rename_at_185) )
+				{
+					TDim<uint32_t,8> __cset_rename_at_190; das_zero(__cset_rename_at_190);
+					set_meta_cc349e8f6f2b739(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_190),__ech_rename_at_185);
+					return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(maybe_d7a4f325999cb99b(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+						regex::ReNode __mks_192;
+						das_zero(__mks_192);
+						das_copy((__mks_192.op),(DAS_COMMENT(enum) regex::ReOp::Set));
+						das_copy((__mks_192.cset),(__cset_rename_at_190));
+						das_copy((__mks_192.at),(range(__offset_rename_at_179,__offset_rename_at_179 + 2)));
+						return __mks_192;
+					})()))));
+				} else {
+					return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(maybe_d7a4f325999cb99b(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+						regex::ReNode __mks_193;
+						das_zero(__mks_193);
+						das_copy((__mks_193.op),(DAS_COMMENT(enum) regex::ReOp::Char));
+						das_copy((__mks_193.text),(((char *)(to_string_char(__ech_rename_at_185,__context__)))));
+						das_copy((__mks_193.textLen),(1));
+						das_copy((__mks_193.at),(range(__offset_rename_at_179,__offset_rename_at_179 + 2)));
+						return __mks_193;
+					})()))));
+				};
+			};
+		} else if ( is_meta_character_24d3d25015b1373f(__context__,__ch_rename_at_183) )
+		{
+			return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+		};
+		return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(maybe_d7a4f325999cb99b(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+			regex::ReNode __mks_196;
+			das_zero(__mks_196);
+			das_copy((__mks_196.op),(DAS_COMMENT(enum) regex::ReOp::Char));
+			das_copy((__mks_196.text),(((char *)(to_string_char(__ch_rename_at_183,__context__)))));
+			das_copy((__mks_196.textLen),(1));
+			das_copy((__mks_196.at),(range(__offset_rename_at_179,__offset_rename_at_179 + 1)));
+			return __mks_196;
+		})()))));
+	};
+}
+
+inline TVariant<16,regex::ReNode *,void *> re_set_items_f2bcd0927fa2c940 ( Context * __context__, char * const  __expr_rename_at_202, int32_t __offset_rename_at_202 )
+{
+	if ( eos_dde6e11fd3802ac8(__context__,__expr_rename_at_202,__offset_rename_at_202) )
+	{
+		return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+	} else {
+		TDim<uint32_t,8> __cset_rename_at_206; das_zero(__cset_rename_at_206);
+		int32_t __iofs_rename_at_207 = __offset_rename_at_202;
+		while ( !eos_dde6e11fd3802ac8(__context__,__expr_rename_at_202,__iofs_rename_at_207) )
+		{
+			int32_t __ch_rename_at_209 = ((int32_t)at_c9bade5ff7edd57d(__context__,__expr_rename_at_202,__iofs_rename_at_207));
+			if ( __ch_rename_at_209 == 93 )
+			{
+				break;
+			} else if ( __ch_rename_at_209 == 92 )
+			{
+				int32_t __che_rename_at_214 = ((int32_t)at_c9bade5ff7edd57d(__context__,__expr_rename_at_202,__iofs_rename_at_207 + 1));
+				if ( __che_rename_at_214 == 0 )
+				{
+					return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+				} else {
+					set_meta_cc349e8f6f2b739(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_206),__che_rename_at_214);
+					__iofs_rename_at_207 += 2;
+				};
+			} else if ( (at_c9bade5ff7edd57d(__context__,__expr_rename_at_202,__iofs_rename_at_207 + 1) == 45) && (at_c9bade5ff7edd57d(__context__,__expr_rename_at_202,__iofs_rename_at_207 + 2) != 93) )
+			{
+				int32_t __che_rename_at_222 = ((int32_t)at_c9bade5ff7edd57d(__context__,__expr_rename_at_202,__iofs_rename_at_207 + 2));
+				if ( __che_rename_at_222 == 0 )
+				{
+					return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+				} else if ( __ch_rename_at_209 > __che_rename_at_222 )
+				{
+					return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+				};
+				set_or_range_a7ad44e8ef1ec07c(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_206),range(__ch_rename_at_209,__che_rename_at_222));
+				__iofs_rename_at_207 += 3;
+			} else {
+				set_or_char_471888d9ed78efab(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_206),__ch_rename_at_209);
+				__iofs_rename_at_207 += 1;
+			};
+		};
+		return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(maybe_d7a4f325999cb99b(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+			regex::ReNode __mks_236;
+			das_zero(__mks_236);
+			das_copy((__mks_236.op),(DAS_COMMENT(enum) regex::ReOp::Set));
+			das_copy((__mks_236.cset),(__cset_rename_at_206));
+			das_copy((__mks_236.at),(range(__offset_rename_at_202,__iofs_rename_at_207)));
+			return __mks_236;
+		})()))));
+	};
+}
+
+inline TVariant<16,regex::ReNode *,void *> re_set_6bf98af24a35a9ab ( Context * __context__, char * const  __expr_rename_at_241, int32_t __offset_rename_at_241 )
+{
+	if ( eos_dde6e11fd3802ac8(__context__,__expr_rename_at_241,__offset_rename_at_241) )
+	{
+		return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+	} else {
+		if ( at_c9bade5ff7edd57d(__context__,__expr_rename_at_241,__offset_rename_at_241) != 91 )
+		{
+			return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+		} else {
+			bool __negative_rename_at_247 = false;
+			if ( at_c9bade5ff7edd57d(__context__,__expr_rename_at_241,__offset_rename_at_241 + 1) == 94 )
+			{
+				das_copy(__negative_rename_at_247,true);
+			};
+			TVariant<16,regex::ReNode *,void *> __oset_rename_at_250 = re_set_items_f2bcd0927fa2c940(__context__,__expr_rename_at_241,__negative_rename_at_247 ? das_auto_cast<int32_t>::cast((__offset_rename_at_241 + 2)) : das_auto_cast<int32_t>::cast((__offset_rename_at_241 + 1)));
+			if ( das_get_variant_field<void *,8,1>::is(__oset_rename_at_250) )
+			{
+				return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+			} else {
+				if ( at_c9bade5ff7edd57d(__context__,__expr_rename_at_241,next_ae6766dbd0f788ec(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__oset_rename_at_250))) != 93 )
+				{
+					finalize_6293242d2ef1254f(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__oset_rename_at_250));
+					return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+				} else {
+					regex::ReNode * __oval_rename_at_256 = das_get_variant_field<regex::ReNode *,8,0>::as(__oset_rename_at_250,__context__);
+					das_copy(das_swizzle_ref<int32_t,range,0>::swizzle(__oval_rename_at_256->at) /*x*/,__offset_rename_at_241);
+					++das_swizzle_ref<int32_t,range,1>::swizzle(__oval_rename_at_256->at) /*y*/;
+					das_copy(__oval_rename_at_256->op,DAS_COMMENT(enum) regex::ReOp::Set);
+					if ( __negative_rename_at_247 )
+					{
+						set_negative_7a1fcd94df7d5358(__context__,das_arg<TDim<uint32_t,8>>::pass(__oval_rename_at_256->cset));
+					};
+					return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(__oset_rename_at_250);
+				};
+			};
+		};
+	};
+}
+
+inline TVariant<16,regex::ReNode *,void *> re_any_99be1211b087eb79 ( Context * __context__, char * const  __expr_rename_at_266, int32_t __offset_rename_at_266 )
+{
+	TVariant<16,regex::ReNode *,void *> _temp_make_local_269_32;
+	TVariant<16,regex::ReNode *,void *> _temp_make_local_271_48;
+	TVariant<16,regex::ReNode *,void *> _temp_make_local_272_80;
+	return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(eos_dde6e11fd3802ac8(__context__,__expr_rename_at_266,__offset_rename_at_266) ? das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast((_temp_make_local_269_32 = (nada_5086bd0a540f8186(__context__)))) : das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(((at_c9bade5ff7edd57d(__context__,__expr_rename_at_266,__offset_rename_at_266) == 46) ? das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast((_temp_make_local_271_48 = (maybe_d7a4f325999cb99b(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+		regex::ReNode __mks_271;
+		das_zero(__mks_271);
+		das_copy((__mks_271.op),(DAS_COMMENT(enum) regex::ReOp::Any));
+		das_copy((__mks_271.at),(range(__offset_rename_at_266,__offset_rename_at_266 + 1)));
+		return __mks_271;
+	})())))))) : das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast((_temp_make_local_272_80 = (nada_5086bd0a540f8186(__context__)))))));
+}
+
+inline TVariant<16,regex::ReNode *,void *> re_eos_fc064f5c08d3ae96 ( Context * __context__, char * const  __expr_rename_at_275, int32_t __offset_rename_at_275 )
+{
+	TVariant<16,regex::ReNode *,void *> _temp_make_local_278_32;
+	TVariant<16,regex::ReNode *,void *> _temp_make_local_280_48;
+	TVariant<16,regex::ReNode *,void *> _temp_make_local_281_80;
+	return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(eos_dde6e11fd3802ac8(__context__,__expr_rename_at_275,__offset_rename_at_275) ? das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast((_temp_make_local_278_32 = (nada_5086bd0a540f8186(__context__)))) : das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(((at_c9bade5ff7edd57d(__context__,__expr_rename_at_275,__offset_rename_at_275) == 36) ? das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast((_temp_make_local_280_48 = (maybe_d7a4f325999cb99b(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+		regex::ReNode __mks_280;
+		das_zero(__mks_280);
+		das_copy((__mks_280.op),(DAS_COMMENT(enum) regex::ReOp::Eos));
+		das_copy((__mks_280.at),(range(__offset_rename_at_275,__offset_rename_at_275 + 1)));
+		return __mks_280;
+	})())))))) : das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast((_temp_make_local_281_80 = (nada_5086bd0a540f8186(__context__)))))));
+}
+
+inline TVariant<16,regex::ReNode *,void *> re_group_b0fc9ca2e5ea7489 ( Context * __context__, char * const  __expr_rename_at_284, int32_t __offset_rename_at_284 )
+{
+	if ( eos_dde6e11fd3802ac8(__context__,__expr_rename_at_284,__offset_rename_at_284) )
+	{
+		return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+	} else {
+		if ( at_c9bade5ff7edd57d(__context__,__expr_rename_at_284,__offset_rename_at_284) != 40 )
+		{
+			return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+		} else {
+			TVariant<16,regex::ReNode *,void *> __ore_rename_at_290 = re_re_c65c8cbaa2bd5746(__context__,__expr_rename_at_284,__offset_rename_at_284 + 1);
+			if ( das_get_variant_field<void *,8,1>::is(__ore_rename_at_290) )
+			{
+				return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+			} else {
+				if ( at_c9bade5ff7edd57d(__context__,__expr_rename_at_284,next_ae6766dbd0f788ec(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__ore_rename_at_290))) != 41 )
+				{
+					finalize_6293242d2ef1254f(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__ore_rename_at_290));
+					return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+				} else {
+					return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(maybe_d7a4f325999cb99b(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+						regex::ReNode __mks_296;
+						das_zero(__mks_296);
+						das_copy((__mks_296.op),(DAS_COMMENT(enum) regex::ReOp::Group));
+						das_copy((__mks_296.subexpr),(das_get_variant_field<regex::ReNode *,8,0>::as(__ore_rename_at_290,__context__)));
+						das_copy((__mks_296.at),(range(__offset_rename_at_284,next_ae6766dbd0f788ec(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__ore_rename_at_290)) + 1)));
+						return __mks_296;
+					})()))));
+				};
+			};
+		};
+	};
+}
+
+inline TVariant<16,regex::ReNode *,void *> re_elementary_44bc08d3b62d065a ( Context * __context__, char * const  __expr_rename_at_299, int32_t __offset_rename_at_299 )
+{
+	if ( eos_dde6e11fd3802ac8(__context__,__expr_rename_at_299,__offset_rename_at_299) )
+	{
+		return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+	} else {
+		TVariant<16,regex::ReNode *,void *> __ogr_rename_at_303 = re_group_b0fc9ca2e5ea7489(__context__,__expr_rename_at_299,__offset_rename_at_299);
+		if ( das_get_variant_field<regex::ReNode *,8,0>::is(__ogr_rename_at_303) )
+		{
+			return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(__ogr_rename_at_303);
+		} else {
+			TVariant<16,regex::ReNode *,void *> __oany_rename_at_306 = re_any_99be1211b087eb79(__context__,__expr_rename_at_299,__offset_rename_at_299);
+			if ( das_get_variant_field<regex::ReNode *,8,0>::is(__oany_rename_at_306) )
+			{
+				return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(__oany_rename_at_306);
+			} else {
+				TVariant<16,regex::ReNode *,void *> __oeos_rename_at_309 = re_eos_fc064f5c08d3ae96(__context__,__expr_rename_at_299,__offset_rename_at_299);
+				if ( das_get_variant_field<regex::ReNode *,8,0>::is(__oeos_rename_at_309) )
+				{
+					return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(__oeos_rename_at_309);
+				} else {
+					TVariant<16,regex::ReNode *,void *> __oset_rename_at_312 = re_set_6bf98af24a35a9ab(__context__,__expr_rename_at_299,__offset_rename_at_299);
+					if ( das_get_variant_field<regex::ReNode *,8,0>::is(__oset_rename_at_312) )
+					{
+						return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(__oset_rename_at_312);
+					} else {
+						TVariant<16,regex::ReNode *,void *> _temp_make_local_318_112;
+						TVariant<16,regex::ReNode *,void *> __ochr_rename_at_315 = re_char_99a4d28b0400d98b(__context__,__expr_rename_at_299,__offset_rename_at_299);
+						return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(das_get_variant_field<regex::ReNode *,8,0>::is(__ochr_rename_at_315) ? das_auto_cast_ref<TVariant<16,regex::ReNode *,void *> &>::cast(__ochr_rename_at_315) : das_auto_cast_ref<TVariant<16,regex::ReNode *,void *> &>::cast((_temp_make_local_318_112 = (nada_5086bd0a540f8186(__context__)))));
+					};
+				};
+			};
+		};
+	};
+}
+
+inline regex::ReNode * mk_concat_b7a782885b2b6870 ( Context * __context__, regex::ReNode * __left_rename_at_320, regex::ReNode * __right_rename_at_320 )
+{
+	if ( __left_rename_at_320 == nullptr )
+	{
+		return das_auto_cast<regex::ReNode *>::cast(__right_rename_at_320);
+	} else if ( (__left_rename_at_320->op == DAS_COMMENT(enum) regex::ReOp::Char) && (__right_rename_at_320->op == DAS_COMMENT(enum) regex::ReOp::Char) )
+	{
+		das_copy(das_swizzle_ref<int32_t,range,1>::swizzle(__left_rename_at_320->at) /*y*/,das_swizzle_ref<int32_t,range,1>::swizzle(__right_rename_at_320->at) /*y*/);
+		SimPolicy<char *>::SetAdd((char *)&(__left_rename_at_320->text),cast<char *>::from(__right_rename_at_320->text),*__context__,nullptr);
+		__left_rename_at_320->textLen += __right_rename_at_320->textLen;
+		finalize_98648ee1450a27e3(__context__,__right_rename_at_320);
+		return das_auto_cast<regex::ReNode *>::cast(__left_rename_at_320);
+	} else if ( ((__left_rename_at_320->op == DAS_COMMENT(enum) regex::ReOp::Concat) && (__left_rename_at_320->right->op == DAS_COMMENT(enum) regex::ReOp::Char)) && (__right_rename_at_320->op == DAS_COMMENT(enum) regex::ReOp::Char) )
+	{
+		regex::ReNode * __lor_rename_at_333 = __left_rename_at_320->right;
+		das_copy(das_swizzle_ref<int32_t,range,1>::swizzle(__left_rename_at_320->at) /*y*/,das_swizzle_ref<int32_t,range,1>::swizzle(__right_rename_at_320->at) /*y*/);
+		das_copy(das_swizzle_ref<int32_t,range,1>::swizzle(__lor_rename_at_333->at) /*y*/,das_swizzle_ref<int32_t,range,1>::swizzle(__right_rename_at_320->at) /*y*/);
+		SimPolicy<char *>::SetAdd((char *)&(__lor_rename_at_333->text),cast<char *>::from(__right_rename_at_320->text),*__context__,nullptr);
+		__lor_rename_at_333->textLen += __right_rename_at_320->textLen;
+		finalize_98648ee1450a27e3(__context__,__right_rename_at_320);
+		return das_auto_cast<regex::ReNode *>::cast(__left_rename_at_320);
+	} else {
+		return das_auto_cast<regex::ReNode *>::cast(das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+			regex::ReNode __mks_342;
+			das_zero(__mks_342);
+			das_copy((__mks_342.op),(DAS_COMMENT(enum) regex::ReOp::Concat));
+			das_copy((__mks_342.left),(__left_rename_at_320));
+			das_copy((__mks_342.right),(__right_rename_at_320));
+			das_copy((__mks_342.at),(range(v_extract_xi(v_cast_vec4i(__left_rename_at_320->at)) /*x*/,v_extract_yi(v_cast_vec4i(__right_rename_at_320->at)) /*y*/)));
+			return __mks_342;
+		})())));
+	};
+}
+
+inline regex::ReNode * mk_union_60be9923d982281f ( Context * __context__, regex::ReNode * __left_rename_at_344, regex::ReNode * __right_rename_at_344 )
+{
+	if ( __left_rename_at_344->op == DAS_COMMENT(enum) regex::ReOp::Union )
+	{
+		das_copy(das_swizzle_ref<int32_t,range,1>::swizzle(__left_rename_at_344->at) /*y*/,das_swizzle_ref<int32_t,range,1>::swizzle(__right_rename_at_344->at) /*y*/);
+		if ( __right_rename_at_344->op == DAS_COMMENT(enum) regex::ReOp::Union )
+		{
+			{
+				uint64_t __loop_count_348 = UINT64_MAX;
+				// x : regex::ReNode?&
+				das_iterator<TArray<regex::ReNode *>> __x_iterator(__right_rename_at_344->all);
+				regex::ReNode * * __x_rename_at_348;
+				__loop_count_348 = das_loop_count(__loop_count_348,__x_iterator.loop_begin(__context__,(__x_rename_at_348)));
+				for ( ; __loop_count_348 ; --__loop_count_348, ++__x_rename_at_348 )
+				{
+					_Funcbuiltin_0x60_push_5dc212b561cc93c2(__context__,das_arg<TArray<regex::ReNode *>>::pass(__left_rename_at_344->all),(*__x_rename_at_348));
+				}
+				__x_iterator.loop_end(__context__,(__x_rename_at_348));
+			};
+			finalize_98648ee1450a27e3(__context__,__right_rename_at_344);
+		} else {
+			_Funcbuiltin_0x60_push_5dc212b561cc93c2(__context__,das_arg<TArray<regex::ReNode *>>::pass(__left_rename_at_344->all),__right_rename_at_344);
+		};
+		return das_auto_cast<regex::ReNode *>::cast(__left_rename_at_344);
+	} else if ( __right_rename_at_344->op == DAS_COMMENT(enum) regex::ReOp::Union )
+	{
+		das_copy(das_swizzle_ref<int32_t,range,0>::swizzle(__right_rename_at_344->at) /*x*/,das_swizzle_ref<int32_t,range,0>::swizzle(__left_rename_at_344->at) /*x*/);
+		_Funcbuiltin_0x60_push_5dc212b561cc93c2(__context__,das_arg<TArray<regex::ReNode *>>::pass(__right_rename_at_344->all),__left_rename_at_344);
+		return das_auto_cast<regex::ReNode *>::cast(__right_rename_at_344);
+	} else {
+		TDim<regex::ReNode *,2> _temp_make_local_360_64;
+		return das_auto_cast<regex::ReNode *>::cast(das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+			regex::ReNode __mks_360;
+			das_zero(__mks_360);
+			das_copy((__mks_360.op),(DAS_COMMENT(enum) regex::ReOp::Union));
+			das_move((__mks_360.all),(_Funcbuiltin_0x60_to_array_move_7c7ffb3d18c3d845(__context__,das_arg<TDim<regex::ReNode *,2>>::pass((([&]() -> TDim<regex::ReNode *,2>& {
+				_temp_make_local_360_64(0,__context__) = __left_rename_at_344;
+				_temp_make_local_360_64(1,__context__) = __right_rename_at_344;
+				return _temp_make_local_360_64;
+			})())))));
+			das_copy((__mks_360.at),(range(v_extract_xi(v_cast_vec4i(__left_rename_at_344->at)) /*x*/,v_extract_yi(v_cast_vec4i(__right_rename_at_344->at)) /*y*/)));
+			return __mks_360;
+		})())));
+	};
+}
+
+inline TVariant<16,regex::ReNode *,void *> re_re_c65c8cbaa2bd5746 ( Context * __context__, char * const  __expr_rename_at_366, int32_t __offset_rename_at_366 )
+{
+	if ( eos_dde6e11fd3802ac8(__context__,__expr_rename_at_366,__offset_rename_at_366) )
+	{
+		return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+	} else {
+		int32_t __cofs_rename_at_370 = __offset_rename_at_366;
+		regex::ReNode * __last_rename_at_371 = 0;
+		while ( !eos_dde6e11fd3802ac8(__context__,__expr_rename_at_366,__cofs_rename_at_370) )
+		{
+			if ( at_c9bade5ff7edd57d(__context__,__expr_rename_at_366,__cofs_rename_at_370) == 124 )
+			{
+				if ( __last_rename_at_371 == nullptr )
+				{
+					return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+				} else {
+					TVariant<16,regex::ReNode *,void *> __oright_rename_at_377 = re_re_c65c8cbaa2bd5746(__context__,__expr_rename_at_366,__cofs_rename_at_370 + 1);
+					if ( das_get_variant_field<void *,8,1>::is(__oright_rename_at_377) )
+					{
+						return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+					} else {
+						das_copy(__last_rename_at_371,mk_union_60be9923d982281f(__context__,__last_rename_at_371,das_get_variant_field<regex::ReNode *,8,0>::as(__oright_rename_at_377,__context__)));
+						das_copy(__cofs_rename_at_370,das_swizzle_ref<int32_t,range,1>::swizzle(__last_rename_at_371->at) /*y*/);
+					};
+				};
+			} else {
+				TVariant<16,regex::ReNode *,void *> __onext_rename_at_384 = re_basic_b4b0bffaf803ddc8(__context__,__expr_rename_at_366,__cofs_rename_at_370);
+				if ( das_get_variant_field<void *,8,1>::is(__onext_rename_at_384) )
+				{
+					TVariant<16,regex::ReNode *,void *> _temp_make_local_386_96;
+					TVariant<16,regex::ReNode *,void *> _temp_make_local_386_112;
+					return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast((__last_rename_at_371 == nullptr) ? das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast((_temp_make_local_386_96 = (nada_5086bd0a540f8186(__context__)))) : das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast((_temp_make_local_386_112 = (maybe_d7a4f325999cb99b(__context__,__last_rename_at_371)))));
+				} else {
+					das_copy(__last_rename_at_371,mk_concat_b7a782885b2b6870(__context__,__last_rename_at_371,das_get_variant_field<regex::ReNode *,8,0>::as(__onext_rename_at_384,__context__)));
+					das_copy(__cofs_rename_at_370,das_swizzle_ref<int32_t,range,1>::swizzle(__last_rename_at_371->at) /*y*/);
+				};
+			};
+		};
+		return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(maybe_d7a4f325999cb99b(__context__,__last_rename_at_371));
+	};
+}
+
+inline TVariant<16,regex::ReNode *,void *> re_basic_b4b0bffaf803ddc8 ( Context * __context__, char * const  __expr_rename_at_394, int32_t __offset_rename_at_394 )
+{
+	if ( eos_dde6e11fd3802ac8(__context__,__expr_rename_at_394,__offset_rename_at_394) )
+	{
+		return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+	} else {
+		TVariant<16,regex::ReNode *,void *> __oelem_rename_at_398 = re_elementary_44bc08d3b62d065a(__context__,__expr_rename_at_394,__offset_rename_at_394);
+		if ( das_get_variant_field<void *,8,1>::is(__oelem_rename_at_398) )
+		{
+			return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+		} else {
+			int32_t __ch_rename_at_401 = ((int32_t)at_c9bade5ff7edd57d(__context__,__expr_rename_at_394,next_ae6766dbd0f788ec(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__oelem_rename_at_398))));
+			if ( __ch_rename_at_401 == 42 )
+			{
+				return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(maybe_d7a4f325999cb99b(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+					regex::ReNode __mks_403;
+					das_zero(__mks_403);
+					das_copy((__mks_403.op),(DAS_COMMENT(enum) regex::ReOp::Star));
+					das_copy((__mks_403.subexpr),(das_get_variant_field<regex::ReNode *,8,0>::as(__oelem_rename_at_398,__context__)));
+					das_copy((__mks_403.at),(range(__offset_rename_at_394,next_ae6766dbd0f788ec(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__oelem_rename_at_398)) + 1)));
+					return __mks_403;
+				})()))));
+			} else if ( __ch_rename_at_401 == 43 )
+			{
+				return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(maybe_d7a4f325999cb99b(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+					regex::ReNode __mks_405;
+					das_zero(__mks_405);
+					das_copy((__mks_405.op),(DAS_COMMENT(enum) regex::ReOp::Plus));
+					das_copy((__mks_405.subexpr),(das_get_variant_field<regex::ReNode *,8,0>::as(__oelem_rename_at_398,__context__)));
+					das_copy((__mks_405.at),(range(__offset_rename_at_394,next_ae6766dbd0f788ec(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__oelem_rename_at_398)) + 1)));
+					return __mks_405;
+				})()))));
+			} else if ( __ch_rename_at_401 == 63 )
+			{
+				return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(maybe_d7a4f325999cb99b(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+					regex::ReNode __mks_407;
+					das_zero(__mks_407);
+					das_copy((__mks_407.op),(DAS_COMMENT(enum) regex::ReOp::Question));
+					das_copy((__mks_407.subexpr),(das_get_variant_field<regex::ReNode *,8,0>::as(__oelem_rename_at_398,__context__)));
+					das_copy((__mks_407.at),(range(__offset_rename_at_394,next_ae6766dbd0f788ec(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__oelem_rename_at_398)) + 1)));
+					return __mks_407;
+				})()))));
+			};
+			return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(__oelem_rename_at_398);
+		};
+	};
+}
+
+inline regex::ReNode * re_parse_3d6f9a305b851160 ( Context * __context__, char * const  __expr_rename_at_410 )
+{
+	TVariant<16,regex::ReNode *,void *> __ore_rename_at_411 = re_re_c65c8cbaa2bd5746(__context__,__expr_rename_at_410,0);
+	if ( das_get_variant_field<void *,8,1>::is(__ore_rename_at_411) )
+	{
+		return das_auto_cast<regex::ReNode *>::cast(nullptr);
+	} else {
+		int32_t __at_rename_at_414 = ((int32_t)next_ae6766dbd0f788ec(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__ore_rename_at_411)));
+		return das_auto_cast<regex::ReNode *>::cast((__at_rename_at_414 != builtin_string_length(__expr_rename_at_410,__context__)) ? das_auto_cast<void * const >::cast(nullptr) : das_auto_cast<void * const >::cast(das_get_variant_field<regex::ReNode *,8,0>::as(__ore_rename_at_411,__context__)));
+	};
+}
+
+inline void visit_top_down_ac4526f0a41e9d37 ( Context * __context__, regex::ReNode * __node_rename_at_420, Block DAS_COMMENT((void,regex::ReNode *)) const  &  __blk_rename_at_420 )
+{
+	das_invoke<void>::invoke<regex::ReNode *>(__context__,nullptr,__blk_rename_at_420,__node_rename_at_420);
+	{
+		uint64_t __loop_count_422 = UINT64_MAX;
+		// x : regex::ReNode?&
+		das_iterator<TArray<regex::ReNode *>> __x_iterator(__node_rename_at_420->all);
+		regex::ReNode * * __x_rename_at_422;
+		__loop_count_422 = das_loop_count(__loop_count_422,__x_iterator.loop_begin(__context__,(__x_rename_at_422)));
+		for ( ; __loop_count_422 ; --__loop_count_422, ++__x_rename_at_422 )
+		{
+			visit_top_down_ac4526f0a41e9d37(__context__,(*__x_rename_at_422),__blk_rename_at_420);
+		}
+		__x_iterator.loop_end(__context__,(__x_rename_at_422));
+	};
+	if ( __node_rename_at_420->subexpr != nullptr )
+	{
+		visit_top_down_ac4526f0a41e9d37(__context__,__node_rename_at_420->subexpr,__blk_rename_at_420);
+	};
+	if ( __node_rename_at_420->left != nullptr )
+	{
+		visit_top_down_ac4526f0a41e9d37(__context__,__node_rename_at_420->left,__blk_rename_at_420);
+	};
+	if ( __node_rename_at_420->right != nullptr )
+	{
+		visit_top_down_ac4526f0a41e9d37(__context__,__node_rename_at_420->right,__blk_rename_at_420);
+	};
+}
+
+inline void re_assign_next_1e223575dac53267 ( Context * __context__, regex::Regex &  __re_rename_at_431 ) { das_stack_prologue __prologue(__context__,128,"re_assign_next " DAS_FILE_LINE);
+{
+	int32_t __id_rename_at_432 = 0;
+	visit_top_down_ac4526f0a41e9d37(__context__,__re_rename_at_431.root,das_make_block<void,regex::ReNode *>(__context__,96,0,&__func_info__87bf23f355201ee1,[&](regex::ReNode * __node_rename_at_433)->void{
+		das_copy(__node_rename_at_433->id,__id_rename_at_432++);
+		if ( __node_rename_at_433->op == DAS_COMMENT(enum) regex::ReOp::Concat )
+		{
+			das_copy(__node_rename_at_433->left->next,__node_rename_at_433->right);
+			das_copy(__node_rename_at_433->right->next,__node_rename_at_433->next);
+		} else if ( __node_rename_at_433->op == DAS_COMMENT(enum) regex::ReOp::Group )
+		{
+			das_copy(__node_rename_at_433->subexpr->next,__node_rename_at_433->next);
+		} else if ( __node_rename_at_433->op == DAS_COMMENT(enum) regex::ReOp::Union )
+		{
+			{
+				uint64_t __loop_count_441 = UINT64_MAX;
+				// sub : regex::ReNode?&
+				das_iterator<TArray<regex::ReNode *>> __sub_iterator(__node_rename_at_433->all);
+				regex::ReNode * * __sub_rename_at_441;
+				__loop_count_441 = das_loop_count(__loop_count_441,__sub_iterator.loop_begin(__context__,(__sub_rename_at_441)));
+				for ( ; __loop_count_441 ; --__loop_count_441, ++__sub_rename_at_441 )
+				{
+					das_copy((*__sub_rename_at_441)->next,__node_rename_at_433->next);
+				}
+				__sub_iterator.loop_end(__context__,(__sub_rename_at_441));
+			};
+		};
+	}));
+}}
+
+inline void re_assign_groups_929e731066f7c1e9 ( Context * __context__, regex::Regex &  __re_rename_at_444 ) { das_stack_prologue __prologue(__context__,144,"re_assign_groups " DAS_FILE_LINE);
+{
+	TTuple<16,range,char *> _temp_make_local_445_32;
+	_Funcbuiltin_0x60_push_bd6055bce97bf09e(__context__,das_arg<TArray<TTuple<16,range,char *>>>::pass(__re_rename_at_444.groups),das_arg<TTuple<16,range,char *>>::pass((([&]() -> TTuple<16,range,char *>& {
+		das_get_tuple_field<range,0>::get(_temp_make_local_445_32) = range(0,0);
+		das_get_tuple_field<char *,8>::get(_temp_make_local_445_32) = nullptr;
+		return _temp_make_local_445_32;
+	})())));
+	visit_top_down_ac4526f0a41e9d37(__context__,__re_rename_at_444.root,das_make_block<void,regex::ReNode *>(__context__,96,0,&__func_info__87bf23f355201ee1,[&](regex::ReNode * __node_rename_at_446)->void{
+		if ( __node_rename_at_446->op == DAS_COMMENT(enum) regex::ReOp::Group )
+		{
+			TTuple<16,range,char *> _temp_make_local_450_128;
+			int32_t __index_rename_at_448 = ((int32_t)builtin_array_size(das_arg<TArray<TTuple<16,range,char *>>>::pass(__re_rename_at_444.groups)));
+			das_copy(__node_rename_at_446->index,__index_rename_at_448);
+			_Funcbuiltin_0x60_push_bd6055bce97bf09e(__context__,das_arg<TArray<TTuple<16,range,char *>>>::pass(__re_rename_at_444.groups),das_arg<TTuple<16,range,char *>>::pass((([&]() -> TTuple<16,range,char *>& {
+				das_get_tuple_field<range,0>::get(_temp_make_local_450_128) = range(0,0);
+				das_get_tuple_field<char *,8>::get(_temp_make_local_450_128) = das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_1, cast<int32_t>::from(__index_rename_at_448)));
+				return _temp_make_local_450_128;
+			})())));
+		};
+	}));
+}}
+
+inline void re_assign_match_functions_98136952e5810501 ( Context * __context__, regex::Regex &  __re_rename_at_456 ) { das_stack_prologue __prologue(__context__,96,"re_assign_match_functions " DAS_FILE_LINE);
+{
+	visit_top_down_ac4526f0a41e9d37(__context__,__re_rename_at_456.root,das_make_block<void,regex::ReNode *>(__context__,80,0,&__func_info__87bf23f355201ee1,[&](regex::ReNode * __node_rename_at_457)->void{
+		if ( __node_rename_at_457->op == DAS_COMMENT(enum) regex::ReOp::Char )
+		{
+			if ( __node_rename_at_457->textLen == 1 )
+			{
+				das_copy(__node_rename_at_457->fun2,Func(__context__->fnByMangledName(/*@regex::re_match2_single_char S<Regex> 1<S<ReNode>>? C1<u8>?*/ 5417525099520759799u)));
+			} else {
+				das_copy(__node_rename_at_457->fun2,Func(__context__->fnByMangledName(/*@regex::re_match2_char S<Regex> 1<S<ReNode>>? C1<u8>?*/ 8813790171797523608u)));
+			};
+		} else if ( __node_rename_at_457->op == DAS_COMMENT(enum) regex::ReOp::Union )
+		{
+			das_copy(__node_rename_at_457->fun2,Func(__context__->fnByMangledName(/*@regex::re_match2_union S<Regex> 1<S<ReNode>>? C1<u8>?*/ 1567949845072352365u)));
+		} else if ( __node_rename_at_457->op == DAS_COMMENT(enum) regex::ReOp::Set )
+		{
+			das_copy(__node_rename_at_457->fun2,Func(__context__->fnByMangledName(/*@regex::re_match2_set S<Regex> 1<S<ReNode>>? C1<u8>?*/ 2505824351754387524u)));
+		} else if ( __node_rename_at_457->op == DAS_COMMENT(enum) regex::ReOp::Any )
+		{
+			das_copy(__node_rename_at_457->fun2,Func(__context__->fnByMangledName(/*@regex::re_match2_any S<Regex> 1<S<ReNode>>? C1<u8>?*/ 17681010453701492986u)));
+		} else if ( __node_rename_at_457->op == DAS_COMMENT(enum) regex::ReOp::Eos )
+		{
+			das_copy(__node_rename_at_457->fun2,Func(__context__->fnByMangledName(/*@regex::re_match2_eos S<Regex> 1<S<ReNode>>? C1<u8>?*/ 9837147356575386631u)));
+		} else if ( __node_rename_at_457->op == DAS_COMMENT(enum) regex::ReOp::Concat )
+		{
+			das_copy(__node_rename_at_457->fun2,Func(__context__->fnByMangledName(/*@regex::re_match2_concat S<Regex> 1<S<ReNode>>? C1<u8>?*/ 10135892173037495604u)));
+		} else if ( __node_rename_at_457->op == DAS_COMMENT(enum) regex::ReOp::Plus )
+		{
+			if ( __node_rename_at_457->subexpr->op == DAS_COMMENT(enum) regex::ReOp::Set )
+			{
+				das_copy(__node_rename_at_457->cset,__node_rename_at_457->subexpr->cset);
+				das_copy(__node_rename_at_457->fun2,Func(__context__->fnByMangledName(/*@regex::re_match2_plus_set S<Regex> 1<S<ReNode>>? C1<u8>?*/ 3556589414834265461u)));
+			} else {
+				das_copy(__node_rename_at_457->fun2,Func(__context__->fnByMangledName(/*@regex::re_match2_plus S<Regex> 1<S<ReNode>>? C1<u8>?*/ 10809835202146601688u)));
+			};
+			das_copy(__node_rename_at_457->fun2,Func(__context__->fnByMangledName(/*@regex::re_match2_plus S<Regex> 1<S<ReNode>>? C1<u8>?*/ 10809835202146601688u)));
+		} else if ( __node_rename_at_457->op == DAS_COMMENT(enum) regex::ReOp::Star )
+		{
+			das_copy(__node_rename_at_457->fun2,Func(__context__->fnByMangledName(/*@regex::re_match2_star S<Regex> 1<S<ReNode>>? C1<u8>?*/ 16602614288544775340u)));
+		} else if ( __node_rename_at_457->op == DAS_COMMENT(enum) regex::ReOp::Question )
+		{
+			das_copy(__node_rename_at_457->fun2,Func(__context__->fnByMangledName(/*@regex::re_match2_question S<Regex> 1<S<ReNode>>? C1<u8>?*/ 15172342848343956220u)));
+		} else if ( __node_rename_at_457->op == DAS_COMMENT(enum) regex::ReOp::Group )
+		{
+			das_copy(__node_rename_at_457->fun2,Func(__context__->fnByMangledName(/*@regex::re_match2_group S<Regex> 1<S<ReNode>>? C1<u8>?*/ 111822258571238289u)));
+		} else {
+			builtin_throw(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_2, cast<char * const >::from(((char *) "unsupported ")), cast<DAS_COMMENT(enum) regex::ReOp>::from(__node_rename_at_457->op))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+		};
+	}));
+}}
+
+inline uint8_t * re_match2_single_char_719b92c7ae28adab ( Context * __context__, regex::Regex &  __regex_rename_at_490, regex::ReNode * __node_rename_at_490, uint8_t * const  __str_rename_at_490 )
+{
+	if ( get_character_uat(__node_rename_at_490->text,0) != int32_t((*(__str_rename_at_490))) )
+	{
+		return das_auto_cast<uint8_t *>::cast(nullptr);
+	} else {
+		uint8_t * __tail_rename_at_496 = das_ptr_add(__str_rename_at_490,1,1);
+		das_copy(__node_rename_at_490->tail,__tail_rename_at_496);
+		regex::ReNode * __node2_rename_at_498 = __node_rename_at_490->next;
+		return das_auto_cast<uint8_t *>::cast((__node2_rename_at_498 != nullptr) ? das_auto_cast<uint8_t *>::cast(das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,nullptr,__node2_rename_at_498->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_490),__node2_rename_at_498,__tail_rename_at_496)) : das_auto_cast<uint8_t *>::cast(__tail_rename_at_496));
+	};
+}
+
+inline uint8_t * re_match2_char_3fc4bfa2fc1fedb5 ( Context * __context__, regex::Regex &  __regex_rename_at_505, regex::ReNode * __node_rename_at_505, uint8_t * const  __str_rename_at_505 )
+{
+	if ( das_memcmp(das_auto_cast<void * const >::cast(das_cast<uint8_t *>::cast(__node_rename_at_505->text)),das_auto_cast<void * const >::cast(__str_rename_at_505),__node_rename_at_505->textLen) != 0 )
+	{
+		return das_auto_cast<uint8_t *>::cast(nullptr);
+	} else {
+		uint8_t * __tail_rename_at_511 = das_ptr_add(__str_rename_at_505,__node_rename_at_505->textLen,1);
+		das_copy(__node_rename_at_505->tail,__tail_rename_at_511);
+		regex::ReNode * __node2_rename_at_513 = __node_rename_at_505->next;
+		return das_auto_cast<uint8_t *>::cast((__node2_rename_at_513 != nullptr) ? das_auto_cast<uint8_t *>::cast(das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,nullptr,__node2_rename_at_513->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_505),__node2_rename_at_513,__tail_rename_at_511)) : das_auto_cast<uint8_t *>::cast(__tail_rename_at_511));
+	};
+}
+
+inline uint8_t * re_match2_union_50b558c71c5a33b ( Context * __context__, regex::Regex &  __regex_rename_at_522, regex::ReNode * __node_rename_at_522, uint8_t * const  __str_rename_at_522 )
+{
+	{
+		uint64_t __loop_count_525 = UINT64_MAX;
+		// sub : regex::ReNode?&
+		das_iterator<TArray<regex::ReNode *>> __sub_iterator(__node_rename_at_522->all);
+		regex::ReNode * * __sub_rename_at_525;
+		__loop_count_525 = das_loop_count(__loop_count_525,__sub_iterator.loop_begin(__context__,(__sub_rename_at_525)));
+		for ( ; __loop_count_525 ; --__loop_count_525, ++__sub_rename_at_525 )
+		{
+			uint8_t * __osub_rename_at_526 = ((uint8_t *)das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t * const >(__context__,nullptr,(*__sub_rename_at_525)->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_522),(*__sub_rename_at_525),__str_rename_at_522));
+			if ( __osub_rename_at_526 != nullptr )
+			{
+				das_copy(__node_rename_at_522->tail,(*__sub_rename_at_525)->tail);
+				return das_auto_cast<uint8_t *>::cast(__osub_rename_at_526);
+			};
+		}
+		__sub_iterator.loop_end(__context__,(__sub_rename_at_525));
+	};
+	return das_auto_cast<uint8_t *>::cast(nullptr);
+}
+
+inline uint8_t * re_match2_set_5ff68104be60aa42 ( Context * __context__, regex::Regex &  __regex_rename_at_533, regex::ReNode * __node_rename_at_533, uint8_t * const  __str_rename_at_533 )
+{
+	if ( !is_char_in_set(int32_t((*(__str_rename_at_533))),das_arg<TDim<uint32_t,8>>::pass(__node_rename_at_533->cset)) )
+	{
+		return das_auto_cast<uint8_t *>::cast(nullptr);
+	} else {
+		uint8_t * __tail_rename_at_539 = das_ptr_add(__str_rename_at_533,1,1);
+		das_copy(__node_rename_at_533->tail,__tail_rename_at_539);
+		regex::ReNode * __node2_rename_at_541 = __node_rename_at_533->next;
+		return das_auto_cast<uint8_t *>::cast((__node2_rename_at_541 != nullptr) ? das_auto_cast<uint8_t *>::cast(das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,nullptr,__node2_rename_at_541->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_533),__node2_rename_at_541,__tail_rename_at_539)) : das_auto_cast<uint8_t *>::cast(__tail_rename_at_539));
+	};
+}
+
+inline uint8_t * re_match2_any_2a47370c24660aa5 ( Context * __context__, regex::Regex &  __regex_rename_at_548, regex::ReNode * __node_rename_at_548, uint8_t * const  __str_rename_at_548 )
+{
+	if ( int32_t((*(__str_rename_at_548))) == 0 )
+	{
+		return das_auto_cast<uint8_t *>::cast(nullptr);
+	} else {
+		uint8_t * __tail_rename_at_554 = das_ptr_add(__str_rename_at_548,1,1);
+		das_copy(__node_rename_at_548->tail,__tail_rename_at_554);
+		regex::ReNode * __node2_rename_at_556 = __node_rename_at_548->next;
+		return das_auto_cast<uint8_t *>::cast((__node2_rename_at_556 != nullptr) ? das_auto_cast<uint8_t *>::cast(das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,nullptr,__node2_rename_at_556->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_548),__node2_rename_at_556,__tail_rename_at_554)) : das_auto_cast<uint8_t *>::cast(__tail_rename_at_554));
+	};
+}
+
+inline uint8_t * re_match2_concat_f320791e8feb9017 ( Context * __context__, regex::Regex &  __regex_rename_at_563, regex::ReNode * __node_rename_at_563, uint8_t * const  __str_rename_at_563 )
+{
+	regex::ReNode * __left_rename_at_566 = __node_rename_at_563->left;
+	uint8_t * __oleft_rename_at_567 = ((uint8_t *)das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t * const >(__context__,nullptr,__left_rename_at_566->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_563),__left_rename_at_566,__str_rename_at_563));
+	if ( __oleft_rename_at_567 == nullptr )
+	{
+		return das_auto_cast<uint8_t *>::cast(nullptr);
+	} else {
+		das_copy(__node_rename_at_563->tail,__node_rename_at_563->right->tail);
+		return das_auto_cast<uint8_t *>::cast(__oleft_rename_at_567);
+	};
+}
+
+inline uint8_t * re_match2_eos_3c1a8603d243a154 ( Context * __context__, regex::Regex &  __regex_rename_at_574, regex::ReNode * __node_rename_at_574, uint8_t * const  __str_rename_at_574 )
+{
+	if ( int32_t((*(__str_rename_at_574))) != 0 )
+	{
+		return das_auto_cast<uint8_t *>::cast(nullptr);
+	} else {
+		das_copy(__node_rename_at_574->tail,__str_rename_at_574);
+		regex::ReNode * __node2_rename_at_580 = __node_rename_at_574->next;
+		return das_auto_cast<uint8_t *>::cast((__node2_rename_at_580 != nullptr) ? das_auto_cast<uint8_t *>::cast(das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t * const >(__context__,nullptr,__node2_rename_at_580->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_574),__node2_rename_at_580,__str_rename_at_574)) : das_auto_cast<uint8_t *>::cast(__str_rename_at_574));
+	};
+}
+
+inline uint8_t * re_match2_question_fbce93a964c27959 ( Context * __context__, regex::Regex &  __regex_rename_at_587, regex::ReNode * __node_rename_at_587, uint8_t * const  __str_rename_at_587 )
+{
+	regex::ReNode * __nsub_rename_at_590 = __node_rename_at_587->subexpr;
+	uint8_t * __tail_rename_at_591 = das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t * const >(__context__,nullptr,__nsub_rename_at_590->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_587),__nsub_rename_at_590,__str_rename_at_587);
+	if ( __tail_rename_at_591 == nullptr )
+	{
+		das_copy(__tail_rename_at_591,__str_rename_at_587);
+	};
+	das_copy(__node_rename_at_587->tail,__tail_rename_at_591);
+	regex::ReNode * __node2_rename_at_595 = __node_rename_at_587->next;
+	return das_auto_cast<uint8_t *>::cast((__node2_rename_at_595 != nullptr) ? das_auto_cast<uint8_t *>::cast(das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,nullptr,__node2_rename_at_595->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_587),__node2_rename_at_595,__tail_rename_at_591)) : das_auto_cast<uint8_t *>::cast(__tail_rename_at_591));
+}
+
+inline uint8_t * re_match2_plus_f4ed81922769b54d ( Context * __context__, regex::Regex &  __regex_rename_at_602, regex::ReNode * __node_rename_at_602, uint8_t * const  __str_rename_at_602 )
+{
+	regex::ReNode * __nsub_rename_at_605 = __node_rename_at_602->subexpr;
+	uint8_t * __osym_rename_at_606 = das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t * const >(__context__,nullptr,__nsub_rename_at_605->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_602),__nsub_rename_at_605,__str_rename_at_602);
+	if ( __osym_rename_at_606 == nullptr )
+	{
+		return das_auto_cast<uint8_t *>::cast(nullptr);
+	} else {
+		uint8_t * __ofs_rename_at_609 = __osym_rename_at_606;
+		regex::ReNode * __node2_rename_at_610 = __node_rename_at_602->next;
+		if ( __node2_rename_at_610 != nullptr )
+		{
+			while ( __osym_rename_at_606 != nullptr )
+			{
+				das_copy(__node_rename_at_602->tail,__osym_rename_at_606);
+				uint8_t * __otail_rename_at_614 = das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,nullptr,__node2_rename_at_610->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_602),__node2_rename_at_610,__osym_rename_at_606);
+				if ( __otail_rename_at_614 != nullptr )
+				{
+					return das_auto_cast<uint8_t *>::cast(__otail_rename_at_614);
+				} else {
+					das_copy(__osym_rename_at_606,das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,nullptr,__nsub_rename_at_605->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_602),__nsub_rename_at_605,__osym_rename_at_606));
+				};
+			};
+			return das_auto_cast<uint8_t *>::cast(nullptr);
+		} else {
+			while ( __osym_rename_at_606 != nullptr )
+			{
+				das_copy(__ofs_rename_at_609,__osym_rename_at_606);
+				das_copy(__osym_rename_at_606,das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,nullptr,__nsub_rename_at_605->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_602),__nsub_rename_at_605,__ofs_rename_at_609));
+			};
+			das_copy(__node_rename_at_602->tail,__ofs_rename_at_609);
+			return das_auto_cast<uint8_t *>::cast(__ofs_rename_at_609);
+		};
+	};
+}
+
+inline uint8_t * re_match2_plus_set_f34b624c2a935b9 ( Context * __context__, regex::Regex &  __regex_rename_at_627, regex::ReNode * __node_rename_at_627, uint8_t * const  __str_rename_at_627 )
+{
+	if ( !is_char_in_set(int32_t((*(__str_rename_at_627))),das_arg<TDim<uint32_t,8>>::pass(__node_rename_at_627->cset)) )
+	{
+		return das_auto_cast<uint8_t *>::cast(nullptr);
+	} else {
+		uint8_t * __ofs_rename_at_634 = das_ptr_add(__str_rename_at_627,1,1);
+		uint8_t * __osym_rename_at_635 = __ofs_rename_at_634;
+		regex::ReNode * __node2_rename_at_636 = __node_rename_at_627->next;
+		if ( __node2_rename_at_636 != nullptr )
+		{
+			while ( __osym_rename_at_635 != nullptr )
+			{
+				das_copy(__node_rename_at_627->tail,__osym_rename_at_635);
+				uint8_t * __otail_rename_at_640 = das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,nullptr,__node2_rename_at_636->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_627),__node2_rename_at_636,__osym_rename_at_635);
+				if ( __otail_rename_at_640 != nullptr )
+				{
+					return das_auto_cast<uint8_t *>::cast(__otail_rename_at_640);
+				} else {
+					if ( !is_char_in_set(int32_t((*(__osym_rename_at_635))),das_arg<TDim<uint32_t,8>>::pass(__node_rename_at_627->cset)) )
+					{
+						return das_auto_cast<uint8_t *>::cast(nullptr);
+					} else {
+						das_ptr_inc(__osym_rename_at_635,1);
+					};
+				};
+			};
+			return das_auto_cast<uint8_t *>::cast(nullptr);
+		} else {
+			while ( __osym_rename_at_635 != nullptr )
+			{
+				das_copy(__ofs_rename_at_634,__osym_rename_at_635);
+				if ( !is_char_in_set(int32_t((*(__osym_rename_at_635))),das_arg<TDim<uint32_t,8>>::pass(__node_rename_at_627->cset)) )
+				{
+					break;
+				} else {
+					das_ptr_inc(__osym_rename_at_635,1);
+				};
+			};
+			das_copy(__node_rename_at_627->tail,__ofs_rename_at_634);
+			return das_auto_cast<uint8_t *>::cast(__ofs_rename_at_634);
+		};
+	};
+}
+
+inline uint8_t * re_match2_star_533ab88bf27eabb3 ( Context * __context__, regex::Regex &  __regex_rename_at_657, regex::ReNode * __node_rename_at_657, uint8_t * const  __str_rename_at_657 )
+{
+	uint8_t * __ofs_rename_at_660 = __str_rename_at_657;
+	regex::ReNode * __node2_rename_at_661 = __node_rename_at_657->next;
+	regex::ReNode * __nsub_rename_at_662 = __node_rename_at_657->subexpr;
+	if ( __node2_rename_at_661 != nullptr )
+	{
+		while ( __ofs_rename_at_660 != nullptr )
+		{
+			das_copy(__node_rename_at_657->tail,__ofs_rename_at_660);
+			uint8_t * __oany_rename_at_666 = ((uint8_t *)das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,nullptr,__node2_rename_at_661->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_657),__node2_rename_at_661,__ofs_rename_at_660));
+			if ( __oany_rename_at_666 != nullptr )
+			{
+				return das_auto_cast<uint8_t *>::cast(__oany_rename_at_666);
+			} else {
+				das_copy(__ofs_rename_at_660,das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,nullptr,__nsub_rename_at_662->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_657),__nsub_rename_at_662,__ofs_rename_at_660));
+			};
+		};
+		return das_auto_cast<uint8_t *>::cast(nullptr);
+	} else {
+		uint8_t * __osym_rename_at_672 = __ofs_rename_at_660;
+		while ( __osym_rename_at_672 != nullptr )
+		{
+			das_copy(__ofs_rename_at_660,__osym_rename_at_672);
+			das_copy(__osym_rename_at_672,das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,nullptr,__nsub_rename_at_662->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_657),__nsub_rename_at_662,__ofs_rename_at_660));
+		};
+		das_copy(__node_rename_at_657->tail,__ofs_rename_at_660);
+		return das_auto_cast<uint8_t *>::cast(__ofs_rename_at_660);
+	};
+}
+
+inline uint8_t * re_match2_group_1b52c8cbe220eede ( Context * __context__, regex::Regex &  __regex_rename_at_680, regex::ReNode * __node_rename_at_680, uint8_t * const  __str_rename_at_680 )
+{
+	regex::ReNode * __nsub_rename_at_683 = __node_rename_at_680->subexpr;
+	uint8_t * __osub_rename_at_684 = ((uint8_t *)das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t * const >(__context__,nullptr,__nsub_rename_at_683->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_680),__nsub_rename_at_683,__str_rename_at_680));
+	if ( __osub_rename_at_684 == nullptr )
+	{
+		return das_auto_cast<uint8_t *>::cast(nullptr);
+	} else {
+		das_copy(das_get_tuple_field<range,0>::get(__regex_rename_at_680.groups(__node_rename_at_680->index,__context__)),range(int32_t(i_das_ptr_diff(das_auto_cast<void * const >::cast(__str_rename_at_680),das_auto_cast<void * const >::cast(__regex_rename_at_680.match),1)),int32_t(i_das_ptr_diff(das_auto_cast<void * const >::cast(__node_rename_at_680->subexpr->tail),das_auto_cast<void * const >::cast(__regex_rename_at_680.match),1))));
+		return das_auto_cast<uint8_t *>::cast(__osub_rename_at_684);
+	};
+}
+
+inline bool re_early_out_7af43e1fb0ced133 ( Context * __context__, TDim<uint32_t,8> &  __cset_rename_at_694, regex::ReNode * const  __node_rename_at_694 )
+{
+	if ( __node_rename_at_694->op == DAS_COMMENT(enum) regex::ReOp::Char )
+	{
+		set_or_char_471888d9ed78efab(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_694),get_character_at(__node_rename_at_694->text,0,__context__));
+		return das_auto_cast<bool>::cast(false);
+	} else if ( __node_rename_at_694->op == DAS_COMMENT(enum) regex::ReOp::Set )
+	{
+		set_or_set_9609a9e932b32815(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_694),__node_rename_at_694->cset);
+		return das_auto_cast<bool>::cast(false);
+	} else if ( __node_rename_at_694->op == DAS_COMMENT(enum) regex::ReOp::Any )
+	{
+		{
+			uint64_t __loop_count_702 = UINT64_MAX;
+			// x : uint aka CharSet& -const
+			das_iterator<TDim<uint32_t,8>> __x_iterator(__cset_rename_at_694);
+			uint32_t * __x_rename_at_702;
+			__loop_count_702 = das_loop_count(__loop_count_702,__x_iterator.loop_begin(__context__,(__x_rename_at_702)));
+			for ( ; __loop_count_702 ; --__loop_count_702, ++__x_rename_at_702 )
+			{
+				das_copy((*__x_rename_at_702),0xffffffffu);
+			}
+			__x_iterator.loop_end(__context__,(__x_rename_at_702));
+		};
+		return das_auto_cast<bool>::cast(false);
+	} else if ( __node_rename_at_694->op == DAS_COMMENT(enum) regex::ReOp::Eos )
+	{
+		return das_auto_cast<bool>::cast(false);
+	} else if ( __node_rename_at_694->op == DAS_COMMENT(enum) regex::ReOp::Group )
+	{
+		return das_auto_cast<bool>::cast(re_early_out_7af43e1fb0ced133(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_694),__node_rename_at_694->subexpr));
+	} else if ( __node_rename_at_694->op == DAS_COMMENT(enum) regex::ReOp::Plus )
+	{
+		return das_auto_cast<bool>::cast(re_early_out_7af43e1fb0ced133(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_694),__node_rename_at_694->subexpr));
+	} else if ( __node_rename_at_694->op == DAS_COMMENT(enum) regex::ReOp::Star )
+	{
+		re_early_out_7af43e1fb0ced133(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_694),__node_rename_at_694->subexpr);
+		return das_auto_cast<bool>::cast(true);
+	} else if ( __node_rename_at_694->op == DAS_COMMENT(enum) regex::ReOp::Question )
+	{
+		re_early_out_7af43e1fb0ced133(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_694),__node_rename_at_694->subexpr);
+		return das_auto_cast<bool>::cast(true);
+	} else if ( __node_rename_at_694->op == DAS_COMMENT(enum) regex::ReOp::Concat )
+	{
+		bool __left_rename_at_718 = ((bool)re_early_out_7af43e1fb0ced133(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_694),__node_rename_at_694->left));
+		return das_auto_cast<bool>::cast(__left_rename_at_718 ? das_auto_cast<bool>::cast(re_early_out_7af43e1fb0ced133(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_694),__node_rename_at_694->right)) : das_auto_cast<bool>::cast(false));
+	} else if ( __node_rename_at_694->op == DAS_COMMENT(enum) regex::ReOp::Union )
+	{
+		bool __any_rename_at_721 = false;
+		{
+			uint64_t __loop_count_722 = UINT64_MAX;
+			// sub : regex::ReNode? const&
+			das_iterator<TArray<regex::ReNode *> const > __sub_iterator(__node_rename_at_694->all);
+			regex::ReNode * const  * __sub_rename_at_722;
+			__loop_count_722 = das_loop_count(__loop_count_722,__sub_iterator.loop_begin(__context__,(__sub_rename_at_722)));
+			for ( ; __loop_count_722 ; --__loop_count_722, ++__sub_rename_at_722 )
+			{
+				das_copy(__any_rename_at_721,re_early_out_7af43e1fb0ced133(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_694),(*__sub_rename_at_722)) || __any_rename_at_721);
+			}
+			__sub_iterator.loop_end(__context__,(__sub_rename_at_722));
+		};
+		return das_auto_cast<bool>::cast(__any_rename_at_721);
+	} else {
+		builtin_throw(((char *) "unsupported operation"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+		return das_auto_cast<bool>::cast(false);
+	};
+}
+
+inline bool is_valid_f341200a6f682e5a ( Context * __context__, regex::Regex &  __re_rename_at_733 )
+{
+	return das_auto_cast<bool>::cast(__re_rename_at_733.root != nullptr);
+}
+
+inline bool regex_compile_49466229404ec92e ( Context * __context__, regex::Regex &  __re_rename_at_737, char * const  __expr_rename_at_737 )
+{
+	das_copy(__re_rename_at_737.root,re_parse_3d6f9a305b851160(__context__,__expr_rename_at_737));
+	if ( __re_rename_at_737.root != nullptr )
+	{
+		re_assign_next_1e223575dac53267(__context__,das_arg<regex::Regex>::pass(__re_rename_at_737));
+		re_assign_groups_929e731066f7c1e9(__context__,das_arg<regex::Regex>::pass(__re_rename_at_737));
+		re_assign_match_functions_98136952e5810501(__context__,das_arg<regex::Regex>::pass(__re_rename_at_737));
+		re_early_out_7af43e1fb0ced133(__context__,das_arg<TDim<uint32_t,8>>::pass(__re_rename_at_737.earlyOut),__re_rename_at_737.root);
+		das_copy(__re_rename_at_737.canEarlyOut,!is_set_empty_fb12252b2129800d(__context__,das_arg<TDim<uint32_t,8>>::pass(__re_rename_at_737.earlyOut)));
+	};
+	return das_auto_cast<bool>::cast(__re_rename_at_737.root != nullptr);
+}
+
+inline regex::Regex regex_compile_3ab3aff652051470 ( Context * __context__, char * const  __expr_rename_at_749 )
+{
+	regex::Regex __re_rename_at_750; das_zero(__re_rename_at_750);
+	if ( !regex_compile_49466229404ec92e(__context__,das_arg<regex::Regex>::pass(__re_rename_at_750),__expr_rename_at_749) )
+	{
+		builtin_throw(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_3, cast<char * const >::from(((char *) "regular expression ")), cast<char * const >::from(__expr_rename_at_749), cast<char * const >::from(((char *) " did not compile")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	};
+	return /* <- */ das_auto_cast_move<regex::Regex>::cast(_Funcbuiltin_0x60__return_with_lockcheck_48c386c3dcec1cdd(__context__,das_arg<regex::Regex>::pass(__re_rename_at_750)));
+}
+
+inline regex::Regex regex_compile_34958ec809c4585e ( Context * __context__, regex::Regex &  __re_rename_at_755 )
+{
+	if ( __re_rename_at_755.root != nullptr )
+	{
+		re_assign_next_1e223575dac53267(__context__,das_arg<regex::Regex>::pass(__re_rename_at_755));
+		re_assign_match_functions_98136952e5810501(__context__,das_arg<regex::Regex>::pass(__re_rename_at_755));
+	};
+	return /* <- */ das_auto_cast_move<regex::Regex>::cast(_Funcbuiltin_0x60__return_with_lockcheck_48c386c3dcec1cdd(__context__,das_arg<regex::Regex>::pass(__re_rename_at_755)));
+}
+
+inline int32_t regex_match_270cb942810fc6f1 ( Context * __context__, regex::Regex &  __regex_rename_at_761, char * const  __str_rename_at_761, int32_t __offset_rename_at_761 )
+{
+	if ( builtin_empty(__str_rename_at_761) )
+	{
+		return das_auto_cast<int32_t>::cast(-1);
+	} else {
+		das_copy(__regex_rename_at_761.match,das_cast<uint8_t *>::cast(__str_rename_at_761));
+		uint8_t * __mptr_rename_at_770 = ((uint8_t *)das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,nullptr,__regex_rename_at_761.root->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_761),__regex_rename_at_761.root,__regex_rename_at_761.match));
+		return das_auto_cast<int32_t>::cast((__mptr_rename_at_770 == nullptr) ? das_auto_cast<int32_t>::cast(-1) : das_auto_cast<int32_t>::cast(int32_t(i_das_ptr_diff(das_auto_cast<void * const >::cast(__mptr_rename_at_770),das_auto_cast<void * const >::cast(__regex_rename_at_761.match),1))));
+	};
+}
+
+inline char * regex_group_1f825e4ecddcb4c9 ( Context * __context__, regex::Regex const  &  __regex_rename_at_775, int32_t __index_rename_at_775, char * const  __match_rename_at_775 )
+{
+	range __sub_range_rename_at_777 = ((range)das_get_tuple_field<range,0>::get(__regex_rename_at_775.groups(__index_rename_at_775,__context__)));
+	return das_auto_cast<char *>::cast(((char *)(builtin_string_slice1(__match_rename_at_775,v_extract_xi(v_cast_vec4i(__sub_range_rename_at_777)) /*x*/,v_extract_yi(v_cast_vec4i(__sub_range_rename_at_777)) /*y*/,__context__))));
+}
+
+inline void regex_foreach_15997c561ebb2761 ( Context * __context__, regex::Regex &  __regex_rename_at_781, char * const  __str_rename_at_781, Block DAS_COMMENT((bool,range)) const  &  __blk_rename_at_781 )
+{
+	if ( builtin_empty(__str_rename_at_781) )
+	{
+		return ;
+	} else {
+		das_copy(__regex_rename_at_781.match,das_cast<uint8_t *>::cast(__str_rename_at_781));
+		regex::ReNode * __root_rename_at_787 = __regex_rename_at_781.root;
+		uint8_t * __pstr_rename_at_788 = das_cast<uint8_t *>::cast(__str_rename_at_781);
+		uint8_t * __cstr_rename_at_789 = __pstr_rename_at_788;
+		if ( __regex_rename_at_781.canEarlyOut )
+		{
+			while ( true )
+			{
+				int32_t __Ch_rename_at_793 = ((int32_t)int32_t((*(__cstr_rename_at_789))));
+				if ( __Ch_rename_at_793 == 0 )
+				{
+					break;
+				} else {
+					if ( is_char_in_set(__Ch_rename_at_793,das_arg<TDim<uint32_t,8>>::pass(__regex_rename_at_781.earlyOut)) )
+					{
+						uint8_t * __om_rename_at_797 = ((uint8_t *)das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,nullptr,__root_rename_at_787->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_781),__root_rename_at_787,__cstr_rename_at_789));
+						if ( __om_rename_at_797 != nullptr )
+						{
+							if ( !das_invoke<bool>::invoke<range>(__context__,nullptr,__blk_rename_at_781,range(int32_t(i_das_ptr_diff(das_auto_cast<void * const >::cast(__cstr_rename_at_789),das_auto_cast<void * const >::cast(__pstr_rename_at_788),1)),int32_t(i_das_ptr_diff(das_auto_cast<void * const >::cast(__om_rename_at_797),das_auto_cast<void * const >::cast(__pstr_rename_at_788),1)))) )
+							{
+								break;
+							} else {
+								das_copy(__cstr_rename_at_789,__om_rename_at_797);
+							};
+						} else {
+							das_ptr_inc(__cstr_rename_at_789,1);
+						};
+					} else {
+						das_ptr_inc(__cstr_rename_at_789,1);
+					};
+				};
+			};
+		} else {
+			while ( int32_t((*(__cstr_rename_at_789))) != 0 )
+			{
+				uint8_t * __om_rename_at_808 = ((uint8_t *)das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,nullptr,__root_rename_at_787->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_781),__root_rename_at_787,__cstr_rename_at_789));
+				if ( __om_rename_at_808 != nullptr )
+				{
+					if ( !das_invoke<bool>::invoke<range>(__context__,nullptr,__blk_rename_at_781,range(int32_t(i_das_ptr_diff(das_auto_cast<void * const >::cast(__cstr_rename_at_789),das_auto_cast<void * const >::cast(__pstr_rename_at_788),1)),int32_t(i_das_ptr_diff(das_auto_cast<void * const >::cast(__om_rename_at_808),das_auto_cast<void * const >::cast(__pstr_rename_at_788),1)))) )
+					{
+						break;
+					} else {
+						das_copy(__cstr_rename_at_789,__om_rename_at_808);
+					};
+				} else {
+					das_ptr_inc(__cstr_rename_at_789,1);
+				};
+			};
+		};
+	};
+}
+
+inline void regex_debug_ceb0bfb647144f34 ( Context * __context__, regex::Regex const  &  __regex_rename_at_820 )
+{
+	debug_re_57e80c63d554e31c(__context__,__regex_rename_at_820.root,1);
+	builtin_print(((char *) "\n"),__context__);
+	if ( __regex_rename_at_820.canEarlyOut )
+	{
+		builtin_print(((char *) "early out: "),__context__);
+		debug_set_31f032942f694fa4(__context__,__regex_rename_at_820.earlyOut);
+		builtin_print(((char *) "\n"),__context__);
+	};
+	if ( builtin_array_size(__regex_rename_at_820.groups) != 0 )
+	{
+		builtin_print(((char *) "groups:"),__context__);
+		{
+			uint64_t __loop_count_830 = UINT64_MAX;
+			// g : tuple<range;string> const&
+			das_iterator<TArray<TTuple<16,range,char *>> const > __g_iterator(__regex_rename_at_820.groups);
+			TTuple<16,range,char *> const  * __g_rename_at_830;
+			__loop_count_830 = das_loop_count(__loop_count_830,__g_iterator.loop_begin(__context__,(__g_rename_at_830)));
+			for ( ; __loop_count_830 ; --__loop_count_830, ++__g_rename_at_830 )
+			{
+				builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_4, cast<char * const >::from(((char *) "\t")), cast<char * const >::from(das_get_tuple_field<char *,8>::get((*__g_rename_at_830))), cast<char * const >::from(((char *) "\n")))),__context__);
+			}
+			__g_iterator.loop_end(__context__,(__g_rename_at_830));
+		};
+	};
+}
+
+inline void debug_set_31f032942f694fa4 ( Context * __context__, TDim<uint32_t,8> const  &  __cset_rename_at_833 )
+{
+	{
+		uint64_t __loop_count_835 = UINT64_MAX;
+		// x : int const
+		das_iterator<range> __x_iterator(range(0,256));
+		int32_t __x_rename_at_835;
+		__loop_count_835 = das_loop_count(__loop_count_835,__x_iterator.loop_begin(__context__,(__x_rename_at_835)));
+		for ( ; __loop_count_835 ; --__loop_count_835, ++__x_rename_at_835 )
+		{
+			if ( (__cset_rename_at_833((__x_rename_at_835 >> 5),__context__) & uint32_t(1 << (__x_rename_at_835 & 31))) != 0x0u )
+			{
+				if ( (__x_rename_at_835 >= 32) && (__x_rename_at_835 <= 127) )
+				{
+					builtin_print(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_5, cast<char *>::from(((char *)(to_string_char(__x_rename_at_835,__context__)))))),__context__);
+				} else {
+					builtin_print(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_6, cast<char * const >::from(((char *) "\\")), cast<int32_t>::from(__x_rename_at_835))),__context__);
+				};
+			};
+		}
+		__x_iterator.loop_end(__context__,(__x_rename_at_835));
+	};
+}
+
+inline void debug_re_57e80c63d554e31c ( Context * __context__, regex::ReNode * const  __node_rename_at_842, int32_t __tab_rename_at_842 )
+{
+	builtin_print(((char *) "("),__context__);
+	if ( __node_rename_at_842 != nullptr )
+	{
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_7, cast<char * const >::from(((char *) "#")), cast<int32_t>::from(__node_rename_at_842->id))),__context__);
+		if ( __node_rename_at_842->next != nullptr )
+		{
+			builtin_print(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_8, cast<char * const >::from(((char *) "->")), cast<int32_t>::from(__node_rename_at_842->next->id))),__context__);
+		} else {
+			builtin_print(((char *) "->!"),__context__);
+		};
+		builtin_print(((char *) " "),__context__);
+	};
+	if ( __node_rename_at_842 == nullptr )
+	{
+		builtin_print(((char *) "null)"),__context__);
+	} else if ( __node_rename_at_842->op == DAS_COMMENT(enum) regex::ReOp::Char )
+	{
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_9, cast<char * const >::from(((char *) "Char `")), cast<char * const >::from(__node_rename_at_842->text), cast<char * const >::from(((char *) "`)")))),__context__);
+	} else if ( __node_rename_at_842->op == DAS_COMMENT(enum) regex::ReOp::Set )
+	{
+		builtin_print(((char *) "Set "),__context__);
+		debug_set_31f032942f694fa4(__context__,__node_rename_at_842->cset);
+		builtin_print(((char *) ")"),__context__);
+	} else if ( __node_rename_at_842->op == DAS_COMMENT(enum) regex::ReOp::Any )
+	{
+		builtin_print(((char *) "Any)"),__context__);
+	} else if ( __node_rename_at_842->op == DAS_COMMENT(enum) regex::ReOp::Eos )
+	{
+		builtin_print(((char *) "Eos)"),__context__);
+	} else if ( __node_rename_at_842->op == DAS_COMMENT(enum) regex::ReOp::Group )
+	{
+		builtin_print(((char *) "Group "),__context__);
+		debug_re_57e80c63d554e31c(__context__,__node_rename_at_842->subexpr,__tab_rename_at_842 + 1);
+		builtin_print(((char *) ")"),__context__);
+	} else if ( __node_rename_at_842->op == DAS_COMMENT(enum) regex::ReOp::Plus )
+	{
+		builtin_print(((char *) "Plus "),__context__);
+		debug_re_57e80c63d554e31c(__context__,__node_rename_at_842->subexpr,__tab_rename_at_842);
+		builtin_print(((char *) ")"),__context__);
+	} else if ( __node_rename_at_842->op == DAS_COMMENT(enum) regex::ReOp::Star )
+	{
+		builtin_print(((char *) "Star "),__context__);
+		debug_re_57e80c63d554e31c(__context__,__node_rename_at_842->subexpr,__tab_rename_at_842);
+		builtin_print(((char *) ")"),__context__);
+	} else if ( __node_rename_at_842->op == DAS_COMMENT(enum) regex::ReOp::Question )
+	{
+		builtin_print(((char *) "Question "),__context__);
+		debug_re_57e80c63d554e31c(__context__,__node_rename_at_842->subexpr,__tab_rename_at_842);
+		builtin_print(((char *) ")"),__context__);
+	} else if ( __node_rename_at_842->op == DAS_COMMENT(enum) regex::ReOp::Concat )
+	{
+		builtin_print(((char *) "Contact"),__context__);
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_10, cast<char * const >::from(((char *) "\n")), cast<char *>::from(((char *)(string_repeat(((char *) "\t"),__tab_rename_at_842,__context__)))))),__context__);
+		debug_re_57e80c63d554e31c(__context__,__node_rename_at_842->left,__tab_rename_at_842 + 1);
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_11, cast<char * const >::from(((char *) "\n")), cast<char *>::from(((char *)(string_repeat(((char *) "\t"),__tab_rename_at_842,__context__)))))),__context__);
+		debug_re_57e80c63d554e31c(__context__,__node_rename_at_842->right,__tab_rename_at_842 + 1);
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_12, cast<char * const >::from(((char *) "\n")), cast<char *>::from(((char *)(string_repeat(((char *) "\t"),__tab_rename_at_842 - 1,__context__)))), cast<char * const >::from(((char *) ")")))),__context__);
+	} else if ( __node_rename_at_842->op == DAS_COMMENT(enum) regex::ReOp::Union )
+	{
+		builtin_print(((char *) "Union\n"),__context__);
+		{
+			uint64_t __loop_count_888 = UINT64_MAX;
+			// sub : regex::ReNode? const&
+			das_iterator<TArray<regex::ReNode *> const > __sub_iterator(__node_rename_at_842->all);
+			regex::ReNode * const  * __sub_rename_at_888;
+			__loop_count_888 = das_loop_count(__loop_count_888,__sub_iterator.loop_begin(__context__,(__sub_rename_at_888)));
+			for ( ; __loop_count_888 ; --__loop_count_888, ++__sub_rename_at_888 )
+			{
+				builtin_print(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_13, cast<char *>::from(((char *)(string_repeat(((char *) "\t"),__tab_rename_at_842,__context__)))))),__context__);
+				debug_re_57e80c63d554e31c(__context__,(*__sub_rename_at_888),__tab_rename_at_842 + 1);
+				builtin_print(((char *) "\n"),__context__);
+			}
+			__sub_iterator.loop_end(__context__,(__sub_rename_at_888));
+		};
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_14, cast<char *>::from(((char *)(string_repeat(((char *) "\t"),__tab_rename_at_842 - 1,__context__)))), cast<char * const >::from(((char *) ")")))),__context__);
+	} else {
+		builtin_throw(((char *) "unsupported op"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	};
+}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_resize_13e4a05653768251
+	aotLib[0xb8d697922f2109d1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<regex::ReNode *> & , int32_t  ),&_Funcbuiltin_0x60_resize_13e4a05653768251>>();
+	};
+	// _Funcbuiltin_0x60_finalize_b7deb464a4f8e41c
+	aotLib[0x758695fb5456c425] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<regex::ReNode *> &  ),&_Funcbuiltin_0x60_finalize_b7deb464a4f8e41c>>();
+	};
+	// _Funcbuiltin_0x60_length_7938efcc1bc3eff1
+	aotLib[0x494cf457a90783a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TDim<regex::ReNode *,2> const  &  ),&_Funcbuiltin_0x60_length_7938efcc1bc3eff1>>();
+	};
+	// finalize_bbd896e678be00ff
+	aotLib[0xb32e499c2eb2c3c6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode &  ),&finalize_bbd896e678be00ff>>();
+	};
+	// _Funcbuiltin_0x60_push_bd6055bce97bf09e
+	aotLib[0x6d0307266f50e401] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TTuple<16,range,char *>> & , TTuple<16,range,char *> const  &  ),&_Funcbuiltin_0x60_push_bd6055bce97bf09e>>();
+	};
+	// _Funcbuiltin_0x60__return_with_lockcheck_48c386c3dcec1cdd
+	aotLib[0x15eca16e6b0825d1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<regex::Regex & (*) ( Context * __context__, regex::Regex &  ),&_Funcbuiltin_0x60__return_with_lockcheck_48c386c3dcec1cdd>>();
+	};
+	// finalize_6293242d2ef1254f
+	aotLib[0xe0fad52ab9ade906] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TVariant<16,regex::ReNode *,void *> &  ),&finalize_6293242d2ef1254f>>();
+	};
+	// finalize_98648ee1450a27e3
+	aotLib[0xa753e7c165143eea] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * &  ),&finalize_98648ee1450a27e3>>();
+	};
+	// _Funcbuiltin_0x60_push_5dc212b561cc93c2
+	aotLib[0x2819a5074444d141] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<regex::ReNode *> & , regex::ReNode * const   ),&_Funcbuiltin_0x60_push_5dc212b561cc93c2>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_7c7ffb3d18c3d845
+	aotLib[0x752a06fecaab37a2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<regex::ReNode *> (*) ( Context * __context__, TDim<regex::ReNode *,2> &  ),&_Funcbuiltin_0x60_to_array_move_7c7ffb3d18c3d845>>();
+	};
+	// trace_89f6695f8909b072
+	aotLib[0x3501f19b79ba4ed9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , int32_t  ),&trace_89f6695f8909b072>>();
+	};
+	// note_89f6695f8909b072
+	aotLib[0x3501f19b79ba4ed9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , int32_t  ),&note_89f6695f8909b072>>();
+	};
+	// trace_backtrack_c77fe5b3ac1a6a7c
+	aotLib[0x474399c20ee853ed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&trace_backtrack_c77fe5b3ac1a6a7c>>();
+	};
+	// trace_value_4739abdd3b0a7208
+	aotLib[0xd1da75c466857d11] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * const   ),&trace_value_4739abdd3b0a7208>>();
+	};
+	// nada_5086bd0a540f8186
+	aotLib[0x9b6df455d513d23d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__ ),&nada_5086bd0a540f8186>>();
+	};
+	// maybe_d7a4f325999cb99b
+	aotLib[0x37a52685839e8db5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, regex::ReNode * const   ),&maybe_d7a4f325999cb99b>>();
+	};
+	// eos_dde6e11fd3802ac8
+	aotLib[0x961e013842bdd11] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, char * const  , int32_t  ),&eos_dde6e11fd3802ac8>>();
+	};
+	// at_c9bade5ff7edd57d
+	aotLib[0x9d976e8cdb634999] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, char * const  , int32_t  ),&at_c9bade5ff7edd57d>>();
+	};
+	// next_ae6766dbd0f788ec
+	aotLib[0xfea0eb9385d837a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TVariant<16,regex::ReNode *,void *> const  &  ),&next_ae6766dbd0f788ec>>();
+	};
+	// is_set_empty_fb12252b2129800d
+	aotLib[0x920d0936973b20a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TDim<uint32_t,8> const  &  ),&is_set_empty_fb12252b2129800d>>();
+	};
+	// set_or_char_471888d9ed78efab
+	aotLib[0xc4836b64ee70e729] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,8> & , int32_t  ),&set_or_char_471888d9ed78efab>>();
+	};
+	// set_or_range_a7ad44e8ef1ec07c
+	aotLib[0xcc4c06a5bc038efd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,8> & , range  ),&set_or_range_a7ad44e8ef1ec07c>>();
+	};
+	// set_invert_be791c77bc6b6a11
+	aotLib[0x6dfa45c4c6120e9d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,8> &  ),&set_invert_be791c77bc6b6a11>>();
+	};
+	// set_or_set_9609a9e932b32815
+	aotLib[0xa88845650b665991] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,8> & , TDim<uint32_t,8> const  &  ),&set_or_set_9609a9e932b32815>>();
+	};
+	// set_negative_7a1fcd94df7d5358
+	aotLib[0xf2801af36a693199] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,8> &  ),&set_negative_7a1fcd94df7d5358>>();
+	};
+	// set_meta_cc349e8f6f2b739
+	aotLib[0xe46b923364f59296] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,8> & , int32_t  ),&set_meta_cc349e8f6f2b739>>();
+	};
+	// is_meta_character_24d3d25015b1373f
+	aotLib[0xc2120b306e7bee35] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, int32_t  ),&is_meta_character_24d3d25015b1373f>>();
+	};
+	// is_set_character_11f8fcca4329c870
+	aotLib[0x71b9b841679480a1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, int32_t  ),&is_set_character_11f8fcca4329c870>>();
+	};
+	// re_char_99a4d28b0400d98b
+	aotLib[0x725784fab11d20b9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_char_99a4d28b0400d98b>>();
+	};
+	// re_set_items_f2bcd0927fa2c940
+	aotLib[0x7de1f3f6f0bea985] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_set_items_f2bcd0927fa2c940>>();
+	};
+	// re_set_6bf98af24a35a9ab
+	aotLib[0xee1bdb287a228b89] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_set_6bf98af24a35a9ab>>();
+	};
+	// re_any_99be1211b087eb79
+	aotLib[0xed84df65b76d0a1e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_any_99be1211b087eb79>>();
+	};
+	// re_eos_fc064f5c08d3ae96
+	aotLib[0xcd7f9d191af6597e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_eos_fc064f5c08d3ae96>>();
+	};
+	// re_group_b0fc9ca2e5ea7489
+	aotLib[0xff808b69695df48c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_group_b0fc9ca2e5ea7489>>();
+	};
+	// re_elementary_44bc08d3b62d065a
+	aotLib[0x72a9816b1cdc2bfe] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_elementary_44bc08d3b62d065a>>();
+	};
+	// mk_concat_b7a782885b2b6870
+	aotLib[0x75bd7e7e5b8548fe] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<regex::ReNode * (*) ( Context * __context__, regex::ReNode * , regex::ReNode *  ),&mk_concat_b7a782885b2b6870>>();
+	};
+	// mk_union_60be9923d982281f
+	aotLib[0x61839d96589c4a82] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<regex::ReNode * (*) ( Context * __context__, regex::ReNode * , regex::ReNode *  ),&mk_union_60be9923d982281f>>();
+	};
+	// re_re_c65c8cbaa2bd5746
+	aotLib[0x8900b3b1245d7e2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_re_c65c8cbaa2bd5746>>();
+	};
+	// re_basic_b4b0bffaf803ddc8
+	aotLib[0x8eb2c04b05fda139] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_basic_b4b0bffaf803ddc8>>();
+	};
+	// re_parse_3d6f9a305b851160
+	aotLib[0x495ca0b1bf45b272] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<regex::ReNode * (*) ( Context * __context__, char * const   ),&re_parse_3d6f9a305b851160>>();
+	};
+	// visit_top_down_ac4526f0a41e9d37
+	aotLib[0x9f6415e6b4b8a2f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * , Block DAS_COMMENT((void,regex::ReNode *)) const  &  ),&visit_top_down_ac4526f0a41e9d37>>();
+	};
+	// re_assign_next_1e223575dac53267
+	aotLib[0xaace75c377fbafe4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::Regex &  ),&re_assign_next_1e223575dac53267>>();
+	};
+	// re_assign_groups_929e731066f7c1e9
+	aotLib[0xee3b6fdc0afacdbe] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::Regex &  ),&re_assign_groups_929e731066f7c1e9>>();
+	};
+	// re_assign_match_functions_98136952e5810501
+	aotLib[0xfe8702c8e1f95b6b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::Regex &  ),&re_assign_match_functions_98136952e5810501>>();
+	};
+	// re_match2_single_char_719b92c7ae28adab
+	aotLib[0x5d0e12a05650cc45] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, regex::Regex & , regex::ReNode * , uint8_t * const   ),&re_match2_single_char_719b92c7ae28adab>>();
+	};
+	// re_match2_char_3fc4bfa2fc1fedb5
+	aotLib[0x8b0671c4e3e46a9d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, regex::Regex & , regex::ReNode * , uint8_t * const   ),&re_match2_char_3fc4bfa2fc1fedb5>>();
+	};
+	// re_match2_union_50b558c71c5a33b
+	aotLib[0x208c8c4b0289f1f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, regex::Regex & , regex::ReNode * , uint8_t * const   ),&re_match2_union_50b558c71c5a33b>>();
+	};
+	// re_match2_set_5ff68104be60aa42
+	aotLib[0x117d775f450f37fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, regex::Regex & , regex::ReNode * , uint8_t * const   ),&re_match2_set_5ff68104be60aa42>>();
+	};
+	// re_match2_any_2a47370c24660aa5
+	aotLib[0xe89a46b14f6f298d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, regex::Regex & , regex::ReNode * , uint8_t * const   ),&re_match2_any_2a47370c24660aa5>>();
+	};
+	// re_match2_concat_f320791e8feb9017
+	aotLib[0x8de6f134c9acc7c1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, regex::Regex & , regex::ReNode * , uint8_t * const   ),&re_match2_concat_f320791e8feb9017>>();
+	};
+	// re_match2_eos_3c1a8603d243a154
+	aotLib[0xc695133d9e287261] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, regex::Regex & , regex::ReNode * , uint8_t * const   ),&re_match2_eos_3c1a8603d243a154>>();
+	};
+	// re_match2_question_fbce93a964c27959
+	aotLib[0x4343fdac2596efd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, regex::Regex & , regex::ReNode * , uint8_t * const   ),&re_match2_question_fbce93a964c27959>>();
+	};
+	// re_match2_plus_f4ed81922769b54d
+	aotLib[0x2f1649c958beba31] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, regex::Regex & , regex::ReNode * , uint8_t * const   ),&re_match2_plus_f4ed81922769b54d>>();
+	};
+	// re_match2_plus_set_f34b624c2a935b9
+	aotLib[0x3c0d71a6f1ec9cdd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, regex::Regex & , regex::ReNode * , uint8_t * const   ),&re_match2_plus_set_f34b624c2a935b9>>();
+	};
+	// re_match2_star_533ab88bf27eabb3
+	aotLib[0x1906e2e35a0aabf5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, regex::Regex & , regex::ReNode * , uint8_t * const   ),&re_match2_star_533ab88bf27eabb3>>();
+	};
+	// re_match2_group_1b52c8cbe220eede
+	aotLib[0xa358d6440b83c8e9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, regex::Regex & , regex::ReNode * , uint8_t * const   ),&re_match2_group_1b52c8cbe220eede>>();
+	};
+	// re_early_out_7af43e1fb0ced133
+	aotLib[0x54b205eeccb9c7d9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TDim<uint32_t,8> & , regex::ReNode * const   ),&re_early_out_7af43e1fb0ced133>>();
+	};
+	// is_valid_f341200a6f682e5a
+	aotLib[0xb251f5a94789ee91] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, regex::Regex &  ),&is_valid_f341200a6f682e5a>>();
+	};
+	// regex_compile_49466229404ec92e
+	aotLib[0x9ec8a2d407da7562] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, regex::Regex & , char * const   ),&regex_compile_49466229404ec92e>>();
+	};
+	// regex_compile_3ab3aff652051470
+	aotLib[0x63be5d611c309108] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<regex::Regex (*) ( Context * __context__, char * const   ),&regex_compile_3ab3aff652051470>>();
+	};
+	// regex_compile_34958ec809c4585e
+	aotLib[0x4f8318af03b00c56] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<regex::Regex (*) ( Context * __context__, regex::Regex &  ),&regex_compile_34958ec809c4585e>>();
+	};
+	// regex_match_270cb942810fc6f1
+	aotLib[0xba1fdb755e116dc5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, regex::Regex & , char * const  , int32_t  ),&regex_match_270cb942810fc6f1>>();
+	};
+	// regex_group_1f825e4ecddcb4c9
+	aotLib[0x2bf3457e81b9979d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, regex::Regex const  & , int32_t , char * const   ),&regex_group_1f825e4ecddcb4c9>>();
+	};
+	// regex_foreach_15997c561ebb2761
+	aotLib[0x956827746605ce85] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::Regex & , char * const  , Block DAS_COMMENT((bool,range)) const  &  ),&regex_foreach_15997c561ebb2761>>();
+	};
+	// regex_debug_ceb0bfb647144f34
+	aotLib[0xaf7bd7861a7621c1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::Regex const  &  ),&regex_debug_ceb0bfb647144f34>>();
+	};
+	// debug_set_31f032942f694fa4
+	aotLib[0xa288dfa369c21525] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,8> const  &  ),&debug_set_31f032942f694fa4>>();
+	};
+	// debug_re_57e80c63d554e31c
+	aotLib[0x6a2dcd62bf200f65] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * const  , int32_t  ),&debug_re_57e80c63d554e31c>>();
+	};
+	// [[ init script ]]
+	aotLib[0x379eb5d3fce250d9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
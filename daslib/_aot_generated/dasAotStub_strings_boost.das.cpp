@@ -0,0 +1,169 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require strings_boost
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_5172167967587827064 {
+
+extern TypeInfo __type_info__6f902bb202c1ac85;
+extern TypeInfo __type_info__af63ee4c86020b22;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern VarInfo __var_info__e989483f695bcee9;
+extern FuncInfo __func_info__7fac1bd753cba6aa;
+
+VarInfo __func_info__7fac1bd753cba6aa_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63ee4c86020b22, nullptr, nullptr, nullptr, 0, 0, nullptr, 57442, 24, 0xe989483f695bcee9ul, "arr", 0 };
+VarInfo * __func_info__7fac1bd753cba6aa_fields[1] =  { &__func_info__7fac1bd753cba6aa_field_0 };
+FuncInfo __func_info__7fac1bd753cba6aa = {"invoke block<(arr:array<string> const#):void> const", "", __func_info__7fac1bd753cba6aa_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,0x7fac1bd753cba6aaul, 0x0 };
+TypeInfo __type_info__6f902bb202c1ac85 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63ee4c86020b22, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 24, 0x6f902bb202c1ac85ul };
+TypeInfo __type_info__af63ee4c86020b22 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, 0xaf63ee4c86020b22ul };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, 0xaf63eb4c86020609ul };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__6f902bb202c1ac85 };
+
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60_clone_c4443fdeccc198b5 ( Context * __context__, TArray<char *> & __a_rename_at_254, TArray<char *> const  & __b_rename_at_254 );
+inline TArray<char *> & _Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465 ( Context * __context__, TArray<char *> & __a_rename_at_42 );
+inline char * wide_7a9ae837ebe3972c ( Context * __context__, char * const  __text_rename_at_9, int32_t __width_rename_at_9 );
+inline TArray<char *> split_dc2af8484b2bf903 ( Context * __context__, char * const  __text_rename_at_38, char * const  __delim_rename_at_38 );
+inline TArray<char *> split_by_chars_c9b83bbaa7051a4e ( Context * __context__, char * const  __text_rename_at_47, char * const  __delim_rename_at_47 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<char *>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_clone_c4443fdeccc198b5 ( Context * __context__, TArray<char *> &  __a_rename_at_254, TArray<char *> const  &  __b_rename_at_254 )
+{
+	_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7(__context__,das_arg<TArray<char *>>::pass(__a_rename_at_254),builtin_array_size(__b_rename_at_254));
+	{
+		uint64_t __loop_count_256 = UINT64_MAX;
+		// aV : string aka TT&
+		das_iterator<TArray<char *>> __aV_iterator(__a_rename_at_254);
+		char * * __aV_rename_at_256;
+		__loop_count_256 = das_loop_count(__loop_count_256,__aV_iterator.loop_begin(__context__,(__aV_rename_at_256)));
+		// bV : string const&#
+		das_iterator<TArray<char *> const > __bV_iterator(__b_rename_at_254);
+		char * const  * __bV_rename_at_256;
+		__loop_count_256 = das_loop_count(__loop_count_256,__bV_iterator.loop_begin(__context__,(__bV_rename_at_256)));
+		for ( ; __loop_count_256 ; --__loop_count_256, ++__aV_rename_at_256, ++__bV_rename_at_256 )
+		{
+			das_copy((*__aV_rename_at_256),((char *)(builtin_string_clone((*__bV_rename_at_256),__context__))));
+		}
+		__aV_iterator.loop_end(__context__,(__aV_rename_at_256));
+		__bV_iterator.loop_end(__context__,(__bV_rename_at_256));
+	};
+}
+
+inline TArray<char *> & _Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465 ( Context * __context__, TArray<char *> &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<TArray<char *> &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<TArray<char *> &>::cast(__a_rename_at_42);
+}
+
+inline char * wide_7a9ae837ebe3972c ( Context * __context__, char * const  __text_rename_at_9, int32_t __width_rename_at_9 )
+{
+	int32_t __extra_rename_at_10 = ((int32_t)(__width_rename_at_9 - builtin_string_length(__text_rename_at_9,__context__)));
+	return das_auto_cast<char *>::cast((__extra_rename_at_10 > 0) ? das_auto_cast<char *>::cast((cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from(__text_rename_at_9),cast<char *>::from(((char *)(string_repeat(((char *) " "),__extra_rename_at_10,__context__)))),*__context__,nullptr)))) : das_auto_cast<char *>::cast(__text_rename_at_9));
+}
+
+inline TArray<char *> split_dc2af8484b2bf903 ( Context * __context__, char * const  __text_rename_at_38, char * const  __delim_rename_at_38 ) { das_stack_prologue __prologue(__context__,128,"split " DAS_FILE_LINE);
+{
+	TArray<char *> __res_rename_at_39; das_zero(__res_rename_at_39);
+	builtin_string_split(__text_rename_at_38,__delim_rename_at_38,das_make_block<void,TArray<char *> const  &>(__context__,112,0,&__func_info__7fac1bd753cba6aa,[&](TArray<char *> const  & __arr_rename_at_40)->void{
+		_Funcbuiltin_0x60_clone_c4443fdeccc198b5(__context__,das_arg<TArray<char *>>::pass(__res_rename_at_39),__arr_rename_at_40);
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	return /* <- */ das_auto_cast_move<TArray<char *>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465(__context__,das_arg<TArray<char *>>::pass(__res_rename_at_39)));
+}}
+
+inline TArray<char *> split_by_chars_c9b83bbaa7051a4e ( Context * __context__, char * const  __text_rename_at_47, char * const  __delim_rename_at_47 ) { das_stack_prologue __prologue(__context__,128,"split_by_chars " DAS_FILE_LINE);
+{
+	TArray<char *> __res_rename_at_48; das_zero(__res_rename_at_48);
+	builtin_string_split_by_char(__text_rename_at_47,__delim_rename_at_47,das_make_block<void,TArray<char *> const  &>(__context__,112,0,&__func_info__7fac1bd753cba6aa,[&](TArray<char *> const  & __arr_rename_at_49)->void{
+		_Funcbuiltin_0x60_clone_c4443fdeccc198b5(__context__,das_arg<TArray<char *>>::pass(__res_rename_at_48),__arr_rename_at_49);
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	return /* <- */ das_auto_cast_move<TArray<char *>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465(__context__,das_arg<TArray<char *>>::pass(__res_rename_at_48)));
+}}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7
+	aotLib[0xdd4771637ebae089] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t  ),&_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7>>();
+	};
+	// _Funcbuiltin_0x60_clone_c4443fdeccc198b5
+	aotLib[0x3d1ffddebc32e5ef] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , TArray<char *> const  &  ),&_Funcbuiltin_0x60_clone_c4443fdeccc198b5>>();
+	};
+	// _Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465
+	aotLib[0xed99ea3c3e04d451] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TArray<char *> & (*) ( Context * __context__, TArray<char *> &  ),&_Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465>>();
+	};
+	// wide_7a9ae837ebe3972c
+	aotLib[0x33fa7781fa6e76e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, char * const  , int32_t  ),&wide_7a9ae837ebe3972c>>();
+	};
+	// split_dc2af8484b2bf903
+	aotLib[0xa038c2e59aa41cd9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, char * const  , char * const   ),&split_dc2af8484b2bf903>>();
+	};
+	// split_by_chars_c9b83bbaa7051a4e
+	aotLib[0x8e2a9fa4dd8589a9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, char * const  , char * const   ),&split_by_chars_c9b83bbaa7051a4e>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
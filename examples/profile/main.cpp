@@ -1,5 +1,6 @@
 #include "daScript/daScript.h"
 #include "daScript/simulate/fs_file_info.h"
+#include "daScript/simulate/runtime_profile.h"
 #include "daScript/misc/sysos.h"
 
 #ifdef _MSC_VER
@@ -27,10 +28,62 @@ struct typeName<ObjectArray> {
 
 TextPrinter tout;
 
-bool unit_test ( const string & fn, bool useAOT ) {
+enum class BenchMode {
+    interpreter,
+    noFusion,
+    aot
+};
+
+const char * benchModeName ( BenchMode mode ) {
+    switch ( mode ) {
+    case BenchMode::interpreter:    return "interpreter";
+    case BenchMode::noFusion:       return "nofusion";
+    case BenchMode::aot:            return "aot";
+    }
+    return "";
+}
+
+struct BenchRecord {
+    string      test;
+    string      mode;
+    string      category;
+    int32_t     count = 0;
+    double      minT = 0.;
+    double      medianT = 0.;
+    double      p99T = 0.;
+    uint64_t    heapBytes = 0;
+    uint64_t    stringBytes = 0;
+    int64_t     counters[int(PerfCounter::total)] = { -1, -1, -1, -1, -1 };   // per run, -1 if not available
+};
+
+// collects results of every profile(...) call in the test, which is currently running
+class BenchCollector : public ProfileCollector {
+public:
+    virtual void onProfile ( Context *, const ProfileResult & res ) override {
+        BenchRecord rec;
+        rec.test = test;
+        rec.mode = mode;
+        rec.category = res.category ? res.category : "";
+        rec.count = res.count;
+        rec.minT = res.minT;
+        rec.medianT = res.medianT;
+        rec.p99T = res.p99T;
+        rec.heapBytes = res.heapBytes;
+        rec.stringBytes = res.stringBytes;
+        for ( int i = 0; i != int(PerfCounter::total); ++i ) {
+            rec.counters[i] = res.countersAvailable[i] ? int64_t(res.counters[i]) : -1;
+        }
+        records.push_back(rec);
+    }
+    string              test;
+    string              mode;
+    vector<BenchRecord> records;
+};
+
+bool unit_test ( const string & fn, BenchMode mode ) {
     // make sure there is no stack
     CodeOfPolicies policies;
-    policies.aot = useAOT;
+    policies.aot = mode==BenchMode::aot;
     policies.stack = 0;
     auto access = make_smart<FsFileAccess>();
     ModuleGroup dummyGroup;
@@ -42,6 +95,10 @@ bool unit_test ( const string & fn, bool useAOT ) {
             }
             return false;
         } else {
+            if ( mode==BenchMode::noFusion ) {
+                // first option wins, so this overrides whatever script specifies
+                program->options.insert(program->options.begin(), AnnotationArgument("fusion",false));
+            }
             // tout << *program << "\n";
             Context ctx(program->getContextStackSize());
             if ( !program->simulate(ctx, tout) ) {
@@ -87,7 +144,11 @@ bool unit_test ( const string & fn, bool useAOT ) {
     }
 }
 
-bool run_tests( const string & path, bool (*test_fn)(const string &, bool aot), bool useAot ) {
+bool unit_test ( const string & fn, bool useAOT ) {
+    return unit_test(fn, useAOT ? BenchMode::aot : BenchMode::interpreter);
+}
+
+vector<string> list_tests ( const string & path ) {
     vector<string> files;
 #ifdef _MSC_VER
     _finddata_t c_file;
@@ -113,18 +174,201 @@ bool run_tests( const string & path, bool (*test_fn)(const string &, bool aot),
     }
 #endif
     sort(files.begin(),files.end());
+    return files;
+}
+
+bool run_tests( const string & path, bool (*test_fn)(const string &, bool aot), bool useAot ) {
     bool ok = true;
-    for ( auto & fn : files ) {
+    for ( auto & fn : list_tests(path) ) {
         ok = test_fn(fn,useAot) && ok;
     }
     return ok;
 }
 
+string json_escape ( const string & str ) {
+    string res;
+    for ( auto ch : str ) {
+        if ( ch=='"' || ch=='\\' ) res += '\\';
+        res += ch;
+    }
+    return res;
+}
+
+string bench_to_json ( const vector<BenchRecord> & records ) {
+    TextWriter tw;
+    tw << "[\n";
+    for ( size_t i=0; i!=records.size(); ++i ) {
+        auto & r = records[i];
+        tw << "\t{\"test\":\"" << json_escape(r.test) << "\", \"mode\":\"" << r.mode
+            << "\", \"category\":\"" << json_escape(r.category) << "\", \"count\":" << r.count
+            << ", \"min\":" << r.minT << ", \"median\":" << r.medianT << ", \"p99\":" << r.p99T
+            << ", \"heap_bytes\":" << r.heapBytes << ", \"string_bytes\":" << r.stringBytes;
+        for ( int c = 0; c != int(PerfCounter::total); ++c ) {
+            if ( r.counters[c] != -1 ) tw << ", \"" << PerfCounters::name(PerfCounter(c)) << "\":" << r.counters[c];
+        }
+        tw << "}" << (i+1!=records.size() ? ",\n" : "\n");
+    }
+    tw << "]\n";
+    return tw.str();
+}
+
+// reads back what bench_to_json writes: array of flat objects with string and number values
+bool bench_from_json ( const string & text, vector<BenchRecord> & records ) {
+    const char * ch = text.c_str();
+    auto skip = [&]() { while ( *ch && isspace((unsigned char)*ch) ) ch++; };
+    auto expect = [&]( char c ) { skip(); if ( *ch!=c ) return false; ch++; return true; };
+    auto readString = [&]( string & res ) {
+        if ( !expect('"') ) return false;
+        res.clear();
+        while ( *ch && *ch!='"' ) {
+            if ( *ch=='\\' && ch[1] ) ch++;
+            res += *ch++;
+        }
+        return expect('"');
+    };
+    if ( !expect('[') ) return false;
+    skip();
+    if ( *ch==']' ) return true;
+    for ( ;; ) {
+        if ( !expect('{') ) return false;
+        BenchRecord rec;
+        for ( ;; ) {
+            string key, svalue;
+            double nvalue = 0.;
+            if ( !readString(key) || !expect(':') ) return false;
+            skip();
+            if ( *ch=='"' ) {
+                if ( !readString(svalue) ) return false;
+            } else {
+                char * end = nullptr;
+                nvalue = strtod(ch, &end);
+                if ( end==ch ) return false;
+                ch = end;
+            }
+            if ( key=="test" ) rec.test = svalue;
+            else if ( key=="mode" ) rec.mode = svalue;
+            else if ( key=="category" ) rec.category = svalue;
+            else if ( key=="count" ) rec.count = int32_t(nvalue);
+            else if ( key=="min" ) rec.minT = nvalue;
+            else if ( key=="median" ) rec.medianT = nvalue;
+            else if ( key=="p99" ) rec.p99T = nvalue;
+            else if ( key=="heap_bytes" ) rec.heapBytes = uint64_t(nvalue);
+            else if ( key=="string_bytes" ) rec.stringBytes = uint64_t(nvalue);
+            else {
+                for ( int c = 0; c != int(PerfCounter::total); ++c ) {
+                    if ( key==PerfCounters::name(PerfCounter(c)) ) rec.counters[c] = int64_t(nvalue);
+                }
+            }
+            skip();
+            if ( *ch==',' ) { ch++; continue; }
+            if ( !expect('}') ) return false;
+            break;
+        }
+        records.push_back(rec);
+        skip();
+        if ( *ch==',' ) { ch++; continue; }
+        return expect(']');
+    }
+}
+
+bool read_text_file ( const string & fname, string & text ) {
+    FILE * f = fopen(fname.c_str(), "rb");
+    if ( !f ) return false;
+    char buf[4096];
+    size_t n;
+    while ( (n = fread(buf, 1, sizeof(buf), f)) > 0 ) {
+        text.append(buf, n);
+    }
+    fclose(f);
+    return true;
+}
+
+bool write_text_file ( const string & fname, const string & text ) {
+    FILE * f = fopen(fname.c_str(), "wb");
+    if ( !f ) return false;
+    fwrite(text.c_str(), 1, text.length(), f);
+    fclose(f);
+    return true;
+}
+
+// compares min time of every record with the baseline, returns number of regressions
+int compare_bench ( const vector<BenchRecord> & baseline, const vector<BenchRecord> & records, double threshold ) {
+    int regressions = 0;
+    for ( auto & r : records ) {
+        auto it = find_if(baseline.begin(), baseline.end(), [&](const BenchRecord & b) {
+            return b.test==r.test && b.mode==r.mode && b.category==r.category;
+        });
+        if ( it==baseline.end() ) {
+            tout << "NEW        " << r.test << " [" << r.mode << "] " << r.category << " " << r.minT << "\n";
+            continue;
+        }
+        double ratio = it->minT > 0. ? r.minT / it->minT : 1.;
+        const char * verdict = "ok        ";
+        if ( ratio > 1. + threshold ) {
+            verdict = "REGRESSION";
+            regressions ++;
+        } else if ( ratio < 1. - threshold ) {
+            verdict = "faster    ";
+        }
+        tout << verdict << " " << r.test << " [" << r.mode << "] " << r.category
+            << " " << it->minT << " -> " << r.minT << " (" << int((ratio-1.)*100.) << "%)\n";
+    }
+    return regressions;
+}
+
+int run_bench ( const vector<string> & files, const vector<BenchMode> & modes,
+        const string & jsonFile, const string & baselineFile, double threshold ) {
+    BenchCollector collector;
+    auto prevCollector = setProfileCollector(&collector);
+    bool ok = true;
+    for ( auto mode : modes ) {
+        collector.mode = benchModeName(mode);
+        tout << "\n" << collector.mode << ":\n";
+        for ( auto & fn : files ) {
+            auto slash = fn.find_last_of("\\/");
+            collector.test = slash==string::npos ? fn : fn.substr(slash+1);
+            ok = unit_test(fn, mode) && ok;
+        }
+    }
+    setProfileCollector(prevCollector);
+    if ( !jsonFile.empty() ) {
+        if ( !write_text_file(jsonFile, bench_to_json(collector.records)) ) {
+            tout << "can't write " << jsonFile << "\n";
+            return -1;
+        }
+    }
+    if ( !baselineFile.empty() ) {
+        string text;
+        vector<BenchRecord> baseline;
+        if ( !read_text_file(baselineFile, text) || !bench_from_json(text, baseline) ) {
+            tout << "can't read baseline " << baselineFile << "\n";
+            return -1;
+        }
+        tout << "\ncomparing with " << baselineFile << ", threshold " << int(threshold*100.) << "%\n";
+        int regressions = compare_bench(baseline, collector.records, threshold);
+        if ( regressions ) {
+            tout << regressions << " regression(s)\n";
+            return 1;
+        }
+    }
+    return ok ? 0 : -1;
+}
+
+void print_help () {
+    tout << "daScriptProfile [pathToDasRoot]\n"
+        << "daScriptProfile [-json out.json] [-baseline base.json] [-threshold percent] [-mode interpreter|nofusion|aot] [test.das ...]\n"
+        << "    -json       write results of every profile(...) call as JSON\n"
+        << "    -baseline   compare with previously written JSON, exit code 1 on regression\n"
+        << "    -threshold  allowed slowdown of the min time, in percent (default 10)\n"
+        << "    -mode       run only specified mode, can be repeated (default is all modes)\n";
+}
+
 int main( int argc, char * argv[] ) {
-    if ( argc>2 ) {
-        tout << "daScriptTest [pathToDasRoot]\n";
+    bool benchMode = argc>1 && argv[1][0]=='-';
+    if ( argc>2 && !benchMode ) {
+        print_help();
         return -1;
-    }  else if ( argc==2 ) {
+    }  else if ( argc==2 && !benchMode ) {
         setDasRoot(argv[1]);
     }
     setCommandLineArguments(argc,argv);
@@ -144,6 +388,38 @@ int main( int argc, char * argv[] ) {
     Module::Shutdown();
     return 0;
 #endif
+    if ( benchMode ) {
+        string jsonFile, baselineFile;
+        double threshold = 0.1;
+        vector<BenchMode> modes;
+        vector<string> files;
+        for ( int i=1; i!=argc; ++i ) {
+            string arg = argv[i];
+            if ( arg=="-json" && i+1<argc ) {
+                jsonFile = argv[++i];
+            } else if ( arg=="-baseline" && i+1<argc ) {
+                baselineFile = argv[++i];
+            } else if ( arg=="-threshold" && i+1<argc ) {
+                threshold = atof(argv[++i]) / 100.;
+            } else if ( arg=="-mode" && i+1<argc ) {
+                string m = argv[++i];
+                if ( m=="interpreter" ) modes.push_back(BenchMode::interpreter);
+                else if ( m=="nofusion" ) modes.push_back(BenchMode::noFusion);
+                else if ( m=="aot" ) modes.push_back(BenchMode::aot);
+                else { print_help(); return -1; }
+            } else if ( arg[0]=='-' ) {
+                print_help();
+                return -1;
+            } else {
+                files.push_back(arg);
+            }
+        }
+        if ( modes.empty() ) modes = { BenchMode::interpreter, BenchMode::noFusion, BenchMode::aot };
+        if ( files.empty() ) files = list_tests(getDasRoot() + "/examples/profile/tests");
+        int res = run_bench(files, modes, jsonFile, baselineFile, threshold);
+        Module::Shutdown();
+        return res;
+    }
     // run tests
     if (argc == 1) {
         tout << "\nINTERPRETED:\n";
@@ -658,6 +658,38 @@ ___noinline float testExpLoop(int count) {
     return ret;
 }
 
+___noinline void saxpy(float * __restrict y, const float * __restrict x, float a, int n) {
+    for (int i = 0; i != n; ++i) {
+        y[i] += a * x[i];
+    }
+}
+
+___noinline float testSaxpy(int count) {
+    das::vector<float> x(100000), y(100000);
+    for (int i = 0; i != 100000; ++i) {
+        x[i] = float(i);
+        y[i] = 1.0f;
+    }
+    for (int i = 0; i != count; ++i) {
+        saxpy(y.data(), x.data(), 0.5f, 100000);
+    }
+    return y[99999];
+}
+
+___noinline float testSumFloat4(int count) {
+    das::vector<das::float4> vel(25000);
+    for (int i = 0; i != 25000; ++i) {
+        vel[i] = das::float4(float(i), 1.0f, 2.0f, 3.0f);
+    }
+    vec4f sum = v_zero();
+    for (int i = 0; i != count; ++i) {
+        for (const auto & v : vel) {
+            sum = v_add(sum, v_ldu((const float *)&v));
+        }
+    }
+    return v_extract_x(sum);
+}
+
 #define pi 3.141592653589793f
 #define solar_mass (4 * pi * pi)
 #define days_per_year 365.24f
@@ -975,6 +1007,8 @@ public:
         addExtern<DAS_BIND_FUN(testParticlesI)>(*this, lib, "testParticlesI",SideEffects::modifyExternal,"testParticlesI");
         addExtern<DAS_BIND_FUN(testTryCatch)>(*this, lib, "testTryCatch",SideEffects::modifyExternal,"testTryCatch");
         addExtern<DAS_BIND_FUN(testExpLoop)>(*this, lib, "testExpLoop",SideEffects::modifyExternal,"testExpLoop");
+        addExtern<DAS_BIND_FUN(testSaxpy)>(*this, lib, "testSaxpy",SideEffects::modifyExternal,"testSaxpy");
+        addExtern<DAS_BIND_FUN(testSumFloat4)>(*this, lib, "testSumFloat4",SideEffects::modifyExternal,"testSumFloat4");
         addExtern<DAS_BIND_FUN(testNBodiesInit)>(*this, lib, "testNBodiesInit",SideEffects::modifyExternal,"testNBodiesInit");
         addExtern<DAS_BIND_FUN(testNBodies)>(*this, lib, "testNBodies",SideEffects::modifyExternal,"testNBodies");
         addExtern<DAS_BIND_FUN(testNBodiesS)>(*this, lib, "testNBodiesS",SideEffects::modifyExternal,"testNBodiesS");
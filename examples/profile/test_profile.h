@@ -33,6 +33,8 @@ int AddOne(int a);
 
 int testDict(das::Array & arr);
 float testExpLoop(int count);
+float testSaxpy(int count);
+float testSumFloat4(int count);
 int testFibR(int n);
 int testFibI(int n);
 void testNBodiesInit();
@@ -0,0 +1,532 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require testProfile
+#include "test_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_4485479894531223051 {
+
+extern TypeInfo __type_info__90f3d07b5a6ca13;
+extern TypeInfo __type_info__af63db4c8601ead9;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern VarInfo __var_info__24a4bd2549ea4f3;
+extern FuncInfo __func_info__2602ff4e80dc2f2b;
+extern FuncInfo __func_info__eeb3b74c98cb09c3;
+
+VarInfo __func_info__2602ff4e80dc2f2b_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~$::dasvector`int"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 24, 0x24a4bd2549ea4f3ul, "arr", 0 };
+VarInfo * __func_info__2602ff4e80dc2f2b_fields[1] =  { &__func_info__2602ff4e80dc2f2b_field_0 };
+FuncInfo __func_info__2602ff4e80dc2f2b = {"invoke block<(arr:$::dasvector`int const):void> const", "", __func_info__2602ff4e80dc2f2b_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,0x2602ff4e80dc2f2bul, 0x0 };
+FuncInfo __func_info__eeb3b74c98cb09c3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,0xeeb3b74c98cb09c3ul, 0x0 };
+TypeInfo __type_info__90f3d07b5a6ca13 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, 0x90f3d07b5a6ca13ul };
+TypeInfo __type_info__af63db4c8601ead9 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xaf63db4c8601ead9ul };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, 0xaf63eb4c86020609ul };
+
+TypeInfo * __tinfo_0[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__af63db4c8601ead9, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_1[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__af63db4c8601ead9, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_2[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__af63db4c8601ead9, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_3[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__af63db4c8601ead9, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_4[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__af63db4c8601ead9, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_5[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__af63db4c8601ead9, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_6[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__af63db4c8601ead9, &__type_info__90f3d07b5a6ca13 };
+namespace  { struct NObject; };
+namespace  {
+
+struct NObject {
+	float3 position;
+	float3 velocity;
+};
+static_assert(sizeof(NObject)==24,"structure size mismatch with DAS");
+static_assert(offsetof(NObject,position)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(NObject,velocity)==12,"structure field offset mismatch with DAS");
+}
+
+inline bool perks_disabler_unset_es_9afe6f7427db3ce2 ( Context * __context__, ObjectArray & __game_effect_dot_allowedMods_rename_at_6, ObjectArray & __allowedMods_rename_at_6 );
+inline void update_72a908a54031d882 ( Context * __context__, NObject & __a_rename_at_19 );
+inline void testSim_d57b6dfc3ec85f37 ( Context * __context__, TDim<NObject,10000> & __objects_rename_at_22 );
+inline void testSimI_9693240a1ba45f06 ( Context * __context__, TDim<NObject,10000> & __objects_rename_at_26 );
+inline void ks_update_f72fb25588a5bc93 ( Context * __context__, float3 & __pos_rename_at_31, float3 __vel_rename_at_31 );
+inline void update_2c3efcd012b89487 ( Context * __context__, Object & __a_rename_at_35 );
+inline void testSim_9c13b5f536150f41 ( Context * __context__, ObjectArray & __objects_rename_at_38 );
+inline void testSimI_5f4b06f7ab1ed004 ( Context * __context__, ObjectArray & __objects_rename_at_42 );
+inline void testInterop_89f99ec31017686d ( Context * __context__, ObjectArray & __objects_rename_at_46 );
+inline void initObj_5f38f1de1877930b ( Context * __context__, int32_t __i_rename_at_50, Object & __a_rename_at_50 );
+inline void initObj_576a6061f608005a ( Context * __context__, int32_t __i_rename_at_54, NObject & __a_rename_at_54 );
+inline void init_63f9fef262132206 ( Context * __context__, ObjectArray & __objects_rename_at_58 );
+inline void init_9b5e71d825369cdb ( Context * __context__, TDim<NObject,10000> & __objects_rename_at_64 );
+inline void verifyManagedInt_4a41078172b557b7 ( Context * __context__ );
+inline bool test_b611289a48664e4f ( Context * __context__, ObjectArray & __objects_rename_at_97 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global_zero<TDim<NObject,10000>,0x916781b09563e1d6>(__context__);/*nobjects*/
+}
+
+inline bool perks_disabler_unset_es_9afe6f7427db3ce2 ( Context * __context__, ObjectArray &  __game_effect_dot_allowedMods_rename_at_6, ObjectArray &  __allowedMods_rename_at_6 )
+{
+	{
+		bool __need_loop_7 = true;
+		// perk : testProfile::Object&
+		das_iterator<ObjectArray> __perk_iterator(__game_effect_dot_allowedMods_rename_at_6);
+		Object * __perk_rename_at_7;
+		__need_loop_7 = __perk_iterator.first(__context__,(__perk_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __perk_iterator.next(__context__,(__perk_rename_at_7)) )
+		{
+			{
+				uint64_t __loop_count_8 = UINT64_MAX;
+				// i : int const
+				das_iterator<range> __i_iterator(mk_range(__allowedMods_rename_at_6.size() /*length*/));
+				int32_t __i_rename_at_8;
+				__loop_count_8 = das_loop_count(__loop_count_8,__i_iterator.loop_begin(__context__,(__i_rename_at_8)));
+				for ( ; __loop_count_8 ; --__loop_count_8, ++__i_rename_at_8 )
+				{
+					if ( SimPolicy<Object>::Equ(cast<Object*>::from(&(das_index<ObjectArray>::at(__allowedMods_rename_at_6,__i_rename_at_8,__context__))),cast<Object *>::from(&((*__perk_rename_at_7))),*__context__,nullptr) )
+					{
+						return das_auto_cast<bool>::cast(true);
+					};
+				}
+				__i_iterator.loop_end(__context__,(__i_rename_at_8));
+			};
+		}
+		__perk_iterator.close(__context__,(__perk_rename_at_7));
+	};
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void update_72a908a54031d882 ( Context * __context__, NObject &  __a_rename_at_19 )
+{
+	SimPolicy<float3>::SetAdd((char *)&(__a_rename_at_19.position),__a_rename_at_19.velocity,*__context__,nullptr);
+}
+
+inline void testSim_d57b6dfc3ec85f37 ( Context * __context__, TDim<NObject,10000> &  __objects_rename_at_22 )
+{
+	{
+		uint64_t __loop_count_23 = UINT64_MAX;
+		// obj : NObject& -const
+		das_iterator<TDim<NObject,10000>> __obj_iterator(__objects_rename_at_22);
+		NObject * __obj_rename_at_23;
+		__loop_count_23 = das_loop_count(__loop_count_23,__obj_iterator.loop_begin(__context__,(__obj_rename_at_23)));
+		for ( ; __loop_count_23 ; --__loop_count_23, ++__obj_rename_at_23 )
+		{
+			update_72a908a54031d882(__context__,das_arg<NObject>::pass((*__obj_rename_at_23)));
+		}
+		__obj_iterator.loop_end(__context__,(__obj_rename_at_23));
+	};
+}
+
+inline void testSimI_9693240a1ba45f06 ( Context * __context__, TDim<NObject,10000> &  __objects_rename_at_26 )
+{
+	{
+		uint64_t __loop_count_27 = UINT64_MAX;
+		// obj : NObject& -const
+		das_iterator<TDim<NObject,10000>> __obj_iterator(__objects_rename_at_26);
+		NObject * __obj_rename_at_27;
+		__loop_count_27 = das_loop_count(__loop_count_27,__obj_iterator.loop_begin(__context__,(__obj_rename_at_27)));
+		for ( ; __loop_count_27 ; --__loop_count_27, ++__obj_rename_at_27 )
+		{
+			SimPolicy<float3>::SetAdd((char *)&((*__obj_rename_at_27).position),(*__obj_rename_at_27).velocity,*__context__,nullptr);
+		}
+		__obj_iterator.loop_end(__context__,(__obj_rename_at_27));
+	};
+}
+
+inline void ks_update_f72fb25588a5bc93 ( Context * __context__, float3 & __pos_rename_at_31, float3 __vel_rename_at_31 )
+{
+	SimPolicy<float3>::SetAdd((char *)&(__pos_rename_at_31),__vel_rename_at_31,*__context__,nullptr);
+}
+
+inline void update_2c3efcd012b89487 ( Context * __context__, Object &  __a_rename_at_35 )
+{
+	SimPolicy<float3>::SetAdd((char *)&(__a_rename_at_35.pos /*position*/),__a_rename_at_35.vel /*velocity*/,*__context__,nullptr);
+}
+
+inline void testSim_9c13b5f536150f41 ( Context * __context__, ObjectArray &  __objects_rename_at_38 )
+{
+	{
+		bool __need_loop_39 = true;
+		// obj : testProfile::Object&
+		das_iterator<ObjectArray> __obj_iterator(__objects_rename_at_38);
+		Object * __obj_rename_at_39;
+		__need_loop_39 = __obj_iterator.first(__context__,(__obj_rename_at_39)) && __need_loop_39;
+		for ( ; __need_loop_39 ; __need_loop_39 = __obj_iterator.next(__context__,(__obj_rename_at_39)) )
+		{
+			update_2c3efcd012b89487(__context__,das_arg<Object>::pass((*__obj_rename_at_39)));
+		}
+		__obj_iterator.close(__context__,(__obj_rename_at_39));
+	};
+}
+
+inline void testSimI_5f4b06f7ab1ed004 ( Context * __context__, ObjectArray &  __objects_rename_at_42 )
+{
+	{
+		bool __need_loop_43 = true;
+		// obj : testProfile::Object&
+		das_iterator<ObjectArray> __obj_iterator(__objects_rename_at_42);
+		Object * __obj_rename_at_43;
+		__need_loop_43 = __obj_iterator.first(__context__,(__obj_rename_at_43)) && __need_loop_43;
+		for ( ; __need_loop_43 ; __need_loop_43 = __obj_iterator.next(__context__,(__obj_rename_at_43)) )
+		{
+			SimPolicy<float3>::SetAdd((char *)&((*__obj_rename_at_43).pos /*position*/),(*__obj_rename_at_43).vel /*velocity*/,*__context__,nullptr);
+		}
+		__obj_iterator.close(__context__,(__obj_rename_at_43));
+	};
+}
+
+inline void testInterop_89f99ec31017686d ( Context * __context__, ObjectArray &  __objects_rename_at_46 )
+{
+	{
+		bool __need_loop_47 = true;
+		// obj : testProfile::Object&
+		das_iterator<ObjectArray> __obj_iterator(__objects_rename_at_46);
+		Object * __obj_rename_at_47;
+		__need_loop_47 = __obj_iterator.first(__context__,(__obj_rename_at_47)) && __need_loop_47;
+		for ( ; __need_loop_47 ; __need_loop_47 = __obj_iterator.next(__context__,(__obj_rename_at_47)) )
+		{
+			updateObject(das_arg<Object>::pass((*__obj_rename_at_47)));
+		}
+		__obj_iterator.close(__context__,(__obj_rename_at_47));
+	};
+}
+
+inline void initObj_5f38f1de1877930b ( Context * __context__, int32_t __i_rename_at_50, Object &  __a_rename_at_50 )
+{
+	das_copy(__a_rename_at_50.pos /*position*/,float3(__i_rename_at_50++,__i_rename_at_50 + 1,__i_rename_at_50 + 2));
+	das_copy(__a_rename_at_50.vel /*velocity*/,v_make_vec4f(1.f,2.f,3.f,0.f));
+}
+
+inline void initObj_576a6061f608005a ( Context * __context__, int32_t __i_rename_at_54, NObject &  __a_rename_at_54 )
+{
+	das_copy(__a_rename_at_54.position,float3(__i_rename_at_54++,__i_rename_at_54 + 1,__i_rename_at_54 + 2));
+	das_copy(__a_rename_at_54.velocity,v_make_vec4f(1.f,2.f,3.f,0.f));
+}
+
+inline void init_63f9fef262132206 ( Context * __context__, ObjectArray &  __objects_rename_at_58 )
+{
+	int32_t __index_rename_at_59 = 0;
+	{
+		bool __need_loop_60 = true;
+		// obj : testProfile::Object&
+		das_iterator<ObjectArray> __obj_iterator(__objects_rename_at_58);
+		Object * __obj_rename_at_60;
+		__need_loop_60 = __obj_iterator.first(__context__,(__obj_rename_at_60)) && __need_loop_60;
+		for ( ; __need_loop_60 ; __need_loop_60 = __obj_iterator.next(__context__,(__obj_rename_at_60)) )
+		{
+			initObj_5f38f1de1877930b(__context__,__index_rename_at_59++,das_arg<Object>::pass((*__obj_rename_at_60)));
+		}
+		__obj_iterator.close(__context__,(__obj_rename_at_60));
+	};
+	DAS_ASSERT((__index_rename_at_59 == __objects_rename_at_58.size() /*length*/));
+}
+
+inline void init_9b5e71d825369cdb ( Context * __context__, TDim<NObject,10000> &  __objects_rename_at_64 )
+{
+	int32_t __index_rename_at_65 = 0;
+	{
+		uint64_t __loop_count_66 = UINT64_MAX;
+		// obj : NObject& -const
+		das_iterator<TDim<NObject,10000>> __obj_iterator(__objects_rename_at_64);
+		NObject * __obj_rename_at_66;
+		__loop_count_66 = das_loop_count(__loop_count_66,__obj_iterator.loop_begin(__context__,(__obj_rename_at_66)));
+		for ( ; __loop_count_66 ; --__loop_count_66, ++__obj_rename_at_66 )
+		{
+			initObj_576a6061f608005a(__context__,__index_rename_at_65++,das_arg<NObject>::pass((*__obj_rename_at_66)));
+		}
+		__obj_iterator.loop_end(__context__,(__obj_rename_at_66));
+	};
+	DAS_ASSERT((__index_rename_at_65 == 10000));
+}
+
+inline void verifyManagedInt_4a41078172b557b7 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,144,"verifyManagedInt " DAS_FILE_LINE);
+{
+	testManagedInt(das_make_block<void,das::vector<int32_t> const  &>(__context__,80,0,&__func_info__2602ff4e80dc2f2b,[&](das::vector<int32_t> const  & __arr_rename_at_89)->void{
+		DAS_ASSERT((__arr_rename_at_89.size() /*length*/ == 10));
+		{
+			uint64_t __loop_count_91 = UINT64_MAX;
+			// x : int const
+			das_iterator<range> __x_iterator(range(0,10));
+			int32_t __x_rename_at_91;
+			__loop_count_91 = das_loop_count(__loop_count_91,__x_iterator.loop_begin(__context__,(__x_rename_at_91)));
+			for ( ; __loop_count_91 ; --__loop_count_91, ++__x_rename_at_91 )
+			{
+				DAS_ASSERT((das_index<das::vector<int32_t> const >::at(__arr_rename_at_89,__x_rename_at_91,__context__) == __x_rename_at_91));
+			}
+			__x_iterator.loop_end(__context__,(__x_rename_at_91));
+		};
+		{
+			bool __need_loop_93 = true;
+			// x : int const
+			das_iterator<range> __x_iterator(range(0,10));
+			int32_t __x_rename_at_93;
+			__need_loop_93 = __x_iterator.first(__context__,(__x_rename_at_93)) && __need_loop_93;
+			// y : int const&
+			das_iterator<das::vector<int32_t> const > __y_iterator(__arr_rename_at_89);
+			int32_t const  * __y_rename_at_93;
+			__need_loop_93 = __y_iterator.first(__context__,(__y_rename_at_93)) && __need_loop_93;
+			for ( ; __need_loop_93 ; __need_loop_93 = __x_iterator.next(__context__,(__x_rename_at_93)) && __y_iterator.next(__context__,(__y_rename_at_93)) )
+			{
+				DAS_ASSERT((__x_rename_at_93 == (*__y_rename_at_93)));
+			}
+			__x_iterator.close(__context__,(__x_rename_at_93));
+			__y_iterator.close(__context__,(__y_rename_at_93));
+		};
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}}
+
+inline bool test_b611289a48664e4f ( Context * __context__, ObjectArray &  __objects_rename_at_97 ) { das_stack_prologue __prologue(__context__,672,"test " DAS_FILE_LINE);
+{
+	verifyManagedInt_4a41078172b557b7(__context__);
+	perks_disabler_unset_es_9afe6f7427db3ce2(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_97),das_arg<ObjectArray>::pass(__objects_rename_at_97));
+	init_9b5e71d825369cdb(__context__,das_arg<TDim<NObject,10000>>::pass(das_global<TDim<NObject,10000>,0x916781b09563e1d6>(__context__) /*nobjects*/));
+	testSim_d57b6dfc3ec85f37(__context__,das_arg<TDim<NObject,10000>>::pass(das_global<TDim<NObject,10000>,0x916781b09563e1d6>(__context__) /*nobjects*/));
+	init_9b5e71d825369cdb(__context__,das_arg<TDim<NObject,10000>>::pass(das_global<TDim<NObject,10000>,0x916781b09563e1d6>(__context__) /*nobjects*/));
+	testSimI_9693240a1ba45f06(__context__,das_arg<TDim<NObject,10000>>::pass(das_global<TDim<NObject,10000>,0x916781b09563e1d6>(__context__) /*nobjects*/));
+	init_63f9fef262132206(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_97));
+	testSim_9c13b5f536150f41(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_97));
+	init_63f9fef262132206(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_97));
+	testSimI_5f4b06f7ab1ed004(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_97));
+	init_63f9fef262132206(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_97));
+	updateTest(das_arg<ObjectArray>::pass(__objects_rename_at_97));
+	init_63f9fef262132206(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_97));
+	testInterop_89f99ec31017686d(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_97));
+	init_63f9fef262132206(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_97));
+	update10000(das_arg<ObjectArray>::pass(__objects_rename_at_97),__context__);
+	init_63f9fef262132206(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_97));
+	update10000ks(das_arg<ObjectArray>::pass(__objects_rename_at_97),__context__);
+	float __simTN_rename_at_127 = ((float)builtin_profile(20,((char *) "native basic version"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		{
+			uint64_t __loop_count_128 = UINT64_MAX;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,1000));
+			int32_t __i_rename_at_128;
+			__loop_count_128 = das_loop_count(__loop_count_128,__i_iterator.loop_begin(__context__,(__i_rename_at_128)));
+			for ( ; __loop_count_128 ; --__loop_count_128, ++__i_rename_at_128 )
+			{
+				testSim_d57b6dfc3ec85f37(__context__,das_arg<TDim<NObject,10000>>::pass(das_global<TDim<NObject,10000>,0x916781b09563e1d6>(__context__) /*nobjects*/));
+			}
+			__i_iterator.loop_end(__context__,(__i_rename_at_128));
+		};
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))));
+	float __simTN_I_rename_at_130 = ((float)builtin_profile(20,((char *) "native basic version, inline"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		{
+			uint64_t __loop_count_131 = UINT64_MAX;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,1000));
+			int32_t __i_rename_at_131;
+			__loop_count_131 = das_loop_count(__loop_count_131,__i_iterator.loop_begin(__context__,(__i_rename_at_131)));
+			for ( ; __loop_count_131 ; --__loop_count_131, ++__i_rename_at_131 )
+			{
+				testSimI_9693240a1ba45f06(__context__,das_arg<TDim<NObject,10000>>::pass(das_global<TDim<NObject,10000>,0x916781b09563e1d6>(__context__) /*nobjects*/));
+			}
+			__i_iterator.loop_end(__context__,(__i_rename_at_131));
+		};
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))));
+	float __simT_rename_at_133 = ((float)builtin_profile(20,((char *) "basic version"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		{
+			uint64_t __loop_count_134 = UINT64_MAX;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,1000));
+			int32_t __i_rename_at_134;
+			__loop_count_134 = das_loop_count(__loop_count_134,__i_iterator.loop_begin(__context__,(__i_rename_at_134)));
+			for ( ; __loop_count_134 ; --__loop_count_134, ++__i_rename_at_134 )
+			{
+				testSim_9c13b5f536150f41(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_97));
+			}
+			__i_iterator.loop_end(__context__,(__i_rename_at_134));
+		};
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))));
+	float __simT_I_rename_at_136 = ((float)builtin_profile(20,((char *) "basic version, inline"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		{
+			uint64_t __loop_count_137 = UINT64_MAX;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,1000));
+			int32_t __i_rename_at_137;
+			__loop_count_137 = das_loop_count(__loop_count_137,__i_iterator.loop_begin(__context__,(__i_rename_at_137)));
+			for ( ; __loop_count_137 ; --__loop_count_137, ++__i_rename_at_137 )
+			{
+				testSimI_5f4b06f7ab1ed004(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_97));
+			}
+			__i_iterator.loop_end(__context__,(__i_rename_at_137));
+		};
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))));
+	float __cT_rename_at_139 = ((float)builtin_profile(20,((char *) "c++ version"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		{
+			uint64_t __loop_count_140 = UINT64_MAX;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,1000));
+			int32_t __i_rename_at_140;
+			__loop_count_140 = das_loop_count(__loop_count_140,__i_iterator.loop_begin(__context__,(__i_rename_at_140)));
+			for ( ; __loop_count_140 ; --__loop_count_140, ++__i_rename_at_140 )
+			{
+				updateTest(das_arg<ObjectArray>::pass(__objects_rename_at_97));
+			}
+			__i_iterator.loop_end(__context__,(__i_rename_at_140));
+		};
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))));
+	float __intT_rename_at_142 = ((float)builtin_profile(20,((char *) "interop version"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		{
+			uint64_t __loop_count_143 = UINT64_MAX;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,1000));
+			int32_t __i_rename_at_143;
+			__loop_count_143 = das_loop_count(__loop_count_143,__i_iterator.loop_begin(__context__,(__i_rename_at_143)));
+			for ( ; __loop_count_143 ; --__loop_count_143, ++__i_rename_at_143 )
+			{
+				testInterop_89f99ec31017686d(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_97));
+			}
+			__i_iterator.loop_end(__context__,(__i_rename_at_143));
+		};
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))));
+	float __manyT_rename_at_145 = ((float)builtin_profile(20,((char *) "interop 10000 version"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		{
+			uint64_t __loop_count_146 = UINT64_MAX;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,1000));
+			int32_t __i_rename_at_146;
+			__loop_count_146 = das_loop_count(__loop_count_146,__i_iterator.loop_begin(__context__,(__i_rename_at_146)));
+			for ( ; __loop_count_146 ; --__loop_count_146, ++__i_rename_at_146 )
+			{
+				update10000(das_arg<ObjectArray>::pass(__objects_rename_at_97),__context__);
+			}
+			__i_iterator.loop_end(__context__,(__i_rename_at_146));
+		};
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))));
+	float __manyKsT_rename_at_148 = ((float)builtin_profile(20,((char *) "interop 10000-ks version"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		{
+			uint64_t __loop_count_149 = UINT64_MAX;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,1000));
+			int32_t __i_rename_at_149;
+			__loop_count_149 = das_loop_count(__loop_count_149,__i_iterator.loop_begin(__context__,(__i_rename_at_149)));
+			for ( ; __loop_count_149 ; --__loop_count_149, ++__i_rename_at_149 )
+			{
+				update10000ks(das_arg<ObjectArray>::pass(__objects_rename_at_97),__context__);
+			}
+			__i_iterator.loop_end(__context__,(__i_rename_at_149));
+		};
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))));
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_0, cast<char * const >::from(((char *) "ratio nsim/c++ ")), cast<float>::from((SimPolicy<float>::Div(__simTN_rename_at_127,__cT_rename_at_139,*__context__,nullptr))), cast<char * const >::from(((char *) "\n")))),__context__);
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "ratio sim/c++: ")), cast<float>::from((SimPolicy<float>::Div(__simT_rename_at_133,__cT_rename_at_139,*__context__,nullptr))), cast<char * const >::from(((char *) "\n")))),__context__);
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_2, cast<char * const >::from(((char *) "ratio nsim,inline/c++ ")), cast<float>::from((SimPolicy<float>::Div(__simTN_I_rename_at_130,__cT_rename_at_139,*__context__,nullptr))), cast<char * const >::from(((char *) "\n")))),__context__);
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_3, cast<char * const >::from(((char *) "ratio sim,inline/c++: ")), cast<float>::from((SimPolicy<float>::Div(__simT_I_rename_at_136,__cT_rename_at_139,*__context__,nullptr))), cast<char * const >::from(((char *) "\n")))),__context__);
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_4, cast<char * const >::from(((char *) "ratio interop/c++: ")), cast<float>::from((SimPolicy<float>::Div(__intT_rename_at_142,__cT_rename_at_139,*__context__,nullptr))), cast<char * const >::from(((char *) "\n")))),__context__);
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_5, cast<char * const >::from(((char *) "ratio interop-10000/c++: ")), cast<float>::from((SimPolicy<float>::Div(__manyT_rename_at_145,__cT_rename_at_139,*__context__,nullptr))), cast<char * const >::from(((char *) "\n")))),__context__);
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_6, cast<char * const >::from(((char *) "ratio interop-10000-ks/c++: ")), cast<float>::from((SimPolicy<float>::Div(__manyKsT_rename_at_148,__cT_rename_at_139,*__context__,nullptr))), cast<char * const >::from(((char *) "\n")))),__context__);
+	return das_auto_cast<bool>::cast(true);
+}}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// perks_disabler_unset_es_9afe6f7427db3ce2
+	aotLib[0xd87488b5588db229] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, ObjectArray & , ObjectArray &  ),&perks_disabler_unset_es_9afe6f7427db3ce2>>();
+	};
+	// update_72a908a54031d882
+	aotLib[0x6ddb934d4346811] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, NObject &  ),&update_72a908a54031d882>>();
+	};
+	// testSim_d57b6dfc3ec85f37
+	aotLib[0xc59dc9a9544b6154] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<NObject,10000> &  ),&testSim_d57b6dfc3ec85f37>>();
+	};
+	// testSimI_9693240a1ba45f06
+	aotLib[0x566ab6ef1273ba11] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<NObject,10000> &  ),&testSimI_9693240a1ba45f06>>();
+	};
+	// ks_update_f72fb25588a5bc93
+	aotLib[0x8e801eac8316343d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, float3 & , float3  ),&ks_update_f72fb25588a5bc93>>();
+	};
+	// update_2c3efcd012b89487
+	aotLib[0x4fdd8d32f8761a69] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Object &  ),&update_2c3efcd012b89487>>();
+	};
+	// testSim_9c13b5f536150f41
+	aotLib[0x4b667268dcb58b2e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ObjectArray &  ),&testSim_9c13b5f536150f41>>();
+	};
+	// testSimI_5f4b06f7ab1ed004
+	aotLib[0x9c8a95d984e92245] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ObjectArray &  ),&testSimI_5f4b06f7ab1ed004>>();
+	};
+	// testInterop_89f99ec31017686d
+	aotLib[0x7f19fc90b432cf1d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ObjectArray &  ),&testInterop_89f99ec31017686d>>();
+	};
+	// initObj_5f38f1de1877930b
+	aotLib[0x1b1bf525fd621de1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , Object &  ),&initObj_5f38f1de1877930b>>();
+	};
+	// initObj_576a6061f608005a
+	aotLib[0xe0baa25ec00a2131] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , NObject &  ),&initObj_576a6061f608005a>>();
+	};
+	// init_63f9fef262132206
+	aotLib[0x2bedbda6d600f54c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ObjectArray &  ),&init_63f9fef262132206>>();
+	};
+	// init_9b5e71d825369cdb
+	aotLib[0xddb8beceed2b010f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<NObject,10000> &  ),&init_9b5e71d825369cdb>>();
+	};
+	// verifyManagedInt_4a41078172b557b7
+	aotLib[0x5fbe48b0af73910d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&verifyManagedInt_4a41078172b557b7>>();
+	};
+	// test_b611289a48664e4f
+	aotLib[0xc1a38711b246dbad] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, ObjectArray &  ),&test_b611289a48664e4f>>();
+	};
+	// [[ init script ]]
+	aotLib[0x24c1e32f61945ff7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,254 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require testProfile
+#include "test_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_13555211742754297576 {
+
+extern TypeInfo __type_info__af63eb4c86020609;
+extern FuncInfo __func_info__eeb3b74c98cb09c3;
+
+FuncInfo __func_info__eeb3b74c98cb09c3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,0xeeb3b74c98cb09c3ul, 0x0 };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, 0xaf63eb4c86020609ul };
+
+
+inline void _Funcbuiltin_0x60_resize_d240579333227022 ( Context * __context__, TArray<float> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60_resize_761fb73a377a5e66 ( Context * __context__, TArray<float4> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void saxpy_f455f83694040b20 ( Context * __context__, TArray<float> & __y_rename_at_3, TArray<float> const  & __x_rename_at_3, float __a_rename_at_3 );
+inline float testSaxpyLoop_b9adff5b519ff14e ( Context * __context__, int32_t __count_rename_at_8 );
+inline float4 sumFloat4_999253f27b5bcf39 ( Context * __context__, TArray<float4> const  & __vel_rename_at_19 );
+inline float testSumFloat4Loop_22908ded51da49bb ( Context * __context__, int32_t __count_rename_at_26 );
+inline bool test_8865abd633e691a ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_resize_d240579333227022 ( Context * __context__, TArray<float> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<float>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_761fb73a377a5e66 ( Context * __context__, TArray<float4> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<float4>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,16,__context__);
+}
+
+inline void saxpy_f455f83694040b20 ( Context * __context__, TArray<float> &  __y_rename_at_3, TArray<float> const  &  __x_rename_at_3, float __a_rename_at_3 )
+{
+	{
+		uint64_t __loop_count_4 = UINT64_MAX;
+		// yy : float&
+		das_iterator<TArray<float>> __yy_iterator(__y_rename_at_3);
+		float * __yy_rename_at_4;
+		__loop_count_4 = das_loop_count(__loop_count_4,__yy_iterator.loop_begin(__context__,(__yy_rename_at_4)));
+		// xx : float const&
+		das_iterator<TArray<float> const > __xx_iterator(__x_rename_at_3);
+		float const  * __xx_rename_at_4;
+		__loop_count_4 = das_loop_count(__loop_count_4,__xx_iterator.loop_begin(__context__,(__xx_rename_at_4)));
+		for ( ; __loop_count_4 ; --__loop_count_4, ++__yy_rename_at_4, ++__xx_rename_at_4 )
+		{
+			(*__yy_rename_at_4) += (__a_rename_at_3 * (*__xx_rename_at_4));
+		}
+		__yy_iterator.loop_end(__context__,(__yy_rename_at_4));
+		__xx_iterator.loop_end(__context__,(__xx_rename_at_4));
+	};
+}
+
+inline float testSaxpyLoop_b9adff5b519ff14e ( Context * __context__, int32_t __count_rename_at_8 )
+{
+	TArray<float> __x_rename_at_9; das_zero(__x_rename_at_9); TArray<float> __y_rename_at_9; das_zero(__y_rename_at_9);
+	_Funcbuiltin_0x60_resize_d240579333227022(__context__,das_arg<TArray<float>>::pass(__x_rename_at_9),100000);
+	_Funcbuiltin_0x60_resize_d240579333227022(__context__,das_arg<TArray<float>>::pass(__y_rename_at_9),100000);
+	{
+		uint64_t __loop_count_12 = UINT64_MAX;
+		// xx : float&
+		das_iterator<TArray<float>> __xx_iterator(__x_rename_at_9);
+		float * __restrict __xx_rename_at_12;
+		__loop_count_12 = das_loop_count(__loop_count_12,__xx_iterator.loop_begin(__context__,(__xx_rename_at_12)));
+		// yy : float&
+		das_iterator<TArray<float>> __yy_iterator(__y_rename_at_9);
+		float * __restrict __yy_rename_at_12;
+		__loop_count_12 = das_loop_count(__loop_count_12,__yy_iterator.loop_begin(__context__,(__yy_rename_at_12)));
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,100000));
+		int32_t __i_rename_at_12;
+		__loop_count_12 = das_loop_count(__loop_count_12,__i_iterator.loop_begin(__context__,(__i_rename_at_12)));
+		for ( ; __loop_count_12 ; --__loop_count_12, ++__xx_rename_at_12, ++__yy_rename_at_12, ++__i_rename_at_12 )
+		{
+			das_copy((*__xx_rename_at_12),float(__i_rename_at_12));
+			das_copy((*__yy_rename_at_12),1.f);
+		}
+		__xx_iterator.loop_end(__context__,(__xx_rename_at_12));
+		__yy_iterator.loop_end(__context__,(__yy_rename_at_12));
+		__i_iterator.loop_end(__context__,(__i_rename_at_12));
+	};
+	{
+		uint64_t __loop_count_15 = UINT64_MAX;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__count_rename_at_8));
+		int32_t __i_rename_at_15;
+		__loop_count_15 = das_loop_count(__loop_count_15,__i_iterator.loop_begin(__context__,(__i_rename_at_15)));
+		for ( ; __loop_count_15 ; --__loop_count_15, ++__i_rename_at_15 )
+		{
+			saxpy_f455f83694040b20(__context__,das_arg<TArray<float>>::pass(__y_rename_at_9),das_arg<TArray<float>>::pass(__x_rename_at_9),0.5f);
+		}
+		__i_iterator.loop_end(__context__,(__i_rename_at_15));
+	};
+	return das_auto_cast<float>::cast(__y_rename_at_9(99999,__context__));
+}
+
+inline float4 sumFloat4_999253f27b5bcf39 ( Context * __context__, TArray<float4> const  &  __vel_rename_at_19 )
+{
+	float4 __sum_rename_at_20 = v_zero();
+	{
+		uint64_t __loop_count_21 = UINT64_MAX;
+		// v : float4 const&
+		das_iterator<TArray<float4> const > __v_iterator(__vel_rename_at_19);
+		float4 const  * __v_rename_at_21;
+		__loop_count_21 = das_loop_count(__loop_count_21,__v_iterator.loop_begin(__context__,(__v_rename_at_21)));
+		for ( ; __loop_count_21 ; --__loop_count_21, ++__v_rename_at_21 )
+		{
+			SimPolicy<float4>::SetAdd((char *)&(__sum_rename_at_20),(*__v_rename_at_21),*__context__,nullptr);
+		}
+		__v_iterator.loop_end(__context__,(__v_rename_at_21));
+	};
+	return das_auto_cast<float4>::cast(__sum_rename_at_20);
+}
+
+inline float testSumFloat4Loop_22908ded51da49bb ( Context * __context__, int32_t __count_rename_at_26 )
+{
+	TArray<float4> __vel_rename_at_27; das_zero(__vel_rename_at_27);
+	_Funcbuiltin_0x60_resize_761fb73a377a5e66(__context__,das_arg<TArray<float4>>::pass(__vel_rename_at_27),25000);
+	{
+		uint64_t __loop_count_29 = UINT64_MAX;
+		// v : float4&
+		das_iterator<TArray<float4>> __v_iterator(__vel_rename_at_27);
+		float4 * __restrict __v_rename_at_29;
+		__loop_count_29 = das_loop_count(__loop_count_29,__v_iterator.loop_begin(__context__,(__v_rename_at_29)));
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,25000));
+		int32_t __i_rename_at_29;
+		__loop_count_29 = das_loop_count(__loop_count_29,__i_iterator.loop_begin(__context__,(__i_rename_at_29)));
+		for ( ; __loop_count_29 ; --__loop_count_29, ++__v_rename_at_29, ++__i_rename_at_29 )
+		{
+			das_copy((*__v_rename_at_29),float4(float(__i_rename_at_29),1.f,2.f,3.f));
+		}
+		__v_iterator.loop_end(__context__,(__v_rename_at_29));
+		__i_iterator.loop_end(__context__,(__i_rename_at_29));
+	};
+	float4 __sum_rename_at_31 = v_zero();
+	{
+		uint64_t __loop_count_32 = UINT64_MAX;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__count_rename_at_26));
+		int32_t __i_rename_at_32;
+		__loop_count_32 = das_loop_count(__loop_count_32,__i_iterator.loop_begin(__context__,(__i_rename_at_32)));
+		for ( ; __loop_count_32 ; --__loop_count_32, ++__i_rename_at_32 )
+		{
+			SimPolicy<float4>::SetAdd((char *)&(__sum_rename_at_31),sumFloat4_999253f27b5bcf39(__context__,das_arg<TArray<float4>>::pass(__vel_rename_at_27)),*__context__,nullptr);
+		}
+		__i_iterator.loop_end(__context__,(__i_rename_at_32));
+	};
+	return das_auto_cast<float>::cast(v_extract_x(__sum_rename_at_31) /*x*/);
+}
+
+inline bool test_8865abd633e691a ( Context * __context__ ) { das_stack_prologue __prologue(__context__,224,"test " DAS_FILE_LINE);
+{
+	builtin_profile(20,((char *) "saxpy over array<float>"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		testSaxpyLoop_b9adff5b519ff14e(__context__,100);
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	builtin_profile(20,((char *) "saxpy over array<float>, C++"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		testSaxpy(100);
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	builtin_profile(20,((char *) "sum over array<float4>"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		testSumFloat4Loop_22908ded51da49bb(__context__,100);
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	builtin_profile(20,((char *) "sum over array<float4>, C++"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		testSumFloat4(100);
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	return das_auto_cast<bool>::cast(true);
+}}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_resize_d240579333227022
+	aotLib[0x40d6b5552dd22f51] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> & , int32_t  ),&_Funcbuiltin_0x60_resize_d240579333227022>>();
+	};
+	// _Funcbuiltin_0x60_resize_761fb73a377a5e66
+	aotLib[0xc267e309ce3735b5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float4> & , int32_t  ),&_Funcbuiltin_0x60_resize_761fb73a377a5e66>>();
+	};
+	// saxpy_f455f83694040b20
+	aotLib[0x1e9bcbbd6fc641c1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> & , TArray<float> const  & , float  ),&saxpy_f455f83694040b20>>();
+	};
+	// testSaxpyLoop_b9adff5b519ff14e
+	aotLib[0x5b8ef38528cf307a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, int32_t  ),&testSaxpyLoop_b9adff5b519ff14e>>();
+	};
+	// sumFloat4_999253f27b5bcf39
+	aotLib[0xb060a444583b5995] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float4 (*) ( Context * __context__, TArray<float4> const  &  ),&sumFloat4_999253f27b5bcf39>>();
+	};
+	// testSumFloat4Loop_22908ded51da49bb
+	aotLib[0x414021c3831ac808] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, int32_t  ),&testSumFloat4Loop_22908ded51da49bb>>();
+	};
+	// test_8865abd633e691a
+	aotLib[0x87b8fb46b90a91f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_8865abd633e691a>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,155 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require testProfile
+#include "test_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_5898749109936057247 {
+
+extern TypeInfo __type_info__af63eb4c86020609;
+extern FuncInfo __func_info__eeb3b74c98cb09c3;
+
+FuncInfo __func_info__eeb3b74c98cb09c3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,0xeeb3b74c98cb09c3ul, 0x0 };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, 0xaf63eb4c86020609ul };
+
+
+inline int32_t _Func_0x60_fibI_ab1e11f1c4abe105 ( Context * __context__, int32_t __n_rename_at_18 );
+inline int32_t _Func_0x60_fibR_322b28e409620a2f ( Context * __context__, int32_t __n_rename_at_6 );
+inline int32_t fibT_8e98827f51d4fb3 ( Context * __context__, int32_t __n_rename_at_12, int32_t __last_rename_at_12, int32_t __cur_rename_at_12 );
+inline bool test_520b220bbad8ffac ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline int32_t _Func_0x60_fibI_ab1e11f1c4abe105 ( Context * __context__, int32_t __n_rename_at_18 )
+{
+	int32_t __last_rename_at_19 = 0;
+	int32_t __cur_rename_at_20 = 1;
+	{
+		uint64_t __loop_count_21 = UINT64_MAX;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__n_rename_at_18 - 1));
+		int32_t __i_rename_at_21;
+		__loop_count_21 = das_loop_count(__loop_count_21,__i_iterator.loop_begin(__context__,(__i_rename_at_21)));
+		for ( ; __loop_count_21 ; --__loop_count_21, ++__i_rename_at_21 )
+		{
+			int32_t __tmp_rename_at_22 = ((int32_t)__cur_rename_at_20);
+			__cur_rename_at_20 += __last_rename_at_19;
+			das_copy(__last_rename_at_19,__tmp_rename_at_22);
+		}
+		__i_iterator.loop_end(__context__,(__i_rename_at_21));
+	};
+	return das_auto_cast<int32_t>::cast(__cur_rename_at_20);
+}
+
+inline int32_t _Func_0x60_fibR_322b28e409620a2f ( Context * __context__, int32_t __n_rename_at_6 )
+{
+	return das_auto_cast<int32_t>::cast((__n_rename_at_6 < 2) ? das_auto_cast<int32_t>::cast(__n_rename_at_6) : das_auto_cast<int32_t>::cast((_Func_0x60_fibR_322b28e409620a2f(__context__,__n_rename_at_6 - 1) + _Func_0x60_fibR_322b28e409620a2f(__context__,__n_rename_at_6 - 2))));
+}
+
+inline int32_t fibT_8e98827f51d4fb3 ( Context * __context__, int32_t __n_rename_at_12, int32_t __last_rename_at_12, int32_t __cur_rename_at_12 )
+{
+__tail_call:
+	{ if ( (__n_rename_at_12 == 0) ) { return das_auto_cast<int32_t>::cast(__last_rename_at_12); } else { /* tail call */ int32_t __tail_arg_0 = __n_rename_at_12 - 1; int32_t __tail_arg_1 = __cur_rename_at_12; int32_t __tail_arg_2 = __last_rename_at_12 + __cur_rename_at_12; __n_rename_at_12 = __tail_arg_0; __last_rename_at_12 = __tail_arg_1; __cur_rename_at_12 = __tail_arg_2; goto __tail_call; } };
+}
+
+inline bool test_520b220bbad8ffac ( Context * __context__ ) { das_stack_prologue __prologue(__context__,352,"test " DAS_FILE_LINE);
+{
+	int32_t __f1_rename_at_29 = 0;
+	builtin_profile(20,((char *) "fibbonacci loop"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		das_copy(__f1_rename_at_29,_Func_0x60_fibI_ab1e11f1c4abe105(__context__,6511134));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	DAS_ASSERT((__f1_rename_at_29 == 1781508648));
+	int32_t __f3_rename_at_33 = 0;
+	builtin_profile(20,((char *) "fibbonacci recursive"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		das_copy(__f3_rename_at_33,_Func_0x60_fibR_322b28e409620a2f(__context__,31));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	DAS_ASSERT((__f3_rename_at_33 == 1346269));
+	int32_t __f2_rename_at_37 = 0;
+	builtin_profile(20,((char *) "fibbonacci tail recursive"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		das_copy(__f2_rename_at_37,fibT_8e98827f51d4fb3(__context__,6511134,0,1));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	DAS_ASSERT((__f2_rename_at_37 == 1781508648));
+	int32_t __f4_rename_at_41 = 0;
+	builtin_profile(20,((char *) "fibbonacci loop c++"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		das_copy(__f4_rename_at_41,testFibI(6511134));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	DAS_ASSERT((__f4_rename_at_41 == 1781508648));
+	int32_t __f5_rename_at_45 = 0;
+	builtin_profile(20,((char *) "fibbonacci recursive c++"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		das_copy(__f5_rename_at_45,testFibR(31));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	DAS_ASSERT((__f5_rename_at_45 == 1346269));
+	return das_auto_cast<bool>::cast(true);
+}}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Func_0x60_fibI_ab1e11f1c4abe105
+	aotLib[0x687a2fdfbf0dade5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&_Func_0x60_fibI_ab1e11f1c4abe105>>();
+	};
+	// _Func_0x60_fibR_322b28e409620a2f
+	aotLib[0x76205f46766150b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&_Func_0x60_fibR_322b28e409620a2f>>();
+	};
+	// fibT_8e98827f51d4fb3
+	aotLib[0x54f3a9bc09019a2d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t , int32_t , int32_t  ),&fibT_8e98827f51d4fb3>>();
+	};
+	// test_520b220bbad8ffac
+	aotLib[0xcf71739cb0b60f16] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_520b220bbad8ffac>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,880 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require functional
+ // require strings_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_11419041301210940104 {
+
+extern StructInfo __struct_info__954eefc391620d5b;
+extern StructInfo __struct_info__26ecbbbbbb122bd1;
+extern StructInfo __struct_info__d3aa58e48f4a9be9;
+extern StructInfo __struct_info__326279bbcaa05b07;
+extern TypeInfo __type_info__1185f2bcb2a62aa0;
+extern TypeInfo __type_info__6f902bb202c1ac85;
+extern TypeInfo __type_info__90f4c07b5a6e390;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__2bef36d3c2da703c;
+extern TypeInfo __type_info__af63df4c8601f1a5;
+extern TypeInfo __type_info__af63ee4c86020b22;
+extern TypeInfo __type_info__90f3d07b5a6ca13;
+extern TypeInfo __type_info__7bf4d07b489ce1e;
+extern TypeInfo __type_info__2747739196a517ac;
+extern TypeInfo __type_info__b29301ae75415d99;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__7bf5307b489d850;
+extern TypeInfo __type_info__4f2ed2886afa1eea;
+extern TypeInfo __type_info__90f5707b5a6f641;
+extern TypeInfo __type_info__f95678735cf0e442;
+extern TypeInfo __type_info__d33a1a8d7c678682;
+extern TypeInfo __type_info__97d4c4d633ae92b4;
+extern TypeInfo __type_info__fa39fefc55c220e2;
+extern TypeInfo __type_info__1a0ac7cd5f09ade2;
+extern TypeInfo __type_info__ebd3809580aadc19;
+extern TypeInfo __type_info__3ceb21b1e6727087;
+extern VarInfo __var_info__a232cbab0eff46e0;
+extern VarInfo __var_info__7d563c8da8606540;
+extern VarInfo __var_info__a2512d49ecc34026;
+extern VarInfo __var_info__1372e0788193062d;
+extern VarInfo __var_info__c96be055cb46432;
+extern VarInfo __var_info__6054875315d987a1;
+extern VarInfo __var_info__21f35bdb24b946ba;
+extern VarInfo __var_info__d653876cee6e4c4b;
+extern VarInfo __var_info__a7509178d58015dc;
+extern VarInfo __var_info__3c9faa31b04e65c7;
+extern VarInfo __var_info__5965d295a8787daf;
+extern VarInfo __var_info__e727240487b7e871;
+extern VarInfo __var_info__4177dbbbe3168c34;
+extern VarInfo __var_info__546c186ca4dc1c66;
+extern VarInfo __var_info__abc8a910cdc9a322;
+extern VarInfo __var_info__d5c69e6b092b41de;
+extern VarInfo __var_info__65116293ca7984fd;
+extern VarInfo __var_info__b113c6e230bd815c;
+extern VarInfo __var_info__fd2182b07b2cf782;
+extern VarInfo __var_info__59983f99958ecb63;
+extern VarInfo __var_info__33f40f860b7358c2;
+extern VarInfo __var_info__ddcea4e98dadbaa8;
+extern VarInfo __var_info__c9c655b357e2d2d0;
+extern VarInfo __var_info__183e84f476168fc4;
+extern FuncInfo __func_info__89cfdd27951bb6cd;
+extern FuncInfo __func_info__855d89348d068c20;
+extern FuncInfo __func_info__eeb3b74c98cb09c3;
+
+TypeInfo * __type_info__ddcea4e98dadbaa8_arg_types_var_10758800183071477083[2] = { &__type_info__1a0ac7cd5f09ade2, &__type_info__7bf4d07b489ce1e };
+VarInfo __struct_info__954eefc391620d5b_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__ddcea4e98dadbaa8_arg_types_var_10758800183071477083, nullptr, 2, 0, nullptr, 28, 8, 0xddcea4e98dadbaa8ul, "__lambda", 0 };
+TypeInfo * __type_info__65116293ca7984fd_arg_types_var_10758800183071477083[1] = { &__type_info__d33a1a8d7c678682 };
+VarInfo __struct_info__954eefc391620d5b_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__65116293ca7984fd_arg_types_var_10758800183071477083, nullptr, 1, 0, nullptr, 28, 8, 0x65116293ca7984fdul, "__finalize", 8 };
+VarInfo __struct_info__954eefc391620d5b_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xb113c6e230bd815cul, "__yield", 16 };
+TypeInfo * __type_info__a7509178d58015dc_arg_types_var_10758800183071477083[1] = { &__type_info__90f5707b5a6f641 };
+VarInfo __struct_info__954eefc391620d5b_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__ebd3809580aadc19, nullptr, (TypeInfo **)__type_info__a7509178d58015dc_arg_types_var_10758800183071477083, nullptr, 1, 0, nullptr, 24576, 8, 0xa7509178d58015dcul, "blk", 24 };
+VarInfo __struct_info__954eefc391620d5b_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b29301ae75415d99, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, 0x1372e0788193062dul, "src", 32 };
+VarInfo __struct_info__954eefc391620d5b_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, 0x7d563c8da8606540ul, "_loop_at_32", 40 };
+VarInfo __struct_info__954eefc391620d5b_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b29301ae75415d99, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, 0xa232cbab0eff46e0ul, "_source_0_at_32", 48 };
+VarInfo __struct_info__954eefc391620d5b_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xc96be055cb46432ul, "w", 56 };
+VarInfo __struct_info__954eefc391620d5b_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0x4177dbbbe3168c34ul, "_pvar_0_at_32", 64 };
+VarInfo * __struct_info__954eefc391620d5b_fields[9] =  { &__struct_info__954eefc391620d5b_field_0, &__struct_info__954eefc391620d5b_field_1, &__struct_info__954eefc391620d5b_field_2, &__struct_info__954eefc391620d5b_field_3, &__struct_info__954eefc391620d5b_field_4, &__struct_info__954eefc391620d5b_field_5, &__struct_info__954eefc391620d5b_field_6, &__struct_info__954eefc391620d5b_field_7, &__struct_info__954eefc391620d5b_field_8 };
+StructInfo __struct_info__954eefc391620d5b = {(char*)"_lambda_thismodule_32_12_4", (char*)"", 14, __struct_info__954eefc391620d5b_fields, 9, 72, 0x0ul, nullptr, 0x954eefc391620d5bul };
+TypeInfo * __type_info__21f35bdb24b946ba_arg_types_var_2804823082916785105[2] = { &__type_info__97d4c4d633ae92b4, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__26ecbbbbbb122bd1_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__21f35bdb24b946ba_arg_types_var_2804823082916785105, nullptr, 2, 0, nullptr, 28, 8, 0x21f35bdb24b946baul, "__lambda", 0 };
+TypeInfo * __type_info__5965d295a8787daf_arg_types_var_2804823082916785105[1] = { &__type_info__2747739196a517ac };
+VarInfo __struct_info__26ecbbbbbb122bd1_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__5965d295a8787daf_arg_types_var_2804823082916785105, nullptr, 1, 0, nullptr, 28, 8, 0x5965d295a8787daful, "__finalize", 8 };
+VarInfo __struct_info__26ecbbbbbb122bd1_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xd5c69e6b092b41deul, "__yield", 16 };
+TypeInfo * __type_info__546c186ca4dc1c66_arg_types_var_2804823082916785105[1] = { &__type_info__90f5707b5a6f641 };
+VarInfo __struct_info__26ecbbbbbb122bd1_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__af63df4c8601f1a5, nullptr, (TypeInfo **)__type_info__546c186ca4dc1c66_arg_types_var_2804823082916785105, nullptr, 1, 0, nullptr, 24576, 8, 0x546c186ca4dc1c66ul, "blk", 24 };
+VarInfo __struct_info__26ecbbbbbb122bd1_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b29301ae75415d99, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, 0xd653876cee6e4c4bul, "src", 32 };
+VarInfo __struct_info__26ecbbbbbb122bd1_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, 0xfd2182b07b2cf782ul, "_loop_at_10", 40 };
+VarInfo __struct_info__26ecbbbbbb122bd1_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b29301ae75415d99, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, 0xa2512d49ecc34026ul, "_source_0_at_10", 48 };
+VarInfo __struct_info__26ecbbbbbb122bd1_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xc9c655b357e2d2d0ul, "w", 56 };
+VarInfo __struct_info__26ecbbbbbb122bd1_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0xabc8a910cdc9a322ul, "_pvar_0_at_10", 64 };
+VarInfo * __struct_info__26ecbbbbbb122bd1_fields[9] =  { &__struct_info__26ecbbbbbb122bd1_field_0, &__struct_info__26ecbbbbbb122bd1_field_1, &__struct_info__26ecbbbbbb122bd1_field_2, &__struct_info__26ecbbbbbb122bd1_field_3, &__struct_info__26ecbbbbbb122bd1_field_4, &__struct_info__26ecbbbbbb122bd1_field_5, &__struct_info__26ecbbbbbb122bd1_field_6, &__struct_info__26ecbbbbbb122bd1_field_7, &__struct_info__26ecbbbbbb122bd1_field_8 };
+StructInfo __struct_info__26ecbbbbbb122bd1 = {(char*)"_lambda_thismodule_10_12_2", (char*)"", 14, __struct_info__26ecbbbbbb122bd1_fields, 9, 72, 0x0ul, nullptr, 0x26ecbbbbbb122bd1ul };
+TypeInfo * __type_info__33f40f860b7358c2_arg_types_var_15252100826723425257[2] = { &__type_info__1185f2bcb2a62aa0, &__type_info__90f5707b5a6f641 };
+VarInfo __struct_info__d3aa58e48f4a9be9_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63ee4c86020b22, nullptr, (TypeInfo **)__type_info__33f40f860b7358c2_arg_types_var_15252100826723425257, nullptr, 2, 0, nullptr, 28, 8, 0x33f40f860b7358c2ul, "__lambda", 0 };
+TypeInfo * __type_info__3c9faa31b04e65c7_arg_types_var_15252100826723425257[1] = { &__type_info__2bef36d3c2da703c };
+VarInfo __struct_info__d3aa58e48f4a9be9_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__3c9faa31b04e65c7_arg_types_var_15252100826723425257, nullptr, 1, 0, nullptr, 28, 8, 0x3c9faa31b04e65c7ul, "__finalize", 8 };
+VarInfo * __struct_info__d3aa58e48f4a9be9_fields[2] =  { &__struct_info__d3aa58e48f4a9be9_field_0, &__struct_info__d3aa58e48f4a9be9_field_1 };
+StructInfo __struct_info__d3aa58e48f4a9be9 = {(char*)"_lambda_thismodule_29_22_3", (char*)"", 6, __struct_info__d3aa58e48f4a9be9_fields, 2, 16, 0x0ul, nullptr, 0xd3aa58e48f4a9be9ul };
+TypeInfo * __type_info__183e84f476168fc4_arg_types_var_3630598097079393031[2] = { &__type_info__fa39fefc55c220e2, &__type_info__90f5707b5a6f641 };
+VarInfo __struct_info__326279bbcaa05b07_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63df4c8601f1a5, nullptr, (TypeInfo **)__type_info__183e84f476168fc4_arg_types_var_3630598097079393031, nullptr, 2, 0, nullptr, 28, 8, 0x183e84f476168fc4ul, "__lambda", 0 };
+TypeInfo * __type_info__e727240487b7e871_arg_types_var_3630598097079393031[1] = { &__type_info__4f2ed2886afa1eea };
+VarInfo __struct_info__326279bbcaa05b07_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__e727240487b7e871_arg_types_var_3630598097079393031, nullptr, 1, 0, nullptr, 28, 8, 0xe727240487b7e871ul, "__finalize", 8 };
+VarInfo __struct_info__326279bbcaa05b07_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0x59983f99958ecb63ul, "mod", 16 };
+VarInfo * __struct_info__326279bbcaa05b07_fields[3] =  { &__struct_info__326279bbcaa05b07_field_0, &__struct_info__326279bbcaa05b07_field_1, &__struct_info__326279bbcaa05b07_field_2 };
+StructInfo __struct_info__326279bbcaa05b07 = {(char*)"_lambda_thismodule_28_25_1", (char*)"", 6, __struct_info__326279bbcaa05b07_fields, 3, 24, 0x0ul, nullptr, 0x326279bbcaa05b07ul };
+VarInfo __func_info__89cfdd27951bb6cd_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, 0x6054875315d987a1ul, "x", 0 };
+VarInfo * __func_info__89cfdd27951bb6cd_fields[1] =  { &__func_info__89cfdd27951bb6cd_field_0 };
+FuncInfo __func_info__89cfdd27951bb6cd = {"invoke block<(x:int const):string> const", "", __func_info__89cfdd27951bb6cd_fields, 1, 32, &__type_info__af63ee4c86020b22, nullptr,0,0x89cfdd27951bb6cdul, 0x0 };
+VarInfo __func_info__855d89348d068c20_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, 0x6054875315d987a1ul, "x", 0 };
+VarInfo * __func_info__855d89348d068c20_fields[1] =  { &__func_info__855d89348d068c20_field_0 };
+FuncInfo __func_info__855d89348d068c20 = {"invoke block<(x:int const):bool> const", "", __func_info__855d89348d068c20_fields, 1, 32, &__type_info__af63df4c8601f1a5, nullptr,0,0x855d89348d068c20ul, 0x0 };
+FuncInfo __func_info__eeb3b74c98cb09c3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,0xeeb3b74c98cb09c3ul, 0x0 };
+TypeInfo __type_info__1185f2bcb2a62aa0 = { Type::tStructure, &__struct_info__d3aa58e48f4a9be9, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 16, 0x1185f2bcb2a62aa0ul };
+TypeInfo __type_info__6f902bb202c1ac85 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63ee4c86020b22, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 24, 0x6f902bb202c1ac85ul };
+TypeInfo __type_info__90f4c07b5a6e390 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 1, 0x90f4c07b5a6e390ul };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xaf63e44c8601fa24ul };
+TypeInfo __type_info__2bef36d3c2da703c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__1185f2bcb2a62aa0, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0x2bef36d3c2da703cul };
+TypeInfo __type_info__af63df4c8601f1a5 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, 0xaf63df4c8601f1a5ul };
+TypeInfo __type_info__af63ee4c86020b22 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, 0xaf63ee4c86020b22ul };
+TypeInfo __type_info__90f3d07b5a6ca13 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, 0x90f3d07b5a6ca13ul };
+TypeInfo __type_info__7bf4d07b489ce1e = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16645, 8, 0x7bf4d07b489ce1eul };
+TypeInfo __type_info__2747739196a517ac = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__97d4c4d633ae92b4, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, 0x2747739196a517acul };
+TypeInfo __type_info__b29301ae75415d99 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xb29301ae75415d99ul };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, 0xaf63eb4c86020609ul };
+TypeInfo __type_info__7bf5307b489d850 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 285, 4, 0x7bf5307b489d850ul };
+TypeInfo __type_info__4f2ed2886afa1eea = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__fa39fefc55c220e2, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0x4f2ed2886afa1eeaul };
+TypeInfo __type_info__90f5707b5a6f641 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, 0x90f5707b5a6f641ul };
+TypeInfo __type_info__f95678735cf0e442 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~strings::StringBuilderWriter"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 40, 0xf95678735cf0e442ul };
+TypeInfo __type_info__d33a1a8d7c678682 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__1a0ac7cd5f09ade2, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, 0xd33a1a8d7c678682ul };
+TypeInfo __type_info__97d4c4d633ae92b4 = { Type::tStructure, &__struct_info__26ecbbbbbb122bd1, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24578, 72, 0x97d4c4d633ae92b4ul };
+TypeInfo __type_info__fa39fefc55c220e2 = { Type::tStructure, &__struct_info__326279bbcaa05b07, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 24, 0xfa39fefc55c220e2ul };
+TypeInfo __type_info__1a0ac7cd5f09ade2 = { Type::tStructure, &__struct_info__954eefc391620d5b, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24578, 72, 0x1a0ac7cd5f09ade2ul };
+TypeInfo __type_info__ebd3809580aadc19 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, 0xebd3809580aadc19ul };
+TypeInfo __type_info__3ceb21b1e6727087 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, 0x3ceb21b1e6727087ul };
+
+TypeInfo * __tinfo_0[2] = { &__type_info__f95678735cf0e442, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_1[2] = { &__type_info__f95678735cf0e442, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_2[1] = { &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_3[1] = { &__type_info__6f902bb202c1ac85 };
+TypeInfo * __tinfo_4[2] = { &__type_info__f95678735cf0e442, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_5[2] = { &__type_info__f95678735cf0e442, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_6[1] = { &__type_info__3ceb21b1e6727087 };
+TypeInfo * __tinfo_7[1] = { &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_8[2] = { &__type_info__f95678735cf0e442, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_9[2] = { &__type_info__f95678735cf0e442, &__type_info__af63ee4c86020b22 };
+namespace  { struct _lambda_thismodule_28_25_1; };
+namespace  { struct _lambda_thismodule_10_12_2; };
+namespace  { struct _lambda_thismodule_29_22_3; };
+namespace  { struct _lambda_thismodule_32_12_4; };
+namespace  {
+
+struct _lambda_thismodule_28_25_1 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_28_25_1,int32_t)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_28_25_1 *)) __finalize;
+	int32_t mod;
+};
+static_assert(sizeof(_lambda_thismodule_28_25_1)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_28_25_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_28_25_1,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_28_25_1,mod)==16,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_10_12_2 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_10_12_2,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_10_12_2 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((bool,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t)) src;
+	bool _loop_at_10;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_10;
+	int32_t w;
+	void * _pvar_0_at_10;
+};
+static_assert(sizeof(_lambda_thismodule_10_12_2)==72,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_2,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_2,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_2,blk)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_2,src)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_2,_loop_at_10)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_2,_source_0_at_10)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_2,w)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_2,_pvar_0_at_10)==64,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_29_22_3 {
+	Func DAS_COMMENT((char *,_lambda_thismodule_29_22_3,int32_t)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_29_22_3 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_29_22_3)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_29_22_3,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_29_22_3,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_32_12_4 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_32_12_4,char * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_32_12_4 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((char *,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t)) src;
+	bool _loop_at_32;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_32;
+	int32_t w;
+	void * _pvar_0_at_32;
+};
+static_assert(sizeof(_lambda_thismodule_32_12_4)==72,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_4,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_4,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_4,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_4,blk)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_4,src)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_4,_loop_at_32)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_4,_source_0_at_32)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_4,w)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_4,_pvar_0_at_32)==64,"structure field offset mismatch with DAS");
+}
+
+inline char * const  _Funcstrings_boost_0x60_join_262ae9de156365d6 ( Context * __context__, Sequence DAS_COMMENT((char *)) const  & __it_rename_at_17, char * const  __separator_rename_at_17 );
+inline void finalize_3ae5956d14f74a8d ( Context * __context__, _lambda_thismodule_32_12_4 & ____this_rename_at_32 );
+inline Sequence DAS_COMMENT((char *)) _Funcbuiltin_0x60_each_db0bdc14e7307b74 ( Context * __context__, Lambda DAS_COMMENT((bool,char * &)) const  __lam_rename_at_374 );
+inline bool _Func_lambda_thismodule_32_12_4_0x60_function_73c158cdee2524bf ( Context * __context__, _lambda_thismodule_32_12_4 & ____this_rename_at_32, char * & ___yield_32_rename_at_32 );
+inline void _Func_lambda_thismodule_32_12_4_0x60_finalizer_3baac9d51a4712bc ( Context * __context__, _lambda_thismodule_32_12_4 * ____this_rename_at_32 );
+inline void finalize_10db6b44f394cc3b ( Context * __context__, _lambda_thismodule_29_22_3 & ____this_rename_at_29 );
+inline char * _Func_lambda_thismodule_29_22_3_0x60_function_604fe7856e746c7a ( Context * __context__, _lambda_thismodule_29_22_3 & ____this_rename_at_29, int32_t __x_rename_at_29 );
+inline void _Func_lambda_thismodule_29_22_3_0x60_finalizer_fa12d335c2f857aa ( Context * __context__, _lambda_thismodule_29_22_3 * ____this_rename_at_29 );
+inline Sequence DAS_COMMENT((char *)) _Funcfunctional_0x60_map_any_9094e8e650017d54 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_29, Lambda DAS_COMMENT((char *,int32_t)) __blk_rename_at_29 );
+inline Sequence DAS_COMMENT((char *)) _Funcfunctional_0x60_map_666fc21f82f70a9 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_47, Lambda DAS_COMMENT((char *,int32_t)) const  __blk_rename_at_47 );
+inline void finalize_46aff3c3dd520d17 ( Context * __context__, _lambda_thismodule_10_12_2 & ____this_rename_at_10 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_e03cdb990e3d5374 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_374 );
+inline bool _Func_lambda_thismodule_10_12_2_0x60_function_a0aa9899188881e ( Context * __context__, _lambda_thismodule_10_12_2 & ____this_rename_at_10, int32_t & ___yield_10_rename_at_10 );
+inline void _Func_lambda_thismodule_10_12_2_0x60_finalizer_e19b7703ff50c0a4 ( Context * __context__, _lambda_thismodule_10_12_2 * ____this_rename_at_10 );
+inline void finalize_9f34814985861fc9 ( Context * __context__, _lambda_thismodule_28_25_1 & ____this_rename_at_28 );
+inline TArray<char *> & _Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465 ( Context * __context__, TArray<char *> & __a_rename_at_42 );
+inline bool _Func_lambda_thismodule_28_25_1_0x60_function_e9c416046d0a9a05 ( Context * __context__, _lambda_thismodule_28_25_1 & ____this_rename_at_28, int32_t __x_rename_at_28 );
+inline void _Func_lambda_thismodule_28_25_1_0x60_finalizer_eadc327160433522 ( Context * __context__, _lambda_thismodule_28_25_1 * ____this_rename_at_28 );
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> & __a_rename_at_293 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_any_bf7ad1100736e66e ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_7, Lambda DAS_COMMENT((bool,int32_t)) __blk_rename_at_7 );
+inline void _Funcbuiltin_0x60_reserve_cecea833d1e66117 ( Context * __context__, TArray<char *> & __Arr_rename_at_59, int32_t __newSize_rename_at_59 );
+inline void _Funcbuiltin_0x60_push_49bdd408ef1e4c5a ( Context * __context__, TArray<char *> & __Arr_rename_at_75, char * const  __value_rename_at_75 );
+inline char * const  _Funcstrings_boost_0x60_join_328e4c419218aea ( Context * __context__, TArray<char *> const  & __it_rename_at_17, char * const  __separator_rename_at_17 );
+inline void _Funcbuiltin_0x60_reserve_a0d71b661f152abb ( Context * __context__, TArray<int32_t> & __Arr_rename_at_59, int32_t __newSize_rename_at_59 );
+inline TArray<int32_t> & _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd ( Context * __context__, TArray<int32_t> & __a_rename_at_42 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_53efa21008623dcb ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_21, Lambda DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_21 );
+inline TArray<char *> _Func_0x60_map_a_bcf63cf0ecad999 ( Context * __context__, TArray<int32_t> const  & __src_rename_at_11, Block DAS_COMMENT((char *,int32_t)) const  & __blk_rename_at_11 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_293 );
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> & __Arr_rename_at_75, int32_t __value_rename_at_75 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_5cbab1dfe9635bc1 ( Context * __context__, range __rng_rename_at_345 );
+inline TArray<int32_t> _Func_0x60_filter_a_9be3f924e0b51d1e ( Context * __context__, TArray<int32_t> const  & __src_rename_at_18, Block DAS_COMMENT((bool,int32_t)) const  & __blk_rename_at_18 );
+inline TArray<int32_t> each_a_4fe169153722e59b ( Context * __context__, range __r_rename_at_4 );
+inline char * const  testGen_772ee263caac86e4 ( Context * __context__, int32_t __total_rename_at_25, int32_t __mod_rename_at_25 );
+inline char * const  testArr_828c0b16f9933b48 ( Context * __context__, int32_t __total_rename_at_33, int32_t __mod_rename_at_33 );
+inline char * const  testLoop_544fa5f25840a6fb ( Context * __context__, int32_t __total_rename_at_43, int32_t __mod_rename_at_43 );
+inline bool test_fd9f86b0061ed961 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline char * const  _Funcstrings_boost_0x60_join_262ae9de156365d6 ( Context * __context__, Sequence DAS_COMMENT((char *)) const  &  __it_rename_at_17, char * const  __separator_rename_at_17 )
+{
+	char * __st_rename_at_22 = ((char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_22)->void{
+		bool __skip_first_rename_at_23 = true;
+		{
+			bool __need_loop_24 = true;
+			// elem : string const
+			das_iterator<Sequence DAS_COMMENT((char *)) const > __elem_iterator(__it_rename_at_17);
+			char * __elem_rename_at_24;
+			__need_loop_24 = __elem_iterator.first(__context__,(__elem_rename_at_24)) && __need_loop_24;
+			for ( ; __need_loop_24 ; __need_loop_24 = __elem_iterator.next(__context__,(__elem_rename_at_24)) )
+			{
+				if ( __skip_first_rename_at_23 )
+				{
+					das_copy(__skip_first_rename_at_23,false);
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<StringBuilderWriter &>::from(__writer_rename_at_22),cast<char * const >::from(__separator_rename_at_17)));
+				};
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_1,cast<StringBuilderWriter &>::from(__writer_rename_at_22),cast<char * const >::from(__elem_rename_at_24)));
+			}
+			__elem_iterator.close(__context__,(__elem_rename_at_24));
+		};
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))));
+	return das_auto_cast<char * const >::cast(__st_rename_at_22);
+}
+
+inline void finalize_3ae5956d14f74a8d ( Context * __context__, _lambda_thismodule_32_12_4 &  ____this_rename_at_32 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),__context__);
+	memset(&(____this_rename_at_32), 0, 72);
+}
+
+inline Sequence DAS_COMMENT((char *)) _Funcbuiltin_0x60_each_db0bdc14e7307b74 ( Context * __context__, Lambda DAS_COMMENT((bool,char * &)) const  __lam_rename_at_374 )
+{
+	Sequence DAS_COMMENT((char *)) __it_rename_at_376; das_zero(__it_rename_at_376);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((char *))>::pass(__it_rename_at_376),__lam_rename_at_374,8,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((char *))>::cast(__it_rename_at_376);
+}
+
+inline bool _Func_lambda_thismodule_32_12_4_0x60_function_73c158cdee2524bf ( Context * __context__, _lambda_thismodule_32_12_4 &  ____this_rename_at_32, char * & ___yield_32_rename_at_32 )
+{
+	switch (____this_rename_at_32.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_32._loop_at_32,true);
+	das_move(____this_rename_at_32._source_0_at_32,____this_rename_at_32.src);
+	memset(&(____this_rename_at_32.w), 0, 4);
+	das_copy(____this_rename_at_32._pvar_0_at_32,das_ref(__context__,____this_rename_at_32.w));
+	DAS_SETBOOLAND((____this_rename_at_32._loop_at_32),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),____this_rename_at_32._pvar_0_at_32,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_32._loop_at_32 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_32_rename_at_32,das_invoke_lambda<char *>::invoke<int32_t>(__context__,nullptr,____this_rename_at_32.blk,____this_rename_at_32.w));
+	das_copy(____this_rename_at_32.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_32._loop_at_32),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),____this_rename_at_32._pvar_0_at_32,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),____this_rename_at_32._pvar_0_at_32,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_32_12_4_0x60_finalizer_3baac9d51a4712bc ( Context * __context__, _lambda_thismodule_32_12_4 * ____this_rename_at_32 )
+{
+	finalize_3ae5956d14f74a8d(__context__,das_arg<_lambda_thismodule_32_12_4>::pass(das_deref(__context__,____this_rename_at_32)));
+	das_delete_lambda_struct<_lambda_thismodule_32_12_4 *>::clear(__context__,____this_rename_at_32);
+}
+
+inline void finalize_10db6b44f394cc3b ( Context * __context__, _lambda_thismodule_29_22_3 &  ____this_rename_at_29 )
+{
+	memset(&(____this_rename_at_29), 0, 16);
+}
+
+inline char * _Func_lambda_thismodule_29_22_3_0x60_function_604fe7856e746c7a ( Context * __context__, _lambda_thismodule_29_22_3 &  ____this_rename_at_29, int32_t __x_rename_at_29 )
+{
+	return das_auto_cast<char *>::cast(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_2, cast<int32_t>::from(__x_rename_at_29))));
+}
+
+inline void _Func_lambda_thismodule_29_22_3_0x60_finalizer_fa12d335c2f857aa ( Context * __context__, _lambda_thismodule_29_22_3 * ____this_rename_at_29 )
+{
+	finalize_10db6b44f394cc3b(__context__,das_arg<_lambda_thismodule_29_22_3>::pass(das_deref(__context__,____this_rename_at_29)));
+	das_delete_lambda_struct<_lambda_thismodule_29_22_3 *>::clear(__context__,____this_rename_at_29);
+}
+
+inline Sequence DAS_COMMENT((char *)) _Funcfunctional_0x60_map_any_9094e8e650017d54 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_29, Lambda DAS_COMMENT((char *,int32_t)) __blk_rename_at_29 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((char *))>::cast(_Funcbuiltin_0x60_each_db0bdc14e7307b74(__context__,das_ascend<bool,_lambda_thismodule_32_12_4>::make(__context__,&__type_info__1a0ac7cd5f09ade2,(([&]() -> _lambda_thismodule_32_12_4 {
+		_lambda_thismodule_32_12_4 __mks_31;
+		das_zero(__mks_31);
+		das_copy((__mks_31.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_32_12_4`function XS<::_lambda_thismodule_32_12_4> &s*/ 17697194002503794329u))));
+		das_copy((__mks_31.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_32_12_4`finalizer X1<S<::_lambda_thismodule_32_12_4>>?*/ 11665587568936424104u))));
+		das_move((__mks_31.blk),(__blk_rename_at_29));
+		das_move((__mks_31.src),(__src_rename_at_29));
+		return __mks_31;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((char *)) _Funcfunctional_0x60_map_666fc21f82f70a9 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_47, Lambda DAS_COMMENT((char *,int32_t)) const  __blk_rename_at_47 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((char *))>::cast(_Funcfunctional_0x60_map_any_9094e8e650017d54(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_47),__blk_rename_at_47));
+}
+
+inline void finalize_46aff3c3dd520d17 ( Context * __context__, _lambda_thismodule_10_12_2 &  ____this_rename_at_10 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_10._source_0_at_10),__context__);
+	memset(&(____this_rename_at_10), 0, 72);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_e03cdb990e3d5374 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_374 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_376; das_zero(__it_rename_at_376);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_376),__lam_rename_at_374,4,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_376);
+}
+
+inline bool _Func_lambda_thismodule_10_12_2_0x60_function_a0aa9899188881e ( Context * __context__, _lambda_thismodule_10_12_2 &  ____this_rename_at_10, int32_t & ___yield_10_rename_at_10 )
+{
+	switch (____this_rename_at_10.__yield) {
+	case 0: goto label_0;
+	case 3: goto label_3;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_10._loop_at_10,true);
+	das_move(____this_rename_at_10._source_0_at_10,____this_rename_at_10.src);
+	memset(&(____this_rename_at_10.w), 0, 4);
+	das_copy(____this_rename_at_10._pvar_0_at_10,das_ref(__context__,____this_rename_at_10.w));
+	DAS_SETBOOLAND((____this_rename_at_10._loop_at_10),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_10._source_0_at_10),____this_rename_at_10._pvar_0_at_10,__context__)));
+	label_3:;;
+	if ( !____this_rename_at_10._loop_at_10 )
+	{
+		goto label_5;
+	};
+	if ( !das_invoke_lambda<bool>::invoke<int32_t>(__context__,nullptr,____this_rename_at_10.blk,____this_rename_at_10.w) )
+	{
+		goto label_2;
+	};
+	das_copy(___yield_10_rename_at_10,____this_rename_at_10.w);
+	das_copy(____this_rename_at_10.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_2:;;
+	label_4:;;
+	DAS_SETBOOLAND((____this_rename_at_10._loop_at_10),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_10._source_0_at_10),____this_rename_at_10._pvar_0_at_10,__context__)));
+	goto label_3;
+	label_5:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_10._source_0_at_10),____this_rename_at_10._pvar_0_at_10,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_10_12_2_0x60_finalizer_e19b7703ff50c0a4 ( Context * __context__, _lambda_thismodule_10_12_2 * ____this_rename_at_10 )
+{
+	finalize_46aff3c3dd520d17(__context__,das_arg<_lambda_thismodule_10_12_2>::pass(das_deref(__context__,____this_rename_at_10)));
+	das_delete_lambda_struct<_lambda_thismodule_10_12_2 *>::clear(__context__,____this_rename_at_10);
+}
+
+inline void finalize_9f34814985861fc9 ( Context * __context__, _lambda_thismodule_28_25_1 &  ____this_rename_at_28 )
+{
+	memset(&(____this_rename_at_28), 0, 24);
+}
+
+inline TArray<char *> & _Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465 ( Context * __context__, TArray<char *> &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_3,cast<TArray<char *> &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<TArray<char *> &>::cast(__a_rename_at_42);
+}
+
+inline bool _Func_lambda_thismodule_28_25_1_0x60_function_e9c416046d0a9a05 ( Context * __context__, _lambda_thismodule_28_25_1 &  ____this_rename_at_28, int32_t __x_rename_at_28 )
+{
+	return das_auto_cast<bool>::cast((SimPolicy<int32_t>::Mod(__x_rename_at_28,____this_rename_at_28.mod,*__context__,nullptr)) == 0);
+}
+
+inline void _Func_lambda_thismodule_28_25_1_0x60_finalizer_eadc327160433522 ( Context * __context__, _lambda_thismodule_28_25_1 * ____this_rename_at_28 )
+{
+	finalize_9f34814985861fc9(__context__,das_arg<_lambda_thismodule_28_25_1>::pass(das_deref(__context__,____this_rename_at_28)));
+	das_delete_lambda_struct<_lambda_thismodule_28_25_1 *>::clear(__context__,____this_rename_at_28);
+}
+
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> &  __a_rename_at_293 )
+{
+	builtin_array_free(das_arg<TArray<char *>>::pass(__a_rename_at_293),8,__context__);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_any_bf7ad1100736e66e ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_7, Lambda DAS_COMMENT((bool,int32_t)) __blk_rename_at_7 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_Funcbuiltin_0x60_each_e03cdb990e3d5374(__context__,das_ascend<bool,_lambda_thismodule_10_12_2>::make(__context__,&__type_info__97d4c4d633ae92b4,(([&]() -> _lambda_thismodule_10_12_2 {
+		_lambda_thismodule_10_12_2 __mks_9;
+		das_zero(__mks_9);
+		das_copy((__mks_9.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_10_12_2`function XS<::_lambda_thismodule_10_12_2> &i*/ 3055634059017582871u))));
+		das_copy((__mks_9.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_10_12_2`finalizer X1<S<::_lambda_thismodule_10_12_2>>?*/ 3149517641495132520u))));
+		das_move((__mks_9.blk),(__blk_rename_at_7));
+		das_move((__mks_9.src),(__src_rename_at_7));
+		return __mks_9;
+	})()))));
+}
+
+inline void _Funcbuiltin_0x60_reserve_cecea833d1e66117 ( Context * __context__, TArray<char *> &  __Arr_rename_at_59, int32_t __newSize_rename_at_59 )
+{
+	builtin_array_reserve(das_arg<TArray<char *>>::pass(__Arr_rename_at_59),__newSize_rename_at_59,8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_49bdd408ef1e4c5a ( Context * __context__, TArray<char *> &  __Arr_rename_at_75, char * const  __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<char *>>::pass(__Arr_rename_at_75),8,__context__),__context__),__value_rename_at_75);
+}
+
+inline char * const  _Funcstrings_boost_0x60_join_328e4c419218aea ( Context * __context__, TArray<char *> const  &  __it_rename_at_17, char * const  __separator_rename_at_17 )
+{
+	char * __st_rename_at_22 = ((char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_22)->void{
+		bool __skip_first_rename_at_23 = true;
+		{
+			uint64_t __loop_count_24 = UINT64_MAX;
+			// elem : string const&
+			das_iterator<TArray<char *> const > __elem_iterator(__it_rename_at_17);
+			char * const  * __elem_rename_at_24;
+			__loop_count_24 = das_loop_count(__loop_count_24,__elem_iterator.loop_begin(__context__,(__elem_rename_at_24)));
+			for ( ; __loop_count_24 ; --__loop_count_24, ++__elem_rename_at_24 )
+			{
+				if ( __skip_first_rename_at_23 )
+				{
+					das_copy(__skip_first_rename_at_23,false);
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_4,cast<StringBuilderWriter &>::from(__writer_rename_at_22),cast<char * const >::from(__separator_rename_at_17)));
+				};
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_5,cast<StringBuilderWriter &>::from(__writer_rename_at_22),cast<char * const >::from((*__elem_rename_at_24))));
+			}
+			__elem_iterator.loop_end(__context__,(__elem_rename_at_24));
+		};
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))));
+	return das_auto_cast<char * const >::cast(__st_rename_at_22);
+}
+
+inline void _Funcbuiltin_0x60_reserve_a0d71b661f152abb ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_59, int32_t __newSize_rename_at_59 )
+{
+	builtin_array_reserve(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_59),__newSize_rename_at_59,4,__context__);
+}
+
+inline TArray<int32_t> & _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd ( Context * __context__, TArray<int32_t> &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_6,cast<TArray<int32_t> &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<TArray<int32_t> &>::cast(__a_rename_at_42);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_53efa21008623dcb ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_21, Lambda DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_21 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_Funcfunctional_0x60_filter_any_bf7ad1100736e66e(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_21),__blk_rename_at_21));
+}
+
+inline TArray<char *> _Func_0x60_map_a_bcf63cf0ecad999 ( Context * __context__, TArray<int32_t> const  &  __src_rename_at_11, Block DAS_COMMENT((char *,int32_t)) const  &  __blk_rename_at_11 )
+{
+	TArray<char *> __a_rename_at_12; das_zero(__a_rename_at_12);
+	_Funcbuiltin_0x60_reserve_cecea833d1e66117(__context__,das_arg<TArray<char *>>::pass(__a_rename_at_12),builtin_array_size(__src_rename_at_11));
+	{
+		uint64_t __loop_count_14 = UINT64_MAX;
+		// x : int aka TT const&
+		das_iterator<TArray<int32_t> const > __x_iterator(__src_rename_at_11);
+		int32_t const  * __x_rename_at_14;
+		__loop_count_14 = das_loop_count(__loop_count_14,__x_iterator.loop_begin(__context__,(__x_rename_at_14)));
+		for ( ; __loop_count_14 ; --__loop_count_14, ++__x_rename_at_14 )
+		{
+			_Funcbuiltin_0x60_push_49bdd408ef1e4c5a(__context__,das_arg<TArray<char *>>::pass(__a_rename_at_12),das_invoke<char *>::invoke<int32_t>(__context__,nullptr,__blk_rename_at_11,(*__x_rename_at_14)));
+		}
+		__x_iterator.loop_end(__context__,(__x_rename_at_14));
+	};
+	return /* <- */ das_auto_cast_move<TArray<char *>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465(__context__,das_arg<TArray<char *>>::pass(__a_rename_at_12)));
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_293 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_293),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_75, int32_t __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_75),4,__context__),__context__),__value_rename_at_75);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_5cbab1dfe9635bc1 ( Context * __context__, range __rng_rename_at_345 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_346; das_zero(__it_rename_at_346);
+	builtin_make_range_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_346),__rng_rename_at_345,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_346);
+}
+
+inline TArray<int32_t> _Func_0x60_filter_a_9be3f924e0b51d1e ( Context * __context__, TArray<int32_t> const  &  __src_rename_at_18, Block DAS_COMMENT((bool,int32_t)) const  &  __blk_rename_at_18 )
+{
+	TArray<int32_t> __a_rename_at_19; das_zero(__a_rename_at_19);
+	{
+		uint64_t __loop_count_20 = UINT64_MAX;
+		// x : int aka TT const&
+		das_iterator<TArray<int32_t> const > __x_iterator(__src_rename_at_18);
+		int32_t const  * __x_rename_at_20;
+		__loop_count_20 = das_loop_count(__loop_count_20,__x_iterator.loop_begin(__context__,(__x_rename_at_20)));
+		for ( ; __loop_count_20 ; --__loop_count_20, ++__x_rename_at_20 )
+		{
+			if ( das_invoke<bool>::invoke<int32_t>(__context__,nullptr,__blk_rename_at_18,(*__x_rename_at_20)) )
+			{
+				_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_19),(*__x_rename_at_20));
+			};
+		}
+		__x_iterator.loop_end(__context__,(__x_rename_at_20));
+	};
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_19)));
+}
+
+inline TArray<int32_t> each_a_4fe169153722e59b ( Context * __context__, range __r_rename_at_4 )
+{
+	TArray<int32_t> __a_rename_at_5; das_zero(__a_rename_at_5);
+	_Funcbuiltin_0x60_reserve_a0d71b661f152abb(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_5),v_extract_yi(v_cast_vec4i(__r_rename_at_4)) /*y*/ - v_extract_xi(v_cast_vec4i(__r_rename_at_4)) /*x*/);
+	{
+		uint64_t __loop_count_7 = UINT64_MAX;
+		// x : int const
+		das_iterator<range> __x_iterator(__r_rename_at_4);
+		int32_t __x_rename_at_7;
+		__loop_count_7 = das_loop_count(__loop_count_7,__x_iterator.loop_begin(__context__,(__x_rename_at_7)));
+		for ( ; __loop_count_7 ; --__loop_count_7, ++__x_rename_at_7 )
+		{
+			_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_5),__x_rename_at_7);
+		}
+		__x_iterator.loop_end(__context__,(__x_rename_at_7));
+	};
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_5)));
+}
+
+inline char * const  testGen_772ee263caac86e4 ( Context * __context__, int32_t __total_rename_at_25, int32_t __mod_rename_at_25 )
+{
+	Sequence DAS_COMMENT((char *)) _temp_make_local_29_32;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_28_48;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_27_64;
+	return das_auto_cast<char * const >::cast(_Funcstrings_boost_0x60_join_262ae9de156365d6(__context__,das_arg<Sequence DAS_COMMENT((char *))>::pass((_temp_make_local_29_32 = (_Funcfunctional_0x60_map_666fc21f82f70a9(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_28_48 = (_Funcfunctional_0x60_filter_53efa21008623dcb(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_27_64 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,mk_range(__total_rename_at_25))))),das_ascend<bool,_lambda_thismodule_28_25_1>::make(__context__,&__type_info__fa39fefc55c220e2,(([&]() -> _lambda_thismodule_28_25_1 {
+		_lambda_thismodule_28_25_1 __mks_28;
+		das_copy((__mks_28.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_28_25_1`function XS<::_lambda_thismodule_28_25_1> Ci*/ 15485030111057778678u))));
+		das_copy((__mks_28.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_28_25_1`finalizer X1<S<::_lambda_thismodule_28_25_1>>?*/ 16132596691056323664u))));
+		das_copy((__mks_28.mod),(__mod_rename_at_25));
+		return __mks_28;
+	})())))))),das_ascend<char *,_lambda_thismodule_29_22_3>::make(__context__,&__type_info__1185f2bcb2a62aa0,(([&]() -> _lambda_thismodule_29_22_3 {
+		_lambda_thismodule_29_22_3 __mks_29;
+		das_copy((__mks_29.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_29_22_3`function XS<::_lambda_thismodule_29_22_3> Ci*/ 9341894630103337874u))));
+		das_copy((__mks_29.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_29_22_3`finalizer X1<S<::_lambda_thismodule_29_22_3>>?*/ 12506113292205269920u))));
+		return __mks_29;
+	})())))))),((char *) ",")));
+}
+
+inline char * const  testArr_828c0b16f9933b48 ( Context * __context__, int32_t __total_rename_at_33, int32_t __mod_rename_at_33 ) { das_stack_prologue __prologue(__context__,256,"testArr " DAS_FILE_LINE);
+{
+	TArray<int32_t> __a1_rename_at_34; memset(&__a1_rename_at_34,0,sizeof(__a1_rename_at_34));
+	TArray<int32_t> __a2_rename_at_35; memset(&__a2_rename_at_35,0,sizeof(__a2_rename_at_35));
+	TArray<char *> __a3_rename_at_36; memset(&__a3_rename_at_36,0,sizeof(__a3_rename_at_36));
+/* finally */ auto __finally_34= das_finally([&](){
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__a1_rename_at_34));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__a2_rename_at_35));
+	_Funcbuiltin_0x60_finalize_acced84d6d724f6e(__context__,das_arg<TArray<char *>>::pass(__a3_rename_at_36));
+/* end finally */ });
+	__a1_rename_at_34; das_zero(__a1_rename_at_34); das_move(__a1_rename_at_34, each_a_4fe169153722e59b(__context__,mk_range(__total_rename_at_33)));
+	__a2_rename_at_35; das_zero(__a2_rename_at_35); das_move(__a2_rename_at_35, _Func_0x60_filter_a_9be3f924e0b51d1e(__context__,das_arg<TArray<int32_t>>::pass(__a1_rename_at_34),das_make_block<bool,int32_t>(__context__,144,0,&__func_info__855d89348d068c20,[&](int32_t const  __x_rename_at_35)->bool{
+		return das_auto_cast<bool>::cast((SimPolicy<int32_t>::Mod(__x_rename_at_35,__mod_rename_at_33,*__context__,nullptr)) == 0);
+	})));
+	__a3_rename_at_36; das_zero(__a3_rename_at_36); das_move(__a3_rename_at_36, _Func_0x60_map_a_bcf63cf0ecad999(__context__,das_arg<TArray<int32_t>>::pass(__a2_rename_at_35),das_make_block<char *,int32_t>(__context__,240,0,&__func_info__89cfdd27951bb6cd,[&](int32_t const  __x_rename_at_36)->char *{
+		return das_auto_cast<char *>::cast(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_7, cast<int32_t>::from(__x_rename_at_36))));
+	})));
+	return das_auto_cast<char * const >::cast(_Funcstrings_boost_0x60_join_328e4c419218aea(__context__,das_arg<TArray<char *>>::pass(__a3_rename_at_36),((char *) ",")));
+}}
+
+inline char * const  testLoop_544fa5f25840a6fb ( Context * __context__, int32_t __total_rename_at_43, int32_t __mod_rename_at_43 )
+{
+	char * __st_rename_at_44 = ((char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_44)->void{
+		bool __skip_first_rename_at_45 = true;
+		{
+			uint64_t __loop_count_46 = UINT64_MAX;
+			// t : int const
+			das_iterator<range> __t_iterator(mk_range(__total_rename_at_43));
+			int32_t __t_rename_at_46;
+			__loop_count_46 = das_loop_count(__loop_count_46,__t_iterator.loop_begin(__context__,(__t_rename_at_46)));
+			for ( ; __loop_count_46 ; --__loop_count_46, ++__t_rename_at_46 )
+			{
+				if ( (SimPolicy<int32_t>::Mod(__t_rename_at_46,__mod_rename_at_43,*__context__,nullptr)) == 0 )
+				{
+					if ( __skip_first_rename_at_45 )
+					{
+						das_copy(__skip_first_rename_at_45,false);
+					} else {
+						das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_8,cast<StringBuilderWriter &>::from(__writer_rename_at_44),cast<char * const >::from(((char *) ","))));
+					};
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_9,cast<StringBuilderWriter &>::from(__writer_rename_at_44),cast<char *>::from(((char *)(das_lexical_cast(__t_rename_at_46,__context__))))));
+				};
+			}
+			__t_iterator.loop_end(__context__,(__t_rename_at_46));
+		};
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))));
+	return das_auto_cast<char * const >::cast(__st_rename_at_44);
+}
+
+inline bool test_fd9f86b0061ed961 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,224,"test " DAS_FILE_LINE);
+{
+	char * __s1_rename_at_57 = 0; char * __s2_rename_at_57 = 0; char * __s3_rename_at_57 = 0;
+	builtin_profile(40,((char *) "testLoop"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		das_copy(__s1_rename_at_57,testLoop_544fa5f25840a6fb(__context__,1000000,99961));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	builtin_profile(40,((char *) "testGen"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		das_copy(__s2_rename_at_57,testGen_772ee263caac86e4(__context__,1000000,99961));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	builtin_profile(40,((char *) "testArr"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		das_copy(__s3_rename_at_57,testArr_828c0b16f9933b48(__context__,1000000,99961));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	DAS_ASSERT((((SimPolicy<char *>::Equ(cast<char *>::from(__s1_rename_at_57),cast<char *>::from(__s2_rename_at_57),*__context__,nullptr)) && (SimPolicy<char *>::Equ(cast<char *>::from(__s1_rename_at_57),cast<char *>::from(__s3_rename_at_57),*__context__,nullptr))) && (SimPolicy<char *>::Equ(cast<char *>::from(__s2_rename_at_57),cast<char *>::from(__s3_rename_at_57),*__context__,nullptr))));
+	return das_auto_cast<bool>::cast(true);
+}}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcstrings_boost_0x60_join_262ae9de156365d6
+	aotLib[0x8d622e6568322085] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, Sequence DAS_COMMENT((char *)) const  & , char * const   ),&_Funcstrings_boost_0x60_join_262ae9de156365d6>>();
+	};
+	// finalize_3ae5956d14f74a8d
+	aotLib[0x18054d6d2135ca61] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_32_12_4 &  ),&finalize_3ae5956d14f74a8d>>();
+	};
+	// _Funcbuiltin_0x60_each_db0bdc14e7307b74
+	aotLib[0x4132eb46c67cce29] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((char *)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,char * &)) const   ),&_Funcbuiltin_0x60_each_db0bdc14e7307b74>>();
+	};
+	// _Func_lambda_thismodule_32_12_4_0x60_function_73c158cdee2524bf
+	aotLib[0x4d381e112f7e5ed1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_32_12_4 & , char * &  ),&_Func_lambda_thismodule_32_12_4_0x60_function_73c158cdee2524bf>>();
+	};
+	// _Func_lambda_thismodule_32_12_4_0x60_finalizer_3baac9d51a4712bc
+	aotLib[0xad5940d5e99b49a4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_32_12_4 *  ),&_Func_lambda_thismodule_32_12_4_0x60_finalizer_3baac9d51a4712bc>>();
+	};
+	// finalize_10db6b44f394cc3b
+	aotLib[0xae52970a38581305] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_29_22_3 &  ),&finalize_10db6b44f394cc3b>>();
+	};
+	// _Func_lambda_thismodule_29_22_3_0x60_function_604fe7856e746c7a
+	aotLib[0x6cf93ccc97723ed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, _lambda_thismodule_29_22_3 & , int32_t  ),&_Func_lambda_thismodule_29_22_3_0x60_function_604fe7856e746c7a>>();
+	};
+	// _Func_lambda_thismodule_29_22_3_0x60_finalizer_fa12d335c2f857aa
+	aotLib[0xe6ab9acf20ac8571] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_29_22_3 *  ),&_Func_lambda_thismodule_29_22_3_0x60_finalizer_fa12d335c2f857aa>>();
+	};
+	// _Funcfunctional_0x60_map_any_9094e8e650017d54
+	aotLib[0x8e327f6e78913155] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((char *)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((char *,int32_t))  ),&_Funcfunctional_0x60_map_any_9094e8e650017d54>>();
+	};
+	// _Funcfunctional_0x60_map_666fc21f82f70a9
+	aotLib[0x6e9f53bc73ebe6ad] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((char *)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((char *,int32_t)) const   ),&_Funcfunctional_0x60_map_666fc21f82f70a9>>();
+	};
+	// finalize_46aff3c3dd520d17
+	aotLib[0x3c0ab0b64a7b1fa1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_10_12_2 &  ),&finalize_46aff3c3dd520d17>>();
+	};
+	// _Funcbuiltin_0x60_each_e03cdb990e3d5374
+	aotLib[0x3f75f25a171c3185] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const   ),&_Funcbuiltin_0x60_each_e03cdb990e3d5374>>();
+	};
+	// _Func_lambda_thismodule_10_12_2_0x60_function_a0aa9899188881e
+	aotLib[0x30c2e4d922f26931] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_10_12_2 & , int32_t &  ),&_Func_lambda_thismodule_10_12_2_0x60_function_a0aa9899188881e>>();
+	};
+	// _Func_lambda_thismodule_10_12_2_0x60_finalizer_e19b7703ff50c0a4
+	aotLib[0x10fcde4068b9d18b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_10_12_2 *  ),&_Func_lambda_thismodule_10_12_2_0x60_finalizer_e19b7703ff50c0a4>>();
+	};
+	// finalize_9f34814985861fc9
+	aotLib[0xb4f1b2d7126cc715] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_28_25_1 &  ),&finalize_9f34814985861fc9>>();
+	};
+	// _Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465
+	aotLib[0xed99ea3c3e04d451] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TArray<char *> & (*) ( Context * __context__, TArray<char *> &  ),&_Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465>>();
+	};
+	// _Func_lambda_thismodule_28_25_1_0x60_function_e9c416046d0a9a05
+	aotLib[0x51930ab76c3d8ae5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_28_25_1 & , int32_t  ),&_Func_lambda_thismodule_28_25_1_0x60_function_e9c416046d0a9a05>>();
+	};
+	// _Func_lambda_thismodule_28_25_1_0x60_finalizer_eadc327160433522
+	aotLib[0x525c82f8c7c1db1b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_28_25_1 *  ),&_Func_lambda_thismodule_28_25_1_0x60_finalizer_eadc327160433522>>();
+	};
+	// _Funcbuiltin_0x60_finalize_acced84d6d724f6e
+	aotLib[0x8e77180c055acda1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&_Funcbuiltin_0x60_finalize_acced84d6d724f6e>>();
+	};
+	// _Funcfunctional_0x60_filter_any_bf7ad1100736e66e
+	aotLib[0x961049c37c134b39] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((bool,int32_t))  ),&_Funcfunctional_0x60_filter_any_bf7ad1100736e66e>>();
+	};
+	// _Funcbuiltin_0x60_reserve_cecea833d1e66117
+	aotLib[0x58482c2f23d3c0ed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t  ),&_Funcbuiltin_0x60_reserve_cecea833d1e66117>>();
+	};
+	// _Funcbuiltin_0x60_push_49bdd408ef1e4c5a
+	aotLib[0xb187be2de84ea8d9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , char * const   ),&_Funcbuiltin_0x60_push_49bdd408ef1e4c5a>>();
+	};
+	// _Funcstrings_boost_0x60_join_328e4c419218aea
+	aotLib[0x353a709d2d8c90fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, TArray<char *> const  & , char * const   ),&_Funcstrings_boost_0x60_join_328e4c419218aea>>();
+	};
+	// _Funcbuiltin_0x60_reserve_a0d71b661f152abb
+	aotLib[0xe761f57d94ab3d39] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_reserve_a0d71b661f152abb>>();
+	};
+	// _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd
+	aotLib[0x66e322246598e835] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TArray<int32_t> & (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd>>();
+	};
+	// _Funcfunctional_0x60_filter_53efa21008623dcb
+	aotLib[0xb7341523b4bd811e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((bool,int32_t)) const   ),&_Funcfunctional_0x60_filter_53efa21008623dcb>>();
+	};
+	// _Func_0x60_map_a_bcf63cf0ecad999
+	aotLib[0xbb7c6f972c5d7a59] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, TArray<int32_t> const  & , Block DAS_COMMENT((char *,int32_t)) const  &  ),&_Func_0x60_map_a_bcf63cf0ecad999>>();
+	};
+	// _Funcbuiltin_0x60_finalize_c5f896860856389a
+	aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+	// _Funcbuiltin_0x60_push_d21751720b4df10e
+	aotLib[0x9fb5b63c22625999] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_d21751720b4df10e>>();
+	};
+	// _Funcbuiltin_0x60_each_5cbab1dfe9635bc1
+	aotLib[0x8c2bf3089ff8b6f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, range  ),&_Funcbuiltin_0x60_each_5cbab1dfe9635bc1>>();
+	};
+	// _Func_0x60_filter_a_9be3f924e0b51d1e
+	aotLib[0xbf069bd4e2b8d29] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TArray<int32_t> const  & , Block DAS_COMMENT((bool,int32_t)) const  &  ),&_Func_0x60_filter_a_9be3f924e0b51d1e>>();
+	};
+	// each_a_4fe169153722e59b
+	aotLib[0x6486eaa9bd01a598] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, range  ),&each_a_4fe169153722e59b>>();
+	};
+	// testGen_772ee263caac86e4
+	aotLib[0x4f724a7dba098ebd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, int32_t , int32_t  ),&testGen_772ee263caac86e4>>();
+	};
+	// testArr_828c0b16f9933b48
+	aotLib[0xdb024c87111d9f87] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, int32_t , int32_t  ),&testArr_828c0b16f9933b48>>();
+	};
+	// testLoop_544fa5f25840a6fb
+	aotLib[0x8faa8b6aa96bab99] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, int32_t , int32_t  ),&testLoop_544fa5f25840a6fb>>();
+	};
+	// test_fd9f86b0061ed961
+	aotLib[0xc8cbf18eef45c572] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_fd9f86b0061ed961>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
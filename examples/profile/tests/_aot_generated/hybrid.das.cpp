@@ -0,0 +1,118 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require testProfile
+#include "test_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_17459273016228813276 {
+
+extern TypeInfo __type_info__af63eb4c86020609;
+extern FuncInfo __func_info__eeb3b74c98cb09c3;
+
+FuncInfo __func_info__eeb3b74c98cb09c3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,0xeeb3b74c98cb09c3ul, 0x0 };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, 0xaf63eb4c86020609ul };
+
+
+inline int32_t _Func_0x60_fibR_322b28e409620a2f ( Context * __context__, int32_t __n_rename_at_6 );
+inline int32_t _Func_0x60_fibRH_a45ebba1b7723d23 ( Context * __context__, int32_t __n_rename_at_18 );
+inline bool test_8b1f055b5f1178ae ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline int32_t _Func_0x60_fibR_322b28e409620a2f ( Context * __context__, int32_t __n_rename_at_6 )
+{
+	return das_auto_cast<int32_t>::cast((__n_rename_at_6 < 2) ? das_auto_cast<int32_t>::cast(__n_rename_at_6) : das_auto_cast<int32_t>::cast((_Func_0x60_fibR_322b28e409620a2f(__context__,__n_rename_at_6 - 1) + _Func_0x60_fibR_322b28e409620a2f(__context__,__n_rename_at_6 - 2))));
+}
+
+inline int32_t _Func_0x60_fibRH_a45ebba1b7723d23 ( Context * __context__, int32_t __n_rename_at_18 )
+{
+	return das_auto_cast<int32_t>::cast((__n_rename_at_18 < 2) ? das_auto_cast<int32_t>::cast(__n_rename_at_18) : das_auto_cast<int32_t>::cast((das_invoke_function<int32_t>::invoke<int32_t>(__context__,nullptr,Func(__context__->fnByMangledName(/*`fibRH CXi*/ 1220155175994539032u)),__n_rename_at_18 - 1) + das_invoke_function<int32_t>::invoke<int32_t>(__context__,nullptr,Func(__context__->fnByMangledName(/*`fibRH CXi*/ 1220155175994539032u)),__n_rename_at_18 - 2))));
+}
+
+inline bool test_8b1f055b5f1178ae ( Context * __context__ ) { das_stack_prologue __prologue(__context__,224,"test " DAS_FILE_LINE);
+{
+	int32_t __f1_rename_at_25 = 0;
+	builtin_profile(20,((char *) "fibbonacci recursive"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		das_copy(__f1_rename_at_25,_Func_0x60_fibR_322b28e409620a2f(__context__,31));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	DAS_ASSERT((__f1_rename_at_25 == 1346269));
+	int32_t __f2_rename_at_29 = 0;
+	builtin_profile(20,((char *) "fibbonacci recursive, no aot"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		das_copy(__f2_rename_at_29,das_invoke_function<int32_t>::invoke<int32_t>(__context__,nullptr,Func(__context__->fnByMangledName(/*`fibRNA CXi*/ 14953100796754132517u)),31));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	DAS_ASSERT((__f2_rename_at_29 == 1346269));
+	int32_t __f3_rename_at_33 = 0;
+	builtin_profile(20,((char *) "fibbonacci recursive, hybrid"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		das_copy(__f3_rename_at_33,das_invoke_function<int32_t>::invoke<int32_t>(__context__,nullptr,Func(__context__->fnByMangledName(/*`fibRH CXi*/ 1220155175994539032u)),31));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	DAS_ASSERT((__f3_rename_at_33 == 1346269));
+	return das_auto_cast<bool>::cast(true);
+}}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Func_0x60_fibR_322b28e409620a2f
+	aotLib[0x76205f46766150b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&_Func_0x60_fibR_322b28e409620a2f>>();
+	};
+	// _Func_0x60_fibRH_a45ebba1b7723d23
+	aotLib[0x6d69f06e9d891911] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&_Func_0x60_fibRH_a45ebba1b7723d23>>();
+	};
+	// test_8b1f055b5f1178ae
+	aotLib[0x81220210510cf999] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_8b1f055b5f1178ae>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
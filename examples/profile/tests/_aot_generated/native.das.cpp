@@ -0,0 +1,111 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require testProfile
+#include "test_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_17543737203971637577 {
+
+extern TypeInfo __type_info__af63eb4c86020609;
+extern FuncInfo __func_info__eeb3b74c98cb09c3;
+
+FuncInfo __func_info__eeb3b74c98cb09c3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,0xeeb3b74c98cb09c3ul, 0x0 };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, 0xaf63eb4c86020609ul };
+
+
+inline int32_t testAdds_4a5a24edb5082e4b ( Context * __context__ );
+inline bool test_efcbbd84b1d88a55 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline int32_t testAdds_4a5a24edb5082e4b ( Context * __context__ )
+{
+	int32_t __count_rename_at_7 = 0;
+	{
+		uint64_t __loop_count_8 = UINT64_MAX;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,10000000));
+		int32_t __i_rename_at_8;
+		__loop_count_8 = das_loop_count(__loop_count_8,__i_iterator.loop_begin(__context__,(__i_rename_at_8)));
+		for ( ; __loop_count_8 ; --__loop_count_8, ++__i_rename_at_8 )
+		{
+			das_copy(__count_rename_at_7,AddOne(__count_rename_at_7));
+		}
+		__i_iterator.loop_end(__context__,(__i_rename_at_8));
+	};
+	return das_auto_cast<int32_t>::cast(__count_rename_at_7);
+}
+
+inline bool test_efcbbd84b1d88a55 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,96,"test " DAS_FILE_LINE);
+{
+	int32_t __count_rename_at_14 = 0;
+	builtin_profile(20,((char *) "native loop"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		das_copy(__count_rename_at_14,testAdds_4a5a24edb5082e4b(__context__));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	DAS_ASSERT((__count_rename_at_14 == 10000000));
+	return das_auto_cast<bool>::cast(true);
+}}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// testAdds_4a5a24edb5082e4b
+	aotLib[0xf7ea82e4edec2bdd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__ ),&testAdds_4a5a24edb5082e4b>>();
+	};
+	// test_efcbbd84b1d88a55
+	aotLib[0x66cb2c7c7af1f3fa] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_efcbbd84b1d88a55>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,281 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require testProfile
+#include "test_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_10309913398385813076 {
+
+extern TypeInfo __type_info__af63eb4c86020609;
+extern FuncInfo __func_info__eeb3b74c98cb09c3;
+
+FuncInfo __func_info__eeb3b74c98cb09c3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,0xeeb3b74c98cb09c3ul, 0x0 };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, 0xaf63eb4c86020609ul };
+
+namespace  { struct body; };
+namespace  {
+
+struct body {
+	float3 x;
+	float pad;
+	float3 v;
+	float mass;
+};
+static_assert(sizeof(body)==32,"structure size mismatch with DAS");
+static_assert(offsetof(body,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(body,pad)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(body,v)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(body,mass)==28,"structure field offset mismatch with DAS");
+}
+
+inline void _Func_0x60_scale_bodies_c91ec0cc6a44519d ( Context * __context__, float __scale_rename_at_78, TDim<body,5> & __bodies_rename_at_78 );
+inline void _Func_0x60_nbodies_2f62ae8d48651733 ( Context * __context__, int32_t __n_rename_at_83 );
+inline void offset_momentum_8e2f0c553330a2fa ( Context * __context__, TDim<body,5> & __bodies_rename_at_42 );
+inline void advance_f568d6c9e0494832 ( Context * __context__, TDim<body,5> & __bodies_rename_at_48 );
+inline float energy_923d1b2c15ea1926 ( Context * __context__, TDim<body,5> & __bodies_rename_at_61 );
+inline bool test_886397f56b4cd8a ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<TDim<body,5>,0xb4a35b540d9dd21f>(__context__) = (([&]() -> TDim<body,5> {
+		TDim<body,5> __mks_19;
+		das_zero(__mks_19);
+		das_copy((__mks_19(0,__context__).x),(v_zero()));
+		das_copy((__mks_19(0,__context__).v),(v_zero()));
+		das_copy((__mks_19(0,__context__).mass),(39.4784203f));
+		das_copy((__mks_19(1,__context__).x),(v_make_vec4f(4.84143162f,-1.16032004f,-0.103622042f,0.f)));
+		das_copy((__mks_19(1,__context__).v),(v_make_vec4f(0.606326401f,2.81198692f,-0.0252183601f,0.f)));
+		das_copy((__mks_19(1,__context__).mass),(0.0376936793f));
+		das_copy((__mks_19(2,__context__).x),(v_make_vec4f(8.34336662f,4.12479877f,-0.403523415f,0.f)));
+		das_copy((__mks_19(2,__context__).v),(v_make_vec4f(-1.01077425f,1.82566226f,0.0084157614f,0.f)));
+		das_copy((__mks_19(2,__context__).mass),(0.0112863267f));
+		das_copy((__mks_19(3,__context__).x),(v_make_vec4f(12.8943691f,-15.1111517f,-0.22330758f,0.f)));
+		das_copy((__mks_19(3,__context__).v),(v_make_vec4f(1.08279097f,0.868712962f,-0.0108326375f,0.f)));
+		das_copy((__mks_19(3,__context__).mass),(0.00172372418f));
+		das_copy((__mks_19(4,__context__).x),(v_make_vec4f(15.3796968f,-25.9193153f,0.179258779f,0.f)));
+		das_copy((__mks_19(4,__context__).v),(v_make_vec4f(0.979090691f,0.594698966f,-0.0347559527f,0.f)));
+		das_copy((__mks_19(4,__context__).mass),(0.00203368696f));
+		return __mks_19;
+	})());/*g_bodies*/
+}
+
+inline void _Func_0x60_scale_bodies_c91ec0cc6a44519d ( Context * __context__, float __scale_rename_at_78, TDim<body,5> &  __bodies_rename_at_78 )
+{
+	{
+		uint64_t __loop_count_79 = UINT64_MAX;
+		// b : body& -const
+		das_iterator<TDim<body,5>> __b_iterator(__bodies_rename_at_78);
+		body * __b_rename_at_79;
+		__loop_count_79 = das_loop_count(__loop_count_79,__b_iterator.loop_begin(__context__,(__b_rename_at_79)));
+		for ( ; __loop_count_79 ; --__loop_count_79, ++__b_rename_at_79 )
+		{
+			(*__b_rename_at_79).mass *= (__scale_rename_at_78 * __scale_rename_at_78);
+			SimPolicy<float3>::SetMulScal((char *)&((*__b_rename_at_79).v),cast<float>::from(__scale_rename_at_78),*__context__,nullptr);
+		}
+		__b_iterator.loop_end(__context__,(__b_rename_at_79));
+	};
+}
+
+inline void _Func_0x60_nbodies_2f62ae8d48651733 ( Context * __context__, int32_t __n_rename_at_83 )
+{
+	_Func_0x60_scale_bodies_c91ec0cc6a44519d(__context__,0.00999999978f,das_arg<TDim<body,5>>::pass(das_global<TDim<body,5>,0xb4a35b540d9dd21f>(__context__) /*g_bodies*/));
+	{
+		uint64_t __loop_count_85 = UINT64_MAX;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__n_rename_at_83));
+		int32_t __i_rename_at_85;
+		__loop_count_85 = das_loop_count(__loop_count_85,__i_iterator.loop_begin(__context__,(__i_rename_at_85)));
+		for ( ; __loop_count_85 ; --__loop_count_85, ++__i_rename_at_85 )
+		{
+			advance_f568d6c9e0494832(__context__,das_arg<TDim<body,5>>::pass(das_global<TDim<body,5>,0xb4a35b540d9dd21f>(__context__) /*g_bodies*/));
+		}
+		__i_iterator.loop_end(__context__,(__i_rename_at_85));
+	};
+	_Func_0x60_scale_bodies_c91ec0cc6a44519d(__context__,100.f,das_arg<TDim<body,5>>::pass(das_global<TDim<body,5>,0xb4a35b540d9dd21f>(__context__) /*g_bodies*/));
+}
+
+inline void offset_momentum_8e2f0c553330a2fa ( Context * __context__, TDim<body,5> &  __bodies_rename_at_42 )
+{
+	float3 __px_rename_at_43 = v_zero();
+	{
+		uint64_t __loop_count_44 = UINT64_MAX;
+		// b : body& -const
+		das_iterator<TDim<body,5>> __b_iterator(__bodies_rename_at_42);
+		body * __b_rename_at_44;
+		__loop_count_44 = das_loop_count(__loop_count_44,__b_iterator.loop_begin(__context__,(__b_rename_at_44)));
+		for ( ; __loop_count_44 ; --__loop_count_44, ++__b_rename_at_44 )
+		{
+			SimPolicy<float3>::SetSub((char *)&(__px_rename_at_43),(SimPolicy<float3>::MulVecScal((*__b_rename_at_44).v,cast<float>::from((*__b_rename_at_44).mass),*__context__,nullptr)),*__context__,nullptr);
+		}
+		__b_iterator.loop_end(__context__,(__b_rename_at_44));
+	};
+	das_copy(__bodies_rename_at_42(0,__context__).v,SimPolicy<float3>::DivVecScal(__px_rename_at_43,cast<float>::from(39.4784203f),*__context__,nullptr));
+}
+
+inline void advance_f568d6c9e0494832 ( Context * __context__, TDim<body,5> &  __bodies_rename_at_48 )
+{
+	int32_t __i_rename_at_49 = 0;
+	{
+		uint64_t __loop_count_50 = UINT64_MAX;
+		// b : body& -const
+		das_iterator<TDim<body,5>> __b_iterator(__bodies_rename_at_48);
+		body * __b_rename_at_50;
+		__loop_count_50 = das_loop_count(__loop_count_50,__b_iterator.loop_begin(__context__,(__b_rename_at_50)));
+		for ( ; __loop_count_50 ; --__loop_count_50, ++__b_rename_at_50 )
+		{
+			++__i_rename_at_49;
+			{
+				uint64_t __loop_count_52 = UINT64_MAX;
+				// j : int const
+				das_iterator<range> __j_iterator(range(__i_rename_at_49,5));
+				int32_t __j_rename_at_52;
+				__loop_count_52 = das_loop_count(__loop_count_52,__j_iterator.loop_begin(__context__,(__j_rename_at_52)));
+				for ( ; __loop_count_52 ; --__loop_count_52, ++__j_rename_at_52 )
+				{
+					body * __b2_rename_at_53 = &(__bodies_rename_at_48(__j_rename_at_52,__context__));
+					float3 __dx_rename_at_54 = ((float3)(SimPolicy<float3>::Sub((*__b_rename_at_50).x,(*__b2_rename_at_53).x,*__context__,nullptr)));
+					float __inv_distance_rename_at_55 = ((float)invlength3(__dx_rename_at_54));
+					float __mag_rename_at_56 = ((float)((__inv_distance_rename_at_55 * __inv_distance_rename_at_55) * __inv_distance_rename_at_55));
+					SimPolicy<float3>::SetSub((char *)&((*__b_rename_at_50).v),(SimPolicy<float3>::MulVecScal(__dx_rename_at_54,cast<float>::from(((*__b2_rename_at_53).mass * __mag_rename_at_56)),*__context__,nullptr)),*__context__,nullptr);
+					SimPolicy<float3>::SetAdd((char *)&((*__b2_rename_at_53).v),(SimPolicy<float3>::MulVecScal(__dx_rename_at_54,cast<float>::from(((*__b_rename_at_50).mass * __mag_rename_at_56)),*__context__,nullptr)),*__context__,nullptr);
+				}
+				__j_iterator.loop_end(__context__,(__j_rename_at_52));
+			};
+			SimPolicy<float3>::SetAdd((char *)&((*__b_rename_at_50).x),(*__b_rename_at_50).v,*__context__,nullptr);
+		}
+		__b_iterator.loop_end(__context__,(__b_rename_at_50));
+	};
+}
+
+inline float energy_923d1b2c15ea1926 ( Context * __context__, TDim<body,5> &  __bodies_rename_at_61 )
+{
+	float __e_rename_at_62 = 0.f;
+	int32_t __i_rename_at_63 = 0;
+	{
+		uint64_t __loop_count_64 = UINT64_MAX;
+		// b : body& -const
+		das_iterator<TDim<body,5>> __b_iterator(__bodies_rename_at_61);
+		body * __b_rename_at_64;
+		__loop_count_64 = das_loop_count(__loop_count_64,__b_iterator.loop_begin(__context__,(__b_rename_at_64)));
+		for ( ; __loop_count_64 ; --__loop_count_64, ++__b_rename_at_64 )
+		{
+			__e_rename_at_62 += (((*__b_rename_at_64).mass * 0.5f) * lengthSq3((*__b_rename_at_64).v));
+			++__i_rename_at_63;
+			{
+				uint64_t __loop_count_67 = UINT64_MAX;
+				// j : int const
+				das_iterator<range> __j_iterator(range(__i_rename_at_63,5));
+				int32_t __j_rename_at_67;
+				__loop_count_67 = das_loop_count(__loop_count_67,__j_iterator.loop_begin(__context__,(__j_rename_at_67)));
+				for ( ; __loop_count_67 ; --__loop_count_67, ++__j_rename_at_67 )
+				{
+					body __b2_rename_at_68_ConstRef = ((body)__bodies_rename_at_61(__j_rename_at_67,__context__));
+	body const  & __b2_rename_at_68 = __b2_rename_at_68_ConstRef; ;
+					__e_rename_at_62 -= (SimPolicy<float>::Div(((*__b_rename_at_64).mass * __b2_rename_at_68.mass),distance3((*__b_rename_at_64).x,__b2_rename_at_68.x),*__context__,nullptr));
+				}
+				__j_iterator.loop_end(__context__,(__j_rename_at_67));
+			};
+		}
+		__b_iterator.loop_end(__context__,(__b_rename_at_64));
+	};
+	return das_auto_cast<float>::cast(__e_rename_at_62);
+}
+
+inline bool test_886397f56b4cd8a ( Context * __context__ ) { das_stack_prologue __prologue(__context__,128,"test " DAS_FILE_LINE);
+{
+	offset_momentum_8e2f0c553330a2fa(__context__,das_arg<TDim<body,5>>::pass(das_global<TDim<body,5>,0xb4a35b540d9dd21f>(__context__) /*g_bodies*/));
+	energy_923d1b2c15ea1926(__context__,das_arg<TDim<body,5>>::pass(das_global<TDim<body,5>,0xb4a35b540d9dd21f>(__context__) /*g_bodies*/));
+	builtin_profile(10,((char *) "n-bodies"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		_Func_0x60_nbodies_2f62ae8d48651733(__context__,500000);
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	energy_923d1b2c15ea1926(__context__,das_arg<TDim<body,5>>::pass(das_global<TDim<body,5>,0xb4a35b540d9dd21f>(__context__) /*g_bodies*/));
+	testNBodiesInit();
+	builtin_profile(10,((char *) "n-bodies, C++"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		testNBodiesS(500000);
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	return das_auto_cast<bool>::cast(true);
+}}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Func_0x60_scale_bodies_c91ec0cc6a44519d
+	aotLib[0x7e5c2721703553f1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, float , TDim<body,5> &  ),&_Func_0x60_scale_bodies_c91ec0cc6a44519d>>();
+	};
+	// _Func_0x60_nbodies_2f62ae8d48651733
+	aotLib[0xec56013f476f376f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t  ),&_Func_0x60_nbodies_2f62ae8d48651733>>();
+	};
+	// offset_momentum_8e2f0c553330a2fa
+	aotLib[0x5afbb13c8fb76f25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<body,5> &  ),&offset_momentum_8e2f0c553330a2fa>>();
+	};
+	// advance_f568d6c9e0494832
+	aotLib[0x2ac5c43f8049b471] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<body,5> &  ),&advance_f568d6c9e0494832>>();
+	};
+	// energy_923d1b2c15ea1926
+	aotLib[0x9dc731382a724799] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, TDim<body,5> &  ),&energy_923d1b2c15ea1926>>();
+	};
+	// test_886397f56b4cd8a
+	aotLib[0xd9199956eea33ae7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_886397f56b4cd8a>>();
+	};
+	// [[ init script ]]
+	aotLib[0x69b136c786abf656] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,456 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require testProfile
+#include "test_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_5165126114626795865 {
+
+extern StructInfo __struct_info__563922d142dbb679;
+extern TypeInfo __type_info__bbf987742fd774be;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern VarInfo __var_info__edcbf89b5a9f7a1c;
+extern VarInfo __var_info__6d5008e1bccfde17;
+extern VarInfo __var_info__79fc636cedc4158;
+extern VarInfo __var_info__6d4998d0bb94736e;
+extern VarInfo __var_info__851502129a08ab1c;
+extern FuncInfo __func_info__eeb3b74c98cb09c3;
+
+VarInfo __struct_info__563922d142dbb679_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0xedcbf89b5a9f7a1cul, "__rtti", 0 };
+TypeInfo * __type_info__6d5008e1bccfde17_arg_types_var_6213035443099514489[1] = { &__type_info__bbf987742fd774be };
+VarInfo __struct_info__563922d142dbb679_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__6d5008e1bccfde17_arg_types_var_6213035443099514489, nullptr, 1, 0, nullptr, 28, 8, 0x6d5008e1bccfde17ul, "__finalize", 8 };
+VarInfo __struct_info__563922d142dbb679_field_2 =  { Type::tFloat3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 12, 0x851502129a08ab1cul, "position", 16 };
+VarInfo __struct_info__563922d142dbb679_field_3 =  { Type::tFloat3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 12, 0x79fc636cedc4158ul, "velocity", 28 };
+TypeInfo * __type_info__6d4998d0bb94736e_arg_types_var_6213035443099514489[1] = { &__type_info__bbf987742fd774be };
+VarInfo __struct_info__563922d142dbb679_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__6d4998d0bb94736e_arg_types_var_6213035443099514489, nullptr, 1, 0, nullptr, 28, 8, 0x6d4998d0bb94736eul, "update", 40 };
+VarInfo * __struct_info__563922d142dbb679_fields[5] =  { &__struct_info__563922d142dbb679_field_0, &__struct_info__563922d142dbb679_field_1, &__struct_info__563922d142dbb679_field_2, &__struct_info__563922d142dbb679_field_3, &__struct_info__563922d142dbb679_field_4 };
+StructInfo __struct_info__563922d142dbb679 = {(char*)"CObject", (char*)"", 5, __struct_info__563922d142dbb679_fields, 5, 48, 0x0ul, nullptr, 0x563922d142dbb679ul };
+FuncInfo __func_info__eeb3b74c98cb09c3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,0xeeb3b74c98cb09c3ul, 0x0 };
+TypeInfo __type_info__bbf987742fd774be = { Type::tStructure, &__struct_info__563922d142dbb679, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8206, 48, 0xbbf987742fd774beul };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, 0xaf63eb4c86020609ul };
+
+namespace  { struct CObject; };
+namespace  { struct NObject; };
+namespace  {
+
+struct CObject {
+	void * __rtti;
+	Func DAS_COMMENT((void,CObject)) __finalize;
+	float3 position;
+	float3 velocity;
+	Func DAS_COMMENT((void,CObject)) update;
+};
+static_assert(sizeof(CObject)==48,"structure size mismatch with DAS");
+static_assert(offsetof(CObject,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(CObject,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(CObject,position)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(CObject,velocity)==28,"structure field offset mismatch with DAS");
+static_assert(offsetof(CObject,update)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct NObject {
+	float3 position;
+	float3 velocity;
+};
+static_assert(sizeof(NObject)==24,"structure size mismatch with DAS");
+static_assert(offsetof(NObject,position)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(NObject,velocity)==12,"structure field offset mismatch with DAS");
+}
+
+inline void finalize_265ddf665670d2db ( Context * __context__, CObject & ____this_rename_at_7 );
+inline void _Funcbuiltin_0x60_resize_a402e7bff6d16bfa ( Context * __context__, TArray<CObject> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60_resize_895b2ff719a60fbf ( Context * __context__, TArray<NObject> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline CObject CObject_a2186f52fb3050a2 ( Context * __context__, int32_t __i_rename_at_10 );
+inline void _FuncCObject_0x60_CObject_1f8956513c47f13d ( Context * __context__, CObject & __self_rename_at_10, int32_t __i_rename_at_10 );
+inline void _FuncCObject_0x60_update_2d4bfd5d2219350f ( Context * __context__, CObject & __self_rename_at_13 );
+inline void _FuncCObject_0x27___finalize_fd0d43fc7e281b5f ( Context * __context__, CObject & __self_rename_at_7 );
+inline void testVirtual_b1b4612cdd2d2d52 ( Context * __context__, TArray<CObject> & __objects_rename_at_16 );
+inline void testVirtual2_8c0e2948435097f3 ( Context * __context__, TArray<CObject> & __objects_rename_at_20, int32_t __count_rename_at_20 );
+inline void testMethod_c143f6bc965ff22c ( Context * __context__, TArray<CObject> & __objects_rename_at_24 );
+inline void testMethod2_f3296ad503cbfe01 ( Context * __context__, TArray<CObject> & __objects_rename_at_28, int32_t __count_rename_at_28 );
+inline void init_5b0f759928c70edb ( Context * __context__, TArray<CObject> & __objects_rename_at_32 );
+inline void update_72a908a54031d882 ( Context * __context__, NObject & __a_rename_at_43 );
+inline void testSim_168630652c40d9b6 ( Context * __context__, TArray<NObject> & __objects_rename_at_46 );
+inline void testSim2_223484789c727771 ( Context * __context__, TArray<NObject> & __objects_rename_at_50, int32_t __count_rename_at_50 );
+inline void testSimI_abb10b105e772cd9 ( Context * __context__, TArray<NObject> & __objects_rename_at_54 );
+inline void testSim2I_8e974b12830fffd5 ( Context * __context__, TArray<NObject> & __objects_rename_at_58, int32_t __count_rename_at_58 );
+inline void init_9089204b6ff6649b ( Context * __context__, TArray<NObject> & __objects_rename_at_62 );
+inline bool test_9f4fdc3bbfd7f50a ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void finalize_265ddf665670d2db ( Context * __context__, CObject &  ____this_rename_at_7 )
+{
+	memset(&(____this_rename_at_7), 0, 48);
+}
+
+inline void _Funcbuiltin_0x60_resize_a402e7bff6d16bfa ( Context * __context__, TArray<CObject> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<CObject>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,48,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_895b2ff719a60fbf ( Context * __context__, TArray<NObject> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<NObject>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,24,__context__);
+}
+
+inline CObject CObject_a2186f52fb3050a2 ( Context * __context__, int32_t __i_rename_at_10 )
+{
+	CObject __self_rename_at_10; das_zero(__self_rename_at_10); das_move(__self_rename_at_10, (([&]() -> CObject {
+		CObject __mks_10;
+		das_zero(__mks_10);
+		das_copy((__mks_10.__rtti),(((void *)(&__type_info__bbf987742fd774be))));
+		das_copy((__mks_10.__finalize),(Func(__context__->fnByMangledName(/*CObject'__finalize S<::CObject>*/ 2873120383404282433u))));
+		das_copy((__mks_10.update),(Func(__context__->fnByMangledName(/*CObject`update S<::CObject>*/ 17696716861512153777u))));
+		return __mks_10;
+	})()));
+	_FuncCObject_0x60_CObject_1f8956513c47f13d(__context__,das_arg<CObject>::pass(__self_rename_at_10),__i_rename_at_10);
+	return /* <- */ das_auto_cast_move<CObject>::cast(__self_rename_at_10);
+}
+
+inline void _FuncCObject_0x60_CObject_1f8956513c47f13d ( Context * __context__, CObject &  __self_rename_at_10, int32_t __i_rename_at_10 )
+{
+	das_copy(__self_rename_at_10.position,float3(__i_rename_at_10,__i_rename_at_10 + 1,__i_rename_at_10 + 2));
+	das_copy(__self_rename_at_10.velocity,v_make_vec4f(1.f,2.f,3.f,0.f));
+}
+
+inline void _FuncCObject_0x60_update_2d4bfd5d2219350f ( Context * __context__, CObject &  __self_rename_at_13 )
+{
+	SimPolicy<float3>::SetAdd((char *)&(__self_rename_at_13.position),__self_rename_at_13.velocity,*__context__,nullptr);
+}
+
+inline void _FuncCObject_0x27___finalize_fd0d43fc7e281b5f ( Context * __context__, CObject &  __self_rename_at_7 )
+{
+	finalize_265ddf665670d2db(__context__,das_arg<CObject>::pass(__self_rename_at_7));
+}
+
+inline void testVirtual_b1b4612cdd2d2d52 ( Context * __context__, TArray<CObject> &  __objects_rename_at_16 )
+{
+	{
+		uint64_t __loop_count_17 = UINT64_MAX;
+		// obj : CObject&
+		das_iterator<TArray<CObject>> __obj_iterator(__objects_rename_at_16);
+		CObject * __obj_rename_at_17;
+		__loop_count_17 = das_loop_count(__loop_count_17,__obj_iterator.loop_begin(__context__,(__obj_rename_at_17)));
+		for ( ; __loop_count_17 ; --__loop_count_17, ++__obj_rename_at_17 )
+		{
+			das_invoke_function<void>::invoke<CObject &>(__context__,nullptr,(*__obj_rename_at_17).update,das_arg<CObject>::pass(das_cast<CObject>::cast((*__obj_rename_at_17))));
+		}
+		__obj_iterator.loop_end(__context__,(__obj_rename_at_17));
+	};
+}
+
+inline void testVirtual2_8c0e2948435097f3 ( Context * __context__, TArray<CObject> &  __objects_rename_at_20, int32_t __count_rename_at_20 )
+{
+	{
+		uint64_t __loop_count_21 = UINT64_MAX;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__count_rename_at_20));
+		int32_t __i_rename_at_21;
+		__loop_count_21 = das_loop_count(__loop_count_21,__i_iterator.loop_begin(__context__,(__i_rename_at_21)));
+		for ( ; __loop_count_21 ; --__loop_count_21, ++__i_rename_at_21 )
+		{
+			testVirtual_b1b4612cdd2d2d52(__context__,das_arg<TArray<CObject>>::pass(__objects_rename_at_20));
+		}
+		__i_iterator.loop_end(__context__,(__i_rename_at_21));
+	};
+}
+
+inline void testMethod_c143f6bc965ff22c ( Context * __context__, TArray<CObject> &  __objects_rename_at_24 )
+{
+	{
+		uint64_t __loop_count_25 = UINT64_MAX;
+		// obj : CObject&
+		das_iterator<TArray<CObject>> __obj_iterator(__objects_rename_at_24);
+		CObject * __obj_rename_at_25;
+		__loop_count_25 = das_loop_count(__loop_count_25,__obj_iterator.loop_begin(__context__,(__obj_rename_at_25)));
+		for ( ; __loop_count_25 ; --__loop_count_25, ++__obj_rename_at_25 )
+		{
+			_FuncCObject_0x60_update_2d4bfd5d2219350f(__context__,das_arg<CObject>::pass((*__obj_rename_at_25)));
+		}
+		__obj_iterator.loop_end(__context__,(__obj_rename_at_25));
+	};
+}
+
+inline void testMethod2_f3296ad503cbfe01 ( Context * __context__, TArray<CObject> &  __objects_rename_at_28, int32_t __count_rename_at_28 )
+{
+	{
+		uint64_t __loop_count_29 = UINT64_MAX;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__count_rename_at_28));
+		int32_t __i_rename_at_29;
+		__loop_count_29 = das_loop_count(__loop_count_29,__i_iterator.loop_begin(__context__,(__i_rename_at_29)));
+		for ( ; __loop_count_29 ; --__loop_count_29, ++__i_rename_at_29 )
+		{
+			testMethod_c143f6bc965ff22c(__context__,das_arg<TArray<CObject>>::pass(__objects_rename_at_28));
+		}
+		__i_iterator.loop_end(__context__,(__i_rename_at_29));
+	};
+}
+
+inline void init_5b0f759928c70edb ( Context * __context__, TArray<CObject> &  __objects_rename_at_32 )
+{
+	_Funcbuiltin_0x60_resize_a402e7bff6d16bfa(__context__,das_arg<TArray<CObject>>::pass(__objects_rename_at_32),50000);
+	int32_t __i_rename_at_34 = 0;
+	{
+		uint64_t __loop_count_35 = UINT64_MAX;
+		// obj : CObject&
+		das_iterator<TArray<CObject>> __obj_iterator(__objects_rename_at_32);
+		CObject * __obj_rename_at_35;
+		__loop_count_35 = das_loop_count(__loop_count_35,__obj_iterator.loop_begin(__context__,(__obj_rename_at_35)));
+		for ( ; __loop_count_35 ; --__loop_count_35, ++__obj_rename_at_35 )
+		{
+			das_copy((*__obj_rename_at_35),CObject_a2186f52fb3050a2(__context__,__i_rename_at_34++));
+		}
+		__obj_iterator.loop_end(__context__,(__obj_rename_at_35));
+	};
+}
+
+inline void update_72a908a54031d882 ( Context * __context__, NObject &  __a_rename_at_43 )
+{
+	SimPolicy<float3>::SetAdd((char *)&(__a_rename_at_43.position),__a_rename_at_43.velocity,*__context__,nullptr);
+}
+
+inline void testSim_168630652c40d9b6 ( Context * __context__, TArray<NObject> &  __objects_rename_at_46 )
+{
+	{
+		uint64_t __loop_count_47 = UINT64_MAX;
+		// obj : NObject&
+		das_iterator<TArray<NObject>> __obj_iterator(__objects_rename_at_46);
+		NObject * __obj_rename_at_47;
+		__loop_count_47 = das_loop_count(__loop_count_47,__obj_iterator.loop_begin(__context__,(__obj_rename_at_47)));
+		for ( ; __loop_count_47 ; --__loop_count_47, ++__obj_rename_at_47 )
+		{
+			update_72a908a54031d882(__context__,das_arg<NObject>::pass((*__obj_rename_at_47)));
+		}
+		__obj_iterator.loop_end(__context__,(__obj_rename_at_47));
+	};
+}
+
+inline void testSim2_223484789c727771 ( Context * __context__, TArray<NObject> &  __objects_rename_at_50, int32_t __count_rename_at_50 )
+{
+	{
+		uint64_t __loop_count_51 = UINT64_MAX;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__count_rename_at_50));
+		int32_t __i_rename_at_51;
+		__loop_count_51 = das_loop_count(__loop_count_51,__i_iterator.loop_begin(__context__,(__i_rename_at_51)));
+		for ( ; __loop_count_51 ; --__loop_count_51, ++__i_rename_at_51 )
+		{
+			testSim_168630652c40d9b6(__context__,das_arg<TArray<NObject>>::pass(__objects_rename_at_50));
+		}
+		__i_iterator.loop_end(__context__,(__i_rename_at_51));
+	};
+}
+
+inline void testSimI_abb10b105e772cd9 ( Context * __context__, TArray<NObject> &  __objects_rename_at_54 )
+{
+	{
+		uint64_t __loop_count_55 = UINT64_MAX;
+		// obj : NObject&
+		das_iterator<TArray<NObject>> __obj_iterator(__objects_rename_at_54);
+		NObject * __obj_rename_at_55;
+		__loop_count_55 = das_loop_count(__loop_count_55,__obj_iterator.loop_begin(__context__,(__obj_rename_at_55)));
+		for ( ; __loop_count_55 ; --__loop_count_55, ++__obj_rename_at_55 )
+		{
+			SimPolicy<float3>::SetAdd((char *)&((*__obj_rename_at_55).position),(*__obj_rename_at_55).velocity,*__context__,nullptr);
+		}
+		__obj_iterator.loop_end(__context__,(__obj_rename_at_55));
+	};
+}
+
+inline void testSim2I_8e974b12830fffd5 ( Context * __context__, TArray<NObject> &  __objects_rename_at_58, int32_t __count_rename_at_58 )
+{
+	{
+		uint64_t __loop_count_59 = UINT64_MAX;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__count_rename_at_58));
+		int32_t __i_rename_at_59;
+		__loop_count_59 = das_loop_count(__loop_count_59,__i_iterator.loop_begin(__context__,(__i_rename_at_59)));
+		for ( ; __loop_count_59 ; --__loop_count_59, ++__i_rename_at_59 )
+		{
+			testSimI_abb10b105e772cd9(__context__,das_arg<TArray<NObject>>::pass(__objects_rename_at_58));
+		}
+		__i_iterator.loop_end(__context__,(__i_rename_at_59));
+	};
+}
+
+inline void init_9089204b6ff6649b ( Context * __context__, TArray<NObject> &  __objects_rename_at_62 )
+{
+	_Funcbuiltin_0x60_resize_895b2ff719a60fbf(__context__,das_arg<TArray<NObject>>::pass(__objects_rename_at_62),50000);
+	int32_t __i_rename_at_64 = 0;
+	{
+		uint64_t __loop_count_65 = UINT64_MAX;
+		// obj : NObject&
+		das_iterator<TArray<NObject>> __obj_iterator(__objects_rename_at_62);
+		NObject * __obj_rename_at_65;
+		__loop_count_65 = das_loop_count(__loop_count_65,__obj_iterator.loop_begin(__context__,(__obj_rename_at_65)));
+		for ( ; __loop_count_65 ; --__loop_count_65, ++__obj_rename_at_65 )
+		{
+			das_copy((*__obj_rename_at_65).position,float3(__i_rename_at_64++,__i_rename_at_64 + 1,__i_rename_at_64 + 2));
+			das_copy((*__obj_rename_at_65).velocity,v_make_vec4f(1.f,2.f,3.f,0.f));
+		}
+		__obj_iterator.loop_end(__context__,(__obj_rename_at_65));
+	};
+	DAS_ASSERT((__i_rename_at_64 == builtin_array_size(das_arg<TArray<NObject>>::pass(__objects_rename_at_62))));
+}
+
+inline bool test_9f4fdc3bbfd7f50a ( Context * __context__ ) { das_stack_prologue __prologue(__context__,384,"test " DAS_FILE_LINE);
+{
+	TArray<NObject> __objects_rename_at_72; das_zero(__objects_rename_at_72);
+	init_9089204b6ff6649b(__context__,das_arg<TArray<NObject>>::pass(__objects_rename_at_72));
+	builtin_profile(20,((char *) "particles kinematics"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		testSim2_223484789c727771(__context__,das_arg<TArray<NObject>>::pass(__objects_rename_at_72),100);
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	builtin_profile(20,((char *) "particles kinematics, inlined"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		testSim2I_8e974b12830fffd5(__context__,das_arg<TArray<NObject>>::pass(__objects_rename_at_72),100);
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	TArray<CObject> __classes_rename_at_80; das_zero(__classes_rename_at_80);
+	init_5b0f759928c70edb(__context__,das_arg<TArray<CObject>>::pass(__classes_rename_at_80));
+	builtin_profile(20,((char *) "particles kinematics OOP, virtual"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		testVirtual2_8c0e2948435097f3(__context__,das_arg<TArray<CObject>>::pass(__classes_rename_at_80),100);
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	builtin_profile(20,((char *) "particles kinematics OOP, method"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		testMethod2_f3296ad503cbfe01(__context__,das_arg<TArray<CObject>>::pass(__classes_rename_at_80),100);
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	builtin_profile(20,((char *) "particles kinematics, C++"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		testParticles(100);
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	builtin_profile(20,((char *) "particles kinematics, inlined C++"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		testParticlesI(100);
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	return das_auto_cast<bool>::cast(true);
+}}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// finalize_265ddf665670d2db
+	aotLib[0x4726a5580672402d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, CObject &  ),&finalize_265ddf665670d2db>>();
+	};
+	// _Funcbuiltin_0x60_resize_a402e7bff6d16bfa
+	aotLib[0xec70b7f02c494de5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<CObject> & , int32_t  ),&_Funcbuiltin_0x60_resize_a402e7bff6d16bfa>>();
+	};
+	// _Funcbuiltin_0x60_resize_895b2ff719a60fbf
+	aotLib[0xb7586077ac9dfa8d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<NObject> & , int32_t  ),&_Funcbuiltin_0x60_resize_895b2ff719a60fbf>>();
+	};
+	// CObject_a2186f52fb3050a2
+	aotLib[0x83ba6136b2e06c8e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<CObject (*) ( Context * __context__, int32_t  ),&CObject_a2186f52fb3050a2>>();
+	};
+	// _FuncCObject_0x60_CObject_1f8956513c47f13d
+	aotLib[0xccaa1093f4eee725] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, CObject & , int32_t  ),&_FuncCObject_0x60_CObject_1f8956513c47f13d>>();
+	};
+	// _FuncCObject_0x60_update_2d4bfd5d2219350f
+	aotLib[0x649cdb9461b40bad] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, CObject &  ),&_FuncCObject_0x60_update_2d4bfd5d2219350f>>();
+	};
+	// _FuncCObject_0x27___finalize_fd0d43fc7e281b5f
+	aotLib[0x81f27cdcf01085e2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, CObject &  ),&_FuncCObject_0x27___finalize_fd0d43fc7e281b5f>>();
+	};
+	// testVirtual_b1b4612cdd2d2d52
+	aotLib[0x173a7f9c016530e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<CObject> &  ),&testVirtual_b1b4612cdd2d2d52>>();
+	};
+	// testVirtual2_8c0e2948435097f3
+	aotLib[0x6fa147ff6d7e842] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<CObject> & , int32_t  ),&testVirtual2_8c0e2948435097f3>>();
+	};
+	// testMethod_c143f6bc965ff22c
+	aotLib[0xc166b8360bcccc40] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<CObject> &  ),&testMethod_c143f6bc965ff22c>>();
+	};
+	// testMethod2_f3296ad503cbfe01
+	aotLib[0x472cd9ab7519f4fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<CObject> & , int32_t  ),&testMethod2_f3296ad503cbfe01>>();
+	};
+	// init_5b0f759928c70edb
+	aotLib[0xcf0f7d4cc4431c34] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<CObject> &  ),&init_5b0f759928c70edb>>();
+	};
+	// update_72a908a54031d882
+	aotLib[0x6ddb934d4346811] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, NObject &  ),&update_72a908a54031d882>>();
+	};
+	// testSim_168630652c40d9b6
+	aotLib[0x6e95eba25562cfa4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<NObject> &  ),&testSim_168630652c40d9b6>>();
+	};
+	// testSim2_223484789c727771
+	aotLib[0x1a133b0af820218] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<NObject> & , int32_t  ),&testSim2_223484789c727771>>();
+	};
+	// testSimI_abb10b105e772cd9
+	aotLib[0xca8d515001fcc041] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<NObject> &  ),&testSimI_abb10b105e772cd9>>();
+	};
+	// testSim2I_8e974b12830fffd5
+	aotLib[0xb579ae8be182e8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<NObject> & , int32_t  ),&testSim2I_8e974b12830fffd5>>();
+	};
+	// init_9089204b6ff6649b
+	aotLib[0xaa7730863ea04f54] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<NObject> &  ),&init_9089204b6ff6649b>>();
+	};
+	// test_9f4fdc3bbfd7f50a
+	aotLib[0x836e3040821feec7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_9f4fdc3bbfd7f50a>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,188 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require testProfile
+#include "test_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_3134273029426390858 {
+
+extern TypeInfo __type_info__af63eb4c86020609;
+extern FuncInfo __func_info__eeb3b74c98cb09c3;
+
+FuncInfo __func_info__eeb3b74c98cb09c3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,0xeeb3b74c98cb09c3ul, 0x0 };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, 0xaf63eb4c86020609ul };
+
+
+inline bool _Func_0x60_isprime_280754d0c19ab92c ( Context * __context__, int32_t __n_rename_at_5 );
+inline int32_t _Func_0x60_primes_36d01339dd83aac4 ( Context * __context__, int32_t __n_rename_at_12 );
+inline int32_t _Func_0x60_primesI_654a588228e31428 ( Context * __context__, int32_t __n_rename_at_20 );
+inline bool test_972ec1bcf15a6614 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool _Func_0x60_isprime_280754d0c19ab92c ( Context * __context__, int32_t __n_rename_at_5 )
+{
+	{
+		uint64_t __loop_count_6 = UINT64_MAX;
+		// i : int const
+		das_iterator<range> __i_iterator(range(2,__n_rename_at_5));
+		int32_t __i_rename_at_6;
+		__loop_count_6 = das_loop_count(__loop_count_6,__i_iterator.loop_begin(__context__,(__i_rename_at_6)));
+		for ( ; __loop_count_6 ; --__loop_count_6, ++__i_rename_at_6 )
+		{
+			if ( (SimPolicy<int32_t>::Mod(__n_rename_at_5,__i_rename_at_6,*__context__,nullptr)) == 0 )
+			{
+				return das_auto_cast<bool>::cast(false);
+			};
+		}
+		__i_iterator.loop_end(__context__,(__i_rename_at_6));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline int32_t _Func_0x60_primes_36d01339dd83aac4 ( Context * __context__, int32_t __n_rename_at_12 )
+{
+	int32_t __count_rename_at_13 = 0;
+	{
+		uint64_t __loop_count_14 = UINT64_MAX;
+		// i : int const
+		das_iterator<range> __i_iterator(range(2,__n_rename_at_12 + 1));
+		int32_t __i_rename_at_14;
+		__loop_count_14 = das_loop_count(__loop_count_14,__i_iterator.loop_begin(__context__,(__i_rename_at_14)));
+		for ( ; __loop_count_14 ; --__loop_count_14, ++__i_rename_at_14 )
+		{
+			if ( _Func_0x60_isprime_280754d0c19ab92c(__context__,__i_rename_at_14) )
+			{
+				++__count_rename_at_13;
+			};
+		}
+		__i_iterator.loop_end(__context__,(__i_rename_at_14));
+	};
+	return das_auto_cast<int32_t>::cast(__count_rename_at_13);
+}
+
+inline int32_t _Func_0x60_primesI_654a588228e31428 ( Context * __context__, int32_t __n_rename_at_20 )
+{
+	int32_t __count_rename_at_21 = 0;
+	{
+		uint64_t __loop_count_22 = UINT64_MAX;
+		// i : int const
+		das_iterator<range> __i_iterator(range(2,__n_rename_at_20 + 1));
+		int32_t __i_rename_at_22;
+		__loop_count_22 = das_loop_count(__loop_count_22,__i_iterator.loop_begin(__context__,(__i_rename_at_22)));
+		for ( ; __loop_count_22 ; --__loop_count_22, ++__i_rename_at_22 )
+		{
+			++__count_rename_at_21;
+			{
+				uint64_t __loop_count_24 = UINT64_MAX;
+				// j : int const
+				das_iterator<range> __j_iterator(range(2,__i_rename_at_22));
+				int32_t __j_rename_at_24;
+				__loop_count_24 = das_loop_count(__loop_count_24,__j_iterator.loop_begin(__context__,(__j_rename_at_24)));
+				for ( ; __loop_count_24 ; --__loop_count_24, ++__j_rename_at_24 )
+				{
+					if ( (SimPolicy<int32_t>::Mod(__i_rename_at_22,__j_rename_at_24,*__context__,nullptr)) == 0 )
+					{
+						--__count_rename_at_21;
+						break;
+					};
+				}
+				__j_iterator.loop_end(__context__,(__j_rename_at_24));
+			};
+		}
+		__i_iterator.loop_end(__context__,(__i_rename_at_22));
+	};
+	return das_auto_cast<int32_t>::cast(__count_rename_at_21);
+}
+
+inline bool test_972ec1bcf15a6614 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,224,"test " DAS_FILE_LINE);
+{
+	int32_t __f1_rename_at_32 = 0;
+	builtin_profile(20,((char *) "primes loop"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		das_copy(__f1_rename_at_32,_Func_0x60_primes_36d01339dd83aac4(__context__,14000));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	DAS_ASSERT((__f1_rename_at_32 == 1652));
+	int32_t __f2_rename_at_36 = 0;
+	builtin_profile(20,((char *) "primes loop, inline"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		das_copy(__f2_rename_at_36,_Func_0x60_primesI_654a588228e31428(__context__,14000));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	DAS_ASSERT((__f2_rename_at_36 == 1652));
+	int32_t __f3_rename_at_40 = 0;
+	builtin_profile(20,((char *) "primes loop C++"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		das_copy(__f3_rename_at_40,testPrimes(14000));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	DAS_ASSERT((__f3_rename_at_40 == 1652));
+	return das_auto_cast<bool>::cast(true);
+}}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Func_0x60_isprime_280754d0c19ab92c
+	aotLib[0x2a59d56608b336dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, int32_t  ),&_Func_0x60_isprime_280754d0c19ab92c>>();
+	};
+	// _Func_0x60_primes_36d01339dd83aac4
+	aotLib[0x2d10c6fa5e251f28] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&_Func_0x60_primes_36d01339dd83aac4>>();
+	};
+	// _Func_0x60_primesI_654a588228e31428
+	aotLib[0x907144cde92a482d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&_Func_0x60_primesI_654a588228e31428>>();
+	};
+	// test_972ec1bcf15a6614
+	aotLib[0xe60df040cef86fc0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_972ec1bcf15a6614>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
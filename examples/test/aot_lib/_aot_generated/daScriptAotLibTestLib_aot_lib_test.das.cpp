@@ -0,0 +1,105 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_12263626664290685579 {
+
+
+
+
+inline int32_t fib_aa4c2d62f42b665a ( Context * __context__, int32_t __n_rename_at_6 );
+inline bool test_5a95b1c9bfdc5e9b ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int32_t,0xbcde1ea62323f6fa>(__context__) = 0;/*total*/
+}
+
+inline int32_t fib_aa4c2d62f42b665a ( Context * __context__, int32_t __n_rename_at_6 )
+{
+	return das_auto_cast<int32_t>::cast((__n_rename_at_6 < 2) ? das_auto_cast<int32_t>::cast(__n_rename_at_6) : das_auto_cast<int32_t>::cast((fib_aa4c2d62f42b665a(__context__,__n_rename_at_6 - 1) + fib_aa4c2d62f42b665a(__context__,__n_rename_at_6 - 2))));
+}
+
+inline bool test_5a95b1c9bfdc5e9b ( Context * __context__ )
+{
+	das_copy(das_global<int32_t,0xbcde1ea62323f6fa>(__context__) /*total*/,0);
+	{
+		uint64_t __loop_count_14 = UINT64_MAX;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,10));
+		int32_t __i_rename_at_14;
+		__loop_count_14 = das_loop_count(__loop_count_14,__i_iterator.loop_begin(__context__,(__i_rename_at_14)));
+		for ( ; __loop_count_14 ; --__loop_count_14, ++__i_rename_at_14 )
+		{
+			das_global<int32_t,0xbcde1ea62323f6fa>(__context__) /*total*/ += fib_aa4c2d62f42b665a(__context__,__i_rename_at_14);
+		}
+		__i_iterator.loop_end(__context__,(__i_rename_at_14));
+	};
+	return das_auto_cast<bool>::cast(das_global<int32_t,0xbcde1ea62323f6fa>(__context__) /*total*/ == 88);
+}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// fib_aa4c2d62f42b665a
+	aotLib[0x1cb8e42c84c66a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&fib_aa4c2d62f42b665a>>();
+	};
+	// test_5a95b1c9bfdc5e9b
+	aotLib[0xd6cdfe2df8c74f4d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_5a95b1c9bfdc5e9b>>();
+	};
+	// [[ init script ]]
+	aotLib[0x72c99c4c11c9d257] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
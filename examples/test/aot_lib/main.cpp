@@ -0,0 +1,156 @@
+#include "daScript/daScript.h"
+#include "daScript/simulate/fs_file_info.h"
+
+/*
+    Loads AOT of aot_lib_test.das from the shared library, which DAS_AOT_LIB builds (DAS_AOT_LIB_TEST_LIBRARY).
+    Library is linked per program via CodeOfPolicies::aot_lib. Stale and missing libraries are reported as AOT link errors,
+    and the program falls back to the interpreter.
+*/
+
+using namespace das;
+
+TextPrinter tout;
+
+static string g_library = DAS_AOT_LIB_TEST_LIBRARY;
+
+static string readScript ( const string & fn ) {
+    auto fAccess = make_smart<FsFileAccess>();
+    auto fi = fAccess->getFileInfo(fn);
+    if ( !fi ) return "";
+    const char * src = nullptr;
+    uint32_t len = 0;
+    fi->getSourceAndLength(src, len);
+    return string(src, len);
+}
+
+static string replaceText ( string text, const string & from, const string & to ) {
+    auto pos = text.find(from);
+    DAS_ASSERT(pos!=string::npos);
+    return text.replace(pos, from.length(), to);
+}
+
+// compiles the script text with the given AOT library, runs 'test', and reports which functions got AOT
+static bool run_with_library ( const string & text, const string & library, das_map<string,bool> & aotFunctions, size_t & aotErrors ) {
+    auto fAccess = make_smart<FsFileAccess>();
+    auto fileInfo = make_unique<TextFileInfo>(text.c_str(), uint32_t(text.length()), false);
+    fAccess->setFileInfo("aot_lib_test.das", das::move(fileInfo));
+    ModuleGroup dummyLibGroup;
+    CodeOfPolicies policies;
+    policies.aot = true;
+    policies.aot_lib = library;
+    policies.fail_on_no_aot = false;
+    auto program = compileDaScript("aot_lib_test.das", fAccess, tout, dummyLibGroup, false, policies);
+    if ( !program || program->failed() ) {
+        tout << "failed to compile\n";
+        if ( program ) {
+            for ( auto & err : program->errors ) {
+                tout << reportError(err.at, err.what, err.extra, err.fixme, err.cerr );
+            }
+        }
+        return false;
+    }
+    Context ctx(program->getContextStackSize());
+    if ( !program->simulate(ctx, tout) ) {
+        tout << "failed to simulate\n";
+        for ( auto & err : program->errors ) {
+            tout << reportError(err.at, err.what, err.extra, err.fixme, err.cerr );
+        }
+        return false;
+    }
+    aotErrors = program->aotErrors.size();
+    for ( int i=0, is=ctx.getTotalFunctions(); i!=is; ++i ) {
+        auto fn = ctx.getFunction(i);
+        aotFunctions[fn->name] = fn->aot;
+    }
+    auto fnTest = ctx.findFunction("test");
+    if ( !fnTest ) {
+        tout << "function 'test' not found\n";
+        return false;
+    }
+    ctx.restart();
+    bool result = cast<bool>::to(ctx.eval(fnTest, nullptr));
+    if ( auto ex = ctx.getException() ) {
+        tout << "exception: " << ex << "\n";
+        return false;
+    }
+    if ( !result ) {
+        tout << "'test' returned false\n";
+    }
+    return result;
+}
+
+static bool expect ( bool condition, const char * what ) {
+    if ( !condition ) tout << "\t" << what << "\n";
+    return condition;
+}
+
+bool test_aot_lib ( const string & text ) {
+    tout << "linking the library ";
+    das_map<string,bool> aot;
+    size_t aotErrors = 0;
+    bool ok = run_with_library(text, g_library, aot, aotErrors);
+    ok = expect(aotErrors==0, "unexpected AOT link errors") && ok;
+    ok = expect(aot["fib"] && aot["test"], "fib and test are expected to be AOT") && ok;
+    tout << (ok ? "ok\n" : "failed\n");
+    return ok;
+}
+
+bool test_stale_function ( const string & text ) {
+    tout << "changed function is not linked ";
+    das_map<string,bool> aot;
+    size_t aotErrors = 0;
+    bool ok = run_with_library(replaceText(text, "if n < 2", "if n <= 1"), g_library, aot, aotErrors);
+    ok = expect(aotErrors!=0, "expecting AOT link error for fib") && ok;
+    ok = expect(!aot["fib"], "fib is not expected to be AOT") && ok;
+    tout << (ok ? "ok\n" : "failed\n");
+    return ok;
+}
+
+bool test_stale_init ( const string & text ) {
+    tout << "changed init script rejects the library ";
+    das_map<string,bool> aot;
+    size_t aotErrors = 0;
+    bool ok = run_with_library(replaceText(text, "total : int = 0", "total : int = 1"), g_library, aot, aotErrors);
+    ok = expect(aotErrors!=0, "expecting AOT link error for the init script") && ok;
+    for ( auto & fa : aot ) {
+        ok = expect(!fa.second, "no function is expected to be AOT") && ok;
+    }
+    tout << (ok ? "ok\n" : "failed\n");
+    return ok;
+}
+
+bool test_missing_library ( const string & text ) {
+    tout << "missing library ";
+    das_map<string,bool> aot;
+    size_t aotErrors = 0;
+    bool ok = run_with_library(text, g_library + ".missing", aot, aotErrors);
+    ok = expect(aotErrors!=0, "expecting AOT link error for the library") && ok;
+    ok = expect(!aot["fib"] && !aot["test"], "no function is expected to be AOT") && ok;
+    tout << (ok ? "ok\n" : "failed\n");
+    return ok;
+}
+
+int main( int argc, char * argv[] ) {
+    if ( argc>2 ) {
+        tout << "daScriptAotLibTest [pathToDasRoot]\n";
+        return -1;
+    }  else if ( argc==2 ) {
+        setDasRoot(argv[1]);
+    }
+    NEED_MODULE(Module_BuiltIn);
+    Module::Initialize();
+    bool ok = true;
+    auto text = readScript(getDasRoot() + "/examples/test/aot_lib/aot_lib_test.das");
+    if ( text.empty() ) {
+        tout << "can't read aot_lib_test.das\n";
+        ok = false;
+    } else {
+        ok = test_aot_lib(text) && ok;
+        ok = test_stale_function(text) && ok;
+        ok = test_stale_init(text) && ok;
+        ok = test_missing_library(text) && ok;
+    }
+    tout << "AOT LIBRARY TESTS " << (ok ? "PASSED" : "FAILED!!!") << "\n";
+    Module::Shutdown();
+    return ok ? 0 : -1;
+}
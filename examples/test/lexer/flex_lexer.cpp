@@ -0,0 +1,11 @@
+// flex generated lexer, compiled into daScriptLexerTest when libDaScript uses the hand written scanner.
+// entry points are renamed, so that it can live next to the scanner from the library
+
+#define das_yylex               das_flex_yylex
+#define das_yylex_init_extra    das_flex_yylex_init_extra
+#define das_yylex_destroy       das_flex_yylex_destroy
+#define das_yybegin             das_flex_yybegin
+#define das_yybegin_reader      das_flex_yybegin_reader
+#define das_yyend_reader        das_flex_yyend_reader
+
+#include "ds_lexer.cpp"
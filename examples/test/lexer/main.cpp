@@ -0,0 +1,294 @@
+#include "daScript/daScript.h"
+#include "daScript/simulate/fs_file_info.h"
+
+#include "parser_state.h"
+#include "parser_impl.h"
+#include "ds_parser.hpp"
+
+#ifdef _MSC_VER
+#include <io.h>
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#endif
+
+/*
+    Compares the hand written scanner (ds_scanner.cpp) with the flex generated lexer (ds_lexer.lpp).
+    Every .das file of the tree, and a batch of random token soups, is lexed by both of them side by side.
+    Tokens, values, locations, parser state after every token, and number of errors have to match.
+    By default libDaScript has the scanner, and the flex lexer is compiled into the test (flex_lexer.cpp).
+    With DAS_FLEX_LEXER it is the other way around. Either way the copy in the test has its entry points renamed.
+*/
+
+using namespace das;
+
+namespace das {
+    bool isUtf8Text ( const char * src, uint32_t length );
+}
+
+#if DAS_LEXER_TEST_FLEX
+// flex generated lexer, see flex_lexer.cpp
+int das_flex_yylex ( DAS_YYSTYPE * yylval_param, DAS_YYLTYPE * yylloc_param, yyscan_t yyscanner );
+int das_flex_yylex_init_extra ( DasParserState * user_defined, yyscan_t * ptr_yy_globals );
+int das_flex_yylex_destroy ( yyscan_t yyscanner );
+void das_flex_yybegin ( const char * str, uint32_t len, yyscan_t yyscanner );
+// hand written scanner, from libDaScript
+int das_yylex ( DAS_YYSTYPE * yylval_param, DAS_YYLTYPE * yylloc_param, yyscan_t yyscanner );
+int das_yylex_init_extra ( DasParserState * user_defined, yyscan_t * ptr_yy_globals );
+int das_yylex_destroy ( yyscan_t yyscanner );
+void das_yybegin ( const char * str, uint32_t len, yyscan_t yyscanner );
+#define FLEX_API        das_flex_yylex, das_flex_yylex_init_extra, das_flex_yylex_destroy, das_flex_yybegin
+#define SCANNER_API     das_yylex, das_yylex_init_extra, das_yylex_destroy, das_yybegin
+#else
+// flex generated lexer, from libDaScript
+int das_yylex ( DAS_YYSTYPE * yylval_param, DAS_YYLTYPE * yylloc_param, yyscan_t yyscanner );
+int das_yylex_init_extra ( DasParserState * user_defined, yyscan_t * ptr_yy_globals );
+int das_yylex_destroy ( yyscan_t yyscanner );
+void das_yybegin ( const char * str, uint32_t len, yyscan_t yyscanner );
+// hand written scanner, see DAS_SCANNER_RENAME
+int das_scanner_yylex ( DAS_YYSTYPE * yylval_param, DAS_YYLTYPE * yylloc_param, yyscan_t yyscanner );
+int das_scanner_yylex_init_extra ( DasParserState * user_defined, yyscan_t * ptr_yy_globals );
+int das_scanner_yylex_destroy ( yyscan_t yyscanner );
+void das_scanner_yybegin ( const char * str, uint32_t len, yyscan_t yyscanner );
+#define FLEX_API        das_yylex, das_yylex_init_extra, das_yylex_destroy, das_yybegin
+#define SCANNER_API     das_scanner_yylex, das_scanner_yylex_init_extra, das_scanner_yylex_destroy, das_scanner_yybegin
+#endif
+
+TextPrinter tout;
+uint64_t g_tokens = 0;
+
+struct LexerApi {
+    const char * name;
+    int (*lex) ( DAS_YYSTYPE *, DAS_YYLTYPE *, yyscan_t );
+    int (*init) ( DasParserState *, yyscan_t * );
+    int (*destroy) ( yyscan_t );
+    void (*begin) ( const char *, uint32_t, yyscan_t );
+};
+
+static LexerApi g_flex = { "flex", FLEX_API };
+static LexerApi g_scanner = { "scanner", SCANNER_API };
+
+struct LexerRun {
+    LexerRun ( const LexerApi & a, const FileAccessPtr & access, FileInfo * fi ) : api(a) {
+        program = make_smart<Program>();
+        state.g_Access = access;
+        state.g_Program = program;
+        state.g_FileAccessStack.push_back(fi);
+        api.init(&state, &scanner);
+        const char * src = nullptr;
+        uint32_t len = 0;
+        fi->getSourceAndLength(src, len);
+        if ( isUtf8Text(src, len) ) {
+            api.begin(src + 3, len - 3, scanner);
+        } else {
+            api.begin(src, len, scanner);
+        }
+    }
+    ~LexerRun() {
+        api.destroy(scanner);
+    }
+    int next() {
+        memset(&value, 0, sizeof(value));
+        memset(&at, 0, sizeof(at));
+        return api.lex(&value, &at, scanner);
+    }
+    const LexerApi &    api;
+    ProgramPtr          program;
+    DasParserState      state;
+    yyscan_t            scanner = nullptr;
+    DAS_YYSTYPE         value;
+    DAS_YYLTYPE         at;
+};
+
+static string describeValue ( int token, const DAS_YYSTYPE & v ) {
+    switch ( token ) {
+    case NAME:                  return v.s ? *v.s : "(null)";
+    case INTEGER:               return to_string(v.i);
+    case UNSIGNED_INTEGER:      return to_string(v.ui);
+    case LONG_INTEGER:          return to_string(v.i64);
+    case UNSIGNED_LONG_INTEGER: return to_string(v.ui64);
+    case FLOAT:                 return to_string(v.fd);
+    case DOUBLE:                return to_string(v.d);
+    case STRING_CHARACTER:
+    case STRING_CHARACTER_ESC:  return to_string(int(v.ch));
+    default:                    return "";
+    }
+}
+
+static bool sameValue ( int token, const DAS_YYSTYPE & a, const DAS_YYSTYPE & b ) {
+    switch ( token ) {
+    case NAME:                  return a.s && b.s && *a.s==*b.s;
+    case INTEGER:               return a.i==b.i;
+    case UNSIGNED_INTEGER:      return a.ui==b.ui;
+    case LONG_INTEGER:          return a.i64==b.i64;
+    case UNSIGNED_LONG_INTEGER: return a.ui64==b.ui64;
+    case FLOAT:                 return memcmp(&a.fd, &b.fd, sizeof(double))==0;
+    case DOUBLE:                return memcmp(&a.d, &b.d, sizeof(double))==0;
+    case STRING_CHARACTER:
+    case STRING_CHARACTER_ESC:  return a.ch==b.ch;
+    default:                    return true;
+    }
+}
+
+static bool sameState ( const DasParserState & a, const DasParserState & b ) {
+    return a.das_current_line_indent==b.das_current_line_indent
+        && a.das_indent_level==b.das_indent_level
+        && a.das_tab_size==b.das_tab_size
+        && a.das_nested_parentheses==b.das_nested_parentheses
+        && a.das_nested_curly_braces==b.das_nested_curly_braces
+        && a.das_nested_square_braces==b.das_nested_square_braces
+        && a.das_nested_sb==b.das_nested_sb
+        && a.das_yycolumn==b.das_yycolumn
+        && a.das_c_style_depth==b.das_c_style_depth
+        && a.das_arrow_depth==b.das_arrow_depth
+        && a.das_need_oxford_comma==b.das_need_oxford_comma
+        && a.das_force_oxford_comma==b.das_force_oxford_comma;
+}
+
+static bool compare_lexers ( const string & name, const FileAccessPtr & access, FileInfo * fi ) {
+    LexerRun fl(g_flex, access, fi);
+    LexerRun sc(g_scanner, access, fi);
+    for ( int index=0; index!=10000000; ++index ) {
+        int tf = fl.next();
+        int ts = sc.next();
+        bool ok = tf==ts && sameValue(tf, fl.value, sc.value)
+            && memcmp(&fl.at, &sc.at, sizeof(DAS_YYLTYPE))==0
+            && sameState(fl.state, sc.state)
+            && fl.program->errors.size()==sc.program->errors.size();
+        if ( !ok ) {
+            tout << name << " differs at token " << index << "\n"
+                << "\tflex    " << tf << " '" << describeValue(tf, fl.value) << "' at " << fl.at.first_line << ":" << fl.at.first_column
+                    << "-" << fl.at.last_line << ":" << fl.at.last_column << ", errors " << int(fl.program->errors.size()) << "\n"
+                << "\tscanner " << ts << " '" << describeValue(ts, sc.value) << "' at " << sc.at.first_line << ":" << sc.at.first_column
+                    << "-" << sc.at.last_line << ":" << sc.at.last_column << ", errors " << int(sc.program->errors.size()) << "\n";
+        }
+        if ( tf==NAME ) delete fl.value.s;
+        if ( ts==NAME ) delete sc.value.s;
+        if ( !ok ) return false;
+        if ( tf==0 ) return true;
+        g_tokens ++;
+    }
+    tout << name << " does not terminate\n";
+    return false;
+}
+
+static bool compare_file ( const string & fn ) {
+    auto access = make_smart<FsFileAccess>();
+    auto fi = access->getFileInfo(fn);
+    if ( !fi ) {
+        tout << fn << " can't be read\n";
+        return false;
+    }
+    const char * src = nullptr;
+    uint32_t len = 0;
+    fi->getSourceAndLength(src, len);
+    // flex reads uninitialized line number for the included buffers, so the locations can't match
+    string text(src, len);
+    if ( text.compare(0, 8, "include ")==0 || text.find("\ninclude ")!=string::npos ) return true;
+    return compare_lexers(fn, access, fi);
+}
+
+static bool compare_tree ( const string & path, int & files ) {
+    bool ok = true;
+#ifdef _MSC_VER
+    _finddata_t c_file;
+    intptr_t hFile;
+    string findPath = path + "/*";
+    if ((hFile = _findfirst(findPath.c_str(), &c_file)) != -1L) {
+        do {
+            string name = c_file.name;
+            if ( name=="." || name==".." || name=="_aot_generated" ) continue;
+            if ( c_file.attrib & _A_SUBDIR ) {
+                ok = compare_tree(path + "/" + name, files) && ok;
+            } else if ( name.size()>4 && name.compare(name.size()-4, 4, ".das")==0 ) {
+                files ++;
+                ok = compare_file(path + "/" + name) && ok;
+            }
+        } while (_findnext(hFile, &c_file) == 0);
+    }
+    _findclose(hFile);
+#else
+    DIR *dir;
+    struct dirent *ent;
+    if ((dir = opendir (path.c_str())) != NULL) {
+        while ((ent = readdir (dir)) != NULL) {
+            string name = ent->d_name;
+            if ( name=="." || name==".." || name=="_aot_generated" ) continue;
+            string full = path + "/" + name;
+            struct stat st;
+            if ( stat(full.c_str(), &st)!=0 ) continue;
+            if ( S_ISDIR(st.st_mode) ) {
+                ok = compare_tree(full, files) && ok;
+            } else if ( name.size()>4 && name.compare(name.size()-4, 4, ".das")==0 ) {
+                files ++;
+                ok = compare_file(full) && ok;
+            }
+        }
+        closedir (dir);
+    }
+#endif
+    return ok;
+}
+
+// random sequences of tokens, broken tokens, comments, strings and whitespace
+static bool compare_soups ( int count ) {
+    static const char * fragments[] = {
+        "def", "let", "var", "struct", "class", "if", "elif", "else", "return", "options", "require", "typedef",
+        "a", "foo_bar", "x`y", "_1", "int", "float", "string", "true", "false", "null",
+        "0", "123", "07", "0x1F", "0xFFu", "0xFFul", "0x1l", "123u", "123ul", "123l", "4294967296", "2147483648u",
+        "9223372036854775807l", "18446744073709551615ul", "99999999999999999999", "0x", "0b101",
+        "1.5", "1e10", "3.f", "2lf", "1.e5", ".5", "1.5e-3f", "1e+7lf", "5f",
+        "<|", "@<|", "@@<|", "$<|", "|>", "<-", "->", "::", ":=", "==", "!=", "&&", "||", "^^", "&&=", "||=", "^^=",
+        "..", "[[", "[{", "{{", "]]", "}}", "%", "%%", "@", "@@", "$", "#", "+=", "-=", "<<<", ">>>", "<<", ">>",
+        "?.", "??", "?[", "?as", "**", "++", "--", "!", "~", "=>", "<", ">", "<=", ">=", "'", "\\",
+        "(", ")", "[", "]", "{", "}", ";", ",", ":", ".", "=", "+", "-", "*", "/", "&", "|", "^", "?",
+        "\"abc\"", "\"a{b}c\"", "\"a{\"x\"}b\"", "\"esc\\n\\t\\\"\"", "\"\\{\\}\"", "\"unterminated", "\"",
+        "'a'", "'\\n'", "'\\\\'", "'\\t'", "''",
+        "//c\n", "// c\r\n", "/* c */", "/* nested /* c */ */", "/*", "*/", "/**/",
+        " ", "  ", "\t", "\n", "\r\n", "    ", "\n    ", "\n\t", "\n        ", "\n  ", "\r",
+        "#line 10 \"file.das\"\n",
+    };
+    const uint32_t total = uint32_t(sizeof(fragments)/sizeof(fragments[0]));
+    uint32_t seed = 12345;
+    auto rnd = [&]() { seed = seed*1664525u + 1013904223u; return seed >> 8; };
+    bool ok = true;
+    for ( int i=0; i!=count; ++i ) {
+        string text;
+        uint32_t n = 1 + rnd() % 64;
+        for ( uint32_t j=0; j!=n; ++j ) {
+            text += fragments[rnd() % total];
+            if ( rnd() % 3 ) text += " ";
+        }
+        auto access = make_smart<FsFileAccess>();
+        string name = "soup" + to_string(i) + ".das";
+        auto fi = make_unique<TextFileInfo>(text.c_str(), uint32_t(text.length()), false);
+        auto pfi = access->setFileInfo(name, das::move(fi));
+        if ( !compare_lexers(name, access, pfi) ) {
+            tout << "\t" << text << "\n";
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+int main( int argc, char * argv[] ) {
+    if ( argc>2 ) {
+        tout << "daScriptLexerTest [pathToDasRoot]\n";
+        return -1;
+    }  else if ( argc==2 ) {
+        setDasRoot(argv[1]);
+    }
+    NEED_MODULE(Module_BuiltIn);
+    Module::Initialize();
+    bool ok = true;
+    int files = 0;
+    for ( auto dir : { "/daslib", "/dastest", "/tests", "/examples", "/doc", "/modules", "/utils" } ) {
+        ok = compare_tree(getDasRoot() + dir, files) && ok;
+    }
+    tout << files << " files\n";
+    ok = compare_soups(20000) && ok;
+    tout << g_tokens << " tokens compared\n";
+    tout << "LEXER TESTS " << (ok ? "PASSED" : "FAILED!!!") << "\n";
+    Module::Shutdown();
+    return ok ? 0 : -1;
+}
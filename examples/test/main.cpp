@@ -311,6 +311,262 @@ bool run_module_test ( const string & path, const string & main, bool usePak ) {
     }
 }
 
+bool run_profile_test ( const string & fn ) {
+    tout << "testing FUNCTION PROFILER at " << fn << " ";
+    auto fAccess = make_smart<FsFileAccess>();
+    ModuleGroup dummyLibGroup;
+    auto program = compileDaScript(fn, fAccess, tout, dummyLibGroup);
+    if ( !program || program->failed() ) {
+        tout << "failed to compile\n";
+        if ( program ) {
+            for ( auto & err : program->errors ) {
+                tout << reportError(err.at, err.what, err.extra, err.fixme, err.cerr );
+            }
+        }
+        return false;
+    }
+    Context ctx(program->getContextStackSize());
+    if ( !program->simulate(ctx, tout) ) {
+        tout << "failed to simulate\n";
+        return false;
+    }
+    auto fnTest = ctx.findFunction("test");
+    if ( !fnTest ) {
+        tout << "function 'test' not found\n";
+        return false;
+    }
+    das_map<string,string> mangled;
+    for ( int i=0, is=ctx.getTotalFunctions(); i!=is; ++i ) {
+        auto sf = ctx.getFunction(i);
+        mangled[sf->name] = sf->mangledName;
+    }
+    bool ok = true;
+    auto expect = [&]( bool condition, const string & what ) {
+        if ( !condition ) {
+            if ( ok ) tout << "failed\n";
+            tout << "\t" << what << "\n";
+            ok = false;
+        }
+    };
+    // entries
+    ctx.setFunctionProfiler(true);
+    ctx.restart();
+    bool result = cast<bool>::to(ctx.eval(fnTest, nullptr));
+    expect(result && !ctx.getException(), "'test' failed with the profiler on");
+    auto profiler = ctx.getFunctionProfiler();
+    FunctionProfiler::Profile profile;
+    profiler->collect(profile);
+    auto calls = [&]( const char * name ) -> uint64_t {
+        auto it = profile.find(mangled[name]);
+        return it!=profile.end() ? it->second.calls : 0;
+    };
+    expect(calls("test")==1, "test is expected to be called once");
+    expect(calls("hot")==1, "hot is expected to be called once");
+    expect(calls("leaf")==1000, "leaf is expected to be called 1000 times");
+    expect(calls("cold")==3, "cold is expected to be called 3 times");
+    expect(profile.find(mangled["never"])==profile.end(), "never is not expected to be in the profile");
+    auto & testEntry = profile[mangled["test"]];
+    auto & hotEntry = profile[mangled["hot"]];
+    expect(testEntry.totalTicks>=hotEntry.totalTicks && hotEntry.totalTicks>=hotEntry.selfTicks, "total time is expected to include the callees");
+    // save and load
+    string profileName = "function_profile_test.txt";
+    expect(profiler->save(profileName), "can't save the profile");
+    FunctionProfiler::Profile loaded;
+    TextWriter logs;
+    expect(FunctionProfiler::load(profileName, loaded, logs), "can't load the profile " + logs.str());
+    expect(loaded.size()==profile.size(), "loaded profile has different number of entries");
+    for ( auto & it : profile ) {
+        auto lt = loaded.find(it.first);
+        expect(lt!=loaded.end() && lt->second.calls==it.second.calls && lt->second.selfTicks==it.second.selfTicks
+            && lt->second.totalTicks==it.second.totalTicks, "loaded entry differs for " + it.first);
+    }
+    // loading again adds up
+    FunctionProfiler::load(profileName, loaded, logs);
+    expect(loaded[mangled["leaf"]].calls==2000, "second load is expected to add to the first one");
+    remove(profileName.c_str());
+    ctx.setFunctionProfiler(false);
+    // hot set selection, on the profile with known times
+    auto selected = [&]( const char * name ) {
+        for ( auto & it : program->aotInterpreted ) {
+            if ( it->name==name ) return false;
+        }
+        return true;
+    };
+    FunctionProfiler::Profile synthetic;
+    synthetic[mangled["hot"]] = { 1, 900, 950 };
+    synthetic[mangled["cold"]] = { 3, 60, 60 };
+    synthetic[mangled["test"]] = { 1, 40, 1000 };
+    TextWriter report;
+    program->selectAotFromProfile(synthetic, 0.8, report);
+    expect(selected("hot") && selected("leaf"), "hot and its callee leaf are expected to be AOT at 80%");
+    expect(!selected("cold") && !selected("test") && !selected("never"), "cold, test, and never are expected to be interpreted at 80%");
+    program->aotInterpreted.clear();
+    program->selectAotFromProfile(synthetic, 0.95, report);
+    expect(selected("hot") && selected("leaf") && selected("cold"), "hot, leaf, and cold are expected to be AOT at 95%");
+    expect(!selected("test") && !selected("never"), "test and never are expected to be interpreted at 95%");
+    if ( ok ) tout << "ok\n";
+    return ok;
+}
+
+bool run_snapshot_test ( const string & fn ) {
+    tout << "testing CONTEXT SNAPSHOT at " << fn << " ";
+    auto fAccess = make_smart<FsFileAccess>();
+    ModuleGroup dummyLibGroup;
+    CodeOfPolicies policies;
+    auto program = compileDaScript(fn, fAccess, tout, dummyLibGroup, false, policies);
+    if ( !program || program->failed() ) {
+        tout << "failed to compile\n";
+        if ( program ) {
+            for ( auto & err : program->errors ) {
+                tout << reportError(err.at, err.what, err.extra, err.fixme, err.cerr );
+            }
+        }
+        return false;
+    }
+    bool ok = true;
+    auto expect = [&]( bool condition, const string & what ) {
+        if ( !condition ) {
+            if ( ok ) tout << "failed\n";
+            tout << "\t" << what << "\n";
+            ok = false;
+        }
+    };
+    auto run = [&]( Context & ctx ) {
+        auto fnTest = ctx.findFunction("test");
+        bool result = fnTest && cast<bool>::to(ctx.eval(fnTest, nullptr));
+        return result && !ctx.getException();
+    };
+    {
+        Context ctx(program->getContextStackSize());
+        if ( !program->simulate(ctx, tout) ) {
+            tout << "failed to simulate\n";
+            return false;
+        }
+        string errors;
+        expect(ctx.takeSnapshot(errors), "can't take snapshot, " + errors);
+        // every request changes the state, so only the first one passes without the restore
+        expect(run(ctx), "first request failed");
+        expect(!run(ctx), "second request is not expected to pass without the restore");
+        for ( int request=0; request!=3 && ok; ++request ) {
+            expect(ctx.restoreSnapshot(), "can't restore snapshot");
+            expect(run(ctx), "request failed after the restore");
+        }
+        ctx.dropSnapshot();
+        expect(!ctx.restoreSnapshot(), "restore is not expected to work after the snapshot is dropped");
+    }
+    {
+        // chain, which was freed by reset, can't be restored. even if the new chain starts at the same address
+        LinearChunkAllocator model;
+        model.setInitialSize(1024);
+        for ( int i=0; i!=16; ++i ) model.allocate(512);
+        LinearChunkSnapshot snap;
+        model.snapshot(snap);
+        expect(model.depth()>1, "expecting more than one chunk");
+        expect(model.restore(snap), "can't restore the chain it was taken from");
+        model.reset();
+        model.allocate(512);
+        expect(!model.restore(snap), "restore is not expected to work after the chain was freed");
+    }
+    {
+        // persistent heap can't be rewound
+        policies.persistent_heap = true;
+        auto pprogram = compileDaScript(fn, fAccess, tout, dummyLibGroup, false, policies);
+        expect(pprogram && !pprogram->failed(), "failed to compile with the persistent heap");
+        if ( pprogram && !pprogram->failed() ) {
+            Context ctx(pprogram->getContextStackSize());
+            expect(pprogram->simulate(ctx, tout), "failed to simulate with the persistent heap");
+            string errors;
+            expect(!ctx.takeSnapshot(errors) && !errors.empty(), "snapshot is expected to fail with the persistent heap");
+        }
+    }
+    if ( ok ) tout << "ok\n";
+    return ok;
+}
+
+bool run_image_test ( const string & fn ) {
+    tout << "testing CONTEXT IMAGE at " << fn << " ";
+    auto fAccess = make_smart<FsFileAccess>();
+    ModuleGroup dummyLibGroup;
+    CodeOfPolicies policies;
+    auto program = compileDaScript(fn, fAccess, tout, dummyLibGroup, false, policies);
+    if ( !program || program->failed() ) {
+        tout << "failed to compile\n";
+        if ( program ) {
+            for ( auto & err : program->errors ) {
+                tout << reportError(err.at, err.what, err.extra, err.fixme, err.cerr );
+            }
+        }
+        return false;
+    }
+    bool ok = true;
+    auto expect = [&]( bool condition, const string & what ) {
+        if ( !condition ) {
+            if ( ok ) tout << "failed\n";
+            tout << "\t" << what << "\n";
+            ok = false;
+        }
+    };
+    auto run = [&]( Context & ctx ) {
+        auto fnTest = ctx.findFunction("test");
+        bool result = fnTest && cast<bool>::to(ctx.eval(fnTest, nullptr));
+        return result && !ctx.getException();
+    };
+    vector<char> image;
+    {
+        Context ctx(program->getContextStackSize());
+        if ( !program->simulate(ctx, tout) ) {
+            tout << "failed to simulate\n";
+            return false;
+        }
+        string errors;
+        expect(ctx.saveImage(image, errors), "can't save image, " + errors);
+    }
+    if ( !ok ) return false;
+    {
+        // copy of the image
+        Context ctx(program->getContextStackSize());
+        string errors;
+        expect(ctx.loadImage(image.data(), image.size(), errors), "can't load image, " + errors);
+        expect(ok && run(ctx), "test failed in the context, loaded from the image");
+    }
+    {
+        string errors;
+        Context ctx(program->getContextStackSize());
+        expect(!ctx.loadImage(image.data(), image.size()/2, errors) && !errors.empty(), "truncated image is expected to fail");
+    }
+    {
+        // image, copied into the chunk region. one region for the test, sized by the image
+        auto region = make_shared<ChunkRegion>(uint64_t(image.size()) + 1024*1024);
+        Context ctx(program->getContextStackSize());
+        ctx.setChunkRegion(region);
+        string errors;
+        expect(ctx.loadImage(image.data(), image.size(), errors), "can't load image into the chunk region, " + errors);
+        expect(region->bytesAllocated()!=0, "code is expected to be placed in the chunk region");
+        expect(ok && run(ctx), "test failed in the context, loaded into the chunk region");
+    }
+    {
+        // image file, which is mapped in place. both contexts map the same file
+        string imageFile = "image_test.img";
+        FILE * f = fopen(imageFile.c_str(), "wb");
+        expect(f && fwrite(image.data(), 1, image.size(), f)==image.size(), "can't write " + imageFile);
+        if ( f ) fclose(f);
+        string errors;
+        {
+            Context ctxA(program->getContextStackSize());
+            Context ctxB(program->getContextStackSize());
+            expect(ctxA.loadImageFile(imageFile, errors), "can't load image file, " + errors);
+            expect(ctxB.loadImageFile(imageFile, errors), "can't load image file twice, " + errors);
+            expect(ok && run(ctxA), "test failed in the context, loaded from the image file");
+            expect(ok && run(ctxB), "test failed in the second context, loaded from the image file");
+        }
+        remove(imageFile.c_str());
+        Context ctx(program->getContextStackSize());
+        expect(!ctx.loadImageFile(imageFile, errors), "missing image file is expected to fail");
+    }
+    if ( ok ) tout << "ok\n";
+    return ok;
+}
+
 int main( int argc, char * argv[] ) {
     if ( argc>2 ) {
         tout << "daScriptTest [pathToDasRoot]\n";
@@ -434,6 +690,9 @@ int main( int argc, char * argv[] ) {
     ok = run_module_test(getDasRoot() +  "/examples/test/module", "main_default.das", false) && ok;
     ok = run_module_test(getDasRoot() +  "/examples/test/module/alias", "main.das", true) && ok;
     ok = run_module_test(getDasRoot() +  "/examples/test/module/cdp", "main.das", true) && ok;
+    ok = run_profile_test(getDasRoot() +  "/examples/test/profile/profile_test.das") && ok;
+    ok = run_snapshot_test(getDasRoot() +  "/examples/test/snapshot/snapshot_test.das") && ok;
+    ok = run_image_test(getDasRoot() +  "/examples/test/image/image_test.das") && ok;
     int usec = get_time_usec(timeStamp);
     tout << "TESTS " << (ok ? "PASSED " : "FAILED!!! ") << ((usec/1000)/1000.0) << "\n";
     // shutdown
@@ -0,0 +1,256 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require _apply_macro
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require strings_boost
+ // require ast_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_1645631803504489460 {
+
+
+
+namespace _apply_macro { struct AppendCondAnnotation; };
+namespace ast { struct AstFunctionAnnotation; };
+namespace ast { struct AstBlockAnnotation; };
+namespace ast { struct AstStructureAnnotation; };
+namespace ast { struct AstPassMacro; };
+namespace ast { struct AstVariantMacro; };
+namespace ast { struct AstReaderMacro; };
+namespace ast { struct AstCommentReader; };
+namespace ast { struct AstCallMacro; };
+namespace ast { struct AstTypeInfoMacro; };
+namespace ast { struct AstEnumerationAnnotation; };
+namespace ast { struct AstVisitor; };
+namespace ast_boost { struct MacroMacro; };
+namespace ast_boost { struct TagFunctionAnnotation; };
+namespace ast_boost { struct TagStructureAnnotation; };
+namespace ast_boost { struct SetupAnyAnnotation; };
+namespace ast_boost { struct SetupFunctionAnnotatoin; };
+namespace ast_boost { struct SetupBlockAnnotatoin; };
+namespace ast_boost { struct SetupStructureAnnotatoin; };
+namespace ast_boost { struct SetupEnumerationAnnotation; };
+namespace ast_boost { struct SetupContractAnnotatoin; };
+namespace ast_boost { struct SetupReaderMacro; };
+namespace ast_boost { struct SetupCommentReader; };
+namespace ast_boost { struct SetupVariantMacro; };
+namespace ast_boost { struct SetupCallMacro; };
+namespace ast_boost { struct SetupTypeInfoMacro; };
+namespace ast_boost { struct SetupInferMacro; };
+namespace ast_boost { struct SetupDirtyInferMacro; };
+namespace ast_boost { struct SetupLintMacro; };
+namespace ast_boost { struct SetupGlobalLintMacro; };
+namespace ast_boost { struct SetupOptimizationMacro; };
+namespace ast_boost { struct TagFunctionMacro; };
+namespace ast_boost { struct BetterRttiVisitor; };
+// unused enumeration CompilationError
+// unused enumeration Type
+// unused enumeration RefMatters
+// unused enumeration ConstMatters
+// unused enumeration TemporaryMatters
+// unused enumeration SideEffects
+// unused enumeration CaptureMode
+namespace ast {
+
+struct AstFunctionAnnotation {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) verifyCall;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string,bool &)) patch;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) fixup;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) lint;
+	Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,smart_ptr_raw<Context>)) complete;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,das::vector<smart_ptr<TypeDecl>>,AnnotationDeclaration const ,das::string)) isCompatible;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation)) isSpecialized;
+};
+static_assert(sizeof(AstFunctionAnnotation)==96,"structure size mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,transform)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,verifyCall)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,apply)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,finish)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,patch)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,fixup)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,lint)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,complete)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,isCompatible)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,isSpecialized)==88,"structure field offset mismatch with DAS");
+}
+// unused structure AstBlockAnnotation
+// unused structure AstStructureAnnotation
+// unused structure AstPassMacro
+// unused structure AstVariantMacro
+// unused structure AstReaderMacro
+// unused structure AstCommentReader
+// unused structure AstCallMacro
+// unused structure AstTypeInfoMacro
+// unused structure AstEnumerationAnnotation
+// unused structure AstVisitor
+// unused structure MacroMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagStructureAnnotation
+// unused structure SetupAnyAnnotation
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupBlockAnnotatoin
+// unused structure SetupStructureAnnotatoin
+// unused structure SetupEnumerationAnnotation
+// unused structure SetupContractAnnotatoin
+// unused structure SetupReaderMacro
+// unused structure SetupCommentReader
+// unused structure SetupVariantMacro
+// unused structure SetupCallMacro
+// unused structure SetupTypeInfoMacro
+// unused structure SetupInferMacro
+// unused structure SetupDirtyInferMacro
+// unused structure SetupLintMacro
+// unused structure SetupGlobalLintMacro
+// unused structure SetupOptimizationMacro
+// unused structure TagFunctionMacro
+// unused structure BetterRttiVisitor
+namespace _apply_macro {
+
+struct AppendCondAnnotation {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) verifyCall;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string,bool &)) patch;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) fixup;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) lint;
+	Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,smart_ptr_raw<Context>)) complete;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,das::vector<smart_ptr<TypeDecl>>,AnnotationDeclaration const ,das::string)) isCompatible;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation)) isSpecialized;
+};
+static_assert(sizeof(AppendCondAnnotation)==96,"structure size mismatch with DAS");
+static_assert(offsetof(AppendCondAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendCondAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendCondAnnotation,transform)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendCondAnnotation,verifyCall)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendCondAnnotation,apply)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendCondAnnotation,finish)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendCondAnnotation,patch)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendCondAnnotation,fixup)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendCondAnnotation,lint)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendCondAnnotation,complete)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendCondAnnotation,isCompatible)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendCondAnnotation,isSpecialized)==88,"structure field offset mismatch with DAS");
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_f67d9a5af7c3ef93 ( Context * __context__, _apply_macro::AppendCondAnnotation const  & __cl_rename_at_86 );
+inline void clone_b39c30844f6e73f0 ( Context * __context__, smart_ptr<Expression> & __dest_rename_at_10, smart_ptr<Expression> const  __src_rename_at_10 );
+inline void prepend_cond_be2e5ecd7308e345 ( Context * __context__, smart_ptr_raw<Function> __fn_rename_at_6, char * const  __cond_rename_at_6 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_f67d9a5af7c3ef93 ( Context * __context__, _apply_macro::AppendCondAnnotation const  &  __cl_rename_at_86 )
+{
+	return das_auto_cast<StructInfo const  *>::cast(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo const  *>::cast(__cl_rename_at_86.__rtti)->structType /*structType*/));
+}
+
+inline void clone_b39c30844f6e73f0 ( Context * __context__, smart_ptr<Expression> & __dest_rename_at_10, smart_ptr<Expression> const  __src_rename_at_10 )
+{
+	builtin_smart_ptr_clone(das_auto_cast<smart_ptr_raw<void> &>::cast(__dest_rename_at_10),das_auto_cast<smart_ptr_raw<void> const >::cast(__src_rename_at_10));
+}
+
+inline void prepend_cond_be2e5ecd7308e345 ( Context * __context__, smart_ptr_raw<Function> __fn_rename_at_6, char * const  __cond_rename_at_6 ) { das_stack_prologue __prologue(__context__,272,"prepend_cond " DAS_FILE_LINE);
+{
+	smart_ptr<Expression> __iblk_rename_at_7; das_zero(__iblk_rename_at_7); das_move(__iblk_rename_at_7, __fn_rename_at_6->body /*body*/);
+	smart_ptr_raw<ExprBlock> __blk_rename_at_8; das_zero(__blk_rename_at_8); das_move(__blk_rename_at_8, das_ascend_handle<true,smart_ptr_raw<ExprBlock>>::make(__context__,nullptr,(([&](ExprBlock & __mks_8) {
+		das_copy((__mks_8.at /*at*/),(__fn_rename_at_6->at /*at*/));
+	}))));
+	smart_ptr_raw<ExprCall> __ifm_rename_at_9; das_zero(__ifm_rename_at_9); das_move(__ifm_rename_at_9, das_ascend_handle<true,smart_ptr_raw<ExprCall>>::make(__context__,nullptr,(([&](ExprCall & __mks_9) {
+		das_copy((__mks_9.at /*at*/),(__fn_rename_at_6->at /*at*/));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_9.name /*name*/),__cond_rename_at_6);
+		}	}))));
+	smart_ptr_raw<ExprIfThenElse> __ife_rename_at_10; das_zero(__ife_rename_at_10); das_move(__ife_rename_at_10, das_ascend_handle<true,smart_ptr_raw<ExprIfThenElse>>::make(__context__,nullptr,(([&](ExprIfThenElse & __mks_10) {
+		das_copy((__mks_10.at /*at*/),(__fn_rename_at_6->at /*at*/));
+		das_move((__mks_10.cond /*cond*/),(__ifm_rename_at_9));
+		{
+			clone_b39c30844f6e73f0(__context__,__mks_10.if_true /*if_true*/,__iblk_rename_at_7);
+		}	}))));
+	das_vector_emplace_back(das_arg<das::vector<smart_ptr<Expression>>>::pass(__blk_rename_at_8->list /*list*/),das_reinterpret<smart_ptr<Expression>>::pass(__ife_rename_at_10));
+	das_move(__fn_rename_at_6->body /*body*/,__blk_rename_at_8);
+}}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcrtti_0x60_class_info_f67d9a5af7c3ef93
+	aotLib[0x61c5403ba2a8ef4d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, _apply_macro::AppendCondAnnotation const  &  ),&_Funcrtti_0x60_class_info_f67d9a5af7c3ef93>>();
+	};
+	// clone_b39c30844f6e73f0
+	aotLib[0xd452a6a2baae4df1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr<Expression> & , smart_ptr<Expression> const   ),&clone_b39c30844f6e73f0>>();
+	};
+	// prepend_cond_be2e5ecd7308e345
+	aotLib[0x5abdfae78b01dcf2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr_raw<Function> , char * const   ),&prepend_cond_be2e5ecd7308e345>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,188 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require _array_reader
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require strings_boost
+ // require ast_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_1216092435259489440 {
+
+
+
+namespace _array_reader { struct ArrayReader; };
+namespace ast { struct AstFunctionAnnotation; };
+namespace ast { struct AstBlockAnnotation; };
+namespace ast { struct AstStructureAnnotation; };
+namespace ast { struct AstPassMacro; };
+namespace ast { struct AstVariantMacro; };
+namespace ast { struct AstReaderMacro; };
+namespace ast { struct AstCommentReader; };
+namespace ast { struct AstCallMacro; };
+namespace ast { struct AstTypeInfoMacro; };
+namespace ast { struct AstEnumerationAnnotation; };
+namespace ast { struct AstVisitor; };
+namespace ast_boost { struct MacroMacro; };
+namespace ast_boost { struct TagFunctionAnnotation; };
+namespace ast_boost { struct TagStructureAnnotation; };
+namespace ast_boost { struct SetupAnyAnnotation; };
+namespace ast_boost { struct SetupFunctionAnnotatoin; };
+namespace ast_boost { struct SetupBlockAnnotatoin; };
+namespace ast_boost { struct SetupStructureAnnotatoin; };
+namespace ast_boost { struct SetupEnumerationAnnotation; };
+namespace ast_boost { struct SetupContractAnnotatoin; };
+namespace ast_boost { struct SetupReaderMacro; };
+namespace ast_boost { struct SetupCommentReader; };
+namespace ast_boost { struct SetupVariantMacro; };
+namespace ast_boost { struct SetupCallMacro; };
+namespace ast_boost { struct SetupTypeInfoMacro; };
+namespace ast_boost { struct SetupInferMacro; };
+namespace ast_boost { struct SetupDirtyInferMacro; };
+namespace ast_boost { struct SetupLintMacro; };
+namespace ast_boost { struct SetupGlobalLintMacro; };
+namespace ast_boost { struct SetupOptimizationMacro; };
+namespace ast_boost { struct TagFunctionMacro; };
+namespace ast_boost { struct BetterRttiVisitor; };
+// unused enumeration CompilationError
+// unused enumeration Type
+// unused enumeration RefMatters
+// unused enumeration ConstMatters
+// unused enumeration TemporaryMatters
+// unused enumeration SideEffects
+// unused enumeration CaptureMode
+// unused structure AstFunctionAnnotation
+// unused structure AstBlockAnnotation
+// unused structure AstStructureAnnotation
+// unused structure AstPassMacro
+// unused structure AstVariantMacro
+namespace ast {
+
+struct AstReaderMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstReaderMacro)) __finalize;
+	Func DAS_COMMENT((bool,ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,ExprReader * const ,int32_t,LineInfo const )) accept;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprReader> const )) visit;
+};
+static_assert(sizeof(AstReaderMacro)==32,"structure size mismatch with DAS");
+static_assert(offsetof(AstReaderMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstReaderMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstReaderMacro,accept)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstReaderMacro,visit)==24,"structure field offset mismatch with DAS");
+}
+// unused structure AstCommentReader
+// unused structure AstCallMacro
+// unused structure AstTypeInfoMacro
+// unused structure AstEnumerationAnnotation
+// unused structure AstVisitor
+// unused structure MacroMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagStructureAnnotation
+// unused structure SetupAnyAnnotation
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupBlockAnnotatoin
+// unused structure SetupStructureAnnotatoin
+// unused structure SetupEnumerationAnnotation
+// unused structure SetupContractAnnotatoin
+// unused structure SetupReaderMacro
+// unused structure SetupCommentReader
+// unused structure SetupVariantMacro
+// unused structure SetupCallMacro
+// unused structure SetupTypeInfoMacro
+// unused structure SetupInferMacro
+// unused structure SetupDirtyInferMacro
+// unused structure SetupLintMacro
+// unused structure SetupGlobalLintMacro
+// unused structure SetupOptimizationMacro
+// unused structure TagFunctionMacro
+// unused structure BetterRttiVisitor
+namespace _array_reader {
+
+struct ArrayReader {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstReaderMacro)) __finalize;
+	Func DAS_COMMENT((bool,ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,ExprReader * const ,int32_t,LineInfo const )) accept;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprReader> const )) visit;
+};
+static_assert(sizeof(ArrayReader)==32,"structure size mismatch with DAS");
+static_assert(offsetof(ArrayReader,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(ArrayReader,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(ArrayReader,accept)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(ArrayReader,visit)==24,"structure field offset mismatch with DAS");
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_7af0187624083e0 ( Context * __context__, _array_reader::ArrayReader const  & __cl_rename_at_86 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_7af0187624083e0 ( Context * __context__, _array_reader::ArrayReader const  &  __cl_rename_at_86 )
+{
+	return das_auto_cast<StructInfo const  *>::cast(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo const  *>::cast(__cl_rename_at_86.__rtti)->structType /*structType*/));
+}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcrtti_0x60_class_info_7af0187624083e0
+	aotLib[0x5ca0386237261be5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, _array_reader::ArrayReader const  &  ),&_Funcrtti_0x60_class_info_7af0187624083e0>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
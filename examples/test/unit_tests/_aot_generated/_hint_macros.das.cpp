@@ -0,0 +1,303 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require _hint_macros
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require strings_boost
+ // require ast_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_5337013949112553388 {
+
+extern TypeInfo __type_info__90f3d07b5a6ca13;
+
+TypeInfo __type_info__90f3d07b5a6ca13 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, 0x90f3d07b5a6ca13ul };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__90f3d07b5a6ca13 };
+namespace _hint_macros { struct HintLookup; };
+namespace _hint_macros { struct GetHintFnMacro; };
+namespace ast { struct AstFunctionAnnotation; };
+namespace ast { struct AstBlockAnnotation; };
+namespace ast { struct AstStructureAnnotation; };
+namespace ast { struct AstPassMacro; };
+namespace ast { struct AstVariantMacro; };
+namespace ast { struct AstReaderMacro; };
+namespace ast { struct AstCommentReader; };
+namespace ast { struct AstCallMacro; };
+namespace ast { struct AstTypeInfoMacro; };
+namespace ast { struct AstEnumerationAnnotation; };
+namespace ast { struct AstVisitor; };
+namespace ast_boost { struct MacroMacro; };
+namespace ast_boost { struct TagFunctionAnnotation; };
+namespace ast_boost { struct TagStructureAnnotation; };
+namespace ast_boost { struct SetupAnyAnnotation; };
+namespace ast_boost { struct SetupFunctionAnnotatoin; };
+namespace ast_boost { struct SetupBlockAnnotatoin; };
+namespace ast_boost { struct SetupStructureAnnotatoin; };
+namespace ast_boost { struct SetupEnumerationAnnotation; };
+namespace ast_boost { struct SetupContractAnnotatoin; };
+namespace ast_boost { struct SetupReaderMacro; };
+namespace ast_boost { struct SetupCommentReader; };
+namespace ast_boost { struct SetupVariantMacro; };
+namespace ast_boost { struct SetupCallMacro; };
+namespace ast_boost { struct SetupTypeInfoMacro; };
+namespace ast_boost { struct SetupInferMacro; };
+namespace ast_boost { struct SetupDirtyInferMacro; };
+namespace ast_boost { struct SetupLintMacro; };
+namespace ast_boost { struct SetupGlobalLintMacro; };
+namespace ast_boost { struct SetupOptimizationMacro; };
+namespace ast_boost { struct TagFunctionMacro; };
+namespace ast_boost { struct BetterRttiVisitor; };
+// unused enumeration CompilationError
+// unused enumeration Type
+// unused enumeration RefMatters
+// unused enumeration ConstMatters
+// unused enumeration TemporaryMatters
+// unused enumeration SideEffects
+// unused enumeration CaptureMode
+namespace ast {
+
+struct AstFunctionAnnotation {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) verifyCall;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string,bool &)) patch;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) fixup;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) lint;
+	Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,smart_ptr_raw<Context>)) complete;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,das::vector<smart_ptr<TypeDecl>>,AnnotationDeclaration const ,das::string)) isCompatible;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation)) isSpecialized;
+};
+static_assert(sizeof(AstFunctionAnnotation)==96,"structure size mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,transform)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,verifyCall)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,apply)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,finish)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,patch)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,fixup)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,lint)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,complete)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,isCompatible)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,isSpecialized)==88,"structure field offset mismatch with DAS");
+}
+// unused structure AstBlockAnnotation
+// unused structure AstStructureAnnotation
+// unused structure AstPassMacro
+// unused structure AstVariantMacro
+// unused structure AstReaderMacro
+// unused structure AstCommentReader
+// unused structure AstCallMacro
+// unused structure AstTypeInfoMacro
+// unused structure AstEnumerationAnnotation
+// unused structure AstVisitor
+// unused structure MacroMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagStructureAnnotation
+// unused structure SetupAnyAnnotation
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupBlockAnnotatoin
+// unused structure SetupStructureAnnotatoin
+// unused structure SetupEnumerationAnnotation
+// unused structure SetupContractAnnotatoin
+// unused structure SetupReaderMacro
+// unused structure SetupCommentReader
+// unused structure SetupVariantMacro
+// unused structure SetupCallMacro
+// unused structure SetupTypeInfoMacro
+// unused structure SetupInferMacro
+// unused structure SetupDirtyInferMacro
+// unused structure SetupLintMacro
+// unused structure SetupGlobalLintMacro
+// unused structure SetupOptimizationMacro
+// unused structure TagFunctionMacro
+// unused structure BetterRttiVisitor
+namespace _hint_macros {
+
+struct HintLookup {
+	TTable<uint64_t,char *> tab;
+};
+static_assert(sizeof(HintLookup)==48,"structure size mismatch with DAS");
+static_assert(offsetof(HintLookup,tab)==0,"structure field offset mismatch with DAS");
+}
+namespace _hint_macros {
+
+struct GetHintFnMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) verifyCall;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string,bool &)) patch;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) fixup;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) lint;
+	Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,smart_ptr_raw<Context>)) complete;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,das::vector<smart_ptr<TypeDecl>>,AnnotationDeclaration const ,das::string)) isCompatible;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation)) isSpecialized;
+};
+static_assert(sizeof(GetHintFnMacro)==96,"structure size mismatch with DAS");
+static_assert(offsetof(GetHintFnMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(GetHintFnMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(GetHintFnMacro,transform)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(GetHintFnMacro,verifyCall)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(GetHintFnMacro,apply)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(GetHintFnMacro,finish)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(GetHintFnMacro,patch)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(GetHintFnMacro,fixup)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(GetHintFnMacro,lint)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(GetHintFnMacro,complete)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(GetHintFnMacro,isCompatible)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(GetHintFnMacro,isSpecialized)==88,"structure field offset mismatch with DAS");
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_ef6041b163026cc9 ( Context * __context__, _hint_macros::GetHintFnMacro const  & __cl_rename_at_86 );
+inline void clone_d6dbc3764a059afc ( Context * __context__, smart_ptr_raw<ExprCallFunc> & __dest_rename_at_239, smart_ptr_raw<ExprCallFunc> const  __src_rename_at_239 );
+inline smart_ptr_raw<ExprCallFunc> _Funcbuiltin_0x60_clone_to_move_c3192518ca661f1b ( Context * __context__, smart_ptr_raw<ExprCallFunc> const  __clone_src_rename_at_236 );
+inline smart_ptr_raw<FunctionAnnotation> _Funcast_0x60_make_function_annotation_d2cda343f9068ae5 ( Context * __context__, char * const  __name_rename_at_517, _hint_macros::GetHintFnMacro * const  __someClassPtr_rename_at_517 );
+inline void _Funcast_boost_0x60_setup_tag_annotation_bd2901c505f3b822 ( Context * __context__, char * const  __name_rename_at_164, char * const  __tag_rename_at_164, _hint_macros::GetHintFnMacro * const  __classPtr_rename_at_164 );
+inline char * const  get_hint_2a1894f54fd39035 ( Context * __context__, _hint_macros::HintLookup const  & __lookup_rename_at_13, char * const  __id_rename_at_13, char * const  __defv_rename_at_13, uint64_t __hint_rename_at_13 );
+inline char * const  get_hint_9f148e8b251850aa ( Context * __context__, _hint_macros::HintLookup const  & __lookup_rename_at_17, char * const  __id_rename_at_17, char * const  __defv_rename_at_17 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int32_t,0x4fa09e68109b5258>(__context__) = 0;/*g_non_hints*/
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_ef6041b163026cc9 ( Context * __context__, _hint_macros::GetHintFnMacro const  &  __cl_rename_at_86 )
+{
+	return das_auto_cast<StructInfo const  *>::cast(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo const  *>::cast(__cl_rename_at_86.__rtti)->structType /*structType*/));
+}
+
+inline void clone_d6dbc3764a059afc ( Context * __context__, smart_ptr_raw<ExprCallFunc> & __dest_rename_at_239, smart_ptr_raw<ExprCallFunc> const  __src_rename_at_239 )
+{
+	builtin_smart_ptr_clone(das_auto_cast<smart_ptr_raw<void> &>::cast(__dest_rename_at_239),das_auto_cast<smart_ptr_raw<void> const >::cast(__src_rename_at_239));
+}
+
+inline smart_ptr_raw<ExprCallFunc> _Funcbuiltin_0x60_clone_to_move_c3192518ca661f1b ( Context * __context__, smart_ptr_raw<ExprCallFunc> const  __clone_src_rename_at_236 )
+{
+	smart_ptr_raw<ExprCallFunc> __clone_dest_rename_at_238; das_zero(__clone_dest_rename_at_238);
+	clone_d6dbc3764a059afc(__context__,__clone_dest_rename_at_238,__clone_src_rename_at_236);
+	return /* <- */ das_auto_cast_move<smart_ptr_raw<ExprCallFunc>>::cast(__clone_dest_rename_at_238);
+}
+
+inline smart_ptr_raw<FunctionAnnotation> _Funcast_0x60_make_function_annotation_d2cda343f9068ae5 ( Context * __context__, char * const  __name_rename_at_517, _hint_macros::GetHintFnMacro * const  __someClassPtr_rename_at_517 )
+{
+	StructInfo const  * __classInfo_rename_at_519 = ((StructInfo const  *)_Funcrtti_0x60_class_info_ef6041b163026cc9(__context__,das_deref(__context__,__someClassPtr_rename_at_517)));
+	return das_auto_cast<smart_ptr_raw<FunctionAnnotation>>::cast(makeFunctionAnnotation(__name_rename_at_517,das_auto_cast<void * const >::cast(__someClassPtr_rename_at_517),__classInfo_rename_at_519,__context__));
+}
+
+inline void _Funcast_boost_0x60_setup_tag_annotation_bd2901c505f3b822 ( Context * __context__, char * const  __name_rename_at_164, char * const  __tag_rename_at_164, _hint_macros::GetHintFnMacro * const  __classPtr_rename_at_164 )
+{
+	smart_ptr_raw<FunctionAnnotation> __ann_rename_at_165; das_zero(__ann_rename_at_165); das_move(__ann_rename_at_165, _Funcast_0x60_make_function_annotation_d2cda343f9068ae5(__context__,__name_rename_at_164,__classPtr_rename_at_164));
+	das_invoke_function<void>::invoke<char * const ,smart_ptr_raw<FunctionAnnotation> const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@ast_boost::apply_tag_annotation Cs CY<FunctionAnnotationPtr>1<H<ast::FunctionAnnotation>>?M*/ 12615543767023261603u)),__tag_rename_at_164,__ann_rename_at_165);
+	addModuleFunctionAnnotation(thisModule(__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__ann_rename_at_165,__context__);
+}
+
+inline char * const  get_hint_2a1894f54fd39035 ( Context * __context__, _hint_macros::HintLookup const  &  __lookup_rename_at_13, char * const  __id_rename_at_13, char * const  __defv_rename_at_13, uint64_t __hint_rename_at_13 )
+{
+	return das_auto_cast<char * const >::cast(das_null_coalescing<char * const >::get(TTable<uint64_t,char *>::safe_index(&(__lookup_rename_at_13.tab),__hint_rename_at_13,__context__),__defv_rename_at_13));
+}
+
+inline char * const  get_hint_9f148e8b251850aa ( Context * __context__, _hint_macros::HintLookup const  &  __lookup_rename_at_17, char * const  __id_rename_at_17, char * const  __defv_rename_at_17 )
+{
+	++das_global<int32_t,0x4fa09e68109b5258>(__context__) /*g_non_hints*/;
+	return das_auto_cast<char * const >::cast(get_hint_2a1894f54fd39035(__context__,__lookup_rename_at_17,__id_rename_at_17,__defv_rename_at_17,das_call_interop<uint64_t>::call(&_builtin_hash,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<char * const >::from(__id_rename_at_17)))));
+}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcrtti_0x60_class_info_ef6041b163026cc9
+	aotLib[0x524709d9136f4cb1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, _hint_macros::GetHintFnMacro const  &  ),&_Funcrtti_0x60_class_info_ef6041b163026cc9>>();
+	};
+	// clone_d6dbc3764a059afc
+	aotLib[0xeef0c8e9bfe78dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr_raw<ExprCallFunc> & , smart_ptr_raw<ExprCallFunc> const   ),&clone_d6dbc3764a059afc>>();
+	};
+	// _Funcbuiltin_0x60_clone_to_move_c3192518ca661f1b
+	aotLib[0xc765081bf304f642] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<ExprCallFunc> (*) ( Context * __context__, smart_ptr_raw<ExprCallFunc> const   ),&_Funcbuiltin_0x60_clone_to_move_c3192518ca661f1b>>();
+	};
+	// _Funcast_0x60_make_function_annotation_d2cda343f9068ae5
+	aotLib[0x86543e93b712e208] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<FunctionAnnotation> (*) ( Context * __context__, char * const  , _hint_macros::GetHintFnMacro * const   ),&_Funcast_0x60_make_function_annotation_d2cda343f9068ae5>>();
+	};
+	// _Funcast_boost_0x60_setup_tag_annotation_bd2901c505f3b822
+	aotLib[0xc57fc98ee7b787bf] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , char * const  , _hint_macros::GetHintFnMacro * const   ),&_Funcast_boost_0x60_setup_tag_annotation_bd2901c505f3b822>>();
+	};
+	// get_hint_2a1894f54fd39035
+	aotLib[0xd7f372266df4593d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, _hint_macros::HintLookup const  & , char * const  , char * const  , uint64_t  ),&get_hint_2a1894f54fd39035>>();
+	};
+	// get_hint_9f148e8b251850aa
+	aotLib[0x1a220488c5383281] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, _hint_macros::HintLookup const  & , char * const  , char * const   ),&get_hint_9f148e8b251850aa>>();
+	};
+	// [[ init script ]]
+	aotLib[0xd4dc0b39a96ec70c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,115 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require _module_b
+ // require _module_a
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_11046432464310959288 {
+
+
+
+
+inline char * const  fun_1_5bc6076986f97b6b ( Context * __context__ );
+inline char * const  fun_5_5bc6076986f97b6b ( Context * __context__ );
+inline char * const  from_b_get_fun_3_7187ced07e258786 ( Context * __context__ );
+inline bool test_b0087d371648db3f ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<char *,0xe74fff8ae2812e31>(__context__) = ((char *) "from_b");/*global_1*/
+	das_global<char *,0x129fc48afb09c742>(__context__) = ((char *) "from_b");/*global_4*/
+}
+
+inline char * const  fun_1_5bc6076986f97b6b ( Context * __context__ )
+{
+	return das_auto_cast<char * const >::cast(((char *) "from_b"));
+}
+
+inline char * const  fun_5_5bc6076986f97b6b ( Context * __context__ )
+{
+	return das_auto_cast<char * const >::cast(((char *) "from_b"));
+}
+
+inline char * const  from_b_get_fun_3_7187ced07e258786 ( Context * __context__ )
+{
+	return das_auto_cast<char * const >::cast(((char *) "from_a"));
+}
+
+inline bool test_b0087d371648db3f ( Context * __context__ )
+{
+	return das_auto_cast<bool>::cast(true);
+}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// fun_1_5bc6076986f97b6b
+	aotLib[0x6032d7a713896449] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__ ),&fun_1_5bc6076986f97b6b>>();
+	};
+	// fun_5_5bc6076986f97b6b
+	aotLib[0x6032d7a713896449] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__ ),&fun_5_5bc6076986f97b6b>>();
+	};
+	// from_b_get_fun_3_7187ced07e258786
+	aotLib[0xf68a79edb98d1895] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__ ),&from_b_get_fun_3_7187ced07e258786>>();
+	};
+	// test_b0087d371648db3f
+	aotLib[0x434f546c6487b225] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_b0087d371648db3f>>();
+	};
+	// [[ init script ]]
+	aotLib[0x5906ca6ce934b4d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,2 @@
+// AOT disabled due to options no_aot=true. There are no modules which require no_aot
+
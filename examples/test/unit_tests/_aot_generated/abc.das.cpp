@@ -0,0 +1,112 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require _c
+ // require _b
+ // require _a
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_1389485635841911644 {
+
+
+
+
+inline bool _Func_c_0x60_c_func_8874bb1619c07f3a ( Context * __context__, int32_t __arg_rename_at_4 );
+inline bool _Func_b_0x60_b_func_1ddb50b3cdf13ed3 ( Context * __context__, int32_t __arg_rename_at_6 );
+inline bool _Func_a_0x60_a_func_8c137f1bdbef435d ( Context * __context__, int32_t __arg_rename_at_6 );
+inline bool test_eb93a74e05703c37 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool _Func_c_0x60_c_func_8874bb1619c07f3a ( Context * __context__, int32_t __arg_rename_at_4 )
+{
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline bool _Func_b_0x60_b_func_1ddb50b3cdf13ed3 ( Context * __context__, int32_t __arg_rename_at_6 )
+{
+	_Func_c_0x60_c_func_8874bb1619c07f3a(__context__,__arg_rename_at_6);
+	return das_auto_cast<bool>::cast(_Func_c_0x60_c_func_8874bb1619c07f3a(__context__,__arg_rename_at_6));
+}
+
+inline bool _Func_a_0x60_a_func_8c137f1bdbef435d ( Context * __context__, int32_t __arg_rename_at_6 )
+{
+	return das_auto_cast<bool>::cast(_Func_b_0x60_b_func_1ddb50b3cdf13ed3(__context__,__arg_rename_at_6));
+}
+
+inline bool test_eb93a74e05703c37 ( Context * __context__ )
+{
+	DAS_VERIFY((_Func_a_0x60_a_func_8c137f1bdbef435d(__context__,13)));
+	return das_auto_cast<bool>::cast(true);
+}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Func_c_0x60_c_func_8874bb1619c07f3a
+	aotLib[0xb399ef8ec080f0cd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, int32_t  ),&_Func_c_0x60_c_func_8874bb1619c07f3a>>();
+	};
+	// _Func_b_0x60_b_func_1ddb50b3cdf13ed3
+	aotLib[0x21b4f7b14c971986] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, int32_t  ),&_Func_b_0x60_b_func_1ddb50b3cdf13ed3>>();
+	};
+	// _Func_a_0x60_a_func_8c137f1bdbef435d
+	aotLib[0xcd7638d9270f2892] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, int32_t  ),&_Func_a_0x60_a_func_8c137f1bdbef435d>>();
+	};
+	// test_eb93a74e05703c37
+	aotLib[0x8697de8d62d232b9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_eb93a74e05703c37>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,242 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_3233722859600412651 {
+
+extern StructInfo __struct_info__38a16ad736a26473;
+extern StructInfo __struct_info__a509ab184e601d3c;
+extern TypeInfo __type_info__1c74d6ac3d1a513a;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__293c013eba484379;
+extern TypeInfo __type_info__84e5d899bedbac24;
+extern VarInfo __var_info__2a6bd6bca3257e95;
+extern VarInfo __var_info__89b146f5312358dd;
+extern VarInfo __var_info__4fbfa4d39d6f9213;
+extern VarInfo __var_info__fe864f563fb90aca;
+extern VarInfo __var_info__39798b77f5eea1f0;
+extern VarInfo __var_info__ef20a82b7e6d690f;
+extern VarInfo __var_info__ffcb5c4ceaff5914;
+extern VarInfo __var_info__3cb94a6a001f4523;
+
+TypeInfo * __type_info__39798b77f5eea1f0_arg_types_var_4080660209941505139[1] = { &__type_info__84e5d899bedbac24 };
+VarInfo __struct_info__38a16ad736a26473_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__39798b77f5eea1f0_arg_types_var_4080660209941505139, nullptr, 1, 0, nullptr, 28, 8, 0x39798b77f5eea1f0ul, "__lambda", 0 };
+TypeInfo * __type_info__2a6bd6bca3257e95_arg_types_var_4080660209941505139[1] = { &__type_info__1c74d6ac3d1a513a };
+VarInfo __struct_info__38a16ad736a26473_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__2a6bd6bca3257e95_arg_types_var_4080660209941505139, nullptr, 1, 0, nullptr, 28, 8, 0x2a6bd6bca3257e95ul, "__finalize", 8 };
+VarInfo __struct_info__38a16ad736a26473_field_2 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__293c013eba484379, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, 0x3cb94a6a001f4523ul, "self", 16 };
+VarInfo * __struct_info__38a16ad736a26473_fields[3] =  { &__struct_info__38a16ad736a26473_field_0, &__struct_info__38a16ad736a26473_field_1, &__struct_info__38a16ad736a26473_field_2 };
+StructInfo __struct_info__38a16ad736a26473 = {(char*)"_lambda_thismodule_6_12_1", (char*)"", 14, __struct_info__38a16ad736a26473_fields, 3, 24, 0x0ul, nullptr, 0x38a16ad736a26473ul };
+VarInfo __struct_info__a509ab184e601d3c_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0xef20a82b7e6d690ful, "__rtti", 0 };
+TypeInfo * __type_info__ffcb5c4ceaff5914_arg_types_var_11892224411930991932[1] = { &__type_info__293c013eba484379 };
+VarInfo __struct_info__a509ab184e601d3c_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__ffcb5c4ceaff5914_arg_types_var_11892224411930991932, nullptr, 1, 0, nullptr, 28, 8, 0xffcb5c4ceaff5914ul, "__finalize", 8 };
+VarInfo __struct_info__a509ab184e601d3c_field_2 =  { Type::tLambda, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24576, 8, 0x89b146f5312358ddul, "onLog", 16 };
+VarInfo __struct_info__a509ab184e601d3c_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0x4fbfa4d39d6f9213ul, "y", 24 };
+TypeInfo * __type_info__fe864f563fb90aca_arg_types_var_11892224411930991932[1] = { &__type_info__293c013eba484379 };
+VarInfo __struct_info__a509ab184e601d3c_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__fe864f563fb90aca_arg_types_var_11892224411930991932, nullptr, 1, 0, nullptr, 28, 8, 0xfe864f563fb90acaul, "bang", 32 };
+VarInfo * __struct_info__a509ab184e601d3c_fields[5] =  { &__struct_info__a509ab184e601d3c_field_0, &__struct_info__a509ab184e601d3c_field_1, &__struct_info__a509ab184e601d3c_field_2, &__struct_info__a509ab184e601d3c_field_3, &__struct_info__a509ab184e601d3c_field_4 };
+StructInfo __struct_info__a509ab184e601d3c = {(char*)"A", (char*)"", 13, __struct_info__a509ab184e601d3c_fields, 5, 40, 0xaf63fc4c860222ecul, nullptr, 0xa509ab184e601d3cul };
+TypeInfo __type_info__1c74d6ac3d1a513a = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__84e5d899bedbac24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, 0x1c74d6ac3d1a513aul };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, 0xaf63eb4c86020609ul };
+TypeInfo __type_info__293c013eba484379 = { Type::tStructure, &__struct_info__a509ab184e601d3c, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24578, 40, 0x293c013eba484379ul };
+TypeInfo __type_info__84e5d899bedbac24 = { Type::tStructure, &__struct_info__38a16ad736a26473, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 24, 0x84e5d899bedbac24ul };
+
+namespace  { struct A; };
+namespace  { struct _lambda_thismodule_6_12_1; };
+namespace  {
+
+struct A {
+	void * __rtti;
+	Func DAS_COMMENT((void,A)) __finalize;
+	Lambda DAS_COMMENT((void)) onLog;
+	int32_t y;
+	Func DAS_COMMENT((void,A)) bang;
+};
+static_assert(sizeof(A)==40,"structure size mismatch with DAS");
+static_assert(offsetof(A,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(A,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(A,onLog)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(A,y)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(A,bang)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_6_12_1 {
+	Func DAS_COMMENT((void,_lambda_thismodule_6_12_1)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_6_12_1 *)) __finalize;
+	A * self;
+};
+static_assert(sizeof(_lambda_thismodule_6_12_1)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_6_12_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_6_12_1,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_6_12_1,self)==16,"structure field offset mismatch with DAS");
+}
+
+inline void finalize_d738484112580e59 ( Context * __context__, _lambda_thismodule_6_12_1 & ____this_rename_at_6 );
+inline void _Func_lambda_thismodule_6_12_1_0x60_function_71ae9005cff6095d ( Context * __context__, _lambda_thismodule_6_12_1 & ____this_rename_at_6 );
+inline void _Func_lambda_thismodule_6_12_1_0x60_finalizer_6d310d59af1c3a26 ( Context * __context__, _lambda_thismodule_6_12_1 * ____this_rename_at_6 );
+inline A A_d60ed1103ae3444b ( Context * __context__ );
+inline void _FuncA_0x60_A_945a68e9b966c660 ( Context * __context__, A & __self_rename_at_4 );
+inline void _FuncA_0x60_bang_a4c3d2c3ced51553 ( Context * __context__, A & __self_rename_at_7 );
+inline void finalize_a4e01d15e0a76fcb ( Context * __context__, A & __self_rename_at_10 );
+inline void _FuncA_0x27___finalize_b5f53aa24ecebb0f ( Context * __context__, A & __self_rename_at_1 );
+inline bool test_61299e84cbd06642 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void finalize_d738484112580e59 ( Context * __context__, _lambda_thismodule_6_12_1 &  ____this_rename_at_6 )
+{
+	memset(&(____this_rename_at_6), 0, 24);
+}
+
+inline void _Func_lambda_thismodule_6_12_1_0x60_function_71ae9005cff6095d ( Context * __context__, _lambda_thismodule_6_12_1 &  ____this_rename_at_6 )
+{
+	--das_deref(__context__,____this_rename_at_6.self).y;
+}
+
+inline void _Func_lambda_thismodule_6_12_1_0x60_finalizer_6d310d59af1c3a26 ( Context * __context__, _lambda_thismodule_6_12_1 * ____this_rename_at_6 )
+{
+	finalize_d738484112580e59(__context__,das_arg<_lambda_thismodule_6_12_1>::pass(das_deref(__context__,____this_rename_at_6)));
+	das_delete_lambda_struct<_lambda_thismodule_6_12_1 *>::clear(__context__,____this_rename_at_6);
+}
+
+inline A A_d60ed1103ae3444b ( Context * __context__ )
+{
+	A __self_rename_at_4; das_zero(__self_rename_at_4); das_move(__self_rename_at_4, (([&]() -> A {
+		A __mks_4;
+		das_zero(__mks_4);
+		das_copy((__mks_4.__rtti),(((void *)(&__type_info__293c013eba484379))));
+		das_copy((__mks_4.__finalize),(Func(__context__->fnByMangledName(/*A'__finalize S<::A>*/ 3078000520127869083u))));
+		das_copy((__mks_4.bang),(Func(__context__->fnByMangledName(/*A`bang S<::A>*/ 622894757924221134u))));
+		return __mks_4;
+	})()));
+	_FuncA_0x60_A_945a68e9b966c660(__context__,das_arg<A>::pass(__self_rename_at_4));
+	return /* <- */ das_auto_cast_move<A>::cast(__self_rename_at_4);
+}
+
+inline void _FuncA_0x60_A_945a68e9b966c660 ( Context * __context__, A &  __self_rename_at_4 )
+{
+	das_move(__self_rename_at_4.onLog,das_ascend<void,_lambda_thismodule_6_12_1>::make(__context__,&__type_info__84e5d899bedbac24,(([&]() -> _lambda_thismodule_6_12_1 {
+		_lambda_thismodule_6_12_1 __mks_6;
+		das_copy((__mks_6.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_6_12_1`function XS<::_lambda_thismodule_6_12_1>*/ 10420150079054882476u))));
+		das_copy((__mks_6.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_6_12_1`finalizer X1<S<::_lambda_thismodule_6_12_1>>?*/ 18197797444341680432u))));
+		das_copy((__mks_6.self),(das_ref(__context__,__self_rename_at_4)));
+		return __mks_6;
+	})())));
+}
+
+inline void _FuncA_0x60_bang_a4c3d2c3ced51553 ( Context * __context__, A &  __self_rename_at_7 )
+{
+	if ( __self_rename_at_7.onLog != nullptr )
+	{
+		das_invoke_lambda<void>::invoke(__context__,nullptr,__self_rename_at_7.onLog);
+	};
+}
+
+inline void finalize_a4e01d15e0a76fcb ( Context * __context__, A &  __self_rename_at_10 )
+{
+	++__self_rename_at_10.y;
+}
+
+inline void _FuncA_0x27___finalize_b5f53aa24ecebb0f ( Context * __context__, A &  __self_rename_at_1 )
+{
+	finalize_a4e01d15e0a76fcb(__context__,das_arg<A>::pass(__self_rename_at_1));
+}
+
+inline bool test_61299e84cbd06642 ( Context * __context__ )
+{
+	A * __a_rename_at_15 = das_new<A>::make_and_init(__context__,[&]() { return A_d60ed1103ae3444b(__context__); });
+	das_invoke_function<void>::invoke<A &>(__context__,nullptr,__a_rename_at_15->bang,das_arg<A>::pass(das_cast<A>::cast(das_deref(__context__,__a_rename_at_15))));
+	return das_auto_cast<bool>::cast(true);
+}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// finalize_d738484112580e59
+	aotLib[0x819f57e0a2d0ea25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_6_12_1 &  ),&finalize_d738484112580e59>>();
+	};
+	// _Func_lambda_thismodule_6_12_1_0x60_function_71ae9005cff6095d
+	aotLib[0x38d31b5a83347d85] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_6_12_1 &  ),&_Func_lambda_thismodule_6_12_1_0x60_function_71ae9005cff6095d>>();
+	};
+	// _Func_lambda_thismodule_6_12_1_0x60_finalizer_6d310d59af1c3a26
+	aotLib[0xaa1c63e20c2c2db0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_6_12_1 *  ),&_Func_lambda_thismodule_6_12_1_0x60_finalizer_6d310d59af1c3a26>>();
+	};
+	// A_d60ed1103ae3444b
+	aotLib[0x461786f50df1a2a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<A (*) ( Context * __context__ ),&A_d60ed1103ae3444b>>();
+	};
+	// _FuncA_0x60_A_945a68e9b966c660
+	aotLib[0x9df6acd0be4fb8a0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, A &  ),&_FuncA_0x60_A_945a68e9b966c660>>();
+	};
+	// _FuncA_0x60_bang_a4c3d2c3ced51553
+	aotLib[0x6a40e26adfef8201] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, A &  ),&_FuncA_0x60_bang_a4c3d2c3ced51553>>();
+	};
+	// finalize_a4e01d15e0a76fcb
+	aotLib[0xbb7a518e5723f0d1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, A &  ),&finalize_a4e01d15e0a76fcb>>();
+	};
+	// _FuncA_0x27___finalize_b5f53aa24ecebb0f
+	aotLib[0xd01fba9a6f28e67a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, A &  ),&_FuncA_0x27___finalize_b5f53aa24ecebb0f>>();
+	};
+	// test_61299e84cbd06642
+	aotLib[0x4b26f971346e2adf] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_61299e84cbd06642>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
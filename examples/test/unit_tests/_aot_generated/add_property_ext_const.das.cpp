@@ -0,0 +1,100 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_9877690193987388997 {
+
+
+
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+
+inline void takeFoo_98506cf3a988e0d7 ( Context * __context__, TestObjectFoo & __foo_rename_at_4, TestObjectFoo const  & __fooRO_rename_at_4 );
+inline bool test_17421c13325d46cc ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void takeFoo_98506cf3a988e0d7 ( Context * __context__, TestObjectFoo &  __foo_rename_at_4, TestObjectFoo const  &  __fooRO_rename_at_4 )
+{
+	DAS_ASSERT((!__foo_rename_at_4.isReadOnly() /*isReadOnly*/));
+	DAS_ASSERT((__fooRO_rename_at_4.isReadOnly() /*isReadOnly*/));
+}
+
+inline bool test_17421c13325d46cc ( Context * __context__ )
+{
+	TestObjectFoo __foo_rename_at_10; das_zero(__foo_rename_at_10);
+	TestObjectFoo __fooRO_rename_at_11_ConstRef; das_zero(__fooRO_rename_at_11_ConstRef);
+	TestObjectFoo const  & __fooRO_rename_at_11 = __fooRO_rename_at_11_ConstRef; ;
+	DAS_ASSERT((!__foo_rename_at_10.isReadOnly() /*isReadOnly*/));
+	DAS_ASSERT((__fooRO_rename_at_11.isReadOnly() /*isReadOnly*/));
+	takeFoo_98506cf3a988e0d7(__context__,das_arg<TestObjectFoo>::pass(__foo_rename_at_10),__fooRO_rename_at_11);
+	return das_auto_cast<bool>::cast(true);
+}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// takeFoo_98506cf3a988e0d7
+	aotLib[0x5746043d459b28dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TestObjectFoo & , TestObjectFoo const  &  ),&takeFoo_98506cf3a988e0d7>>();
+	};
+	// test_17421c13325d46cc
+	aotLib[0xdc6634bf57048522] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_17421c13325d46cc>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
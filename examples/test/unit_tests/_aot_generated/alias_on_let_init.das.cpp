@@ -0,0 +1,111 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_12011981302373436069 {
+
+
+
+namespace  { struct GunLoc; };
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+namespace  {
+
+struct GunLoc {
+	float3 * gunPos;
+};
+static_assert(sizeof(GunLoc)==8,"structure size mismatch with DAS");
+static_assert(offsetof(GunLoc,gunPos)==0,"structure field offset mismatch with DAS");
+}
+
+inline void pgp_5ff65183dd7c2d7a ( Context * __context__, GunLoc const  & __gloc_rename_at_7 );
+inline bool test_5b011c19a878c31b ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void pgp_5ff65183dd7c2d7a ( Context * __context__, GunLoc const  &  __gloc_rename_at_7 )
+{
+	float3 __gunPos_rename_at_8 = ((float3)das_alias<Point3>::from(das_deref(__context__,__gloc_rename_at_7.gunPos)));
+	DAS_ASSERT((SimPolicy<float3>::Equ(__gunPos_rename_at_8,v_make_vec4f(1.f,2.f,3.f,0.f),*__context__,nullptr)));
+}
+
+inline bool test_5b011c19a878c31b ( Context * __context__ )
+{
+	float3 __gpos_rename_at_13 = v_make_vec4f(1.f,2.f,3.f,0.f);
+	float3 * __ppos_rename_at_14 = das_ref(__context__,__gpos_rename_at_13);
+	GunLoc __gun_rename_at_15 = (([&]() -> GunLoc {
+		GunLoc __mks_15;
+		das_copy((__mks_15.gunPos),(das_cast<float3 *>::cast(__ppos_rename_at_14)));
+		return __mks_15;
+	})());
+	pgp_5ff65183dd7c2d7a(__context__,das_arg<GunLoc>::pass(__gun_rename_at_15));
+	return das_auto_cast<bool>::cast(true);
+}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// pgp_5ff65183dd7c2d7a
+	aotLib[0x9734ab7e19bc09a9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, GunLoc const  &  ),&pgp_5ff65183dd7c2d7a>>();
+	};
+	// test_5b011c19a878c31b
+	aotLib[0xc4f51bef6e71251c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_5b011c19a878c31b>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,534 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_13800847624903574601 {
+
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__af63ee4c86020b22;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__64be5dc860f5ba81;
+extern TypeInfo __type_info__289c16574f003020;
+extern VarInfo __var_info__e989483f695bcee9;
+extern FuncInfo __func_info__7fac1bd753cba6aa;
+
+VarInfo __func_info__7fac1bd753cba6aa_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63ee4c86020b22, nullptr, nullptr, nullptr, 0, 0, nullptr, 57442, 24, 0xe989483f695bcee9ul, "arr", 0 };
+VarInfo * __func_info__7fac1bd753cba6aa_fields[1] =  { &__func_info__7fac1bd753cba6aa_field_0 };
+FuncInfo __func_info__7fac1bd753cba6aa = {"invoke block<(arr:array<string> const#):void> const", "", __func_info__7fac1bd753cba6aa_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,0x7fac1bd753cba6aaul, 0x0 };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xaf63e44c8601fa24ul };
+TypeInfo __type_info__af63ee4c86020b22 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, 0xaf63ee4c86020b22ul };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, 0xaf63eb4c86020609ul };
+TypeInfo __type_info__64be5dc860f5ba81 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, 0x64be5dc860f5ba81ul };
+TypeInfo __type_info__289c16574f003020 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, 0x289c16574f003020ul };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__64be5dc860f5ba81 };
+TypeInfo * __tinfo_1[1] = { &__type_info__289c16574f003020 };
+namespace  { struct Foo; };
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+namespace  {
+
+struct Foo {
+	int32_t bar;
+};
+static_assert(sizeof(Foo)==4,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,bar)==0,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07 ( Context * __context__, TArray<int32_t> & __a_rename_at_31, TArray<int32_t> & __b_rename_at_31 );
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_d8ac2a3ec396965f ( Context * __context__, TDim<char *,1> & __a_rename_at_412 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> & __Arr_rename_at_75, int32_t __value_rename_at_75 );
+inline void _Funcbuiltin_0x60_reserve_a0d71b661f152abb ( Context * __context__, TArray<int32_t> & __Arr_rename_at_59, int32_t __newSize_rename_at_59 );
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_67, int32_t __value_rename_at_67, int32_t __at_rename_at_67 );
+inline void _Funcbuiltin_0x60_erase_a0d3d30dc9807389 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_159, int32_t __at_rename_at_159 );
+inline void _Funcbuiltin_0x60_resize_1772ad774a2515b3 ( Context * __context__, TArray<Foo const > & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void make_test_array_bcc4a199f5626a3a ( Context * __context__, TArray<int32_t> & __a_rename_at_9, int32_t __extra_rename_at_9 );
+inline void verify_test_array_f938f285b2d86ead ( Context * __context__, TArray<int32_t> const  & __a_rename_at_16, int32_t __extra_rename_at_16 );
+inline void pass_array_70ba279d67c790e3 ( Context * __context__, TArray<int32_t> & __arr_rename_at_23 );
+inline void verifyIntArray_ea8ec9b57f9b9b6f ( Context * __context__, TArray<int32_t> const  & __a_rename_at_27, int32_t __s_rename_at_27, int32_t __c_rename_at_27, int32_t __tail_rename_at_27 );
+inline void testIntArray_11d478e9c7de3fa1 ( Context * __context__ );
+inline void testInterop_42dc405cbcc89686 ( Context * __context__ );
+inline bool test_746d3831ab9d2ec5 ( Context * __context__ );
+inline bool testAccept_10d992fd644441df ( Context * __context__, TArray<Foo const > const  & __t_rename_at_147, TDim<Foo,10> const  & __e_rename_at_147 );
+inline void testConstInArray_e5fb24a8d3c21ac6 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<char *>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,8,__context__);
+}
+
+inline void _Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07 ( Context * __context__, TArray<int32_t> &  __a_rename_at_31, TArray<int32_t> &  __b_rename_at_31 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<TArray<int32_t> &>::from(__a_rename_at_31)));
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_1,cast<TArray<int32_t> &>::from(__b_rename_at_31)));
+	das_move(__a_rename_at_31,__b_rename_at_31);
+}
+
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_d8ac2a3ec396965f ( Context * __context__, TDim<char *,1> &  __a_rename_at_412 )
+{
+	TArray<char *> __arr_rename_at_413; das_zero(__arr_rename_at_413);
+	_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7(__context__,das_arg<TArray<char *>>::pass(__arr_rename_at_413),1);
+	das_copy(das_cast<TDim<char *,1>>::cast(das_ref(__context__,__arr_rename_at_413(0,__context__))),__a_rename_at_412);
+	return /* <- */ das_auto_cast_move<TArray<char *>>::cast(__arr_rename_at_413);
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_75, int32_t __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_75),4,__context__),__context__),__value_rename_at_75);
+}
+
+inline void _Funcbuiltin_0x60_reserve_a0d71b661f152abb ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_59, int32_t __newSize_rename_at_59 )
+{
+	builtin_array_reserve(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_59),__newSize_rename_at_59,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_67, int32_t __value_rename_at_67, int32_t __at_rename_at_67 )
+{
+	das_copy(__Arr_rename_at_67(builtin_array_push(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_67),__at_rename_at_67,4,__context__),__context__),__value_rename_at_67);
+}
+
+inline void _Funcbuiltin_0x60_erase_a0d3d30dc9807389 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_159, int32_t __at_rename_at_159 )
+{
+	builtin_array_erase(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_159),__at_rename_at_159,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_1772ad774a2515b3 ( Context * __context__, TArray<Foo const > &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<Foo const >>::pass(__Arr_rename_at_54),__newSize_rename_at_54,4,__context__);
+}
+
+inline void make_test_array_bcc4a199f5626a3a ( Context * __context__, TArray<int32_t> &  __a_rename_at_9, int32_t __extra_rename_at_9 )
+{
+	int32_t __i_rename_at_10 = 0;
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_9),10);
+	{
+		uint64_t __loop_count_12 = UINT64_MAX;
+		// x : int&
+		das_iterator<TArray<int32_t>> __x_iterator(__a_rename_at_9);
+		int32_t * __x_rename_at_12;
+		__loop_count_12 = das_loop_count(__loop_count_12,__x_iterator.loop_begin(__context__,(__x_rename_at_12)));
+		for ( ; __loop_count_12 ; --__loop_count_12, ++__x_rename_at_12 )
+		{
+			das_copy((*__x_rename_at_12),__i_rename_at_10++ + __extra_rename_at_9);
+		}
+		__x_iterator.loop_end(__context__,(__x_rename_at_12));
+	};
+}
+
+inline void verify_test_array_f938f285b2d86ead ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_16, int32_t __extra_rename_at_16 )
+{
+	DAS_ASSERT((builtin_array_size(__a_rename_at_16) == 10));
+	int32_t __i_rename_at_18 = 0;
+	{
+		uint64_t __loop_count_19 = UINT64_MAX;
+		// x : int const&
+		das_iterator<TArray<int32_t> const > __x_iterator(__a_rename_at_16);
+		int32_t const  * __x_rename_at_19;
+		__loop_count_19 = das_loop_count(__loop_count_19,__x_iterator.loop_begin(__context__,(__x_rename_at_19)));
+		for ( ; __loop_count_19 ; --__loop_count_19, ++__x_rename_at_19 )
+		{
+			DAS_VERIFY(((*__x_rename_at_19) == (__extra_rename_at_16 + __i_rename_at_18++)));
+		}
+		__x_iterator.loop_end(__context__,(__x_rename_at_19));
+	};
+}
+
+inline void pass_array_70ba279d67c790e3 ( Context * __context__, TArray<int32_t> &  __arr_rename_at_23 )
+{
+	_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_23),4);
+}
+
+inline void verifyIntArray_ea8ec9b57f9b9b6f ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_27, int32_t __s_rename_at_27, int32_t __c_rename_at_27, int32_t __tail_rename_at_27 )
+{
+	{
+		uint64_t __loop_count_28 = UINT64_MAX;
+		// t : int const
+		das_iterator<range> __t_iterator(mk_range(__c_rename_at_27));
+		int32_t __t_rename_at_28;
+		__loop_count_28 = das_loop_count(__loop_count_28,__t_iterator.loop_begin(__context__,(__t_rename_at_28)));
+		for ( ; __loop_count_28 ; --__loop_count_28, ++__t_rename_at_28 )
+		{
+			DAS_VERIFY((__a_rename_at_27(__t_rename_at_28,__context__) == __s_rename_at_27++));
+		}
+		__t_iterator.loop_end(__context__,(__t_rename_at_28));
+	};
+	{
+		uint64_t __loop_count_30 = UINT64_MAX;
+		// t : int const
+		das_iterator<range> __t_iterator(range(__c_rename_at_27,__c_rename_at_27 + __tail_rename_at_27));
+		int32_t __t_rename_at_30;
+		__loop_count_30 = das_loop_count(__loop_count_30,__t_iterator.loop_begin(__context__,(__t_rename_at_30)));
+		for ( ; __loop_count_30 ; --__loop_count_30, ++__t_rename_at_30 )
+		{
+			DAS_ASSERT((__a_rename_at_27(__t_rename_at_30,__context__) == 0));
+		}
+		__t_iterator.loop_end(__context__,(__t_rename_at_30));
+	};
+}
+
+inline void testIntArray_11d478e9c7de3fa1 ( Context * __context__ )
+{
+	TArray<int32_t> __arr_rename_at_35; das_zero(__arr_rename_at_35); TArray<int32_t> __arr2_rename_at_35; das_zero(__arr2_rename_at_35);
+	DAS_ASSERTF((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_35)) == 0),(((char *) "array starts at 0 length")));
+	_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),1);
+	_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),2);
+	_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),3);
+	DAS_ASSERTF((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_35)) == 3),(((char *) "array length is 3")));
+	DAS_ASSERTF((builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__arr_rename_at_35)) == 16),(((char *) "its 2x, but no less than 16")));
+	verifyIntArray_ea8ec9b57f9b9b6f(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),1,3,0);
+	pass_array_70ba279d67c790e3(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35));
+	DAS_ASSERTF((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_35)) == 4),(((char *) "array length is 4")));
+	verifyIntArray_ea8ec9b57f9b9b6f(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),1,4,0);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),6);
+	DAS_ASSERTF((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_35)) == 6),(((char *) "array length is now 6")));
+	verifyIntArray_ea8ec9b57f9b9b6f(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),1,4,2);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),17);
+	verifyIntArray_ea8ec9b57f9b9b6f(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),1,4,13);
+	DAS_ASSERTF((builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__arr_rename_at_35)) == 32),(((char *) "now bigger")));
+	_Funcbuiltin_0x60_reserve_a0d71b661f152abb(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),33);
+	verifyIntArray_ea8ec9b57f9b9b6f(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),1,4,13);
+	DAS_ASSERTF((builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__arr_rename_at_35)) == 33),(((char *) "now even bigger")));
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),4);
+	DAS_ASSERTF((builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__arr_rename_at_35)) == 33),(((char *) "did not grow smaller")));
+	DAS_ASSERTF((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_35)) == 4),(((char *) "resized properly")));
+	_Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07(__context__,das_arg<TArray<int32_t>>::pass(__arr2_rename_at_35),das_arg<TArray<int32_t>>::pass(__arr_rename_at_35));
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_35)) == 0));
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr2_rename_at_35)) == 4));
+	int32_t __index_rename_at_62 = 0;
+	while ( __index_rename_at_62 < 4 )
+	{
+		++__arr2_rename_at_35(__index_rename_at_62++,__context__);
+	};
+	verifyIntArray_ea8ec9b57f9b9b6f(__context__,das_arg<TArray<int32_t>>::pass(__arr2_rename_at_35),2,4,0);
+	_Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),das_arg<TArray<int32_t>>::pass(__arr2_rename_at_35));
+	verifyIntArray_ea8ec9b57f9b9b6f(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),2,4,0);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),3);
+	verifyIntArray_ea8ec9b57f9b9b6f(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),2,3,0);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),4);
+	DAS_ASSERTF((__arr_rename_at_35(3,__context__) == 0),(((char *) "new element after resize is 0")));
+	verifyIntArray_ea8ec9b57f9b9b6f(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),2,3,1);
+	_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),1,0);
+	verifyIntArray_ea8ec9b57f9b9b6f(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),1,4,1);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),4);
+	_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),5,4);
+	verifyIntArray_ea8ec9b57f9b9b6f(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),1,5,0);
+	_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),7,2);
+	_Funcbuiltin_0x60_erase_a0d3d30dc9807389(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),2);
+	verifyIntArray_ea8ec9b57f9b9b6f(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),1,5,0);
+	_Funcbuiltin_0x60_erase_a0d3d30dc9807389(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),0);
+	_Funcbuiltin_0x60_erase_a0d3d30dc9807389(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),3);
+	verifyIntArray_ea8ec9b57f9b9b6f(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),2,3,0);
+}
+
+inline void testInterop_42dc405cbcc89686 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,160,"testInterop " DAS_FILE_LINE);
+{
+	TArray<char *> _temp_make_local_86_48;
+	TDim<char *,1> _temp_make_local_86_80;
+	bool __res_rename_at_86 = ((bool)tempArrayExample(das_arg<TArray<char *>>::pass((_temp_make_local_86_48 = (_Funcbuiltin_0x60_to_array_move_d8ac2a3ec396965f(__context__,das_arg<TDim<char *,1>>::pass((([&]() -> TDim<char *,1>& {
+		_temp_make_local_86_80(0,__context__) = ((char *) "one");
+		return _temp_make_local_86_80;
+	})())))))),das_make_block<void,TArray<char *> const  &>(__context__,144,0,&__func_info__7fac1bd753cba6aa,[&](TArray<char *> const  & __arr_rename_at_86)->void{
+		DAS_ASSERT((builtin_array_size(__arr_rename_at_86) == 1));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__arr_rename_at_86(0,__context__)),cast<char *>::from(((char *) "one")),*__context__,nullptr)));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))));
+	DAS_ASSERT((__res_rename_at_86));
+}}
+
+inline bool test_746d3831ab9d2ec5 ( Context * __context__ )
+{
+	TArray<int32_t> __a_rename_at_94; das_zero(__a_rename_at_94);
+	make_test_array_bcc4a199f5626a3a(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_94),0);
+	verify_test_array_f938f285b2d86ead(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_94),0);
+	make_test_array_bcc4a199f5626a3a(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_94),13);
+	verify_test_array_f938f285b2d86ead(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_94),13);
+	make_test_array_bcc4a199f5626a3a(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_94),0);
+	verify_test_array_f938f285b2d86ead(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_94),0);
+	TArray<int32_t> __b_rename_at_102; das_zero(__b_rename_at_102); das_move(__b_rename_at_102, __a_rename_at_94);
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_94)) == 0));
+	verify_test_array_f938f285b2d86ead(__context__,das_arg<TArray<int32_t>>::pass(__b_rename_at_102),0);
+	_Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_94),das_arg<TArray<int32_t>>::pass(__b_rename_at_102));
+	verify_test_array_f938f285b2d86ead(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_94),0);
+	TArray<int32_t> __a_rename_at_108; das_zero(__a_rename_at_108); TArray<int32_t> __b_rename_at_108; das_zero(__b_rename_at_108);
+	int32_t __i_rename_at_109 = 0;
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_108),10);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__b_rename_at_108),10);
+	{
+		uint64_t __loop_count_112 = UINT64_MAX;
+		// l : int&
+		das_iterator<TArray<int32_t>> __l_iterator(__a_rename_at_108);
+		int32_t * __restrict __l_rename_at_112;
+		__loop_count_112 = das_loop_count(__loop_count_112,__l_iterator.loop_begin(__context__,(__l_rename_at_112)));
+		// r : int&
+		das_iterator<TArray<int32_t>> __r_iterator(__b_rename_at_108);
+		int32_t * __restrict __r_rename_at_112;
+		__loop_count_112 = das_loop_count(__loop_count_112,__r_iterator.loop_begin(__context__,(__r_rename_at_112)));
+		for ( ; __loop_count_112 ; --__loop_count_112, ++__l_rename_at_112, ++__r_rename_at_112 )
+		{
+			das_copy((*__l_rename_at_112),__i_rename_at_109);
+			das_copy((*__r_rename_at_112),(__i_rename_at_109 * 2) - 5);
+			++__i_rename_at_109;
+		}
+		__l_iterator.loop_end(__context__,(__l_rename_at_112));
+		__r_iterator.loop_end(__context__,(__r_rename_at_112));
+	};
+	verify_test_array_f938f285b2d86ead(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_108),0);
+	das_copy(__i_rename_at_109,0);
+	{
+		uint64_t __loop_count_118 = UINT64_MAX;
+		// l : int&
+		das_iterator<TArray<int32_t>> __l_iterator(__a_rename_at_108);
+		int32_t * __restrict __l_rename_at_118;
+		__loop_count_118 = das_loop_count(__loop_count_118,__l_iterator.loop_begin(__context__,(__l_rename_at_118)));
+		// r : int&
+		das_iterator<TArray<int32_t>> __r_iterator(__b_rename_at_108);
+		int32_t * __restrict __r_rename_at_118;
+		__loop_count_118 = das_loop_count(__loop_count_118,__r_iterator.loop_begin(__context__,(__r_rename_at_118)));
+		for ( ; __loop_count_118 ; --__loop_count_118, ++__l_rename_at_118, ++__r_rename_at_118 )
+		{
+			DAS_ASSERT(((*__l_rename_at_118) == __i_rename_at_109));
+			DAS_ASSERT(((*__r_rename_at_118) == ((__i_rename_at_109 * 2) - 5)));
+			++__i_rename_at_109;
+		}
+		__l_iterator.loop_end(__context__,(__l_rename_at_118));
+		__r_iterator.loop_end(__context__,(__r_rename_at_118));
+	};
+	das_copy(__i_rename_at_109,0);
+	{
+		uint64_t __loop_count_123 = UINT64_MAX;
+		// l : int&
+		das_iterator<TArray<int32_t>> __l_iterator(__a_rename_at_108);
+		int32_t * __restrict __l_rename_at_123;
+		__loop_count_123 = das_loop_count(__loop_count_123,__l_iterator.loop_begin(__context__,(__l_rename_at_123)));
+		// r : int&
+		das_iterator<TArray<int32_t>> __r_iterator(__b_rename_at_108);
+		int32_t * __restrict __r_rename_at_123;
+		__loop_count_123 = das_loop_count(__loop_count_123,__r_iterator.loop_begin(__context__,(__r_rename_at_123)));
+		for ( ; __loop_count_123 ; --__loop_count_123, ++__l_rename_at_123, ++__r_rename_at_123 )
+		{
+			if ( (*__l_rename_at_123) > (*__r_rename_at_123) )
+			{
+				DAS_ASSERT(((*__l_rename_at_123) > (*__r_rename_at_123)));
+				++__i_rename_at_109;
+			};
+		}
+		__l_iterator.loop_end(__context__,(__l_rename_at_123));
+		__r_iterator.loop_end(__context__,(__r_rename_at_123));
+	};
+	DAS_ASSERT((__i_rename_at_109 == 5));
+	TDim<TArray<int32_t>,10> __a_rename_at_129; das_zero(__a_rename_at_129);
+	int32_t __i_rename_at_130 = 0;
+	{
+		uint64_t __loop_count_131 = UINT64_MAX;
+		// b : array<int>& -const
+		das_iterator<TDim<TArray<int32_t>,10>> __b_iterator(__a_rename_at_129);
+		TArray<int32_t> * __restrict __b_rename_at_131;
+		__loop_count_131 = das_loop_count(__loop_count_131,__b_iterator.loop_begin(__context__,(__b_rename_at_131)));
+		for ( ; __loop_count_131 ; --__loop_count_131, ++__b_rename_at_131 )
+		{
+			make_test_array_bcc4a199f5626a3a(__context__,das_arg<TArray<int32_t>>::pass((*__b_rename_at_131)),__i_rename_at_130++);
+		}
+		__b_iterator.loop_end(__context__,(__b_rename_at_131));
+	};
+	das_copy(__i_rename_at_130,0);
+	{
+		uint64_t __loop_count_134 = UINT64_MAX;
+		// b : array<int>& -const
+		das_iterator<TDim<TArray<int32_t>,10>> __b_iterator(__a_rename_at_129);
+		TArray<int32_t> * __restrict __b_rename_at_134;
+		__loop_count_134 = das_loop_count(__loop_count_134,__b_iterator.loop_begin(__context__,(__b_rename_at_134)));
+		for ( ; __loop_count_134 ; --__loop_count_134, ++__b_rename_at_134 )
+		{
+			verify_test_array_f938f285b2d86ead(__context__,das_arg<TArray<int32_t>>::pass((*__b_rename_at_134)),__i_rename_at_130++);
+		}
+		__b_iterator.loop_end(__context__,(__b_rename_at_134));
+	};
+	testIntArray_11d478e9c7de3fa1(__context__);
+	testConstInArray_e5fb24a8d3c21ac6(__context__);
+	testInterop_42dc405cbcc89686(__context__);
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline bool testAccept_10d992fd644441df ( Context * __context__, TArray<Foo const > const  &  __t_rename_at_147, TDim<Foo,10> const  &  __e_rename_at_147 )
+{
+	{
+		uint64_t __loop_count_148 = UINT64_MAX;
+		// i : Foo const&
+		das_iterator<TArray<Foo const > const > __i_iterator(__t_rename_at_147);
+		Foo const  * __i_rename_at_148;
+		__loop_count_148 = das_loop_count(__loop_count_148,__i_iterator.loop_begin(__context__,(__i_rename_at_148)));
+		for ( ; __loop_count_148 ; --__loop_count_148, ++__i_rename_at_148 )
+		{
+			if ( (*__i_rename_at_148).bar == 13 )
+			{
+				return das_auto_cast<bool>::cast(true);
+			};
+		}
+		__i_iterator.loop_end(__context__,(__i_rename_at_148));
+	};
+	{
+		uint64_t __loop_count_151 = UINT64_MAX;
+		// j : Foo const&
+		das_iterator<TDim<Foo,10> const > __j_iterator(__e_rename_at_147);
+		Foo const  * __j_rename_at_151;
+		__loop_count_151 = das_loop_count(__loop_count_151,__j_iterator.loop_begin(__context__,(__j_rename_at_151)));
+		for ( ; __loop_count_151 ; --__loop_count_151, ++__j_rename_at_151 )
+		{
+			if ( (*__j_rename_at_151).bar == 13 )
+			{
+				return das_auto_cast<bool>::cast(false);
+			};
+		}
+		__j_iterator.loop_end(__context__,(__j_rename_at_151));
+	};
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void testConstInArray_e5fb24a8d3c21ac6 ( Context * __context__ )
+{
+	TArray<Foo const > __a_rename_at_158; das_zero(__a_rename_at_158);
+	_Funcbuiltin_0x60_resize_1772ad774a2515b3(__context__,das_arg<TArray<Foo const >>::pass(__a_rename_at_158),20);
+	TDim<Foo,10> __b_rename_at_160_ConstRef; das_zero(__b_rename_at_160_ConstRef);
+	TDim<Foo,10> const  & __b_rename_at_160 = __b_rename_at_160_ConstRef; ;
+	testAccept_10d992fd644441df(__context__,das_arg<TArray<Foo const >>::pass(__a_rename_at_158),__b_rename_at_160);
+}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7
+	aotLib[0xdd4771637ebae089] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t  ),&_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7>>();
+	};
+	// _Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07
+	aotLib[0x44c6ff6768abbc55] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> &  ),&_Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_d8ac2a3ec396965f
+	aotLib[0xbb5d2737e45573af] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, TDim<char *,1> &  ),&_Funcbuiltin_0x60_to_array_move_d8ac2a3ec396965f>>();
+	};
+	// _Funcbuiltin_0x60_resize_ce974596f011d69b
+	aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+	// _Funcbuiltin_0x60_push_d21751720b4df10e
+	aotLib[0x9fb5b63c22625999] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_d21751720b4df10e>>();
+	};
+	// _Funcbuiltin_0x60_reserve_a0d71b661f152abb
+	aotLib[0xe761f57d94ab3d39] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_reserve_a0d71b661f152abb>>();
+	};
+	// _Funcbuiltin_0x60_push_d7f619259dc926c6
+	aotLib[0x7c1d8142a521fc3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t , int32_t  ),&_Funcbuiltin_0x60_push_d7f619259dc926c6>>();
+	};
+	// _Funcbuiltin_0x60_erase_a0d3d30dc9807389
+	aotLib[0xc4522b3c0e92475] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_erase_a0d3d30dc9807389>>();
+	};
+	// _Funcbuiltin_0x60_resize_1772ad774a2515b3
+	aotLib[0x7fe60ae1c08abe25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<Foo const > & , int32_t  ),&_Funcbuiltin_0x60_resize_1772ad774a2515b3>>();
+	};
+	// make_test_array_bcc4a199f5626a3a
+	aotLib[0xc9afd365f73b3191] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&make_test_array_bcc4a199f5626a3a>>();
+	};
+	// verify_test_array_f938f285b2d86ead
+	aotLib[0x83f4f35edac80055] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> const  & , int32_t  ),&verify_test_array_f938f285b2d86ead>>();
+	};
+	// pass_array_70ba279d67c790e3
+	aotLib[0xbb7e49243ccec9b0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&pass_array_70ba279d67c790e3>>();
+	};
+	// verifyIntArray_ea8ec9b57f9b9b6f
+	aotLib[0x9878d2e2221cab59] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> const  & , int32_t , int32_t , int32_t  ),&verifyIntArray_ea8ec9b57f9b9b6f>>();
+	};
+	// testIntArray_11d478e9c7de3fa1
+	aotLib[0xf76ecd498d7e7013] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&testIntArray_11d478e9c7de3fa1>>();
+	};
+	// testInterop_42dc405cbcc89686
+	aotLib[0x91d1d7424fabc849] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&testInterop_42dc405cbcc89686>>();
+	};
+	// test_746d3831ab9d2ec5
+	aotLib[0xd71977020bd39c07] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_746d3831ab9d2ec5>>();
+	};
+	// testAccept_10d992fd644441df
+	aotLib[0x4d657e14d9494d31] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TArray<Foo const > const  & , TDim<Foo,10> const  &  ),&testAccept_10d992fd644441df>>();
+	};
+	// testConstInArray_e5fb24a8d3c21ac6
+	aotLib[0x243e9e1bedd5e40b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&testConstInArray_e5fb24a8d3c21ac6>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
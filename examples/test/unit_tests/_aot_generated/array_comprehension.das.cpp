@@ -0,0 +1,173 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_1453201550901497738 {
+
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__3ceb21b1e6727087;
+
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xaf63e44c8601fa24ul };
+TypeInfo __type_info__3ceb21b1e6727087 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, 0x3ceb21b1e6727087ul };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__3ceb21b1e6727087 };
+
+inline TArray<int32_t> & _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd ( Context * __context__, TArray<int32_t> & __a_rename_at_42 );
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> & __Arr_rename_at_75, int32_t __value_rename_at_75 );
+inline bool test_edafdb9607bcc7d5 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline TArray<int32_t> & _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd ( Context * __context__, TArray<int32_t> &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<TArray<int32_t> &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<TArray<int32_t> &>::cast(__a_rename_at_42);
+}
+
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_75, int32_t __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_75),4,__context__),__context__),__value_rename_at_75);
+}
+
+inline bool test_edafdb9607bcc7d5 ( Context * __context__ )
+{
+	TArray<int32_t> __q_rename_at_3_ConstRef; das_zero(__q_rename_at_3_ConstRef); das_move(__q_rename_at_3_ConstRef, ((TArray<int32_t>)das_invoke<TArray<int32_t>>::invoke_cmres(__context__,nullptr,[&]()->TArray<int32_t>{
+		TArray<int32_t> ____acomp_3_rename_at_3; das_zero(____acomp_3_rename_at_3);
+		{
+			uint64_t __loop_count_3 = UINT64_MAX;
+			// x : int const
+			das_iterator<range> __x_iterator(range(0,10));
+			int32_t __x_rename_at_3;
+			__loop_count_3 = das_loop_count(__loop_count_3,__x_iterator.loop_begin(__context__,(__x_rename_at_3)));
+			for ( ; __loop_count_3 ; --__loop_count_3, ++__x_rename_at_3 )
+			{
+				_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(____acomp_3_rename_at_3),__x_rename_at_3 * __x_rename_at_3);
+			}
+			__x_iterator.loop_end(__context__,(__x_rename_at_3));
+		};
+		return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd(__context__,das_arg<TArray<int32_t>>::pass(____acomp_3_rename_at_3)));
+	})));
+	TArray<int32_t> const  & __q_rename_at_3 = __q_rename_at_3_ConstRef; ;
+	{
+		uint64_t __loop_count_4 = UINT64_MAX;
+		// y : int const
+		das_iterator<range> __y_iterator(range(0,10));
+		int32_t __y_rename_at_4;
+		__loop_count_4 = das_loop_count(__loop_count_4,__y_iterator.loop_begin(__context__,(__y_rename_at_4)));
+		// qV : int const&
+		das_iterator<TArray<int32_t> const > __qV_iterator(__q_rename_at_3);
+		int32_t const  * __restrict __qV_rename_at_4;
+		__loop_count_4 = das_loop_count(__loop_count_4,__qV_iterator.loop_begin(__context__,(__qV_rename_at_4)));
+		for ( ; __loop_count_4 ; --__loop_count_4, ++__y_rename_at_4, ++__qV_rename_at_4 )
+		{
+			DAS_VERIFY(((__y_rename_at_4 * __y_rename_at_4) == (*__qV_rename_at_4)));
+		}
+		__y_iterator.loop_end(__context__,(__y_rename_at_4));
+		__qV_iterator.loop_end(__context__,(__qV_rename_at_4));
+	};
+	TArray<int32_t> __t_rename_at_6_ConstRef; das_zero(__t_rename_at_6_ConstRef); das_move(__t_rename_at_6_ConstRef, ((TArray<int32_t>)das_invoke<TArray<int32_t>>::invoke_cmres(__context__,nullptr,[&]()->TArray<int32_t>{
+		TArray<int32_t> ____acomp_6_rename_at_6; das_zero(____acomp_6_rename_at_6);
+		{
+			uint64_t __loop_count_6 = UINT64_MAX;
+			// x : int const
+			das_iterator<range> __x_iterator(range(0,10));
+			int32_t __x_rename_at_6;
+			__loop_count_6 = das_loop_count(__loop_count_6,__x_iterator.loop_begin(__context__,(__x_rename_at_6)));
+			for ( ; __loop_count_6 ; --__loop_count_6, ++__x_rename_at_6 )
+			{
+				if ( (__x_rename_at_6 & 1) == 0 )
+				{
+					_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(____acomp_6_rename_at_6),__x_rename_at_6 * __x_rename_at_6);
+				};
+			}
+			__x_iterator.loop_end(__context__,(__x_rename_at_6));
+		};
+		return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd(__context__,das_arg<TArray<int32_t>>::pass(____acomp_6_rename_at_6)));
+	})));
+	TArray<int32_t> const  & __t_rename_at_6 = __t_rename_at_6_ConstRef; ;
+	int32_t __count_rename_at_7 = 0;
+	{
+		uint64_t __loop_count_8 = UINT64_MAX;
+		// z : int const
+		das_iterator<range> __z_iterator(range(0,10));
+		int32_t __z_rename_at_8;
+		__loop_count_8 = das_loop_count(__loop_count_8,__z_iterator.loop_begin(__context__,(__z_rename_at_8)));
+		for ( ; __loop_count_8 ; --__loop_count_8, ++__z_rename_at_8 )
+		{
+			if ( (__z_rename_at_8 & 1) == 0 )
+			{
+				DAS_VERIFY((__t_rename_at_6(__count_rename_at_7++,__context__) == (__z_rename_at_8 * __z_rename_at_8)));
+			};
+		}
+		__z_iterator.loop_end(__context__,(__z_rename_at_8));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd
+	aotLib[0x66e322246598e835] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TArray<int32_t> & (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd>>();
+	};
+	// _Funcbuiltin_0x60_push_d21751720b4df10e
+	aotLib[0x9fb5b63c22625999] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_d21751720b4df10e>>();
+	};
+	// test_edafdb9607bcc7d5
+	aotLib[0x2b53cf88fa665e45] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_edafdb9607bcc7d5>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,211 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require strings_boost
+ // require ast_boost
+ // require _array_reader
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_13099369285978860244 {
+
+
+
+namespace ast { struct AstFunctionAnnotation; };
+namespace ast { struct AstBlockAnnotation; };
+namespace ast { struct AstStructureAnnotation; };
+namespace ast { struct AstPassMacro; };
+namespace ast { struct AstVariantMacro; };
+namespace ast { struct AstReaderMacro; };
+namespace ast { struct AstCommentReader; };
+namespace ast { struct AstCallMacro; };
+namespace ast { struct AstTypeInfoMacro; };
+namespace ast { struct AstEnumerationAnnotation; };
+namespace ast { struct AstVisitor; };
+namespace ast_boost { struct MacroMacro; };
+namespace ast_boost { struct TagFunctionAnnotation; };
+namespace ast_boost { struct TagStructureAnnotation; };
+namespace ast_boost { struct SetupAnyAnnotation; };
+namespace ast_boost { struct SetupFunctionAnnotatoin; };
+namespace ast_boost { struct SetupBlockAnnotatoin; };
+namespace ast_boost { struct SetupStructureAnnotatoin; };
+namespace ast_boost { struct SetupEnumerationAnnotation; };
+namespace ast_boost { struct SetupContractAnnotatoin; };
+namespace ast_boost { struct SetupReaderMacro; };
+namespace ast_boost { struct SetupCommentReader; };
+namespace ast_boost { struct SetupVariantMacro; };
+namespace ast_boost { struct SetupCallMacro; };
+namespace ast_boost { struct SetupTypeInfoMacro; };
+namespace ast_boost { struct SetupInferMacro; };
+namespace ast_boost { struct SetupDirtyInferMacro; };
+namespace ast_boost { struct SetupLintMacro; };
+namespace ast_boost { struct SetupGlobalLintMacro; };
+namespace ast_boost { struct SetupOptimizationMacro; };
+namespace ast_boost { struct TagFunctionMacro; };
+namespace ast_boost { struct BetterRttiVisitor; };
+namespace _array_reader { struct ArrayReader; };
+// unused enumeration CompilationError
+// unused enumeration Type
+// unused enumeration RefMatters
+// unused enumeration ConstMatters
+// unused enumeration TemporaryMatters
+// unused enumeration SideEffects
+// unused enumeration CaptureMode
+// unused structure AstFunctionAnnotation
+// unused structure AstBlockAnnotation
+// unused structure AstStructureAnnotation
+// unused structure AstPassMacro
+// unused structure AstVariantMacro
+// unused structure AstReaderMacro
+// unused structure AstCommentReader
+// unused structure AstCallMacro
+// unused structure AstTypeInfoMacro
+// unused structure AstEnumerationAnnotation
+// unused structure AstVisitor
+// unused structure MacroMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagStructureAnnotation
+// unused structure SetupAnyAnnotation
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupBlockAnnotatoin
+// unused structure SetupStructureAnnotatoin
+// unused structure SetupEnumerationAnnotation
+// unused structure SetupContractAnnotatoin
+// unused structure SetupReaderMacro
+// unused structure SetupCommentReader
+// unused structure SetupVariantMacro
+// unused structure SetupCallMacro
+// unused structure SetupTypeInfoMacro
+// unused structure SetupInferMacro
+// unused structure SetupDirtyInferMacro
+// unused structure SetupLintMacro
+// unused structure SetupGlobalLintMacro
+// unused structure SetupOptimizationMacro
+// unused structure TagFunctionMacro
+// unused structure BetterRttiVisitor
+// unused structure ArrayReader
+
+inline bool test_3d6a792e6949268f ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool test_3d6a792e6949268f ( Context * __context__ )
+{
+	TDim<int32_t,12> __x_rename_at_7 = (([&]() -> TDim<int32_t,12> {
+		TDim<int32_t,12> __mka_7;
+		__mka_7(0,__context__) = 92;
+		__mka_7(1,__context__) = 123;
+		__mka_7(2,__context__) = 92;
+		__mka_7(3,__context__) = 125;
+		__mka_7(4,__context__) = 92;
+		__mka_7(5,__context__) = 119;
+		__mka_7(6,__context__) = 92;
+		__mka_7(7,__context__) = 120;
+		__mka_7(8,__context__) = 92;
+		__mka_7(9,__context__) = 121;
+		__mka_7(10,__context__) = 92;
+		__mka_7(11,__context__) = 110;
+		return __mka_7;
+	})());
+	TDim<int32_t,12> __y_rename_at_9 = (([&]() -> TDim<int32_t,12> {
+		TDim<int32_t,12> __mka_9;
+		__mka_9(0,__context__) = 92;
+		__mka_9(1,__context__) = 123;
+		__mka_9(2,__context__) = 92;
+		__mka_9(3,__context__) = 125;
+		__mka_9(4,__context__) = 92;
+		__mka_9(5,__context__) = 119;
+		__mka_9(6,__context__) = 92;
+		__mka_9(7,__context__) = 120;
+		__mka_9(8,__context__) = 92;
+		__mka_9(9,__context__) = 121;
+		__mka_9(10,__context__) = 92;
+		__mka_9(11,__context__) = 110;
+		return __mka_9;
+	})());
+	{
+		uint64_t __loop_count_10 = UINT64_MAX;
+		// t1 : int&
+		das_iterator<TDim<int32_t,12>> __t1_iterator(__x_rename_at_7);
+		int32_t * __restrict __t1_rename_at_10;
+		__loop_count_10 = das_loop_count(__loop_count_10,__t1_iterator.loop_begin(__context__,(__t1_rename_at_10)));
+		// t2 : int&
+		das_iterator<TDim<int32_t,12>> __t2_iterator(__y_rename_at_9);
+		int32_t * __restrict __t2_rename_at_10;
+		__loop_count_10 = das_loop_count(__loop_count_10,__t2_iterator.loop_begin(__context__,(__t2_rename_at_10)));
+		for ( ; __loop_count_10 ; --__loop_count_10, ++__t1_rename_at_10, ++__t2_rename_at_10 )
+		{
+			DAS_ASSERT(((*__t1_rename_at_10) == (*__t2_rename_at_10)));
+		}
+		__t1_iterator.loop_end(__context__,(__t1_rename_at_10));
+		__t2_iterator.loop_end(__context__,(__t2_rename_at_10));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// test_3d6a792e6949268f
+	aotLib[0x7ba01c94199e3689] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_3d6a792e6949268f>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
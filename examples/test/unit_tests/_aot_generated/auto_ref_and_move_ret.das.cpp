@@ -0,0 +1,168 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_10827148179742040309 {
+
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__3ceb21b1e6727087;
+
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xaf63e44c8601fa24ul };
+TypeInfo __type_info__3ceb21b1e6727087 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, 0x3ceb21b1e6727087ul };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__3ceb21b1e6727087 };
+
+inline TArray<int32_t> & _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd ( Context * __context__, TArray<int32_t> & __a_rename_at_42 );
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> & __Arr_rename_at_75, int32_t __value_rename_at_75 );
+inline int32_t abs_bd4386af1c94038b ( Context * __context__, int32_t __i_rename_at_1 );
+inline TArray<int32_t> foo_c3e724c0550de614 ( Context * __context__, TArray<int32_t> & __bar_rename_at_4 );
+inline bool test_95d3455d9e9d1c16 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline TArray<int32_t> & _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd ( Context * __context__, TArray<int32_t> &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<TArray<int32_t> &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<TArray<int32_t> &>::cast(__a_rename_at_42);
+}
+
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_75, int32_t __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_75),4,__context__),__context__),__value_rename_at_75);
+}
+
+inline int32_t abs_bd4386af1c94038b ( Context * __context__, int32_t __i_rename_at_1 )
+{
+	return das_auto_cast<int32_t>::cast((__i_rename_at_1 < 0) ? das_auto_cast<int32_t>::cast(-__i_rename_at_1) : das_auto_cast<int32_t>::cast(__i_rename_at_1));
+}
+
+inline TArray<int32_t> foo_c3e724c0550de614 ( Context * __context__, TArray<int32_t> &  __bar_rename_at_4 )
+{
+	TArray<int32_t> * __b_rename_at_5 = &(__bar_rename_at_4);
+	{
+		uint64_t __loop_count_6 = UINT64_MAX;
+		// x : int const
+		das_iterator<range> __x_iterator(range(0,10));
+		int32_t __x_rename_at_6;
+		__loop_count_6 = das_loop_count(__loop_count_6,__x_iterator.loop_begin(__context__,(__x_rename_at_6)));
+		for ( ; __loop_count_6 ; --__loop_count_6, ++__x_rename_at_6 )
+		{
+			_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass((*__b_rename_at_5)),__x_rename_at_6);
+		}
+		__x_iterator.loop_end(__context__,(__x_rename_at_6));
+	};
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd(__context__,das_arg<TArray<int32_t>>::pass((*__b_rename_at_5))));
+}
+
+inline bool test_95d3455d9e9d1c16 ( Context * __context__ )
+{
+	TArray<int32_t> __a_rename_at_12; das_zero(__a_rename_at_12);
+	{
+		uint64_t __loop_count_13 = UINT64_MAX;
+		// x : int const
+		das_iterator<range> __x_iterator(range(0,10));
+		int32_t __x_rename_at_13;
+		__loop_count_13 = das_loop_count(__loop_count_13,__x_iterator.loop_begin(__context__,(__x_rename_at_13)));
+		for ( ; __loop_count_13 ; --__loop_count_13, ++__x_rename_at_13 )
+		{
+			_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_12),10 - __x_rename_at_13);
+		}
+		__x_iterator.loop_end(__context__,(__x_rename_at_13));
+	};
+	TArray<int32_t> __t_rename_at_15; das_zero(__t_rename_at_15); das_move(__t_rename_at_15, foo_c3e724c0550de614(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_12)));
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_12)) == 0));
+	{
+		uint64_t __loop_count_17 = UINT64_MAX;
+		// x : int const
+		das_iterator<range> __x_iterator(range(-10,10));
+		int32_t __x_rename_at_17;
+		__loop_count_17 = das_loop_count(__loop_count_17,__x_iterator.loop_begin(__context__,(__x_rename_at_17)));
+		// y : int&
+		das_iterator<TArray<int32_t>> __y_iterator(__t_rename_at_15);
+		int32_t * __restrict __y_rename_at_17;
+		__loop_count_17 = das_loop_count(__loop_count_17,__y_iterator.loop_begin(__context__,(__y_rename_at_17)));
+		for ( ; __loop_count_17 ; --__loop_count_17, ++__x_rename_at_17, ++__y_rename_at_17 )
+		{
+			DAS_ASSERT((abs_bd4386af1c94038b(__context__,__x_rename_at_17) == (*__y_rename_at_17)));
+		}
+		__x_iterator.loop_end(__context__,(__x_rename_at_17));
+		__y_iterator.loop_end(__context__,(__y_rename_at_17));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd
+	aotLib[0x66e322246598e835] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TArray<int32_t> & (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd>>();
+	};
+	// _Funcbuiltin_0x60_push_d21751720b4df10e
+	aotLib[0x9fb5b63c22625999] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_d21751720b4df10e>>();
+	};
+	// abs_bd4386af1c94038b
+	aotLib[0x435688c52fcf7e75] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&abs_bd4386af1c94038b>>();
+	};
+	// foo_c3e724c0550de614
+	aotLib[0xb14996f6c0572445] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TArray<int32_t> &  ),&foo_c3e724c0550de614>>();
+	};
+	// test_95d3455d9e9d1c16
+	aotLib[0xc60e361e307dad18] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_95d3455d9e9d1c16>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
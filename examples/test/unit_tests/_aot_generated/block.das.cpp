@@ -0,0 +1,279 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_7285053693875740733 {
+
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern VarInfo __var_info__61259ea81abc7b8f;
+extern VarInfo __var_info__f6dfae96345dd901;
+extern VarInfo __var_info__c2160882aba7101d;
+extern VarInfo __var_info__c1324c9fc48d769a;
+extern FuncInfo __func_info__20af7f4711b3f3be;
+extern FuncInfo __func_info__713cdbcd6d7157b6;
+extern FuncInfo __func_info__f7360bd36c815503;
+extern FuncInfo __func_info__52eea8e6040ca532;
+extern FuncInfo __func_info__9ae7a2f00aea5535;
+extern FuncInfo __func_info__eeb3b74c98cb09c3;
+
+FuncInfo __func_info__20af7f4711b3f3be = {"invoke block<int> const", "", nullptr, 0, 32, &__type_info__af63e44c8601fa24, nullptr,0,0x20af7f4711b3f3beul, 0x0 };
+VarInfo __func_info__713cdbcd6d7157b6_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, 0xc1324c9fc48d769aul, "a2", 0 };
+VarInfo * __func_info__713cdbcd6d7157b6_fields[1] =  { &__func_info__713cdbcd6d7157b6_field_0 };
+FuncInfo __func_info__713cdbcd6d7157b6 = {"invoke block<(a2:int const):int> const", "", __func_info__713cdbcd6d7157b6_fields, 1, 32, &__type_info__af63e44c8601fa24, nullptr,0,0x713cdbcd6d7157b6ul, 0x0 };
+VarInfo __func_info__f7360bd36c815503_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, 0x61259ea81abc7b8ful, "a3", 0 };
+VarInfo * __func_info__f7360bd36c815503_fields[1] =  { &__func_info__f7360bd36c815503_field_0 };
+FuncInfo __func_info__f7360bd36c815503 = {"invoke block<(a3:int const):int> const", "", __func_info__f7360bd36c815503_fields, 1, 32, &__type_info__af63e44c8601fa24, nullptr,0,0xf7360bd36c815503ul, 0x0 };
+VarInfo __func_info__52eea8e6040ca532_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 285, 4, 0xc2160882aba7101dul, "a", 0 };
+VarInfo * __func_info__52eea8e6040ca532_fields[1] =  { &__func_info__52eea8e6040ca532_field_0 };
+FuncInfo __func_info__52eea8e6040ca532 = {"invoke block<(a:int& -const):int> const", "", __func_info__52eea8e6040ca532_fields, 1, 32, &__type_info__af63e44c8601fa24, nullptr,0,0x52eea8e6040ca532ul, 0x0 };
+VarInfo __func_info__9ae7a2f00aea5535_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, 0xf6dfae96345dd901ul, "a1", 0 };
+VarInfo * __func_info__9ae7a2f00aea5535_fields[1] =  { &__func_info__9ae7a2f00aea5535_field_0 };
+FuncInfo __func_info__9ae7a2f00aea5535 = {"invoke block<(a1:int const):int> const", "", __func_info__9ae7a2f00aea5535_fields, 1, 32, &__type_info__af63e44c8601fa24, nullptr,0,0x9ae7a2f00aea5535ul, 0x0 };
+FuncInfo __func_info__eeb3b74c98cb09c3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,0xeeb3b74c98cb09c3ul, 0x0 };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xaf63e44c8601fa24ul };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, 0xaf63eb4c86020609ul };
+
+
+inline void twice_8e54f11b4ead5bbf ( Context * __context__, Block DAS_COMMENT((void)) const  & __b_rename_at_4 );
+inline int32_t twice_good_20186d440a33695f ( Context * __context__, Block DAS_COMMENT((int32_t)) const  & __b_rename_at_8 );
+inline void crapOnStack_fef00f342c0a0bc6 ( Context * __context__ );
+inline void func1_b01e3c7942154c1e ( Context * __context__, Block DAS_COMMENT((void)) const  & __b_rename_at_20 );
+inline void func2_c0fc074b68cc54d4 ( Context * __context__, Block DAS_COMMENT((void)) const  & __b_rename_at_25 );
+inline void func3_b01e3c7942154c1e ( Context * __context__, Block DAS_COMMENT((void)) const  & __b_rename_at_30 );
+inline void func4_b01e3c7942154c1e ( Context * __context__, Block DAS_COMMENT((void)) const  & __b_rename_at_35 );
+inline int32_t badd_2561f855b652e9f ( Context * __context__, int32_t __ext_rename_at_40, Block DAS_COMMENT((int32_t,int32_t)) const  & __b_rename_at_40 );
+inline int32_t radd_f99307a4cdee40a7 ( Context * __context__, int32_t & __ext_rename_at_43, Block DAS_COMMENT((int32_t,int32_t &)) const  & __b_rename_at_43 );
+inline bool test_be577f7114869df3 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void twice_8e54f11b4ead5bbf ( Context * __context__, Block DAS_COMMENT((void)) const  &  __b_rename_at_4 )
+{
+	das_invoke<void>::invoke(__context__,nullptr,__b_rename_at_4);
+	das_invoke<void>::invoke(__context__,nullptr,__b_rename_at_4);
+}
+
+inline int32_t twice_good_20186d440a33695f ( Context * __context__, Block DAS_COMMENT((int32_t)) const  &  __b_rename_at_8 )
+{
+	int32_t __t_rename_at_9 = 0;
+	__t_rename_at_9 += das_invoke<int32_t>::invoke(__context__,nullptr,__b_rename_at_8);
+	__t_rename_at_9 += das_invoke<int32_t>::invoke(__context__,nullptr,__b_rename_at_8);
+	return das_auto_cast<int32_t>::cast(__t_rename_at_9);
+}
+
+inline void crapOnStack_fef00f342c0a0bc6 ( Context * __context__ )
+{
+	TDim<int32_t,20> __a_rename_at_16; das_zero(__a_rename_at_16);
+	{
+		uint64_t __loop_count_17 = UINT64_MAX;
+		// b : int& -const
+		das_iterator<TDim<int32_t,20>> __b_iterator(__a_rename_at_16);
+		int32_t * __restrict __b_rename_at_17;
+		__loop_count_17 = das_loop_count(__loop_count_17,__b_iterator.loop_begin(__context__,(__b_rename_at_17)));
+		for ( ; __loop_count_17 ; --__loop_count_17, ++__b_rename_at_17 )
+		{
+			das_copy((*__b_rename_at_17),13);
+		}
+		__b_iterator.loop_end(__context__,(__b_rename_at_17));
+	};
+}
+
+inline void func1_b01e3c7942154c1e ( Context * __context__, Block DAS_COMMENT((void)) const  &  __b_rename_at_20 )
+{
+	crapOnStack_fef00f342c0a0bc6(__context__);
+	das_invoke<void>::invoke(__context__,nullptr,__b_rename_at_20);
+	crapOnStack_fef00f342c0a0bc6(__context__);
+}
+
+inline void func2_c0fc074b68cc54d4 ( Context * __context__, Block DAS_COMMENT((void)) const  &  __b_rename_at_25 )
+{
+	crapOnStack_fef00f342c0a0bc6(__context__);
+	func3_b01e3c7942154c1e(__context__,__b_rename_at_25);
+	crapOnStack_fef00f342c0a0bc6(__context__);
+}
+
+inline void func3_b01e3c7942154c1e ( Context * __context__, Block DAS_COMMENT((void)) const  &  __b_rename_at_30 )
+{
+	crapOnStack_fef00f342c0a0bc6(__context__);
+	das_invoke<void>::invoke(__context__,nullptr,__b_rename_at_30);
+	crapOnStack_fef00f342c0a0bc6(__context__);
+}
+
+inline void func4_b01e3c7942154c1e ( Context * __context__, Block DAS_COMMENT((void)) const  &  __b_rename_at_35 )
+{
+	crapOnStack_fef00f342c0a0bc6(__context__);
+	das_invoke<void>::invoke(__context__,nullptr,__b_rename_at_35);
+	crapOnStack_fef00f342c0a0bc6(__context__);
+}
+
+inline int32_t badd_2561f855b652e9f ( Context * __context__, int32_t __ext_rename_at_40, Block DAS_COMMENT((int32_t,int32_t)) const  &  __b_rename_at_40 )
+{
+	return das_auto_cast<int32_t>::cast(das_invoke<int32_t>::invoke<int32_t>(__context__,nullptr,__b_rename_at_40,__ext_rename_at_40));
+}
+
+inline int32_t radd_f99307a4cdee40a7 ( Context * __context__, int32_t & __ext_rename_at_43, Block DAS_COMMENT((int32_t,int32_t &)) const  &  __b_rename_at_43 )
+{
+	return das_auto_cast<int32_t>::cast(das_invoke<int32_t>::invoke<int32_t &>(__context__,nullptr,__b_rename_at_43,__ext_rename_at_43));
+}
+
+inline bool test_be577f7114869df3 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,848,"test " DAS_FILE_LINE);
+{
+	int32_t __a_rename_at_49 = 0;
+	int32_t __b_rename_at_50 = 0;
+	twice_8e54f11b4ead5bbf(__context__,das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		++__a_rename_at_49;
+	}));
+	DAS_ASSERT((__a_rename_at_49 == 2));
+	das_copy(__b_rename_at_50,twice_good_20186d440a33695f(__context__,das_make_block<int32_t>(__context__,0,0,&__func_info__20af7f4711b3f3be,[&]()->int32_t{
+		return das_auto_cast<int32_t>::cast(__a_rename_at_49++);
+	})));
+	DAS_ASSERT(((__a_rename_at_49 == 4) && (__b_rename_at_50 == 5)));
+	das_copy(__b_rename_at_50,twice_good_20186d440a33695f(__context__,das_make_block<int32_t>(__context__,0,0,&__func_info__20af7f4711b3f3be,[&]()->int32_t{
+		return das_auto_cast<int32_t>::cast(__a_rename_at_49++);
+	})));
+	DAS_ASSERT((__b_rename_at_50 == 9));
+	das_copy(__b_rename_at_50,twice_good_20186d440a33695f(__context__,das_make_block<int32_t>(__context__,0,0,&__func_info__20af7f4711b3f3be,[&]()->int32_t{
+		return das_auto_cast<int32_t>::cast(++__a_rename_at_49);
+	})));
+	DAS_ASSERT((__a_rename_at_49 == 8));
+	DAS_ASSERT((__b_rename_at_50 == 15));
+	int32_t __x_rename_at_62 = 0;
+	int32_t __y_rename_at_63 = 0;
+	func1_b01e3c7942154c1e(__context__,das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		__x_rename_at_62 += 1;
+		__y_rename_at_63 += 2;
+		func2_c0fc074b68cc54d4(__context__,das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+			++__x_rename_at_62;
+			__y_rename_at_63 += 3;
+		}));
+		func4_b01e3c7942154c1e(__context__,das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+			++__x_rename_at_62;
+			__y_rename_at_63 += 4;
+		}));
+	}));
+	DAS_ASSERT(((__x_rename_at_62 == 3) && (__y_rename_at_63 == 9)));
+	int32_t __v1_rename_at_75 = 1;
+	int32_t __res_rename_at_76 = badd_2561f855b652e9f(__context__,1000,das_make_block<int32_t,int32_t>(__context__,512,0,&__func_info__9ae7a2f00aea5535,[&](int32_t const  __a1_rename_at_76)->int32_t{
+		return das_auto_cast<int32_t>::cast(__v1_rename_at_75++ + __a1_rename_at_76);
+	}));
+	DAS_ASSERT((__res_rename_at_76 == 1001));
+	das_copy(__res_rename_at_76,badd_2561f855b652e9f(__context__,1000,das_make_block<int32_t,int32_t>(__context__,576,0,&__func_info__9ae7a2f00aea5535,[&](int32_t const  __a1_rename_at_78)->int32_t{
+		return das_auto_cast<int32_t>::cast(__v1_rename_at_75 + __a1_rename_at_78);
+	})));
+	DAS_ASSERT((__res_rename_at_76 == 1002));
+	das_copy(__v1_rename_at_75,3);
+	das_copy(__res_rename_at_76,badd_2561f855b652e9f(__context__,1000,das_make_block<int32_t,int32_t>(__context__,640,0,&__func_info__9ae7a2f00aea5535,[&](int32_t const  __a1_rename_at_81)->int32_t{
+		return das_auto_cast<int32_t>::cast(__v1_rename_at_75 + __a1_rename_at_81);
+	})));
+	DAS_ASSERT((__res_rename_at_76 == 1003));
+	das_copy(__v1_rename_at_75,4);
+	das_copy(__res_rename_at_76,badd_2561f855b652e9f(__context__,1000,das_make_block<int32_t,int32_t>(__context__,704,0,&__func_info__713cdbcd6d7157b6,[&](int32_t const  __a2_rename_at_85)->int32_t{
+		return das_auto_cast<int32_t>::cast(badd_2561f855b652e9f(__context__,2000,das_make_block<int32_t,int32_t>(__context__,768,0,&__func_info__f7360bd36c815503,[&](int32_t const  __a3_rename_at_86)->int32_t{
+			return das_auto_cast<int32_t>::cast((__a3_rename_at_86 + __a2_rename_at_85) + __v1_rename_at_75);
+		})));
+	})));
+	DAS_ASSERT((__res_rename_at_76 == 3004));
+	das_copy(__v1_rename_at_75,3);
+	das_copy(__res_rename_at_76,radd_f99307a4cdee40a7(__context__,__v1_rename_at_75,das_make_block<int32_t,int32_t &>(__context__,832,0,&__func_info__52eea8e6040ca532,[&](int32_t & __a_rename_at_89)->int32_t{
+		return das_auto_cast<int32_t>::cast(__a_rename_at_89++);
+	})));
+	DAS_ASSERT(((__res_rename_at_76 == 3) && (__v1_rename_at_75 == 4)));
+	return das_auto_cast<bool>::cast(true);
+}}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// twice_8e54f11b4ead5bbf
+	aotLib[0xde398c5380df08d9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Block DAS_COMMENT((void)) const  &  ),&twice_8e54f11b4ead5bbf>>();
+	};
+	// twice_good_20186d440a33695f
+	aotLib[0x45ec54b7755a1005] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Block DAS_COMMENT((int32_t)) const  &  ),&twice_good_20186d440a33695f>>();
+	};
+	// crapOnStack_fef00f342c0a0bc6
+	aotLib[0xeeb2cb30c3b2c595] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&crapOnStack_fef00f342c0a0bc6>>();
+	};
+	// func1_b01e3c7942154c1e
+	aotLib[0x250b115e518aa727] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Block DAS_COMMENT((void)) const  &  ),&func1_b01e3c7942154c1e>>();
+	};
+	// func2_c0fc074b68cc54d4
+	aotLib[0x2b729aef38be64a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Block DAS_COMMENT((void)) const  &  ),&func2_c0fc074b68cc54d4>>();
+	};
+	// func3_b01e3c7942154c1e
+	aotLib[0x250b115e518aa727] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Block DAS_COMMENT((void)) const  &  ),&func3_b01e3c7942154c1e>>();
+	};
+	// func4_b01e3c7942154c1e
+	aotLib[0x250b115e518aa727] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Block DAS_COMMENT((void)) const  &  ),&func4_b01e3c7942154c1e>>();
+	};
+	// badd_2561f855b652e9f
+	aotLib[0x974f23b94ad52b05] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t , Block DAS_COMMENT((int32_t,int32_t)) const  &  ),&badd_2561f855b652e9f>>();
+	};
+	// radd_f99307a4cdee40a7
+	aotLib[0x356b436447da1f21] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t & , Block DAS_COMMENT((int32_t,int32_t &)) const  &  ),&radd_f99307a4cdee40a7>>();
+	};
+	// test_be577f7114869df3
+	aotLib[0x9ceb197ab1b755dc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_be577f7114869df3>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
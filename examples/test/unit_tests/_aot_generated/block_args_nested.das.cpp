@@ -0,0 +1,246 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_10849710622718832447 {
+
+extern StructInfo __struct_info__f35ff723fded4627;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern VarInfo __var_info__b275029e6c0739d6;
+extern VarInfo __var_info__2e024e90a5755266;
+extern VarInfo __var_info__7f8d6207902222ef;
+extern VarInfo __var_info__a08ab92745ae7029;
+extern VarInfo __var_info__5c694f07ecd73d90;
+extern VarInfo __var_info__d66974921d0006f2;
+extern VarInfo __var_info__765ce69a732f4247;
+extern VarInfo __var_info__54688f47465b66c6;
+extern VarInfo __var_info__c0e00482aa9f06e4;
+extern VarInfo __var_info__fb49b641a7038dc1;
+extern VarInfo __var_info__4fd22671b9e67f0d;
+extern VarInfo __var_info__ba7acbad7efbcaf0;
+extern VarInfo __var_info__c929db76ade7350;
+extern FuncInfo __func_info__c800839e2b6ff2eb;
+extern FuncInfo __func_info__2e560e096b107520;
+extern FuncInfo __func_info__d4de8f75595b1fcc;
+extern FuncInfo __func_info__a9b98c218ae5e1df;
+extern FuncInfo __func_info__f9c266abeb1f6de0;
+extern FuncInfo __func_info__44f1e3aa3eecfede;
+extern FuncInfo __func_info__7fa9ceffe25bec1a;
+extern FuncInfo __func_info__5e37de60eb6ae1e2;
+extern FuncInfo __func_info__65db1f6b7aee37af;
+extern FuncInfo __func_info__f858a3e8cd2cc611;
+extern FuncInfo __func_info__b8fc2c9b4646317f;
+extern FuncInfo __func_info__829cc39c54503eed;
+
+VarInfo __struct_info__f35ff723fded4627_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xa08ab92745ae7029ul, "v", 0 };
+VarInfo * __struct_info__f35ff723fded4627_fields[1] =  { &__struct_info__f35ff723fded4627_field_0 };
+StructInfo __struct_info__f35ff723fded4627 = {(char*)"Foo", (char*)"", 0, __struct_info__f35ff723fded4627_fields, 1, 4, 0x0ul, nullptr, 0xf35ff723fded4627ul };
+VarInfo __func_info__c800839e2b6ff2eb_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 8236, 8, 0x7f8d6207902222eful, "b", 0 };
+VarInfo * __func_info__c800839e2b6ff2eb_fields[1] =  { &__func_info__c800839e2b6ff2eb_field_0 };
+FuncInfo __func_info__c800839e2b6ff2eb = {"invoke block<(b:int? const):void> const", "", __func_info__c800839e2b6ff2eb_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,0xc800839e2b6ff2ebul, 0x0 };
+VarInfo __func_info__2e560e096b107520_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, 0x765ce69a732f4247ul, "b", 0 };
+VarInfo * __func_info__2e560e096b107520_fields[1] =  { &__func_info__2e560e096b107520_field_0 };
+FuncInfo __func_info__2e560e096b107520 = {"invoke block<(b:int const):void> const", "", __func_info__2e560e096b107520_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,0x2e560e096b107520ul, 0x0 };
+VarInfo __func_info__d4de8f75595b1fcc_field_0 =  { Type::tStructure, &__struct_info__f35ff723fded4627, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 62, 4, 0xc929db76ade7350ul, "a", 0 };
+VarInfo * __func_info__d4de8f75595b1fcc_fields[1] =  { &__func_info__d4de8f75595b1fcc_field_0 };
+FuncInfo __func_info__d4de8f75595b1fcc = {"invoke block<(a:Foo const):void> const", "", __func_info__d4de8f75595b1fcc_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,0xd4de8f75595b1fccul, 0x0 };
+VarInfo __func_info__a9b98c218ae5e1df_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, 0xd66974921d0006f2ul, "c", 0 };
+VarInfo * __func_info__a9b98c218ae5e1df_fields[1] =  { &__func_info__a9b98c218ae5e1df_field_0 };
+FuncInfo __func_info__a9b98c218ae5e1df = {"invoke block<(c:int const):void> const", "", __func_info__a9b98c218ae5e1df_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,0xa9b98c218ae5e1dful, 0x0 };
+VarInfo __func_info__f9c266abeb1f6de0_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 8236, 8, 0xba7acbad7efbcaf0ul, "a", 0 };
+VarInfo * __func_info__f9c266abeb1f6de0_fields[1] =  { &__func_info__f9c266abeb1f6de0_field_0 };
+FuncInfo __func_info__f9c266abeb1f6de0 = {"invoke block<(a:int? const):void> const", "", __func_info__f9c266abeb1f6de0_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,0xf9c266abeb1f6de0ul, 0x0 };
+VarInfo __func_info__44f1e3aa3eecfede_field_0 =  { Type::tStructure, &__struct_info__f35ff723fded4627, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 62, 4, 0x2e024e90a5755266ul, "c", 0 };
+VarInfo * __func_info__44f1e3aa3eecfede_fields[1] =  { &__func_info__44f1e3aa3eecfede_field_0 };
+FuncInfo __func_info__44f1e3aa3eecfede = {"invoke block<(c:Foo const):void> const", "", __func_info__44f1e3aa3eecfede_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,0x44f1e3aa3eecfedeul, 0x0 };
+VarInfo __func_info__7fa9ceffe25bec1a_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 317, 4, 0x4fd22671b9e67f0dul, "b", 0 };
+VarInfo * __func_info__7fa9ceffe25bec1a_fields[1] =  { &__func_info__7fa9ceffe25bec1a_field_0 };
+FuncInfo __func_info__7fa9ceffe25bec1a = {"invoke block<(b:int const&):void> const", "", __func_info__7fa9ceffe25bec1a_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,0x7fa9ceffe25bec1aul, 0x0 };
+VarInfo __func_info__5e37de60eb6ae1e2_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 8236, 8, 0xb275029e6c0739d6ul, "c", 0 };
+VarInfo * __func_info__5e37de60eb6ae1e2_fields[1] =  { &__func_info__5e37de60eb6ae1e2_field_0 };
+FuncInfo __func_info__5e37de60eb6ae1e2 = {"invoke block<(c:int? const):void> const", "", __func_info__5e37de60eb6ae1e2_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,0x5e37de60eb6ae1e2ul, 0x0 };
+VarInfo __func_info__65db1f6b7aee37af_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 317, 4, 0x5c694f07ecd73d90ul, "a", 0 };
+VarInfo * __func_info__65db1f6b7aee37af_fields[1] =  { &__func_info__65db1f6b7aee37af_field_0 };
+FuncInfo __func_info__65db1f6b7aee37af = {"invoke block<(a:int const&):void> const", "", __func_info__65db1f6b7aee37af_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,0x65db1f6b7aee37aful, 0x0 };
+VarInfo __func_info__f858a3e8cd2cc611_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 317, 4, 0x54688f47465b66c6ul, "c", 0 };
+VarInfo * __func_info__f858a3e8cd2cc611_fields[1] =  { &__func_info__f858a3e8cd2cc611_field_0 };
+FuncInfo __func_info__f858a3e8cd2cc611 = {"invoke block<(c:int const&):void> const", "", __func_info__f858a3e8cd2cc611_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,0xf858a3e8cd2cc611ul, 0x0 };
+VarInfo __func_info__b8fc2c9b4646317f_field_0 =  { Type::tStructure, &__struct_info__f35ff723fded4627, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 62, 4, 0xfb49b641a7038dc1ul, "b", 0 };
+VarInfo * __func_info__b8fc2c9b4646317f_fields[1] =  { &__func_info__b8fc2c9b4646317f_field_0 };
+FuncInfo __func_info__b8fc2c9b4646317f = {"invoke block<(b:Foo const):void> const", "", __func_info__b8fc2c9b4646317f_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,0xb8fc2c9b4646317ful, 0x0 };
+VarInfo __func_info__829cc39c54503eed_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, 0xc0e00482aa9f06e4ul, "a", 0 };
+VarInfo * __func_info__829cc39c54503eed_fields[1] =  { &__func_info__829cc39c54503eed_field_0 };
+FuncInfo __func_info__829cc39c54503eed = {"invoke block<(a:int const):void> const", "", __func_info__829cc39c54503eed_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,0x829cc39c54503eedul, 0x0 };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xaf63e44c8601fa24ul };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, 0xaf63eb4c86020609ul };
+
+namespace  { struct Foo; };
+namespace  {
+
+struct Foo {
+	int32_t v;
+};
+static_assert(sizeof(Foo)==4,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,v)==0,"structure field offset mismatch with DAS");
+}
+
+inline void passthrough_2b483dc4984ff341 ( Context * __context__, int32_t __a_rename_at_1, Block DAS_COMMENT((void,int32_t)) const  & __blk_rename_at_1 );
+inline void passthroughref_6c13e02c413b8e0b ( Context * __context__, int32_t const  & __a_rename_at_4, Block DAS_COMMENT((void,int32_t const  &)) const  & __blk_rename_at_4 );
+inline void passthroughptr_6af8e096cf860265 ( Context * __context__, int32_t * const  __a_rename_at_7, Block DAS_COMMENT((void,int32_t * const )) const  & __blk_rename_at_7 );
+inline void passthroughFoo_857ec50884293c9d ( Context * __context__, Foo const  & __a_rename_at_13, Block DAS_COMMENT((void,Foo const )) const  & __blk_rename_at_13 );
+inline bool test_f3cef99f91bca05d ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void passthrough_2b483dc4984ff341 ( Context * __context__, int32_t __a_rename_at_1, Block DAS_COMMENT((void,int32_t)) const  &  __blk_rename_at_1 )
+{
+	das_invoke<void>::invoke<int32_t>(__context__,nullptr,__blk_rename_at_1,__a_rename_at_1);
+}
+
+inline void passthroughref_6c13e02c413b8e0b ( Context * __context__, int32_t const  & __a_rename_at_4, Block DAS_COMMENT((void,int32_t const  &)) const  &  __blk_rename_at_4 )
+{
+	das_invoke<void>::invoke<int32_t const  &>(__context__,nullptr,__blk_rename_at_4,__a_rename_at_4);
+}
+
+inline void passthroughptr_6af8e096cf860265 ( Context * __context__, int32_t * const  __a_rename_at_7, Block DAS_COMMENT((void,int32_t * const )) const  &  __blk_rename_at_7 )
+{
+	das_invoke<void>::invoke<int32_t * const >(__context__,nullptr,__blk_rename_at_7,__a_rename_at_7);
+}
+
+inline void passthroughFoo_857ec50884293c9d ( Context * __context__, Foo const  &  __a_rename_at_13, Block DAS_COMMENT((void,Foo const )) const  &  __blk_rename_at_13 )
+{
+	das_invoke<void>::invoke<Foo const  &>(__context__,nullptr,__blk_rename_at_13,__a_rename_at_13);
+}
+
+inline bool test_f3cef99f91bca05d ( Context * __context__ ) { das_stack_prologue __prologue(__context__,896,"test " DAS_FILE_LINE);
+{
+	Foo _temp_make_local_43_656;
+	passthrough_2b483dc4984ff341(__context__,1,das_make_block<void,int32_t>(__context__,80,0,&__func_info__829cc39c54503eed,[&](int32_t const  __a_rename_at_18)->void{
+		DAS_ASSERT((__a_rename_at_18 == 1));
+		passthrough_2b483dc4984ff341(__context__,2,das_make_block<void,int32_t>(__context__,144,0,&__func_info__2e560e096b107520,[&](int32_t const  __b_rename_at_20)->void{
+			DAS_ASSERT(((__a_rename_at_18 == 1) && (__b_rename_at_20 == 2)));
+			passthrough_2b483dc4984ff341(__context__,3,das_make_block<void,int32_t>(__context__,208,0,&__func_info__a9b98c218ae5e1df,[&](int32_t const  __c_rename_at_22)->void{
+				DAS_ASSERT((((__a_rename_at_18 == 1) && (__b_rename_at_20 == 2)) && (__c_rename_at_22 == 3)));
+			}));
+		}));
+	}));
+	int32_t __A_rename_at_25 = 1;
+	int32_t __B_rename_at_26 = 2;
+	int32_t __C_rename_at_27 = 3;
+	passthroughref_6c13e02c413b8e0b(__context__,__A_rename_at_25,das_make_block<void,int32_t const  &>(__context__,320,0,&__func_info__65db1f6b7aee37af,[&](int32_t const  & __a_rename_at_28)->void{
+		DAS_ASSERT((__a_rename_at_28 == 1));
+		passthroughref_6c13e02c413b8e0b(__context__,__B_rename_at_26,das_make_block<void,int32_t const  &>(__context__,384,0,&__func_info__7fa9ceffe25bec1a,[&](int32_t const  & __b_rename_at_30)->void{
+			DAS_ASSERT(((__a_rename_at_28 == 1) && (__b_rename_at_30 == 2)));
+			passthroughref_6c13e02c413b8e0b(__context__,__C_rename_at_27,das_make_block<void,int32_t const  &>(__context__,448,0,&__func_info__f858a3e8cd2cc611,[&](int32_t const  & __c_rename_at_32)->void{
+				DAS_ASSERT((((__a_rename_at_28 == 1) && (__b_rename_at_30 == 2)) && (__c_rename_at_32 == 3)));
+			}));
+		}));
+	}));
+	passthroughptr_6af8e096cf860265(__context__,das_ref(__context__,__A_rename_at_25),das_make_block<void,int32_t * const >(__context__,512,0,&__func_info__f9c266abeb1f6de0,[&](int32_t * const  __a_rename_at_36)->void{
+		DAS_ASSERT((das_deref(__context__,__a_rename_at_36) == 1));
+		passthroughptr_6af8e096cf860265(__context__,das_ref(__context__,__B_rename_at_26),das_make_block<void,int32_t * const >(__context__,576,0,&__func_info__c800839e2b6ff2eb,[&](int32_t * const  __b_rename_at_38)->void{
+			DAS_ASSERT(((das_deref(__context__,__a_rename_at_36) == 1) && (das_deref(__context__,__b_rename_at_38) == 2)));
+			passthroughptr_6af8e096cf860265(__context__,das_ref(__context__,__C_rename_at_27),das_make_block<void,int32_t * const >(__context__,640,0,&__func_info__5e37de60eb6ae1e2,[&](int32_t * const  __c_rename_at_40)->void{
+				DAS_ASSERT((((das_deref(__context__,__a_rename_at_36) == 1) && (das_deref(__context__,__b_rename_at_38) == 2)) && (das_deref(__context__,__c_rename_at_40) == 3)));
+			}));
+		}));
+	}));
+	passthroughFoo_857ec50884293c9d(__context__,das_arg<Foo>::pass((([&]() -> Foo& {
+		das_copy((_temp_make_local_43_656.v),(1));
+		return _temp_make_local_43_656;
+	})())),das_make_block<void,Foo const  &>(__context__,720,0,&__func_info__d4de8f75595b1fcc,[&](Foo const  & __a_rename_at_43)->void{
+		Foo _temp_make_local_45_736;
+		DAS_ASSERT((__a_rename_at_43.v == 1));
+		passthroughFoo_857ec50884293c9d(__context__,das_arg<Foo>::pass((([&]() -> Foo& {
+			das_copy((_temp_make_local_45_736.v),(2));
+			return _temp_make_local_45_736;
+		})())),das_make_block<void,Foo const  &>(__context__,800,0,&__func_info__b8fc2c9b4646317f,[&](Foo const  & __b_rename_at_45)->void{
+			Foo _temp_make_local_47_816;
+			DAS_ASSERT(((__a_rename_at_43.v == 1) && (__b_rename_at_45.v == 2)));
+			passthroughFoo_857ec50884293c9d(__context__,das_arg<Foo>::pass((([&]() -> Foo& {
+				das_copy((_temp_make_local_47_816.v),(3));
+				return _temp_make_local_47_816;
+			})())),das_make_block<void,Foo const  &>(__context__,880,0,&__func_info__44f1e3aa3eecfede,[&](Foo const  & __c_rename_at_47)->void{
+				DAS_ASSERT((((__a_rename_at_43.v == 1) && (__b_rename_at_45.v == 2)) && (__c_rename_at_47.v == 3)));
+			}));
+		}));
+	}));
+	return das_auto_cast<bool>::cast(true);
+}}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// passthrough_2b483dc4984ff341
+	aotLib[0x6fe0d841d0d71739] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , Block DAS_COMMENT((void,int32_t)) const  &  ),&passthrough_2b483dc4984ff341>>();
+	};
+	// passthroughref_6c13e02c413b8e0b
+	aotLib[0xd3946cd003dd8c51] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t const  & , Block DAS_COMMENT((void,int32_t const  &)) const  &  ),&passthroughref_6c13e02c413b8e0b>>();
+	};
+	// passthroughptr_6af8e096cf860265
+	aotLib[0xfc1fa0a4ddae434d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t * const  , Block DAS_COMMENT((void,int32_t * const )) const  &  ),&passthroughptr_6af8e096cf860265>>();
+	};
+	// passthroughFoo_857ec50884293c9d
+	aotLib[0x705ed0553a517e95] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo const  & , Block DAS_COMMENT((void,Foo const )) const  &  ),&passthroughFoo_857ec50884293c9d>>();
+	};
+	// test_f3cef99f91bca05d
+	aotLib[0x1c5508c8f763d5a8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_f3cef99f91bca05d>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,295 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require strings_boost
+ // require ast_boost
+ // require templates_boost
+ // require defer
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_10241801254913865887 {
+
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__64be5dc860f5ba81;
+extern TypeInfo __type_info__3ceb21b1e6727087;
+extern TypeInfo __type_info__289c16574f003020;
+
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xaf63e44c8601fa24ul };
+TypeInfo __type_info__64be5dc860f5ba81 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, 0x64be5dc860f5ba81ul };
+TypeInfo __type_info__3ceb21b1e6727087 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, 0x3ceb21b1e6727087ul };
+TypeInfo __type_info__289c16574f003020 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, 0x289c16574f003020ul };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__3ceb21b1e6727087 };
+TypeInfo * __tinfo_1[1] = { &__type_info__64be5dc860f5ba81 };
+TypeInfo * __tinfo_2[1] = { &__type_info__289c16574f003020 };
+namespace ast { struct AstFunctionAnnotation; };
+namespace ast { struct AstBlockAnnotation; };
+namespace ast { struct AstStructureAnnotation; };
+namespace ast { struct AstPassMacro; };
+namespace ast { struct AstVariantMacro; };
+namespace ast { struct AstReaderMacro; };
+namespace ast { struct AstCommentReader; };
+namespace ast { struct AstCallMacro; };
+namespace ast { struct AstTypeInfoMacro; };
+namespace ast { struct AstEnumerationAnnotation; };
+namespace ast { struct AstVisitor; };
+namespace ast_boost { struct MacroMacro; };
+namespace ast_boost { struct TagFunctionAnnotation; };
+namespace ast_boost { struct TagStructureAnnotation; };
+namespace ast_boost { struct SetupAnyAnnotation; };
+namespace ast_boost { struct SetupFunctionAnnotatoin; };
+namespace ast_boost { struct SetupBlockAnnotatoin; };
+namespace ast_boost { struct SetupStructureAnnotatoin; };
+namespace ast_boost { struct SetupEnumerationAnnotation; };
+namespace ast_boost { struct SetupContractAnnotatoin; };
+namespace ast_boost { struct SetupReaderMacro; };
+namespace ast_boost { struct SetupCommentReader; };
+namespace ast_boost { struct SetupVariantMacro; };
+namespace ast_boost { struct SetupCallMacro; };
+namespace ast_boost { struct SetupTypeInfoMacro; };
+namespace ast_boost { struct SetupInferMacro; };
+namespace ast_boost { struct SetupDirtyInferMacro; };
+namespace ast_boost { struct SetupLintMacro; };
+namespace ast_boost { struct SetupGlobalLintMacro; };
+namespace ast_boost { struct SetupOptimizationMacro; };
+namespace ast_boost { struct TagFunctionMacro; };
+namespace ast_boost { struct BetterRttiVisitor; };
+namespace templates_boost { struct Template; };
+namespace templates_boost { struct TemplateVisitor; };
+namespace templates_boost { struct RemoveDerefVisitor; };
+namespace defer { struct DeferMacro; };
+namespace defer { struct DeferDeleteMacro; };
+// unused enumeration CompilationError
+// unused enumeration Type
+// unused enumeration RefMatters
+// unused enumeration ConstMatters
+// unused enumeration TemporaryMatters
+// unused enumeration SideEffects
+// unused enumeration CaptureMode
+// unused structure AstFunctionAnnotation
+// unused structure AstBlockAnnotation
+// unused structure AstStructureAnnotation
+// unused structure AstPassMacro
+// unused structure AstVariantMacro
+// unused structure AstReaderMacro
+// unused structure AstCommentReader
+// unused structure AstCallMacro
+// unused structure AstTypeInfoMacro
+// unused structure AstEnumerationAnnotation
+// unused structure AstVisitor
+// unused structure MacroMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagStructureAnnotation
+// unused structure SetupAnyAnnotation
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupBlockAnnotatoin
+// unused structure SetupStructureAnnotatoin
+// unused structure SetupEnumerationAnnotation
+// unused structure SetupContractAnnotatoin
+// unused structure SetupReaderMacro
+// unused structure SetupCommentReader
+// unused structure SetupVariantMacro
+// unused structure SetupCallMacro
+// unused structure SetupTypeInfoMacro
+// unused structure SetupInferMacro
+// unused structure SetupDirtyInferMacro
+// unused structure SetupLintMacro
+// unused structure SetupGlobalLintMacro
+// unused structure SetupOptimizationMacro
+// unused structure TagFunctionMacro
+// unused structure BetterRttiVisitor
+// unused structure Template
+// unused structure TemplateVisitor
+// unused structure RemoveDerefVisitor
+// unused structure DeferMacro
+// unused structure DeferDeleteMacro
+
+inline TArray<int32_t> & _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd ( Context * __context__, TArray<int32_t> & __a_rename_at_42 );
+inline void _Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07 ( Context * __context__, TArray<int32_t> & __a_rename_at_31, TArray<int32_t> & __b_rename_at_31 );
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> & __Arr_rename_at_75, int32_t __value_rename_at_75 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_293 );
+inline void check_def_7f5bf5e37d16767c ( Context * __context__, int32_t & __x_rename_at_3 );
+inline int32_t check_def_del_c91bc5da1e45cc36 ( Context * __context__, TArray<int32_t> & __a_rename_at_14 );
+inline void check_short_pipe_1493df9253024657 ( Context * __context__ );
+inline bool test_173a0e20e339136b ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline TArray<int32_t> & _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd ( Context * __context__, TArray<int32_t> &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<TArray<int32_t> &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<TArray<int32_t> &>::cast(__a_rename_at_42);
+}
+
+inline void _Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07 ( Context * __context__, TArray<int32_t> &  __a_rename_at_31, TArray<int32_t> &  __b_rename_at_31 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_1,cast<TArray<int32_t> &>::from(__a_rename_at_31)));
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_2,cast<TArray<int32_t> &>::from(__b_rename_at_31)));
+	das_move(__a_rename_at_31,__b_rename_at_31);
+}
+
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_75, int32_t __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_75),4,__context__),__context__),__value_rename_at_75);
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_293 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_293),4,__context__);
+}
+
+inline void check_def_7f5bf5e37d16767c ( Context * __context__, int32_t & __x_rename_at_3 )
+{
+/* finally */ auto __finally_4= das_finally([&](){
+	DAS_ASSERT((__x_rename_at_3 == 3));
+	--__x_rename_at_3;
+	DAS_ASSERT((__x_rename_at_3 == 2));
+	(__x_rename_at_3 *= 2);
+/* end finally */ });
+	__x_rename_at_3 += 2;
+}
+
+inline int32_t check_def_del_c91bc5da1e45cc36 ( Context * __context__, TArray<int32_t> &  __a_rename_at_14 )
+{
+/* finally */ auto __finally_15= das_finally([&](){
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_14));
+/* end finally */ });
+	_Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_14),das_arg<TArray<int32_t>>::pass(das_invoke<TArray<int32_t>>::invoke_cmres(__context__,nullptr,[&]()->TArray<int32_t>{
+		TArray<int32_t> ____acomp_15_rename_at_15; das_zero(____acomp_15_rename_at_15);
+		{
+			uint64_t __loop_count_15 = UINT64_MAX;
+			// x : int const
+			das_iterator<range> __x_iterator(range(0,10));
+			int32_t __x_rename_at_15;
+			__loop_count_15 = das_loop_count(__loop_count_15,__x_iterator.loop_begin(__context__,(__x_rename_at_15)));
+			for ( ; __loop_count_15 ; --__loop_count_15, ++__x_rename_at_15 )
+			{
+				_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(____acomp_15_rename_at_15),__x_rename_at_15 * __x_rename_at_15);
+			}
+			__x_iterator.loop_end(__context__,(__x_rename_at_15));
+		};
+		return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd(__context__,das_arg<TArray<int32_t>>::pass(____acomp_15_rename_at_15)));
+	})));
+	return das_auto_cast<int32_t>::cast(builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_14)));
+}
+
+inline void check_short_pipe_1493df9253024657 ( Context * __context__ )
+{
+	int32_t __x_rename_at_21 = 1;
+	{
+	/* finally */ auto __finally_23= das_finally([&](){
+		--__x_rename_at_21;
+	/* end finally */ });
+		++__x_rename_at_21;
+	};
+	DAS_ASSERT((__x_rename_at_21 == 1));
+}
+
+inline bool test_173a0e20e339136b ( Context * __context__ )
+{
+	int32_t __x_rename_at_30 = 1;
+	check_def_7f5bf5e37d16767c(__context__,__x_rename_at_30);
+	DAS_ASSERT((__x_rename_at_30 == 4));
+	TArray<int32_t> __a_rename_at_33; das_zero(__a_rename_at_33);
+	int32_t __len_rename_at_34 = ((int32_t)check_def_del_c91bc5da1e45cc36(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_33)));
+	DAS_ASSERT((__len_rename_at_34 == 10));
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_33)) == 0));
+	check_short_pipe_1493df9253024657(__context__);
+	return das_auto_cast<bool>::cast(true);
+}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd
+	aotLib[0x66e322246598e835] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TArray<int32_t> & (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd>>();
+	};
+	// _Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07
+	aotLib[0x44c6ff6768abbc55] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> &  ),&_Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07>>();
+	};
+	// _Funcbuiltin_0x60_push_d21751720b4df10e
+	aotLib[0x9fb5b63c22625999] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_d21751720b4df10e>>();
+	};
+	// _Funcbuiltin_0x60_finalize_c5f896860856389a
+	aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+	// check_def_7f5bf5e37d16767c
+	aotLib[0x41c3de8f067bab91] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t &  ),&check_def_7f5bf5e37d16767c>>();
+	};
+	// check_def_del_c91bc5da1e45cc36
+	aotLib[0x206905e9f15a1d3a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<int32_t> &  ),&check_def_del_c91bc5da1e45cc36>>();
+	};
+	// check_short_pipe_1493df9253024657
+	aotLib[0xbf0fa21a3953bf35] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&check_short_pipe_1493df9253024657>>();
+	};
+	// test_173a0e20e339136b
+	aotLib[0x445a0f3716aeebad] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_173a0e20e339136b>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,108 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_6541471161892961756 {
+
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__6878c3a3dc19cbcf;
+extern VarInfo __var_info__5f2d53f489936cc4;
+extern VarInfo __var_info__a1ada80378df1eda;
+extern FuncInfo __func_info__ff0bba53f0066857;
+
+VarInfo __func_info__ff0bba53f0066857_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 32, 0x5f2d53f489936cc4ul, "s", 0 };
+VarInfo __func_info__ff0bba53f0066857_field_1 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 32, 0xa1ada80378df1edaul, "s2", 0 };
+VarInfo * __func_info__ff0bba53f0066857_fields[2] =  { &__func_info__ff0bba53f0066857_field_0, &__func_info__ff0bba53f0066857_field_1 };
+FuncInfo __func_info__ff0bba53f0066857 = {"invoke block<(s:$::das_string -const;s2:$::das_string -const):void> const", "", __func_info__ff0bba53f0066857_fields, 2, 32, &__type_info__af63eb4c86020609, nullptr,0,0xff0bba53f0066857ul, 0x0 };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, 0xaf63eb4c86020609ul };
+TypeInfo __type_info__6878c3a3dc19cbcf = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 32, 0x6878c3a3dc19cbcful };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__6878c3a3dc19cbcf };
+TypeInfo * __tinfo_1[1] = { &__type_info__6878c3a3dc19cbcf };
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+
+inline bool test_de18fc0039c9bbdd ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool test_de18fc0039c9bbdd ( Context * __context__ ) { das_stack_prologue __prologue(__context__,160,"test " DAS_FILE_LINE);
+{
+	test_das_string(das_make_block<void,das::string &,das::string &>(__context__,80,0,&__func_info__ff0bba53f0066857,[&](das::string & __s_rename_at_7, das::string & __s2_rename_at_7)->void{
+		set_das_string(das_arg<das::string>::pass(__s2_rename_at_7),((char *) "test_das_string"));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<das::string &>::from(__s_rename_at_7)))),cast<char *>::from(((char *) "test_das_string")),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(((char *)(to_das_string(das_arg<das::string>::pass(__s_rename_at_7),__context__)))),cast<char *>::from(((char *) "test_das_string")),*__context__,nullptr)));
+		peek_das_string_T(das_arg<das::string>::pass(__s_rename_at_7),[&](char * const  __st_rename_at_11)->void{
+			DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__st_rename_at_11),cast<char *>::from(((char *) "test_das_string")),*__context__,nullptr)));
+		},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+		DAS_ASSERT((eq_dstr_str(das_arg<das::string>::pass(__s_rename_at_7),((char *) "test_das_string"))));
+		set_das_string(das_arg<das::string>::pass(__s_rename_at_7),((char *) "out_of_it"));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_1, cast<das::string &>::from(__s_rename_at_7)))),cast<char *>::from(((char *) "out_of_it")),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(((char *)(to_das_string(das_arg<das::string>::pass(__s_rename_at_7),__context__)))),cast<char *>::from(((char *) "out_of_it")),*__context__,nullptr)));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	return das_auto_cast<bool>::cast(true);
+}}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// test_de18fc0039c9bbdd
+	aotLib[0xbb8c4857a9e96405] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_de18fc0039c9bbdd>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
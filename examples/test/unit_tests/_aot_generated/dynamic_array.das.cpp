@@ -0,0 +1,239 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_10064627197182802091 {
+
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__64be5dc860f5ba81;
+extern TypeInfo __type_info__289c16574f003020;
+
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xaf63e44c8601fa24ul };
+TypeInfo __type_info__64be5dc860f5ba81 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, 0x64be5dc860f5ba81ul };
+TypeInfo __type_info__289c16574f003020 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, 0x289c16574f003020ul };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__64be5dc860f5ba81 };
+TypeInfo * __tinfo_1[1] = { &__type_info__289c16574f003020 };
+
+inline void _Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07 ( Context * __context__, TArray<int32_t> & __a_rename_at_31, TArray<int32_t> & __b_rename_at_31 );
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> & __Arr_rename_at_75, int32_t __value_rename_at_75 );
+inline void _Func_0x60_pass_array_4c2cad3b9d7d2d09 ( Context * __context__, TArray<int32_t> & __arr_rename_at_3 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60_reserve_a0d71b661f152abb ( Context * __context__, TArray<int32_t> & __Arr_rename_at_59, int32_t __newSize_rename_at_59 );
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_67, int32_t __value_rename_at_67, int32_t __at_rename_at_67 );
+inline void _Funcbuiltin_0x60_erase_a0d3d30dc9807389 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_159, int32_t __at_rename_at_159 );
+inline bool test_8a0203fcea31ce70 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07 ( Context * __context__, TArray<int32_t> &  __a_rename_at_31, TArray<int32_t> &  __b_rename_at_31 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<TArray<int32_t> &>::from(__a_rename_at_31)));
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_1,cast<TArray<int32_t> &>::from(__b_rename_at_31)));
+	das_move(__a_rename_at_31,__b_rename_at_31);
+}
+
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_75, int32_t __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_75),4,__context__),__context__),__value_rename_at_75);
+}
+
+inline void _Func_0x60_pass_array_4c2cad3b9d7d2d09 ( Context * __context__, TArray<int32_t> &  __arr_rename_at_3 )
+{
+	_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_3),4);
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_reserve_a0d71b661f152abb ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_59, int32_t __newSize_rename_at_59 )
+{
+	builtin_array_reserve(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_59),__newSize_rename_at_59,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_67, int32_t __value_rename_at_67, int32_t __at_rename_at_67 )
+{
+	das_copy(__Arr_rename_at_67(builtin_array_push(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_67),__at_rename_at_67,4,__context__),__context__),__value_rename_at_67);
+}
+
+inline void _Funcbuiltin_0x60_erase_a0d3d30dc9807389 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_159, int32_t __at_rename_at_159 )
+{
+	builtin_array_erase(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_159),__at_rename_at_159,4,__context__);
+}
+
+inline bool test_8a0203fcea31ce70 ( Context * __context__ )
+{
+	TArray<int32_t> __arr_rename_at_9; das_zero(__arr_rename_at_9); TArray<int32_t> __arr2_rename_at_9; das_zero(__arr2_rename_at_9);
+	DAS_ASSERTF((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_9)) == 0),(((char *) "array starts at 0 length")));
+	_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_9),1);
+	_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_9),2);
+	_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_9),3);
+	DAS_ASSERTF((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_9)) == 3),(((char *) "array length is 3")));
+	DAS_ASSERTF((builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__arr_rename_at_9)) == 16),(((char *) "its 2x, but no less than 16")));
+	_Func_0x60_pass_array_4c2cad3b9d7d2d09(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_9));
+	DAS_ASSERTF((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_9)) == 4),(((char *) "array length is 4")));
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_9),6);
+	DAS_ASSERTF((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_9)) == 6),(((char *) "array length is now 6")));
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_9),17);
+	DAS_ASSERTF((builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__arr_rename_at_9)) == 32),(((char *) "now bigger")));
+	_Funcbuiltin_0x60_reserve_a0d71b661f152abb(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_9),33);
+	DAS_ASSERTF((builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__arr_rename_at_9)) == 33),(((char *) "now even bigger")));
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_9),4);
+	DAS_ASSERTF((builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__arr_rename_at_9)) == 33),(((char *) "did not grow smaller")));
+	DAS_ASSERTF((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_9)) == 4),(((char *) "resized properly")));
+	_Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07(__context__,das_arg<TArray<int32_t>>::pass(__arr2_rename_at_9),das_arg<TArray<int32_t>>::pass(__arr_rename_at_9));
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_9)) == 0));
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr2_rename_at_9)) == 4));
+	int32_t __index_rename_at_31 = 0;
+	while ( __index_rename_at_31 < 4 )
+	{
+		++__arr2_rename_at_9(__index_rename_at_31++,__context__);
+	};
+	_Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_9),das_arg<TArray<int32_t>>::pass(__arr2_rename_at_9));
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr2_rename_at_9)) == 0));
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_9)) == 4));
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_9),3);
+	DAS_ASSERT((__arr_rename_at_9(2,__context__) == 4));
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_9),4);
+	DAS_ASSERTF((__arr_rename_at_9(3,__context__) == 0),(((char *) "new element after resize is 0")));
+	_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_9),1,0);
+	{
+		uint64_t __loop_count_42 = UINT64_MAX;
+		// t : int const
+		das_iterator<range> __t_iterator(range(1,5));
+		int32_t __t_rename_at_42;
+		__loop_count_42 = das_loop_count(__loop_count_42,__t_iterator.loop_begin(__context__,(__t_rename_at_42)));
+		for ( ; __loop_count_42 ; --__loop_count_42, ++__t_rename_at_42 )
+		{
+			DAS_ASSERT((__arr_rename_at_9((__t_rename_at_42 - 1),__context__) == __t_rename_at_42));
+		}
+		__t_iterator.loop_end(__context__,(__t_rename_at_42));
+	};
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_9),4);
+	_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_9),5,4);
+	_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_9),7,2);
+	_Funcbuiltin_0x60_erase_a0d3d30dc9807389(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_9),2);
+	{
+		uint64_t __loop_count_48 = UINT64_MAX;
+		// t : int const
+		das_iterator<range> __t_iterator(range(1,5));
+		int32_t __t_rename_at_48;
+		__loop_count_48 = das_loop_count(__loop_count_48,__t_iterator.loop_begin(__context__,(__t_rename_at_48)));
+		for ( ; __loop_count_48 ; --__loop_count_48, ++__t_rename_at_48 )
+		{
+			DAS_ASSERT((__arr_rename_at_9((__t_rename_at_48 - 1),__context__) == __t_rename_at_48));
+		}
+		__t_iterator.loop_end(__context__,(__t_rename_at_48));
+	};
+	_Funcbuiltin_0x60_erase_a0d3d30dc9807389(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_9),0);
+	_Funcbuiltin_0x60_erase_a0d3d30dc9807389(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_9),3);
+	{
+		uint64_t __loop_count_52 = UINT64_MAX;
+		// t : int const
+		das_iterator<range> __t_iterator(range(2,4));
+		int32_t __t_rename_at_52;
+		__loop_count_52 = das_loop_count(__loop_count_52,__t_iterator.loop_begin(__context__,(__t_rename_at_52)));
+		for ( ; __loop_count_52 ; --__loop_count_52, ++__t_rename_at_52 )
+		{
+			DAS_ASSERT((__arr_rename_at_9((__t_rename_at_52 - 2),__context__) == __t_rename_at_52));
+		}
+		__t_iterator.loop_end(__context__,(__t_rename_at_52));
+	};
+	TArray<int32_t> __a_rename_at_55; das_zero(__a_rename_at_55);
+	_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_55),1);
+	_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_55),2);
+	TArray<int32_t> __b_rename_at_58_ConstRef; das_zero(__b_rename_at_58_ConstRef); das_move(__b_rename_at_58_ConstRef, ((TArray<int32_t>)__a_rename_at_55));
+	TArray<int32_t> const  & __b_rename_at_58 = __b_rename_at_58_ConstRef; ;
+	DAS_ASSERT(((builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_55)) == 0) && (builtin_array_size(__b_rename_at_58) == 2)));
+	return das_auto_cast<bool>::cast(true);
+}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07
+	aotLib[0x44c6ff6768abbc55] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> &  ),&_Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07>>();
+	};
+	// _Funcbuiltin_0x60_push_d21751720b4df10e
+	aotLib[0x9fb5b63c22625999] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_d21751720b4df10e>>();
+	};
+	// _Func_0x60_pass_array_4c2cad3b9d7d2d09
+	aotLib[0xdac17fee2c330d78] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Func_0x60_pass_array_4c2cad3b9d7d2d09>>();
+	};
+	// _Funcbuiltin_0x60_resize_ce974596f011d69b
+	aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+	// _Funcbuiltin_0x60_reserve_a0d71b661f152abb
+	aotLib[0xe761f57d94ab3d39] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_reserve_a0d71b661f152abb>>();
+	};
+	// _Funcbuiltin_0x60_push_d7f619259dc926c6
+	aotLib[0x7c1d8142a521fc3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t , int32_t  ),&_Funcbuiltin_0x60_push_d7f619259dc926c6>>();
+	};
+	// _Funcbuiltin_0x60_erase_a0d3d30dc9807389
+	aotLib[0xc4522b3c0e92475] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_erase_a0d3d30dc9807389>>();
+	};
+	// test_8a0203fcea31ce70
+	aotLib[0x9bf3ce941c8321b2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_8a0203fcea31ce70>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,358 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_12768328343408914425 {
+
+extern TypeInfo __type_info__bb21a28e47c514da;
+extern TypeInfo __type_info__ef28d7fbc99ff900;
+extern TypeInfo __type_info__e1e65bebc2561eee;
+extern TypeInfo __type_info__753985814acee798;
+extern TypeInfo __type_info__1930cc5446b7cf48;
+extern TypeInfo __type_info__a804e42df96bbee4;
+extern EnumInfo __enum_info__b1ce1d7de5d66085;
+extern EnumInfo __enum_info__f7b45ded8b5a2054;
+extern EnumInfo __enum_info__7a3d3771defbc8df;
+
+EnumValueInfo __enum_info__b1ce1d7de5d66085_value_0 = { (char*)"boo", 1 };
+EnumValueInfo __enum_info__b1ce1d7de5d66085_value_1 = { (char*)"hoo", 2 };
+EnumValueInfo __enum_info__b1ce1d7de5d66085_value_2 = { (char*)"boo_hoo", 3 };
+EnumValueInfo * __enum_info__b1ce1d7de5d66085_values [] = { &__enum_info__b1ce1d7de5d66085_value_0, &__enum_info__b1ce1d7de5d66085_value_1, &__enum_info__b1ce1d7de5d66085_value_2 };
+EnumInfo __enum_info__b1ce1d7de5d66085 = { (char*)"BooHoo8", (char*)"", __enum_info__b1ce1d7de5d66085_values, 3, 0xb1ce1d7de5d66085ul };
+EnumValueInfo __enum_info__f7b45ded8b5a2054_value_0 = { (char*)"boo", 4 };
+EnumValueInfo __enum_info__f7b45ded8b5a2054_value_1 = { (char*)"hoo", 5 };
+EnumValueInfo __enum_info__f7b45ded8b5a2054_value_2 = { (char*)"boo_hoo", 6 };
+EnumValueInfo * __enum_info__f7b45ded8b5a2054_values [] = { &__enum_info__f7b45ded8b5a2054_value_0, &__enum_info__f7b45ded8b5a2054_value_1, &__enum_info__f7b45ded8b5a2054_value_2 };
+EnumInfo __enum_info__f7b45ded8b5a2054 = { (char*)"BooHoo16", (char*)"", __enum_info__f7b45ded8b5a2054_values, 3, 0xf7b45ded8b5a2054ul };
+EnumValueInfo __enum_info__7a3d3771defbc8df_value_0 = { (char*)"boo", 0 };
+EnumValueInfo __enum_info__7a3d3771defbc8df_value_1 = { (char*)"hoo", 1 };
+EnumValueInfo __enum_info__7a3d3771defbc8df_value_2 = { (char*)"boo_hoo", 5 };
+EnumValueInfo * __enum_info__7a3d3771defbc8df_values [] = { &__enum_info__7a3d3771defbc8df_value_0, &__enum_info__7a3d3771defbc8df_value_1, &__enum_info__7a3d3771defbc8df_value_2 };
+EnumInfo __enum_info__7a3d3771defbc8df = { (char*)"BooHoo", (char*)"", __enum_info__7a3d3771defbc8df_values, 3, 0x7a3d3771defbc8dful };
+TypeInfo __type_info__bb21a28e47c514da = { Type::tEnumeration16, nullptr, &__enum_info__f7b45ded8b5a2054, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 2, 0xbb21a28e47c514daul };
+TypeInfo __type_info__ef28d7fbc99ff900 = { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__a804e42df96bbee4, nullptr, nullptr, nullptr, 0, 0, nullptr, 24858, 8, 0xef28d7fbc99ff900ul };
+TypeInfo __type_info__e1e65bebc2561eee = { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__bb21a28e47c514da, nullptr, nullptr, nullptr, 0, 0, nullptr, 24858, 8, 0xe1e65bebc2561eeeul };
+TypeInfo __type_info__753985814acee798 = { Type::tEnumeration8, nullptr, &__enum_info__b1ce1d7de5d66085, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, 0x753985814acee798ul };
+TypeInfo __type_info__1930cc5446b7cf48 = { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__753985814acee798, nullptr, nullptr, nullptr, 0, 0, nullptr, 24858, 8, 0x1930cc5446b7cf48ul };
+TypeInfo __type_info__a804e42df96bbee4 = { Type::tEnumeration, nullptr, &__enum_info__7a3d3771defbc8df, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xa804e42df96bbee4ul };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__ef28d7fbc99ff900 };
+TypeInfo * __tinfo_1[1] = { &__type_info__1930cc5446b7cf48 };
+TypeInfo * __tinfo_2[1] = { &__type_info__e1e65bebc2561eee };
+namespace  { struct Foo; };
+#if 0 // external enum
+namespace UnitTest {
+
+enum class GooEnum : int32_t {
+	regular = int32_t(INT64_C(0)),
+	hazardous = int32_t(INT64_C(1)),
+};
+}
+#endif // external enum
+#if 0 // external enum
+namespace UnitTest {
+
+enum class SomeEnum : int32_t {
+	zero = int32_t(INT64_C(0)),
+	one = int32_t(INT64_C(1)),
+	two = int32_t(INT64_C(2)),
+};
+}
+#endif // external enum
+#if 0 // external enum
+namespace UnitTest {
+
+enum class SomeEnum98 : uint32_t {
+	SomeEnum98_zero = uint32_t(INT64_C(0)),
+	SomeEnum98_one = uint32_t(INT64_C(1)),
+	SomeEnum98_two = uint32_t(INT64_C(2)),
+};
+}
+#endif // external enum
+// unused enumeration SomeEnum_16
+namespace  {
+
+enum class Numbers : int16_t {
+	zero = int16_t(0),
+	one = int16_t(1),
+	two = int16_t(2),
+	ten = int16_t(10),
+	sixteen = int16_t(16),
+	neg_ten = int16_t(-10),
+	neg_one = int16_t(-1),
+	neg_one_i = int16_t(-1),
+};
+}
+}
+template <> struct cast< das::_anon_12768328343408914425::Numbers > : cast_enum < das::_anon_12768328343408914425::Numbers > {};
+namespace _anon_12768328343408914425 {
+namespace  {
+
+enum class Zen : int32_t {
+	zero = int32_t(0),
+	not_zero = int32_t(1),
+};
+}
+}
+template <> struct cast< das::_anon_12768328343408914425::Zen > : cast_enum < das::_anon_12768328343408914425::Zen > {};
+namespace _anon_12768328343408914425 {
+namespace  {
+
+enum class QQ : int32_t {
+	size_of_Foo_Padded = int32_t(16),
+};
+}
+}
+template <> struct cast< das::_anon_12768328343408914425::QQ > : cast_enum < das::_anon_12768328343408914425::QQ > {};
+namespace _anon_12768328343408914425 {
+namespace  {
+
+enum class BooHoo : int32_t {
+	boo = int32_t(0),
+	hoo = int32_t(1),
+	boo_hoo = int32_t(5),
+};
+}
+}
+template <> struct cast< das::_anon_12768328343408914425::BooHoo > : cast_enum < das::_anon_12768328343408914425::BooHoo > {};
+namespace _anon_12768328343408914425 {
+namespace  {
+
+enum class BooHoo8 : int8_t {
+	boo = int8_t(1),
+	hoo = int8_t(2),
+	boo_hoo = int8_t(3),
+};
+}
+}
+template <> struct cast< das::_anon_12768328343408914425::BooHoo8 > : cast_enum < das::_anon_12768328343408914425::BooHoo8 > {};
+namespace _anon_12768328343408914425 {
+namespace  {
+
+enum class BooHoo16 : int16_t {
+	boo = int16_t(4),
+	hoo = int16_t(5),
+	boo_hoo = int16_t(6),
+};
+}
+}
+template <> struct cast< das::_anon_12768328343408914425::BooHoo16 > : cast_enum < das::_anon_12768328343408914425::BooHoo16 > {};
+namespace _anon_12768328343408914425 {
+namespace  {
+
+struct Foo {
+	int32_t a;
+	float b;
+};
+static_assert(sizeof(Foo)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,b)==4,"structure field offset mismatch with DAS");
+}
+
+inline Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo)) _Funcbuiltin_0x60_each_enum_26b456f729975348 ( Context * __context__, DAS_COMMENT(enum) BooHoo __tt_rename_at_388 );
+inline Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo8)) _Funcbuiltin_0x60_each_enum_907ffd06394b7bc8 ( Context * __context__, DAS_COMMENT(enum) BooHoo8 __tt_rename_at_388 );
+inline Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo16)) _Funcbuiltin_0x60_each_enum_2eeabea19a13b81e ( Context * __context__, DAS_COMMENT(enum) BooHoo16 __tt_rename_at_388 );
+inline DAS_COMMENT(enum) Zen getZenOne_45270433218591fd ( Context * __context__ );
+inline bool test_43d2ad4b64ea1d18 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo)) _Funcbuiltin_0x60_each_enum_26b456f729975348 ( Context * __context__, DAS_COMMENT(enum) BooHoo __tt_rename_at_388 )
+{
+	Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo)) __iter_rename_at_390; das_zero(__iter_rename_at_390);
+	das_call_interop<void>::call(&builtin_make_enum_iterator,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo)) &>::from(__iter_rename_at_390)));
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo))>::cast(__iter_rename_at_390);
+}
+
+inline Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo8)) _Funcbuiltin_0x60_each_enum_907ffd06394b7bc8 ( Context * __context__, DAS_COMMENT(enum) BooHoo8 __tt_rename_at_388 )
+{
+	Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo8)) __iter_rename_at_390; das_zero(__iter_rename_at_390);
+	das_call_interop<void>::call(&builtin_make_enum_iterator,__context__,SimNode_AotInterop<1>(__tinfo_1,cast<Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo8)) &>::from(__iter_rename_at_390)));
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo8))>::cast(__iter_rename_at_390);
+}
+
+inline Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo16)) _Funcbuiltin_0x60_each_enum_2eeabea19a13b81e ( Context * __context__, DAS_COMMENT(enum) BooHoo16 __tt_rename_at_388 )
+{
+	Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo16)) __iter_rename_at_390; das_zero(__iter_rename_at_390);
+	das_call_interop<void>::call(&builtin_make_enum_iterator,__context__,SimNode_AotInterop<1>(__tinfo_2,cast<Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo16)) &>::from(__iter_rename_at_390)));
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo16))>::cast(__iter_rename_at_390);
+}
+
+inline DAS_COMMENT(enum) Zen getZenOne_45270433218591fd ( Context * __context__ )
+{
+	return das_auto_cast<DAS_COMMENT(enum) Zen>::cast(DAS_COMMENT(enum) Zen::not_zero);
+}
+
+inline bool test_43d2ad4b64ea1d18 ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo)) _temp_make_local_84_144;
+	TDim<int32_t,3> _temp_make_local_84_160;
+	Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo8)) _temp_make_local_86_208;
+	TDim<int32_t,3> _temp_make_local_86_224;
+	Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo16)) _temp_make_local_88_272;
+	TDim<int32_t,3> _temp_make_local_88_288;
+	DAS_COMMENT(enum) Numbers __q_rename_at_55 = DAS_COMMENT(enum) Numbers::one;
+	DAS_ASSERT((int32_t(__q_rename_at_55) == 1));
+	DAS_ASSERT((__q_rename_at_55 == DAS_COMMENT(enum) Numbers::one));
+	DAS_ASSERT((DAS_COMMENT(enum) Numbers::zero != __q_rename_at_55));
+	das_copy(__q_rename_at_55,DAS_COMMENT(enum) Numbers::zero);
+	DAS_ASSERT((DAS_COMMENT(enum) Numbers::zero == __q_rename_at_55));
+	DAS_VERIFY((getZenOne_45270433218591fd(__context__) == DAS_COMMENT(enum) Zen::not_zero));
+	DAS_VERIFY((efn_takeOne_giveTwo(DAS_COMMENT(bound_enum) SomeEnum::one) == DAS_COMMENT(bound_enum) SomeEnum::two));
+	DAS_VERIFY((efn_takeOne_giveTwo_98(DAS_COMMENT(bound_enum) SomeEnum98::SomeEnum98_one) == DAS_COMMENT(bound_enum) SomeEnum98::SomeEnum98_two));
+	DAS_COMMENT(bound_enum) SomeEnum __result_efn_rename_at_72 = efn_takeOne_giveTwo(DAS_COMMENT(bound_enum) SomeEnum::one);
+	DAS_ASSERT((__result_efn_rename_at_72 == DAS_COMMENT(bound_enum) SomeEnum::two));
+	DAS_COMMENT(bound_enum) Goo::GooEnum __goo_rename_at_75; das_zero(__goo_rename_at_75);
+	das_copy(__goo_rename_at_75,DAS_COMMENT(bound_enum) Goo::GooEnum::regular);
+	DAS_VERIFY((efn_flip(__goo_rename_at_75) == DAS_COMMENT(bound_enum) Goo::GooEnum::hazardous));
+	TestObjectFoo __foo16_rename_at_78; das_zero(__foo16_rename_at_78);
+	DAS_ASSERT((__foo16_rename_at_78.e16 /*e16*/ == DAS_COMMENT(bound_enum) SomeEnum_16::SomeEnum_16_zero));
+	das_copy(__foo16_rename_at_78.e16 /*e16*/,DAS_COMMENT(bound_enum) SomeEnum_16::SomeEnum_16_one);
+	DAS_ASSERT((__foo16_rename_at_78.e16 /*e16*/ == DAS_COMMENT(bound_enum) SomeEnum_16::SomeEnum_16_one));
+	DAS_ASSERT((int32_t(__foo16_rename_at_78.e16 /*e16*/) == 1));
+	{
+		bool __need_loop_84 = true;
+		// e : BooHoo
+		das_iterator<Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo))> __e_iterator((_temp_make_local_84_144 = (_Funcbuiltin_0x60_each_enum_26b456f729975348(__context__,DAS_COMMENT(enum) BooHoo::boo))));
+		DAS_COMMENT(enum) BooHoo __e_rename_at_84;
+		__need_loop_84 = __e_iterator.first(__context__,(__e_rename_at_84)) && __need_loop_84;
+		// tt : int&
+		das_iterator<TDim<int32_t,3>> __tt_iterator((([&]() -> TDim<int32_t,3>& {
+			_temp_make_local_84_160(0,__context__) = 0;
+			_temp_make_local_84_160(1,__context__) = 1;
+			_temp_make_local_84_160(2,__context__) = 5;
+			return _temp_make_local_84_160;
+		})()));
+		int32_t * __tt_rename_at_84;
+		__need_loop_84 = __tt_iterator.first(__context__,(__tt_rename_at_84)) && __need_loop_84;
+		for ( ; __need_loop_84 ; __need_loop_84 = __e_iterator.next(__context__,(__e_rename_at_84)) && __tt_iterator.next(__context__,(__tt_rename_at_84)) )
+		{
+			DAS_ASSERT((int32_t(__e_rename_at_84) == (*__tt_rename_at_84)));
+		}
+		__e_iterator.close(__context__,(__e_rename_at_84));
+		__tt_iterator.close(__context__,(__tt_rename_at_84));
+	};
+	{
+		bool __need_loop_86 = true;
+		// e : BooHoo8
+		das_iterator<Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo8))> __e_iterator((_temp_make_local_86_208 = (_Funcbuiltin_0x60_each_enum_907ffd06394b7bc8(__context__,DAS_COMMENT(enum) BooHoo8::boo))));
+		DAS_COMMENT(enum) BooHoo8 __e_rename_at_86;
+		__need_loop_86 = __e_iterator.first(__context__,(__e_rename_at_86)) && __need_loop_86;
+		// tt : int&
+		das_iterator<TDim<int32_t,3>> __tt_iterator((([&]() -> TDim<int32_t,3>& {
+			_temp_make_local_86_224(0,__context__) = 1;
+			_temp_make_local_86_224(1,__context__) = 2;
+			_temp_make_local_86_224(2,__context__) = 3;
+			return _temp_make_local_86_224;
+		})()));
+		int32_t * __tt_rename_at_86;
+		__need_loop_86 = __tt_iterator.first(__context__,(__tt_rename_at_86)) && __need_loop_86;
+		for ( ; __need_loop_86 ; __need_loop_86 = __e_iterator.next(__context__,(__e_rename_at_86)) && __tt_iterator.next(__context__,(__tt_rename_at_86)) )
+		{
+			DAS_ASSERT((int32_t(__e_rename_at_86) == (*__tt_rename_at_86)));
+		}
+		__e_iterator.close(__context__,(__e_rename_at_86));
+		__tt_iterator.close(__context__,(__tt_rename_at_86));
+	};
+	{
+		bool __need_loop_88 = true;
+		// e : BooHoo16
+		das_iterator<Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo16))> __e_iterator((_temp_make_local_88_272 = (_Funcbuiltin_0x60_each_enum_2eeabea19a13b81e(__context__,DAS_COMMENT(enum) BooHoo16::boo))));
+		DAS_COMMENT(enum) BooHoo16 __e_rename_at_88;
+		__need_loop_88 = __e_iterator.first(__context__,(__e_rename_at_88)) && __need_loop_88;
+		// tt : int&
+		das_iterator<TDim<int32_t,3>> __tt_iterator((([&]() -> TDim<int32_t,3>& {
+			_temp_make_local_88_288(0,__context__) = 4;
+			_temp_make_local_88_288(1,__context__) = 5;
+			_temp_make_local_88_288(2,__context__) = 6;
+			return _temp_make_local_88_288;
+		})()));
+		int32_t * __tt_rename_at_88;
+		__need_loop_88 = __tt_iterator.first(__context__,(__tt_rename_at_88)) && __need_loop_88;
+		for ( ; __need_loop_88 ; __need_loop_88 = __e_iterator.next(__context__,(__e_rename_at_88)) && __tt_iterator.next(__context__,(__tt_rename_at_88)) )
+		{
+			DAS_ASSERT((int32_t(__e_rename_at_88) == (*__tt_rename_at_88)));
+		}
+		__e_iterator.close(__context__,(__e_rename_at_88));
+		__tt_iterator.close(__context__,(__tt_rename_at_88));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_each_enum_26b456f729975348
+	aotLib[0x195ebb2c1077a7f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo)) (*) ( Context * __context__, DAS_COMMENT(enum) BooHoo  ),&_Funcbuiltin_0x60_each_enum_26b456f729975348>>();
+	};
+	// _Funcbuiltin_0x60_each_enum_907ffd06394b7bc8
+	aotLib[0xc7b5b83106fb0241] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo8)) (*) ( Context * __context__, DAS_COMMENT(enum) BooHoo8  ),&_Funcbuiltin_0x60_each_enum_907ffd06394b7bc8>>();
+	};
+	// _Funcbuiltin_0x60_each_enum_2eeabea19a13b81e
+	aotLib[0x7f31ccd828545bd5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo16)) (*) ( Context * __context__, DAS_COMMENT(enum) BooHoo16  ),&_Funcbuiltin_0x60_each_enum_2eeabea19a13b81e>>();
+	};
+	// getZenOne_45270433218591fd
+	aotLib[0x461b29b0b76bb15] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<DAS_COMMENT(enum) Zen (*) ( Context * __context__ ),&getZenOne_45270433218591fd>>();
+	};
+	// test_43d2ad4b64ea1d18
+	aotLib[0xbd14e4626ccf91c7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_43d2ad4b64ea1d18>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
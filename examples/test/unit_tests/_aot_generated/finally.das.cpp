@@ -0,0 +1,245 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_6160512410725476827 {
+
+
+
+
+inline bool test_if_finally_d4b78d7b3f94e186 ( Context * __context__ );
+inline bool test_for_finally_c13835f3b2fb872a ( Context * __context__ );
+inline int32_t one_34fb548c7cf34477 ( Context * __context__ );
+inline bool test_while_finally_a66539126d130b0b ( Context * __context__ );
+inline int32_t func_finally_fd8d4bcec0111e96 ( Context * __context__ );
+inline void test_func_finally_f32ef6a0fbae59b9 ( Context * __context__ );
+inline void test_block_finally_11edaa7222b189be ( Context * __context__ );
+inline bool test_4c13d1046b5a30ef ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int32_t,0x90cfa65eb9b6172c>(__context__) = 1;/*ONE*/
+	das_global<int32_t,0xcabfca06cc3d13d0>(__context__) = 0;/*glob*/
+	das_global<int32_t,0x13f5a66e3bb98748>(__context__) = 0;/*glob_count*/
+}
+
+inline bool test_if_finally_d4b78d7b3f94e186 ( Context * __context__ )
+{
+	TDim<int32_t,10> __t_rename_at_5; das_zero(__t_rename_at_5);
+	int32_t __count_rename_at_6 = 0;
+	{
+		uint64_t __loop_count_7 = UINT64_MAX;
+		// x : int const
+		das_iterator<range> __x_iterator(range(0,10));
+		int32_t __x_rename_at_7;
+		__loop_count_7 = das_loop_count(__loop_count_7,__x_iterator.loop_begin(__context__,(__x_rename_at_7)));
+		for ( ; __loop_count_7 ; --__loop_count_7, ++__x_rename_at_7 )
+		{
+			das_copy(__t_rename_at_5(__x_rename_at_7,__context__),__x_rename_at_7 + 1);
+			if ( __x_rename_at_7 == 5 )
+			{
+			/* finally */ auto __finally_10= das_finally([&](){
+				das_copy(__t_rename_at_5(9,__context__),13);
+				__count_rename_at_6++;
+			/* end finally */ });
+				break;
+			};
+		}
+		__x_iterator.loop_end(__context__,(__x_rename_at_7));
+	};
+	DAS_ASSERT(((__count_rename_at_6 == 1) && (__t_rename_at_5(9,__context__) == 13)));
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline bool test_for_finally_c13835f3b2fb872a ( Context * __context__ )
+{
+	int32_t __uno_rename_at_22; memset(&__uno_rename_at_22,0,sizeof(__uno_rename_at_22));
+	TDim<int32_t,10> __t_rename_at_19; das_zero(__t_rename_at_19);
+	int32_t __count_rename_at_20 = 0;
+	{
+		uint64_t __loop_count_21 = UINT64_MAX;
+		// x : int const
+		das_iterator<range> __x_iterator(range(0,10));
+		int32_t __x_rename_at_21;
+		__loop_count_21 = das_loop_count(__loop_count_21,__x_iterator.loop_begin(__context__,(__x_rename_at_21)));
+	/* finally */ auto __finally_22= das_finally([&](){
+		das_copy(__t_rename_at_19(9,__context__),13);
+		(__count_rename_at_20 += __uno_rename_at_22);
+	/* end finally */ });
+		for ( ; __loop_count_21 ; --__loop_count_21, ++__x_rename_at_21 )
+		{
+			__uno_rename_at_22 = ((int32_t)one_34fb548c7cf34477(__context__));
+			das_copy(__t_rename_at_19(__x_rename_at_21,__context__),__x_rename_at_21 + __uno_rename_at_22);
+			if ( __x_rename_at_21 == 5 )
+			{
+				break;
+			};
+		}
+		__x_iterator.loop_end(__context__,(__x_rename_at_21));
+	};
+	DAS_ASSERT(((__count_rename_at_20 == 1) && (__t_rename_at_19(9,__context__) == 13)));
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline int32_t one_34fb548c7cf34477 ( Context * __context__ )
+{
+	das_copy(das_global<int32_t,0x90cfa65eb9b6172c>(__context__) /*ONE*/,1);
+	DAS_ASSERT((das_global<int32_t,0x90cfa65eb9b6172c>(__context__) /*ONE*/ == 1));
+	return das_auto_cast<int32_t>::cast(das_global<int32_t,0x90cfa65eb9b6172c>(__context__) /*ONE*/);
+}
+
+inline bool test_while_finally_a66539126d130b0b ( Context * __context__ )
+{
+	int32_t __uno_rename_at_47; memset(&__uno_rename_at_47,0,sizeof(__uno_rename_at_47));
+	TDim<int32_t,10> __t_rename_at_43; das_zero(__t_rename_at_43);
+	int32_t __count_rename_at_44 = 0;
+	int32_t __x_rename_at_45 = 0;
+	{
+	/* finally */ auto __finally_47= das_finally([&](){
+		das_copy(__t_rename_at_43(9,__context__),(__uno_rename_at_47 + 12));
+		__count_rename_at_44++;
+	/* end finally */ });
+		while ( __x_rename_at_45 != 10 )
+		{
+			__uno_rename_at_47 = ((int32_t)one_34fb548c7cf34477(__context__));
+			das_copy(__t_rename_at_43(__x_rename_at_45,__context__),__x_rename_at_45 + __uno_rename_at_47);
+			if ( __x_rename_at_45 == 5 )
+			{
+				break;
+			} else {
+				++__x_rename_at_45;
+			};
+		}
+	};
+	DAS_ASSERT(((__count_rename_at_44 == 1) && (__t_rename_at_43(9,__context__) == 13)));
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline int32_t func_finally_fd8d4bcec0111e96 ( Context * __context__ )
+{
+/* finally */ auto __finally_63= das_finally([&](){
+	das_copy(das_global<int32_t,0xcabfca06cc3d13d0>(__context__) /*glob*/,13);
+	das_global<int32_t,0x13f5a66e3bb98748>(__context__) /*glob_count*/++;
+/* end finally */ });
+	return das_auto_cast<int32_t>::cast(12);
+}
+
+inline void test_func_finally_f32ef6a0fbae59b9 ( Context * __context__ )
+{
+	das_copy(das_global<int32_t,0xcabfca06cc3d13d0>(__context__) /*glob*/,0);
+	das_copy(das_global<int32_t,0x13f5a66e3bb98748>(__context__) /*glob_count*/,0);
+	int32_t __t_rename_at_71 = ((int32_t)func_finally_fd8d4bcec0111e96(__context__));
+	DAS_ASSERT((((__t_rename_at_71 == 12) && (das_global<int32_t,0xcabfca06cc3d13d0>(__context__) /*glob*/ == 13)) && (das_global<int32_t,0x13f5a66e3bb98748>(__context__) /*glob_count*/ == 1)));
+}
+
+inline void test_block_finally_11edaa7222b189be ( Context * __context__ )
+{
+	int32_t __t_rename_at_76 = 0;
+	das_invoke<void>::invoke(__context__,nullptr,[&]()->void{
+	/* finally */ auto __finally_77= das_finally([&](){
+		das_copy(__t_rename_at_76,2);
+	/* end finally */ });
+		das_copy(__t_rename_at_76,1);
+	});
+	DAS_ASSERT((__t_rename_at_76 == 2));
+}
+
+inline bool test_4c13d1046b5a30ef ( Context * __context__ )
+{
+	test_block_finally_11edaa7222b189be(__context__);
+	test_for_finally_c13835f3b2fb872a(__context__);
+	test_if_finally_d4b78d7b3f94e186(__context__);
+	test_while_finally_a66539126d130b0b(__context__);
+	test_func_finally_f32ef6a0fbae59b9(__context__);
+	return das_auto_cast<bool>::cast(true);
+}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// test_if_finally_d4b78d7b3f94e186
+	aotLib[0x412737b67b0d1349] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_if_finally_d4b78d7b3f94e186>>();
+	};
+	// test_for_finally_c13835f3b2fb872a
+	aotLib[0x39c6494c3edc625a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_for_finally_c13835f3b2fb872a>>();
+	};
+	// one_34fb548c7cf34477
+	aotLib[0x2fa984a7355960d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__ ),&one_34fb548c7cf34477>>();
+	};
+	// test_while_finally_a66539126d130b0b
+	aotLib[0x3ed56bdb4c207586] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_while_finally_a66539126d130b0b>>();
+	};
+	// func_finally_fd8d4bcec0111e96
+	aotLib[0xed6c3ce9a0817a45] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__ ),&func_finally_fd8d4bcec0111e96>>();
+	};
+	// test_func_finally_f32ef6a0fbae59b9
+	aotLib[0x78e412bcb646b759] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_func_finally_f32ef6a0fbae59b9>>();
+	};
+	// test_block_finally_11edaa7222b189be
+	aotLib[0x4db2fc199737f7fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_block_finally_11edaa7222b189be>>();
+	};
+	// test_4c13d1046b5a30ef
+	aotLib[0xba11740ea413f2f8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_4c13d1046b5a30ef>>();
+	};
+	// [[ init script ]]
+	aotLib[0x9a615b5a9ba389df] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
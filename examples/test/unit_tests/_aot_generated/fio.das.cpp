@@ -0,0 +1,289 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require fio
+#include "daScript/misc/performance_time.h"
+#include "daScript/misc/async_file_io.h"
+#include "daScript/simulate/aot_builtin_fio.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_4551036706288460030 {
+
+extern StructInfo __struct_info__f35ff723fded4627;
+extern StructInfo __struct_info__744034d235be9ced;
+extern TypeInfo __type_info__27ac16b8889ae752;
+extern TypeInfo __type_info__54205c109064aabf;
+extern TypeInfo __type_info__dfd82b908f3b1490;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__fd978c5c1218516b;
+extern TypeInfo __type_info__8a677f2ab3b012d0;
+extern TypeInfo __type_info__8c48207b56753d8;
+extern TypeInfo __type_info__ce34cf44aed6443;
+extern TypeInfo __type_info__4812a076be41e1a6;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__a0ce90235c80549f;
+extern TypeInfo __type_info__90f5707b5a6f641;
+extern TypeInfo __type_info__bc36319aa7b1067;
+extern TypeInfo __type_info__6975b78eb076b06c;
+extern VarInfo __var_info__a08aad2745ae5bc5;
+extern VarInfo __var_info__8bf04e77b9de08ad;
+extern VarInfo __var_info__e18af8f9bba47d4a;
+extern VarInfo __var_info__a08aaa2745ae56ac;
+extern VarInfo __var_info__7fa35db5918423ce;
+extern VarInfo __var_info__8a594fc4a742d2cf;
+extern FuncInfo __func_info__d3b307c446b1e15e;
+extern FuncInfo __func_info__97e90aed55b2517d;
+
+VarInfo __struct_info__f35ff723fded4627_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xa08aaa2745ae56acul, "a", 0 };
+VarInfo __struct_info__f35ff723fded4627_field_1 =  { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xa08aad2745ae5bc5ul, "b", 4 };
+VarInfo * __struct_info__f35ff723fded4627_fields[2] =  { &__struct_info__f35ff723fded4627_field_0, &__struct_info__f35ff723fded4627_field_1 };
+StructInfo __struct_info__f35ff723fded4627 = {(char*)"Foo", (char*)"", 0, __struct_info__f35ff723fded4627_fields, 2, 8, 0xf2bb95199c92e1d7ul, nullptr, 0xf35ff723fded4627ul };
+VarInfo __struct_info__744034d235be9ced_field_0 =  { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0x7fa35db5918423ceul, "magic", 0 };
+VarInfo __struct_info__744034d235be9ced_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xe18af8f9bba47d4aul, "size", 4 };
+VarInfo * __struct_info__744034d235be9ced_fields[2] =  { &__struct_info__744034d235be9ced_field_0, &__struct_info__744034d235be9ced_field_1 };
+StructInfo __struct_info__744034d235be9ced = {(char*)"df_header", (char*)"fio", 0, __struct_info__744034d235be9ced_fields, 2, 8, 0x0ul, nullptr, 0x744034d235be9cedul };
+VarInfo __func_info__d3b307c446b1e15e_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__8c48207b56753d8, nullptr, nullptr, nullptr, 0, 0, nullptr, 40994, 24, 0x8bf04e77b9de08adul, "data", 0 };
+VarInfo * __func_info__d3b307c446b1e15e_fields[1] =  { &__func_info__d3b307c446b1e15e_field_0 };
+FuncInfo __func_info__d3b307c446b1e15e = {"invoke block<(data:array<uint8> const):void> const", "", __func_info__d3b307c446b1e15e_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,0xd3b307c446b1e15eul, 0x0 };
+VarInfo __func_info__97e90aed55b2517d_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8a677f2ab3b012d0, nullptr, nullptr, nullptr, 0, 0, nullptr, 8236, 8, 0x8a594fc4a742d2cful, "f", 0 };
+VarInfo * __func_info__97e90aed55b2517d_fields[1] =  { &__func_info__97e90aed55b2517d_field_0 };
+FuncInfo __func_info__97e90aed55b2517d = {"invoke block<(f:fio::FILE const? const):void> const", "", __func_info__97e90aed55b2517d_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,0x97e90aed55b2517dul, 0x0 };
+TypeInfo __type_info__27ac16b8889ae752 = { Type::tStructure, &__struct_info__744034d235be9ced, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 286, 8, 0x27ac16b8889ae752ul };
+TypeInfo __type_info__54205c109064aabf = { Type::tStructure, &__struct_info__744034d235be9ced, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 318, 8, 0x54205c109064aabful };
+TypeInfo __type_info__dfd82b908f3b1490 = { Type::tStructure, &__struct_info__f35ff723fded4627, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 8, 0xdfd82b908f3b1490ul };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xaf63e44c8601fa24ul };
+TypeInfo * __type_info__fd978c5c1218516b_arg_types[1] = { &__type_info__a0ce90235c80549f };
+TypeInfo __type_info__fd978c5c1218516b = { Type::tBlock, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__fd978c5c1218516b_arg_types, nullptr, 1, 0, nullptr, 34, 40, 0xfd978c5c1218516bul };
+TypeInfo __type_info__8a677f2ab3b012d0 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~fio::FILE"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 46, 216, 0x8a677f2ab3b012d0ul };
+TypeInfo __type_info__8c48207b56753d8 = { Type::tUInt8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, 0x8c48207b56753d8ul };
+TypeInfo __type_info__ce34cf44aed6443 = { Type::tStructure, &__struct_info__f35ff723fded4627, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 62, 8, 0xce34cf44aed6443ul };
+TypeInfo __type_info__4812a076be41e1a6 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__bc36319aa7b1067, nullptr, nullptr, nullptr, 0, 0, nullptr, 8236, 8, 0x4812a076be41e1a6ul };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, 0xaf63eb4c86020609ul };
+TypeInfo __type_info__a0ce90235c80549f = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__8c48207b56753d8, nullptr, nullptr, nullptr, 0, 0, nullptr, 40994, 24, 0xa0ce90235c80549ful };
+TypeInfo __type_info__90f5707b5a6f641 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, 0x90f5707b5a6f641ul };
+TypeInfo __type_info__bc36319aa7b1067 = { Type::tUInt8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 1, 0xbc36319aa7b1067ul };
+TypeInfo __type_info__6975b78eb076b06c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8a677f2ab3b012d0, nullptr, nullptr, nullptr, 0, 0, nullptr, 8236, 8, 0x6975b78eb076b06cul };
+
+TypeInfo * __tinfo_0[2] = { &__type_info__ce34cf44aed6443, &__type_info__fd978c5c1218516b };
+TypeInfo * __tinfo_1[2] = { &__type_info__dfd82b908f3b1490, &__type_info__a0ce90235c80549f };
+TypeInfo * __tinfo_2[3] = { &__type_info__6975b78eb076b06c, &__type_info__54205c109064aabf, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_3[3] = { &__type_info__6975b78eb076b06c, &__type_info__4812a076be41e1a6, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_4[3] = { &__type_info__6975b78eb076b06c, &__type_info__27ac16b8889ae752, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_5[3] = { &__type_info__6975b78eb076b06c, &__type_info__af63e44c8601fa24, &__type_info__fd978c5c1218516b };
+namespace  { struct Foo; };
+namespace fio { struct df_header; };
+namespace fio {
+
+struct df_header {
+	uint32_t magic;
+	int32_t size;
+};
+static_assert(sizeof(df_header)==8,"structure size mismatch with DAS");
+static_assert(offsetof(df_header,magic)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(df_header,size)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Foo {
+	int32_t a;
+	float b;
+};
+static_assert(sizeof(Foo)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,b)==4,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_binary_save_df945637b1078ab2 ( Context * __context__, Foo const  & __obj_rename_at_228, Block DAS_COMMENT((void,TArray<uint8_t> const )) const  & __subexpr_rename_at_228 );
+inline void _Funcbuiltin_0x60_binary_load_43040880b26c4465 ( Context * __context__, Foo & __obj_rename_at_232, TArray<uint8_t> const  & __data_rename_at_232 );
+inline int32_t _Funcfio_0x60_fsave_1cf1b87a33c6fc5a ( Context * __context__, FILE const  * const  __f_rename_at_93, Foo const  & __buf_rename_at_93 );
+inline bool _Funcfio_0x60_fload_bc188924ab79366c ( Context * __context__, FILE const  * const  __f_rename_at_79, Foo & __buf_rename_at_79 );
+inline void _Funcfio_0x60_fopen_4e6143847f364a84 ( Context * __context__, char * const  __name_rename_at_11, char * const  __mode_rename_at_11, Block DAS_COMMENT((void,FILE const  * const )) const  & __blk_rename_at_11 );
+inline bool test_df6d9ba202eb6eba ( Context * __context__ );
+inline Foo Foo_2cda648a5bf7d61 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_binary_save_df945637b1078ab2 ( Context * __context__, Foo const  &  __obj_rename_at_228, Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &  __subexpr_rename_at_228 )
+{
+	das_call_interop<void>::call(&_builtin_binary_save,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<Foo const  &>::from(__obj_rename_at_228),cast<Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &>::from(__subexpr_rename_at_228)));
+}
+
+inline void _Funcbuiltin_0x60_binary_load_43040880b26c4465 ( Context * __context__, Foo &  __obj_rename_at_232, TArray<uint8_t> const  &  __data_rename_at_232 )
+{
+	das_call_interop<void>::call(&_builtin_binary_load,__context__,SimNode_AotInterop<2>(__tinfo_1,cast<Foo &>::from(__obj_rename_at_232),cast<TArray<uint8_t> const  &>::from(__data_rename_at_232)));
+}
+
+inline int32_t _Funcfio_0x60_fsave_1cf1b87a33c6fc5a ( Context * __context__, FILE const  * const  __f_rename_at_93, Foo const  &  __buf_rename_at_93 ) { das_stack_prologue __prologue(__context__,160,"fio`fsave " DAS_FILE_LINE);
+{
+	int32_t __r1_rename_at_94 = 0; int32_t __r2_rename_at_94 = 0;
+	_Funcbuiltin_0x60_binary_save_df945637b1078ab2(__context__,__buf_rename_at_93,das_make_block<void,TArray<uint8_t> const  &>(__context__,112,0,&__func_info__d3b307c446b1e15e,[&](TArray<uint8_t> const  & __data_rename_at_95)->void{
+		int32_t __len_rename_at_96 = ((int32_t)builtin_array_size(__data_rename_at_95));
+		fio::df_header __dfh_rename_at_97_ConstRef = ((fio::df_header)(([&]() -> fio::df_header {
+			fio::df_header __mks_97;
+			das_copy((__mks_97.magic),(0x12345678u));
+			das_copy((__mks_97.size),(__len_rename_at_96));
+			return __mks_97;
+		})()));
+	fio::df_header const  & __dfh_rename_at_97 = __dfh_rename_at_97_ConstRef; ;
+		das_copy(__r1_rename_at_94,das_call_interop<int32_t>::call(&builtin_write,__context__,SimNode_AotInterop<3>(__tinfo_2,cast<FILE const  * const >::from(__f_rename_at_93),cast<fio::df_header const  &>::from(__dfh_rename_at_97),cast<int32_t>::from(8))));
+		das_copy(__r2_rename_at_94,das_call_interop<int32_t>::call(&builtin_write,__context__,SimNode_AotInterop<3>(__tinfo_3,cast<FILE const  * const >::from(__f_rename_at_93),cast<uint8_t const  * const >::from(das_ref(__context__,__data_rename_at_95(0,__context__))),cast<int32_t>::from(__len_rename_at_96))));
+	}));
+	return das_auto_cast<int32_t>::cast((__r1_rename_at_94 < 0) ? das_auto_cast<int32_t>::cast(__r1_rename_at_94) : das_auto_cast<int32_t>::cast(((__r2_rename_at_94 < 0) ? das_auto_cast<int32_t>::cast(__r2_rename_at_94) : das_auto_cast<int32_t>::cast((__r1_rename_at_94 + __r2_rename_at_94)))));
+}}
+
+inline bool _Funcfio_0x60_fload_bc188924ab79366c ( Context * __context__, FILE const  * const  __f_rename_at_79, Foo &  __buf_rename_at_79 ) { das_stack_prologue __prologue(__context__,144,"fio`fload " DAS_FILE_LINE);
+{
+	fio::df_header __dfh_rename_at_80; das_zero(__dfh_rename_at_80);
+	int32_t __r1_rename_at_81 = ((int32_t)das_call_interop<int32_t>::call(&builtin_read,__context__,SimNode_AotInterop<3>(__tinfo_4,cast<FILE const  * const >::from(__f_rename_at_79),cast<fio::df_header &>::from(__dfh_rename_at_80),cast<int32_t>::from(8))));
+	if ( __r1_rename_at_81 < 0 )
+	{
+		return das_auto_cast<bool>::cast(false);
+	} else {
+		if ( __dfh_rename_at_80.magic != 0x12345678u )
+		{
+			return das_auto_cast<bool>::cast(false);
+		} else {
+			bool __loaded_rename_at_86 = false;
+			das_call_interop<void>::call(&builtin_load,__context__,SimNode_AotInterop<3>(__tinfo_5,cast<FILE const  * const >::from(__f_rename_at_79),cast<int32_t>::from(__dfh_rename_at_80.size),cast<Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &>::from(das_make_block<void,TArray<uint8_t> const  &>(__context__,128,0,&__func_info__d3b307c446b1e15e,[&](TArray<uint8_t> const  & __data_rename_at_87)->void{
+				if ( builtin_array_size(__data_rename_at_87) != 0 )
+				{
+					_Funcbuiltin_0x60_binary_load_43040880b26c4465(__context__,das_arg<Foo>::pass(__buf_rename_at_79),__data_rename_at_87);
+					das_copy(__loaded_rename_at_86,true);
+				};
+			}))));
+			return das_auto_cast<bool>::cast(__loaded_rename_at_86);
+		};
+	};
+}}
+
+inline void _Funcfio_0x60_fopen_4e6143847f364a84 ( Context * __context__, char * const  __name_rename_at_11, char * const  __mode_rename_at_11, Block DAS_COMMENT((void,FILE const  * const )) const  &  __blk_rename_at_11 )
+{
+	FILE const  * __f_rename_at_12 = ((FILE const  *)builtin_fopen(__name_rename_at_11,__mode_rename_at_11));
+	das_invoke<void>::invoke<FILE const  * const >(__context__,nullptr,__blk_rename_at_11,__f_rename_at_12);
+	if ( __f_rename_at_12 != nullptr )
+	{
+		builtin_fclose(__f_rename_at_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	};
+}
+
+inline bool test_df6d9ba202eb6eba ( Context * __context__ ) { das_stack_prologue __prologue(__context__,224,"test " DAS_FILE_LINE);
+{
+	bool __saved_rename_at_9 = false;
+	bool __loaded_rename_at_10 = false;
+	Foo __foo0_rename_at_11_ConstRef = ((Foo)Foo_2cda648a5bf7d61(__context__));
+	Foo const  & __foo0_rename_at_11 = __foo0_rename_at_11_ConstRef; ;
+	_Funcfio_0x60_fopen_4e6143847f364a84(__context__,((char *) "test.bin"),((char *) "wb"),das_make_block<void,FILE const  * const >(__context__,128,0,&__func_info__97e90aed55b2517d,[&](FILE const  * const  __f_rename_at_12)->void{
+		if ( __f_rename_at_12 != nullptr )
+		{
+			_Funcfio_0x60_fsave_1cf1b87a33c6fc5a(__context__,__f_rename_at_12,__foo0_rename_at_11);
+			das_copy(__saved_rename_at_9,true);
+		};
+	}));
+	Foo __foo1_rename_at_16; das_zero(__foo1_rename_at_16);
+	_Funcfio_0x60_fopen_4e6143847f364a84(__context__,((char *) "test.bin"),((char *) "rb"),das_make_block<void,FILE const  * const >(__context__,208,0,&__func_info__97e90aed55b2517d,[&](FILE const  * const  __f_rename_at_17)->void{
+		if ( __f_rename_at_17 != nullptr )
+		{
+			_Funcfio_0x60_fload_bc188924ab79366c(__context__,__f_rename_at_17,das_arg<Foo>::pass(__foo1_rename_at_16));
+			das_copy(__loaded_rename_at_10,true);
+		};
+	}));
+	DAS_ASSERT((__saved_rename_at_9));
+	DAS_ASSERT((__loaded_rename_at_10));
+	DAS_ASSERT(((__foo0_rename_at_11.a == __foo1_rename_at_16.a) && (__foo0_rename_at_11.b == __foo1_rename_at_16.b)));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+inline Foo Foo_2cda648a5bf7d61 ( Context * __context__ )
+{
+	return das_auto_cast_ref<Foo>::cast((([&]() -> Foo {
+		Foo __mks_3;
+		das_copy((__mks_3.a),(1));
+		das_copy((__mks_3.b),(2.f));
+		return __mks_3;
+	})()));
+}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_binary_save_df945637b1078ab2
+	aotLib[0xd0fc38c10c0acad5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo const  & , Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &  ),&_Funcbuiltin_0x60_binary_save_df945637b1078ab2>>();
+	};
+	// _Funcbuiltin_0x60_binary_load_43040880b26c4465
+	aotLib[0x6bdd023c49b23d11] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo & , TArray<uint8_t> const  &  ),&_Funcbuiltin_0x60_binary_load_43040880b26c4465>>();
+	};
+	// _Funcfio_0x60_fsave_1cf1b87a33c6fc5a
+	aotLib[0x8108a0b1d9c66c6d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, FILE const  * const  , Foo const  &  ),&_Funcfio_0x60_fsave_1cf1b87a33c6fc5a>>();
+	};
+	// _Funcfio_0x60_fload_bc188924ab79366c
+	aotLib[0x401b763d374466eb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, FILE const  * const  , Foo &  ),&_Funcfio_0x60_fload_bc188924ab79366c>>();
+	};
+	// _Funcfio_0x60_fopen_4e6143847f364a84
+	aotLib[0xb0b10cf2a8d7d46d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , char * const  , Block DAS_COMMENT((void,FILE const  * const )) const  &  ),&_Funcfio_0x60_fopen_4e6143847f364a84>>();
+	};
+	// test_df6d9ba202eb6eba
+	aotLib[0xc9cd78274cb5d428] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_df6d9ba202eb6eba>>();
+	};
+	// Foo_2cda648a5bf7d61
+	aotLib[0xdbb8de7ec022ec7d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__ ),&Foo_2cda648a5bf7d61>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
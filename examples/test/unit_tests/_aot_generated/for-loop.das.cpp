@@ -0,0 +1,561 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_7517222392756243744 {
+
+extern TypeInfo __type_info__90f3d07b5a6ca13;
+extern TypeInfo __type_info__90f4307b5a6d445;
+extern TypeInfo __type_info__90f5707b5a6f641;
+
+TypeInfo __type_info__90f3d07b5a6ca13 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, 0x90f3d07b5a6ca13ul };
+TypeInfo __type_info__90f4307b5a6d445 = { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, 0x90f4307b5a6d445ul };
+TypeInfo __type_info__90f5707b5a6f641 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, 0x90f5707b5a6f641ul };
+
+TypeInfo * __tinfo_0[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f5707b5a6f641, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_1[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f4307b5a6d445, &__type_info__90f3d07b5a6ca13 };
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_5cbab1dfe9635bc1 ( Context * __context__, range __rng_rename_at_345 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void test_from_gte_to_f1cb55459e0ad324 ( Context * __context__ );
+inline bool test_fc6d3d3c46094146 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_5cbab1dfe9635bc1 ( Context * __context__, range __rng_rename_at_345 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_346; das_zero(__it_rename_at_346);
+	builtin_make_range_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_346),__rng_rename_at_345,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_346);
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,4,__context__);
+}
+
+inline void test_from_gte_to_f1cb55459e0ad324 ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_32_224;
+	{
+		uint64_t __loop_count_3 = UINT64_MAX;
+		// x : int const
+		das_iterator<range> __x_iterator(range(3,2));
+		int32_t __x_rename_at_3;
+		__loop_count_3 = das_loop_count(__loop_count_3,__x_iterator.loop_begin(__context__,(__x_rename_at_3)));
+		for ( ; __loop_count_3 ; --__loop_count_3, ++__x_rename_at_3 )
+		{
+			DAS_ASSERT((false));
+		}
+		__x_iterator.loop_end(__context__,(__x_rename_at_3));
+	};
+	{
+		uint64_t __loop_count_5 = UINT64_MAX;
+		// x : uint const
+		das_iterator<urange> __x_iterator(urange(3,2));
+		uint32_t __x_rename_at_5;
+		__loop_count_5 = das_loop_count(__loop_count_5,__x_iterator.loop_begin(__context__,(__x_rename_at_5)));
+		for ( ; __loop_count_5 ; --__loop_count_5, ++__x_rename_at_5 )
+		{
+			DAS_ASSERT((false));
+		}
+		__x_iterator.loop_end(__context__,(__x_rename_at_5));
+	};
+	{
+		uint64_t __loop_count_8 = UINT64_MAX;
+		// x : int const
+		das_iterator<range> __x_iterator(range(3,2));
+		int32_t __x_rename_at_8;
+		__loop_count_8 = das_loop_count(__loop_count_8,__x_iterator.loop_begin(__context__,(__x_rename_at_8)));
+		for ( ; __loop_count_8 ; --__loop_count_8, ++__x_rename_at_8 )
+		{
+			builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_0, cast<char * const >::from(((char *) "x=")), cast<int32_t>::from(__x_rename_at_8), cast<char * const >::from(((char *) "\n")))),__context__);
+			DAS_ASSERT((false));
+		}
+		__x_iterator.loop_end(__context__,(__x_rename_at_8));
+	};
+	{
+		uint64_t __loop_count_11 = UINT64_MAX;
+		// x : uint const
+		das_iterator<urange> __x_iterator(urange(3,2));
+		uint32_t __x_rename_at_11;
+		__loop_count_11 = das_loop_count(__loop_count_11,__x_iterator.loop_begin(__context__,(__x_rename_at_11)));
+		for ( ; __loop_count_11 ; --__loop_count_11, ++__x_rename_at_11 )
+		{
+			builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "x=")), cast<uint32_t>::from(__x_rename_at_11), cast<char * const >::from(((char *) "\n")))),__context__);
+			DAS_ASSERT((false));
+		}
+		__x_iterator.loop_end(__context__,(__x_rename_at_11));
+	};
+	{
+		uint64_t __loop_count_15 = UINT64_MAX;
+		// x : int const
+		das_iterator<range> __x_iterator(range(3,2));
+		int32_t __x_rename_at_15;
+		__loop_count_15 = das_loop_count(__loop_count_15,__x_iterator.loop_begin(__context__,(__x_rename_at_15)));
+		for ( ; __loop_count_15 ; --__loop_count_15, ++__x_rename_at_15 )
+		{
+			break;
+		}
+		__x_iterator.loop_end(__context__,(__x_rename_at_15));
+	};
+	{
+		uint64_t __loop_count_17 = UINT64_MAX;
+		// x : uint const
+		das_iterator<urange> __x_iterator(urange(3,2));
+		uint32_t __x_rename_at_17;
+		__loop_count_17 = das_loop_count(__loop_count_17,__x_iterator.loop_begin(__context__,(__x_rename_at_17)));
+		for ( ; __loop_count_17 ; --__loop_count_17, ++__x_rename_at_17 )
+		{
+			break;
+		}
+		__x_iterator.loop_end(__context__,(__x_rename_at_17));
+	};
+	{
+		uint64_t __loop_count_20 = UINT64_MAX;
+		// x : int const
+		das_iterator<range> __x_iterator(range(3,2));
+		int32_t __x_rename_at_20;
+		__loop_count_20 = das_loop_count(__loop_count_20,__x_iterator.loop_begin(__context__,(__x_rename_at_20)));
+		for ( ; __loop_count_20 ; --__loop_count_20, ++__x_rename_at_20 )
+		{
+			DAS_ASSERT((false));
+			break;
+		}
+		__x_iterator.loop_end(__context__,(__x_rename_at_20));
+	};
+	{
+		uint64_t __loop_count_23 = UINT64_MAX;
+		// x : uint const
+		das_iterator<urange> __x_iterator(urange(3,2));
+		uint32_t __x_rename_at_23;
+		__loop_count_23 = das_loop_count(__loop_count_23,__x_iterator.loop_begin(__context__,(__x_rename_at_23)));
+		for ( ; __loop_count_23 ; --__loop_count_23, ++__x_rename_at_23 )
+		{
+			DAS_ASSERT((false));
+			break;
+		}
+		__x_iterator.loop_end(__context__,(__x_rename_at_23));
+	};
+	{
+		uint64_t __loop_count_27 = UINT64_MAX;
+		// x : int const
+		das_iterator<range> __x_iterator(range(3,2));
+		int32_t __x_rename_at_27;
+		__loop_count_27 = das_loop_count(__loop_count_27,__x_iterator.loop_begin(__context__,(__x_rename_at_27)));
+		// y : uint const
+		das_iterator<urange> __y_iterator(urange(3,2));
+		uint32_t __y_rename_at_27;
+		__loop_count_27 = das_loop_count(__loop_count_27,__y_iterator.loop_begin(__context__,(__y_rename_at_27)));
+		for ( ; __loop_count_27 ; --__loop_count_27, ++__x_rename_at_27, ++__y_rename_at_27 )
+		{
+			DAS_ASSERT((false));
+		}
+		__x_iterator.loop_end(__context__,(__x_rename_at_27));
+		__y_iterator.loop_end(__context__,(__y_rename_at_27));
+	};
+	{
+		uint64_t __loop_count_29 = UINT64_MAX;
+		// x : uint const
+		das_iterator<urange> __x_iterator(urange(3,2));
+		uint32_t __x_rename_at_29;
+		__loop_count_29 = das_loop_count(__loop_count_29,__x_iterator.loop_begin(__context__,(__x_rename_at_29)));
+		// y : uint const
+		das_iterator<urange> __y_iterator(urange(3,2));
+		uint32_t __y_rename_at_29;
+		__loop_count_29 = das_loop_count(__loop_count_29,__y_iterator.loop_begin(__context__,(__y_rename_at_29)));
+		for ( ; __loop_count_29 ; --__loop_count_29, ++__x_rename_at_29, ++__y_rename_at_29 )
+		{
+			DAS_ASSERT((false));
+		}
+		__x_iterator.loop_end(__context__,(__x_rename_at_29));
+		__y_iterator.loop_end(__context__,(__y_rename_at_29));
+	};
+	{
+		bool __need_loop_32 = true;
+		// x : int
+		das_iterator<Sequence DAS_COMMENT((int32_t))> __x_iterator((_temp_make_local_32_224 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(3,2)))));
+		int32_t __x_rename_at_32;
+		__need_loop_32 = __x_iterator.first(__context__,(__x_rename_at_32)) && __need_loop_32;
+		for ( ; __need_loop_32 ; __need_loop_32 = __x_iterator.next(__context__,(__x_rename_at_32)) )
+		{
+			DAS_ASSERT((false));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_32));
+	};
+}
+
+inline bool test_fc6d3d3c46094146 ( Context * __context__ )
+{
+	TDim<int32_t,10> __a_rename_at_39; das_zero(__a_rename_at_39);
+	int32_t __i_rename_at_40 = 0;
+	{
+		uint64_t __loop_count_41 = UINT64_MAX;
+		// l : int& -const
+		das_iterator<TDim<int32_t,10>> __l_iterator(__a_rename_at_39);
+		int32_t * __restrict __l_rename_at_41;
+		__loop_count_41 = das_loop_count(__loop_count_41,__l_iterator.loop_begin(__context__,(__l_rename_at_41)));
+		for ( ; __loop_count_41 ; --__loop_count_41, ++__l_rename_at_41 )
+		{
+			das_copy((*__l_rename_at_41),__i_rename_at_40);
+			++__i_rename_at_40;
+		}
+		__l_iterator.loop_end(__context__,(__l_rename_at_41));
+	};
+	DAS_ASSERT((__i_rename_at_40 == 10));
+	das_copy(__i_rename_at_40,0);
+	{
+		uint64_t __loop_count_46 = UINT64_MAX;
+		// l : int& -const
+		das_iterator<TDim<int32_t,10>> __l_iterator(__a_rename_at_39);
+		int32_t * __restrict __l_rename_at_46;
+		__loop_count_46 = das_loop_count(__loop_count_46,__l_iterator.loop_begin(__context__,(__l_rename_at_46)));
+		for ( ; __loop_count_46 ; --__loop_count_46, ++__l_rename_at_46 )
+		{
+			DAS_ASSERT(((*__l_rename_at_46) == __i_rename_at_40));
+			++__i_rename_at_40;
+		}
+		__l_iterator.loop_end(__context__,(__l_rename_at_46));
+	};
+	TArray<int32_t> __a_rename_at_51; das_zero(__a_rename_at_51);
+	int32_t __i_rename_at_52 = 0;
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_51),13);
+	{
+		uint64_t __loop_count_54 = UINT64_MAX;
+		// l : int&
+		das_iterator<TArray<int32_t>> __l_iterator(__a_rename_at_51);
+		int32_t * __restrict __l_rename_at_54;
+		__loop_count_54 = das_loop_count(__loop_count_54,__l_iterator.loop_begin(__context__,(__l_rename_at_54)));
+		for ( ; __loop_count_54 ; --__loop_count_54, ++__l_rename_at_54 )
+		{
+			das_copy((*__l_rename_at_54),__i_rename_at_52++);
+		}
+		__l_iterator.loop_end(__context__,(__l_rename_at_54));
+	};
+	DAS_ASSERT((__i_rename_at_52 == 13));
+	das_copy(__i_rename_at_52,0);
+	{
+		uint64_t __loop_count_58 = UINT64_MAX;
+		// l : int&
+		das_iterator<TArray<int32_t>> __l_iterator(__a_rename_at_51);
+		int32_t * __restrict __l_rename_at_58;
+		__loop_count_58 = das_loop_count(__loop_count_58,__l_iterator.loop_begin(__context__,(__l_rename_at_58)));
+		for ( ; __loop_count_58 ; --__loop_count_58, ++__l_rename_at_58 )
+		{
+			DAS_ASSERT(((*__l_rename_at_58) == __i_rename_at_52));
+			++__i_rename_at_52;
+		}
+		__l_iterator.loop_end(__context__,(__l_rename_at_58));
+	};
+	TDim<int32_t,10> __a_rename_at_63; das_zero(__a_rename_at_63); TDim<int32_t,10> __b_rename_at_63; das_zero(__b_rename_at_63);
+	int32_t __i_rename_at_64 = 0;
+	{
+		uint64_t __loop_count_65 = UINT64_MAX;
+		// l : int& -const
+		das_iterator<TDim<int32_t,10>> __l_iterator(__a_rename_at_63);
+		int32_t * __restrict __l_rename_at_65;
+		__loop_count_65 = das_loop_count(__loop_count_65,__l_iterator.loop_begin(__context__,(__l_rename_at_65)));
+		// r : int& -const
+		das_iterator<TDim<int32_t,10>> __r_iterator(__b_rename_at_63);
+		int32_t * __restrict __r_rename_at_65;
+		__loop_count_65 = das_loop_count(__loop_count_65,__r_iterator.loop_begin(__context__,(__r_rename_at_65)));
+		for ( ; __loop_count_65 ; --__loop_count_65, ++__l_rename_at_65, ++__r_rename_at_65 )
+		{
+			das_copy((*__r_rename_at_65),(__i_rename_at_64 * 2) - 5);
+			das_copy((*__l_rename_at_65),__i_rename_at_64++);
+		}
+		__l_iterator.loop_end(__context__,(__l_rename_at_65));
+		__r_iterator.loop_end(__context__,(__r_rename_at_65));
+	};
+	DAS_ASSERT((__i_rename_at_64 == 10));
+	das_copy(__i_rename_at_64,0);
+	{
+		uint64_t __loop_count_70 = UINT64_MAX;
+		// l : int& -const
+		das_iterator<TDim<int32_t,10>> __l_iterator(__a_rename_at_63);
+		int32_t * __restrict __l_rename_at_70;
+		__loop_count_70 = das_loop_count(__loop_count_70,__l_iterator.loop_begin(__context__,(__l_rename_at_70)));
+		// r : int& -const
+		das_iterator<TDim<int32_t,10>> __r_iterator(__b_rename_at_63);
+		int32_t * __restrict __r_rename_at_70;
+		__loop_count_70 = das_loop_count(__loop_count_70,__r_iterator.loop_begin(__context__,(__r_rename_at_70)));
+		for ( ; __loop_count_70 ; --__loop_count_70, ++__l_rename_at_70, ++__r_rename_at_70 )
+		{
+			DAS_ASSERT(((*__r_rename_at_70) == ((__i_rename_at_64 * 2) - 5)));
+			DAS_VERIFY(((*__l_rename_at_70) == __i_rename_at_64++));
+		}
+		__l_iterator.loop_end(__context__,(__l_rename_at_70));
+		__r_iterator.loop_end(__context__,(__r_rename_at_70));
+	};
+	das_copy(__i_rename_at_64,0);
+	{
+		uint64_t __loop_count_74 = UINT64_MAX;
+		// l : int& -const
+		das_iterator<TDim<int32_t,10>> __l_iterator(__a_rename_at_63);
+		int32_t * __restrict __l_rename_at_74;
+		__loop_count_74 = das_loop_count(__loop_count_74,__l_iterator.loop_begin(__context__,(__l_rename_at_74)));
+		// r : int& -const
+		das_iterator<TDim<int32_t,10>> __r_iterator(__b_rename_at_63);
+		int32_t * __restrict __r_rename_at_74;
+		__loop_count_74 = das_loop_count(__loop_count_74,__r_iterator.loop_begin(__context__,(__r_rename_at_74)));
+		for ( ; __loop_count_74 ; --__loop_count_74, ++__l_rename_at_74, ++__r_rename_at_74 )
+		{
+			if ( (*__l_rename_at_74) > (*__r_rename_at_74) )
+			{
+				DAS_ASSERT(((*__l_rename_at_74) > (*__r_rename_at_74)));
+				++__i_rename_at_64;
+			};
+		}
+		__l_iterator.loop_end(__context__,(__l_rename_at_74));
+		__r_iterator.loop_end(__context__,(__r_rename_at_74));
+	};
+	DAS_ASSERT((__i_rename_at_64 == 5));
+	TArray<int32_t> __a_rename_at_81; das_zero(__a_rename_at_81);
+	TDim<int32_t,10> __b_rename_at_82; das_zero(__b_rename_at_82);
+	int32_t __i_rename_at_83 = 0;
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_81),4);
+	{
+		uint64_t __loop_count_85 = UINT64_MAX;
+		// l : int&
+		das_iterator<TArray<int32_t>> __l_iterator(__a_rename_at_81);
+		int32_t * __restrict __l_rename_at_85;
+		__loop_count_85 = das_loop_count(__loop_count_85,__l_iterator.loop_begin(__context__,(__l_rename_at_85)));
+		// r : int& -const
+		das_iterator<TDim<int32_t,10>> __r_iterator(__b_rename_at_82);
+		int32_t * __restrict __r_rename_at_85;
+		__loop_count_85 = das_loop_count(__loop_count_85,__r_iterator.loop_begin(__context__,(__r_rename_at_85)));
+		for ( ; __loop_count_85 ; --__loop_count_85, ++__l_rename_at_85, ++__r_rename_at_85 )
+		{
+			DAS_ASSERT((__i_rename_at_83 < 4));
+			das_copy((*__r_rename_at_85),(__i_rename_at_83 * 2) - 5);
+			das_copy((*__l_rename_at_85),__i_rename_at_83++);
+		}
+		__l_iterator.loop_end(__context__,(__l_rename_at_85));
+		__r_iterator.loop_end(__context__,(__r_rename_at_85));
+	};
+	DAS_ASSERT((__i_rename_at_83 == 4));
+	das_copy(__i_rename_at_83,0);
+	{
+		uint64_t __loop_count_91 = UINT64_MAX;
+		// l : int&
+		das_iterator<TArray<int32_t>> __l_iterator(__a_rename_at_81);
+		int32_t * __restrict __l_rename_at_91;
+		__loop_count_91 = das_loop_count(__loop_count_91,__l_iterator.loop_begin(__context__,(__l_rename_at_91)));
+		// r : int& -const
+		das_iterator<TDim<int32_t,10>> __r_iterator(__b_rename_at_82);
+		int32_t * __restrict __r_rename_at_91;
+		__loop_count_91 = das_loop_count(__loop_count_91,__r_iterator.loop_begin(__context__,(__r_rename_at_91)));
+		for ( ; __loop_count_91 ; --__loop_count_91, ++__l_rename_at_91, ++__r_rename_at_91 )
+		{
+			DAS_ASSERT(((*__r_rename_at_91) == ((__i_rename_at_83 * 2) - 5)));
+			DAS_VERIFY(((*__l_rename_at_91) == __i_rename_at_83++));
+		}
+		__l_iterator.loop_end(__context__,(__l_rename_at_91));
+		__r_iterator.loop_end(__context__,(__r_rename_at_91));
+	};
+	DAS_ASSERT((__i_rename_at_83 == 4));
+	das_copy(__i_rename_at_83,0);
+	{
+		uint64_t __loop_count_96 = UINT64_MAX;
+		// l : int&
+		das_iterator<TArray<int32_t>> __l_iterator(__a_rename_at_81);
+		int32_t * __restrict __l_rename_at_96;
+		__loop_count_96 = das_loop_count(__loop_count_96,__l_iterator.loop_begin(__context__,(__l_rename_at_96)));
+		// r : int& -const
+		das_iterator<TDim<int32_t,10>> __r_iterator(__b_rename_at_82);
+		int32_t * __restrict __r_rename_at_96;
+		__loop_count_96 = das_loop_count(__loop_count_96,__r_iterator.loop_begin(__context__,(__r_rename_at_96)));
+		for ( ; __loop_count_96 ; --__loop_count_96, ++__l_rename_at_96, ++__r_rename_at_96 )
+		{
+			if ( (*__l_rename_at_96) > (*__r_rename_at_96) )
+			{
+				DAS_ASSERT(((*__l_rename_at_96) > (*__r_rename_at_96)));
+				++__i_rename_at_83;
+			};
+		}
+		__l_iterator.loop_end(__context__,(__l_rename_at_96));
+		__r_iterator.loop_end(__context__,(__r_rename_at_96));
+	};
+	DAS_ASSERT((__i_rename_at_83 == 4));
+	int32_t __i_rename_at_103 = 0;
+	{
+		uint64_t __loop_count_104 = UINT64_MAX;
+		// a : int const
+		das_iterator<range> __a_iterator(range(0,10));
+		int32_t __a_rename_at_104;
+		__loop_count_104 = das_loop_count(__loop_count_104,__a_iterator.loop_begin(__context__,(__a_rename_at_104)));
+		for ( ; __loop_count_104 ; --__loop_count_104, ++__a_rename_at_104 )
+		{
+			DAS_VERIFY((__a_rename_at_104 == __i_rename_at_103++));
+		}
+		__a_iterator.loop_end(__context__,(__a_rename_at_104));
+	};
+	DAS_ASSERT((__i_rename_at_103 == 10));
+	TDim<int32_t,10> __b_rename_at_109; das_zero(__b_rename_at_109);
+	int32_t __i_rename_at_110 = 0;
+	{
+		uint64_t __loop_count_111 = UINT64_MAX;
+		// l : int const
+		das_iterator<range> __l_iterator(range(0,10));
+		int32_t __l_rename_at_111;
+		__loop_count_111 = das_loop_count(__loop_count_111,__l_iterator.loop_begin(__context__,(__l_rename_at_111)));
+		// r : int& -const
+		das_iterator<TDim<int32_t,10>> __r_iterator(__b_rename_at_109);
+		int32_t * __restrict __r_rename_at_111;
+		__loop_count_111 = das_loop_count(__loop_count_111,__r_iterator.loop_begin(__context__,(__r_rename_at_111)));
+		for ( ; __loop_count_111 ; --__loop_count_111, ++__l_rename_at_111, ++__r_rename_at_111 )
+		{
+			das_copy((*__r_rename_at_111),(__i_rename_at_110++ * 2) - 5);
+		}
+		__l_iterator.loop_end(__context__,(__l_rename_at_111));
+		__r_iterator.loop_end(__context__,(__r_rename_at_111));
+	};
+	DAS_ASSERT((__i_rename_at_110 == 10));
+	das_copy(__i_rename_at_110,0);
+	{
+		uint64_t __loop_count_115 = UINT64_MAX;
+		// l : int const
+		das_iterator<range> __l_iterator(range(0,10));
+		int32_t __l_rename_at_115;
+		__loop_count_115 = das_loop_count(__loop_count_115,__l_iterator.loop_begin(__context__,(__l_rename_at_115)));
+		// r : int& -const
+		das_iterator<TDim<int32_t,10>> __r_iterator(__b_rename_at_109);
+		int32_t * __restrict __r_rename_at_115;
+		__loop_count_115 = das_loop_count(__loop_count_115,__r_iterator.loop_begin(__context__,(__r_rename_at_115)));
+		for ( ; __loop_count_115 ; --__loop_count_115, ++__l_rename_at_115, ++__r_rename_at_115 )
+		{
+			DAS_ASSERT(((*__r_rename_at_115) == ((__i_rename_at_110 * 2) - 5)));
+			DAS_VERIFY((__l_rename_at_115 == __i_rename_at_110++));
+		}
+		__l_iterator.loop_end(__context__,(__l_rename_at_115));
+		__r_iterator.loop_end(__context__,(__r_rename_at_115));
+	};
+	das_copy(__i_rename_at_110,0);
+	{
+		uint64_t __loop_count_119 = UINT64_MAX;
+		// l : int const
+		das_iterator<range> __l_iterator(range(0,10));
+		int32_t __l_rename_at_119;
+		__loop_count_119 = das_loop_count(__loop_count_119,__l_iterator.loop_begin(__context__,(__l_rename_at_119)));
+		// r : int& -const
+		das_iterator<TDim<int32_t,10>> __r_iterator(__b_rename_at_109);
+		int32_t * __restrict __r_rename_at_119;
+		__loop_count_119 = das_loop_count(__loop_count_119,__r_iterator.loop_begin(__context__,(__r_rename_at_119)));
+		for ( ; __loop_count_119 ; --__loop_count_119, ++__l_rename_at_119, ++__r_rename_at_119 )
+		{
+			if ( __l_rename_at_119 > (*__r_rename_at_119) )
+			{
+				DAS_ASSERT((__l_rename_at_119 > (*__r_rename_at_119)));
+				++__i_rename_at_110;
+			};
+		}
+		__l_iterator.loop_end(__context__,(__l_rename_at_119));
+		__r_iterator.loop_end(__context__,(__r_rename_at_119));
+	};
+	DAS_ASSERT((__i_rename_at_110 == 5));
+	uint32_t __u_rename_at_125 = 0x0u;
+	{
+		uint64_t __loop_count_126 = UINT64_MAX;
+		// t : uint const
+		das_iterator<urange> __t_iterator(urange(0,3));
+		uint32_t __t_rename_at_126;
+		__loop_count_126 = das_loop_count(__loop_count_126,__t_iterator.loop_begin(__context__,(__t_rename_at_126)));
+		for ( ; __loop_count_126 ; --__loop_count_126, ++__t_rename_at_126 )
+		{
+			__u_rename_at_125 += __t_rename_at_126;
+		}
+		__t_iterator.loop_end(__context__,(__t_rename_at_126));
+	};
+	DAS_ASSERT((__u_rename_at_125 == 0x3u));
+	TArray<int32_t> __a_rename_at_131; das_zero(__a_rename_at_131);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_131),8);
+	TArray<int32_t> * __b_rename_at_133 = &(__a_rename_at_131);
+	{
+		uint64_t __loop_count_134 = UINT64_MAX;
+		// x : int&
+		das_iterator<TArray<int32_t>> __x_iterator(__a_rename_at_131);
+		int32_t * __x_rename_at_134;
+		__loop_count_134 = das_loop_count(__loop_count_134,__x_iterator.loop_begin(__context__,(__x_rename_at_134)));
+		for ( ; __loop_count_134 ; --__loop_count_134, ++__x_rename_at_134 )
+		{
+			(*__b_rename_at_133)(0,__context__) += 1;
+			(*__x_rename_at_134) += (*__b_rename_at_133)(0,__context__);
+		}
+		__x_iterator.loop_end(__context__,(__x_rename_at_134));
+	};
+	DAS_ASSERT((((__a_rename_at_131(0,__context__) == 9) && (__a_rename_at_131(1,__context__) == 3)) && (__a_rename_at_131(7,__context__) == 9)));
+	test_from_gte_to_f1cb55459e0ad324(__context__);
+	return das_auto_cast<bool>::cast(true);
+}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_each_5cbab1dfe9635bc1
+	aotLib[0x8c2bf3089ff8b6f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, range  ),&_Funcbuiltin_0x60_each_5cbab1dfe9635bc1>>();
+	};
+	// _Funcbuiltin_0x60_resize_ce974596f011d69b
+	aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+	// test_from_gte_to_f1cb55459e0ad324
+	aotLib[0x7125f97c64aea4a7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_from_gte_to_f1cb55459e0ad324>>();
+	};
+	// test_fc6d3d3c46094146
+	aotLib[0x1b96ba8a1832c428] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_fc6d3d3c46094146>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
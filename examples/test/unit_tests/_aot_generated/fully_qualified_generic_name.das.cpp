@@ -0,0 +1,111 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require UnitTest
+#include "unitTest.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_15691854681602807235 {
+
+
+
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+
+inline bool _FuncUnitTest_0x60_start_effect_1e2eade881d0b509 ( Context * __context__, char * const  __name_rename_at_3, float3x4 const  & __tm_rename_at_3 );
+inline bool on_armor_hit_fx_effect_es_1d5ce4a17b41b867 ( Context * __context__, char * const  __visual_armor_hit_dot_effectName_rename_at_4 );
+inline bool test_f1d59eecb81fd3ac ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool _FuncUnitTest_0x60_start_effect_1e2eade881d0b509 ( Context * __context__, char * const  __name_rename_at_3, float3x4 const  &  __tm_rename_at_3 )
+{
+	return das_auto_cast<bool>::cast(start_effect(__name_rename_at_3,__tm_rename_at_3,1.f));
+}
+
+inline bool on_armor_hit_fx_effect_es_1d5ce4a17b41b867 ( Context * __context__, char * const  __visual_armor_hit_dot_effectName_rename_at_4 )
+{
+	float3x4 __tm_rename_at_5; das_zero(__tm_rename_at_5);
+	float3x4_identity(das_arg<float3x4>::pass(__tm_rename_at_5));
+	return das_auto_cast<bool>::cast(_FuncUnitTest_0x60_start_effect_1e2eade881d0b509(__context__,__visual_armor_hit_dot_effectName_rename_at_4,das_arg<float3x4>::pass(__tm_rename_at_5)));
+}
+
+inline bool test_f1d59eecb81fd3ac ( Context * __context__ )
+{
+	DAS_VERIFY((!on_armor_hit_fx_effect_es_1d5ce4a17b41b867(__context__,((char *) "test"))));
+	float3x4 __tm_rename_at_12; das_zero(__tm_rename_at_12);
+	float3x4_identity(das_arg<float3x4>::pass(__tm_rename_at_12));
+	_FuncUnitTest_0x60_start_effect_1e2eade881d0b509(__context__,((char *) "test-test"),das_arg<float3x4>::pass(__tm_rename_at_12));
+	return das_auto_cast<bool>::cast(true);
+}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _FuncUnitTest_0x60_start_effect_1e2eade881d0b509
+	aotLib[0xe724e52577b95329] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, char * const  , float3x4 const  &  ),&_FuncUnitTest_0x60_start_effect_1e2eade881d0b509>>();
+	};
+	// on_armor_hit_fx_effect_es_1d5ce4a17b41b867
+	aotLib[0x374d3f4c51ecf98b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, char * const   ),&on_armor_hit_fx_effect_es_1d5ce4a17b41b867>>();
+	};
+	// test_f1d59eecb81fd3ac
+	aotLib[0xb3d02a34a64206] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_f1d59eecb81fd3ac>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,1978 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_563978567757915810 {
+
+extern StructInfo __struct_info__445fc213758e745a;
+extern StructInfo __struct_info__75f139fb0d7903cc;
+extern StructInfo __struct_info__65ed51ec56f68b72;
+extern StructInfo __struct_info__f2771dea464979f2;
+extern StructInfo __struct_info__949f54b926b96fa4;
+extern StructInfo __struct_info__38a001508c55f81b;
+extern StructInfo __struct_info__744cfff74816431e;
+extern StructInfo __struct_info__9341429604e96234;
+extern StructInfo __struct_info__16945481f95e29d0;
+extern StructInfo __struct_info__c8fad7c83dbf58bd;
+extern StructInfo __struct_info__3617cb6b5728c9ca;
+extern StructInfo __struct_info__1b814321ec0683c5;
+extern StructInfo __struct_info__f7dcdd75dd77166e;
+extern StructInfo __struct_info__be8a7a154b983bc3;
+extern TypeInfo __type_info__4ebea6b4cf76514b;
+extern TypeInfo __type_info__60fec17896533777;
+extern TypeInfo __type_info__8f17d7aae820031c;
+extern TypeInfo __type_info__90f4c07b5a6e390;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__7fabd1653d932cd1;
+extern TypeInfo __type_info__574dbdb1dc587435;
+extern TypeInfo __type_info__45ec1d4e6051a4db;
+extern TypeInfo __type_info__13674d08c6ce3165;
+extern TypeInfo __type_info__39a2907d380e7fa2;
+extern TypeInfo __type_info__d07e8c02ec880f09;
+extern TypeInfo __type_info__6964d686464baf60;
+extern TypeInfo __type_info__693cc13c1ad65f7b;
+extern TypeInfo __type_info__50b236c0c3679a07;
+extern TypeInfo __type_info__e798b9863673a07;
+extern TypeInfo __type_info__ddc83c7879f95a70;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__537b25dfc19dabc;
+extern TypeInfo __type_info__7bf5307b489d850;
+extern TypeInfo __type_info__1ee8c403a3b9eb3d;
+extern TypeInfo __type_info__ae9d40554f3d3b65;
+extern TypeInfo __type_info__a8304d4f1d8e0373;
+extern TypeInfo __type_info__8579fec2120f02b;
+extern TypeInfo __type_info__835f336e2f0d7022;
+extern TypeInfo __type_info__e4a4f20d2e813a14;
+extern TypeInfo __type_info__babaed4061694eb9;
+extern TypeInfo __type_info__629ba791d8367189;
+extern TypeInfo __type_info__9a4e963311b57c01;
+extern TypeInfo __type_info__619cf07339b4f1e5;
+extern TypeInfo __type_info__97ba66ce6d6a80f1;
+extern TypeInfo __type_info__2251a8dc8724191a;
+extern TypeInfo __type_info__4eea7ba07c5b7fcb;
+extern VarInfo __var_info__f64f0a871abd23e6;
+extern VarInfo __var_info__be36668663a02368;
+extern VarInfo __var_info__bd21c9e92ca467;
+extern VarInfo __var_info__8f398718c53253ea;
+extern VarInfo __var_info__5aebe73d2c07d221;
+extern VarInfo __var_info__fa41cbd0b133486;
+extern VarInfo __var_info__80eac506cf901be5;
+extern VarInfo __var_info__2882ee8d5e44683b;
+extern VarInfo __var_info__ff5e71c03c28c7c8;
+extern VarInfo __var_info__caec65218d20d616;
+extern VarInfo __var_info__f7544dd0eb976731;
+extern VarInfo __var_info__1375f3732f3db3d3;
+extern VarInfo __var_info__a0c02555dad29bfe;
+extern VarInfo __var_info__fde840036eb62ecb;
+extern VarInfo __var_info__8ec88cddbb365b40;
+extern VarInfo __var_info__e005643f2e917a5a;
+extern VarInfo __var_info__667dc26b501aa9aa;
+extern VarInfo __var_info__938cd7f9d2a333e1;
+extern VarInfo __var_info__f7cea2a9fd9f363f;
+extern VarInfo __var_info__cb259ce48e568726;
+extern VarInfo __var_info__6b19ff4cf0dcb2ee;
+extern VarInfo __var_info__a609c54ad1a94f4e;
+extern VarInfo __var_info__35fe67faa12e59f3;
+extern VarInfo __var_info__42f4f0b6a7d3d544;
+extern VarInfo __var_info__f10abe1460a59f15;
+extern VarInfo __var_info__4aaf04a2f66ff306;
+extern VarInfo __var_info__52c486f8e776d890;
+extern VarInfo __var_info__e59bde0c0a7845a6;
+extern VarInfo __var_info__e4cacaa67806e55b;
+extern VarInfo __var_info__d5d6a65cbdf1494b;
+extern VarInfo __var_info__5da51341dd031aea;
+extern VarInfo __var_info__d88070e4f862592a;
+extern VarInfo __var_info__e12aef54fd774c6f;
+extern VarInfo __var_info__136d82efc9d65b45;
+extern VarInfo __var_info__16fb593f495a192c;
+extern VarInfo __var_info__ebd2921657612ec3;
+extern VarInfo __var_info__6286c458145d39c6;
+extern VarInfo __var_info__d351fb8a10cd741c;
+extern VarInfo __var_info__3e78f59c1fbe6088;
+extern VarInfo __var_info__65cd145d6a6b3140;
+extern VarInfo __var_info__dc55c1985350c9ff;
+extern VarInfo __var_info__3233564b153ca1de;
+extern VarInfo __var_info__507c6ca2e3f2632e;
+extern VarInfo __var_info__77e7ffa41f717ebd;
+extern VarInfo __var_info__dde7bb13bc083fcb;
+extern VarInfo __var_info__382698332f729f8c;
+extern VarInfo __var_info__2e6508f2a73db957;
+extern VarInfo __var_info__7191b1646da6adf0;
+extern VarInfo __var_info__4454b3c68e7e3d83;
+extern VarInfo __var_info__6e072023beef0ce5;
+extern VarInfo __var_info__b0ae5e129562a095;
+extern VarInfo __var_info__83cdf89db057cca9;
+extern VarInfo __var_info__3599900724d243dc;
+extern VarInfo __var_info__5e1b83e01e51f41b;
+extern VarInfo __var_info__b9ad6d6341614dbd;
+extern VarInfo __var_info__20a674f6cac5fe64;
+extern VarInfo __var_info__a9e56061de2d0066;
+extern VarInfo __var_info__a07f3b356a42f554;
+extern VarInfo __var_info__28c600e6dc82e708;
+extern VarInfo __var_info__c5217f9baab7aed1;
+extern VarInfo __var_info__a07f5b356a432bb4;
+extern VarInfo __var_info__d4012fbd833ac902;
+extern VarInfo __var_info__920fb5043150f0dd;
+extern VarInfo __var_info__5d513e06601a43ef;
+extern VarInfo __var_info__a482259ef0b816a5;
+extern VarInfo __var_info__350aebb3e95713a;
+extern VarInfo __var_info__605300f10b3ce3dd;
+extern VarInfo __var_info__93165a810179d952;
+extern VarInfo __var_info__e35268b76f0ce2d3;
+extern VarInfo __var_info__741cd4e8d637f3b7;
+extern VarInfo __var_info__c2b95991b2cbe93d;
+extern VarInfo __var_info__2ba69326662be71c;
+extern VarInfo __var_info__64143a34b5de1914;
+extern VarInfo __var_info__3cbbc92b28f39f6a;
+extern VarInfo __var_info__abb1defc6e18e2e7;
+extern VarInfo __var_info__3ebe7744aae050e0;
+
+TypeInfo * __type_info__abb1defc6e18e2e7_arg_types_var_4926869906199049306[2] = { &__type_info__babaed4061694eb9, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__445fc213758e745a_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__abb1defc6e18e2e7_arg_types_var_4926869906199049306, nullptr, 2, 0, nullptr, 28, 8, 0xabb1defc6e18e2e7ul, "__lambda", 0 };
+TypeInfo * __type_info__a609c54ad1a94f4e_arg_types_var_4926869906199049306[1] = { &__type_info__1ee8c403a3b9eb3d };
+VarInfo __struct_info__445fc213758e745a_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__a609c54ad1a94f4e_arg_types_var_4926869906199049306, nullptr, 1, 0, nullptr, 28, 8, 0xa609c54ad1a94f4eul, "__finalize", 8 };
+VarInfo __struct_info__445fc213758e745a_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xf10abe1460a59f15ul, "__yield", 16 };
+VarInfo __struct_info__445fc213758e745a_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0x6b19ff4cf0dcb2eeul, "t", 20 };
+VarInfo * __struct_info__445fc213758e745a_fields[4] =  { &__struct_info__445fc213758e745a_field_0, &__struct_info__445fc213758e745a_field_1, &__struct_info__445fc213758e745a_field_2, &__struct_info__445fc213758e745a_field_3 };
+StructInfo __struct_info__445fc213758e745a = {(char*)"_lambda_thismodule_106_8_6", (char*)"", 6, __struct_info__445fc213758e745a_fields, 4, 24, 0x0ul, nullptr, 0x445fc213758e745aul };
+TypeInfo * __type_info__920fb5043150f0dd_arg_types_var_8498637722250445772[2] = { &__type_info__574dbdb1dc587435, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__75f139fb0d7903cc_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__920fb5043150f0dd_arg_types_var_8498637722250445772, nullptr, 2, 0, nullptr, 28, 8, 0x920fb5043150f0ddul, "__lambda", 0 };
+TypeInfo * __type_info__20a674f6cac5fe64_arg_types_var_8498637722250445772[1] = { &__type_info__8579fec2120f02b };
+VarInfo __struct_info__75f139fb0d7903cc_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__20a674f6cac5fe64_arg_types_var_8498637722250445772, nullptr, 1, 0, nullptr, 28, 8, 0x20a674f6cac5fe64ul, "__finalize", 8 };
+VarInfo __struct_info__75f139fb0d7903cc_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xd5d6a65cbdf1494bul, "__yield", 16 };
+VarInfo __struct_info__75f139fb0d7903cc_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xa07f5b356a432bb4ul, "t", 20 };
+VarInfo __struct_info__75f139fb0d7903cc_field_4 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0xa07f3b356a42f554ul, "T", 24 };
+VarInfo * __struct_info__75f139fb0d7903cc_fields[5] =  { &__struct_info__75f139fb0d7903cc_field_0, &__struct_info__75f139fb0d7903cc_field_1, &__struct_info__75f139fb0d7903cc_field_2, &__struct_info__75f139fb0d7903cc_field_3, &__struct_info__75f139fb0d7903cc_field_4 };
+StructInfo __struct_info__75f139fb0d7903cc = {(char*)"_lambda_thismodule_46_8_3", (char*)"", 6, __struct_info__75f139fb0d7903cc_fields, 5, 32, 0x0ul, nullptr, 0x75f139fb0d7903ccul };
+TypeInfo * __type_info__e12aef54fd774c6f_arg_types_var_7344616642824276850[2] = { &__type_info__50b236c0c3679a07, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__65ed51ec56f68b72_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__e12aef54fd774c6f_arg_types_var_7344616642824276850, nullptr, 2, 0, nullptr, 28, 8, 0xe12aef54fd774c6ful, "__lambda", 0 };
+TypeInfo * __type_info__a9e56061de2d0066_arg_types_var_7344616642824276850[1] = { &__type_info__9a4e963311b57c01 };
+VarInfo __struct_info__65ed51ec56f68b72_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__a9e56061de2d0066_arg_types_var_7344616642824276850, nullptr, 1, 0, nullptr, 28, 8, 0xa9e56061de2d0066ul, "__finalize", 8 };
+VarInfo __struct_info__65ed51ec56f68b72_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0x77e7ffa41f717ebdul, "__yield", 16 };
+VarInfo __struct_info__65ed51ec56f68b72_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, 0x3e78f59c1fbe6088ul, "_loop_at_181", 20 };
+VarInfo __struct_info__65ed51ec56f68b72_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xcb259ce48e568726ul, "t", 24 };
+VarInfo __struct_info__65ed51ec56f68b72_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0x382698332f729f8cul, "_pvar_0_at_181", 32 };
+VarInfo __struct_info__65ed51ec56f68b72_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, 0xff5e71c03c28c7c8ul, "_source_0_at_181", 40 };
+VarInfo * __struct_info__65ed51ec56f68b72_fields[7] =  { &__struct_info__65ed51ec56f68b72_field_0, &__struct_info__65ed51ec56f68b72_field_1, &__struct_info__65ed51ec56f68b72_field_2, &__struct_info__65ed51ec56f68b72_field_3, &__struct_info__65ed51ec56f68b72_field_4, &__struct_info__65ed51ec56f68b72_field_5, &__struct_info__65ed51ec56f68b72_field_6 };
+StructInfo __struct_info__65ed51ec56f68b72 = {(char*)"_lambda_thismodule_181_8_14", (char*)"", 14, __struct_info__65ed51ec56f68b72_fields, 7, 48, 0x0ul, nullptr, 0x65ed51ec56f68b72ul };
+TypeInfo * __type_info__5d513e06601a43ef_arg_types_var_17471466171445901810[2] = { &__type_info__4eea7ba07c5b7fcb, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__f2771dea464979f2_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__5d513e06601a43ef_arg_types_var_17471466171445901810, nullptr, 2, 0, nullptr, 28, 8, 0x5d513e06601a43eful, "__lambda", 0 };
+TypeInfo * __type_info__f64f0a871abd23e6_arg_types_var_17471466171445901810[1] = { &__type_info__7fabd1653d932cd1 };
+VarInfo __struct_info__f2771dea464979f2_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__f64f0a871abd23e6_arg_types_var_17471466171445901810, nullptr, 1, 0, nullptr, 28, 8, 0xf64f0a871abd23e6ul, "__finalize", 8 };
+VarInfo __struct_info__f2771dea464979f2_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xc2b95991b2cbe93dul, "__yield", 16 };
+VarInfo __struct_info__f2771dea464979f2_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xe59bde0c0a7845a6ul, "t", 20 };
+VarInfo * __struct_info__f2771dea464979f2_fields[4] =  { &__struct_info__f2771dea464979f2_field_0, &__struct_info__f2771dea464979f2_field_1, &__struct_info__f2771dea464979f2_field_2, &__struct_info__f2771dea464979f2_field_3 };
+StructInfo __struct_info__f2771dea464979f2 = {(char*)"_lambda_thismodule_30_8_2", (char*)"", 6, __struct_info__f2771dea464979f2_fields, 4, 24, 0x0ul, nullptr, 0xf2771dea464979f2ul };
+TypeInfo * __type_info__80eac506cf901be5_arg_types_var_10709371593105698724[2] = { &__type_info__629ba791d8367189, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__949f54b926b96fa4_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__80eac506cf901be5_arg_types_var_10709371593105698724, nullptr, 2, 0, nullptr, 28, 8, 0x80eac506cf901be5ul, "__lambda", 0 };
+TypeInfo * __type_info__2ba69326662be71c_arg_types_var_10709371593105698724[1] = { &__type_info__60fec17896533777 };
+VarInfo __struct_info__949f54b926b96fa4_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__2ba69326662be71c_arg_types_var_10709371593105698724, nullptr, 1, 0, nullptr, 28, 8, 0x2ba69326662be71cul, "__finalize", 8 };
+VarInfo __struct_info__949f54b926b96fa4_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0x1375f3732f3db3d3ul, "__yield", 16 };
+VarInfo __struct_info__949f54b926b96fa4_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, 0x4454b3c68e7e3d83ul, "_loop_at_173", 20 };
+VarInfo __struct_info__949f54b926b96fa4_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xe35268b76f0ce2d3ul, "q", 24 };
+VarInfo __struct_info__949f54b926b96fa4_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0x2882ee8d5e44683bul, "_pvar_0_at_173", 32 };
+VarInfo __struct_info__949f54b926b96fa4_field_6 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, 0x8f398718c53253eaul, "___loop_at_174_rename_at_174", 40 };
+VarInfo __struct_info__949f54b926b96fa4_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0x28c600e6dc82e708ul, "__t_rename_at_174", 44 };
+VarInfo __struct_info__949f54b926b96fa4_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0x507c6ca2e3f2632eul, "___pvar_0_at_174_rename_at_174", 48 };
+VarInfo __struct_info__949f54b926b96fa4_field_9 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, 0xdc55c1985350c9fful, "_source_0_at_173", 56 };
+VarInfo __struct_info__949f54b926b96fa4_field_10 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, 0x3cbbc92b28f39f6aul, "___source_0_at_174_rename_at_174", 64 };
+VarInfo * __struct_info__949f54b926b96fa4_fields[11] =  { &__struct_info__949f54b926b96fa4_field_0, &__struct_info__949f54b926b96fa4_field_1, &__struct_info__949f54b926b96fa4_field_2, &__struct_info__949f54b926b96fa4_field_3, &__struct_info__949f54b926b96fa4_field_4, &__struct_info__949f54b926b96fa4_field_5, &__struct_info__949f54b926b96fa4_field_6, &__struct_info__949f54b926b96fa4_field_7, &__struct_info__949f54b926b96fa4_field_8, &__struct_info__949f54b926b96fa4_field_9, &__struct_info__949f54b926b96fa4_field_10 };
+StructInfo __struct_info__949f54b926b96fa4 = {(char*)"_lambda_thismodule_173_8_13", (char*)"", 14, __struct_info__949f54b926b96fa4_fields, 11, 72, 0x0ul, nullptr, 0x949f54b926b96fa4ul };
+TypeInfo * __type_info__be36668663a02368_arg_types_var_4080262707861125147[2] = { &__type_info__537b25dfc19dabc, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__38a001508c55f81b_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__be36668663a02368_arg_types_var_4080262707861125147, nullptr, 2, 0, nullptr, 28, 8, 0xbe36668663a02368ul, "__lambda", 0 };
+TypeInfo * __type_info__b9ad6d6341614dbd_arg_types_var_4080262707861125147[1] = { &__type_info__835f336e2f0d7022 };
+VarInfo __struct_info__38a001508c55f81b_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__b9ad6d6341614dbd_arg_types_var_4080262707861125147, nullptr, 1, 0, nullptr, 28, 8, 0xb9ad6d6341614dbdul, "__finalize", 8 };
+VarInfo __struct_info__38a001508c55f81b_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xd351fb8a10cd741cul, "__yield", 16 };
+VarInfo __struct_info__38a001508c55f81b_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, 0x7191b1646da6adf0ul, "_loop_at_148", 20 };
+VarInfo __struct_info__38a001508c55f81b_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xf7cea2a9fd9f363ful, "t", 24 };
+VarInfo __struct_info__38a001508c55f81b_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0x42f4f0b6a7d3d544ul, "_pvar_0_at_148", 32 };
+VarInfo __struct_info__38a001508c55f81b_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, 0x52c486f8e776d890ul, "_source_0_at_148", 40 };
+VarInfo * __struct_info__38a001508c55f81b_fields[7] =  { &__struct_info__38a001508c55f81b_field_0, &__struct_info__38a001508c55f81b_field_1, &__struct_info__38a001508c55f81b_field_2, &__struct_info__38a001508c55f81b_field_3, &__struct_info__38a001508c55f81b_field_4, &__struct_info__38a001508c55f81b_field_5, &__struct_info__38a001508c55f81b_field_6 };
+StructInfo __struct_info__38a001508c55f81b = {(char*)"_lambda_thismodule_148_8_10", (char*)"", 14, __struct_info__38a001508c55f81b_fields, 7, 48, 0x0ul, nullptr, 0x38a001508c55f81bul };
+TypeInfo * __type_info__5e1b83e01e51f41b_arg_types_var_8380354444161073950[2] = { &__type_info__693cc13c1ad65f7b, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__744cfff74816431e_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__5e1b83e01e51f41b_arg_types_var_8380354444161073950, nullptr, 2, 0, nullptr, 28, 8, 0x5e1b83e01e51f41bul, "__lambda", 0 };
+TypeInfo * __type_info__e005643f2e917a5a_arg_types_var_8380354444161073950[1] = { &__type_info__619cf07339b4f1e5 };
+VarInfo __struct_info__744cfff74816431e_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__e005643f2e917a5a_arg_types_var_8380354444161073950, nullptr, 1, 0, nullptr, 28, 8, 0xe005643f2e917a5aul, "__finalize", 8 };
+VarInfo __struct_info__744cfff74816431e_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xf7544dd0eb976731ul, "__yield", 16 };
+VarInfo __struct_info__744cfff74816431e_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, 0x83cdf89db057cca9ul, "_loop_at_155", 20 };
+VarInfo __struct_info__744cfff74816431e_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0x350aebb3e95713aul, "t", 24 };
+VarInfo __struct_info__744cfff74816431e_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0x136d82efc9d65b45ul, "_pvar_0_at_155", 32 };
+VarInfo __struct_info__744cfff74816431e_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, 0x5aebe73d2c07d221ul, "_source_0_at_155", 40 };
+VarInfo * __struct_info__744cfff74816431e_fields[7] =  { &__struct_info__744cfff74816431e_field_0, &__struct_info__744cfff74816431e_field_1, &__struct_info__744cfff74816431e_field_2, &__struct_info__744cfff74816431e_field_3, &__struct_info__744cfff74816431e_field_4, &__struct_info__744cfff74816431e_field_5, &__struct_info__744cfff74816431e_field_6 };
+StructInfo __struct_info__744cfff74816431e = {(char*)"_lambda_thismodule_155_8_11", (char*)"", 14, __struct_info__744cfff74816431e_fields, 7, 48, 0x0ul, nullptr, 0x744cfff74816431eul };
+TypeInfo * __type_info__b0ae5e129562a095_arg_types_var_10610835409156530740[2] = { &__type_info__97ba66ce6d6a80f1, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__9341429604e96234_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__b0ae5e129562a095_arg_types_var_10610835409156530740, nullptr, 2, 0, nullptr, 28, 8, 0xb0ae5e129562a095ul, "__lambda", 0 };
+TypeInfo * __type_info__16fb593f495a192c_arg_types_var_10610835409156530740[1] = { &__type_info__a8304d4f1d8e0373 };
+VarInfo __struct_info__9341429604e96234_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__16fb593f495a192c_arg_types_var_10610835409156530740, nullptr, 1, 0, nullptr, 28, 8, 0x16fb593f495a192cul, "__finalize", 8 };
+VarInfo __struct_info__9341429604e96234_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xebd2921657612ec3ul, "__yield", 16 };
+VarInfo __struct_info__9341429604e96234_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0x3599900724d243dcul, "t", 20 };
+VarInfo * __struct_info__9341429604e96234_fields[4] =  { &__struct_info__9341429604e96234_field_0, &__struct_info__9341429604e96234_field_1, &__struct_info__9341429604e96234_field_2, &__struct_info__9341429604e96234_field_3 };
+StructInfo __struct_info__9341429604e96234 = {(char*)"_lambda_thismodule_63_8_4", (char*)"", 6, __struct_info__9341429604e96234_fields, 4, 24, 0x0ul, nullptr, 0x9341429604e96234ul };
+TypeInfo * __type_info__c5217f9baab7aed1_arg_types_var_1627018282598803920[2] = { &__type_info__45ec1d4e6051a4db, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__16945481f95e29d0_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__c5217f9baab7aed1_arg_types_var_1627018282598803920, nullptr, 2, 0, nullptr, 28, 8, 0xc5217f9baab7aed1ul, "__lambda", 0 };
+TypeInfo * __type_info__8ec88cddbb365b40_arg_types_var_1627018282598803920[1] = { &__type_info__4ebea6b4cf76514b };
+VarInfo __struct_info__16945481f95e29d0_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__8ec88cddbb365b40_arg_types_var_1627018282598803920, nullptr, 1, 0, nullptr, 28, 8, 0x8ec88cddbb365b40ul, "__finalize", 8 };
+VarInfo __struct_info__16945481f95e29d0_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0x2e6508f2a73db957ul, "__yield", 16 };
+VarInfo __struct_info__16945481f95e29d0_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0x65cd145d6a6b3140ul, "t", 20 };
+VarInfo * __struct_info__16945481f95e29d0_fields[4] =  { &__struct_info__16945481f95e29d0_field_0, &__struct_info__16945481f95e29d0_field_1, &__struct_info__16945481f95e29d0_field_2, &__struct_info__16945481f95e29d0_field_3 };
+StructInfo __struct_info__16945481f95e29d0 = {(char*)"_lambda_thismodule_116_8_7", (char*)"", 6, __struct_info__16945481f95e29d0_fields, 4, 24, 0x0ul, nullptr, 0x16945481f95e29d0ul };
+TypeInfo * __type_info__fa41cbd0b133486_arg_types_var_14482124806792632509[2] = { &__type_info__2251a8dc8724191a, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__c8fad7c83dbf58bd_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__fa41cbd0b133486_arg_types_var_14482124806792632509, nullptr, 2, 0, nullptr, 28, 8, 0xfa41cbd0b133486ul, "__lambda", 0 };
+TypeInfo * __type_info__35fe67faa12e59f3_arg_types_var_14482124806792632509[1] = { &__type_info__8f17d7aae820031c };
+VarInfo __struct_info__c8fad7c83dbf58bd_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__35fe67faa12e59f3_arg_types_var_14482124806792632509, nullptr, 1, 0, nullptr, 28, 8, 0x35fe67faa12e59f3ul, "__finalize", 8 };
+VarInfo __struct_info__c8fad7c83dbf58bd_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0x93165a810179d952ul, "__yield", 16 };
+VarInfo __struct_info__c8fad7c83dbf58bd_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0x605300f10b3ce3ddul, "t", 20 };
+VarInfo * __struct_info__c8fad7c83dbf58bd_fields[4] =  { &__struct_info__c8fad7c83dbf58bd_field_0, &__struct_info__c8fad7c83dbf58bd_field_1, &__struct_info__c8fad7c83dbf58bd_field_2, &__struct_info__c8fad7c83dbf58bd_field_3 };
+StructInfo __struct_info__c8fad7c83dbf58bd = {(char*)"_lambda_thismodule_98_8_5", (char*)"", 6, __struct_info__c8fad7c83dbf58bd_fields, 4, 24, 0x0ul, nullptr, 0xc8fad7c83dbf58bdul };
+TypeInfo * __type_info__741cd4e8d637f3b7_arg_types_var_3897807664396683722[2] = { &__type_info__e798b9863673a07, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__3617cb6b5728c9ca_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__741cd4e8d637f3b7_arg_types_var_3897807664396683722, nullptr, 2, 0, nullptr, 28, 8, 0x741cd4e8d637f3b7ul, "__lambda", 0 };
+TypeInfo * __type_info__a0c02555dad29bfe_arg_types_var_3897807664396683722[1] = { &__type_info__d07e8c02ec880f09 };
+VarInfo __struct_info__3617cb6b5728c9ca_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__a0c02555dad29bfe_arg_types_var_3897807664396683722, nullptr, 1, 0, nullptr, 28, 8, 0xa0c02555dad29bfeul, "__finalize", 8 };
+VarInfo __struct_info__3617cb6b5728c9ca_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xa482259ef0b816a5ul, "__yield", 16 };
+VarInfo * __struct_info__3617cb6b5728c9ca_fields[3] =  { &__struct_info__3617cb6b5728c9ca_field_0, &__struct_info__3617cb6b5728c9ca_field_1, &__struct_info__3617cb6b5728c9ca_field_2 };
+StructInfo __struct_info__3617cb6b5728c9ca = {(char*)"_lambda_thismodule_15_8_1", (char*)"", 6, __struct_info__3617cb6b5728c9ca_fields, 3, 24, 0x0ul, nullptr, 0x3617cb6b5728c9caul };
+TypeInfo * __type_info__3233564b153ca1de_arg_types_var_1981939123992560581[2] = { &__type_info__6964d686464baf60, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__1b814321ec0683c5_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__3233564b153ca1de_arg_types_var_1981939123992560581, nullptr, 2, 0, nullptr, 28, 8, 0x3233564b153ca1deul, "__lambda", 0 };
+TypeInfo * __type_info__e4cacaa67806e55b_arg_types_var_1981939123992560581[1] = { &__type_info__ddc83c7879f95a70 };
+VarInfo __struct_info__1b814321ec0683c5_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__e4cacaa67806e55b_arg_types_var_1981939123992560581, nullptr, 1, 0, nullptr, 28, 8, 0xe4cacaa67806e55bul, "__finalize", 8 };
+VarInfo __struct_info__1b814321ec0683c5_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0x5da51341dd031aeaul, "__yield", 16 };
+VarInfo __struct_info__1b814321ec0683c5_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0x4aaf04a2f66ff306ul, "q", 20 };
+VarInfo __struct_info__1b814321ec0683c5_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xdde7bb13bc083fcbul, "__t_rename_at_129", 24 };
+VarInfo * __struct_info__1b814321ec0683c5_fields[5] =  { &__struct_info__1b814321ec0683c5_field_0, &__struct_info__1b814321ec0683c5_field_1, &__struct_info__1b814321ec0683c5_field_2, &__struct_info__1b814321ec0683c5_field_3, &__struct_info__1b814321ec0683c5_field_4 };
+StructInfo __struct_info__1b814321ec0683c5 = {(char*)"_lambda_thismodule_127_8_8", (char*)"", 6, __struct_info__1b814321ec0683c5_fields, 5, 32, 0x0ul, nullptr, 0x1b814321ec0683c5ul };
+TypeInfo * __type_info__fde840036eb62ecb_arg_types_var_17860393720541025902[2] = { &__type_info__ae9d40554f3d3b65, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__f7dcdd75dd77166e_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__fde840036eb62ecb_arg_types_var_17860393720541025902, nullptr, 2, 0, nullptr, 28, 8, 0xfde840036eb62ecbul, "__lambda", 0 };
+TypeInfo * __type_info__d88070e4f862592a_arg_types_var_17860393720541025902[1] = { &__type_info__13674d08c6ce3165 };
+VarInfo __struct_info__f7dcdd75dd77166e_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__d88070e4f862592a_arg_types_var_17860393720541025902, nullptr, 1, 0, nullptr, 28, 8, 0xd88070e4f862592aul, "__finalize", 8 };
+VarInfo __struct_info__f7dcdd75dd77166e_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0x938cd7f9d2a333e1ul, "__yield", 16 };
+VarInfo __struct_info__f7dcdd75dd77166e_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0x667dc26b501aa9aaul, "t", 20 };
+VarInfo * __struct_info__f7dcdd75dd77166e_fields[4] =  { &__struct_info__f7dcdd75dd77166e_field_0, &__struct_info__f7dcdd75dd77166e_field_1, &__struct_info__f7dcdd75dd77166e_field_2, &__struct_info__f7dcdd75dd77166e_field_3 };
+StructInfo __struct_info__f7dcdd75dd77166e = {(char*)"_lambda_thismodule_138_8_9", (char*)"", 6, __struct_info__f7dcdd75dd77166e_fields, 4, 24, 0x0ul, nullptr, 0xf7dcdd75dd77166eul };
+TypeInfo * __type_info__3ebe7744aae050e0_arg_types_var_13729920645873548227[2] = { &__type_info__e4a4f20d2e813a14, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__be8a7a154b983bc3_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__3ebe7744aae050e0_arg_types_var_13729920645873548227, nullptr, 2, 0, nullptr, 28, 8, 0x3ebe7744aae050e0ul, "__lambda", 0 };
+TypeInfo * __type_info__6e072023beef0ce5_arg_types_var_13729920645873548227[1] = { &__type_info__39a2907d380e7fa2 };
+VarInfo __struct_info__be8a7a154b983bc3_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__6e072023beef0ce5_arg_types_var_13729920645873548227, nullptr, 1, 0, nullptr, 28, 8, 0x6e072023beef0ce5ul, "__finalize", 8 };
+VarInfo __struct_info__be8a7a154b983bc3_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0x64143a34b5de1914ul, "__yield", 16 };
+VarInfo __struct_info__be8a7a154b983bc3_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, 0x6286c458145d39c6ul, "_loop_at_164", 20 };
+VarInfo __struct_info__be8a7a154b983bc3_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xbd21c9e92ca467ul, "t", 24 };
+VarInfo __struct_info__be8a7a154b983bc3_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0xd4012fbd833ac902ul, "_pvar_0_at_164", 32 };
+VarInfo __struct_info__be8a7a154b983bc3_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, 0xcaec65218d20d616ul, "_source_0_at_164", 40 };
+VarInfo * __struct_info__be8a7a154b983bc3_fields[7] =  { &__struct_info__be8a7a154b983bc3_field_0, &__struct_info__be8a7a154b983bc3_field_1, &__struct_info__be8a7a154b983bc3_field_2, &__struct_info__be8a7a154b983bc3_field_3, &__struct_info__be8a7a154b983bc3_field_4, &__struct_info__be8a7a154b983bc3_field_5, &__struct_info__be8a7a154b983bc3_field_6 };
+StructInfo __struct_info__be8a7a154b983bc3 = {(char*)"_lambda_thismodule_164_8_12", (char*)"", 14, __struct_info__be8a7a154b983bc3_fields, 7, 48, 0x0ul, nullptr, 0xbe8a7a154b983bc3ul };
+TypeInfo __type_info__4ebea6b4cf76514b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__45ec1d4e6051a4db, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0x4ebea6b4cf76514bul };
+TypeInfo __type_info__60fec17896533777 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__629ba791d8367189, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, 0x60fec17896533777ul };
+TypeInfo __type_info__8f17d7aae820031c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2251a8dc8724191a, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0x8f17d7aae820031cul };
+TypeInfo __type_info__90f4c07b5a6e390 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 1, 0x90f4c07b5a6e390ul };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xaf63e44c8601fa24ul };
+TypeInfo __type_info__7fabd1653d932cd1 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4eea7ba07c5b7fcb, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0x7fabd1653d932cd1ul };
+TypeInfo __type_info__574dbdb1dc587435 = { Type::tStructure, &__struct_info__75f139fb0d7903cc, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8206, 32, 0x574dbdb1dc587435ul };
+TypeInfo __type_info__45ec1d4e6051a4db = { Type::tStructure, &__struct_info__16945481f95e29d0, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 24, 0x45ec1d4e6051a4dbul };
+TypeInfo __type_info__13674d08c6ce3165 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__ae9d40554f3d3b65, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0x13674d08c6ce3165ul };
+TypeInfo __type_info__39a2907d380e7fa2 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__e4a4f20d2e813a14, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, 0x39a2907d380e7fa2ul };
+TypeInfo __type_info__d07e8c02ec880f09 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__e798b9863673a07, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0xd07e8c02ec880f09ul };
+TypeInfo __type_info__6964d686464baf60 = { Type::tStructure, &__struct_info__1b814321ec0683c5, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 32, 0x6964d686464baf60ul };
+TypeInfo __type_info__693cc13c1ad65f7b = { Type::tStructure, &__struct_info__744cfff74816431e, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 48, 0x693cc13c1ad65f7bul };
+TypeInfo __type_info__50b236c0c3679a07 = { Type::tStructure, &__struct_info__65ed51ec56f68b72, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 48, 0x50b236c0c3679a07ul };
+TypeInfo __type_info__e798b9863673a07 = { Type::tStructure, &__struct_info__3617cb6b5728c9ca, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 24, 0xe798b9863673a07ul };
+TypeInfo __type_info__ddc83c7879f95a70 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__6964d686464baf60, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0xddc83c7879f95a70ul };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, 0xaf63eb4c86020609ul };
+TypeInfo __type_info__537b25dfc19dabc = { Type::tStructure, &__struct_info__38a001508c55f81b, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 48, 0x537b25dfc19dabcul };
+TypeInfo __type_info__7bf5307b489d850 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 285, 4, 0x7bf5307b489d850ul };
+TypeInfo __type_info__1ee8c403a3b9eb3d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__babaed4061694eb9, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0x1ee8c403a3b9eb3dul };
+TypeInfo __type_info__ae9d40554f3d3b65 = { Type::tStructure, &__struct_info__f7dcdd75dd77166e, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 24, 0xae9d40554f3d3b65ul };
+TypeInfo __type_info__a8304d4f1d8e0373 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__97ba66ce6d6a80f1, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0xa8304d4f1d8e0373ul };
+TypeInfo __type_info__8579fec2120f02b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__574dbdb1dc587435, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0x8579fec2120f02bul };
+TypeInfo __type_info__835f336e2f0d7022 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__537b25dfc19dabc, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, 0x835f336e2f0d7022ul };
+TypeInfo __type_info__e4a4f20d2e813a14 = { Type::tStructure, &__struct_info__be8a7a154b983bc3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 48, 0xe4a4f20d2e813a14ul };
+TypeInfo __type_info__babaed4061694eb9 = { Type::tStructure, &__struct_info__445fc213758e745a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 24, 0xbabaed4061694eb9ul };
+TypeInfo __type_info__629ba791d8367189 = { Type::tStructure, &__struct_info__949f54b926b96fa4, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 72, 0x629ba791d8367189ul };
+TypeInfo __type_info__9a4e963311b57c01 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__50b236c0c3679a07, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, 0x9a4e963311b57c01ul };
+TypeInfo __type_info__619cf07339b4f1e5 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__693cc13c1ad65f7b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, 0x619cf07339b4f1e5ul };
+TypeInfo __type_info__97ba66ce6d6a80f1 = { Type::tStructure, &__struct_info__9341429604e96234, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 24, 0x97ba66ce6d6a80f1ul };
+TypeInfo __type_info__2251a8dc8724191a = { Type::tStructure, &__struct_info__c8fad7c83dbf58bd, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 24, 0x2251a8dc8724191aul };
+TypeInfo __type_info__4eea7ba07c5b7fcb = { Type::tStructure, &__struct_info__f2771dea464979f2, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 24, 0x4eea7ba07c5b7fcbul };
+
+namespace  { struct _lambda_thismodule_15_8_1; };
+namespace  { struct _lambda_thismodule_30_8_2; };
+namespace  { struct _lambda_thismodule_46_8_3; };
+namespace  { struct _lambda_thismodule_63_8_4; };
+namespace  { struct _lambda_thismodule_98_8_5; };
+namespace  { struct _lambda_thismodule_106_8_6; };
+namespace  { struct _lambda_thismodule_116_8_7; };
+namespace  { struct _lambda_thismodule_127_8_8; };
+namespace  { struct _lambda_thismodule_138_8_9; };
+namespace  { struct _lambda_thismodule_148_8_10; };
+namespace  { struct _lambda_thismodule_155_8_11; };
+namespace  { struct _lambda_thismodule_164_8_12; };
+namespace  { struct _lambda_thismodule_173_8_13; };
+namespace  { struct _lambda_thismodule_181_8_14; };
+namespace  {
+
+struct _lambda_thismodule_15_8_1 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_15_8_1,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_15_8_1 *)) __finalize;
+	int32_t __yield;
+};
+static_assert(sizeof(_lambda_thismodule_15_8_1)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_15_8_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_15_8_1,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_15_8_1,__yield)==16,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_30_8_2 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_30_8_2,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_30_8_2 *)) __finalize;
+	int32_t __yield;
+	int32_t t;
+};
+static_assert(sizeof(_lambda_thismodule_30_8_2)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_30_8_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_30_8_2,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_30_8_2,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_30_8_2,t)==20,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_46_8_3 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_46_8_3,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_46_8_3 *)) __finalize;
+	int32_t __yield;
+	int32_t t;
+	int32_t * T;
+};
+static_assert(sizeof(_lambda_thismodule_46_8_3)==32,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_8_3,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_8_3,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_8_3,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_8_3,t)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_8_3,T)==24,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_63_8_4 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_63_8_4,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_63_8_4 *)) __finalize;
+	int32_t __yield;
+	int32_t t;
+};
+static_assert(sizeof(_lambda_thismodule_63_8_4)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_63_8_4,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_63_8_4,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_63_8_4,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_63_8_4,t)==20,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_98_8_5 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_98_8_5,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_98_8_5 *)) __finalize;
+	int32_t __yield;
+	int32_t t;
+};
+static_assert(sizeof(_lambda_thismodule_98_8_5)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_98_8_5,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_98_8_5,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_98_8_5,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_98_8_5,t)==20,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_106_8_6 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_106_8_6,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_106_8_6 *)) __finalize;
+	int32_t __yield;
+	int32_t t;
+};
+static_assert(sizeof(_lambda_thismodule_106_8_6)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_106_8_6,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_106_8_6,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_106_8_6,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_106_8_6,t)==20,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_116_8_7 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_116_8_7,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_116_8_7 *)) __finalize;
+	int32_t __yield;
+	int32_t t;
+};
+static_assert(sizeof(_lambda_thismodule_116_8_7)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_116_8_7,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_116_8_7,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_116_8_7,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_116_8_7,t)==20,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_127_8_8 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_127_8_8,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_127_8_8 *)) __finalize;
+	int32_t __yield;
+	int32_t q;
+	int32_t __t_rename_at_129;
+};
+static_assert(sizeof(_lambda_thismodule_127_8_8)==32,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_127_8_8,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_127_8_8,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_127_8_8,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_127_8_8,q)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_127_8_8,__t_rename_at_129)==24,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_138_8_9 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_138_8_9,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_138_8_9 *)) __finalize;
+	int32_t __yield;
+	int32_t t;
+};
+static_assert(sizeof(_lambda_thismodule_138_8_9)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_138_8_9,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_138_8_9,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_138_8_9,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_138_8_9,t)==20,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_148_8_10 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_148_8_10,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_148_8_10 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_148;
+	int32_t t;
+	void * _pvar_0_at_148;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_148;
+};
+static_assert(sizeof(_lambda_thismodule_148_8_10)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_148_8_10,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_148_8_10,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_148_8_10,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_148_8_10,_loop_at_148)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_148_8_10,t)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_148_8_10,_pvar_0_at_148)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_148_8_10,_source_0_at_148)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_155_8_11 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_155_8_11,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_155_8_11 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_155;
+	int32_t t;
+	void * _pvar_0_at_155;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_155;
+};
+static_assert(sizeof(_lambda_thismodule_155_8_11)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_155_8_11,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_155_8_11,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_155_8_11,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_155_8_11,_loop_at_155)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_155_8_11,t)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_155_8_11,_pvar_0_at_155)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_155_8_11,_source_0_at_155)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_164_8_12 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_164_8_12,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_164_8_12 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_164;
+	int32_t t;
+	void * _pvar_0_at_164;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_164;
+};
+static_assert(sizeof(_lambda_thismodule_164_8_12)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_164_8_12,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_164_8_12,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_164_8_12,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_164_8_12,_loop_at_164)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_164_8_12,t)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_164_8_12,_pvar_0_at_164)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_164_8_12,_source_0_at_164)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_173_8_13 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_173_8_13,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_173_8_13 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_173;
+	int32_t q;
+	void * _pvar_0_at_173;
+	bool ___loop_at_174_rename_at_174;
+	int32_t __t_rename_at_174;
+	void * ___pvar_0_at_174_rename_at_174;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_173;
+	Sequence DAS_COMMENT((int32_t)) ___source_0_at_174_rename_at_174;
+};
+static_assert(sizeof(_lambda_thismodule_173_8_13)==72,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_173_8_13,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_173_8_13,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_173_8_13,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_173_8_13,_loop_at_173)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_173_8_13,q)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_173_8_13,_pvar_0_at_173)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_173_8_13,___loop_at_174_rename_at_174)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_173_8_13,__t_rename_at_174)==44,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_173_8_13,___pvar_0_at_174_rename_at_174)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_173_8_13,_source_0_at_173)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_173_8_13,___source_0_at_174_rename_at_174)==64,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_181_8_14 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_181_8_14,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_181_8_14 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_181;
+	int32_t t;
+	void * _pvar_0_at_181;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_181;
+};
+static_assert(sizeof(_lambda_thismodule_181_8_14)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_181_8_14,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_181_8_14,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_181_8_14,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_181_8_14,_loop_at_181)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_181_8_14,t)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_181_8_14,_pvar_0_at_181)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_181_8_14,_source_0_at_181)==40,"structure field offset mismatch with DAS");
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_5cbab1dfe9635bc1 ( Context * __context__, range __rng_rename_at_345 );
+inline void finalize_5b02563dafedbee6 ( Context * __context__, _lambda_thismodule_15_8_1 & ____this_rename_at_15 );
+inline void finalize_6171d14823a8b21e ( Context * __context__, _lambda_thismodule_30_8_2 & ____this_rename_at_30 );
+inline void finalize_2db4ad5f85e220c8 ( Context * __context__, _lambda_thismodule_46_8_3 & ____this_rename_at_46 );
+inline void finalize_8ef7a7ac80228b08 ( Context * __context__, _lambda_thismodule_63_8_4 & ____this_rename_at_63 );
+inline void finalize_7eb7534262aa1943 ( Context * __context__, _lambda_thismodule_98_8_5 & ____this_rename_at_98 );
+inline void finalize_39c09eeb94608282 ( Context * __context__, _lambda_thismodule_106_8_6 & ____this_rename_at_106 );
+inline void finalize_facd51879497e70 ( Context * __context__, _lambda_thismodule_116_8_7 & ____this_rename_at_116 );
+inline void finalize_ce3c90fc305251a7 ( Context * __context__, _lambda_thismodule_127_8_8 & ____this_rename_at_127 );
+inline void finalize_2cdc25d288d5bdba ( Context * __context__, _lambda_thismodule_138_8_9 & ____this_rename_at_138 );
+inline void finalize_ffee4bfb0ce3b1cd ( Context * __context__, _lambda_thismodule_148_8_10 & ____this_rename_at_148 );
+inline void finalize_374c0be22d6b54f4 ( Context * __context__, _lambda_thismodule_155_8_11 & ____this_rename_at_155 );
+inline void finalize_e02182ac8e0f274d ( Context * __context__, _lambda_thismodule_164_8_12 & ____this_rename_at_164 );
+inline void finalize_ef50215be3055b3d ( Context * __context__, _lambda_thismodule_173_8_13 & ____this_rename_at_173 );
+inline void finalize_64989e0124a0a430 ( Context * __context__, _lambda_thismodule_181_8_14 & ____this_rename_at_181 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_e06f3606db6c5381 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_374 );
+inline bool _Func_lambda_thismodule_15_8_1_0x60_function_27d3ba381b259179 ( Context * __context__, _lambda_thismodule_15_8_1 & ____this_rename_at_15, int32_t & ___yield_15_rename_at_15 );
+inline void _Func_lambda_thismodule_15_8_1_0x60_finalizer_9e266614028e3bee ( Context * __context__, _lambda_thismodule_15_8_1 * ____this_rename_at_15 );
+inline bool _Func_lambda_thismodule_30_8_2_0x60_function_7f05d78a4e483572 ( Context * __context__, _lambda_thismodule_30_8_2 & ____this_rename_at_30, int32_t & ___yield_30_rename_at_30 );
+inline void _Func_lambda_thismodule_30_8_2_0x60_finalizer_d374a95ec3bf83f2 ( Context * __context__, _lambda_thismodule_30_8_2 * ____this_rename_at_30 );
+inline bool _Func_lambda_thismodule_46_8_3_0x60_function_69539e62cb957148 ( Context * __context__, _lambda_thismodule_46_8_3 & ____this_rename_at_46, int32_t & ___yield_46_rename_at_46 );
+inline void _Func_lambda_thismodule_46_8_3_0x60_finalizer_ae8c54a162875a36 ( Context * __context__, _lambda_thismodule_46_8_3 * ____this_rename_at_46 );
+inline bool _Func_lambda_thismodule_63_8_4_0x60_function_aa2d22de5ea30b83 ( Context * __context__, _lambda_thismodule_63_8_4 & ____this_rename_at_63, int32_t & ___yield_63_rename_at_63 );
+inline void _Func_lambda_thismodule_63_8_4_0x60_finalizer_8b265ca3b3942d7a ( Context * __context__, _lambda_thismodule_63_8_4 * ____this_rename_at_63 );
+inline bool _Func_lambda_thismodule_98_8_5_0x60_function_1ec687004213b05d ( Context * __context__, _lambda_thismodule_98_8_5 & ____this_rename_at_98, int32_t & ___yield_98_rename_at_98 );
+inline void _Func_lambda_thismodule_98_8_5_0x60_finalizer_ef68934b82e4af12 ( Context * __context__, _lambda_thismodule_98_8_5 * ____this_rename_at_98 );
+inline bool _Func_lambda_thismodule_106_8_6_0x60_function_a80958c8871f25c9 ( Context * __context__, _lambda_thismodule_106_8_6 & ____this_rename_at_106, int32_t & ___yield_106_rename_at_106 );
+inline void _Func_lambda_thismodule_106_8_6_0x60_finalizer_f15cd56f71576e64 ( Context * __context__, _lambda_thismodule_106_8_6 * ____this_rename_at_106 );
+inline bool _Func_lambda_thismodule_116_8_7_0x60_function_b9140608d57ed540 ( Context * __context__, _lambda_thismodule_116_8_7 & ____this_rename_at_116, int32_t & ___yield_116_rename_at_116 );
+inline void _Func_lambda_thismodule_116_8_7_0x60_finalizer_feab25e2b4471e58 ( Context * __context__, _lambda_thismodule_116_8_7 * ____this_rename_at_116 );
+inline bool _Func_lambda_thismodule_127_8_8_0x60_function_a69a16180055437 ( Context * __context__, _lambda_thismodule_127_8_8 & ____this_rename_at_127, int32_t & ___yield_127_rename_at_127 );
+inline void _Func_lambda_thismodule_127_8_8_0x60_finalizer_df8b07997fada04a ( Context * __context__, _lambda_thismodule_127_8_8 * ____this_rename_at_127 );
+inline bool _Func_lambda_thismodule_138_8_9_0x60_function_bfe086350c0a3405 ( Context * __context__, _lambda_thismodule_138_8_9 & ____this_rename_at_138, int32_t & ___yield_138_rename_at_138 );
+inline void _Func_lambda_thismodule_138_8_9_0x60_finalizer_1d6b783a905b2418 ( Context * __context__, _lambda_thismodule_138_8_9 * ____this_rename_at_138 );
+inline bool _Func_lambda_thismodule_148_8_10_0x60_function_d52c21408a6fadc3 ( Context * __context__, _lambda_thismodule_148_8_10 & ____this_rename_at_148, int32_t & ___yield_148_rename_at_148 );
+inline void _Func_lambda_thismodule_148_8_10_0x60_finalizer_f7641aeadc01ff4c ( Context * __context__, _lambda_thismodule_148_8_10 * ____this_rename_at_148 );
+inline bool _Func_lambda_thismodule_155_8_11_0x60_function_f4b1236830d201c5 ( Context * __context__, _lambda_thismodule_155_8_11 & ____this_rename_at_155, int32_t & ___yield_155_rename_at_155 );
+inline void _Func_lambda_thismodule_155_8_11_0x60_finalizer_4d1bc51cd2ab5ca8 ( Context * __context__, _lambda_thismodule_155_8_11 * ____this_rename_at_155 );
+inline bool _Func_lambda_thismodule_164_8_12_0x60_function_19007db58da6b4fc ( Context * __context__, _lambda_thismodule_164_8_12 & ____this_rename_at_164, int32_t & ___yield_164_rename_at_164 );
+inline void _Func_lambda_thismodule_164_8_12_0x60_finalizer_6dc71dd77f6c40e4 ( Context * __context__, _lambda_thismodule_164_8_12 * ____this_rename_at_164 );
+inline bool _Func_lambda_thismodule_173_8_13_0x60_function_933bb4552c02a48f ( Context * __context__, _lambda_thismodule_173_8_13 & ____this_rename_at_173, int32_t & ___yield_173_rename_at_173 );
+inline void _Func_lambda_thismodule_173_8_13_0x60_finalizer_9ed93911dd3fad90 ( Context * __context__, _lambda_thismodule_173_8_13 * ____this_rename_at_173 );
+inline bool _Func_lambda_thismodule_181_8_14_0x60_function_751009d83b403c93 ( Context * __context__, _lambda_thismodule_181_8_14 & ____this_rename_at_181, int32_t & ___yield_181_rename_at_181 );
+inline void _Func_lambda_thismodule_181_8_14_0x60_finalizer_805eac3b4d3687c0 ( Context * __context__, _lambda_thismodule_181_8_14 * ____this_rename_at_181 );
+inline void checkIt_b77b2cf6f5613cc5 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __gen_rename_at_2 );
+inline void test_yield_43bf5d7d8b5c310f ( Context * __context__ );
+inline void test_local_c97ca04425182266 ( Context * __context__ );
+inline void test_local_ref_4ca5ac966d19e4c4 ( Context * __context__ );
+inline void test_if_4b2334d19cdbfc63 ( Context * __context__ );
+inline void test_while_207168d1bc64b6ff ( Context * __context__ );
+inline void test_while_break_c4f7dfad9b875d56 ( Context * __context__ );
+inline void test_while_continue_75c0e4a995a2673d ( Context * __context__ );
+inline void test_while_nested_8836704f64262b28 ( Context * __context__ );
+inline void test_while_finally_1f53f1e10cf6e7f1 ( Context * __context__ );
+inline void test_for_3d4014c593e25361 ( Context * __context__ );
+inline void test_for_break_cca2bc3cb5da05c1 ( Context * __context__ );
+inline void test_for_continue_53de54f968be3ee6 ( Context * __context__ );
+inline void test_for_nested_935ae4a50d073e48 ( Context * __context__ );
+inline void test_for_finally_67c0d997405975ab ( Context * __context__ );
+inline bool test_3923557ae2b0401c ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_5cbab1dfe9635bc1 ( Context * __context__, range __rng_rename_at_345 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_346; das_zero(__it_rename_at_346);
+	builtin_make_range_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_346),__rng_rename_at_345,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_346);
+}
+
+inline void finalize_5b02563dafedbee6 ( Context * __context__, _lambda_thismodule_15_8_1 &  ____this_rename_at_15 )
+{
+	memset(&(____this_rename_at_15), 0, 24);
+}
+
+inline void finalize_6171d14823a8b21e ( Context * __context__, _lambda_thismodule_30_8_2 &  ____this_rename_at_30 )
+{
+	memset(&(____this_rename_at_30), 0, 24);
+}
+
+inline void finalize_2db4ad5f85e220c8 ( Context * __context__, _lambda_thismodule_46_8_3 &  ____this_rename_at_46 )
+{
+	memset(&(____this_rename_at_46), 0, 32);
+}
+
+inline void finalize_8ef7a7ac80228b08 ( Context * __context__, _lambda_thismodule_63_8_4 &  ____this_rename_at_63 )
+{
+	memset(&(____this_rename_at_63), 0, 24);
+}
+
+inline void finalize_7eb7534262aa1943 ( Context * __context__, _lambda_thismodule_98_8_5 &  ____this_rename_at_98 )
+{
+	memset(&(____this_rename_at_98), 0, 24);
+}
+
+inline void finalize_39c09eeb94608282 ( Context * __context__, _lambda_thismodule_106_8_6 &  ____this_rename_at_106 )
+{
+	memset(&(____this_rename_at_106), 0, 24);
+}
+
+inline void finalize_facd51879497e70 ( Context * __context__, _lambda_thismodule_116_8_7 &  ____this_rename_at_116 )
+{
+	memset(&(____this_rename_at_116), 0, 24);
+}
+
+inline void finalize_ce3c90fc305251a7 ( Context * __context__, _lambda_thismodule_127_8_8 &  ____this_rename_at_127 )
+{
+	memset(&(____this_rename_at_127), 0, 32);
+}
+
+inline void finalize_2cdc25d288d5bdba ( Context * __context__, _lambda_thismodule_138_8_9 &  ____this_rename_at_138 )
+{
+	memset(&(____this_rename_at_138), 0, 24);
+}
+
+inline void finalize_ffee4bfb0ce3b1cd ( Context * __context__, _lambda_thismodule_148_8_10 &  ____this_rename_at_148 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_148._source_0_at_148),__context__);
+	memset(&(____this_rename_at_148), 0, 48);
+}
+
+inline void finalize_374c0be22d6b54f4 ( Context * __context__, _lambda_thismodule_155_8_11 &  ____this_rename_at_155 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_155._source_0_at_155),__context__);
+	memset(&(____this_rename_at_155), 0, 48);
+}
+
+inline void finalize_e02182ac8e0f274d ( Context * __context__, _lambda_thismodule_164_8_12 &  ____this_rename_at_164 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_164._source_0_at_164),__context__);
+	memset(&(____this_rename_at_164), 0, 48);
+}
+
+inline void finalize_ef50215be3055b3d ( Context * __context__, _lambda_thismodule_173_8_13 &  ____this_rename_at_173 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_173._source_0_at_173),__context__);
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_173.___source_0_at_174_rename_at_174),__context__);
+	memset(&(____this_rename_at_173), 0, 72);
+}
+
+inline void finalize_64989e0124a0a430 ( Context * __context__, _lambda_thismodule_181_8_14 &  ____this_rename_at_181 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_181._source_0_at_181),__context__);
+	memset(&(____this_rename_at_181), 0, 48);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_e06f3606db6c5381 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_374 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_376; das_zero(__it_rename_at_376);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_376),__lam_rename_at_374,4,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_376);
+}
+
+inline bool _Func_lambda_thismodule_15_8_1_0x60_function_27d3ba381b259179 ( Context * __context__, _lambda_thismodule_15_8_1 &  ____this_rename_at_15, int32_t & ___yield_15_rename_at_15 )
+{
+	switch (____this_rename_at_15.__yield) {
+	case 0: goto label_0;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	case 6: goto label_6;
+	case 7: goto label_7;
+	case 8: goto label_8;
+	case 9: goto label_9;
+	case 10: goto label_10;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(___yield_15_rename_at_15,0);
+	das_copy(____this_rename_at_15.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	das_copy(___yield_15_rename_at_15,1);
+	das_copy(____this_rename_at_15.__yield,2);
+	return das_auto_cast<bool>::cast(true);
+	label_2:;;
+	das_copy(___yield_15_rename_at_15,2);
+	das_copy(____this_rename_at_15.__yield,3);
+	return das_auto_cast<bool>::cast(true);
+	label_3:;;
+	das_copy(___yield_15_rename_at_15,3);
+	das_copy(____this_rename_at_15.__yield,4);
+	return das_auto_cast<bool>::cast(true);
+	label_4:;;
+	das_copy(___yield_15_rename_at_15,4);
+	das_copy(____this_rename_at_15.__yield,5);
+	return das_auto_cast<bool>::cast(true);
+	label_5:;;
+	das_copy(___yield_15_rename_at_15,5);
+	das_copy(____this_rename_at_15.__yield,6);
+	return das_auto_cast<bool>::cast(true);
+	label_6:;;
+	das_copy(___yield_15_rename_at_15,6);
+	das_copy(____this_rename_at_15.__yield,7);
+	return das_auto_cast<bool>::cast(true);
+	label_7:;;
+	das_copy(___yield_15_rename_at_15,7);
+	das_copy(____this_rename_at_15.__yield,8);
+	return das_auto_cast<bool>::cast(true);
+	label_8:;;
+	das_copy(___yield_15_rename_at_15,8);
+	das_copy(____this_rename_at_15.__yield,9);
+	return das_auto_cast<bool>::cast(true);
+	label_9:;;
+	das_copy(___yield_15_rename_at_15,9);
+	das_copy(____this_rename_at_15.__yield,10);
+	return das_auto_cast<bool>::cast(true);
+	label_10:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_15_8_1_0x60_finalizer_9e266614028e3bee ( Context * __context__, _lambda_thismodule_15_8_1 * ____this_rename_at_15 )
+{
+	finalize_5b02563dafedbee6(__context__,das_arg<_lambda_thismodule_15_8_1>::pass(das_deref(__context__,____this_rename_at_15)));
+	das_delete_lambda_struct<_lambda_thismodule_15_8_1 *>::clear(__context__,____this_rename_at_15);
+}
+
+inline bool _Func_lambda_thismodule_30_8_2_0x60_function_7f05d78a4e483572 ( Context * __context__, _lambda_thismodule_30_8_2 &  ____this_rename_at_30, int32_t & ___yield_30_rename_at_30 )
+{
+	switch (____this_rename_at_30.__yield) {
+	case 0: goto label_0;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	case 6: goto label_6;
+	case 7: goto label_7;
+	case 8: goto label_8;
+	case 9: goto label_9;
+	case 10: goto label_10;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_30.t,0);
+	das_copy(___yield_30_rename_at_30,____this_rename_at_30.t++);
+	das_copy(____this_rename_at_30.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	das_copy(___yield_30_rename_at_30,____this_rename_at_30.t++);
+	das_copy(____this_rename_at_30.__yield,2);
+	return das_auto_cast<bool>::cast(true);
+	label_2:;;
+	das_copy(___yield_30_rename_at_30,____this_rename_at_30.t++);
+	das_copy(____this_rename_at_30.__yield,3);
+	return das_auto_cast<bool>::cast(true);
+	label_3:;;
+	das_copy(___yield_30_rename_at_30,____this_rename_at_30.t++);
+	das_copy(____this_rename_at_30.__yield,4);
+	return das_auto_cast<bool>::cast(true);
+	label_4:;;
+	das_copy(___yield_30_rename_at_30,____this_rename_at_30.t++);
+	das_copy(____this_rename_at_30.__yield,5);
+	return das_auto_cast<bool>::cast(true);
+	label_5:;;
+	das_copy(___yield_30_rename_at_30,____this_rename_at_30.t++);
+	das_copy(____this_rename_at_30.__yield,6);
+	return das_auto_cast<bool>::cast(true);
+	label_6:;;
+	das_copy(___yield_30_rename_at_30,____this_rename_at_30.t++);
+	das_copy(____this_rename_at_30.__yield,7);
+	return das_auto_cast<bool>::cast(true);
+	label_7:;;
+	das_copy(___yield_30_rename_at_30,____this_rename_at_30.t++);
+	das_copy(____this_rename_at_30.__yield,8);
+	return das_auto_cast<bool>::cast(true);
+	label_8:;;
+	das_copy(___yield_30_rename_at_30,____this_rename_at_30.t++);
+	das_copy(____this_rename_at_30.__yield,9);
+	return das_auto_cast<bool>::cast(true);
+	label_9:;;
+	das_copy(___yield_30_rename_at_30,____this_rename_at_30.t++);
+	das_copy(____this_rename_at_30.__yield,10);
+	return das_auto_cast<bool>::cast(true);
+	label_10:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_30_8_2_0x60_finalizer_d374a95ec3bf83f2 ( Context * __context__, _lambda_thismodule_30_8_2 * ____this_rename_at_30 )
+{
+	finalize_6171d14823a8b21e(__context__,das_arg<_lambda_thismodule_30_8_2>::pass(das_deref(__context__,____this_rename_at_30)));
+	das_delete_lambda_struct<_lambda_thismodule_30_8_2 *>::clear(__context__,____this_rename_at_30);
+}
+
+inline bool _Func_lambda_thismodule_46_8_3_0x60_function_69539e62cb957148 ( Context * __context__, _lambda_thismodule_46_8_3 &  ____this_rename_at_46, int32_t & ___yield_46_rename_at_46 )
+{
+	switch (____this_rename_at_46.__yield) {
+	case 0: goto label_0;
+	case 1: goto label_1;
+	case 6: goto label_6;
+	case 2: goto label_2;
+	case 7: goto label_7;
+	case 3: goto label_3;
+	case 8: goto label_8;
+	case 4: goto label_4;
+	case 9: goto label_9;
+	case 5: goto label_5;
+	case 10: goto label_10;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_46.t,0);
+	das_copy(____this_rename_at_46.T,das_ref(__context__,____this_rename_at_46.t));
+	das_copy(___yield_46_rename_at_46,____this_rename_at_46.t++);
+	das_copy(____this_rename_at_46.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	das_copy(___yield_46_rename_at_46,das_deref(__context__,____this_rename_at_46.T)++);
+	das_copy(____this_rename_at_46.__yield,6);
+	return das_auto_cast<bool>::cast(true);
+	label_6:;;
+	das_copy(___yield_46_rename_at_46,____this_rename_at_46.t++);
+	das_copy(____this_rename_at_46.__yield,2);
+	return das_auto_cast<bool>::cast(true);
+	label_2:;;
+	das_copy(___yield_46_rename_at_46,das_deref(__context__,____this_rename_at_46.T)++);
+	das_copy(____this_rename_at_46.__yield,7);
+	return das_auto_cast<bool>::cast(true);
+	label_7:;;
+	das_copy(___yield_46_rename_at_46,____this_rename_at_46.t++);
+	das_copy(____this_rename_at_46.__yield,3);
+	return das_auto_cast<bool>::cast(true);
+	label_3:;;
+	das_copy(___yield_46_rename_at_46,das_deref(__context__,____this_rename_at_46.T)++);
+	das_copy(____this_rename_at_46.__yield,8);
+	return das_auto_cast<bool>::cast(true);
+	label_8:;;
+	das_copy(___yield_46_rename_at_46,____this_rename_at_46.t++);
+	das_copy(____this_rename_at_46.__yield,4);
+	return das_auto_cast<bool>::cast(true);
+	label_4:;;
+	das_copy(___yield_46_rename_at_46,das_deref(__context__,____this_rename_at_46.T)++);
+	das_copy(____this_rename_at_46.__yield,9);
+	return das_auto_cast<bool>::cast(true);
+	label_9:;;
+	das_copy(___yield_46_rename_at_46,____this_rename_at_46.t++);
+	das_copy(____this_rename_at_46.__yield,5);
+	return das_auto_cast<bool>::cast(true);
+	label_5:;;
+	das_copy(___yield_46_rename_at_46,das_deref(__context__,____this_rename_at_46.T)++);
+	das_copy(____this_rename_at_46.__yield,10);
+	return das_auto_cast<bool>::cast(true);
+	label_10:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_46_8_3_0x60_finalizer_ae8c54a162875a36 ( Context * __context__, _lambda_thismodule_46_8_3 * ____this_rename_at_46 )
+{
+	finalize_2db4ad5f85e220c8(__context__,das_arg<_lambda_thismodule_46_8_3>::pass(das_deref(__context__,____this_rename_at_46)));
+	das_delete_lambda_struct<_lambda_thismodule_46_8_3 *>::clear(__context__,____this_rename_at_46);
+}
+
+inline bool _Func_lambda_thismodule_63_8_4_0x60_function_aa2d22de5ea30b83 ( Context * __context__, _lambda_thismodule_63_8_4 &  ____this_rename_at_63, int32_t & ___yield_63_rename_at_63 )
+{
+	switch (____this_rename_at_63.__yield) {
+	case 0: goto label_0;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	case 6: goto label_6;
+	case 5: goto label_5;
+	case 7: goto label_7;
+	case 8: goto label_8;
+	case 10: goto label_10;
+	case 9: goto label_9;
+	case 11: goto label_11;
+	case 13: goto label_13;
+	case 12: goto label_12;
+	case 14: goto label_14;
+	case 15: goto label_15;
+	case 20: goto label_20;
+	case 16: goto label_16;
+	case 18: goto label_18;
+	case 17: goto label_17;
+	case 19: goto label_19;
+	case 21: goto label_21;
+	case 22: goto label_22;
+	case 23: goto label_23;
+	case 24: goto label_24;
+	case 25: goto label_25;
+	case 26: goto label_26;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_63.t,0);
+	das_copy(___yield_63_rename_at_63,____this_rename_at_63.t++);
+	das_copy(____this_rename_at_63.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	if ( !(____this_rename_at_63.t == 1) )
+	{
+		goto label_3;
+	};
+	das_copy(___yield_63_rename_at_63,____this_rename_at_63.t++);
+	das_copy(____this_rename_at_63.__yield,2);
+	return das_auto_cast<bool>::cast(true);
+	label_2:;;
+	label_3:;;
+	if ( !(____this_rename_at_63.t == 2) )
+	{
+		goto label_6;
+	};
+	das_copy(___yield_63_rename_at_63,____this_rename_at_63.t++);
+	das_copy(____this_rename_at_63.__yield,4);
+	return das_auto_cast<bool>::cast(true);
+	label_4:;;
+	goto label_7;
+	label_6:;;
+	das_copy(___yield_63_rename_at_63,13);
+	das_copy(____this_rename_at_63.__yield,5);
+	return das_auto_cast<bool>::cast(true);
+	label_5:;;
+	label_7:;;
+	if ( !(____this_rename_at_63.t == 3) )
+	{
+		goto label_13;
+	};
+	if ( !(____this_rename_at_63.t < 10) )
+	{
+		goto label_10;
+	};
+	das_copy(___yield_63_rename_at_63,____this_rename_at_63.t++);
+	das_copy(____this_rename_at_63.__yield,8);
+	return das_auto_cast<bool>::cast(true);
+	label_8:;;
+	goto label_11;
+	label_10:;;
+	das_copy(___yield_63_rename_at_63,13);
+	das_copy(____this_rename_at_63.__yield,9);
+	return das_auto_cast<bool>::cast(true);
+	label_9:;;
+	label_11:;;
+	goto label_14;
+	label_13:;;
+	das_copy(___yield_63_rename_at_63,12);
+	das_copy(____this_rename_at_63.__yield,12);
+	return das_auto_cast<bool>::cast(true);
+	label_12:;;
+	label_14:;;
+	if ( !(____this_rename_at_63.t == 13) )
+	{
+		goto label_20;
+	};
+	das_copy(___yield_63_rename_at_63,0);
+	das_copy(____this_rename_at_63.__yield,15);
+	return das_auto_cast<bool>::cast(true);
+	label_15:;;
+	goto label_21;
+	label_20:;;
+	if ( !(____this_rename_at_63.t == 4) )
+	{
+		goto label_18;
+	};
+	das_copy(___yield_63_rename_at_63,____this_rename_at_63.t++);
+	das_copy(____this_rename_at_63.__yield,16);
+	return das_auto_cast<bool>::cast(true);
+	label_16:;;
+	goto label_19;
+	label_18:;;
+	das_copy(___yield_63_rename_at_63,-1);
+	das_copy(____this_rename_at_63.__yield,17);
+	return das_auto_cast<bool>::cast(true);
+	label_17:;;
+	label_19:;;
+	label_21:;;
+	das_copy(___yield_63_rename_at_63,____this_rename_at_63.t++);
+	das_copy(____this_rename_at_63.__yield,22);
+	return das_auto_cast<bool>::cast(true);
+	label_22:;;
+	das_copy(___yield_63_rename_at_63,____this_rename_at_63.t++);
+	das_copy(____this_rename_at_63.__yield,23);
+	return das_auto_cast<bool>::cast(true);
+	label_23:;;
+	das_copy(___yield_63_rename_at_63,____this_rename_at_63.t++);
+	das_copy(____this_rename_at_63.__yield,24);
+	return das_auto_cast<bool>::cast(true);
+	label_24:;;
+	das_copy(___yield_63_rename_at_63,____this_rename_at_63.t++);
+	das_copy(____this_rename_at_63.__yield,25);
+	return das_auto_cast<bool>::cast(true);
+	label_25:;;
+	das_copy(___yield_63_rename_at_63,____this_rename_at_63.t++);
+	das_copy(____this_rename_at_63.__yield,26);
+	return das_auto_cast<bool>::cast(true);
+	label_26:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_63_8_4_0x60_finalizer_8b265ca3b3942d7a ( Context * __context__, _lambda_thismodule_63_8_4 * ____this_rename_at_63 )
+{
+	finalize_8ef7a7ac80228b08(__context__,das_arg<_lambda_thismodule_63_8_4>::pass(das_deref(__context__,____this_rename_at_63)));
+	das_delete_lambda_struct<_lambda_thismodule_63_8_4 *>::clear(__context__,____this_rename_at_63);
+}
+
+inline bool _Func_lambda_thismodule_98_8_5_0x60_function_1ec687004213b05d ( Context * __context__, _lambda_thismodule_98_8_5 &  ____this_rename_at_98, int32_t & ___yield_98_rename_at_98 )
+{
+	switch (____this_rename_at_98.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_98.t,0);
+	label_2:;;
+	if ( !(____this_rename_at_98.t < 10) )
+	{
+		goto label_3;
+	};
+	das_copy(___yield_98_rename_at_98,____this_rename_at_98.t++);
+	das_copy(____this_rename_at_98.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	goto label_2;
+	label_3:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_98_8_5_0x60_finalizer_ef68934b82e4af12 ( Context * __context__, _lambda_thismodule_98_8_5 * ____this_rename_at_98 )
+{
+	finalize_7eb7534262aa1943(__context__,das_arg<_lambda_thismodule_98_8_5>::pass(das_deref(__context__,____this_rename_at_98)));
+	das_delete_lambda_struct<_lambda_thismodule_98_8_5 *>::clear(__context__,____this_rename_at_98);
+}
+
+inline bool _Func_lambda_thismodule_106_8_6_0x60_function_a80958c8871f25c9 ( Context * __context__, _lambda_thismodule_106_8_6 &  ____this_rename_at_106, int32_t & ___yield_106_rename_at_106 )
+{
+	switch (____this_rename_at_106.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_106.t,0);
+	label_2:;;
+	if ( !(____this_rename_at_106.t < 100) )
+	{
+		goto label_3;
+	};
+	if ( ____this_rename_at_106.t == 10 )
+	{
+		goto label_3;
+	};
+	das_copy(___yield_106_rename_at_106,____this_rename_at_106.t++);
+	das_copy(____this_rename_at_106.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	goto label_2;
+	label_3:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_106_8_6_0x60_finalizer_f15cd56f71576e64 ( Context * __context__, _lambda_thismodule_106_8_6 * ____this_rename_at_106 )
+{
+	finalize_39c09eeb94608282(__context__,das_arg<_lambda_thismodule_106_8_6>::pass(das_deref(__context__,____this_rename_at_106)));
+	das_delete_lambda_struct<_lambda_thismodule_106_8_6 *>::clear(__context__,____this_rename_at_106);
+}
+
+inline bool _Func_lambda_thismodule_116_8_7_0x60_function_b9140608d57ed540 ( Context * __context__, _lambda_thismodule_116_8_7 &  ____this_rename_at_116, int32_t & ___yield_116_rename_at_116 )
+{
+	switch (____this_rename_at_116.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_116.t,0);
+	label_2:;;
+	if ( !(____this_rename_at_116.t < 100) )
+	{
+		goto label_3;
+	};
+	if ( ____this_rename_at_116.t >= 10 )
+	{
+		++____this_rename_at_116.t;
+		goto label_2;
+	};
+	das_copy(___yield_116_rename_at_116,____this_rename_at_116.t++);
+	das_copy(____this_rename_at_116.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	goto label_2;
+	label_3:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_116_8_7_0x60_finalizer_feab25e2b4471e58 ( Context * __context__, _lambda_thismodule_116_8_7 * ____this_rename_at_116 )
+{
+	finalize_facd51879497e70(__context__,das_arg<_lambda_thismodule_116_8_7>::pass(das_deref(__context__,____this_rename_at_116)));
+	das_delete_lambda_struct<_lambda_thismodule_116_8_7 *>::clear(__context__,____this_rename_at_116);
+}
+
+inline bool _Func_lambda_thismodule_127_8_8_0x60_function_a69a16180055437 ( Context * __context__, _lambda_thismodule_127_8_8 &  ____this_rename_at_127, int32_t & ___yield_127_rename_at_127 )
+{
+	switch (____this_rename_at_127.__yield) {
+	case 0: goto label_0;
+	case 4: goto label_4;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_127.q,0);
+	label_4:;;
+	if ( !(____this_rename_at_127.q < 2) )
+	{
+		goto label_5;
+	};
+	das_copy(____this_rename_at_127.__t_rename_at_129,0);
+	label_2:;;
+	if ( !(____this_rename_at_127.__t_rename_at_129 < 5) )
+	{
+		goto label_3;
+	};
+	das_copy(___yield_127_rename_at_127,(____this_rename_at_127.q * 5) + (____this_rename_at_127.__t_rename_at_129++));
+	das_copy(____this_rename_at_127.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	goto label_2;
+	label_3:;;
+	++____this_rename_at_127.q;
+	goto label_4;
+	label_5:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_127_8_8_0x60_finalizer_df8b07997fada04a ( Context * __context__, _lambda_thismodule_127_8_8 * ____this_rename_at_127 )
+{
+	finalize_ce3c90fc305251a7(__context__,das_arg<_lambda_thismodule_127_8_8>::pass(das_deref(__context__,____this_rename_at_127)));
+	das_delete_lambda_struct<_lambda_thismodule_127_8_8 *>::clear(__context__,____this_rename_at_127);
+}
+
+inline bool _Func_lambda_thismodule_138_8_9_0x60_function_bfe086350c0a3405 ( Context * __context__, _lambda_thismodule_138_8_9 &  ____this_rename_at_138, int32_t & ___yield_138_rename_at_138 )
+{
+	switch (____this_rename_at_138.__yield) {
+	case 0: goto label_0;
+	case 3: goto label_3;
+	case 1: goto label_1;
+	case 4: goto label_4;
+	case 2: goto label_2;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_138.t,0);
+	label_3:;;
+	if ( !(____this_rename_at_138.t < 9) )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_138_rename_at_138,____this_rename_at_138.t++);
+	das_copy(____this_rename_at_138.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	goto label_3;
+	label_4:;;
+	das_copy(___yield_138_rename_at_138,9);
+	das_copy(____this_rename_at_138.__yield,2);
+	return das_auto_cast<bool>::cast(true);
+	label_2:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_138_8_9_0x60_finalizer_1d6b783a905b2418 ( Context * __context__, _lambda_thismodule_138_8_9 * ____this_rename_at_138 )
+{
+	finalize_2cdc25d288d5bdba(__context__,das_arg<_lambda_thismodule_138_8_9>::pass(das_deref(__context__,____this_rename_at_138)));
+	das_delete_lambda_struct<_lambda_thismodule_138_8_9 *>::clear(__context__,____this_rename_at_138);
+}
+
+inline bool _Func_lambda_thismodule_148_8_10_0x60_function_d52c21408a6fadc3 ( Context * __context__, _lambda_thismodule_148_8_10 &  ____this_rename_at_148, int32_t & ___yield_148_rename_at_148 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_148_32;
+	switch (____this_rename_at_148.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_148._loop_at_148,true);
+	das_move(____this_rename_at_148._source_0_at_148,(_temp_make_local_148_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(0,10)))));
+	memset(&(____this_rename_at_148.t), 0, 4);
+	das_copy(____this_rename_at_148._pvar_0_at_148,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_148.t)));
+	DAS_SETBOOLAND((____this_rename_at_148._loop_at_148),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_148._source_0_at_148),____this_rename_at_148._pvar_0_at_148,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_148._loop_at_148 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_148_rename_at_148,____this_rename_at_148.t);
+	das_copy(____this_rename_at_148.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_148._loop_at_148),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_148._source_0_at_148),____this_rename_at_148._pvar_0_at_148,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_148._source_0_at_148),____this_rename_at_148._pvar_0_at_148,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_148_8_10_0x60_finalizer_f7641aeadc01ff4c ( Context * __context__, _lambda_thismodule_148_8_10 * ____this_rename_at_148 )
+{
+	finalize_ffee4bfb0ce3b1cd(__context__,das_arg<_lambda_thismodule_148_8_10>::pass(das_deref(__context__,____this_rename_at_148)));
+	das_delete_lambda_struct<_lambda_thismodule_148_8_10 *>::clear(__context__,____this_rename_at_148);
+}
+
+inline bool _Func_lambda_thismodule_155_8_11_0x60_function_f4b1236830d201c5 ( Context * __context__, _lambda_thismodule_155_8_11 &  ____this_rename_at_155, int32_t & ___yield_155_rename_at_155 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_155_32;
+	switch (____this_rename_at_155.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_155._loop_at_155,true);
+	das_move(____this_rename_at_155._source_0_at_155,(_temp_make_local_155_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(0,100)))));
+	memset(&(____this_rename_at_155.t), 0, 4);
+	das_copy(____this_rename_at_155._pvar_0_at_155,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_155.t)));
+	DAS_SETBOOLAND((____this_rename_at_155._loop_at_155),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_155._source_0_at_155),____this_rename_at_155._pvar_0_at_155,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_155._loop_at_155 )
+	{
+		goto label_4;
+	};
+	if ( ____this_rename_at_155.t == 10 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_155_rename_at_155,____this_rename_at_155.t);
+	das_copy(____this_rename_at_155.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_155._loop_at_155),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_155._source_0_at_155),____this_rename_at_155._pvar_0_at_155,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_155._source_0_at_155),____this_rename_at_155._pvar_0_at_155,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_155_8_11_0x60_finalizer_4d1bc51cd2ab5ca8 ( Context * __context__, _lambda_thismodule_155_8_11 * ____this_rename_at_155 )
+{
+	finalize_374c0be22d6b54f4(__context__,das_arg<_lambda_thismodule_155_8_11>::pass(das_deref(__context__,____this_rename_at_155)));
+	das_delete_lambda_struct<_lambda_thismodule_155_8_11 *>::clear(__context__,____this_rename_at_155);
+}
+
+inline bool _Func_lambda_thismodule_164_8_12_0x60_function_19007db58da6b4fc ( Context * __context__, _lambda_thismodule_164_8_12 &  ____this_rename_at_164, int32_t & ___yield_164_rename_at_164 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_164_32;
+	switch (____this_rename_at_164.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_164._loop_at_164,true);
+	das_move(____this_rename_at_164._source_0_at_164,(_temp_make_local_164_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(0,100)))));
+	memset(&(____this_rename_at_164.t), 0, 4);
+	das_copy(____this_rename_at_164._pvar_0_at_164,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_164.t)));
+	DAS_SETBOOLAND((____this_rename_at_164._loop_at_164),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_164._source_0_at_164),____this_rename_at_164._pvar_0_at_164,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_164._loop_at_164 )
+	{
+		goto label_4;
+	};
+	if ( ____this_rename_at_164.t >= 10 )
+	{
+		goto label_3;
+	};
+	das_copy(___yield_164_rename_at_164,____this_rename_at_164.t);
+	das_copy(____this_rename_at_164.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_164._loop_at_164),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_164._source_0_at_164),____this_rename_at_164._pvar_0_at_164,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_164._source_0_at_164),____this_rename_at_164._pvar_0_at_164,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_164_8_12_0x60_finalizer_6dc71dd77f6c40e4 ( Context * __context__, _lambda_thismodule_164_8_12 * ____this_rename_at_164 )
+{
+	finalize_e02182ac8e0f274d(__context__,das_arg<_lambda_thismodule_164_8_12>::pass(das_deref(__context__,____this_rename_at_164)));
+	das_delete_lambda_struct<_lambda_thismodule_164_8_12 *>::clear(__context__,____this_rename_at_164);
+}
+
+inline bool _Func_lambda_thismodule_173_8_13_0x60_function_933bb4552c02a48f ( Context * __context__, _lambda_thismodule_173_8_13 &  ____this_rename_at_173, int32_t & ___yield_173_rename_at_173 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_173_32;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_174_48;
+	switch (____this_rename_at_173.__yield) {
+	case 0: goto label_0;
+	case 5: goto label_5;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	case 6: goto label_6;
+	case 7: goto label_7;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_173._loop_at_173,true);
+	das_move(____this_rename_at_173._source_0_at_173,(_temp_make_local_173_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(0,2)))));
+	memset(&(____this_rename_at_173.q), 0, 4);
+	das_copy(____this_rename_at_173._pvar_0_at_173,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_173.q)));
+	DAS_SETBOOLAND((____this_rename_at_173._loop_at_173),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_173._source_0_at_173),____this_rename_at_173._pvar_0_at_173,__context__)));
+	label_5:;;
+	if ( !____this_rename_at_173._loop_at_173 )
+	{
+		goto label_7;
+	};
+	das_copy(____this_rename_at_173.___loop_at_174_rename_at_174,true);
+	das_move(____this_rename_at_173.___source_0_at_174_rename_at_174,(_temp_make_local_174_48 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(0,5)))));
+	memset(&(____this_rename_at_173.__t_rename_at_174), 0, 4);
+	das_copy(____this_rename_at_173.___pvar_0_at_174_rename_at_174,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_173.__t_rename_at_174)));
+	DAS_SETBOOLAND((____this_rename_at_173.___loop_at_174_rename_at_174),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_173.___source_0_at_174_rename_at_174),____this_rename_at_173.___pvar_0_at_174_rename_at_174,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_173.___loop_at_174_rename_at_174 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_173_rename_at_173,(____this_rename_at_173.q * 5) + ____this_rename_at_173.__t_rename_at_174);
+	das_copy(____this_rename_at_173.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_173.___loop_at_174_rename_at_174),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_173.___source_0_at_174_rename_at_174),____this_rename_at_173.___pvar_0_at_174_rename_at_174,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_173.___source_0_at_174_rename_at_174),____this_rename_at_173.___pvar_0_at_174_rename_at_174,__context__);
+	label_6:;;
+	DAS_SETBOOLAND((____this_rename_at_173._loop_at_173),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_173._source_0_at_173),____this_rename_at_173._pvar_0_at_173,__context__)));
+	goto label_5;
+	label_7:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_173._source_0_at_173),____this_rename_at_173._pvar_0_at_173,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_173_8_13_0x60_finalizer_9ed93911dd3fad90 ( Context * __context__, _lambda_thismodule_173_8_13 * ____this_rename_at_173 )
+{
+	finalize_ef50215be3055b3d(__context__,das_arg<_lambda_thismodule_173_8_13>::pass(das_deref(__context__,____this_rename_at_173)));
+	das_delete_lambda_struct<_lambda_thismodule_173_8_13 *>::clear(__context__,____this_rename_at_173);
+}
+
+inline bool _Func_lambda_thismodule_181_8_14_0x60_function_751009d83b403c93 ( Context * __context__, _lambda_thismodule_181_8_14 &  ____this_rename_at_181, int32_t & ___yield_181_rename_at_181 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_181_32;
+	switch (____this_rename_at_181.__yield) {
+	case 0: goto label_0;
+	case 3: goto label_3;
+	case 1: goto label_1;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	case 2: goto label_2;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_181._loop_at_181,true);
+	das_move(____this_rename_at_181._source_0_at_181,(_temp_make_local_181_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(0,9)))));
+	memset(&(____this_rename_at_181.t), 0, 4);
+	das_copy(____this_rename_at_181._pvar_0_at_181,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_181.t)));
+	DAS_SETBOOLAND((____this_rename_at_181._loop_at_181),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_181._source_0_at_181),____this_rename_at_181._pvar_0_at_181,__context__)));
+	label_3:;;
+	if ( !____this_rename_at_181._loop_at_181 )
+	{
+		goto label_5;
+	};
+	das_copy(___yield_181_rename_at_181,____this_rename_at_181.t);
+	das_copy(____this_rename_at_181.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_4:;;
+	DAS_SETBOOLAND((____this_rename_at_181._loop_at_181),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_181._source_0_at_181),____this_rename_at_181._pvar_0_at_181,__context__)));
+	goto label_3;
+	label_5:;;
+	das_copy(___yield_181_rename_at_181,9);
+	das_copy(____this_rename_at_181.__yield,2);
+	return das_auto_cast<bool>::cast(true);
+	label_2:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_181._source_0_at_181),____this_rename_at_181._pvar_0_at_181,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_181_8_14_0x60_finalizer_805eac3b4d3687c0 ( Context * __context__, _lambda_thismodule_181_8_14 * ____this_rename_at_181 )
+{
+	finalize_64989e0124a0a430(__context__,das_arg<_lambda_thismodule_181_8_14>::pass(das_deref(__context__,____this_rename_at_181)));
+	das_delete_lambda_struct<_lambda_thismodule_181_8_14 *>::clear(__context__,____this_rename_at_181);
+}
+
+inline void checkIt_b77b2cf6f5613cc5 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __gen_rename_at_2 )
+{
+	int32_t __count_rename_at_4 = 0;
+	{
+		bool __need_loop_5 = true;
+		// x : int const
+		das_iterator<Sequence DAS_COMMENT((int32_t)) const > __x_iterator(__gen_rename_at_2);
+		int32_t __x_rename_at_5;
+		__need_loop_5 = __x_iterator.first(__context__,(__x_rename_at_5)) && __need_loop_5;
+		// y : int const
+		das_iterator<range> __y_iterator(range(0,100500));
+		int32_t __y_rename_at_5;
+		__need_loop_5 = __y_iterator.first(__context__,(__y_rename_at_5)) && __need_loop_5;
+		for ( ; __need_loop_5 ; __need_loop_5 = __x_iterator.next(__context__,(__x_rename_at_5)) && __y_iterator.next(__context__,(__y_rename_at_5)) )
+		{
+			if ( __y_rename_at_5 >= 10 )
+			{
+				DAS_ASSERTF((false),(((char *) "output too long")));
+			};
+			DAS_ASSERTF((__x_rename_at_5 == __y_rename_at_5),(((char *) "value mismatch")));
+			++__count_rename_at_4;
+		}
+		__x_iterator.close(__context__,(__x_rename_at_5));
+		__y_iterator.close(__context__,(__y_rename_at_5));
+	};
+	DAS_ASSERTF((__count_rename_at_4 == 10),(((char *) "output too short")));
+}
+
+inline void test_yield_43bf5d7d8b5c310f ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t)) __gen_rename_at_14_ConstRef; das_zero(__gen_rename_at_14_ConstRef); das_move(__gen_rename_at_14_ConstRef, ((Sequence DAS_COMMENT((int32_t)))_Funcbuiltin_0x60_each_e06f3606db6c5381(__context__,das_ascend<bool,_lambda_thismodule_15_8_1>::make(__context__,&__type_info__e798b9863673a07,(([&]() -> _lambda_thismodule_15_8_1 {
+		_lambda_thismodule_15_8_1 __mks_14;
+		das_zero(__mks_14);
+		das_copy((__mks_14.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_15_8_1`function XS<::_lambda_thismodule_15_8_1> &i*/ 1434921611548637u))));
+		das_copy((__mks_14.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_15_8_1`finalizer X1<S<::_lambda_thismodule_15_8_1>>?*/ 17510463830138486758u))));
+		return __mks_14;
+	})())))));
+	Sequence DAS_COMMENT((int32_t)) const  & __gen_rename_at_14 = __gen_rename_at_14_ConstRef; ;
+	checkIt_b77b2cf6f5613cc5(__context__,__gen_rename_at_14);
+}
+
+inline void test_local_c97ca04425182266 ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t)) __gen_rename_at_29_ConstRef; das_zero(__gen_rename_at_29_ConstRef); das_move(__gen_rename_at_29_ConstRef, ((Sequence DAS_COMMENT((int32_t)))_Funcbuiltin_0x60_each_e06f3606db6c5381(__context__,das_ascend<bool,_lambda_thismodule_30_8_2>::make(__context__,&__type_info__4eea7ba07c5b7fcb,(([&]() -> _lambda_thismodule_30_8_2 {
+		_lambda_thismodule_30_8_2 __mks_29;
+		das_zero(__mks_29);
+		das_copy((__mks_29.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_30_8_2`function XS<::_lambda_thismodule_30_8_2> &i*/ 3828138743882661789u))));
+		das_copy((__mks_29.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_30_8_2`finalizer X1<S<::_lambda_thismodule_30_8_2>>?*/ 10445581596867309930u))));
+		return __mks_29;
+	})())))));
+	Sequence DAS_COMMENT((int32_t)) const  & __gen_rename_at_29 = __gen_rename_at_29_ConstRef; ;
+	checkIt_b77b2cf6f5613cc5(__context__,__gen_rename_at_29);
+}
+
+inline void test_local_ref_4ca5ac966d19e4c4 ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t)) __gen_rename_at_45_ConstRef; das_zero(__gen_rename_at_45_ConstRef); das_move(__gen_rename_at_45_ConstRef, ((Sequence DAS_COMMENT((int32_t)))_Funcbuiltin_0x60_each_e06f3606db6c5381(__context__,das_ascend<bool,_lambda_thismodule_46_8_3>::make(__context__,&__type_info__574dbdb1dc587435,(([&]() -> _lambda_thismodule_46_8_3 {
+		_lambda_thismodule_46_8_3 __mks_45;
+		das_zero(__mks_45);
+		das_copy((__mks_45.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_46_8_3`function XS<::_lambda_thismodule_46_8_3> &i*/ 9609593503032938569u))));
+		das_copy((__mks_45.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_46_8_3`finalizer X1<S<::_lambda_thismodule_46_8_3>>?*/ 2617635461242460638u))));
+		return __mks_45;
+	})())))));
+	Sequence DAS_COMMENT((int32_t)) const  & __gen_rename_at_45 = __gen_rename_at_45_ConstRef; ;
+	checkIt_b77b2cf6f5613cc5(__context__,__gen_rename_at_45);
+}
+
+inline void test_if_4b2334d19cdbfc63 ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t)) __gen_rename_at_62_ConstRef; das_zero(__gen_rename_at_62_ConstRef); das_move(__gen_rename_at_62_ConstRef, ((Sequence DAS_COMMENT((int32_t)))_Funcbuiltin_0x60_each_e06f3606db6c5381(__context__,das_ascend<bool,_lambda_thismodule_63_8_4>::make(__context__,&__type_info__97ba66ce6d6a80f1,(([&]() -> _lambda_thismodule_63_8_4 {
+		_lambda_thismodule_63_8_4 __mks_62;
+		das_zero(__mks_62);
+		das_copy((__mks_62.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_63_8_4`function XS<::_lambda_thismodule_63_8_4> &i*/ 17696560279268626105u))));
+		das_copy((__mks_62.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_63_8_4`finalizer X1<S<::_lambda_thismodule_63_8_4>>?*/ 12247701490387263250u))));
+		return __mks_62;
+	})())))));
+	Sequence DAS_COMMENT((int32_t)) const  & __gen_rename_at_62 = __gen_rename_at_62_ConstRef; ;
+	checkIt_b77b2cf6f5613cc5(__context__,__gen_rename_at_62);
+}
+
+inline void test_while_207168d1bc64b6ff ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t)) __gen_rename_at_97_ConstRef; das_zero(__gen_rename_at_97_ConstRef); das_move(__gen_rename_at_97_ConstRef, ((Sequence DAS_COMMENT((int32_t)))_Funcbuiltin_0x60_each_e06f3606db6c5381(__context__,das_ascend<bool,_lambda_thismodule_98_8_5>::make(__context__,&__type_info__2251a8dc8724191a,(([&]() -> _lambda_thismodule_98_8_5 {
+		_lambda_thismodule_98_8_5 __mks_97;
+		das_zero(__mks_97);
+		das_copy((__mks_97.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_98_8_5`function XS<::_lambda_thismodule_98_8_5> &i*/ 10881143942056194997u))));
+		das_copy((__mks_97.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_98_8_5`finalizer X1<S<::_lambda_thismodule_98_8_5>>?*/ 3066611193211164604u))));
+		return __mks_97;
+	})())))));
+	Sequence DAS_COMMENT((int32_t)) const  & __gen_rename_at_97 = __gen_rename_at_97_ConstRef; ;
+	checkIt_b77b2cf6f5613cc5(__context__,__gen_rename_at_97);
+}
+
+inline void test_while_break_c4f7dfad9b875d56 ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t)) __gen_rename_at_105_ConstRef; das_zero(__gen_rename_at_105_ConstRef); das_move(__gen_rename_at_105_ConstRef, ((Sequence DAS_COMMENT((int32_t)))_Funcbuiltin_0x60_each_e06f3606db6c5381(__context__,das_ascend<bool,_lambda_thismodule_106_8_6>::make(__context__,&__type_info__babaed4061694eb9,(([&]() -> _lambda_thismodule_106_8_6 {
+		_lambda_thismodule_106_8_6 __mks_105;
+		das_zero(__mks_105);
+		das_copy((__mks_105.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_106_8_6`function XS<::_lambda_thismodule_106_8_6> &i*/ 1912312002146920541u))));
+		das_copy((__mks_105.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_106_8_6`finalizer X1<S<::_lambda_thismodule_106_8_6>>?*/ 5464387161659315748u))));
+		return __mks_105;
+	})())))));
+	Sequence DAS_COMMENT((int32_t)) const  & __gen_rename_at_105 = __gen_rename_at_105_ConstRef; ;
+	checkIt_b77b2cf6f5613cc5(__context__,__gen_rename_at_105);
+}
+
+inline void test_while_continue_75c0e4a995a2673d ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t)) __gen_rename_at_115_ConstRef; das_zero(__gen_rename_at_115_ConstRef); das_move(__gen_rename_at_115_ConstRef, ((Sequence DAS_COMMENT((int32_t)))_Funcbuiltin_0x60_each_e06f3606db6c5381(__context__,das_ascend<bool,_lambda_thismodule_116_8_7>::make(__context__,&__type_info__45ec1d4e6051a4db,(([&]() -> _lambda_thismodule_116_8_7 {
+		_lambda_thismodule_116_8_7 __mks_115;
+		das_zero(__mks_115);
+		das_copy((__mks_115.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_116_8_7`function XS<::_lambda_thismodule_116_8_7> &i*/ 2791680852147587965u))));
+		das_copy((__mks_115.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_116_8_7`finalizer X1<S<::_lambda_thismodule_116_8_7>>?*/ 2231122602570750440u))));
+		return __mks_115;
+	})())))));
+	Sequence DAS_COMMENT((int32_t)) const  & __gen_rename_at_115 = __gen_rename_at_115_ConstRef; ;
+	checkIt_b77b2cf6f5613cc5(__context__,__gen_rename_at_115);
+}
+
+inline void test_while_nested_8836704f64262b28 ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t)) __gen_rename_at_126_ConstRef; das_zero(__gen_rename_at_126_ConstRef); das_move(__gen_rename_at_126_ConstRef, ((Sequence DAS_COMMENT((int32_t)))_Funcbuiltin_0x60_each_e06f3606db6c5381(__context__,das_ascend<bool,_lambda_thismodule_127_8_8>::make(__context__,&__type_info__6964d686464baf60,(([&]() -> _lambda_thismodule_127_8_8 {
+		_lambda_thismodule_127_8_8 __mks_126;
+		das_zero(__mks_126);
+		das_copy((__mks_126.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_127_8_8`function XS<::_lambda_thismodule_127_8_8> &i*/ 13019531992016209855u))));
+		das_copy((__mks_126.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_127_8_8`finalizer X1<S<::_lambda_thismodule_127_8_8>>?*/ 14015745253302607832u))));
+		return __mks_126;
+	})())))));
+	Sequence DAS_COMMENT((int32_t)) const  & __gen_rename_at_126 = __gen_rename_at_126_ConstRef; ;
+	checkIt_b77b2cf6f5613cc5(__context__,__gen_rename_at_126);
+}
+
+inline void test_while_finally_1f53f1e10cf6e7f1 ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t)) __gen_rename_at_137_ConstRef; das_zero(__gen_rename_at_137_ConstRef); das_move(__gen_rename_at_137_ConstRef, ((Sequence DAS_COMMENT((int32_t)))_Funcbuiltin_0x60_each_e06f3606db6c5381(__context__,das_ascend<bool,_lambda_thismodule_138_8_9>::make(__context__,&__type_info__ae9d40554f3d3b65,(([&]() -> _lambda_thismodule_138_8_9 {
+		_lambda_thismodule_138_8_9 __mks_137;
+		das_zero(__mks_137);
+		das_copy((__mks_137.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_138_8_9`function XS<::_lambda_thismodule_138_8_9> &i*/ 15602141982767290957u))));
+		das_copy((__mks_137.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_138_8_9`finalizer X1<S<::_lambda_thismodule_138_8_9>>?*/ 12467431092625192536u))));
+		return __mks_137;
+	})())))));
+	Sequence DAS_COMMENT((int32_t)) const  & __gen_rename_at_137 = __gen_rename_at_137_ConstRef; ;
+	checkIt_b77b2cf6f5613cc5(__context__,__gen_rename_at_137);
+}
+
+inline void test_for_3d4014c593e25361 ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t)) __gen_rename_at_147_ConstRef; das_zero(__gen_rename_at_147_ConstRef); das_move(__gen_rename_at_147_ConstRef, ((Sequence DAS_COMMENT((int32_t)))_Funcbuiltin_0x60_each_e06f3606db6c5381(__context__,das_ascend<bool,_lambda_thismodule_148_8_10>::make(__context__,&__type_info__537b25dfc19dabc,(([&]() -> _lambda_thismodule_148_8_10 {
+		_lambda_thismodule_148_8_10 __mks_147;
+		das_zero(__mks_147);
+		das_copy((__mks_147.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_148_8_10`function XS<::_lambda_thismodule_148_8_10> &i*/ 9728547864607189053u))));
+		das_copy((__mks_147.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_148_8_10`finalizer X1<S<::_lambda_thismodule_148_8_10>>?*/ 2197411294666528704u))));
+		return __mks_147;
+	})())))));
+	Sequence DAS_COMMENT((int32_t)) const  & __gen_rename_at_147 = __gen_rename_at_147_ConstRef; ;
+	checkIt_b77b2cf6f5613cc5(__context__,__gen_rename_at_147);
+}
+
+inline void test_for_break_cca2bc3cb5da05c1 ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t)) __gen_rename_at_154_ConstRef; das_zero(__gen_rename_at_154_ConstRef); das_move(__gen_rename_at_154_ConstRef, ((Sequence DAS_COMMENT((int32_t)))_Funcbuiltin_0x60_each_e06f3606db6c5381(__context__,das_ascend<bool,_lambda_thismodule_155_8_11>::make(__context__,&__type_info__693cc13c1ad65f7b,(([&]() -> _lambda_thismodule_155_8_11 {
+		_lambda_thismodule_155_8_11 __mks_154;
+		das_zero(__mks_154);
+		das_copy((__mks_154.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_155_8_11`function XS<::_lambda_thismodule_155_8_11> &i*/ 8218870346502161253u))));
+		das_copy((__mks_154.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_155_8_11`finalizer X1<S<::_lambda_thismodule_155_8_11>>?*/ 5287830100410965230u))));
+		return __mks_154;
+	})())))));
+	Sequence DAS_COMMENT((int32_t)) const  & __gen_rename_at_154 = __gen_rename_at_154_ConstRef; ;
+	checkIt_b77b2cf6f5613cc5(__context__,__gen_rename_at_154);
+}
+
+inline void test_for_continue_53de54f968be3ee6 ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t)) __gen_rename_at_163_ConstRef; das_zero(__gen_rename_at_163_ConstRef); das_move(__gen_rename_at_163_ConstRef, ((Sequence DAS_COMMENT((int32_t)))_Funcbuiltin_0x60_each_e06f3606db6c5381(__context__,das_ascend<bool,_lambda_thismodule_164_8_12>::make(__context__,&__type_info__e4a4f20d2e813a14,(([&]() -> _lambda_thismodule_164_8_12 {
+		_lambda_thismodule_164_8_12 __mks_163;
+		das_zero(__mks_163);
+		das_copy((__mks_163.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_164_8_12`function XS<::_lambda_thismodule_164_8_12> &i*/ 5489572971897532621u))));
+		das_copy((__mks_163.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_164_8_12`finalizer X1<S<::_lambda_thismodule_164_8_12>>?*/ 6150727324924101160u))));
+		return __mks_163;
+	})())))));
+	Sequence DAS_COMMENT((int32_t)) const  & __gen_rename_at_163 = __gen_rename_at_163_ConstRef; ;
+	checkIt_b77b2cf6f5613cc5(__context__,__gen_rename_at_163);
+}
+
+inline void test_for_nested_935ae4a50d073e48 ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t)) __gen_rename_at_172_ConstRef; das_zero(__gen_rename_at_172_ConstRef); das_move(__gen_rename_at_172_ConstRef, ((Sequence DAS_COMMENT((int32_t)))_Funcbuiltin_0x60_each_e06f3606db6c5381(__context__,das_ascend<bool,_lambda_thismodule_173_8_13>::make(__context__,&__type_info__629ba791d8367189,(([&]() -> _lambda_thismodule_173_8_13 {
+		_lambda_thismodule_173_8_13 __mks_172;
+		das_zero(__mks_172);
+		das_copy((__mks_172.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_173_8_13`function XS<::_lambda_thismodule_173_8_13> &i*/ 17300964355093108373u))));
+		das_copy((__mks_172.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_173_8_13`finalizer X1<S<::_lambda_thismodule_173_8_13>>?*/ 10574929149465217874u))));
+		return __mks_172;
+	})())))));
+	Sequence DAS_COMMENT((int32_t)) const  & __gen_rename_at_172 = __gen_rename_at_172_ConstRef; ;
+	checkIt_b77b2cf6f5613cc5(__context__,__gen_rename_at_172);
+}
+
+inline void test_for_finally_67c0d997405975ab ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t)) __gen_rename_at_180_ConstRef; das_zero(__gen_rename_at_180_ConstRef); das_move(__gen_rename_at_180_ConstRef, ((Sequence DAS_COMMENT((int32_t)))_Funcbuiltin_0x60_each_e06f3606db6c5381(__context__,das_ascend<bool,_lambda_thismodule_181_8_14>::make(__context__,&__type_info__50b236c0c3679a07,(([&]() -> _lambda_thismodule_181_8_14 {
+		_lambda_thismodule_181_8_14 __mks_180;
+		das_zero(__mks_180);
+		das_copy((__mks_180.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_181_8_14`function XS<::_lambda_thismodule_181_8_14> &i*/ 5606208595989016557u))));
+		das_copy((__mks_180.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_181_8_14`finalizer X1<S<::_lambda_thismodule_181_8_14>>?*/ 1581629009757907086u))));
+		return __mks_180;
+	})())))));
+	Sequence DAS_COMMENT((int32_t)) const  & __gen_rename_at_180 = __gen_rename_at_180_ConstRef; ;
+	checkIt_b77b2cf6f5613cc5(__context__,__gen_rename_at_180);
+}
+
+inline bool test_3923557ae2b0401c ( Context * __context__ )
+{
+	test_yield_43bf5d7d8b5c310f(__context__);
+	test_local_c97ca04425182266(__context__);
+	test_local_ref_4ca5ac966d19e4c4(__context__);
+	test_if_4b2334d19cdbfc63(__context__);
+	test_while_207168d1bc64b6ff(__context__);
+	test_while_break_c4f7dfad9b875d56(__context__);
+	test_while_continue_75c0e4a995a2673d(__context__);
+	test_while_nested_8836704f64262b28(__context__);
+	test_while_finally_1f53f1e10cf6e7f1(__context__);
+	test_for_3d4014c593e25361(__context__);
+	test_for_break_cca2bc3cb5da05c1(__context__);
+	test_for_continue_53de54f968be3ee6(__context__);
+	test_for_nested_935ae4a50d073e48(__context__);
+	test_for_finally_67c0d997405975ab(__context__);
+	return das_auto_cast<bool>::cast(true);
+}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_each_5cbab1dfe9635bc1
+	aotLib[0x8c2bf3089ff8b6f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, range  ),&_Funcbuiltin_0x60_each_5cbab1dfe9635bc1>>();
+	};
+	// finalize_5b02563dafedbee6
+	aotLib[0x3e40015273b7364d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_15_8_1 &  ),&finalize_5b02563dafedbee6>>();
+	};
+	// finalize_6171d14823a8b21e
+	aotLib[0x7bf45fddcc2fc2c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_30_8_2 &  ),&finalize_6171d14823a8b21e>>();
+	};
+	// finalize_2db4ad5f85e220c8
+	aotLib[0xce394eb98ac49cf9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_46_8_3 &  ),&finalize_2db4ad5f85e220c8>>();
+	};
+	// finalize_8ef7a7ac80228b08
+	aotLib[0xa7bd707d33534501] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_63_8_4 &  ),&finalize_8ef7a7ac80228b08>>();
+	};
+	// finalize_7eb7534262aa1943
+	aotLib[0x7567bd36f1160425] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_98_8_5 &  ),&finalize_7eb7534262aa1943>>();
+	};
+	// finalize_39c09eeb94608282
+	aotLib[0xac4378c2ce36ca11] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_106_8_6 &  ),&finalize_39c09eeb94608282>>();
+	};
+	// finalize_facd51879497e70
+	aotLib[0x4cfcd0d304084319] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_116_8_7 &  ),&finalize_facd51879497e70>>();
+	};
+	// finalize_ce3c90fc305251a7
+	aotLib[0xb673e4cab691447d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_127_8_8 &  ),&finalize_ce3c90fc305251a7>>();
+	};
+	// finalize_2cdc25d288d5bdba
+	aotLib[0x1e1b2c9226eb885d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_138_8_9 &  ),&finalize_2cdc25d288d5bdba>>();
+	};
+	// finalize_ffee4bfb0ce3b1cd
+	aotLib[0x23eeee73a71dec3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_148_8_10 &  ),&finalize_ffee4bfb0ce3b1cd>>();
+	};
+	// finalize_374c0be22d6b54f4
+	aotLib[0xaddf9afbf8f96811] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_155_8_11 &  ),&finalize_374c0be22d6b54f4>>();
+	};
+	// finalize_e02182ac8e0f274d
+	aotLib[0x76133f6a54a9e61] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_164_8_12 &  ),&finalize_e02182ac8e0f274d>>();
+	};
+	// finalize_ef50215be3055b3d
+	aotLib[0xcd100311388acf19] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_173_8_13 &  ),&finalize_ef50215be3055b3d>>();
+	};
+	// finalize_64989e0124a0a430
+	aotLib[0xb6cbaac6c8e3ba31] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_181_8_14 &  ),&finalize_64989e0124a0a430>>();
+	};
+	// _Funcbuiltin_0x60_each_e06f3606db6c5381
+	aotLib[0x7cb6e34cd9f5c0b5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const   ),&_Funcbuiltin_0x60_each_e06f3606db6c5381>>();
+	};
+	// _Func_lambda_thismodule_15_8_1_0x60_function_27d3ba381b259179
+	aotLib[0xdcf58b0022dabb31] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_15_8_1 & , int32_t &  ),&_Func_lambda_thismodule_15_8_1_0x60_function_27d3ba381b259179>>();
+	};
+	// _Func_lambda_thismodule_15_8_1_0x60_finalizer_9e266614028e3bee
+	aotLib[0x7dea7db40b37a8fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_15_8_1 *  ),&_Func_lambda_thismodule_15_8_1_0x60_finalizer_9e266614028e3bee>>();
+	};
+	// _Func_lambda_thismodule_30_8_2_0x60_function_7f05d78a4e483572
+	aotLib[0xe50b0ca15a592ec5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_30_8_2 & , int32_t &  ),&_Func_lambda_thismodule_30_8_2_0x60_function_7f05d78a4e483572>>();
+	};
+	// _Func_lambda_thismodule_30_8_2_0x60_finalizer_d374a95ec3bf83f2
+	aotLib[0x1abeb3b0576e8481] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_30_8_2 *  ),&_Func_lambda_thismodule_30_8_2_0x60_finalizer_d374a95ec3bf83f2>>();
+	};
+	// _Func_lambda_thismodule_46_8_3_0x60_function_69539e62cb957148
+	aotLib[0xb85c172525f87c05] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_46_8_3 & , int32_t &  ),&_Func_lambda_thismodule_46_8_3_0x60_function_69539e62cb957148>>();
+	};
+	// _Func_lambda_thismodule_46_8_3_0x60_finalizer_ae8c54a162875a36
+	aotLib[0xd66467fff8628e1b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_46_8_3 *  ),&_Func_lambda_thismodule_46_8_3_0x60_finalizer_ae8c54a162875a36>>();
+	};
+	// _Func_lambda_thismodule_63_8_4_0x60_function_aa2d22de5ea30b83
+	aotLib[0x4c1f52926e8825c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_63_8_4 & , int32_t &  ),&_Func_lambda_thismodule_63_8_4_0x60_function_aa2d22de5ea30b83>>();
+	};
+	// _Func_lambda_thismodule_63_8_4_0x60_finalizer_8b265ca3b3942d7a
+	aotLib[0xef57e7477411d2de] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_63_8_4 *  ),&_Func_lambda_thismodule_63_8_4_0x60_finalizer_8b265ca3b3942d7a>>();
+	};
+	// _Func_lambda_thismodule_98_8_5_0x60_function_1ec687004213b05d
+	aotLib[0x12643b78e3f9dacd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_98_8_5 & , int32_t &  ),&_Func_lambda_thismodule_98_8_5_0x60_function_1ec687004213b05d>>();
+	};
+	// _Func_lambda_thismodule_98_8_5_0x60_finalizer_ef68934b82e4af12
+	aotLib[0x9391dce346ed533] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_98_8_5 *  ),&_Func_lambda_thismodule_98_8_5_0x60_finalizer_ef68934b82e4af12>>();
+	};
+	// _Func_lambda_thismodule_106_8_6_0x60_function_a80958c8871f25c9
+	aotLib[0x9d68fe083e5e1a41] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_106_8_6 & , int32_t &  ),&_Func_lambda_thismodule_106_8_6_0x60_function_a80958c8871f25c9>>();
+	};
+	// _Func_lambda_thismodule_106_8_6_0x60_finalizer_f15cd56f71576e64
+	aotLib[0xf4808fe852645a23] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_106_8_6 *  ),&_Func_lambda_thismodule_106_8_6_0x60_finalizer_f15cd56f71576e64>>();
+	};
+	// _Func_lambda_thismodule_116_8_7_0x60_function_b9140608d57ed540
+	aotLib[0xca2dd326eff88c1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_116_8_7 & , int32_t &  ),&_Func_lambda_thismodule_116_8_7_0x60_function_b9140608d57ed540>>();
+	};
+	// _Func_lambda_thismodule_116_8_7_0x60_finalizer_feab25e2b4471e58
+	aotLib[0x14157e60a972eb6f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_116_8_7 *  ),&_Func_lambda_thismodule_116_8_7_0x60_finalizer_feab25e2b4471e58>>();
+	};
+	// _Func_lambda_thismodule_127_8_8_0x60_function_a69a16180055437
+	aotLib[0xd1fbc3aa23d6d199] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_127_8_8 & , int32_t &  ),&_Func_lambda_thismodule_127_8_8_0x60_function_a69a16180055437>>();
+	};
+	// _Func_lambda_thismodule_127_8_8_0x60_finalizer_df8b07997fada04a
+	aotLib[0x3c00e42ce14b0e01] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_127_8_8 *  ),&_Func_lambda_thismodule_127_8_8_0x60_finalizer_df8b07997fada04a>>();
+	};
+	// _Func_lambda_thismodule_138_8_9_0x60_function_bfe086350c0a3405
+	aotLib[0xdb93021ff9fe12d1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_138_8_9 & , int32_t &  ),&_Func_lambda_thismodule_138_8_9_0x60_function_bfe086350c0a3405>>();
+	};
+	// _Func_lambda_thismodule_138_8_9_0x60_finalizer_1d6b783a905b2418
+	aotLib[0x4a9373b560b2a63c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_138_8_9 *  ),&_Func_lambda_thismodule_138_8_9_0x60_finalizer_1d6b783a905b2418>>();
+	};
+	// _Func_lambda_thismodule_148_8_10_0x60_function_d52c21408a6fadc3
+	aotLib[0x9179ef5e753ace87] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_148_8_10 & , int32_t &  ),&_Func_lambda_thismodule_148_8_10_0x60_function_d52c21408a6fadc3>>();
+	};
+	// _Func_lambda_thismodule_148_8_10_0x60_finalizer_f7641aeadc01ff4c
+	aotLib[0x9fd4f3f335bdf50d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_148_8_10 *  ),&_Func_lambda_thismodule_148_8_10_0x60_finalizer_f7641aeadc01ff4c>>();
+	};
+	// _Func_lambda_thismodule_155_8_11_0x60_function_f4b1236830d201c5
+	aotLib[0x9ab0ddc9140dbb07] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_155_8_11 & , int32_t &  ),&_Func_lambda_thismodule_155_8_11_0x60_function_f4b1236830d201c5>>();
+	};
+	// _Func_lambda_thismodule_155_8_11_0x60_finalizer_4d1bc51cd2ab5ca8
+	aotLib[0x25b4b104663bbdcf] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_155_8_11 *  ),&_Func_lambda_thismodule_155_8_11_0x60_finalizer_4d1bc51cd2ab5ca8>>();
+	};
+	// _Func_lambda_thismodule_164_8_12_0x60_function_19007db58da6b4fc
+	aotLib[0x27d3a16902aa3da7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_164_8_12 & , int32_t &  ),&_Func_lambda_thismodule_164_8_12_0x60_function_19007db58da6b4fc>>();
+	};
+	// _Func_lambda_thismodule_164_8_12_0x60_finalizer_6dc71dd77f6c40e4
+	aotLib[0xfe24e9a44d11e3ab] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_164_8_12 *  ),&_Func_lambda_thismodule_164_8_12_0x60_finalizer_6dc71dd77f6c40e4>>();
+	};
+	// _Func_lambda_thismodule_173_8_13_0x60_function_933bb4552c02a48f
+	aotLib[0x7c0c9725242ee2d3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_173_8_13 & , int32_t &  ),&_Func_lambda_thismodule_173_8_13_0x60_function_933bb4552c02a48f>>();
+	};
+	// _Func_lambda_thismodule_173_8_13_0x60_finalizer_9ed93911dd3fad90
+	aotLib[0x66e9308d5e50de48] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_173_8_13 *  ),&_Func_lambda_thismodule_173_8_13_0x60_finalizer_9ed93911dd3fad90>>();
+	};
+	// _Func_lambda_thismodule_181_8_14_0x60_function_751009d83b403c93
+	aotLib[0xe2b5416992244feb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_181_8_14 & , int32_t &  ),&_Func_lambda_thismodule_181_8_14_0x60_function_751009d83b403c93>>();
+	};
+	// _Func_lambda_thismodule_181_8_14_0x60_finalizer_805eac3b4d3687c0
+	aotLib[0xe19b954f1fe446e6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_181_8_14 *  ),&_Func_lambda_thismodule_181_8_14_0x60_finalizer_805eac3b4d3687c0>>();
+	};
+	// checkIt_b77b2cf6f5613cc5
+	aotLib[0xfb80e1ba3dd61699] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  ),&checkIt_b77b2cf6f5613cc5>>();
+	};
+	// test_yield_43bf5d7d8b5c310f
+	aotLib[0x18a76902cb849fcb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_yield_43bf5d7d8b5c310f>>();
+	};
+	// test_local_c97ca04425182266
+	aotLib[0x63d8f7a7d0af739d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_local_c97ca04425182266>>();
+	};
+	// test_local_ref_4ca5ac966d19e4c4
+	aotLib[0x8edddd953a2dba9f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_local_ref_4ca5ac966d19e4c4>>();
+	};
+	// test_if_4b2334d19cdbfc63
+	aotLib[0x165d75ab24906cc3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_if_4b2334d19cdbfc63>>();
+	};
+	// test_while_207168d1bc64b6ff
+	aotLib[0x43799d2bcf774a59] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_while_207168d1bc64b6ff>>();
+	};
+	// test_while_break_c4f7dfad9b875d56
+	aotLib[0xe56d0ae06fcab952] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_while_break_c4f7dfad9b875d56>>();
+	};
+	// test_while_continue_75c0e4a995a2673d
+	aotLib[0x5b02446cc4e3d73c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_while_continue_75c0e4a995a2673d>>();
+	};
+	// test_while_nested_8836704f64262b28
+	aotLib[0x871b64d22bfce763] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_while_nested_8836704f64262b28>>();
+	};
+	// test_while_finally_1f53f1e10cf6e7f1
+	aotLib[0x7ee00f39397996d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_while_finally_1f53f1e10cf6e7f1>>();
+	};
+	// test_for_3d4014c593e25361
+	aotLib[0x1423743a386c6222] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_for_3d4014c593e25361>>();
+	};
+	// test_for_break_cca2bc3cb5da05c1
+	aotLib[0xde51f44ddeae7d4e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_for_break_cca2bc3cb5da05c1>>();
+	};
+	// test_for_continue_53de54f968be3ee6
+	aotLib[0xef859c9572459e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_for_continue_53de54f968be3ee6>>();
+	};
+	// test_for_nested_935ae4a50d073e48
+	aotLib[0xfd4e398ab6cf5127] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_for_nested_935ae4a50d073e48>>();
+	};
+	// test_for_finally_67c0d997405975ab
+	aotLib[0x89b171b70ca315fe] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_for_finally_67c0d997405975ab>>();
+	};
+	// test_3923557ae2b0401c
+	aotLib[0xec07ec097d297946] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_3923557ae2b0401c>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,145 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_4064006376245435435 {
+
+extern StructInfo __struct_info__f35ff723fded4627;
+extern TypeInfo __type_info__441f4faaa4ccc2bb;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern VarInfo __var_info__a08ab22745ae6444;
+extern VarInfo __var_info__a08aaa2745ae56ac;
+
+VarInfo __struct_info__f35ff723fded4627_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xa08ab22745ae6444ul, "i", 0 };
+VarInfo __struct_info__f35ff723fded4627_field_1 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, 0xa08aaa2745ae56acul, "a", 8 };
+VarInfo * __struct_info__f35ff723fded4627_fields[2] =  { &__struct_info__f35ff723fded4627_field_0, &__struct_info__f35ff723fded4627_field_1 };
+StructInfo __struct_info__f35ff723fded4627 = {(char*)"Foo", (char*)"", 20, __struct_info__f35ff723fded4627_fields, 2, 32, 0xf2bb95199c92e1d7ul, nullptr, 0xf35ff723fded4627ul };
+TypeInfo __type_info__441f4faaa4ccc2bb = { Type::tStructure, &__struct_info__f35ff723fded4627, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 32, 0x441f4faaa4ccc2bbul };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xaf63e44c8601fa24ul };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__441f4faaa4ccc2bb };
+namespace  { struct Foo; };
+namespace  {
+
+struct Foo {
+	int32_t i;
+	TArray<int32_t> a;
+};
+static_assert(sizeof(Foo)==32,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,i)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,a)==8,"structure field offset mismatch with DAS");
+}
+
+inline Foo & _Funcbuiltin_0x60__return_with_lockcheck_e3f27a37706a12a5 ( Context * __context__, Foo & __a_rename_at_42 );
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> & __Arr_rename_at_75, int32_t __value_rename_at_75 );
+inline bool test_8ef36484e565e0d4 ( Context * __context__ );
+inline Foo Foo_969eb4ae64e7dd14 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<Foo *,0xd8f093e12e73bb55>(__context__) = das_new<Foo>::make_and_init(__context__,[&]() { return Foo_969eb4ae64e7dd14(__context__); });/*g*/
+	das_global<Foo *,0x6be14e14bb777fff>(__context__) = das_new<Foo>::make_and_init(__context__,[&]() { return Foo_969eb4ae64e7dd14(__context__); });/*pg*/
+}
+
+inline Foo & _Funcbuiltin_0x60__return_with_lockcheck_e3f27a37706a12a5 ( Context * __context__, Foo &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<Foo &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<Foo &>::cast(__a_rename_at_42);
+}
+
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_75, int32_t __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_75),4,__context__),__context__),__value_rename_at_75);
+}
+
+inline bool test_8ef36484e565e0d4 ( Context * __context__ )
+{
+	_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(das_global<Foo *,0xd8f093e12e73bb55>(__context__) /*g*/->a),10);
+	DAS_ASSERT((das_global<Foo *,0xd8f093e12e73bb55>(__context__) /*g*/->i == 5));
+	DAS_ASSERT((das_global<Foo *,0x6be14e14bb777fff>(__context__) /*pg*/->i == 5));
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline Foo Foo_969eb4ae64e7dd14 ( Context * __context__ )
+{
+	Foo _temp_make_local_4_32;
+	return /* <- */ das_auto_cast_move<Foo>::cast(_Funcbuiltin_0x60__return_with_lockcheck_e3f27a37706a12a5(__context__,das_arg<Foo>::pass((([&]() -> Foo& {
+		das_zero(_temp_make_local_4_32);
+		das_copy((_temp_make_local_4_32.i),(5));
+		return _temp_make_local_4_32;
+	})()))));
+}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60__return_with_lockcheck_e3f27a37706a12a5
+	aotLib[0xb06e2106c303ef51] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<Foo & (*) ( Context * __context__, Foo &  ),&_Funcbuiltin_0x60__return_with_lockcheck_e3f27a37706a12a5>>();
+	};
+	// _Funcbuiltin_0x60_push_d21751720b4df10e
+	aotLib[0x9fb5b63c22625999] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_d21751720b4df10e>>();
+	};
+	// test_8ef36484e565e0d4
+	aotLib[0x3d97c39f524eb169] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_8ef36484e565e0d4>>();
+	};
+	// Foo_969eb4ae64e7dd14
+	aotLib[0x673d02175ebdac9a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__ ),&Foo_969eb4ae64e7dd14>>();
+	};
+	// [[ init script ]]
+	aotLib[0x8f5d42e64acaeaab] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,329 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_16861495141994232996 {
+
+extern TypeInfo __type_info__90f3d07b5a6ca13;
+extern TypeInfo __type_info__f95678735cf0e442;
+extern TypeInfo __type_info__90f5707b5a6f641;
+
+TypeInfo __type_info__90f3d07b5a6ca13 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, 0x90f3d07b5a6ca13ul };
+TypeInfo __type_info__f95678735cf0e442 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~strings::StringBuilderWriter"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 288, 0xf95678735cf0e442ul };
+TypeInfo __type_info__90f5707b5a6f641 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, 0x90f5707b5a6f641ul };
+
+TypeInfo * __tinfo_0[2] = { &__type_info__f95678735cf0e442, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_1[2] = { &__type_info__f95678735cf0e442, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_2[2] = { &__type_info__f95678735cf0e442, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_3[2] = { &__type_info__f95678735cf0e442, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_4[2] = { &__type_info__f95678735cf0e442, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_5[2] = { &__type_info__f95678735cf0e442, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_6[2] = { &__type_info__f95678735cf0e442, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_7[2] = { &__type_info__f95678735cf0e442, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_8[2] = { &__type_info__f95678735cf0e442, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_9[2] = { &__type_info__f95678735cf0e442, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_10[2] = { &__type_info__f95678735cf0e442, &__type_info__90f3d07b5a6ca13 };
+
+inline char * const  _Funcstrings_boost_0x60_join_e037aa8a889146d3 ( Context * __context__, TDim<int32_t,1> const  & __it_rename_at_17, char * const  __separator_rename_at_17 );
+inline char * const  _Funcstrings_boost_0x60_join_5f0ee9ad9a015be2 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_17, char * const  __separator_rename_at_17 );
+inline char * const  _Funcstrings_boost_0x60_join_a32510cbf2dd5518 ( Context * __context__, TDim<int32_t,4> const  & __it_rename_at_17, char * const  __separator_rename_at_17 );
+inline char * const  _Funcstrings_boost_0x60_join_c1dcb32ad20ca31a ( Context * __context__, TArray<int32_t> const  & __it_rename_at_17, char * const  __separator_rename_at_17 );
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> & __Arr_rename_at_75, int32_t __value_rename_at_75 );
+inline char * const  _Funcstrings_boost_0x60_join_a335f7954d6ee570 ( Context * __context__, range __it_rename_at_17, char * const  __separator_rename_at_17 );
+inline char * const  _Funcstrings_boost_0x60_join_35a2782e4cfa1b7f ( Context * __context__, char * const  __it_rename_at_17, char * const  __separator_rename_at_17 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_5cbab1dfe9635bc1 ( Context * __context__, range __rng_rename_at_345 );
+inline bool test_63e198c95c246146 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline char * const  _Funcstrings_boost_0x60_join_e037aa8a889146d3 ( Context * __context__, TDim<int32_t,1> const  &  __it_rename_at_17, char * const  __separator_rename_at_17 )
+{
+	char * __st_rename_at_22 = ((char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_22)->void{
+		bool __skip_first_rename_at_23 = true;
+		{
+			uint64_t __loop_count_24 = UINT64_MAX;
+			// elem : int const&
+			das_iterator<TDim<int32_t,1> const > __elem_iterator(__it_rename_at_17);
+			int32_t const  * __elem_rename_at_24;
+			__loop_count_24 = das_loop_count(__loop_count_24,__elem_iterator.loop_begin(__context__,(__elem_rename_at_24)));
+			for ( ; __loop_count_24 ; --__loop_count_24, ++__elem_rename_at_24 )
+			{
+				if ( __skip_first_rename_at_23 )
+				{
+					das_copy(__skip_first_rename_at_23,false);
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<StringBuilderWriter &>::from(__writer_rename_at_22),cast<char * const >::from(__separator_rename_at_17)));
+				};
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_1,cast<StringBuilderWriter &>::from(__writer_rename_at_22),cast<int32_t>::from((*__elem_rename_at_24))));
+			}
+			__elem_iterator.loop_end(__context__,(__elem_rename_at_24));
+		};
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))));
+	return das_auto_cast<char * const >::cast(__st_rename_at_22);
+}
+
+inline char * const  _Funcstrings_boost_0x60_join_5f0ee9ad9a015be2 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_17, char * const  __separator_rename_at_17 )
+{
+	char * __st_rename_at_22 = ((char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_22)->void{
+		bool __skip_first_rename_at_23 = true;
+		{
+			bool __need_loop_24 = true;
+			// elem : int const
+			das_iterator<Sequence DAS_COMMENT((int32_t)) const > __elem_iterator(__it_rename_at_17);
+			int32_t __elem_rename_at_24;
+			__need_loop_24 = __elem_iterator.first(__context__,(__elem_rename_at_24)) && __need_loop_24;
+			for ( ; __need_loop_24 ; __need_loop_24 = __elem_iterator.next(__context__,(__elem_rename_at_24)) )
+			{
+				if ( __skip_first_rename_at_23 )
+				{
+					das_copy(__skip_first_rename_at_23,false);
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_2,cast<StringBuilderWriter &>::from(__writer_rename_at_22),cast<char * const >::from(__separator_rename_at_17)));
+				};
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_3,cast<StringBuilderWriter &>::from(__writer_rename_at_22),cast<int32_t>::from(__elem_rename_at_24)));
+			}
+			__elem_iterator.close(__context__,(__elem_rename_at_24));
+		};
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))));
+	return das_auto_cast<char * const >::cast(__st_rename_at_22);
+}
+
+inline char * const  _Funcstrings_boost_0x60_join_a32510cbf2dd5518 ( Context * __context__, TDim<int32_t,4> const  &  __it_rename_at_17, char * const  __separator_rename_at_17 )
+{
+	char * __st_rename_at_22 = ((char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_22)->void{
+		bool __skip_first_rename_at_23 = true;
+		{
+			uint64_t __loop_count_24 = UINT64_MAX;
+			// elem : int const&
+			das_iterator<TDim<int32_t,4> const > __elem_iterator(__it_rename_at_17);
+			int32_t const  * __elem_rename_at_24;
+			__loop_count_24 = das_loop_count(__loop_count_24,__elem_iterator.loop_begin(__context__,(__elem_rename_at_24)));
+			for ( ; __loop_count_24 ; --__loop_count_24, ++__elem_rename_at_24 )
+			{
+				if ( __skip_first_rename_at_23 )
+				{
+					das_copy(__skip_first_rename_at_23,false);
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_4,cast<StringBuilderWriter &>::from(__writer_rename_at_22),cast<char * const >::from(__separator_rename_at_17)));
+				};
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_5,cast<StringBuilderWriter &>::from(__writer_rename_at_22),cast<int32_t>::from((*__elem_rename_at_24))));
+			}
+			__elem_iterator.loop_end(__context__,(__elem_rename_at_24));
+		};
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))));
+	return das_auto_cast<char * const >::cast(__st_rename_at_22);
+}
+
+inline char * const  _Funcstrings_boost_0x60_join_c1dcb32ad20ca31a ( Context * __context__, TArray<int32_t> const  &  __it_rename_at_17, char * const  __separator_rename_at_17 )
+{
+	char * __st_rename_at_22 = ((char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_22)->void{
+		bool __skip_first_rename_at_23 = true;
+		{
+			uint64_t __loop_count_24 = UINT64_MAX;
+			// elem : int const&
+			das_iterator<TArray<int32_t> const > __elem_iterator(__it_rename_at_17);
+			int32_t const  * __elem_rename_at_24;
+			__loop_count_24 = das_loop_count(__loop_count_24,__elem_iterator.loop_begin(__context__,(__elem_rename_at_24)));
+			for ( ; __loop_count_24 ; --__loop_count_24, ++__elem_rename_at_24 )
+			{
+				if ( __skip_first_rename_at_23 )
+				{
+					das_copy(__skip_first_rename_at_23,false);
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_6,cast<StringBuilderWriter &>::from(__writer_rename_at_22),cast<char * const >::from(__separator_rename_at_17)));
+				};
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_7,cast<StringBuilderWriter &>::from(__writer_rename_at_22),cast<int32_t>::from((*__elem_rename_at_24))));
+			}
+			__elem_iterator.loop_end(__context__,(__elem_rename_at_24));
+		};
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))));
+	return das_auto_cast<char * const >::cast(__st_rename_at_22);
+}
+
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_75, int32_t __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_75),4,__context__),__context__),__value_rename_at_75);
+}
+
+inline char * const  _Funcstrings_boost_0x60_join_a335f7954d6ee570 ( Context * __context__, range __it_rename_at_17, char * const  __separator_rename_at_17 )
+{
+	char * __st_rename_at_22 = ((char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_22)->void{
+		bool __skip_first_rename_at_23 = true;
+		{
+			uint64_t __loop_count_24 = UINT64_MAX;
+			// elem : int const
+			das_iterator<range> __elem_iterator(__it_rename_at_17);
+			int32_t __elem_rename_at_24;
+			__loop_count_24 = das_loop_count(__loop_count_24,__elem_iterator.loop_begin(__context__,(__elem_rename_at_24)));
+			for ( ; __loop_count_24 ; --__loop_count_24, ++__elem_rename_at_24 )
+			{
+				if ( __skip_first_rename_at_23 )
+				{
+					das_copy(__skip_first_rename_at_23,false);
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_8,cast<StringBuilderWriter &>::from(__writer_rename_at_22),cast<char * const >::from(__separator_rename_at_17)));
+				};
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_9,cast<StringBuilderWriter &>::from(__writer_rename_at_22),cast<int32_t>::from(__elem_rename_at_24)));
+			}
+			__elem_iterator.loop_end(__context__,(__elem_rename_at_24));
+		};
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))));
+	return das_auto_cast<char * const >::cast(__st_rename_at_22);
+}
+
+inline char * const  _Funcstrings_boost_0x60_join_35a2782e4cfa1b7f ( Context * __context__, char * const  __it_rename_at_17, char * const  __separator_rename_at_17 )
+{
+	char * __st_rename_at_22 = ((char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_22)->void{
+		bool __skip_first_rename_at_23 = true;
+		{
+			bool __need_loop_24 = true;
+			// elem : int const
+			das_iterator<char * const > __elem_iterator(__it_rename_at_17);
+			int32_t __elem_rename_at_24;
+			__need_loop_24 = __elem_iterator.first(__context__,(__elem_rename_at_24)) && __need_loop_24;
+			for ( ; __need_loop_24 ; __need_loop_24 = __elem_iterator.next(__context__,(__elem_rename_at_24)) )
+			{
+				if ( __skip_first_rename_at_23 )
+				{
+					das_copy(__skip_first_rename_at_23,false);
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_10,cast<StringBuilderWriter &>::from(__writer_rename_at_22),cast<char * const >::from(__separator_rename_at_17)));
+				};
+				write_string_char(das_arg<StringBuilderWriter>::pass(__writer_rename_at_22),__elem_rename_at_24);
+			}
+			__elem_iterator.close(__context__,(__elem_rename_at_24));
+		};
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))));
+	return das_auto_cast<char * const >::cast(__st_rename_at_22);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_5cbab1dfe9635bc1 ( Context * __context__, range __rng_rename_at_345 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_346; das_zero(__it_rename_at_346);
+	builtin_make_range_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_346),__rng_rename_at_345,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_346);
+}
+
+inline bool test_63e198c95c246146 ( Context * __context__ )
+{
+	TDim<int32_t,1> _temp_make_local_6_32;
+	TDim<int32_t,4> _temp_make_local_7_48;
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boost_0x60_join_e037aa8a889146d3(__context__,das_arg<TDim<int32_t,1>>::pass((([&]() -> TDim<int32_t,1>& {
+		_temp_make_local_6_32(0,__context__) = 1;
+		return _temp_make_local_6_32;
+	})())),((char *) ","))),cast<char *>::from(((char *) "1")),*__context__,nullptr)));
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boost_0x60_join_a32510cbf2dd5518(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+		_temp_make_local_7_48(0,__context__) = 1;
+		_temp_make_local_7_48(1,__context__) = 2;
+		_temp_make_local_7_48(2,__context__) = 3;
+		_temp_make_local_7_48(3,__context__) = 4;
+		return _temp_make_local_7_48;
+	})())),((char *) ","))),cast<char *>::from(((char *) "1,2,3,4")),*__context__,nullptr)));
+	TArray<int32_t> __a_rename_at_9; das_zero(__a_rename_at_9);
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boost_0x60_join_c1dcb32ad20ca31a(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_9),((char *) " "))),cast<char *>::from(nullptr),*__context__,nullptr)));
+	_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_9),1);
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boost_0x60_join_c1dcb32ad20ca31a(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_9),((char *) "."))),cast<char *>::from(((char *) "1")),*__context__,nullptr)));
+	_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_9),2);
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boost_0x60_join_c1dcb32ad20ca31a(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_9),((char *) "."))),cast<char *>::from(((char *) "1.2")),*__context__,nullptr)));
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boost_0x60_join_a335f7954d6ee570(__context__,range(1,4),((char *) "-"))),cast<char *>::from(((char *) "1-2-3")),*__context__,nullptr)));
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boost_0x60_join_35a2782e4cfa1b7f(__context__,((char *) "hello"),((char *) " "))),cast<char *>::from(((char *) "h e l l o")),*__context__,nullptr)));
+	Sequence DAS_COMMENT((int32_t)) __rit_rename_at_20_ConstRef; das_zero(__rit_rename_at_20_ConstRef); das_move(__rit_rename_at_20_ConstRef, ((Sequence DAS_COMMENT((int32_t)))_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(1,4))));
+	Sequence DAS_COMMENT((int32_t)) const  & __rit_rename_at_20 = __rit_rename_at_20_ConstRef; ;
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boost_0x60_join_5f0ee9ad9a015be2(__context__,__rit_rename_at_20,((char *) "*"))),cast<char *>::from(((char *) "1*2*3")),*__context__,nullptr)));
+	return das_auto_cast<bool>::cast(true);
+}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcstrings_boost_0x60_join_e037aa8a889146d3
+	aotLib[0x424a4f4c2f77e9d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, TDim<int32_t,1> const  & , char * const   ),&_Funcstrings_boost_0x60_join_e037aa8a889146d3>>();
+	};
+	// _Funcstrings_boost_0x60_join_5f0ee9ad9a015be2
+	aotLib[0x23cdd556e7ecb3d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & , char * const   ),&_Funcstrings_boost_0x60_join_5f0ee9ad9a015be2>>();
+	};
+	// _Funcstrings_boost_0x60_join_a32510cbf2dd5518
+	aotLib[0xbddab884697331ed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, TDim<int32_t,4> const  & , char * const   ),&_Funcstrings_boost_0x60_join_a32510cbf2dd5518>>();
+	};
+	// _Funcstrings_boost_0x60_join_c1dcb32ad20ca31a
+	aotLib[0xa837ce29df3c92f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, TArray<int32_t> const  & , char * const   ),&_Funcstrings_boost_0x60_join_c1dcb32ad20ca31a>>();
+	};
+	// _Funcbuiltin_0x60_push_d21751720b4df10e
+	aotLib[0x9fb5b63c22625999] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_d21751720b4df10e>>();
+	};
+	// _Funcstrings_boost_0x60_join_a335f7954d6ee570
+	aotLib[0xc02f439f122469a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, range , char * const   ),&_Funcstrings_boost_0x60_join_a335f7954d6ee570>>();
+	};
+	// _Funcstrings_boost_0x60_join_35a2782e4cfa1b7f
+	aotLib[0x13ea5a375199fcd1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, char * const  , char * const   ),&_Funcstrings_boost_0x60_join_35a2782e4cfa1b7f>>();
+	};
+	// _Funcbuiltin_0x60_each_5cbab1dfe9635bc1
+	aotLib[0x8c2bf3089ff8b6f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, range  ),&_Funcbuiltin_0x60_each_5cbab1dfe9635bc1>>();
+	};
+	// test_63e198c95c246146
+	aotLib[0xdfd6f0daae5bfb63] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_63e198c95c246146>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,348 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_15284454922743948949 {
+
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__ab623c79443cb772;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__90f5707b5a6f641;
+extern TypeInfo __type_info__3ceb21b1e6727087;
+extern VarInfo __var_info__2b53753c9e06b87e;
+extern VarInfo __var_info__7ebc384e9ad54cf5;
+extern VarInfo __var_info__4db606ebbb415df4;
+extern VarInfo __var_info__b860b353cf55600d;
+extern VarInfo __var_info__e8a86008e72808fa;
+extern VarInfo __var_info__c7c61dae2d1d01b4;
+extern FuncInfo __func_info__7b907b9bb53120a1;
+extern FuncInfo __func_info__39e68453484bfe78;
+extern FuncInfo __func_info__d288526b39488ae2;
+extern FuncInfo __func_info__987684a7db7b0827;
+extern FuncInfo __func_info__e9a029d22c57d9c0;
+
+VarInfo __func_info__7b907b9bb53120a1_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__90f5707b5a6f641, nullptr, nullptr, nullptr, 0, 0, nullptr, 8428, 8, 0xe8a86008e72808faul, "data", 0 };
+VarInfo __func_info__7b907b9bb53120a1_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, 0x4db606ebbb415df4ul, "size", 0 };
+VarInfo * __func_info__7b907b9bb53120a1_fields[2] =  { &__func_info__7b907b9bb53120a1_field_0, &__func_info__7b907b9bb53120a1_field_1 };
+FuncInfo __func_info__7b907b9bb53120a1 = {"invoke block<(data:int const? const# implicit;size:int const):void> const", "", __func_info__7b907b9bb53120a1_fields, 2, 32, &__type_info__af63eb4c86020609, nullptr,0,0x7b907b9bb53120a1ul, 0x0 };
+VarInfo __func_info__39e68453484bfe78_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 41154, 24, 0xb860b353cf55600dul, "tarr2", 0 };
+VarInfo * __func_info__39e68453484bfe78_fields[1] =  { &__func_info__39e68453484bfe78_field_0 };
+FuncInfo __func_info__39e68453484bfe78 = {"invoke block<(tarr2:array<int># implicit):void> const", "", __func_info__39e68453484bfe78_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,0x39e68453484bfe78ul, 0x0 };
+VarInfo __func_info__d288526b39488ae2_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 41186, 24, 0xc7c61dae2d1d01b4ul, "tarr", 0 };
+VarInfo * __func_info__d288526b39488ae2_fields[1] =  { &__func_info__d288526b39488ae2_field_0 };
+FuncInfo __func_info__d288526b39488ae2 = {"invoke block<(tarr:array<int> const# implicit):void> const", "", __func_info__d288526b39488ae2_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,0xd288526b39488ae2ul, 0x0 };
+VarInfo __func_info__987684a7db7b0827_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 8396, 8, 0x2b53753c9e06b87eul, "data", 0 };
+VarInfo __func_info__987684a7db7b0827_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, 0x4db606ebbb415df4ul, "size", 0 };
+VarInfo * __func_info__987684a7db7b0827_fields[2] =  { &__func_info__987684a7db7b0827_field_0, &__func_info__987684a7db7b0827_field_1 };
+FuncInfo __func_info__987684a7db7b0827 = {"invoke block<(data:int?# implicit;size:int const):void> const", "", __func_info__987684a7db7b0827_fields, 2, 32, &__type_info__af63eb4c86020609, nullptr,0,0x987684a7db7b0827ul, 0x0 };
+VarInfo __func_info__e9a029d22c57d9c0_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__ab623c79443cb772, nullptr, nullptr, nullptr, 0, 0, nullptr, 41154, 24, 0x7ebc384e9ad54cf5ul, "ftarr", 0 };
+VarInfo * __func_info__e9a029d22c57d9c0_fields[1] =  { &__func_info__e9a029d22c57d9c0_field_0 };
+FuncInfo __func_info__e9a029d22c57d9c0 = {"invoke block<(ftarr:array<UnitTest::TestObjectFoo># implicit):void> const", "", __func_info__e9a029d22c57d9c0_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,0xe9a029d22c57d9c0ul, 0x0 };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xaf63e44c8601fa24ul };
+TypeInfo __type_info__ab623c79443cb772 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~UnitTest::TestObjectFoo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8206, 56, 0xab623c79443cb772ul };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, 0xaf63eb4c86020609ul };
+TypeInfo __type_info__90f5707b5a6f641 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, 0x90f5707b5a6f641ul };
+TypeInfo __type_info__3ceb21b1e6727087 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, 0x3ceb21b1e6727087ul };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__3ceb21b1e6727087 };
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+
+inline TArray<int32_t> & _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd ( Context * __context__, TArray<int32_t> & __a_rename_at_42 );
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> & __Arr_rename_at_75, int32_t __value_rename_at_75 );
+inline void _Funcbuiltin_0x60_lock_12751cddc08bcc29 ( Context * __context__, TArray<int32_t> const  & __a_rename_at_535, Block DAS_COMMENT((void,TArray<int32_t> const )) const  & __blk_rename_at_535 );
+inline void _Funcbuiltin_0x60_lock_data_9f60f83d136f70bc ( Context * __context__, TArray<int32_t> const  & __a_rename_at_551, Block DAS_COMMENT((void,int32_t const  * const ,int32_t)) const  & __blk_rename_at_551 );
+inline void _Funcbuiltin_0x60_lock_data_ff58b4773ba03d68 ( Context * __context__, TArray<int32_t> & __a_rename_at_540, Block DAS_COMMENT((void,int32_t *,int32_t)) const  & __blk_rename_at_540 );
+inline void _Funcbuiltin_0x60_lock_cf3da1f452741925 ( Context * __context__, TArray<int32_t> & __a_rename_at_530, Block DAS_COMMENT((void,TArray<int32_t>)) const  & __blk_rename_at_530 );
+inline void _Funcbuiltin_0x60_push_488225fd8c3c264a ( Context * __context__, TArray<TestObjectFoo> & __Arr_rename_at_75, TestObjectFoo const  & __value_rename_at_75 );
+inline void _Funcbuiltin_0x60_lock_7a0dfef0e8dd2acb ( Context * __context__, TArray<TestObjectFoo> & __a_rename_at_530, Block DAS_COMMENT((void,TArray<TestObjectFoo>)) const  & __blk_rename_at_530 );
+inline bool test_b83aaf3dd844d513 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline TArray<int32_t> & _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd ( Context * __context__, TArray<int32_t> &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<TArray<int32_t> &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<TArray<int32_t> &>::cast(__a_rename_at_42);
+}
+
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_75, int32_t __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_75),4,__context__),__context__),__value_rename_at_75);
+}
+
+inline void _Funcbuiltin_0x60_lock_12751cddc08bcc29 ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_535, Block DAS_COMMENT((void,TArray<int32_t> const )) const  &  __blk_rename_at_535 )
+{
+	builtin_array_lock(__a_rename_at_535,__context__);
+	das_invoke<void>::invoke<TArray<int32_t> const  &>(__context__,nullptr,__blk_rename_at_535,__a_rename_at_535);
+	builtin_array_unlock(__a_rename_at_535,__context__);
+}
+
+inline void _Funcbuiltin_0x60_lock_data_9f60f83d136f70bc ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_551, Block DAS_COMMENT((void,int32_t const  * const ,int32_t)) const  &  __blk_rename_at_551 )
+{
+	int32_t __len_rename_at_552 = ((int32_t)builtin_array_size(__a_rename_at_551));
+	if ( __len_rename_at_552 != 0 )
+	{
+		builtin_array_lock(__a_rename_at_551,__context__);
+		das_invoke<void>::invoke<int32_t const  * const ,int32_t>(__context__,nullptr,__blk_rename_at_551,das_ref(__context__,__a_rename_at_551(0,__context__)),__len_rename_at_552);
+		builtin_array_unlock(__a_rename_at_551,__context__);
+	} else {
+		das_invoke<void>::invoke<void * const ,int32_t>(__context__,nullptr,__blk_rename_at_551,nullptr,0);
+	};
+}
+
+inline void _Funcbuiltin_0x60_lock_data_ff58b4773ba03d68 ( Context * __context__, TArray<int32_t> &  __a_rename_at_540, Block DAS_COMMENT((void,int32_t *,int32_t)) const  &  __blk_rename_at_540 )
+{
+	int32_t __len_rename_at_541 = ((int32_t)builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_540)));
+	if ( __len_rename_at_541 != 0 )
+	{
+		builtin_array_lock(das_arg<TArray<int32_t>>::pass(__a_rename_at_540),__context__);
+		das_invoke<void>::invoke<int32_t *,int32_t>(__context__,nullptr,__blk_rename_at_540,das_ref(__context__,__a_rename_at_540(0,__context__)),__len_rename_at_541);
+		builtin_array_unlock(das_arg<TArray<int32_t>>::pass(__a_rename_at_540),__context__);
+	} else {
+		int32_t * __nullT_rename_at_548 = 0;
+		das_invoke<void>::invoke<int32_t *,int32_t>(__context__,nullptr,__blk_rename_at_540,__nullT_rename_at_548,0);
+	};
+}
+
+inline void _Funcbuiltin_0x60_lock_cf3da1f452741925 ( Context * __context__, TArray<int32_t> &  __a_rename_at_530, Block DAS_COMMENT((void,TArray<int32_t>)) const  &  __blk_rename_at_530 )
+{
+	builtin_array_lock(das_arg<TArray<int32_t>>::pass(__a_rename_at_530),__context__);
+	das_invoke<void>::invoke<TArray<int32_t> &>(__context__,nullptr,__blk_rename_at_530,das_arg<TArray<int32_t>>::pass(__a_rename_at_530));
+	builtin_array_unlock(das_arg<TArray<int32_t>>::pass(__a_rename_at_530),__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_488225fd8c3c264a ( Context * __context__, TArray<TestObjectFoo> &  __Arr_rename_at_75, TestObjectFoo const  &  __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<TestObjectFoo>>::pass(__Arr_rename_at_75),56,__context__),__context__),__value_rename_at_75);
+}
+
+inline void _Funcbuiltin_0x60_lock_7a0dfef0e8dd2acb ( Context * __context__, TArray<TestObjectFoo> &  __a_rename_at_530, Block DAS_COMMENT((void,TArray<TestObjectFoo>)) const  &  __blk_rename_at_530 )
+{
+	builtin_array_lock(das_arg<TArray<TestObjectFoo>>::pass(__a_rename_at_530),__context__);
+	das_invoke<void>::invoke<TArray<TestObjectFoo> &>(__context__,nullptr,__blk_rename_at_530,das_arg<TArray<TestObjectFoo>>::pass(__a_rename_at_530));
+	builtin_array_unlock(das_arg<TArray<TestObjectFoo>>::pass(__a_rename_at_530),__context__);
+}
+
+inline bool test_b83aaf3dd844d513 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,864,"test " DAS_FILE_LINE);
+{
+	TestObjectFoo _temp_make_local_26_720;
+	TArray<int32_t> __arr_rename_at_6_ConstRef; das_zero(__arr_rename_at_6_ConstRef); das_move(__arr_rename_at_6_ConstRef, ((TArray<int32_t>)das_invoke<TArray<int32_t>>::invoke_cmres(__context__,nullptr,[&]()->TArray<int32_t>{
+		TArray<int32_t> ____acomp_6_rename_at_6; das_zero(____acomp_6_rename_at_6);
+		{
+			uint64_t __loop_count_6 = UINT64_MAX;
+			// x : int const
+			das_iterator<range> __x_iterator(range(0,10));
+			int32_t __x_rename_at_6;
+			__loop_count_6 = das_loop_count(__loop_count_6,__x_iterator.loop_begin(__context__,(__x_rename_at_6)));
+			for ( ; __loop_count_6 ; --__loop_count_6, ++__x_rename_at_6 )
+			{
+				_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(____acomp_6_rename_at_6),__x_rename_at_6);
+			}
+			__x_iterator.loop_end(__context__,(__x_rename_at_6));
+		};
+		return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd(__context__,das_arg<TArray<int32_t>>::pass(____acomp_6_rename_at_6)));
+	})));
+	TArray<int32_t> const  & __arr_rename_at_6 = __arr_rename_at_6_ConstRef; ;
+	_Funcbuiltin_0x60_lock_12751cddc08bcc29(__context__,__arr_rename_at_6,das_make_block<void,TArray<int32_t> const  &>(__context__,224,0,&__func_info__d288526b39488ae2,[&](TArray<int32_t> const  & __tarr_rename_at_7)->void{
+		{
+			uint64_t __loop_count_8 = UINT64_MAX;
+			// a : int const&
+			das_iterator<TArray<int32_t> const > __a_iterator(__arr_rename_at_6);
+			int32_t const  * __a_rename_at_8;
+			__loop_count_8 = das_loop_count(__loop_count_8,__a_iterator.loop_begin(__context__,(__a_rename_at_8)));
+			// b : int const&#
+			das_iterator<TArray<int32_t> const > __b_iterator(__tarr_rename_at_7);
+			int32_t const  * __b_rename_at_8;
+			__loop_count_8 = das_loop_count(__loop_count_8,__b_iterator.loop_begin(__context__,(__b_rename_at_8)));
+			for ( ; __loop_count_8 ; --__loop_count_8, ++__a_rename_at_8, ++__b_rename_at_8 )
+			{
+				DAS_ASSERT(((*__a_rename_at_8) == (*__b_rename_at_8)));
+			}
+			__a_iterator.loop_end(__context__,(__a_rename_at_8));
+			__b_iterator.loop_end(__context__,(__b_rename_at_8));
+		};
+	}));
+	_Funcbuiltin_0x60_lock_data_9f60f83d136f70bc(__context__,__arr_rename_at_6,das_make_block<void,int32_t const  * const ,int32_t>(__context__,320,0,&__func_info__7b907b9bb53120a1,[&](int32_t const  * const  __data_rename_at_10, int32_t const  __size_rename_at_10)->void{
+		{
+			uint64_t __loop_count_11 = UINT64_MAX;
+			// j : int const
+			das_iterator<range> __j_iterator(range(0,10));
+			int32_t __j_rename_at_11;
+			__loop_count_11 = das_loop_count(__loop_count_11,__j_iterator.loop_begin(__context__,(__j_rename_at_11)));
+			for ( ; __loop_count_11 ; --__loop_count_11, ++__j_rename_at_11 )
+			{
+				DAS_ASSERT((das_index<int32_t const  * const >::at(__data_rename_at_10,__j_rename_at_11,__context__) == __j_rename_at_11));
+			}
+			__j_iterator.loop_end(__context__,(__j_rename_at_11));
+		};
+	}));
+	TArray<int32_t> __arr2_rename_at_14; das_zero(__arr2_rename_at_14); das_move(__arr2_rename_at_14, das_invoke<TArray<int32_t>>::invoke_cmres(__context__,nullptr,[&]()->TArray<int32_t>{
+		TArray<int32_t> ____acomp_14_rename_at_14; das_zero(____acomp_14_rename_at_14);
+		{
+			uint64_t __loop_count_14 = UINT64_MAX;
+			// x : int const
+			das_iterator<range> __x_iterator(range(0,10));
+			int32_t __x_rename_at_14;
+			__loop_count_14 = das_loop_count(__loop_count_14,__x_iterator.loop_begin(__context__,(__x_rename_at_14)));
+			for ( ; __loop_count_14 ; --__loop_count_14, ++__x_rename_at_14 )
+			{
+				_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(____acomp_14_rename_at_14),__x_rename_at_14);
+			}
+			__x_iterator.loop_end(__context__,(__x_rename_at_14));
+		};
+		return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd(__context__,das_arg<TArray<int32_t>>::pass(____acomp_14_rename_at_14)));
+	}));
+	_Funcbuiltin_0x60_lock_data_ff58b4773ba03d68(__context__,das_arg<TArray<int32_t>>::pass(__arr2_rename_at_14),das_make_block<void,int32_t *,int32_t>(__context__,544,0,&__func_info__987684a7db7b0827,[&](int32_t * __data_rename_at_15, int32_t const  __size_rename_at_15)->void{
+		{
+			uint64_t __loop_count_16 = UINT64_MAX;
+			// j : int const
+			das_iterator<range> __j_iterator(range(0,10));
+			int32_t __j_rename_at_16;
+			__loop_count_16 = das_loop_count(__loop_count_16,__j_iterator.loop_begin(__context__,(__j_rename_at_16)));
+			for ( ; __loop_count_16 ; --__loop_count_16, ++__j_rename_at_16 )
+			{
+				das_copy(das_index<int32_t *>::at(__data_rename_at_15,__j_rename_at_16,__context__),__j_rename_at_16 * 2);
+			}
+			__j_iterator.loop_end(__context__,(__j_rename_at_16));
+		};
+	}));
+	{
+		uint64_t __loop_count_19 = UINT64_MAX;
+		// j : int const
+		das_iterator<range> __j_iterator(range(0,10));
+		int32_t __j_rename_at_19;
+		__loop_count_19 = das_loop_count(__loop_count_19,__j_iterator.loop_begin(__context__,(__j_rename_at_19)));
+		for ( ; __loop_count_19 ; --__loop_count_19, ++__j_rename_at_19 )
+		{
+			DAS_ASSERT((__arr2_rename_at_14(__j_rename_at_19,__context__) == (__j_rename_at_19 * 2)));
+		}
+		__j_iterator.loop_end(__context__,(__j_rename_at_19));
+	};
+	_Funcbuiltin_0x60_lock_cf3da1f452741925(__context__,das_arg<TArray<int32_t>>::pass(__arr2_rename_at_14),das_make_block<void,TArray<int32_t> &>(__context__,640,0,&__func_info__39e68453484bfe78,[&](TArray<int32_t> & __tarr2_rename_at_21)->void{
+		{
+			uint64_t __loop_count_22 = UINT64_MAX;
+			// a : int&
+			das_iterator<TArray<int32_t>> __a_iterator(__arr2_rename_at_14);
+			int32_t * __a_rename_at_22;
+			__loop_count_22 = das_loop_count(__loop_count_22,__a_iterator.loop_begin(__context__,(__a_rename_at_22)));
+			// b : int&#
+			das_iterator<TArray<int32_t>> __b_iterator(__tarr2_rename_at_21);
+			int32_t * __b_rename_at_22;
+			__loop_count_22 = das_loop_count(__loop_count_22,__b_iterator.loop_begin(__context__,(__b_rename_at_22)));
+			for ( ; __loop_count_22 ; --__loop_count_22, ++__a_rename_at_22, ++__b_rename_at_22 )
+			{
+				DAS_ASSERT(((*__a_rename_at_22) == (*__b_rename_at_22)));
+			}
+			__a_iterator.loop_end(__context__,(__a_rename_at_22));
+			__b_iterator.loop_end(__context__,(__b_rename_at_22));
+		};
+	}));
+	TArray<TestObjectFoo> __farr_rename_at_25; das_zero(__farr_rename_at_25);
+	_Funcbuiltin_0x60_push_488225fd8c3c264a(__context__,das_arg<TArray<TestObjectFoo>>::pass(__farr_rename_at_25),das_arg<TestObjectFoo>::pass((([&]() -> TestObjectFoo& {
+		das_zero(_temp_make_local_26_720);
+		return _temp_make_local_26_720;
+	})())));
+	_Funcbuiltin_0x60_lock_7a0dfef0e8dd2acb(__context__,das_arg<TArray<TestObjectFoo>>::pass(__farr_rename_at_25),das_make_block<void,TArray<TestObjectFoo> &>(__context__,832,0,&__func_info__e9a029d22c57d9c0,[&](TArray<TestObjectFoo> & __ftarr_rename_at_27)->void{
+		TestObjectFoo * __q_rename_at_28 = das_ref(__context__,__ftarr_rename_at_27(0,__context__));
+		set_foo_data(__q_rename_at_28,1234);
+	}));
+	DAS_ASSERT((__farr_rename_at_25(0,__context__).fooData /*fooData*/ == 1234));
+	return das_auto_cast<bool>::cast(true);
+}}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd
+	aotLib[0x66e322246598e835] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TArray<int32_t> & (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd>>();
+	};
+	// _Funcbuiltin_0x60_push_d21751720b4df10e
+	aotLib[0x9fb5b63c22625999] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_d21751720b4df10e>>();
+	};
+	// _Funcbuiltin_0x60_lock_12751cddc08bcc29
+	aotLib[0xd769e7cfca5cfe45] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> const  & , Block DAS_COMMENT((void,TArray<int32_t> const )) const  &  ),&_Funcbuiltin_0x60_lock_12751cddc08bcc29>>();
+	};
+	// _Funcbuiltin_0x60_lock_data_9f60f83d136f70bc
+	aotLib[0xa379dc67d2f431e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> const  & , Block DAS_COMMENT((void,int32_t const  * const ,int32_t)) const  &  ),&_Funcbuiltin_0x60_lock_data_9f60f83d136f70bc>>();
+	};
+	// _Funcbuiltin_0x60_lock_data_ff58b4773ba03d68
+	aotLib[0xed85ea3eb7c16a85] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , Block DAS_COMMENT((void,int32_t *,int32_t)) const  &  ),&_Funcbuiltin_0x60_lock_data_ff58b4773ba03d68>>();
+	};
+	// _Funcbuiltin_0x60_lock_cf3da1f452741925
+	aotLib[0x2ef43f191c373e85] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , Block DAS_COMMENT((void,TArray<int32_t>)) const  &  ),&_Funcbuiltin_0x60_lock_cf3da1f452741925>>();
+	};
+	// _Funcbuiltin_0x60_push_488225fd8c3c264a
+	aotLib[0xa301beabbc4f8e55] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TestObjectFoo> & , TestObjectFoo const  &  ),&_Funcbuiltin_0x60_push_488225fd8c3c264a>>();
+	};
+	// _Funcbuiltin_0x60_lock_7a0dfef0e8dd2acb
+	aotLib[0x18ba0fb07aece389] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TestObjectFoo> & , Block DAS_COMMENT((void,TArray<TestObjectFoo>)) const  &  ),&_Funcbuiltin_0x60_lock_7a0dfef0e8dd2acb>>();
+	};
+	// test_b83aaf3dd844d513
+	aotLib[0x2d3b8c9fc6aae105] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_b83aaf3dd844d513>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
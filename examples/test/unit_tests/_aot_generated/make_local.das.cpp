@@ -0,0 +1,179 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_11905183463044903254 {
+
+
+
+namespace  { struct Bar; };
+namespace  { struct Foo; };
+namespace  {
+
+struct Bar {
+	int32_t x;
+	int32_t y;
+	int32_t z;
+	int32_t w;
+};
+static_assert(sizeof(Bar)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Bar,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Bar,y)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Bar,z)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Bar,w)==12,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Foo {
+	int32_t i;
+	float f;
+	char * s;
+};
+static_assert(sizeof(Foo)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,i)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,f)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,s)==8,"structure field offset mismatch with DAS");
+}
+
+inline bool test_e012f022a5719d3d ( Context * __context__ );
+inline Foo Foo_c7da4e85d01eda83 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<Foo,0xff0853fffb359c63>(__context__) = Foo_c7da4e85d01eda83(__context__);/*testFoo*/
+	das_global<Foo,0x28c20ad8e5bb65fd>(__context__) = (([&]() -> Foo {
+		Foo __mks_27;
+		das_copy((__mks_27.i),(3));
+		das_copy((__mks_27.f),(4.f));
+		das_copy((__mks_27.s),(((char *) "blah")));
+		return __mks_27;
+	})());/*jestFoo*/
+}
+
+inline bool test_e012f022a5719d3d ( Context * __context__ )
+{
+	DAS_ASSERT((((das_global<Foo,0xff0853fffb359c63>(__context__) /*testFoo*/.i == 5) && (das_global<Foo,0xff0853fffb359c63>(__context__) /*testFoo*/.f == 6.f)) && (SimPolicy<char *>::Equ(cast<char *>::from(das_global<Foo,0xff0853fffb359c63>(__context__) /*testFoo*/.s),cast<char *>::from(((char *) "hello")),*__context__,nullptr))));
+	DAS_ASSERT((((das_global<Foo,0x28c20ad8e5bb65fd>(__context__) /*jestFoo*/.i == 3) && (das_global<Foo,0x28c20ad8e5bb65fd>(__context__) /*jestFoo*/.f == 4.f)) && (SimPolicy<char *>::Equ(cast<char *>::from(das_global<Foo,0x28c20ad8e5bb65fd>(__context__) /*jestFoo*/.s),cast<char *>::from(((char *) "blah")),*__context__,nullptr))));
+	Foo __t_rename_at_34_ConstRef = ((Foo)Foo_c7da4e85d01eda83(__context__));
+	Foo const  & __t_rename_at_34 = __t_rename_at_34_ConstRef; ;
+	DAS_ASSERT((__t_rename_at_34.i == 5));
+	DAS_ASSERT((__t_rename_at_34.f == 6.f));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__t_rename_at_34.s),cast<char *>::from(((char *) "hello")),*__context__,nullptr)));
+	Foo __q_rename_at_38_ConstRef = ((Foo)(([&]() -> Foo {
+		Foo __mks_38;
+		das_zero(__mks_38);
+		das_copy((__mks_38.i),(6));
+		das_copy((__mks_38.s),(((char *) "world")));
+		return __mks_38;
+	})()));
+	Foo const  & __q_rename_at_38 = __q_rename_at_38_ConstRef; ;
+	DAS_ASSERT((__q_rename_at_38.i == 6));
+	DAS_ASSERT((__q_rename_at_38.f == 0.f));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__q_rename_at_38.s),cast<char *>::from(((char *) "world")),*__context__,nullptr)));
+	TDim<Foo,3> __qq3_rename_at_42_ConstRef = ((TDim<Foo,3>)(([&]() -> TDim<Foo,3> {
+		TDim<Foo,3> __mks_42;
+		das_zero(__mks_42);
+		das_copy((__mks_42(0,__context__).i),(1));
+		das_copy((__mks_42(1,__context__).i),(2));
+		das_copy((__mks_42(2,__context__).i),(3));
+		return __mks_42;
+	})()));
+	TDim<Foo,3> const  & __qq3_rename_at_42 = __qq3_rename_at_42_ConstRef; ;
+	DAS_ASSERT((((__qq3_rename_at_42(0,__context__).i == 1) && (__qq3_rename_at_42(1,__context__).i == 2)) && (__qq3_rename_at_42(2,__context__).i == 3)));
+	TDim<int32_t,4> __ar_rename_at_44_ConstRef = ((TDim<int32_t,4>)(([&]() -> TDim<int32_t,4> {
+		TDim<int32_t,4> __mka_44;
+		__mka_44(0,__context__) = 1;
+		__mka_44(1,__context__) = 2;
+		__mka_44(2,__context__) = 3;
+		__mka_44(3,__context__) = 4;
+		return __mka_44;
+	})()));
+	TDim<int32_t,4> const  & __ar_rename_at_44 = __ar_rename_at_44_ConstRef; ;
+	DAS_ASSERT(((((__ar_rename_at_44(0,__context__) == 1) && (__ar_rename_at_44(1,__context__) == 2)) && (__ar_rename_at_44(2,__context__) == 3)) && (__ar_rename_at_44(3,__context__) == 4)));
+	TDim<Foo,2> __arf_rename_at_46_ConstRef = ((TDim<Foo,2>)(([&]() -> TDim<Foo,2> {
+		TDim<Foo,2> __mka_46;
+		__mka_46(0,__context__) = Foo_c7da4e85d01eda83(__context__);
+		__mka_46(1,__context__) = Foo_c7da4e85d01eda83(__context__);
+		return __mka_46;
+	})()));
+	TDim<Foo,2> const  & __arf_rename_at_46 = __arf_rename_at_46_ConstRef; ;
+	DAS_ASSERT(((__arf_rename_at_46(0,__context__).i == 5) && (__arf_rename_at_46(1,__context__).i == 5)));
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline Foo Foo_c7da4e85d01eda83 ( Context * __context__ )
+{
+	return das_auto_cast_ref<Foo>::cast((([&]() -> Foo {
+		Foo __mks_18;
+		das_copy((__mks_18.i),(5));
+		das_copy((__mks_18.f),(6.f));
+		das_copy((__mks_18.s),(((char *) "hello")));
+		return __mks_18;
+	})()));
+}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// test_e012f022a5719d3d
+	aotLib[0xa8340a3a2ba688ee] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_e012f022a5719d3d>>();
+	};
+	// Foo_c7da4e85d01eda83
+	aotLib[0x6fd29ff652c6a289] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__ ),&Foo_c7da4e85d01eda83>>();
+	};
+	// [[ init script ]]
+	aotLib[0xa5937cf4d1e5bec0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
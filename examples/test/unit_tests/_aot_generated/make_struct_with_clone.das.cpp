@@ -0,0 +1,243 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_398701858841431669 {
+
+extern TypeInfo __type_info__90f3d07b5a6ca13;
+extern TypeInfo __type_info__f95678735cf0e442;
+extern TypeInfo __type_info__90f5707b5a6f641;
+
+TypeInfo __type_info__90f3d07b5a6ca13 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, 0x90f3d07b5a6ca13ul };
+TypeInfo __type_info__f95678735cf0e442 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~strings::StringBuilderWriter"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 288, 0xf95678735cf0e442ul };
+TypeInfo __type_info__90f5707b5a6f641 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, 0x90f5707b5a6f641ul };
+
+TypeInfo * __tinfo_0[2] = { &__type_info__f95678735cf0e442, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_1[2] = { &__type_info__f95678735cf0e442, &__type_info__90f5707b5a6f641 };
+namespace  { struct Foo; };
+namespace  {
+
+struct Foo {
+	TArray<int32_t> a;
+	char * b;
+};
+static_assert(sizeof(Foo)==32,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,b)==24,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60_clone_4bc3594d348ca0bd ( Context * __context__, TArray<int32_t> & __a_rename_at_249, TArray<int32_t> const  & __b_rename_at_249 );
+inline char * const  _Funcstrings_boost_0x60_join_c1dcb32ad20ca31a ( Context * __context__, TArray<int32_t> const  & __it_rename_at_17, char * const  __separator_rename_at_17 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_f202b192b57688a7 ( Context * __context__, TDim<int32_t,4> & __a_rename_at_412 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_58657389153dbc0f ( Context * __context__, TDim<int32_t,3> & __a_rename_at_412 );
+inline bool test_4b80a469a6f535e ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_clone_4bc3594d348ca0bd ( Context * __context__, TArray<int32_t> &  __a_rename_at_249, TArray<int32_t> const  &  __b_rename_at_249 )
+{
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_249),builtin_array_size(__b_rename_at_249));
+	{
+		uint64_t __loop_count_251 = UINT64_MAX;
+		// aV : int aka TT&
+		das_iterator<TArray<int32_t>> __aV_iterator(__a_rename_at_249);
+		int32_t * __aV_rename_at_251;
+		__loop_count_251 = das_loop_count(__loop_count_251,__aV_iterator.loop_begin(__context__,(__aV_rename_at_251)));
+		// bV : int const&
+		das_iterator<TArray<int32_t> const > __bV_iterator(__b_rename_at_249);
+		int32_t const  * __bV_rename_at_251;
+		__loop_count_251 = das_loop_count(__loop_count_251,__bV_iterator.loop_begin(__context__,(__bV_rename_at_251)));
+		for ( ; __loop_count_251 ; --__loop_count_251, ++__aV_rename_at_251, ++__bV_rename_at_251 )
+		{
+			das_copy((*__aV_rename_at_251),(*__bV_rename_at_251));
+		}
+		__aV_iterator.loop_end(__context__,(__aV_rename_at_251));
+		__bV_iterator.loop_end(__context__,(__bV_rename_at_251));
+	};
+}
+
+inline char * const  _Funcstrings_boost_0x60_join_c1dcb32ad20ca31a ( Context * __context__, TArray<int32_t> const  &  __it_rename_at_17, char * const  __separator_rename_at_17 )
+{
+	char * __st_rename_at_22 = ((char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_22)->void{
+		bool __skip_first_rename_at_23 = true;
+		{
+			uint64_t __loop_count_24 = UINT64_MAX;
+			// elem : int const&
+			das_iterator<TArray<int32_t> const > __elem_iterator(__it_rename_at_17);
+			int32_t const  * __elem_rename_at_24;
+			__loop_count_24 = das_loop_count(__loop_count_24,__elem_iterator.loop_begin(__context__,(__elem_rename_at_24)));
+			for ( ; __loop_count_24 ; --__loop_count_24, ++__elem_rename_at_24 )
+			{
+				if ( __skip_first_rename_at_23 )
+				{
+					das_copy(__skip_first_rename_at_23,false);
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<StringBuilderWriter &>::from(__writer_rename_at_22),cast<char * const >::from(__separator_rename_at_17)));
+				};
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_1,cast<StringBuilderWriter &>::from(__writer_rename_at_22),cast<int32_t>::from((*__elem_rename_at_24))));
+			}
+			__elem_iterator.loop_end(__context__,(__elem_rename_at_24));
+		};
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))));
+	return das_auto_cast<char * const >::cast(__st_rename_at_22);
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_f202b192b57688a7 ( Context * __context__, TDim<int32_t,4> &  __a_rename_at_412 )
+{
+	TArray<int32_t> __arr_rename_at_413; das_zero(__arr_rename_at_413);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_413),4);
+	das_copy(das_cast<TDim<int32_t,4>>::cast(das_ref(__context__,__arr_rename_at_413(0,__context__))),__a_rename_at_412);
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_413);
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_58657389153dbc0f ( Context * __context__, TDim<int32_t,3> &  __a_rename_at_412 )
+{
+	TArray<int32_t> __arr_rename_at_413; das_zero(__arr_rename_at_413);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_413),3);
+	das_copy(das_cast<TDim<int32_t,3>>::cast(das_ref(__context__,__arr_rename_at_413(0,__context__))),__a_rename_at_412);
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_413);
+}
+
+inline bool test_4b80a469a6f535e ( Context * __context__ ) { das_stack_prologue __prologue(__context__,448,"test " DAS_FILE_LINE);
+{
+	TDim<int32_t,4> _temp_make_local_9_64;
+	TDim<int32_t,3> _temp_make_local_10_112;
+	TArray<int32_t> __sa_rename_at_9_ConstRef; das_zero(__sa_rename_at_9_ConstRef); das_move(__sa_rename_at_9_ConstRef, ((TArray<int32_t>)_Funcbuiltin_0x60_to_array_move_f202b192b57688a7(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+		_temp_make_local_9_64(0,__context__) = 1;
+		_temp_make_local_9_64(1,__context__) = 2;
+		_temp_make_local_9_64(2,__context__) = 3;
+		_temp_make_local_9_64(3,__context__) = 4;
+		return _temp_make_local_9_64;
+	})())))));
+	TArray<int32_t> const  & __sa_rename_at_9 = __sa_rename_at_9_ConstRef; ;
+	TArray<int32_t> __sb_rename_at_10_ConstRef; das_zero(__sb_rename_at_10_ConstRef); das_move(__sb_rename_at_10_ConstRef, ((TArray<int32_t>)_Funcbuiltin_0x60_to_array_move_58657389153dbc0f(__context__,das_arg<TDim<int32_t,3>>::pass((([&]() -> TDim<int32_t,3>& {
+		_temp_make_local_10_112(0,__context__) = 1;
+		_temp_make_local_10_112(1,__context__) = 2;
+		_temp_make_local_10_112(2,__context__) = 3;
+		return _temp_make_local_10_112;
+	})())))));
+	TArray<int32_t> const  & __sb_rename_at_10 = __sb_rename_at_10_ConstRef; ;
+	Foo __fa_rename_at_11_ConstRef; das_zero(__fa_rename_at_11_ConstRef); das_move(__fa_rename_at_11_ConstRef, ((Foo)(([&]() -> Foo {
+		Foo __mks_11;
+		das_zero(__mks_11);
+		{
+			_Funcbuiltin_0x60_clone_4bc3594d348ca0bd(__context__,das_arg<TArray<int32_t>>::pass(__mks_11.a),__sa_rename_at_9);
+		}		return __mks_11;
+	})())));
+	Foo const  & __fa_rename_at_11 = __fa_rename_at_11_ConstRef; ;
+	TDim<Foo,2> __fa2_rename_at_12_ConstRef; das_zero(__fa2_rename_at_12_ConstRef); das_move(__fa2_rename_at_12_ConstRef, ((TDim<Foo,2>)(([&]() -> TDim<Foo,2> {
+		TDim<Foo,2> __mks_12;
+		das_zero(__mks_12);
+		{
+			_Funcbuiltin_0x60_clone_4bc3594d348ca0bd(__context__,das_arg<TArray<int32_t>>::pass(__mks_12(1,__context__).a),__sb_rename_at_10);
+			_Funcbuiltin_0x60_clone_4bc3594d348ca0bd(__context__,das_arg<TArray<int32_t>>::pass(__mks_12(0,__context__).a),__sa_rename_at_9);
+		}		return __mks_12;
+	})())));
+	TDim<Foo,2> const  & __fa2_rename_at_12 = __fa2_rename_at_12_ConstRef; ;
+	DAS_ASSERT((builtin_array_size(__sa_rename_at_9) == 4));
+	DAS_ASSERT((builtin_array_size(__fa_rename_at_11.a) == 4));
+	DAS_ASSERT((builtin_array_size(__fa2_rename_at_12(0,__context__).a) == 4));
+	DAS_ASSERT((builtin_array_size(__fa2_rename_at_12(1,__context__).a) == 3));
+	Foo __faw_rename_at_17_ConstRef; das_zero(__faw_rename_at_17_ConstRef); das_move(__faw_rename_at_17_ConstRef, ((Foo)(([&]() -> Foo {
+		Foo __mks_17;
+		das_zero(__mks_17);
+		das_copy((__mks_17.b),(((char *) "a is ")));
+		{
+			_Funcbuiltin_0x60_clone_4bc3594d348ca0bd(__context__,das_arg<TArray<int32_t>>::pass(__mks_17.a),__sa_rename_at_9);
+			SimPolicy<char *>::SetAdd((char *)&(__mks_17.b),cast<char *>::from(_Funcstrings_boost_0x60_join_c1dcb32ad20ca31a(__context__,das_arg<TArray<int32_t>>::pass(__mks_17.a),((char *) "-"))),*__context__,nullptr);
+		}		return __mks_17;
+	})())));
+	Foo const  & __faw_rename_at_17 = __faw_rename_at_17_ConstRef; ;
+	DAS_ASSERT((builtin_array_size(__faw_rename_at_17.a) == 4));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__faw_rename_at_17.b),cast<char *>::from(((char *) "a is 1-2-3-4")),*__context__,nullptr)));
+	return das_auto_cast<bool>::cast(true);
+}}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_resize_ce974596f011d69b
+	aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+	// _Funcbuiltin_0x60_clone_4bc3594d348ca0bd
+	aotLib[0x1366ab6fb285c311] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_clone_4bc3594d348ca0bd>>();
+	};
+	// _Funcstrings_boost_0x60_join_c1dcb32ad20ca31a
+	aotLib[0xa837ce29df3c92f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, TArray<int32_t> const  & , char * const   ),&_Funcstrings_boost_0x60_join_c1dcb32ad20ca31a>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_f202b192b57688a7
+	aotLib[0x984c02de20baa6b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TDim<int32_t,4> &  ),&_Funcbuiltin_0x60_to_array_move_f202b192b57688a7>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_58657389153dbc0f
+	aotLib[0x35e8134f0c6d8065] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TDim<int32_t,3> &  ),&_Funcbuiltin_0x60_to_array_move_58657389153dbc0f>>();
+	};
+	// test_4b80a469a6f535e
+	aotLib[0x9fd070746641975e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_4b80a469a6f535e>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,128 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_2617409150284652474 {
+
+extern TypeInfo __type_info__af63db4c8601ead9;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern VarInfo __var_info__2fcde36e7f449b8a;
+extern FuncInfo __func_info__d157e112bad06aa5;
+
+VarInfo __func_info__d157e112bad06aa5_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63db4c8601ead9, nullptr, nullptr, nullptr, 0, 0, nullptr, 41026, 24, 0x2fcde36e7f449b8aul, "foo", 0 };
+VarInfo * __func_info__d157e112bad06aa5_fields[1] =  { &__func_info__d157e112bad06aa5_field_0 };
+FuncInfo __func_info__d157e112bad06aa5 = {"invoke block<(foo:array<float># -const):void> const", "", __func_info__d157e112bad06aa5_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,0xd157e112bad06aa5ul, 0x0 };
+TypeInfo __type_info__af63db4c8601ead9 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xaf63db4c8601ead9ul };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, 0xaf63eb4c86020609ul };
+
+
+inline void _Funcbuiltin_0x60_map_to_array_3164d8abb5353c56 ( Context * __context__, void * const  __data_rename_at_623, int32_t __len_rename_at_623, Block DAS_COMMENT((void,TArray<float>)) const  & __blk_rename_at_623 );
+inline bool test_a6b52aa4a9516fa2 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_map_to_array_3164d8abb5353c56 ( Context * __context__, void * const  __data_rename_at_623, int32_t __len_rename_at_623, Block DAS_COMMENT((void,TArray<float>)) const  &  __blk_rename_at_623 )
+{
+	DAS_ASSERTF((__data_rename_at_623 != nullptr),(((char *) "expecting data")));
+	DAS_ASSERTF((__len_rename_at_623 > 0),(((char *) "at least 1 element")));
+	int32_t __num_elem_rename_at_627 = ((int32_t)(SimPolicy<int32_t>::Div(__len_rename_at_623,4,*__context__,nullptr)));
+	builtin_temp_array(__data_rename_at_623,__num_elem_rename_at_627,__blk_rename_at_623,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline bool test_a6b52aa4a9516fa2 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,208,"test " DAS_FILE_LINE);
+{
+	TDim<uint32_t,10> __arr_rename_at_4; das_zero(__arr_rename_at_4);
+	void * __pdata_rename_at_5 = das_auto_cast<void *>::cast(das_ref(__context__,__arr_rename_at_4(0,__context__)));
+	_Funcbuiltin_0x60_map_to_array_3164d8abb5353c56(__context__,__pdata_rename_at_5,40,das_make_block<void,TArray<float> &>(__context__,144,0,&__func_info__d157e112bad06aa5,[&](TArray<float> & __foo_rename_at_7)->void{
+		{
+			uint64_t __loop_count_8 = UINT64_MAX;
+			// x : int const
+			das_iterator<range> __x_iterator(range(0,10));
+			int32_t __x_rename_at_8;
+			__loop_count_8 = das_loop_count(__loop_count_8,__x_iterator.loop_begin(__context__,(__x_rename_at_8)));
+			for ( ; __loop_count_8 ; --__loop_count_8, ++__x_rename_at_8 )
+			{
+				das_copy(__foo_rename_at_7(__x_rename_at_8,__context__),float(__x_rename_at_8));
+			}
+			__x_iterator.loop_end(__context__,(__x_rename_at_8));
+		};
+	}));
+	{
+		uint64_t __loop_count_10 = UINT64_MAX;
+		// x : int const
+		das_iterator<range> __x_iterator(range(0,10));
+		int32_t __x_rename_at_10;
+		__loop_count_10 = das_loop_count(__loop_count_10,__x_iterator.loop_begin(__context__,(__x_rename_at_10)));
+		for ( ; __loop_count_10 ; --__loop_count_10, ++__x_rename_at_10 )
+		{
+			float __t_rename_at_11 = ((float)das_cast<float>::cast(__arr_rename_at_4(__x_rename_at_10,__context__)));
+			DAS_ASSERT((float(__x_rename_at_10) == __t_rename_at_11));
+		}
+		__x_iterator.loop_end(__context__,(__x_rename_at_10));
+	};
+	return das_auto_cast<bool>::cast(true);
+}}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_map_to_array_3164d8abb5353c56
+	aotLib[0x98bce6d4007685b5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, void * const  , int32_t , Block DAS_COMMENT((void,TArray<float>)) const  &  ),&_Funcbuiltin_0x60_map_to_array_3164d8abb5353c56>>();
+	};
+	// test_a6b52aa4a9516fa2
+	aotLib[0x8f6ea474fe263d69] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_a6b52aa4a9516fa2>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
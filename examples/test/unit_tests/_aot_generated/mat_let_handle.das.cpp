@@ -0,0 +1,212 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_5386562125123059591 {
+
+
+
+
+inline void test_mat_ac78c10b22102105 ( Context * __context__, float3x4 const  & __m_rename_at_4 );
+inline bool test_transpose_778f4babf5140c9b ( Context * __context__ );
+inline bool test_853b003bfb1a0fc7 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void test_mat_ac78c10b22102105 ( Context * __context__, float3x4 const  &  __m_rename_at_4 )
+{
+	float3x4 __t_rename_at_5 = __m_rename_at_4;
+	{
+		uint64_t __loop_count_6 = UINT64_MAX;
+		// x : int const
+		das_iterator<range> __x_iterator(range(0,3));
+		int32_t __x_rename_at_6;
+		__loop_count_6 = das_loop_count(__loop_count_6,__x_iterator.loop_begin(__context__,(__x_rename_at_6)));
+		for ( ; __loop_count_6 ; --__loop_count_6, ++__x_rename_at_6 )
+		{
+			{
+				uint64_t __loop_count_7 = UINT64_MAX;
+				// y : int const
+				das_iterator<range> __y_iterator(range(0,4));
+				int32_t __y_rename_at_7;
+				__loop_count_7 = das_loop_count(__loop_count_7,__y_iterator.loop_begin(__context__,(__y_rename_at_7)));
+				for ( ; __loop_count_7 ; --__loop_count_7, ++__y_rename_at_7 )
+				{
+					DAS_ASSERT((das_index<float3>::at(das_index<float3x4>::at(__t_rename_at_5,__y_rename_at_7,__context__),__x_rename_at_6,__context__) == float((__y_rename_at_7 * 3) + __x_rename_at_6)));
+					DAS_ASSERT((das_index<float3>::at(das_index<float3x4>::at(__t_rename_at_5,__y_rename_at_7,__context__),__x_rename_at_6,__context__) == das_index<float3 const >::at(das_index<float3x4 const >::at(__m_rename_at_4,__y_rename_at_7,__context__),__x_rename_at_6,__context__)));
+				}
+				__y_iterator.loop_end(__context__,(__y_rename_at_7));
+			};
+		}
+		__x_iterator.loop_end(__context__,(__x_rename_at_6));
+	};
+}
+
+inline bool test_transpose_778f4babf5140c9b ( Context * __context__ )
+{
+	float4x4 _temp_make_local_22_352;
+	float4x4 _temp_make_local_26_736;
+	float4x4 _temp_make_local_26_800;
+	float4x4 __a_rename_at_13; das_zero(__a_rename_at_13); float4x4 __b_rename_at_13; das_zero(__b_rename_at_13);
+	{
+		uint64_t __loop_count_14 = UINT64_MAX;
+		// x : int const
+		das_iterator<range> __x_iterator(range(0,4));
+		int32_t __x_rename_at_14;
+		__loop_count_14 = das_loop_count(__loop_count_14,__x_iterator.loop_begin(__context__,(__x_rename_at_14)));
+		for ( ; __loop_count_14 ; --__loop_count_14, ++__x_rename_at_14 )
+		{
+			{
+				uint64_t __loop_count_15 = UINT64_MAX;
+				// y : int const
+				das_iterator<range> __y_iterator(range(0,4));
+				int32_t __y_rename_at_15;
+				__loop_count_15 = das_loop_count(__loop_count_15,__y_iterator.loop_begin(__context__,(__y_rename_at_15)));
+				for ( ; __loop_count_15 ; --__loop_count_15, ++__y_rename_at_15 )
+				{
+					das_copy(das_index<float4>::at(das_index<float4x4>::at(__a_rename_at_13,__x_rename_at_14,__context__),__y_rename_at_15,__context__),float((__x_rename_at_14 * 4) + __y_rename_at_15));
+					das_copy(das_index<float4>::at(das_index<float4x4>::at(__b_rename_at_13,__x_rename_at_14,__context__),__y_rename_at_15,__context__),float(((__x_rename_at_14 + 1) * 4) + (__y_rename_at_15 + 1)));
+				}
+				__y_iterator.loop_end(__context__,(__y_rename_at_15));
+			};
+		}
+		__x_iterator.loop_end(__context__,(__x_rename_at_14));
+	};
+	float4x4 __ta_rename_at_18_ConstRef = ((float4x4)float4x4_transpose(das_arg<float4x4>::pass(__a_rename_at_13)));
+	float4x4 const  & __ta_rename_at_18 = __ta_rename_at_18_ConstRef; ;
+	{
+		uint64_t __loop_count_19 = UINT64_MAX;
+		// x : int const
+		das_iterator<range> __x_iterator(range(0,4));
+		int32_t __x_rename_at_19;
+		__loop_count_19 = das_loop_count(__loop_count_19,__x_iterator.loop_begin(__context__,(__x_rename_at_19)));
+		for ( ; __loop_count_19 ; --__loop_count_19, ++__x_rename_at_19 )
+		{
+			{
+				uint64_t __loop_count_20 = UINT64_MAX;
+				// y : int const
+				das_iterator<range> __y_iterator(range(0,4));
+				int32_t __y_rename_at_20;
+				__loop_count_20 = das_loop_count(__loop_count_20,__y_iterator.loop_begin(__context__,(__y_rename_at_20)));
+				for ( ; __loop_count_20 ; --__loop_count_20, ++__y_rename_at_20 )
+				{
+					DAS_ASSERT((das_index<float4 const >::at(das_index<float4x4 const >::at(__ta_rename_at_18,__y_rename_at_20,__context__),__x_rename_at_19,__context__) == float((__x_rename_at_19 * 4) + __y_rename_at_20)));
+				}
+				__y_iterator.loop_end(__context__,(__y_rename_at_20));
+			};
+		}
+		__x_iterator.loop_end(__context__,(__x_rename_at_19));
+	};
+	float4x4 __tta_rename_at_22_ConstRef = ((float4x4)float4x4_transpose(das_arg<float4x4>::pass((_temp_make_local_22_352 = (float4x4_transpose(das_arg<float4x4>::pass(__a_rename_at_13)))))));
+	float4x4 const  & __tta_rename_at_22 = __tta_rename_at_22_ConstRef; ;
+	DAS_ASSERT((float4x4_equ(__tta_rename_at_22,das_arg<float4x4>::pass(__a_rename_at_13))));
+	float4x4 __tb_rename_at_24_ConstRef = ((float4x4)float4x4_transpose(das_arg<float4x4>::pass(__b_rename_at_13)));
+	float4x4 const  & __tb_rename_at_24 = __tb_rename_at_24_ConstRef; ;
+	float4x4 __tatb_rename_at_25_ConstRef = ((float4x4)(float4x4_mul(__ta_rename_at_18,__tb_rename_at_24)));
+	float4x4 const  & __tatb_rename_at_25 = __tatb_rename_at_25_ConstRef; ;
+	float4x4 __tatb_opt_rename_at_26_ConstRef = ((float4x4)(float4x4_mul(das_arg<float4x4>::pass((_temp_make_local_26_736 = (float4x4_transpose(das_arg<float4x4>::pass(__a_rename_at_13))))),das_arg<float4x4>::pass((_temp_make_local_26_800 = (float4x4_transpose(das_arg<float4x4>::pass(__b_rename_at_13))))))));
+	float4x4 const  & __tatb_opt_rename_at_26 = __tatb_opt_rename_at_26_ConstRef; ;
+	DAS_ASSERT((float4x4_equ(__tatb_rename_at_25,__tatb_opt_rename_at_26)));
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline bool test_853b003bfb1a0fc7 ( Context * __context__ )
+{
+	float3x4 __m_rename_at_32; das_zero(__m_rename_at_32);
+	{
+		uint64_t __loop_count_33 = UINT64_MAX;
+		// x : int const
+		das_iterator<range> __x_iterator(range(0,3));
+		int32_t __x_rename_at_33;
+		__loop_count_33 = das_loop_count(__loop_count_33,__x_iterator.loop_begin(__context__,(__x_rename_at_33)));
+		for ( ; __loop_count_33 ; --__loop_count_33, ++__x_rename_at_33 )
+		{
+			{
+				uint64_t __loop_count_34 = UINT64_MAX;
+				// y : int const
+				das_iterator<range> __y_iterator(range(0,4));
+				int32_t __y_rename_at_34;
+				__loop_count_34 = das_loop_count(__loop_count_34,__y_iterator.loop_begin(__context__,(__y_rename_at_34)));
+				for ( ; __loop_count_34 ; --__loop_count_34, ++__y_rename_at_34 )
+				{
+					das_copy(das_index<float3>::at(das_index<float3x4>::at(__m_rename_at_32,__y_rename_at_34,__context__),__x_rename_at_33,__context__),float((__y_rename_at_34 * 3) + __x_rename_at_33));
+				}
+				__y_iterator.loop_end(__context__,(__y_rename_at_34));
+			};
+		}
+		__x_iterator.loop_end(__context__,(__x_rename_at_33));
+	};
+	test_mat_ac78c10b22102105(__context__,das_arg<float3x4>::pass(__m_rename_at_32));
+	test_transpose_778f4babf5140c9b(__context__);
+	return das_auto_cast<bool>::cast(true);
+}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// test_mat_ac78c10b22102105
+	aotLib[0xa1be196c130f000d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, float3x4 const  &  ),&test_mat_ac78c10b22102105>>();
+	};
+	// test_transpose_778f4babf5140c9b
+	aotLib[0xb6e7c3dbcb7a0855] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_transpose_778f4babf5140c9b>>();
+	};
+	// test_853b003bfb1a0fc7
+	aotLib[0x822432cc3667f429] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_853b003bfb1a0fc7>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
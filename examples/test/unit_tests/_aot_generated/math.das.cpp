@@ -0,0 +1,154 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_1808465533684236262 {
+
+extern TypeInfo __type_info__90f5007b5a6ea5c;
+extern TypeInfo __type_info__90f3d07b5a6ca13;
+
+TypeInfo __type_info__90f5007b5a6ea5c = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, 0x90f5007b5a6ea5cul };
+TypeInfo __type_info__90f3d07b5a6ca13 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, 0x90f3d07b5a6ca13ul };
+
+TypeInfo * __tinfo_0[5] = { &__type_info__90f5007b5a6ea5c, &__type_info__90f3d07b5a6ca13, &__type_info__90f5007b5a6ea5c, &__type_info__90f3d07b5a6ca13, &__type_info__90f5007b5a6ea5c };
+
+inline int32_t rightPolicyCeili_e8875dc7b7ac0f0d ( Context * __context__, float __a_rename_at_6 );
+inline bool test_5b473bba271b4b12 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline int32_t rightPolicyCeili_e8875dc7b7ac0f0d ( Context * __context__, float __a_rename_at_6 )
+{
+	return das_auto_cast<int32_t>::cast(SimPolicy<float>::Ceili(__a_rename_at_6,*__context__,nullptr));
+}
+
+inline bool test_5b473bba271b4b12 ( Context * __context__ )
+{
+	DAS_ASSERT((true));
+	uint32_t __seed_rename_at_12 = 0x1u;
+	int32_t __position_rename_at_13 = ((int32_t)1);
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((uint_noise1D(__position_rename_at_13,__seed_rename_at_12) != __seed_rename_at_12));
+	DAS_ASSERT((uint_noise2D_int2(int2(100,100),__seed_rename_at_12) != __seed_rename_at_12));
+	DAS_ASSERT((uint_noise3D_int3(int3(100,100,100),__seed_rename_at_12) != __seed_rename_at_12));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_VERIFY((rightPolicyCeili_e8875dc7b7ac0f0d(__context__,1.20000005f) == 2));
+	char * __mme_rename_at_71 = ((char *)(char *)(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_0, cast<float>::from(das_global<float,0xa185b1df226cc7c1>(__context__) /*FLT_MIN*/), cast<char * const >::from(((char *) " ")), cast<float>::from(das_global<float,0xc7a41e1799b91cff>(__context__) /*FLT_MAX*/), cast<char * const >::from(((char *) " ")), cast<float>::from(das_global<float,0xc8f255e6baf41c7f>(__context__) /*FLT_EPSILON*/)))));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__mme_rename_at_71),cast<char *>::from(((char *) "0.000000000 340282346638528859811704183484516925440.000000000 0.000000119")),*__context__,nullptr)));
+	return das_auto_cast<bool>::cast(true);
+}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// rightPolicyCeili_e8875dc7b7ac0f0d
+	aotLib[0x3fc5c565b7a092c1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, float  ),&rightPolicyCeili_e8875dc7b7ac0f0d>>();
+	};
+	// test_5b473bba271b4b12
+	aotLib[0x2ba4a3afc992f91b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_5b473bba271b4b12>>();
+	};
+	// [[ init script ]]
+	aotLib[0xbb0b1cb638b14c54] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
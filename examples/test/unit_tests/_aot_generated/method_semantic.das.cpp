@@ -0,0 +1,135 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_17160119182876748626 {
+
+
+
+namespace  { struct Point; };
+namespace  {
+
+struct Point {
+	float x;
+	float y;
+	Func DAS_COMMENT((float,Point const )) magnitude;
+	Func DAS_COMMENT((float,Point const ,Point const )) dot;
+};
+static_assert(sizeof(Point)==24,"structure size mismatch with DAS");
+static_assert(offsetof(Point,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Point,y)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Point,magnitude)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Point,dot)==16,"structure field offset mismatch with DAS");
+}
+
+inline Point _Func_0x60_Point_207577237388bd06 ( Context * __context__, float __X_rename_at_6, float __Y_rename_at_6 );
+inline float point_magnitude_a291cf2a1d44a90 ( Context * __context__, Point const  & __that_rename_at_9 );
+inline float point_dot_bc8093ba2246bcd9 ( Context * __context__, Point const  & __that_rename_at_12, Point const  & __p_rename_at_12 );
+inline bool test_41a4a5a8ec66c0de ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline Point _Func_0x60_Point_207577237388bd06 ( Context * __context__, float __X_rename_at_6, float __Y_rename_at_6 )
+{
+	return das_auto_cast_ref<Point>::cast((([&]() -> Point {
+		Point __mks_7;
+		das_copy((__mks_7.x),(__X_rename_at_6));
+		das_copy((__mks_7.y),(__Y_rename_at_6));
+		das_copy((__mks_7.magnitude),(Func(__context__->fnByMangledName(/*point_magnitude CS<::Point>*/ 8983661393894889522u))));
+		das_copy((__mks_7.dot),(Func(__context__->fnByMangledName(/*point_dot CS<::Point> CS<::Point>*/ 16516196385285554209u))));
+		return __mks_7;
+	})()));
+}
+
+inline float point_magnitude_a291cf2a1d44a90 ( Context * __context__, Point const  &  __that_rename_at_9 )
+{
+	return das_auto_cast<float>::cast((__that_rename_at_9.x * __that_rename_at_9.x) + (__that_rename_at_9.y * __that_rename_at_9.y));
+}
+
+inline float point_dot_bc8093ba2246bcd9 ( Context * __context__, Point const  &  __that_rename_at_12, Point const  &  __p_rename_at_12 )
+{
+	return das_auto_cast<float>::cast((__that_rename_at_12.x * __p_rename_at_12.x) + (__that_rename_at_12.y * __p_rename_at_12.y));
+}
+
+inline bool test_41a4a5a8ec66c0de ( Context * __context__ )
+{
+	Point _temp_make_local_19_96;
+	Point __p_rename_at_17_ConstRef = ((Point)_Func_0x60_Point_207577237388bd06(__context__,2.f,3.f));
+	Point const  & __p_rename_at_17 = __p_rename_at_17_ConstRef; ;
+	float __t_rename_at_18 = ((float)das_invoke_function<float>::invoke<Point const  &>(__context__,nullptr,__p_rename_at_17.magnitude,das_cast<Point const >::cast(__p_rename_at_17)));
+	float __d_rename_at_19 = ((float)das_invoke_function<float>::invoke<Point const  &,Point &>(__context__,nullptr,__p_rename_at_17.dot,das_cast<Point const >::cast(__p_rename_at_17),das_arg<Point>::pass((_temp_make_local_19_96 = (_Func_0x60_Point_207577237388bd06(__context__,1.f,1.f))))));
+	DAS_ASSERT(((__t_rename_at_18 == 13.f) && (__d_rename_at_19 == 5.f)));
+	return das_auto_cast<bool>::cast(true);
+}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Func_0x60_Point_207577237388bd06
+	aotLib[0x77113cc607172e97] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Point (*) ( Context * __context__, float , float  ),&_Func_0x60_Point_207577237388bd06>>();
+	};
+	// point_magnitude_a291cf2a1d44a90
+	aotLib[0x68e8e20911a2ae15] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, Point const  &  ),&point_magnitude_a291cf2a1d44a90>>();
+	};
+	// point_dot_bc8093ba2246bcd9
+	aotLib[0x99d540cbb9c08529] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, Point const  & , Point const  &  ),&point_dot_bc8093ba2246bcd9>>();
+	};
+	// test_41a4a5a8ec66c0de
+	aotLib[0x8038a7b1124c2370] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_41a4a5a8ec66c0de>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
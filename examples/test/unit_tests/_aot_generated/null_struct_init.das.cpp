@@ -0,0 +1,123 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_12402226488923518898 {
+
+
+
+namespace  { struct NullEvent; };
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+namespace  {
+
+struct NullEvent {
+	uint64_t eventType;
+	uint16_t eventSize;
+	uint16_t eventFlags;
+};
+static_assert(sizeof(NullEvent)==16,"structure size mismatch with DAS");
+static_assert(offsetof(NullEvent,eventType)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(NullEvent,eventSize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(NullEvent,eventFlags)==10,"structure field offset mismatch with DAS");
+}
+
+inline void _Func_0x60__builtin_send_blobevent_3aaec6c44e3967b2 ( Context * __context__, int32_t __eid_rename_at_13, NullEvent const  & __evt_rename_at_13, char * const  __evt_name_rename_at_13 );
+inline void _Func_0x60_sendEvent_97ef5d0267d5b2bc ( Context * __context__, int32_t __eid_rename_at_20, NullEvent & __evt_rename_at_20 );
+inline bool test_e3dd3cfc84016ca9 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Func_0x60__builtin_send_blobevent_3aaec6c44e3967b2 ( Context * __context__, int32_t __eid_rename_at_13, NullEvent const  &  __evt_rename_at_13, char * const  __evt_name_rename_at_13 )
+{
+}
+
+inline void _Func_0x60_sendEvent_97ef5d0267d5b2bc ( Context * __context__, int32_t __eid_rename_at_20, NullEvent &  __evt_rename_at_20 )
+{
+	das_copy(__evt_rename_at_20.eventType,UINT64_C(0xc7f9ed856fc1d79c));
+	das_copy(__evt_rename_at_20.eventSize,uint16_t(16));
+	DAS_ASSERT((int32_t(__evt_rename_at_20.eventFlags) == 0));
+	_Func_0x60__builtin_send_blobevent_3aaec6c44e3967b2(__context__,__eid_rename_at_20,das_arg<NullEvent>::pass(__evt_rename_at_20),((char *) "NullEvent"));
+}
+
+inline bool test_e3dd3cfc84016ca9 ( Context * __context__ )
+{
+	NullEvent _temp_make_local_35_32;
+	_Func_0x60_sendEvent_97ef5d0267d5b2bc(__context__,13,das_arg<NullEvent>::pass((([&]() -> NullEvent& {
+		das_zero(_temp_make_local_35_32);
+		return _temp_make_local_35_32;
+	})())));
+	return das_auto_cast<bool>::cast(true);
+}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Func_0x60__builtin_send_blobevent_3aaec6c44e3967b2
+	aotLib[0x2e3b02f14da24089] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , NullEvent const  & , char * const   ),&_Func_0x60__builtin_send_blobevent_3aaec6c44e3967b2>>();
+	};
+	// _Func_0x60_sendEvent_97ef5d0267d5b2bc
+	aotLib[0x511d9fea1f7449ef] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , NullEvent &  ),&_Func_0x60_sendEvent_97ef5d0267d5b2bc>>();
+	};
+	// test_e3dd3cfc84016ca9
+	aotLib[0x79c6594c777e641e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_e3dd3cfc84016ca9>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,100 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_18153194399951192417 {
+
+
+
+
+inline bool fnBottom_5723b6060f979c04 ( Context * __context__ );
+inline bool fnTop_3fe9e892d272198b ( Context * __context__ );
+inline bool test_27e850b388beeee3 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool fnBottom_5723b6060f979c04 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,32,"fnBottom " DAS_FILE_LINE);
+{
+	builtin_stackwalk(true,true,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+inline bool fnTop_3fe9e892d272198b ( Context * __context__ ) { das_stack_prologue __prologue(__context__,32,"fnTop " DAS_FILE_LINE);
+{
+	das_invoke_function<bool>::invoke(__context__,nullptr,Func(__context__->fnByMangledName(/*fnMid*/ 1288698783388350869u)));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+inline bool test_27e850b388beeee3 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,32,"test " DAS_FILE_LINE);
+{
+	fnTop_3fe9e892d272198b(__context__);
+	return das_auto_cast<bool>::cast(true);
+}}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// fnBottom_5723b6060f979c04
+	aotLib[0xcea7586159fc7d75] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&fnBottom_5723b6060f979c04>>();
+	};
+	// fnTop_3fe9e892d272198b
+	aotLib[0x9236f2cf6efaea55] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&fnTop_3fe9e892d272198b>>();
+	};
+	// test_27e850b388beeee3
+	aotLib[0xf37905fe16df524f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_27e850b388beeee3>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
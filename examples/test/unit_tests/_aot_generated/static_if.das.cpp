@@ -0,0 +1,123 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_13198305849554384532 {
+
+
+
+namespace  { struct Foo; };
+namespace  { struct Bar; };
+namespace  {
+
+struct Foo {
+	int32_t a;
+	int32_t b;
+};
+static_assert(sizeof(Foo)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,b)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Bar {
+	int32_t c;
+	int32_t d;
+};
+static_assert(sizeof(Bar)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Bar,c)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Bar,d)==4,"structure field offset mismatch with DAS");
+}
+
+inline void _Func_0x60_setA_91e23ca722b0cf72 ( Context * __context__, Foo & __obj_rename_at_10, int32_t __val_rename_at_10 );
+inline void _Func_0x60_setA_67f2caa51be5f975 ( Context * __context__, Bar & __obj_rename_at_10, int32_t __val_rename_at_10 );
+inline bool test_6bc290cebb92e2d8 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Func_0x60_setA_91e23ca722b0cf72 ( Context * __context__, Foo &  __obj_rename_at_10, int32_t __val_rename_at_10 )
+{
+	das_copy(__obj_rename_at_10.a,__val_rename_at_10);
+}
+
+inline void _Func_0x60_setA_67f2caa51be5f975 ( Context * __context__, Bar &  __obj_rename_at_10, int32_t __val_rename_at_10 )
+{
+}
+
+inline bool test_6bc290cebb92e2d8 ( Context * __context__ )
+{
+	Foo __f_rename_at_20; das_zero(__f_rename_at_20);
+	Bar __b_rename_at_21; das_zero(__b_rename_at_21);
+	_Func_0x60_setA_91e23ca722b0cf72(__context__,das_arg<Foo>::pass(__f_rename_at_20),1);
+	_Func_0x60_setA_67f2caa51be5f975(__context__,das_arg<Bar>::pass(__b_rename_at_21),2);
+	DAS_ASSERT((__f_rename_at_20.a == 1));
+	return das_auto_cast<bool>::cast(true);
+}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Func_0x60_setA_91e23ca722b0cf72
+	aotLib[0x3d7382d45e2e983d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo & , int32_t  ),&_Func_0x60_setA_91e23ca722b0cf72>>();
+	};
+	// _Func_0x60_setA_67f2caa51be5f975
+	aotLib[0x21f5a28d48b18b41] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Bar & , int32_t  ),&_Func_0x60_setA_67f2caa51be5f975>>();
+	};
+	// test_6bc290cebb92e2d8
+	aotLib[0xd75d7b9f343ae3e4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_6bc290cebb92e2d8>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
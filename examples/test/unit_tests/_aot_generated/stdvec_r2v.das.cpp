@@ -0,0 +1,107 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_13393055568187302492 {
+
+extern TypeInfo __type_info__af63eb4c86020609;
+extern VarInfo __var_info__1eea2c9ed711856c;
+extern FuncInfo __func_info__c4f16d6aa7a44ed1;
+
+VarInfo __func_info__c4f16d6aa7a44ed1_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~$::dasvector`TestObjectFoo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8194, 24, 0x1eea2c9ed711856cul, "arr", 0 };
+VarInfo * __func_info__c4f16d6aa7a44ed1_fields[1] =  { &__func_info__c4f16d6aa7a44ed1_field_0 };
+FuncInfo __func_info__c4f16d6aa7a44ed1 = {"invoke block<(arr:$::dasvector`TestObjectFoo):void> const", "", __func_info__c4f16d6aa7a44ed1_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,0xc4f16d6aa7a44ed1ul, 0x0 };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, 0xaf63eb4c86020609ul };
+
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+
+inline bool test_1ee0c6e0ace85890 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool test_1ee0c6e0ace85890 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,112,"test " DAS_FILE_LINE);
+{
+	testFooArray(das_make_block<void,das::vector<TestObjectFoo> &>(__context__,80,0,&__func_info__c4f16d6aa7a44ed1,[&](das::vector<TestObjectFoo> & __arr_rename_at_5)->void{
+		{
+			uint64_t __loop_count_6 = UINT64_MAX;
+			// i : int const
+			das_iterator<range> __i_iterator(mk_range(__arr_rename_at_5.size() /*length*/));
+			int32_t __i_rename_at_6;
+			__loop_count_6 = das_loop_count(__loop_count_6,__i_iterator.loop_begin(__context__,(__i_rename_at_6)));
+			for ( ; __loop_count_6 ; --__loop_count_6, ++__i_rename_at_6 )
+			{
+				if ( das_index<das::vector<TestObjectFoo>>::at(__arr_rename_at_5,__i_rename_at_6,__context__).fooData /*fooData*/ != __i_rename_at_6 )
+				{
+					builtin_throw(((char *) "bad"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+				};
+			}
+			__i_iterator.loop_end(__context__,(__i_rename_at_6));
+		};
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	return das_auto_cast<bool>::cast(true);
+}}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// test_1ee0c6e0ace85890
+	aotLib[0x85a1dabc285c1855] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_1ee0c6e0ace85890>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
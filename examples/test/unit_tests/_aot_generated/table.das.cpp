@@ -0,0 +1,723 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_18007533389355199516 {
+
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__90f3d07b5a6ca13;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__90f5707b5a6f641;
+extern VarInfo __var_info__2af15b326a3e4f8a;
+extern VarInfo __var_info__45dd7720586500dd;
+extern VarInfo __var_info__afd03904bf52eaf4;
+extern VarInfo __var_info__3625b5fa66370a98;
+extern VarInfo __var_info__671754fe3241480d;
+extern FuncInfo __func_info__735ba107eb6b2351;
+extern FuncInfo __func_info__6fb9169af6817643;
+extern FuncInfo __func_info__ad7520471b59db0c;
+extern FuncInfo __func_info__4de8fc42dc6bf9c5;
+extern FuncInfo __func_info__fb0fda01b169d452;
+
+VarInfo __func_info__735ba107eb6b2351_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 8236, 8, 0x45dd7720586500ddul, "num", 0 };
+VarInfo * __func_info__735ba107eb6b2351_fields[1] =  { &__func_info__735ba107eb6b2351_field_0 };
+FuncInfo __func_info__735ba107eb6b2351 = {"invoke block<(num:int? const):void> const", "", __func_info__735ba107eb6b2351_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,0x735ba107eb6b2351ul, 0x0 };
+VarInfo __func_info__6fb9169af6817643_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0xafd03904bf52eaf4ul, "num", 0 };
+VarInfo * __func_info__6fb9169af6817643_fields[1] =  { &__func_info__6fb9169af6817643_field_0 };
+FuncInfo __func_info__6fb9169af6817643 = {"invoke block<(num:int? -const):void> const", "", __func_info__6fb9169af6817643_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,0x6fb9169af6817643ul, 0x0 };
+VarInfo __func_info__ad7520471b59db0c_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 8236, 8, 0x2af15b326a3e4f8aul, "pVal", 0 };
+VarInfo * __func_info__ad7520471b59db0c_fields[1] =  { &__func_info__ad7520471b59db0c_field_0 };
+FuncInfo __func_info__ad7520471b59db0c = {"invoke block<(pVal:int? const):void> const", "", __func_info__ad7520471b59db0c_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,0xad7520471b59db0cul, 0x0 };
+VarInfo __func_info__4de8fc42dc6bf9c5_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 8236, 8, 0x671754fe3241480dul, "t", 0 };
+VarInfo * __func_info__4de8fc42dc6bf9c5_fields[1] =  { &__func_info__4de8fc42dc6bf9c5_field_0 };
+FuncInfo __func_info__4de8fc42dc6bf9c5 = {"invoke block<(t:int? const):void> const", "", __func_info__4de8fc42dc6bf9c5_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,0x4de8fc42dc6bf9c5ul, 0x0 };
+VarInfo __func_info__fb0fda01b169d452_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 8236, 8, 0x3625b5fa66370a98ul, "pValue", 0 };
+VarInfo * __func_info__fb0fda01b169d452_fields[1] =  { &__func_info__fb0fda01b169d452_field_0 };
+FuncInfo __func_info__fb0fda01b169d452 = {"invoke block<(pValue:int? const):void> const", "", __func_info__fb0fda01b169d452_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,0xfb0fda01b169d452ul, 0x0 };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xaf63e44c8601fa24ul };
+TypeInfo __type_info__90f3d07b5a6ca13 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, 0x90f3d07b5a6ca13ul };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, 0xaf63eb4c86020609ul };
+TypeInfo __type_info__90f5707b5a6f641 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, 0x90f5707b5a6f641ul };
+
+TypeInfo * __tinfo_0[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_1[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_2[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f5707b5a6f641 };
+namespace  { struct TestStruct; };
+namespace  { struct TableContainer; };
+namespace  {
+
+struct TestStruct {
+	char * test;
+};
+static_assert(sizeof(TestStruct)==8,"structure size mismatch with DAS");
+static_assert(offsetof(TestStruct,test)==0,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct TableContainer {
+	TTable<char *,TestStruct> t;
+};
+static_assert(sizeof(TableContainer)==48,"structure size mismatch with DAS");
+static_assert(offsetof(TableContainer,t)==0,"structure field offset mismatch with DAS");
+}
+
+inline bool _Funcbuiltin_0x60_find_if_exists_7ee55bb5a3679228 ( Context * __context__, TTable<char *,int32_t> const  & __Tab_rename_at_179, char * const  __at_rename_at_179, Block DAS_COMMENT((void,int32_t * const )) const  & __blk_rename_at_179 );
+inline void _Funcbuiltin_0x60_find_for_edit_54cf37fec08499c6 ( Context * __context__, TTable<char *,int32_t> & __Tab_rename_at_197, char * const  __at_rename_at_197, Block DAS_COMMENT((void,int32_t *)) const  & __blk_rename_at_197 );
+inline void _Funcbuiltin_0x60_find_for_edit_if_exists_c3be78c372b66c6b ( Context * __context__, TTable<char *,int32_t> & __Tab_rename_at_203, char * const  __at_rename_at_203, Block DAS_COMMENT((void,int32_t *)) const  & __blk_rename_at_203 );
+inline int32_t * _Funcbuiltin_0x60_find_for_edit_f24db96641bb3dd ( Context * __context__, TTable<char *,int32_t> & __Tab_rename_at_211, char * const  __at_rename_at_211 );
+inline TTable<char *,int32_t> _Funcbuiltin_0x60_to_table_move_d4e2568a5fc88cd5 ( Context * __context__, TDim<TTuple<16,char *,int32_t>,2> & __a_rename_at_442 );
+inline bool _Funcbuiltin_0x60_erase_61b4ed4bc61116da ( Context * __context__, TTable<char *,int32_t> & __Tab_rename_at_220, char * const  __at_rename_at_220 );
+inline void _Funcbuiltin_0x60_find_fd9952db15f0f9da ( Context * __context__, TTable<char *,int32_t> const  & __Tab_rename_at_173, char * const  __at_rename_at_173, Block DAS_COMMENT((void,int32_t * const )) const  & __blk_rename_at_173 );
+inline int32_t const  * _Funcbuiltin_0x60_find_d1c87b7bbc435721 ( Context * __context__, TTable<char *,int32_t> const  & __Tab_rename_at_189, char * const  __at_rename_at_189 );
+inline Sequence DAS_COMMENT((char * const  &)) _Funcbuiltin_0x60_keys_e42fdde57381fb5e ( Context * __context__, TTable<char *,int32_t> const  & __a_rename_at_270 );
+inline Sequence DAS_COMMENT((int32_t &)) _Funcbuiltin_0x60_values_b65bfa7ca0abf5be ( Context * __context__, TTable<char *,int32_t> & __a_rename_at_280 );
+inline bool _Funcbuiltin_0x60_key_exists_f198e231103db6d0 ( Context * __context__, TTable<bool,int32_t> const  & __Tab_rename_at_225, bool __at_rename_at_225 );
+inline bool _Funcbuiltin_0x60_key_exists_164817c6d7890150 ( Context * __context__, TTable<int32_t,int32_t> const  & __Tab_rename_at_225, int32_t __at_rename_at_225 );
+inline bool _Funcbuiltin_0x60_erase_b20b0382d59ae57c ( Context * __context__, TTable<int32_t,int32_t> & __Tab_rename_at_220, int32_t __at_rename_at_220 );
+inline bool _Funcbuiltin_0x60_key_exists_65edeaae187fe7ac ( Context * __context__, TTable<char *,int32_t> const  & __Tab_rename_at_225, char * const  __at_rename_at_225 );
+inline void _Funcbuiltin_0x60_push_49bdd408ef1e4c5a ( Context * __context__, TArray<char *> & __Arr_rename_at_75, char * const  __value_rename_at_75 );
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> & __Arr_rename_at_75, int32_t __value_rename_at_75 );
+inline bool _Funcbuiltin_0x60_erase_525a560436991d88 ( Context * __context__, TTable<char *,TestStruct> & __Tab_rename_at_220, char * const  __at_rename_at_220 );
+inline bool test_find_1b7a59b556b073a8 ( Context * __context__ );
+inline bool test_e2bf523908c6d640 ( Context * __context__ );
+inline bool test_lock_panic_34bdc822ce21a284 ( Context * __context__ );
+inline bool check_e57a004afa5b7a90 ( Context * __context__, TableContainer & __t_rename_at_190, TArray<int32_t> const  & __deletedEntries_rename_at_190 );
+inline void test_erase_collision_aaf184dcdf93dcd9 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool _Funcbuiltin_0x60_find_if_exists_7ee55bb5a3679228 ( Context * __context__, TTable<char *,int32_t> const  &  __Tab_rename_at_179, char * const  __at_rename_at_179, Block DAS_COMMENT((void,int32_t * const )) const  &  __blk_rename_at_179 )
+{
+	int32_t * __val_rename_at_180 = __builtin_table_find(__context__,__Tab_rename_at_179,__at_rename_at_179);
+	if ( __val_rename_at_180 != nullptr )
+	{
+		builtin_table_lock(__Tab_rename_at_179,__context__);
+		das_invoke<void>::invoke<int32_t *>(__context__,nullptr,__blk_rename_at_179,__val_rename_at_180);
+		builtin_table_unlock(__Tab_rename_at_179,__context__);
+		return das_auto_cast<bool>::cast(true);
+	} else {
+		return das_auto_cast<bool>::cast(false);
+	};
+}
+
+inline void _Funcbuiltin_0x60_find_for_edit_54cf37fec08499c6 ( Context * __context__, TTable<char *,int32_t> &  __Tab_rename_at_197, char * const  __at_rename_at_197, Block DAS_COMMENT((void,int32_t *)) const  &  __blk_rename_at_197 )
+{
+	builtin_table_lock(das_arg<TTable<char *,int32_t>>::pass(__Tab_rename_at_197),__context__);
+	int32_t * __val_rename_at_199 = __builtin_table_find(__context__,__Tab_rename_at_197,__at_rename_at_197);
+	das_invoke<void>::invoke<int32_t *>(__context__,nullptr,__blk_rename_at_197,__val_rename_at_199);
+	builtin_table_unlock(das_arg<TTable<char *,int32_t>>::pass(__Tab_rename_at_197),__context__);
+}
+
+inline void _Funcbuiltin_0x60_find_for_edit_if_exists_c3be78c372b66c6b ( Context * __context__, TTable<char *,int32_t> &  __Tab_rename_at_203, char * const  __at_rename_at_203, Block DAS_COMMENT((void,int32_t *)) const  &  __blk_rename_at_203 )
+{
+	int32_t * __val_rename_at_204 = __builtin_table_find(__context__,__Tab_rename_at_203,__at_rename_at_203);
+	if ( __val_rename_at_204 != nullptr )
+	{
+		builtin_table_lock(das_arg<TTable<char *,int32_t>>::pass(__Tab_rename_at_203),__context__);
+		das_invoke<void>::invoke<int32_t *>(__context__,nullptr,__blk_rename_at_203,__val_rename_at_204);
+		builtin_table_unlock(das_arg<TTable<char *,int32_t>>::pass(__Tab_rename_at_203),__context__);
+	};
+}
+
+inline int32_t * _Funcbuiltin_0x60_find_for_edit_f24db96641bb3dd ( Context * __context__, TTable<char *,int32_t> &  __Tab_rename_at_211, char * const  __at_rename_at_211 )
+{
+	return das_auto_cast<int32_t *>::cast(__builtin_table_find(__context__,__Tab_rename_at_211,__at_rename_at_211));
+}
+
+inline TTable<char *,int32_t> _Funcbuiltin_0x60_to_table_move_d4e2568a5fc88cd5 ( Context * __context__, TDim<TTuple<16,char *,int32_t>,2> &  __a_rename_at_442 )
+{
+	TTable<char *,int32_t> __tab_rename_at_443; das_zero(__tab_rename_at_443);
+	{
+		uint64_t __loop_count_445 = UINT64_MAX;
+		// x : tuple<string aka keyT;int aka valT>&
+		das_iterator<TDim<TTuple<16,char *,int32_t>,2>> __x_iterator(__a_rename_at_442);
+		TTuple<16,char *,int32_t> * __x_rename_at_445;
+		__loop_count_445 = das_loop_count(__loop_count_445,__x_iterator.loop_begin(__context__,(__x_rename_at_445)));
+		for ( ; __loop_count_445 ; --__loop_count_445, ++__x_rename_at_445 )
+		{
+			das_copy(__tab_rename_at_443(das_get_tuple_field<char *,0>::get((*__x_rename_at_445)),__context__),das_get_tuple_field<int32_t,8>::get((*__x_rename_at_445)));
+		}
+		__x_iterator.loop_end(__context__,(__x_rename_at_445));
+	};
+	return /* <- */ das_auto_cast_move<TTable<char *,int32_t>>::cast(__tab_rename_at_443);
+}
+
+inline bool _Funcbuiltin_0x60_erase_61b4ed4bc61116da ( Context * __context__, TTable<char *,int32_t> &  __Tab_rename_at_220, char * const  __at_rename_at_220 )
+{
+	return das_auto_cast<bool>::cast(__builtin_table_erase(__context__,__Tab_rename_at_220,__at_rename_at_220));
+}
+
+inline void _Funcbuiltin_0x60_find_fd9952db15f0f9da ( Context * __context__, TTable<char *,int32_t> const  &  __Tab_rename_at_173, char * const  __at_rename_at_173, Block DAS_COMMENT((void,int32_t * const )) const  &  __blk_rename_at_173 )
+{
+	builtin_table_lock(__Tab_rename_at_173,__context__);
+	int32_t * __val_rename_at_175 = __builtin_table_find(__context__,__Tab_rename_at_173,__at_rename_at_173);
+	das_invoke<void>::invoke<int32_t *>(__context__,nullptr,__blk_rename_at_173,__val_rename_at_175);
+	builtin_table_unlock(__Tab_rename_at_173,__context__);
+}
+
+inline int32_t const  * _Funcbuiltin_0x60_find_d1c87b7bbc435721 ( Context * __context__, TTable<char *,int32_t> const  &  __Tab_rename_at_189, char * const  __at_rename_at_189 )
+{
+	return das_auto_cast<int32_t const  *>::cast(das_cast<int32_t const  *>::cast(__builtin_table_find(__context__,__Tab_rename_at_189,__at_rename_at_189)));
+}
+
+inline Sequence DAS_COMMENT((char * const  &)) _Funcbuiltin_0x60_keys_e42fdde57381fb5e ( Context * __context__, TTable<char *,int32_t> const  &  __a_rename_at_270 )
+{
+	Sequence DAS_COMMENT((char * *)) __it_rename_at_271; das_zero(__it_rename_at_271);
+	builtin_table_keys(das_arg<Sequence DAS_COMMENT((char * const ))>::pass(__it_rename_at_271),__a_rename_at_270,8,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((char * const  &))>::cast(__it_rename_at_271);
+}
+
+inline Sequence DAS_COMMENT((int32_t &)) _Funcbuiltin_0x60_values_b65bfa7ca0abf5be ( Context * __context__, TTable<char *,int32_t> &  __a_rename_at_280 )
+{
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_281; das_zero(__it_rename_at_281);
+	builtin_table_values(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_281),das_arg<TTable<char *,int32_t>>::pass(__a_rename_at_280),4,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t &))>::cast(__it_rename_at_281);
+}
+
+inline bool _Funcbuiltin_0x60_key_exists_f198e231103db6d0 ( Context * __context__, TTable<bool,int32_t> const  &  __Tab_rename_at_225, bool __at_rename_at_225 )
+{
+	return das_auto_cast<bool>::cast(__builtin_table_key_exists(__context__,__Tab_rename_at_225,__at_rename_at_225));
+}
+
+inline bool _Funcbuiltin_0x60_key_exists_164817c6d7890150 ( Context * __context__, TTable<int32_t,int32_t> const  &  __Tab_rename_at_225, int32_t __at_rename_at_225 )
+{
+	return das_auto_cast<bool>::cast(__builtin_table_key_exists(__context__,__Tab_rename_at_225,__at_rename_at_225));
+}
+
+inline bool _Funcbuiltin_0x60_erase_b20b0382d59ae57c ( Context * __context__, TTable<int32_t,int32_t> &  __Tab_rename_at_220, int32_t __at_rename_at_220 )
+{
+	return das_auto_cast<bool>::cast(__builtin_table_erase(__context__,__Tab_rename_at_220,__at_rename_at_220));
+}
+
+inline bool _Funcbuiltin_0x60_key_exists_65edeaae187fe7ac ( Context * __context__, TTable<char *,int32_t> const  &  __Tab_rename_at_225, char * const  __at_rename_at_225 )
+{
+	return das_auto_cast<bool>::cast(__builtin_table_key_exists(__context__,__Tab_rename_at_225,__at_rename_at_225));
+}
+
+inline void _Funcbuiltin_0x60_push_49bdd408ef1e4c5a ( Context * __context__, TArray<char *> &  __Arr_rename_at_75, char * const  __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<char *>>::pass(__Arr_rename_at_75),8,__context__),__context__),__value_rename_at_75);
+}
+
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_75, int32_t __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_75),4,__context__),__context__),__value_rename_at_75);
+}
+
+inline bool _Funcbuiltin_0x60_erase_525a560436991d88 ( Context * __context__, TTable<char *,TestStruct> &  __Tab_rename_at_220, char * const  __at_rename_at_220 )
+{
+	return das_auto_cast<bool>::cast(__builtin_table_erase(__context__,__Tab_rename_at_220,__at_rename_at_220));
+}
+
+inline bool test_find_1b7a59b556b073a8 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,640,"test_find " DAS_FILE_LINE);
+{
+	TDim<TTuple<16,char *,int32_t>,2> _temp_make_local_2_80;
+	TDim<TTuple<16,char *,int32_t>,2> _temp_make_local_11_352;
+	TTable<char *,int32_t> __const_tab_rename_at_2_ConstRef; das_zero(__const_tab_rename_at_2_ConstRef); das_move(__const_tab_rename_at_2_ConstRef, ((TTable<char *,int32_t>)_Funcbuiltin_0x60_to_table_move_d4e2568a5fc88cd5(__context__,das_arg<TDim<TTuple<16,char *,int32_t>,2>>::pass((([&]() -> TDim<TTuple<16,char *,int32_t>,2>& {
+		_temp_make_local_2_80(0,__context__) = (([&]() -> TTuple<16,char *,int32_t> {
+			TTuple<16,char *,int32_t> __mkt_2;
+			das_get_tuple_field<char *,0>::get(__mkt_2) = ((char *) "one");
+			das_get_tuple_field<int32_t,8>::get(__mkt_2) = 1;
+			return __mkt_2;
+		})());
+		_temp_make_local_2_80(1,__context__) = (([&]() -> TTuple<16,char *,int32_t> {
+			TTuple<16,char *,int32_t> __mkt_2;
+			das_get_tuple_field<char *,0>::get(__mkt_2) = ((char *) "two");
+			das_get_tuple_field<int32_t,8>::get(__mkt_2) = 2;
+			return __mkt_2;
+		})());
+		return _temp_make_local_2_80;
+	})())))));
+	TTable<char *,int32_t> const  & __const_tab_rename_at_2 = __const_tab_rename_at_2_ConstRef; ;
+	_Funcbuiltin_0x60_find_fd9952db15f0f9da(__context__,__const_tab_rename_at_2,((char *) "one"),das_make_block<void,int32_t * const >(__context__,160,0,&__func_info__735ba107eb6b2351,[&](int32_t * const  __num_rename_at_3)->void{
+		DAS_ASSERT((das_deref(__context__,__num_rename_at_3) == 1));
+	}));
+	_Funcbuiltin_0x60_find_if_exists_7ee55bb5a3679228(__context__,__const_tab_rename_at_2,((char *) "one"),das_make_block<void,int32_t * const >(__context__,224,0,&__func_info__735ba107eb6b2351,[&](int32_t * const  __num_rename_at_5)->void{
+		DAS_ASSERT((das_deref(__context__,__num_rename_at_5) == 1));
+	}));
+	_Funcbuiltin_0x60_find_fd9952db15f0f9da(__context__,__const_tab_rename_at_2,((char *) "one"),das_make_block<void,int32_t * const >(__context__,288,0,&__func_info__735ba107eb6b2351,[&](int32_t * const  __num_rename_at_7)->void{
+		if ( __num_rename_at_7 != nullptr )
+		{
+			DAS_ASSERT((das_deref(__context__,__num_rename_at_7) == 1));
+		};
+	}));
+	DAS_ASSERT((das_deref(__context__,_Funcbuiltin_0x60_find_d1c87b7bbc435721(__context__,__const_tab_rename_at_2,((char *) "one"))) == 1));
+	TTable<char *,int32_t> __tab_rename_at_11; das_zero(__tab_rename_at_11); das_move(__tab_rename_at_11, _Funcbuiltin_0x60_to_table_move_d4e2568a5fc88cd5(__context__,das_arg<TDim<TTuple<16,char *,int32_t>,2>>::pass((([&]() -> TDim<TTuple<16,char *,int32_t>,2>& {
+		_temp_make_local_11_352(0,__context__) = (([&]() -> TTuple<16,char *,int32_t> {
+			TTuple<16,char *,int32_t> __mkt_11;
+			das_get_tuple_field<char *,0>::get(__mkt_11) = ((char *) "one");
+			das_get_tuple_field<int32_t,8>::get(__mkt_11) = 1;
+			return __mkt_11;
+		})());
+		_temp_make_local_11_352(1,__context__) = (([&]() -> TTuple<16,char *,int32_t> {
+			TTuple<16,char *,int32_t> __mkt_11;
+			das_get_tuple_field<char *,0>::get(__mkt_11) = ((char *) "two");
+			das_get_tuple_field<int32_t,8>::get(__mkt_11) = 2;
+			return __mkt_11;
+		})());
+		return _temp_make_local_11_352;
+	})()))));
+	_Funcbuiltin_0x60_find_fd9952db15f0f9da(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_11),((char *) "one"),das_make_block<void,int32_t * const >(__context__,432,0,&__func_info__735ba107eb6b2351,[&](int32_t * const  __num_rename_at_12)->void{
+		DAS_ASSERT((das_deref(__context__,__num_rename_at_12) == 1));
+	}));
+	_Funcbuiltin_0x60_find_for_edit_54cf37fec08499c6(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_11),((char *) "one"),das_make_block<void,int32_t *>(__context__,496,0,&__func_info__6fb9169af6817643,[&](int32_t * __num_rename_at_14)->void{
+		DAS_ASSERT((das_deref(__context__,__num_rename_at_14) == 1));
+		das_copy(das_deref(__context__,__num_rename_at_14),3);
+	}));
+	DAS_ASSERT((das_deref(__context__,_Funcbuiltin_0x60_find_d1c87b7bbc435721(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_11),((char *) "one"))) == 3));
+	_Funcbuiltin_0x60_find_for_edit_54cf37fec08499c6(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_11),((char *) "one"),das_make_block<void,int32_t *>(__context__,560,0,&__func_info__6fb9169af6817643,[&](int32_t * __num_rename_at_18)->void{
+		if ( __num_rename_at_18 != nullptr )
+		{
+			DAS_ASSERT((das_deref(__context__,__num_rename_at_18) == 3));
+			das_copy(das_deref(__context__,__num_rename_at_18),4);
+		};
+	}));
+	DAS_ASSERT((das_deref(__context__,_Funcbuiltin_0x60_find_d1c87b7bbc435721(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_11),((char *) "one"))) == 4));
+	_Funcbuiltin_0x60_find_for_edit_if_exists_c3be78c372b66c6b(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_11),((char *) "one"),das_make_block<void,int32_t *>(__context__,624,0,&__func_info__6fb9169af6817643,[&](int32_t * __num_rename_at_23)->void{
+		DAS_ASSERT((das_deref(__context__,__num_rename_at_23) == 4));
+		das_copy(das_deref(__context__,__num_rename_at_23),5);
+	}));
+	DAS_ASSERT((das_deref(__context__,_Funcbuiltin_0x60_find_d1c87b7bbc435721(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_11),((char *) "one"))) == 5));
+	das_copy(das_deref(__context__,_Funcbuiltin_0x60_find_for_edit_f24db96641bb3dd(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_11),((char *) "one"))),1);
+	DAS_ASSERT((das_deref(__context__,_Funcbuiltin_0x60_find_for_edit_f24db96641bb3dd(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_11),((char *) "one"))) == 1));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+inline bool test_e2bf523908c6d640 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,608,"test " DAS_FILE_LINE);
+{
+	Sequence DAS_COMMENT((char * *)) _temp_make_local_113_400;
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_113_416;
+	test_find_1b7a59b556b073a8(__context__);
+	TTable<char *,int32_t> __tab_rename_at_36; das_zero(__tab_rename_at_36);
+	int32_t __i_rename_at_37 = 0; int32_t __del_rename_at_37 = 0;
+	DAS_VERIFY((!_Funcbuiltin_0x60_erase_61b4ed4bc61116da(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36),((char *) "0"))));
+	das_copy(__i_rename_at_37,0);
+	while ( __i_rename_at_37 != 32 )
+	{
+		das_copy(__tab_rename_at_36(((char *)(das_lexical_cast(__i_rename_at_37,__context__))),__context__),__i_rename_at_37);
+		++__i_rename_at_37;
+	};
+	DAS_ASSERT((builtin_table_size(das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36)) == 32));
+	das_copy(__i_rename_at_37,0);
+	while ( __i_rename_at_37 != 32 )
+	{
+		DAS_VERIFY((__tab_rename_at_36(((char *)(das_lexical_cast(__i_rename_at_37,__context__))),__context__) == __i_rename_at_37));
+		++__i_rename_at_37;
+	};
+	DAS_ASSERT((builtin_table_size(das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36)) == 32));
+	das_copy(__i_rename_at_37,0);
+	das_copy(__del_rename_at_37,0);
+	while ( __i_rename_at_37 < 32 )
+	{
+		DAS_VERIFY((_Funcbuiltin_0x60_erase_61b4ed4bc61116da(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36),((char *)(das_lexical_cast(__i_rename_at_37,__context__))))));
+		DAS_VERIFY((!_Funcbuiltin_0x60_erase_61b4ed4bc61116da(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36),((char *)(das_lexical_cast(__i_rename_at_37,__context__))))));
+		++__del_rename_at_37;
+		__i_rename_at_37 += 7;
+	};
+	DAS_ASSERT((builtin_table_size(das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36)) == (32 - __del_rename_at_37)));
+	das_copy(__i_rename_at_37,0);
+	while ( __i_rename_at_37 < 32 )
+	{
+		_Funcbuiltin_0x60_find_fd9952db15f0f9da(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36),((char *)(das_lexical_cast(__i_rename_at_37,__context__))),das_make_block<void,int32_t * const >(__context__,160,0,&__func_info__fb0fda01b169d452,[&](int32_t * const  __pValue_rename_at_64)->void{
+			if ( __pValue_rename_at_64 != nullptr )
+			{
+				DAS_ASSERT((das_deref(__context__,__pValue_rename_at_64) == __i_rename_at_37));
+			} else {
+				DAS_ASSERT(((SimPolicy<int32_t>::Mod(__i_rename_at_37,7,*__context__,nullptr)) == 0));
+			};
+		}));
+		++__i_rename_at_37;
+	};
+	while ( __i_rename_at_37 < 32 )
+	{
+		int32_t const  * __pValue_rename_at_71 = ((int32_t const  *)_Funcbuiltin_0x60_find_d1c87b7bbc435721(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36),((char *)(das_lexical_cast(__i_rename_at_37,__context__)))));
+		if ( __pValue_rename_at_71 != nullptr )
+		{
+			DAS_ASSERT((das_deref(__context__,__pValue_rename_at_71) == __i_rename_at_37));
+		} else {
+			DAS_ASSERT(((SimPolicy<int32_t>::Mod(__i_rename_at_37,7,*__context__,nullptr)) == 0));
+		};
+		++__i_rename_at_37;
+	};
+	int32_t __j_rename_at_78 = 0; int32_t __k_rename_at_78 = 0;
+	das_copy(__i_rename_at_37,0);
+	while ( __i_rename_at_37 < 32 )
+	{
+		_Funcbuiltin_0x60_find_fd9952db15f0f9da(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36),((char *)(das_lexical_cast(__i_rename_at_37,__context__))),das_make_block<void,int32_t * const >(__context__,272,0,&__func_info__ad7520471b59db0c,[&](int32_t * const  __pVal_rename_at_81)->void{
+			__j_rename_at_78 += das_null_coalescing<int32_t>::get(__pVal_rename_at_81,0);
+		}));
+		if ( (SimPolicy<int32_t>::Mod(__i_rename_at_37,7,*__context__,nullptr)) != 0 )
+		{
+			__k_rename_at_78 += __i_rename_at_37;
+		} else {
+			DAS_ASSERT(((SimPolicy<int32_t>::Mod(__i_rename_at_37,7,*__context__,nullptr)) == 0));
+		};
+		++__i_rename_at_37;
+	};
+	DAS_ASSERT((__j_rename_at_78 == __k_rename_at_78));
+	int32_t __j_rename_at_90 = 0; int32_t __k_rename_at_90 = 0;
+	das_copy(__i_rename_at_37,0);
+	while ( __i_rename_at_37 < 32 )
+	{
+		_Funcbuiltin_0x60_find_fd9952db15f0f9da(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36),((char *)(das_lexical_cast(__i_rename_at_37,__context__))),das_make_block<void,int32_t * const >(__context__,368,0,&__func_info__ad7520471b59db0c,[&](int32_t * const  __pVal_rename_at_93)->void{
+			__j_rename_at_90 += das_null_coalescing<int32_t>::get(__pVal_rename_at_93,0);
+		}));
+		if ( (SimPolicy<int32_t>::Mod(__i_rename_at_37,7,*__context__,nullptr)) != 0 )
+		{
+			__k_rename_at_90 += __i_rename_at_37;
+		};
+		++__i_rename_at_37;
+	};
+	DAS_ASSERT((__j_rename_at_90 == __k_rename_at_90));
+	das_copy(__i_rename_at_37,0);
+	while ( __i_rename_at_37 < 32 )
+	{
+		das_copy(__tab_rename_at_36(((char *)(das_lexical_cast(__i_rename_at_37,__context__))),__context__),__i_rename_at_37);
+		__i_rename_at_37 += 7;
+	};
+	DAS_ASSERT((builtin_table_size(das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36)) == 32));
+	das_copy(__i_rename_at_37,0);
+	while ( __i_rename_at_37 != 32 )
+	{
+		DAS_VERIFY((__tab_rename_at_36(((char *)(das_lexical_cast(__i_rename_at_37,__context__))),__context__) == __i_rename_at_37));
+		++__i_rename_at_37;
+	};
+	DAS_ASSERT((builtin_table_size(das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36)) == 32));
+	int32_t __cnt_rename_at_112 = 0;
+	{
+		bool __need_loop_113 = true;
+		// k : string const&
+		das_iterator<Sequence DAS_COMMENT((char * const ))> __k_iterator((_temp_make_local_113_400 = (_Funcbuiltin_0x60_keys_e42fdde57381fb5e(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36)))));
+		char * const  * __k_rename_at_113;
+		__need_loop_113 = __k_iterator.first(__context__,(__k_rename_at_113)) && __need_loop_113;
+		// v : int&
+		das_iterator<Sequence DAS_COMMENT((int32_t))> __v_iterator((_temp_make_local_113_416 = (_Funcbuiltin_0x60_values_b65bfa7ca0abf5be(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36)))));
+		int32_t * __v_rename_at_113;
+		__need_loop_113 = __v_iterator.first(__context__,(__v_rename_at_113)) && __need_loop_113;
+		for ( ; __need_loop_113 ; __need_loop_113 = __k_iterator.next(__context__,(__k_rename_at_113)) && __v_iterator.next(__context__,(__v_rename_at_113)) )
+		{
+			DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from((*__k_rename_at_113)),cast<char *>::from(((char *)(das_lexical_cast((*__v_rename_at_113),__context__)))),*__context__,nullptr)));
+			++__cnt_rename_at_112;
+		}
+		__k_iterator.close(__context__,(__k_rename_at_113));
+		__v_iterator.close(__context__,(__v_rename_at_113));
+	};
+	DAS_ASSERT((__cnt_rename_at_112 == 32));
+	DAS_VERIFY((_Funcbuiltin_0x60_erase_61b4ed4bc61116da(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36),((char *) "1"))));
+	DAS_VERIFY((!_Funcbuiltin_0x60_erase_61b4ed4bc61116da(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36),((char *) "-1"))));
+	TTable<bool,int32_t> __tab_bool_rename_at_123; das_zero(__tab_bool_rename_at_123);
+	DAS_ASSERT((!_Funcbuiltin_0x60_key_exists_f198e231103db6d0(__context__,das_arg<TTable<bool,int32_t>>::pass(__tab_bool_rename_at_123),false)));
+	DAS_ASSERT((!_Funcbuiltin_0x60_key_exists_f198e231103db6d0(__context__,das_arg<TTable<bool,int32_t>>::pass(__tab_bool_rename_at_123),true)));
+	das_copy(__tab_bool_rename_at_123(true,__context__),0);
+	DAS_ASSERT((_Funcbuiltin_0x60_key_exists_f198e231103db6d0(__context__,das_arg<TTable<bool,int32_t>>::pass(__tab_bool_rename_at_123),true)));
+	das_copy(__tab_bool_rename_at_123(false,__context__),-1);
+	DAS_ASSERT((_Funcbuiltin_0x60_key_exists_f198e231103db6d0(__context__,das_arg<TTable<bool,int32_t>>::pass(__tab_bool_rename_at_123),false)));
+	TTable<int32_t,int32_t> __tab_int_rename_at_131; das_zero(__tab_int_rename_at_131);
+	DAS_ASSERT((!_Funcbuiltin_0x60_key_exists_164817c6d7890150(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_int_rename_at_131),-1)));
+	das_copy(__tab_int_rename_at_131(-1,__context__),-1);
+	DAS_ASSERT((_Funcbuiltin_0x60_key_exists_164817c6d7890150(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_int_rename_at_131),-1)));
+	_Funcbuiltin_0x60_erase_b20b0382d59ae57c(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_int_rename_at_131),-1);
+	DAS_ASSERT((!_Funcbuiltin_0x60_key_exists_164817c6d7890150(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_int_rename_at_131),-1)));
+	TTable<char *,int32_t> __tab_string_rename_at_138; das_zero(__tab_string_rename_at_138);
+	DAS_ASSERT((!_Funcbuiltin_0x60_key_exists_65edeaae187fe7ac(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_string_rename_at_138),((char *) "---"))));
+	das_copy(__tab_string_rename_at_138(((char *) "---"),__context__),-1);
+	DAS_ASSERT((_Funcbuiltin_0x60_key_exists_65edeaae187fe7ac(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_string_rename_at_138),((char *) "---"))));
+	_Funcbuiltin_0x60_erase_61b4ed4bc61116da(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_string_rename_at_138),((char *) "---"));
+	DAS_ASSERT((!_Funcbuiltin_0x60_key_exists_65edeaae187fe7ac(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_string_rename_at_138),((char *) "---"))));
+	DAS_ASSERT((!_Funcbuiltin_0x60_key_exists_65edeaae187fe7ac(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_string_rename_at_138),((char *) " "))));
+	das_copy(__tab_string_rename_at_138(((char *) " "),__context__),-1);
+	DAS_ASSERT((_Funcbuiltin_0x60_key_exists_65edeaae187fe7ac(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_string_rename_at_138),((char *) " "))));
+	_Funcbuiltin_0x60_erase_61b4ed4bc61116da(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_string_rename_at_138),((char *) " "));
+	DAS_ASSERT((!_Funcbuiltin_0x60_key_exists_65edeaae187fe7ac(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_string_rename_at_138),((char *) " "))));
+	das_copy(__tab_string_rename_at_138(nullptr,__context__),-2);
+	DAS_ASSERT((_Funcbuiltin_0x60_key_exists_65edeaae187fe7ac(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_string_rename_at_138),nullptr)));
+	DAS_VERIFY((__tab_string_rename_at_138(nullptr,__context__) == -2));
+	_Funcbuiltin_0x60_erase_61b4ed4bc61116da(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_string_rename_at_138),nullptr);
+	DAS_ASSERT((!_Funcbuiltin_0x60_key_exists_65edeaae187fe7ac(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_string_rename_at_138),nullptr)));
+	test_erase_collision_aaf184dcdf93dcd9(__context__);
+	test_lock_panic_34bdc822ce21a284(__context__);
+	return das_auto_cast<bool>::cast(true);
+}}
+
+inline bool test_lock_panic_34bdc822ce21a284 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,256,"test_lock_panic " DAS_FILE_LINE);
+{
+	TDim<TTuple<16,char *,int32_t>,2> _temp_make_local_162_80;
+	TTable<char *,int32_t> __tab_rename_at_162; das_zero(__tab_rename_at_162); das_move(__tab_rename_at_162, _Funcbuiltin_0x60_to_table_move_d4e2568a5fc88cd5(__context__,das_arg<TDim<TTuple<16,char *,int32_t>,2>>::pass((([&]() -> TDim<TTuple<16,char *,int32_t>,2>& {
+		_temp_make_local_162_80(0,__context__) = (([&]() -> TTuple<16,char *,int32_t> {
+			TTuple<16,char *,int32_t> __mkt_162;
+			das_get_tuple_field<char *,0>::get(__mkt_162) = ((char *) "one");
+			das_get_tuple_field<int32_t,8>::get(__mkt_162) = 1;
+			return __mkt_162;
+		})());
+		_temp_make_local_162_80(1,__context__) = (([&]() -> TTuple<16,char *,int32_t> {
+			TTuple<16,char *,int32_t> __mkt_162;
+			das_get_tuple_field<char *,0>::get(__mkt_162) = ((char *) "two");
+			das_get_tuple_field<int32_t,8>::get(__mkt_162) = 2;
+			return __mkt_162;
+		})());
+		return _temp_make_local_162_80;
+	})()))));
+	bool __failed_rename_at_163 = false;
+	das_try_recover(__context__, [&]()
+	{
+		_Funcbuiltin_0x60_find_fd9952db15f0f9da(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_162),((char *) "one"),das_make_block<void,int32_t * const >(__context__,176,0,&__func_info__4de8fc42dc6bf9c5,[&](int32_t * const  __t_rename_at_165)->void{
+			DAS_ASSERT((__t_rename_at_165 != nullptr));
+			das_copy(__tab_rename_at_162(((char *) "three"),__context__),3);
+		}));
+	}, [&]()
+	{
+		das_copy(__failed_rename_at_163,true);
+	});
+	DAS_ASSERT((__failed_rename_at_163));
+	das_copy(__failed_rename_at_163,false);
+	das_try_recover(__context__, [&]()
+	{
+		_Funcbuiltin_0x60_find_fd9952db15f0f9da(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_162),((char *) "three"),das_make_block<void,int32_t * const >(__context__,240,0,&__func_info__4de8fc42dc6bf9c5,[&](int32_t * const  __t_rename_at_173)->void{
+			DAS_ASSERT((__t_rename_at_173 == nullptr));
+			_Funcbuiltin_0x60_erase_61b4ed4bc61116da(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_162),((char *) "three"));
+		}));
+	}, [&]()
+	{
+		das_copy(__failed_rename_at_163,true);
+	});
+	DAS_ASSERT((__failed_rename_at_163));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+inline bool check_e57a004afa5b7a90 ( Context * __context__, TableContainer &  __t_rename_at_190, TArray<int32_t> const  &  __deletedEntries_rename_at_190 )
+{
+	{
+		uint64_t __loop_count_191 = UINT64_MAX;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,100));
+		int32_t __i_rename_at_191;
+		__loop_count_191 = das_loop_count(__loop_count_191,__i_iterator.loop_begin(__context__,(__i_rename_at_191)));
+		for ( ; __loop_count_191 ; --__loop_count_191, ++__i_rename_at_191 )
+		{
+			bool __deleted_rename_at_192 = 0;
+			{
+				uint64_t __loop_count_193 = UINT64_MAX;
+				// x : int const&
+				das_iterator<TArray<int32_t> const > __x_iterator(__deletedEntries_rename_at_190);
+				int32_t const  * __x_rename_at_193;
+				__loop_count_193 = das_loop_count(__loop_count_193,__x_iterator.loop_begin(__context__,(__x_rename_at_193)));
+				for ( ; __loop_count_193 ; --__loop_count_193, ++__x_rename_at_193 )
+				{
+					if ( (*__x_rename_at_193) == __i_rename_at_191 )
+					{
+						das_copy(__deleted_rename_at_192,true);
+						break;
+					};
+				}
+				__x_iterator.loop_end(__context__,(__x_rename_at_193));
+			};
+			if ( __deleted_rename_at_192 )
+			{
+				continue;
+			} else {
+				char * __n_rename_at_199 = ((char *)(char *)(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_0, cast<char * const >::from(((char *) "name_")), cast<int32_t>::from(__i_rename_at_191)))));
+				if ( SimPolicy<char *>::NotEqu(cast<char *>::from(__t_rename_at_190.t(__n_rename_at_199,__context__).test),cast<char *>::from(__n_rename_at_199),*__context__,nullptr) )
+				{
+					return das_auto_cast<bool>::cast(false);
+				};
+			};
+		}
+		__i_iterator.loop_end(__context__,(__i_rename_at_191));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline void test_erase_collision_aaf184dcdf93dcd9 ( Context * __context__ )
+{
+	TableContainer __t_rename_at_206; das_zero(__t_rename_at_206);
+	TArray<char *> __names_rename_at_207; das_zero(__names_rename_at_207);
+	{
+		uint64_t __loop_count_208 = UINT64_MAX;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,100));
+		int32_t __i_rename_at_208;
+		__loop_count_208 = das_loop_count(__loop_count_208,__i_iterator.loop_begin(__context__,(__i_rename_at_208)));
+		for ( ; __loop_count_208 ; --__loop_count_208, ++__i_rename_at_208 )
+		{
+			_Funcbuiltin_0x60_push_49bdd408ef1e4c5a(__context__,das_arg<TArray<char *>>::pass(__names_rename_at_207),das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_1, cast<char * const >::from(((char *) "name_")), cast<int32_t>::from(__i_rename_at_208))));
+		}
+		__i_iterator.loop_end(__context__,(__i_rename_at_208));
+	};
+	{
+		uint64_t __loop_count_210 = UINT64_MAX;
+		// n : string&
+		das_iterator<TArray<char *>> __n_iterator(__names_rename_at_207);
+		char * * __restrict __n_rename_at_210;
+		__loop_count_210 = das_loop_count(__loop_count_210,__n_iterator.loop_begin(__context__,(__n_rename_at_210)));
+		for ( ; __loop_count_210 ; --__loop_count_210, ++__n_rename_at_210 )
+		{
+			TestStruct _temp_make_local_211_144;
+			das_move(__t_rename_at_206.t((*__n_rename_at_210),__context__),(([&]() -> TestStruct& {
+				das_copy((_temp_make_local_211_144.test),((*__n_rename_at_210)));
+				return _temp_make_local_211_144;
+			})()));
+		}
+		__n_iterator.loop_end(__context__,(__n_rename_at_210));
+	};
+	TArray<int32_t> __deletedEntries_rename_at_212; das_zero(__deletedEntries_rename_at_212);
+	DAS_VERIFY((check_e57a004afa5b7a90(__context__,das_arg<TableContainer>::pass(__t_rename_at_206),das_arg<TArray<int32_t>>::pass(__deletedEntries_rename_at_212))));
+	{
+		uint64_t __loop_count_214 = UINT64_MAX;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,100));
+		int32_t __i_rename_at_214;
+		__loop_count_214 = das_loop_count(__loop_count_214,__i_iterator.loop_begin(__context__,(__i_rename_at_214)));
+		for ( ; __loop_count_214 ; --__loop_count_214, ++__i_rename_at_214 )
+		{
+			char * __x_rename_at_215 = ((char *)(char *)(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_2, cast<char * const >::from(((char *) "name_")), cast<int32_t>::from(__i_rename_at_214)))));
+			_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(__deletedEntries_rename_at_212),__i_rename_at_214);
+			_Funcbuiltin_0x60_erase_525a560436991d88(__context__,das_arg<TTable<char *,TestStruct>>::pass(__t_rename_at_206.t),__x_rename_at_215);
+			DAS_VERIFY((check_e57a004afa5b7a90(__context__,das_arg<TableContainer>::pass(__t_rename_at_206),das_arg<TArray<int32_t>>::pass(__deletedEntries_rename_at_212))));
+		}
+		__i_iterator.loop_end(__context__,(__i_rename_at_214));
+	};
+}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_find_if_exists_7ee55bb5a3679228
+	aotLib[0x8bf40668e33761d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<char *,int32_t> const  & , char * const  , Block DAS_COMMENT((void,int32_t * const )) const  &  ),&_Funcbuiltin_0x60_find_if_exists_7ee55bb5a3679228>>();
+	};
+	// _Funcbuiltin_0x60_find_for_edit_54cf37fec08499c6
+	aotLib[0x73bcfb1efaf0bcf9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<char *,int32_t> & , char * const  , Block DAS_COMMENT((void,int32_t *)) const  &  ),&_Funcbuiltin_0x60_find_for_edit_54cf37fec08499c6>>();
+	};
+	// _Funcbuiltin_0x60_find_for_edit_if_exists_c3be78c372b66c6b
+	aotLib[0xa33edb11f555cf0d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<char *,int32_t> & , char * const  , Block DAS_COMMENT((void,int32_t *)) const  &  ),&_Funcbuiltin_0x60_find_for_edit_if_exists_c3be78c372b66c6b>>();
+	};
+	// _Funcbuiltin_0x60_find_for_edit_f24db96641bb3dd
+	aotLib[0x9a2dac82f06d4b6d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t * (*) ( Context * __context__, TTable<char *,int32_t> & , char * const   ),&_Funcbuiltin_0x60_find_for_edit_f24db96641bb3dd>>();
+	};
+	// _Funcbuiltin_0x60_to_table_move_d4e2568a5fc88cd5
+	aotLib[0xe70dcdfa92f52ee9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TTable<char *,int32_t> (*) ( Context * __context__, TDim<TTuple<16,char *,int32_t>,2> &  ),&_Funcbuiltin_0x60_to_table_move_d4e2568a5fc88cd5>>();
+	};
+	// _Funcbuiltin_0x60_erase_61b4ed4bc61116da
+	aotLib[0x3cb88775d3e4742d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<char *,int32_t> & , char * const   ),&_Funcbuiltin_0x60_erase_61b4ed4bc61116da>>();
+	};
+	// _Funcbuiltin_0x60_find_fd9952db15f0f9da
+	aotLib[0x459fa806d87d2d7d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<char *,int32_t> const  & , char * const  , Block DAS_COMMENT((void,int32_t * const )) const  &  ),&_Funcbuiltin_0x60_find_fd9952db15f0f9da>>();
+	};
+	// _Funcbuiltin_0x60_find_d1c87b7bbc435721
+	aotLib[0xe591e80736e2c791] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t const  * (*) ( Context * __context__, TTable<char *,int32_t> const  & , char * const   ),&_Funcbuiltin_0x60_find_d1c87b7bbc435721>>();
+	};
+	// _Funcbuiltin_0x60_keys_e42fdde57381fb5e
+	aotLib[0x160f40a129ee52a9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((char * const  &)) (*) ( Context * __context__, TTable<char *,int32_t> const  &  ),&_Funcbuiltin_0x60_keys_e42fdde57381fb5e>>();
+	};
+	// _Funcbuiltin_0x60_values_b65bfa7ca0abf5be
+	aotLib[0x7dd116f14474a229] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t &)) (*) ( Context * __context__, TTable<char *,int32_t> &  ),&_Funcbuiltin_0x60_values_b65bfa7ca0abf5be>>();
+	};
+	// _Funcbuiltin_0x60_key_exists_f198e231103db6d0
+	aotLib[0x38b494c47f093a15] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<bool,int32_t> const  & , bool  ),&_Funcbuiltin_0x60_key_exists_f198e231103db6d0>>();
+	};
+	// _Funcbuiltin_0x60_key_exists_164817c6d7890150
+	aotLib[0xc7c11e5244a2f1c9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<int32_t,int32_t> const  & , int32_t  ),&_Funcbuiltin_0x60_key_exists_164817c6d7890150>>();
+	};
+	// _Funcbuiltin_0x60_erase_b20b0382d59ae57c
+	aotLib[0xaa9de85420b74e25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<int32_t,int32_t> & , int32_t  ),&_Funcbuiltin_0x60_erase_b20b0382d59ae57c>>();
+	};
+	// _Funcbuiltin_0x60_key_exists_65edeaae187fe7ac
+	aotLib[0x9c0d8b0eceeeb3dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<char *,int32_t> const  & , char * const   ),&_Funcbuiltin_0x60_key_exists_65edeaae187fe7ac>>();
+	};
+	// _Funcbuiltin_0x60_push_49bdd408ef1e4c5a
+	aotLib[0xb187be2de84ea8d9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , char * const   ),&_Funcbuiltin_0x60_push_49bdd408ef1e4c5a>>();
+	};
+	// _Funcbuiltin_0x60_push_d21751720b4df10e
+	aotLib[0x9fb5b63c22625999] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_d21751720b4df10e>>();
+	};
+	// _Funcbuiltin_0x60_erase_525a560436991d88
+	aotLib[0xe0916f20923a4cd9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<char *,TestStruct> & , char * const   ),&_Funcbuiltin_0x60_erase_525a560436991d88>>();
+	};
+	// test_find_1b7a59b556b073a8
+	aotLib[0xe4a46dd80eedd77c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_find_1b7a59b556b073a8>>();
+	};
+	// test_e2bf523908c6d640
+	aotLib[0xe45e0ddd3398036e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_e2bf523908c6d640>>();
+	};
+	// test_lock_panic_34bdc822ce21a284
+	aotLib[0xab350ade9528fade] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_lock_panic_34bdc822ce21a284>>();
+	};
+	// check_e57a004afa5b7a90
+	aotLib[0x9f31515ae2cfb5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TableContainer & , TArray<int32_t> const  &  ),&check_e57a004afa5b7a90>>();
+	};
+	// test_erase_collision_aaf184dcdf93dcd9
+	aotLib[0x9145fac039ea02c9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_erase_collision_aaf184dcdf93dcd9>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,868 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require jobque
+#include "daScript/simulate/aot_builtin_jobque.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require strings_boost
+ // require ast_boost
+ // require templates
+ // require jobque_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_3051613471692060290 {
+
+extern StructInfo __struct_info__c70a59dee7d757c8;
+extern StructInfo __struct_info__6989d632e5581748;
+extern StructInfo __struct_info__e5095599a587ca50;
+extern StructInfo __struct_info__39e00ee5a445fd07;
+extern StructInfo __struct_info__838012e86500b30d;
+extern TypeInfo __type_info__a7244f77d75ea149;
+extern TypeInfo __type_info__89f87fddfa254636;
+extern TypeInfo __type_info__569f9f2b1331f4d2;
+extern TypeInfo __type_info__baa4c4bc11614b7;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__90f4c07b5a6e390;
+extern TypeInfo __type_info__117f5cf4148559d4;
+extern TypeInfo __type_info__2f707f193f39acb0;
+extern TypeInfo __type_info__de07e88d204ba4b0;
+extern TypeInfo __type_info__b24c6b19126eda29;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__527c1866e14c26a7;
+extern TypeInfo __type_info__87830cbb3176f4fe;
+extern TypeInfo __type_info__fe24a2dd43758fc9;
+extern TypeInfo __type_info__5c0317348680295f;
+extern TypeInfo __type_info__3ceb21b1e6727087;
+extern VarInfo __var_info__7395b868f21cfae9;
+extern VarInfo __var_info__ed408fd07bade1c0;
+extern VarInfo __var_info__996b1cb2a31043fc;
+extern VarInfo __var_info__af54561d500e6219;
+extern VarInfo __var_info__13f7c98505bae5c4;
+extern VarInfo __var_info__db45aaec75ab7bff;
+extern VarInfo __var_info__d1fac18297a969fc;
+extern VarInfo __var_info__bf0a7891be5e5b36;
+extern VarInfo __var_info__1e12ac326c257baf;
+extern VarInfo __var_info__1dfee10f7761dfd4;
+extern VarInfo __var_info__18aab86bb3264c3a;
+extern VarInfo __var_info__401fe9c0f41e9c3;
+extern VarInfo __var_info__48451147c3a4df78;
+extern VarInfo __var_info__85046dd2ed4bae71;
+extern VarInfo __var_info__ed409bd07badf624;
+extern VarInfo __var_info__a5287aee19f7e65f;
+extern VarInfo __var_info__1dfee20f7761e187;
+extern VarInfo __var_info__c68ce48f6c3a8ae9;
+extern VarInfo __var_info__f39e46a82669d8f8;
+extern VarInfo __var_info__23f479c6e1a03f99;
+extern VarInfo __var_info__e91a2e3649f8d2df;
+extern VarInfo __var_info__3abde3f972d5b902;
+extern VarInfo __var_info__49adcf947981896c;
+extern FuncInfo __func_info__cfb81a8365a0ae64;
+extern FuncInfo __func_info__e3ccd7343d92b33;
+extern FuncInfo __func_info__3ad0a31d00c9d958;
+extern FuncInfo __func_info__eeb3b74c98cb09c3;
+
+TypeInfo * __type_info__23f479c6e1a03f99_arg_types_var_14342374777222027208[1] = { &__type_info__baa4c4bc11614b7 };
+VarInfo __struct_info__c70a59dee7d757c8_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__23f479c6e1a03f99_arg_types_var_14342374777222027208, nullptr, 1, 0, nullptr, 28, 8, 0x23f479c6e1a03f99ul, "__lambda", 0 };
+TypeInfo * __type_info__f39e46a82669d8f8_arg_types_var_14342374777222027208[1] = { &__type_info__527c1866e14c26a7 };
+VarInfo __struct_info__c70a59dee7d757c8_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__f39e46a82669d8f8_arg_types_var_14342374777222027208, nullptr, 1, 0, nullptr, 28, 8, 0xf39e46a82669d8f8ul, "__finalize", 8 };
+VarInfo __struct_info__c70a59dee7d757c8_field_2 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__89f87fddfa254636, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0xe91a2e3649f8d2dful, "channel", 16 };
+VarInfo __struct_info__c70a59dee7d757c8_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0x49adcf947981896cul, "x", 24 };
+VarInfo * __struct_info__c70a59dee7d757c8_fields[4] =  { &__struct_info__c70a59dee7d757c8_field_0, &__struct_info__c70a59dee7d757c8_field_1, &__struct_info__c70a59dee7d757c8_field_2, &__struct_info__c70a59dee7d757c8_field_3 };
+StructInfo __struct_info__c70a59dee7d757c8 = {(char*)"_lambda_thismodule_25_20_2", (char*)"", 6, __struct_info__c70a59dee7d757c8_fields, 4, 32, 0x0ul, nullptr, 0xc70a59dee7d757c8ul };
+TypeInfo * __type_info__af54561d500e6219_arg_types_var_7604844959876257608[2] = { &__type_info__b24c6b19126eda29, &__type_info__a7244f77d75ea149 };
+VarInfo __struct_info__6989d632e5581748_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__af54561d500e6219_arg_types_var_7604844959876257608, nullptr, 2, 0, nullptr, 28, 8, 0xaf54561d500e6219ul, "__lambda", 0 };
+TypeInfo * __type_info__48451147c3a4df78_arg_types_var_7604844959876257608[1] = { &__type_info__5c0317348680295f };
+VarInfo __struct_info__6989d632e5581748_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__48451147c3a4df78_arg_types_var_7604844959876257608, nullptr, 1, 0, nullptr, 28, 8, 0x48451147c3a4df78ul, "__finalize", 8 };
+VarInfo __struct_info__6989d632e5581748_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xdb45aaec75ab7bfful, "__yield", 16 };
+VarInfo __struct_info__6989d632e5581748_field_3 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__89f87fddfa254636, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0xa5287aee19f7e65ful, "channel", 24 };
+VarInfo __struct_info__6989d632e5581748_field_4 =  { Type::tPointer, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0xd1fac18297a969fcul, "__void_data_rename_at_104", 32 };
+VarInfo * __struct_info__6989d632e5581748_fields[5] =  { &__struct_info__6989d632e5581748_field_0, &__struct_info__6989d632e5581748_field_1, &__struct_info__6989d632e5581748_field_2, &__struct_info__6989d632e5581748_field_3, &__struct_info__6989d632e5581748_field_4 };
+StructInfo __struct_info__6989d632e5581748 = {(char*)"_lambda_thismodule_103_12_4", (char*)"", 6, __struct_info__6989d632e5581748_fields, 5, 40, 0x0ul, nullptr, 0x6989d632e5581748ul };
+VarInfo __struct_info__e5095599a587ca50_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xed409bd07badf624ul, "x", 0 };
+VarInfo __struct_info__e5095599a587ca50_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xed408fd07bade1c0ul, "t", 4 };
+VarInfo * __struct_info__e5095599a587ca50_fields[2] =  { &__struct_info__e5095599a587ca50_field_0, &__struct_info__e5095599a587ca50_field_1 };
+StructInfo __struct_info__e5095599a587ca50 = {(char*)"Work", (char*)"", 0, __struct_info__e5095599a587ca50_fields, 2, 8, 0x0ul, nullptr, 0xe5095599a587ca50ul };
+TypeInfo * __type_info__13f7c98505bae5c4_arg_types_var_4170349634411429127[1] = { &__type_info__87830cbb3176f4fe };
+VarInfo __struct_info__39e00ee5a445fd07_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__13f7c98505bae5c4_arg_types_var_4170349634411429127, nullptr, 1, 0, nullptr, 28, 8, 0x13f7c98505bae5c4ul, "__lambda", 0 };
+TypeInfo * __type_info__85046dd2ed4bae71_arg_types_var_4170349634411429127[1] = { &__type_info__569f9f2b1331f4d2 };
+VarInfo __struct_info__39e00ee5a445fd07_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__85046dd2ed4bae71_arg_types_var_4170349634411429127, nullptr, 1, 0, nullptr, 28, 8, 0x85046dd2ed4bae71ul, "__finalize", 8 };
+VarInfo __struct_info__39e00ee5a445fd07_field_2 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2f707f193f39acb0, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0x1e12ac326c257baful, "status", 16 };
+VarInfo __struct_info__39e00ee5a445fd07_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0x1dfee20f7761e187ul, "x", 24 };
+VarInfo __struct_info__39e00ee5a445fd07_field_4 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, 0x1dfee10f7761dfd4ul, "y", 32 };
+VarInfo * __struct_info__39e00ee5a445fd07_fields[5] =  { &__struct_info__39e00ee5a445fd07_field_0, &__struct_info__39e00ee5a445fd07_field_1, &__struct_info__39e00ee5a445fd07_field_2, &__struct_info__39e00ee5a445fd07_field_3, &__struct_info__39e00ee5a445fd07_field_4 };
+StructInfo __struct_info__39e00ee5a445fd07 = {(char*)"_lambda_thismodule_16_20_1", (char*)"", 22, __struct_info__39e00ee5a445fd07_fields, 5, 56, 0x0ul, nullptr, 0x39e00ee5a445fd07ul };
+TypeInfo * __type_info__bf0a7891be5e5b36_arg_types_var_9475594405323780877[1] = { &__type_info__de07e88d204ba4b0 };
+VarInfo __struct_info__838012e86500b30d_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__bf0a7891be5e5b36_arg_types_var_9475594405323780877, nullptr, 1, 0, nullptr, 28, 8, 0xbf0a7891be5e5b36ul, "__lambda", 0 };
+TypeInfo * __type_info__401fe9c0f41e9c3_arg_types_var_9475594405323780877[1] = { &__type_info__117f5cf4148559d4 };
+VarInfo __struct_info__838012e86500b30d_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__401fe9c0f41e9c3_arg_types_var_9475594405323780877, nullptr, 1, 0, nullptr, 28, 8, 0x401fe9c0f41e9c3ul, "__finalize", 8 };
+VarInfo __struct_info__838012e86500b30d_field_2 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__89f87fddfa254636, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0x3abde3f972d5b902ul, "channel", 16 };
+VarInfo __struct_info__838012e86500b30d_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0x7395b868f21cfae9ul, "x", 24 };
+VarInfo * __struct_info__838012e86500b30d_fields[4] =  { &__struct_info__838012e86500b30d_field_0, &__struct_info__838012e86500b30d_field_1, &__struct_info__838012e86500b30d_field_2, &__struct_info__838012e86500b30d_field_3 };
+StructInfo __struct_info__838012e86500b30d = {(char*)"_lambda_thismodule_38_20_3", (char*)"", 6, __struct_info__838012e86500b30d_fields, 4, 32, 0x0ul, nullptr, 0x838012e86500b30dul };
+VarInfo __func_info__cfb81a8365a0ae64_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__89f87fddfa254636, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0xc68ce48f6c3a8ae9ul, "channel", 0 };
+VarInfo * __func_info__cfb81a8365a0ae64_fields[1] =  { &__func_info__cfb81a8365a0ae64_field_0 };
+FuncInfo __func_info__cfb81a8365a0ae64 = {"invoke block<(channel:jobque::Channel?):void> const", "", __func_info__cfb81a8365a0ae64_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,0xcfb81a8365a0ae64ul, 0x0 };
+VarInfo __func_info__e3ccd7343d92b33_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2f707f193f39acb0, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0x18aab86bb3264c3aul, "status", 0 };
+VarInfo * __func_info__e3ccd7343d92b33_fields[1] =  { &__func_info__e3ccd7343d92b33_field_0 };
+FuncInfo __func_info__e3ccd7343d92b33 = {"invoke block<(status:jobque::JobStatus?):void> const", "", __func_info__e3ccd7343d92b33_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,0xe3ccd7343d92b33ul, 0x0 };
+VarInfo __func_info__3ad0a31d00c9d958_field_0 =  { Type::tStructure, &__struct_info__e5095599a587ca50, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 126, 8, 0x996b1cb2a31043fcul, "w", 0 };
+VarInfo * __func_info__3ad0a31d00c9d958_fields[1] =  { &__func_info__3ad0a31d00c9d958_field_0 };
+FuncInfo __func_info__3ad0a31d00c9d958 = {"invoke block<(w:Work const#):void> const", "", __func_info__3ad0a31d00c9d958_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,0x3ad0a31d00c9d958ul, 0x0 };
+FuncInfo __func_info__eeb3b74c98cb09c3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,0xeeb3b74c98cb09c3ul, 0x0 };
+TypeInfo __type_info__a7244f77d75ea149 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__fe24a2dd43758fc9, nullptr, nullptr, nullptr, 0, 0, nullptr, 8461, 8, 0xa7244f77d75ea149ul };
+TypeInfo __type_info__89f87fddfa254636 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~jobque::Channel"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 216, 0x89f87fddfa254636ul };
+TypeInfo __type_info__569f9f2b1331f4d2 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__87830cbb3176f4fe, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0x569f9f2b1331f4d2ul };
+TypeInfo __type_info__baa4c4bc11614b7 = { Type::tStructure, &__struct_info__c70a59dee7d757c8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8206, 32, 0xbaa4c4bc11614b7ul };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0xaf63e44c8601fa24ul };
+TypeInfo __type_info__90f4c07b5a6e390 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 1, 0x90f4c07b5a6e390ul };
+TypeInfo __type_info__117f5cf4148559d4 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__de07e88d204ba4b0, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0x117f5cf4148559d4ul };
+TypeInfo __type_info__2f707f193f39acb0 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~jobque::JobStatus"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 96, 0x2f707f193f39acb0ul };
+TypeInfo __type_info__de07e88d204ba4b0 = { Type::tStructure, &__struct_info__838012e86500b30d, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8206, 32, 0xde07e88d204ba4b0ul };
+TypeInfo __type_info__b24c6b19126eda29 = { Type::tStructure, &__struct_info__6989d632e5581748, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8206, 40, 0xb24c6b19126eda29ul };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, 0xaf63eb4c86020609ul };
+TypeInfo __type_info__527c1866e14c26a7 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__baa4c4bc11614b7, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0x527c1866e14c26a7ul };
+TypeInfo __type_info__87830cbb3176f4fe = { Type::tStructure, &__struct_info__39e00ee5a445fd07, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 56, 0x87830cbb3176f4feul };
+TypeInfo __type_info__fe24a2dd43758fc9 = { Type::tStructure, &__struct_info__e5095599a587ca50, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 126, 8, 0xfe24a2dd43758fc9ul };
+TypeInfo __type_info__5c0317348680295f = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b24c6b19126eda29, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, 0x5c0317348680295ful };
+TypeInfo __type_info__3ceb21b1e6727087 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, 0x3ceb21b1e6727087ul };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__3ceb21b1e6727087 };
+namespace  { struct Work; };
+namespace  { struct _lambda_thismodule_16_20_1; };
+namespace  { struct _lambda_thismodule_25_20_2; };
+namespace  { struct _lambda_thismodule_38_20_3; };
+namespace  { struct _lambda_thismodule_103_12_4; };
+namespace  { struct _lambda_thismodule_16_20_1_new_job_clone; };
+namespace  { struct _lambda_thismodule_25_20_2_new_job_clone; };
+namespace  { struct _lambda_thismodule_38_20_3_new_job_clone; };
+namespace ast { struct AstFunctionAnnotation; };
+namespace ast { struct AstBlockAnnotation; };
+namespace ast { struct AstStructureAnnotation; };
+namespace ast { struct AstPassMacro; };
+namespace ast { struct AstVariantMacro; };
+namespace ast { struct AstReaderMacro; };
+namespace ast { struct AstCommentReader; };
+namespace ast { struct AstCallMacro; };
+namespace ast { struct AstTypeInfoMacro; };
+namespace ast { struct AstEnumerationAnnotation; };
+namespace ast { struct AstVisitor; };
+namespace ast_boost { struct MacroMacro; };
+namespace ast_boost { struct TagFunctionAnnotation; };
+namespace ast_boost { struct TagStructureAnnotation; };
+namespace ast_boost { struct SetupAnyAnnotation; };
+namespace ast_boost { struct SetupFunctionAnnotatoin; };
+namespace ast_boost { struct SetupBlockAnnotatoin; };
+namespace ast_boost { struct SetupStructureAnnotatoin; };
+namespace ast_boost { struct SetupEnumerationAnnotation; };
+namespace ast_boost { struct SetupContractAnnotatoin; };
+namespace ast_boost { struct SetupReaderMacro; };
+namespace ast_boost { struct SetupCommentReader; };
+namespace ast_boost { struct SetupVariantMacro; };
+namespace ast_boost { struct SetupCallMacro; };
+namespace ast_boost { struct SetupTypeInfoMacro; };
+namespace ast_boost { struct SetupInferMacro; };
+namespace ast_boost { struct SetupDirtyInferMacro; };
+namespace ast_boost { struct SetupLintMacro; };
+namespace ast_boost { struct SetupGlobalLintMacro; };
+namespace ast_boost { struct SetupOptimizationMacro; };
+namespace ast_boost { struct TagFunctionMacro; };
+namespace ast_boost { struct BetterRttiVisitor; };
+namespace templates { struct DecltypeMacro; };
+namespace templates { struct DecltypeNoRefMacro; };
+namespace templates { struct TemplateMacro; };
+namespace jobque_boost { struct NewJobMacro; };
+// unused enumeration CompilationError
+// unused enumeration Type
+// unused enumeration RefMatters
+// unused enumeration ConstMatters
+// unused enumeration TemporaryMatters
+// unused enumeration SideEffects
+// unused enumeration CaptureMode
+// unused structure AstFunctionAnnotation
+// unused structure AstBlockAnnotation
+// unused structure AstStructureAnnotation
+// unused structure AstPassMacro
+// unused structure AstVariantMacro
+// unused structure AstReaderMacro
+// unused structure AstCommentReader
+// unused structure AstCallMacro
+// unused structure AstTypeInfoMacro
+// unused structure AstEnumerationAnnotation
+// unused structure AstVisitor
+// unused structure MacroMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagStructureAnnotation
+// unused structure SetupAnyAnnotation
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupBlockAnnotatoin
+// unused structure SetupStructureAnnotatoin
+// unused structure SetupEnumerationAnnotation
+// unused structure SetupContractAnnotatoin
+// unused structure SetupReaderMacro
+// unused structure SetupCommentReader
+// unused structure SetupVariantMacro
+// unused structure SetupCallMacro
+// unused structure SetupTypeInfoMacro
+// unused structure SetupInferMacro
+// unused structure SetupDirtyInferMacro
+// unused structure SetupLintMacro
+// unused structure SetupGlobalLintMacro
+// unused structure SetupOptimizationMacro
+// unused structure TagFunctionMacro
+// unused structure BetterRttiVisitor
+// unused structure DecltypeMacro
+// unused structure DecltypeNoRefMacro
+// unused structure TemplateMacro
+// unused structure NewJobMacro
+namespace  {
+
+struct Work {
+	int32_t x;
+	int32_t t;
+};
+static_assert(sizeof(Work)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Work,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Work,t)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_16_20_1 {
+	Func DAS_COMMENT((void,_lambda_thismodule_16_20_1)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_16_20_1 *)) __finalize;
+	JobStatus * status;
+	int32_t x;
+	TArray<int32_t> y;
+};
+static_assert(sizeof(_lambda_thismodule_16_20_1)==56,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_20_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_20_1,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_20_1,status)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_20_1,x)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_20_1,y)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_25_20_2 {
+	Func DAS_COMMENT((void,_lambda_thismodule_25_20_2)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_25_20_2 *)) __finalize;
+	Channel * channel;
+	int32_t x;
+};
+static_assert(sizeof(_lambda_thismodule_25_20_2)==32,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_25_20_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_25_20_2,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_25_20_2,channel)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_25_20_2,x)==24,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_38_20_3 {
+	Func DAS_COMMENT((void,_lambda_thismodule_38_20_3)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_38_20_3 *)) __finalize;
+	Channel * channel;
+	int32_t x;
+};
+static_assert(sizeof(_lambda_thismodule_38_20_3)==32,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_38_20_3,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_38_20_3,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_38_20_3,channel)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_38_20_3,x)==24,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_103_12_4 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_103_12_4,Work const  * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_103_12_4 *)) __finalize;
+	int32_t __yield;
+	Channel * channel;
+	void * __void_data_rename_at_104;
+};
+static_assert(sizeof(_lambda_thismodule_103_12_4)==40,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_103_12_4,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_103_12_4,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_103_12_4,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_103_12_4,channel)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_103_12_4,__void_data_rename_at_104)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_16_20_1_new_job_clone {
+	Func DAS_COMMENT((void,_lambda_thismodule_16_20_1)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_16_20_1 *)) __finalize;
+	JobStatus * status;
+	int32_t x;
+	TArray<int32_t> y;
+};
+static_assert(sizeof(_lambda_thismodule_16_20_1_new_job_clone)==56,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_20_1_new_job_clone,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_20_1_new_job_clone,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_20_1_new_job_clone,status)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_20_1_new_job_clone,x)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_20_1_new_job_clone,y)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_25_20_2_new_job_clone {
+	Func DAS_COMMENT((void,_lambda_thismodule_25_20_2)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_25_20_2 *)) __finalize;
+	Channel * channel;
+	int32_t x;
+};
+static_assert(sizeof(_lambda_thismodule_25_20_2_new_job_clone)==32,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_25_20_2_new_job_clone,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_25_20_2_new_job_clone,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_25_20_2_new_job_clone,channel)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_25_20_2_new_job_clone,x)==24,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_38_20_3_new_job_clone {
+	Func DAS_COMMENT((void,_lambda_thismodule_38_20_3)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_38_20_3 *)) __finalize;
+	Channel * channel;
+	int32_t x;
+};
+static_assert(sizeof(_lambda_thismodule_38_20_3_new_job_clone)==32,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_38_20_3_new_job_clone,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_38_20_3_new_job_clone,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_38_20_3_new_job_clone,channel)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_38_20_3_new_job_clone,x)==24,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60_clone_4bc3594d348ca0bd ( Context * __context__, TArray<int32_t> & __a_rename_at_249, TArray<int32_t> const  & __b_rename_at_249 );
+inline void finalize_49cd92bb30524b7c ( Context * __context__, _lambda_thismodule_103_12_4 & ____this_rename_at_103 );
+inline Sequence DAS_COMMENT((Work const  &)) _Funcbuiltin_0x60_each_ref_31cbd29dd352bcfd ( Context * __context__, Lambda DAS_COMMENT((bool,Work const  * &)) const  __lam_rename_at_381 );
+inline void finalize_bb0ef778d3414e1 ( Context * __context__, _lambda_thismodule_16_20_1 & ____this_rename_at_16 );
+inline void finalize_2310198c3f5c050c ( Context * __context__, _lambda_thismodule_25_20_2 & ____this_rename_at_25 );
+inline void finalize_c6cfad95212c91a3 ( Context * __context__, _lambda_thismodule_38_20_3 & ____this_rename_at_38 );
+inline bool _Func_lambda_thismodule_103_12_4_0x60_function_18afc87e8ce28e4e ( Context * __context__, _lambda_thismodule_103_12_4 & ____this_rename_at_103, Work const  * & ___ryield103_rename_at_103 );
+inline void _Func_lambda_thismodule_103_12_4_0x60_finalizer_f6a1811136975a96 ( Context * __context__, _lambda_thismodule_103_12_4 * ____this_rename_at_103 );
+inline TArray<int32_t> & _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd ( Context * __context__, TArray<int32_t> & __a_rename_at_42 );
+inline void clone_f22a49f16d5e014d ( Context * __context__, _lambda_thismodule_16_20_1_new_job_clone & __a_rename_at_16, _lambda_thismodule_16_20_1_new_job_clone const  & __b_rename_at_16 );
+inline void clone_c8c1a4dd7f2f9a41 ( Context * __context__, _lambda_thismodule_25_20_2_new_job_clone & __a_rename_at_25, _lambda_thismodule_25_20_2_new_job_clone const  & __b_rename_at_25 );
+inline void clone_8ddf918c99b89333 ( Context * __context__, _lambda_thismodule_38_20_3_new_job_clone & __a_rename_at_38, _lambda_thismodule_38_20_3_new_job_clone const  & __b_rename_at_38 );
+inline Sequence DAS_COMMENT((Work const  &)) _Func_0x60_template_0x60_0x9ae6ef0237d899a0_0x60_jobque_boost_0x60_each_69bfe90215e05b31 ( Context * __context__, Channel * const  __channel_rename_at_97 );
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> & __Arr_rename_at_75, int32_t __value_rename_at_75 );
+inline void _Func_lambda_thismodule_16_20_1_0x60_function_7b45c2c568d06003 ( Context * __context__, _lambda_thismodule_16_20_1 & ____this_rename_at_16 );
+inline void _Func_lambda_thismodule_16_20_1_0x60_finalizer_4fdddf92fd17908a ( Context * __context__, _lambda_thismodule_16_20_1 * ____this_rename_at_16 );
+inline void _Funcjobque_boost_0x60_push_clone_da713af63af8d87f ( Context * __context__, Channel * const  __channel_rename_at_86, Work const  & __data_rename_at_86 );
+inline void _Func_lambda_thismodule_25_20_2_0x60_function_3df419c413e23ad1 ( Context * __context__, _lambda_thismodule_25_20_2 & ____this_rename_at_25 );
+inline void _Func_lambda_thismodule_25_20_2_0x60_finalizer_99287f364d0fe9b4 ( Context * __context__, _lambda_thismodule_25_20_2 * ____this_rename_at_25 );
+inline void _Funcjobque_boost_0x60_for_each_5e3fb95ea02e92be ( Context * __context__, Channel * const  __channel_rename_at_74, Block DAS_COMMENT((void,Work const )) const  & __blk_rename_at_74 );
+inline void _Func_lambda_thismodule_38_20_3_0x60_function_4ddfbc2141d8ac1c ( Context * __context__, _lambda_thismodule_38_20_3 & ____this_rename_at_38 );
+inline void _Func_lambda_thismodule_38_20_3_0x60_finalizer_4c08ba03df06924a ( Context * __context__, _lambda_thismodule_38_20_3 * ____this_rename_at_38 );
+inline bool test_515d4eb849673ad7 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_clone_4bc3594d348ca0bd ( Context * __context__, TArray<int32_t> &  __a_rename_at_249, TArray<int32_t> const  &  __b_rename_at_249 )
+{
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_249),builtin_array_size(__b_rename_at_249));
+	{
+		uint64_t __loop_count_251 = UINT64_MAX;
+		// aV : int aka TT&
+		das_iterator<TArray<int32_t>> __aV_iterator(__a_rename_at_249);
+		int32_t * __aV_rename_at_251;
+		__loop_count_251 = das_loop_count(__loop_count_251,__aV_iterator.loop_begin(__context__,(__aV_rename_at_251)));
+		// bV : int const&
+		das_iterator<TArray<int32_t> const > __bV_iterator(__b_rename_at_249);
+		int32_t const  * __bV_rename_at_251;
+		__loop_count_251 = das_loop_count(__loop_count_251,__bV_iterator.loop_begin(__context__,(__bV_rename_at_251)));
+		for ( ; __loop_count_251 ; --__loop_count_251, ++__aV_rename_at_251, ++__bV_rename_at_251 )
+		{
+			das_copy((*__aV_rename_at_251),(*__bV_rename_at_251));
+		}
+		__aV_iterator.loop_end(__context__,(__aV_rename_at_251));
+		__bV_iterator.loop_end(__context__,(__bV_rename_at_251));
+	};
+}
+
+inline void finalize_49cd92bb30524b7c ( Context * __context__, _lambda_thismodule_103_12_4 &  ____this_rename_at_103 )
+{
+	memset(&(____this_rename_at_103), 0, 40);
+}
+
+inline Sequence DAS_COMMENT((Work const  &)) _Funcbuiltin_0x60_each_ref_31cbd29dd352bcfd ( Context * __context__, Lambda DAS_COMMENT((bool,Work const  * &)) const  __lam_rename_at_381 )
+{
+	Sequence DAS_COMMENT((Work *)) __it_rename_at_382; das_zero(__it_rename_at_382);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((Work const ))>::pass(__it_rename_at_382),__lam_rename_at_381,8,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((Work const  &))>::cast(__it_rename_at_382);
+}
+
+inline void finalize_bb0ef778d3414e1 ( Context * __context__, _lambda_thismodule_16_20_1 &  ____this_rename_at_16 )
+{
+	memset(&(____this_rename_at_16), 0, 56);
+}
+
+inline void finalize_2310198c3f5c050c ( Context * __context__, _lambda_thismodule_25_20_2 &  ____this_rename_at_25 )
+{
+	memset(&(____this_rename_at_25), 0, 32);
+}
+
+inline void finalize_c6cfad95212c91a3 ( Context * __context__, _lambda_thismodule_38_20_3 &  ____this_rename_at_38 )
+{
+	memset(&(____this_rename_at_38), 0, 32);
+}
+
+inline bool _Func_lambda_thismodule_103_12_4_0x60_function_18afc87e8ce28e4e ( Context * __context__, _lambda_thismodule_103_12_4 &  ____this_rename_at_103, Work const  * & ___ryield103_rename_at_103 )
+{
+	switch (____this_rename_at_103.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	label_2:;;
+	das_copy(____this_rename_at_103.__void_data_rename_at_104,channelPop(____this_rename_at_103.channel));
+	if ( ____this_rename_at_103.__void_data_rename_at_104 == nullptr )
+	{
+		return das_auto_cast<bool>::cast(false);
+	};
+	das_copy(___ryield103_rename_at_103,das_ref(__context__,das_deref(__context__,das_cast<Work const  *>::cast(____this_rename_at_103.__void_data_rename_at_104))));
+	das_copy(____this_rename_at_103.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	goto label_2;
+	label_3:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_103_12_4_0x60_finalizer_f6a1811136975a96 ( Context * __context__, _lambda_thismodule_103_12_4 * ____this_rename_at_103 )
+{
+	finalize_49cd92bb30524b7c(__context__,das_arg<_lambda_thismodule_103_12_4>::pass(das_deref(__context__,____this_rename_at_103)));
+	das_delete_lambda_struct<_lambda_thismodule_103_12_4 *>::clear(__context__,____this_rename_at_103);
+}
+
+inline TArray<int32_t> & _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd ( Context * __context__, TArray<int32_t> &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<TArray<int32_t> &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<TArray<int32_t> &>::cast(__a_rename_at_42);
+}
+
+inline void clone_f22a49f16d5e014d ( Context * __context__, _lambda_thismodule_16_20_1_new_job_clone &  __a_rename_at_16, _lambda_thismodule_16_20_1_new_job_clone const  &  __b_rename_at_16 )
+{
+	das_copy(__a_rename_at_16.__lambda,__b_rename_at_16.__lambda);
+	das_copy(__a_rename_at_16.__finalize,__b_rename_at_16.__finalize);
+	das_copy(__a_rename_at_16.status,__b_rename_at_16.status);
+	das_copy(__a_rename_at_16.x,__b_rename_at_16.x);
+	_Funcbuiltin_0x60_clone_4bc3594d348ca0bd(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_16.y),__b_rename_at_16.y);
+}
+
+inline void clone_c8c1a4dd7f2f9a41 ( Context * __context__, _lambda_thismodule_25_20_2_new_job_clone &  __a_rename_at_25, _lambda_thismodule_25_20_2_new_job_clone const  &  __b_rename_at_25 )
+{
+	das_copy(__a_rename_at_25.__lambda,__b_rename_at_25.__lambda);
+	das_copy(__a_rename_at_25.__finalize,__b_rename_at_25.__finalize);
+	das_copy(__a_rename_at_25.channel,__b_rename_at_25.channel);
+	das_copy(__a_rename_at_25.x,__b_rename_at_25.x);
+}
+
+inline void clone_8ddf918c99b89333 ( Context * __context__, _lambda_thismodule_38_20_3_new_job_clone &  __a_rename_at_38, _lambda_thismodule_38_20_3_new_job_clone const  &  __b_rename_at_38 )
+{
+	das_copy(__a_rename_at_38.__lambda,__b_rename_at_38.__lambda);
+	das_copy(__a_rename_at_38.__finalize,__b_rename_at_38.__finalize);
+	das_copy(__a_rename_at_38.channel,__b_rename_at_38.channel);
+	das_copy(__a_rename_at_38.x,__b_rename_at_38.x);
+}
+
+inline Sequence DAS_COMMENT((Work const  &)) _Func_0x60_template_0x60_0x9ae6ef0237d899a0_0x60_jobque_boost_0x60_each_69bfe90215e05b31 ( Context * __context__, Channel * const  __channel_rename_at_97 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((Work const  &))>::cast(_Funcbuiltin_0x60_each_ref_31cbd29dd352bcfd(__context__,das_ascend<bool,_lambda_thismodule_103_12_4>::make(__context__,&__type_info__b24c6b19126eda29,(([&]() -> _lambda_thismodule_103_12_4 {
+		_lambda_thismodule_103_12_4 __mks_102;
+		das_zero(__mks_102);
+		das_copy((__mks_102.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_103_12_4`function XS<::_lambda_thismodule_103_12_4> &1<C#XS<::Work>>?*/ 812555425766148146u))));
+		das_copy((__mks_102.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_103_12_4`finalizer X1<S<::_lambda_thismodule_103_12_4>>?*/ 12517919730343936846u))));
+		das_copy((__mks_102.channel),(__channel_rename_at_97));
+		return __mks_102;
+	})()))));
+}
+
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_75, int32_t __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_75),4,__context__),__context__),__value_rename_at_75);
+}
+
+inline void _Func_lambda_thismodule_16_20_1_0x60_function_7b45c2c568d06003 ( Context * __context__, _lambda_thismodule_16_20_1 &  ____this_rename_at_16 )
+{
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(____this_rename_at_16.y)) == 3));
+	{
+		uint64_t __loop_count_17 = UINT64_MAX;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,3));
+		int32_t __t_rename_at_17;
+		__loop_count_17 = das_loop_count(__loop_count_17,__t_iterator.loop_begin(__context__,(__t_rename_at_17)));
+		// c : int&
+		das_iterator<TArray<int32_t>> __c_iterator(____this_rename_at_16.y);
+		int32_t * __c_rename_at_17;
+		__loop_count_17 = das_loop_count(__loop_count_17,__c_iterator.loop_begin(__context__,(__c_rename_at_17)));
+		for ( ; __loop_count_17 ; --__loop_count_17, ++__t_rename_at_17, ++__c_rename_at_17 )
+		{
+			DAS_ASSERT(((__t_rename_at_17 + ____this_rename_at_16.x) == (*__c_rename_at_17)));
+		}
+		__t_iterator.loop_end(__context__,(__t_rename_at_17));
+		__c_iterator.loop_end(__context__,(__c_rename_at_17));
+	};
+	notifyJob(____this_rename_at_16.status);
+}
+
+inline void _Func_lambda_thismodule_16_20_1_0x60_finalizer_4fdddf92fd17908a ( Context * __context__, _lambda_thismodule_16_20_1 * ____this_rename_at_16 )
+{
+	finalize_bb0ef778d3414e1(__context__,das_arg<_lambda_thismodule_16_20_1>::pass(das_deref(__context__,____this_rename_at_16)));
+	das_delete_lambda_struct<_lambda_thismodule_16_20_1 *>::clear(__context__,____this_rename_at_16);
+}
+
+inline void _Funcjobque_boost_0x60_push_clone_da713af63af8d87f ( Context * __context__, Channel * const  __channel_rename_at_86, Work const  &  __data_rename_at_86 )
+{
+	Work * __heap_data_rename_at_88 = das_new<Work>::make(__context__);
+	das_copy(das_deref(__context__,__heap_data_rename_at_88),__data_rename_at_86);
+	channelPush(__channel_rename_at_86,das_auto_cast<void * const >::cast(__heap_data_rename_at_88),__context__);
+}
+
+inline void _Func_lambda_thismodule_25_20_2_0x60_function_3df419c413e23ad1 ( Context * __context__, _lambda_thismodule_25_20_2 &  ____this_rename_at_25 )
+{
+	{
+		uint64_t __loop_count_25 = UINT64_MAX;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,3));
+		int32_t __t_rename_at_25;
+		__loop_count_25 = das_loop_count(__loop_count_25,__t_iterator.loop_begin(__context__,(__t_rename_at_25)));
+		for ( ; __loop_count_25 ; --__loop_count_25, ++__t_rename_at_25 )
+		{
+			Work _temp_make_local_26_48;
+			_Funcjobque_boost_0x60_push_clone_da713af63af8d87f(__context__,____this_rename_at_25.channel,das_arg<Work>::pass((([&]() -> Work& {
+				das_copy((_temp_make_local_26_48.x),(____this_rename_at_25.x));
+				das_copy((_temp_make_local_26_48.t),(__t_rename_at_25));
+				return _temp_make_local_26_48;
+			})())));
+		}
+		__t_iterator.loop_end(__context__,(__t_rename_at_25));
+	};
+	notifyChannel(____this_rename_at_25.channel);
+}
+
+inline void _Func_lambda_thismodule_25_20_2_0x60_finalizer_99287f364d0fe9b4 ( Context * __context__, _lambda_thismodule_25_20_2 * ____this_rename_at_25 )
+{
+	finalize_2310198c3f5c050c(__context__,das_arg<_lambda_thismodule_25_20_2>::pass(das_deref(__context__,____this_rename_at_25)));
+	das_delete_lambda_struct<_lambda_thismodule_25_20_2 *>::clear(__context__,____this_rename_at_25);
+}
+
+inline void _Funcjobque_boost_0x60_for_each_5e3fb95ea02e92be ( Context * __context__, Channel * const  __channel_rename_at_74, Block DAS_COMMENT((void,Work const )) const  &  __blk_rename_at_74 )
+{
+	while ( true )
+	{
+		void * __void_data_rename_at_79 = ((void *)channelPop(__channel_rename_at_74));
+		if ( __void_data_rename_at_79 == nullptr )
+		{
+			break;
+		} else {
+			Work const  * __typed_data_rename_at_83 = ((Work const  *)das_cast<Work const  *>::cast(__void_data_rename_at_79));
+			das_invoke<void>::invoke<Work const  &>(__context__,nullptr,__blk_rename_at_74,das_deref(__context__,__typed_data_rename_at_83));
+		};
+	};
+}
+
+inline void _Func_lambda_thismodule_38_20_3_0x60_function_4ddfbc2141d8ac1c ( Context * __context__, _lambda_thismodule_38_20_3 &  ____this_rename_at_38 )
+{
+	{
+		uint64_t __loop_count_38 = UINT64_MAX;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,3));
+		int32_t __t_rename_at_38;
+		__loop_count_38 = das_loop_count(__loop_count_38,__t_iterator.loop_begin(__context__,(__t_rename_at_38)));
+		for ( ; __loop_count_38 ; --__loop_count_38, ++__t_rename_at_38 )
+		{
+			Work _temp_make_local_39_48;
+			_Funcjobque_boost_0x60_push_clone_da713af63af8d87f(__context__,____this_rename_at_38.channel,das_arg<Work>::pass((([&]() -> Work& {
+				das_copy((_temp_make_local_39_48.x),(____this_rename_at_38.x));
+				das_copy((_temp_make_local_39_48.t),(__t_rename_at_38));
+				return _temp_make_local_39_48;
+			})())));
+		}
+		__t_iterator.loop_end(__context__,(__t_rename_at_38));
+	};
+	notifyChannel(____this_rename_at_38.channel);
+}
+
+inline void _Func_lambda_thismodule_38_20_3_0x60_finalizer_4c08ba03df06924a ( Context * __context__, _lambda_thismodule_38_20_3 * ____this_rename_at_38 )
+{
+	finalize_c6cfad95212c91a3(__context__,das_arg<_lambda_thismodule_38_20_3>::pass(das_deref(__context__,____this_rename_at_38)));
+	das_delete_lambda_struct<_lambda_thismodule_38_20_3 *>::clear(__context__,____this_rename_at_38);
+}
+
+inline bool test_515d4eb849673ad7 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,640,"test " DAS_FILE_LINE);
+{
+	withJobQue(das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		withJobStatus(5,das_make_block<void,JobStatus *>(__context__,128,0,&__func_info__e3ccd7343d92b33,[&](JobStatus * __status_rename_at_12)->void{
+			{
+				uint64_t __loop_count_13 = UINT64_MAX;
+				// x : int const
+				das_iterator<range> __x_iterator(range(0,5));
+				int32_t __x_rename_at_13;
+				__loop_count_13 = das_loop_count(__loop_count_13,__x_iterator.loop_begin(__context__,(__x_rename_at_13)));
+				for ( ; __loop_count_13 ; --__loop_count_13, ++__x_rename_at_13 )
+				{
+					TArray<int32_t> __y_rename_at_14; das_zero(__y_rename_at_14); das_move(__y_rename_at_14, das_invoke<TArray<int32_t>>::invoke_cmres(__context__,nullptr,[&]()->TArray<int32_t>{
+						TArray<int32_t> ____acomp_14_rename_at_14; das_zero(____acomp_14_rename_at_14);
+						{
+							uint64_t __loop_count_14 = UINT64_MAX;
+							// t : int const
+							das_iterator<range> __t_iterator(range(0,3));
+							int32_t __t_rename_at_14;
+							__loop_count_14 = das_loop_count(__loop_count_14,__t_iterator.loop_begin(__context__,(__t_rename_at_14)));
+							for ( ; __loop_count_14 ; --__loop_count_14, ++__t_rename_at_14 )
+							{
+								_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(____acomp_14_rename_at_14),__t_rename_at_14 + __x_rename_at_13);
+							}
+							__t_iterator.loop_end(__context__,(__t_rename_at_14));
+						};
+						return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd(__context__,das_arg<TArray<int32_t>>::pass(____acomp_14_rename_at_14)));
+					}));
+					new_job_invoke(das_ascend<void,_lambda_thismodule_16_20_1>::make(__context__,&__type_info__87830cbb3176f4fe,(([&]() -> _lambda_thismodule_16_20_1 {
+						_lambda_thismodule_16_20_1 __mks_16;
+						das_copy((__mks_16.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_16_20_1`function XS<::_lambda_thismodule_16_20_1>*/ 1272212481320918938u))));
+						das_copy((__mks_16.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_16_20_1`finalizer X1<S<::_lambda_thismodule_16_20_1>>?*/ 3481368400536447312u))));
+						das_copy((__mks_16.status),(__status_rename_at_12));
+						das_copy((__mks_16.x),(__x_rename_at_13));
+						das_move((__mks_16.y),(__y_rename_at_14));
+						return __mks_16;
+					})())),Func(__context__->fnByMangledName(/*clone XS<::_lambda_thismodule_16_20_1_new_job_clone> CIS<::_lambda_thismodule_16_20_1_new_job_clone>*/ 5392471600106507002u)),56,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+				}
+				__x_iterator.loop_end(__context__,(__x_rename_at_13));
+			};
+			waitForJob(__status_rename_at_12);
+		}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+		withChannelEx(5,das_make_block<void,Channel *>(__context__,368,0,&__func_info__cfb81a8365a0ae64,[&](Channel * __channel_rename_at_22)->void{
+			{
+				uint64_t __loop_count_23 = UINT64_MAX;
+				// x : int const
+				das_iterator<range> __x_iterator(range(0,5));
+				int32_t __x_rename_at_23;
+				__loop_count_23 = das_loop_count(__loop_count_23,__x_iterator.loop_begin(__context__,(__x_rename_at_23)));
+				for ( ; __loop_count_23 ; --__loop_count_23, ++__x_rename_at_23 )
+				{
+					new_job_invoke(das_ascend<void,_lambda_thismodule_25_20_2>::make(__context__,&__type_info__baa4c4bc11614b7,(([&]() -> _lambda_thismodule_25_20_2 {
+						_lambda_thismodule_25_20_2 __mks_25;
+						das_copy((__mks_25.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_25_20_2`function XS<::_lambda_thismodule_25_20_2>*/ 16545670980346322864u))));
+						das_copy((__mks_25.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_25_20_2`finalizer X1<S<::_lambda_thismodule_25_20_2>>?*/ 11449628549393116428u))));
+						das_copy((__mks_25.channel),(__channel_rename_at_22));
+						das_copy((__mks_25.x),(__x_rename_at_23));
+						return __mks_25;
+					})())),Func(__context__->fnByMangledName(/*clone XS<::_lambda_thismodule_25_20_2_new_job_clone> CIS<::_lambda_thismodule_25_20_2_new_job_clone>*/ 9001411922300667902u)),32,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+				}
+				__x_iterator.loop_end(__context__,(__x_rename_at_23));
+			};
+			int32_t __summ_rename_at_28 = 0;
+			_Funcjobque_boost_0x60_for_each_5e3fb95ea02e92be(__context__,__channel_rename_at_22,das_make_block<void,Work const  &>(__context__,480,0,&__func_info__3ad0a31d00c9d958,[&](Work const  & __w_rename_at_29)->void{
+				__summ_rename_at_28 += (__w_rename_at_29.x * __w_rename_at_29.t);
+			}));
+			DAS_ASSERT((__summ_rename_at_28 == 30));
+			DAS_ASSERT((__channel_rename_at_22->isEmpty() /*isEmpty*/));
+			DAS_ASSERT((__channel_rename_at_22->isReady() /*isReady*/));
+		}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+		withChannelEx(5,das_make_block<void,Channel *>(__context__,544,0,&__func_info__cfb81a8365a0ae64,[&](Channel * __channel_rename_at_35)->void{
+			Sequence DAS_COMMENT((Work *)) _temp_make_local_42_608;
+			{
+				uint64_t __loop_count_36 = UINT64_MAX;
+				// x : int const
+				das_iterator<range> __x_iterator(range(0,5));
+				int32_t __x_rename_at_36;
+				__loop_count_36 = das_loop_count(__loop_count_36,__x_iterator.loop_begin(__context__,(__x_rename_at_36)));
+				for ( ; __loop_count_36 ; --__loop_count_36, ++__x_rename_at_36 )
+				{
+					new_job_invoke(das_ascend<void,_lambda_thismodule_38_20_3>::make(__context__,&__type_info__de07e88d204ba4b0,(([&]() -> _lambda_thismodule_38_20_3 {
+						_lambda_thismodule_38_20_3 __mks_38;
+						das_copy((__mks_38.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_38_20_3`function XS<::_lambda_thismodule_38_20_3>*/ 4864509860894236834u))));
+						das_copy((__mks_38.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_38_20_3`finalizer X1<S<::_lambda_thismodule_38_20_3>>?*/ 16509389861020951620u))));
+						das_copy((__mks_38.channel),(__channel_rename_at_35));
+						das_copy((__mks_38.x),(__x_rename_at_36));
+						return __mks_38;
+					})())),Func(__context__->fnByMangledName(/*clone XS<::_lambda_thismodule_38_20_3_new_job_clone> CIS<::_lambda_thismodule_38_20_3_new_job_clone>*/ 7841980842205359938u)),32,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+				}
+				__x_iterator.loop_end(__context__,(__x_rename_at_36));
+			};
+			int32_t __summ_rename_at_41 = 0;
+			{
+				bool __need_loop_42 = true;
+				// w : Work const&#
+				das_iterator<Sequence DAS_COMMENT((Work const ))> __w_iterator((_temp_make_local_42_608 = (_Func_0x60_template_0x60_0x9ae6ef0237d899a0_0x60_jobque_boost_0x60_each_69bfe90215e05b31(__context__,__channel_rename_at_35))));
+				Work const  * __w_rename_at_42;
+				__need_loop_42 = __w_iterator.first(__context__,(__w_rename_at_42)) && __need_loop_42;
+				for ( ; __need_loop_42 ; __need_loop_42 = __w_iterator.next(__context__,(__w_rename_at_42)) )
+				{
+					__summ_rename_at_41 += ((*__w_rename_at_42).x * (*__w_rename_at_42).t);
+				}
+				__w_iterator.close(__context__,(__w_rename_at_42));
+			};
+			DAS_ASSERT((__summ_rename_at_41 == 30));
+			DAS_ASSERT((__channel_rename_at_35->isEmpty() /*isEmpty*/));
+			DAS_ASSERT((__channel_rename_at_35->isReady() /*isReady*/));
+		}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	return das_auto_cast<bool>::cast(true);
+}}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_resize_ce974596f011d69b
+	aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+	// _Funcbuiltin_0x60_clone_4bc3594d348ca0bd
+	aotLib[0x1366ab6fb285c311] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_clone_4bc3594d348ca0bd>>();
+	};
+	// finalize_49cd92bb30524b7c
+	aotLib[0x8c57a6fe68e80cd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_103_12_4 &  ),&finalize_49cd92bb30524b7c>>();
+	};
+	// _Funcbuiltin_0x60_each_ref_31cbd29dd352bcfd
+	aotLib[0x68bf5f48a2512d5d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((Work const  &)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,Work const  * &)) const   ),&_Funcbuiltin_0x60_each_ref_31cbd29dd352bcfd>>();
+	};
+	// finalize_bb0ef778d3414e1
+	aotLib[0xc57bf28147f3f161] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_16_20_1 &  ),&finalize_bb0ef778d3414e1>>();
+	};
+	// finalize_2310198c3f5c050c
+	aotLib[0xae6ee47cd45ef105] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_25_20_2 &  ),&finalize_2310198c3f5c050c>>();
+	};
+	// finalize_c6cfad95212c91a3
+	aotLib[0xc9cc0a3f86f87b15] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_38_20_3 &  ),&finalize_c6cfad95212c91a3>>();
+	};
+	// _Func_lambda_thismodule_103_12_4_0x60_function_18afc87e8ce28e4e
+	aotLib[0x8d6802db73e86039] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_103_12_4 & , Work const  * &  ),&_Func_lambda_thismodule_103_12_4_0x60_function_18afc87e8ce28e4e>>();
+	};
+	// _Func_lambda_thismodule_103_12_4_0x60_finalizer_f6a1811136975a96
+	aotLib[0xe4219f7d620ace21] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_103_12_4 *  ),&_Func_lambda_thismodule_103_12_4_0x60_finalizer_f6a1811136975a96>>();
+	};
+	// _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd
+	aotLib[0x66e322246598e835] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TArray<int32_t> & (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd>>();
+	};
+	// clone_f22a49f16d5e014d
+	aotLib[0x34aad1a44bbd428c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_16_20_1_new_job_clone & , _lambda_thismodule_16_20_1_new_job_clone const  &  ),&clone_f22a49f16d5e014d>>();
+	};
+	// clone_c8c1a4dd7f2f9a41
+	aotLib[0xbbedbf5bbcb5a441] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_25_20_2_new_job_clone & , _lambda_thismodule_25_20_2_new_job_clone const  &  ),&clone_c8c1a4dd7f2f9a41>>();
+	};
+	// clone_8ddf918c99b89333
+	aotLib[0xae9104c6f6656dad] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_38_20_3_new_job_clone & , _lambda_thismodule_38_20_3_new_job_clone const  &  ),&clone_8ddf918c99b89333>>();
+	};
+	// _Func_0x60_template_0x60_0x9ae6ef0237d899a0_0x60_jobque_boost_0x60_each_69bfe90215e05b31
+	aotLib[0x305eecb0edee14fb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((Work const  &)) (*) ( Context * __context__, Channel * const   ),&_Func_0x60_template_0x60_0x9ae6ef0237d899a0_0x60_jobque_boost_0x60_each_69bfe90215e05b31>>();
+	};
+	// _Funcbuiltin_0x60_push_d21751720b4df10e
+	aotLib[0x9fb5b63c22625999] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_d21751720b4df10e>>();
+	};
+	// _Func_lambda_thismodule_16_20_1_0x60_function_7b45c2c568d06003
+	aotLib[0x1144da5186743955] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_16_20_1 &  ),&_Func_lambda_thismodule_16_20_1_0x60_function_7b45c2c568d06003>>();
+	};
+	// _Func_lambda_thismodule_16_20_1_0x60_finalizer_4fdddf92fd17908a
+	aotLib[0xee784b14d64ebd84] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_16_20_1 *  ),&_Func_lambda_thismodule_16_20_1_0x60_finalizer_4fdddf92fd17908a>>();
+	};
+	// _Funcjobque_boost_0x60_push_clone_da713af63af8d87f
+	aotLib[0x1c5a48d6b742de85] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Channel * const  , Work const  &  ),&_Funcjobque_boost_0x60_push_clone_da713af63af8d87f>>();
+	};
+	// _Func_lambda_thismodule_25_20_2_0x60_function_3df419c413e23ad1
+	aotLib[0x27f0a7918444cfa7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_25_20_2 &  ),&_Func_lambda_thismodule_25_20_2_0x60_function_3df419c413e23ad1>>();
+	};
+	// _Func_lambda_thismodule_25_20_2_0x60_finalizer_99287f364d0fe9b4
+	aotLib[0x56c12748c43f8615] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_25_20_2 *  ),&_Func_lambda_thismodule_25_20_2_0x60_finalizer_99287f364d0fe9b4>>();
+	};
+	// _Funcjobque_boost_0x60_for_each_5e3fb95ea02e92be
+	aotLib[0xcc9f96400c6c83e9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Channel * const  , Block DAS_COMMENT((void,Work const )) const  &  ),&_Funcjobque_boost_0x60_for_each_5e3fb95ea02e92be>>();
+	};
+	// _Func_lambda_thismodule_38_20_3_0x60_function_4ddfbc2141d8ac1c
+	aotLib[0xfd5e1265ac82860f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_38_20_3 &  ),&_Func_lambda_thismodule_38_20_3_0x60_function_4ddfbc2141d8ac1c>>();
+	};
+	// _Func_lambda_thismodule_38_20_3_0x60_finalizer_4c08ba03df06924a
+	aotLib[0x7ffd66bd89ee40a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_38_20_3 *  ),&_Func_lambda_thismodule_38_20_3_0x60_finalizer_4c08ba03df06924a>>();
+	};
+	// test_515d4eb849673ad7
+	aotLib[0xee10b4e7e0487ab9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_515d4eb849673ad7>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,126 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_4654127378926713897 {
+
+
+
+
+inline das::Time testClockArg_3d75f024c26ca503 ( Context * __context__, das::Time const  __c_rename_at_1 );
+inline bool test_6fc92d52da90edd8 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline das::Time testClockArg_3d75f024c26ca503 ( Context * __context__, das::Time const  __c_rename_at_1 )
+{
+	das::Time __d_rename_at_2 = ((das::Time)__c_rename_at_1);
+	return das_auto_cast<das::Time>::cast(__d_rename_at_2);
+}
+
+inline bool test_6fc92d52da90edd8 ( Context * __context__ )
+{
+	das::Time __a1_rename_at_7; das_zero(__a1_rename_at_7); das::Time __a2_rename_at_7; das_zero(__a2_rename_at_7);
+	double __dt_rename_at_8 = 0;
+	das_copy(__a1_rename_at_7,/*c-tor*/ builtin_clock(/*end-c-tor*/));
+	{
+		uint64_t __loop_count_10 = UINT64_MAX;
+		// z : int const
+		das_iterator<range> __z_iterator(range(0,3));
+		int32_t __z_rename_at_10;
+		__loop_count_10 = das_loop_count(__loop_count_10,__z_iterator.loop_begin(__context__,(__z_rename_at_10)));
+		for ( ; __loop_count_10 ; --__loop_count_10, ++__z_rename_at_10 )
+		{
+			TDim<int32_t,3> __a_rename_at_11; das_zero(__a_rename_at_11); TDim<int32_t,3> __b_rename_at_11; das_zero(__b_rename_at_11);
+			{
+				uint64_t __loop_count_12 = UINT64_MAX;
+				// x : int& -const
+				das_iterator<TDim<int32_t,3>> __x_iterator(__a_rename_at_11);
+				int32_t * __restrict __x_rename_at_12;
+				__loop_count_12 = das_loop_count(__loop_count_12,__x_iterator.loop_begin(__context__,(__x_rename_at_12)));
+				// y : int& -const
+				das_iterator<TDim<int32_t,3>> __y_iterator(__b_rename_at_11);
+				int32_t * __restrict __y_rename_at_12;
+				__loop_count_12 = das_loop_count(__loop_count_12,__y_iterator.loop_begin(__context__,(__y_rename_at_12)));
+				for ( ; __loop_count_12 ; --__loop_count_12, ++__x_rename_at_12, ++__y_rename_at_12 )
+				{
+					(*__x_rename_at_12) += (*__y_rename_at_12);
+				}
+				__x_iterator.loop_end(__context__,(__x_rename_at_12));
+				__y_iterator.loop_end(__context__,(__y_rename_at_12));
+			};
+		}
+		__z_iterator.loop_end(__context__,(__z_rename_at_10));
+	};
+	das_copy(__a2_rename_at_7,/*c-tor*/ builtin_clock(/*end-c-tor*/));
+	DAS_ASSERT((SimPolicy<das::Time>::LessEqu(cast<das::Time>::from(__a1_rename_at_7),cast<das::Time>::from(__a2_rename_at_7),*__context__,nullptr)));
+	das::Time __a3_rename_at_16 = ((das::Time)testClockArg_3d75f024c26ca503(__context__,__a2_rename_at_7));
+	DAS_ASSERT((SimPolicy<das::Time>::Equ(cast<das::Time>::from(__a2_rename_at_7),cast<das::Time>::from(__a3_rename_at_16),*__context__,nullptr)));
+	das_copy(__dt_rename_at_8,SimPolicy<das::Time>::Sub(cast<das::Time>::from(__a2_rename_at_7),cast<das::Time>::from(__a1_rename_at_7),*__context__,nullptr));
+	DAS_ASSERT((__dt_rename_at_8 <= 1.));
+	return das_auto_cast<bool>::cast(true);
+}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// testClockArg_3d75f024c26ca503
+	aotLib[0xae353834c31d9a25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<das::Time (*) ( Context * __context__, das::Time const   ),&testClockArg_3d75f024c26ca503>>();
+	};
+	// test_6fc92d52da90edd8
+	aotLib[0xb2b3111cbe30c5d1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_6fc92d52da90edd8>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,164 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_13990516641728852953 {
+
+extern TypeInfo __type_info__af63eb4c86020609;
+extern VarInfo __var_info__53583eef824e4fec;
+extern VarInfo __var_info__348e72f001ddaf8c;
+extern VarInfo __var_info__7ea730ef9ad58274;
+extern FuncInfo __func_info__8be911f9ec86f51b;
+
+VarInfo __func_info__8be911f9ec86f51b_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0x53583eef824e4fecul, "b_var_i", 0 };
+VarInfo __func_info__8be911f9ec86f51b_field_1 =  { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, 0x7ea730ef9ad58274ul, "b_var_f", 0 };
+VarInfo __func_info__8be911f9ec86f51b_field_2 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, 0x348e72f001ddaf8cul, "b_var_s", 0 };
+VarInfo * __func_info__8be911f9ec86f51b_fields[3] =  { &__func_info__8be911f9ec86f51b_field_0, &__func_info__8be911f9ec86f51b_field_1, &__func_info__8be911f9ec86f51b_field_2 };
+FuncInfo __func_info__8be911f9ec86f51b = {"invoke block<(b_var_i:int -const;b_var_f:float -const;b_var_s:string -const):void> const", "", __func_info__8be911f9ec86f51b_fields, 3, 32, &__type_info__af63eb4c86020609, nullptr,0,0x8be911f9ec86f51bul, 0x0 };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, 0xaf63eb4c86020609ul };
+
+
+inline void test_global_var_88385695269ffacc ( Context * __context__ );
+inline void test_arg_4fa1808947ed1e54 ( Context * __context__, int32_t __a_var_i_rename_at_33, float __a_var_f_rename_at_33, char * __a_var_s_rename_at_33 );
+inline void test_block_invoke_9b86154d4493e403 ( Context * __context__, Block DAS_COMMENT((void,int32_t,float,char *)) const  & __b_rename_at_44 );
+inline void test_block_var_2e6ace1de29b989e ( Context * __context__ );
+inline bool test_679a89eb3394da20 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int32_t,0x88cc09dde5998d17>(__context__) = 1;/*g_var_i*/
+	das_global<float,0xc6481fde08aaaedf>(__context__) = 3.1400001f;/*g_var_f*/
+	das_global<char *,0x6adc4dde65e2aba7>(__context__) = ((char *) "blah");/*g_var_s*/
+}
+
+inline void test_global_var_88385695269ffacc ( Context * __context__ )
+{
+	DAS_ASSERT((das_global<int32_t,0x88cc09dde5998d17>(__context__) /*g_var_i*/ == 1));
+	das_copy(das_global<int32_t,0x88cc09dde5998d17>(__context__) /*g_var_i*/,das_global<int32_t,0x88cc09dde5998d17>(__context__) /*g_var_i*/ + 1);
+	DAS_ASSERT((das_global<int32_t,0x88cc09dde5998d17>(__context__) /*g_var_i*/ == 2));
+	DAS_ASSERT((das_global<float,0xc6481fde08aaaedf>(__context__) /*g_var_f*/ == 3.1400001f));
+	das_copy(das_global<float,0xc6481fde08aaaedf>(__context__) /*g_var_f*/,das_global<float,0xc6481fde08aaaedf>(__context__) /*g_var_f*/ * 2.f);
+	DAS_ASSERT((das_global<float,0xc6481fde08aaaedf>(__context__) /*g_var_f*/ == 6.28000021f));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_global<char *,0x6adc4dde65e2aba7>(__context__) /*g_var_s*/),cast<char *>::from(((char *) "blah")),*__context__,nullptr)));
+	SimPolicy<char *>::SetAdd((char *)&(das_global<char *,0x6adc4dde65e2aba7>(__context__) /*g_var_s*/),cast<char *>::from(((char *) "_blah")),*__context__,nullptr);
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_global<char *,0x6adc4dde65e2aba7>(__context__) /*g_var_s*/),cast<char *>::from(((char *) "blah_blah")),*__context__,nullptr)));
+}
+
+inline void test_arg_4fa1808947ed1e54 ( Context * __context__, int32_t __a_var_i_rename_at_33, float __a_var_f_rename_at_33, char * __a_var_s_rename_at_33 )
+{
+	DAS_ASSERT((__a_var_i_rename_at_33 == 1));
+	das_copy(__a_var_i_rename_at_33,__a_var_i_rename_at_33 + 1);
+	DAS_ASSERT((__a_var_i_rename_at_33 == 2));
+	DAS_ASSERT((__a_var_f_rename_at_33 == 3.1400001f));
+	das_copy(__a_var_f_rename_at_33,__a_var_f_rename_at_33 * 2.f);
+	DAS_ASSERT((__a_var_f_rename_at_33 == 6.28000021f));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_var_s_rename_at_33),cast<char *>::from(((char *) "blah")),*__context__,nullptr)));
+	SimPolicy<char *>::SetAdd((char *)&(__a_var_s_rename_at_33),cast<char *>::from(((char *) "_blah")),*__context__,nullptr);
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_var_s_rename_at_33),cast<char *>::from(((char *) "blah_blah")),*__context__,nullptr)));
+}
+
+inline void test_block_invoke_9b86154d4493e403 ( Context * __context__, Block DAS_COMMENT((void,int32_t,float,char *)) const  &  __b_rename_at_44 )
+{
+	das_invoke<void>::invoke<int32_t,float,char * const >(__context__,nullptr,__b_rename_at_44,1,3.1400001f,((char *) "blah"));
+}
+
+inline void test_block_var_2e6ace1de29b989e ( Context * __context__ ) { das_stack_prologue __prologue(__context__,96,"test_block_var " DAS_FILE_LINE);
+{
+	test_block_invoke_9b86154d4493e403(__context__,das_make_block<void,int32_t,float,char *>(__context__,80,0,&__func_info__8be911f9ec86f51b,[&](int32_t __b_var_i_rename_at_48, float __b_var_f_rename_at_48, char * __b_var_s_rename_at_48)->void{
+		DAS_ASSERT((__b_var_i_rename_at_48 == 1));
+		das_copy(__b_var_i_rename_at_48,__b_var_i_rename_at_48 + 1);
+		DAS_ASSERT((__b_var_i_rename_at_48 == 2));
+		DAS_ASSERT((__b_var_f_rename_at_48 == 3.1400001f));
+		das_copy(__b_var_f_rename_at_48,__b_var_f_rename_at_48 * 2.f);
+		DAS_ASSERT((__b_var_f_rename_at_48 == 6.28000021f));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__b_var_s_rename_at_48),cast<char *>::from(((char *) "blah")),*__context__,nullptr)));
+		SimPolicy<char *>::SetAdd((char *)&(__b_var_s_rename_at_48),cast<char *>::from(((char *) "_blah")),*__context__,nullptr);
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__b_var_s_rename_at_48),cast<char *>::from(((char *) "blah_blah")),*__context__,nullptr)));
+	}));
+}}
+
+inline bool test_679a89eb3394da20 ( Context * __context__ )
+{
+	test_global_var_88385695269ffacc(__context__);
+	test_arg_4fa1808947ed1e54(__context__,1,3.1400001f,((char *) "blah"));
+	test_block_var_2e6ace1de29b989e(__context__);
+	return das_auto_cast<bool>::cast(true);
+}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// test_global_var_88385695269ffacc
+	aotLib[0x13bfa046f87f0065] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_global_var_88385695269ffacc>>();
+	};
+	// test_arg_4fa1808947ed1e54
+	aotLib[0xcecc279cbb1dfeb9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , float , char *  ),&test_arg_4fa1808947ed1e54>>();
+	};
+	// test_block_invoke_9b86154d4493e403
+	aotLib[0xd9f935976910c8f1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Block DAS_COMMENT((void,int32_t,float,char *)) const  &  ),&test_block_invoke_9b86154d4493e403>>();
+	};
+	// test_block_var_2e6ace1de29b989e
+	aotLib[0xceea68e44a09ece4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_block_var_2e6ace1de29b989e>>();
+	};
+	// test_679a89eb3394da20
+	aotLib[0x392ee36f0fbcda97] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_679a89eb3394da20>>();
+	};
+	// [[ init script ]]
+	aotLib[0x208224862fa22d4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,11 @@
+// unity build batch 13
+#include "shared.das.cpp"
+#include "smart_ptr.das.cpp"
+#include "sort.das.cpp"
+#include "sorted_array_test.das.cpp"
+#include "split.das.cpp"
+#include "split_by_chars.das.cpp"
+#include "stackwalk.das.cpp"
+#include "static_if.das.cpp"
+#include "stdvec_r2v.das.cpp"
+#include "storage_types.das.cpp"
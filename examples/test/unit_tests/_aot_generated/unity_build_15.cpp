@@ -0,0 +1,11 @@
+// unity build batch 15
+#include "test_move_on_return.das.cpp"
+#include "test_template.das.cpp"
+#include "time.das.cpp"
+#include "toarray.das.cpp"
+#include "totable.das.cpp"
+#include "try-catch.das.cpp"
+#include "tuple.das.cpp"
+#include "typeAlias.das.cpp"
+#include "typeinfo.das.cpp"
+#include "typename.das.cpp"
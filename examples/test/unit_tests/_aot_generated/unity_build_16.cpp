@@ -0,0 +1,8 @@
+// unity build batch 16
+#include "types.das.cpp"
+#include "unused_arguments.das.cpp"
+#include "variant.das.cpp"
+#include "vec_ctors.das.cpp"
+#include "vec_index.das.cpp"
+#include "vec_swizzle.das.cpp"
+#include "with.das.cpp"
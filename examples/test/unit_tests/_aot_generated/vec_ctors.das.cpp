@@ -0,0 +1,588 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_10081785718223038802 {
+
+extern TypeInfo __type_info__bef6b19aaa058ea;
+extern TypeInfo __type_info__c075419aab4c3b6;
+extern TypeInfo __type_info__bc35c19aa7b0482;
+extern TypeInfo __type_info__90f3c07b5a6c860;
+extern TypeInfo __type_info__bc35d19aa7b0635;
+extern TypeInfo __type_info__bef6519aaa04eb8;
+extern TypeInfo __type_info__c075519aab4c569;
+extern TypeInfo __type_info__bef6c19aaa05a9d;
+extern TypeInfo __type_info__90f4407b5a6d5f8;
+extern TypeInfo __type_info__c075719aab4c8cf;
+extern TypeInfo __type_info__bc35719aa7afc03;
+
+TypeInfo __type_info__bef6b19aaa058ea = { Type::tFloat2, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 8, 0xbef6b19aaa058eaul };
+TypeInfo __type_info__c075419aab4c3b6 = { Type::tInt3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 12, 0xc075419aab4c3b6ul };
+TypeInfo __type_info__bc35c19aa7b0482 = { Type::tUInt3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 12, 0xbc35c19aa7b0482ul };
+TypeInfo __type_info__90f3c07b5a6c860 = { Type::tRange, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 8, 0x90f3c07b5a6c860ul };
+TypeInfo __type_info__bc35d19aa7b0635 = { Type::tUInt2, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 8, 0xbc35d19aa7b0635ul };
+TypeInfo __type_info__bef6519aaa04eb8 = { Type::tFloat4, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 16, 0xbef6519aaa04eb8ul };
+TypeInfo __type_info__c075519aab4c569 = { Type::tInt2, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 8, 0xc075519aab4c569ul };
+TypeInfo __type_info__bef6c19aaa05a9d = { Type::tFloat3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 12, 0xbef6c19aaa05a9dul };
+TypeInfo __type_info__90f4407b5a6d5f8 = { Type::tURange, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 8, 0x90f4407b5a6d5f8ul };
+TypeInfo __type_info__c075719aab4c8cf = { Type::tInt4, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 16, 0xc075719aab4c8cful };
+TypeInfo __type_info__bc35719aa7afc03 = { Type::tUInt4, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 16, 0xbc35719aa7afc03ul };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__bef6b19aaa058ea };
+TypeInfo * __tinfo_1[1] = { &__type_info__bef6b19aaa058ea };
+TypeInfo * __tinfo_2[1] = { &__type_info__bef6b19aaa058ea };
+TypeInfo * __tinfo_3[1] = { &__type_info__bef6b19aaa058ea };
+TypeInfo * __tinfo_4[1] = { &__type_info__bef6b19aaa058ea };
+TypeInfo * __tinfo_5[1] = { &__type_info__bef6b19aaa058ea };
+TypeInfo * __tinfo_6[1] = { &__type_info__bef6b19aaa058ea };
+TypeInfo * __tinfo_7[1] = { &__type_info__bef6b19aaa058ea };
+TypeInfo * __tinfo_8[1] = { &__type_info__bef6b19aaa058ea };
+TypeInfo * __tinfo_9[1] = { &__type_info__bef6b19aaa058ea };
+TypeInfo * __tinfo_10[1] = { &__type_info__bef6b19aaa058ea };
+TypeInfo * __tinfo_11[1] = { &__type_info__bef6b19aaa058ea };
+TypeInfo * __tinfo_12[1] = { &__type_info__bef6b19aaa058ea };
+TypeInfo * __tinfo_13[1] = { &__type_info__bef6c19aaa05a9d };
+TypeInfo * __tinfo_14[1] = { &__type_info__bef6c19aaa05a9d };
+TypeInfo * __tinfo_15[1] = { &__type_info__bef6c19aaa05a9d };
+TypeInfo * __tinfo_16[1] = { &__type_info__bef6c19aaa05a9d };
+TypeInfo * __tinfo_17[1] = { &__type_info__bef6c19aaa05a9d };
+TypeInfo * __tinfo_18[1] = { &__type_info__bef6c19aaa05a9d };
+TypeInfo * __tinfo_19[1] = { &__type_info__bef6c19aaa05a9d };
+TypeInfo * __tinfo_20[1] = { &__type_info__bef6c19aaa05a9d };
+TypeInfo * __tinfo_21[1] = { &__type_info__bef6c19aaa05a9d };
+TypeInfo * __tinfo_22[1] = { &__type_info__bef6519aaa04eb8 };
+TypeInfo * __tinfo_23[1] = { &__type_info__bef6519aaa04eb8 };
+TypeInfo * __tinfo_24[1] = { &__type_info__bef6519aaa04eb8 };
+TypeInfo * __tinfo_25[1] = { &__type_info__bef6519aaa04eb8 };
+TypeInfo * __tinfo_26[1] = { &__type_info__bef6519aaa04eb8 };
+TypeInfo * __tinfo_27[1] = { &__type_info__bef6519aaa04eb8 };
+TypeInfo * __tinfo_28[1] = { &__type_info__bef6519aaa04eb8 };
+TypeInfo * __tinfo_29[1] = { &__type_info__bef6519aaa04eb8 };
+TypeInfo * __tinfo_30[1] = { &__type_info__bef6519aaa04eb8 };
+TypeInfo * __tinfo_31[1] = { &__type_info__c075519aab4c569 };
+TypeInfo * __tinfo_32[1] = { &__type_info__c075519aab4c569 };
+TypeInfo * __tinfo_33[1] = { &__type_info__c075519aab4c569 };
+TypeInfo * __tinfo_34[1] = { &__type_info__c075519aab4c569 };
+TypeInfo * __tinfo_35[1] = { &__type_info__c075519aab4c569 };
+TypeInfo * __tinfo_36[1] = { &__type_info__c075519aab4c569 };
+TypeInfo * __tinfo_37[1] = { &__type_info__c075519aab4c569 };
+TypeInfo * __tinfo_38[1] = { &__type_info__c075519aab4c569 };
+TypeInfo * __tinfo_39[1] = { &__type_info__c075519aab4c569 };
+TypeInfo * __tinfo_40[1] = { &__type_info__c075519aab4c569 };
+TypeInfo * __tinfo_41[1] = { &__type_info__c075519aab4c569 };
+TypeInfo * __tinfo_42[1] = { &__type_info__c075519aab4c569 };
+TypeInfo * __tinfo_43[1] = { &__type_info__c075519aab4c569 };
+TypeInfo * __tinfo_44[1] = { &__type_info__c075419aab4c3b6 };
+TypeInfo * __tinfo_45[1] = { &__type_info__c075419aab4c3b6 };
+TypeInfo * __tinfo_46[1] = { &__type_info__c075419aab4c3b6 };
+TypeInfo * __tinfo_47[1] = { &__type_info__c075419aab4c3b6 };
+TypeInfo * __tinfo_48[1] = { &__type_info__c075419aab4c3b6 };
+TypeInfo * __tinfo_49[1] = { &__type_info__c075419aab4c3b6 };
+TypeInfo * __tinfo_50[1] = { &__type_info__c075419aab4c3b6 };
+TypeInfo * __tinfo_51[1] = { &__type_info__c075419aab4c3b6 };
+TypeInfo * __tinfo_52[1] = { &__type_info__c075419aab4c3b6 };
+TypeInfo * __tinfo_53[1] = { &__type_info__c075719aab4c8cf };
+TypeInfo * __tinfo_54[1] = { &__type_info__c075719aab4c8cf };
+TypeInfo * __tinfo_55[1] = { &__type_info__c075719aab4c8cf };
+TypeInfo * __tinfo_56[1] = { &__type_info__c075719aab4c8cf };
+TypeInfo * __tinfo_57[1] = { &__type_info__c075719aab4c8cf };
+TypeInfo * __tinfo_58[1] = { &__type_info__c075719aab4c8cf };
+TypeInfo * __tinfo_59[1] = { &__type_info__c075719aab4c8cf };
+TypeInfo * __tinfo_60[1] = { &__type_info__c075719aab4c8cf };
+TypeInfo * __tinfo_61[1] = { &__type_info__c075719aab4c8cf };
+TypeInfo * __tinfo_62[1] = { &__type_info__bc35d19aa7b0635 };
+TypeInfo * __tinfo_63[1] = { &__type_info__bc35d19aa7b0635 };
+TypeInfo * __tinfo_64[1] = { &__type_info__bc35d19aa7b0635 };
+TypeInfo * __tinfo_65[1] = { &__type_info__bc35d19aa7b0635 };
+TypeInfo * __tinfo_66[1] = { &__type_info__bc35d19aa7b0635 };
+TypeInfo * __tinfo_67[1] = { &__type_info__bc35d19aa7b0635 };
+TypeInfo * __tinfo_68[1] = { &__type_info__bc35d19aa7b0635 };
+TypeInfo * __tinfo_69[1] = { &__type_info__bc35d19aa7b0635 };
+TypeInfo * __tinfo_70[1] = { &__type_info__bc35d19aa7b0635 };
+TypeInfo * __tinfo_71[1] = { &__type_info__bc35d19aa7b0635 };
+TypeInfo * __tinfo_72[1] = { &__type_info__bc35d19aa7b0635 };
+TypeInfo * __tinfo_73[1] = { &__type_info__bc35d19aa7b0635 };
+TypeInfo * __tinfo_74[1] = { &__type_info__bc35d19aa7b0635 };
+TypeInfo * __tinfo_75[1] = { &__type_info__bc35c19aa7b0482 };
+TypeInfo * __tinfo_76[1] = { &__type_info__bc35c19aa7b0482 };
+TypeInfo * __tinfo_77[1] = { &__type_info__bc35c19aa7b0482 };
+TypeInfo * __tinfo_78[1] = { &__type_info__bc35c19aa7b0482 };
+TypeInfo * __tinfo_79[1] = { &__type_info__bc35c19aa7b0482 };
+TypeInfo * __tinfo_80[1] = { &__type_info__bc35c19aa7b0482 };
+TypeInfo * __tinfo_81[1] = { &__type_info__bc35c19aa7b0482 };
+TypeInfo * __tinfo_82[1] = { &__type_info__bc35c19aa7b0482 };
+TypeInfo * __tinfo_83[1] = { &__type_info__bc35c19aa7b0482 };
+TypeInfo * __tinfo_84[1] = { &__type_info__bc35719aa7afc03 };
+TypeInfo * __tinfo_85[1] = { &__type_info__bc35719aa7afc03 };
+TypeInfo * __tinfo_86[1] = { &__type_info__bc35719aa7afc03 };
+TypeInfo * __tinfo_87[1] = { &__type_info__bc35719aa7afc03 };
+TypeInfo * __tinfo_88[1] = { &__type_info__bc35719aa7afc03 };
+TypeInfo * __tinfo_89[1] = { &__type_info__bc35719aa7afc03 };
+TypeInfo * __tinfo_90[1] = { &__type_info__bc35719aa7afc03 };
+TypeInfo * __tinfo_91[1] = { &__type_info__bc35719aa7afc03 };
+TypeInfo * __tinfo_92[1] = { &__type_info__bc35719aa7afc03 };
+TypeInfo * __tinfo_93[1] = { &__type_info__90f3c07b5a6c860 };
+TypeInfo * __tinfo_94[1] = { &__type_info__90f3c07b5a6c860 };
+TypeInfo * __tinfo_95[1] = { &__type_info__90f3c07b5a6c860 };
+TypeInfo * __tinfo_96[1] = { &__type_info__90f3c07b5a6c860 };
+TypeInfo * __tinfo_97[1] = { &__type_info__90f3c07b5a6c860 };
+TypeInfo * __tinfo_98[1] = { &__type_info__90f3c07b5a6c860 };
+TypeInfo * __tinfo_99[1] = { &__type_info__90f3c07b5a6c860 };
+TypeInfo * __tinfo_100[1] = { &__type_info__90f3c07b5a6c860 };
+TypeInfo * __tinfo_101[1] = { &__type_info__90f3c07b5a6c860 };
+TypeInfo * __tinfo_102[1] = { &__type_info__90f3c07b5a6c860 };
+TypeInfo * __tinfo_103[1] = { &__type_info__90f3c07b5a6c860 };
+TypeInfo * __tinfo_104[1] = { &__type_info__90f3c07b5a6c860 };
+TypeInfo * __tinfo_105[1] = { &__type_info__90f3c07b5a6c860 };
+TypeInfo * __tinfo_106[1] = { &__type_info__90f4407b5a6d5f8 };
+TypeInfo * __tinfo_107[1] = { &__type_info__90f4407b5a6d5f8 };
+TypeInfo * __tinfo_108[1] = { &__type_info__90f4407b5a6d5f8 };
+TypeInfo * __tinfo_109[1] = { &__type_info__90f4407b5a6d5f8 };
+TypeInfo * __tinfo_110[1] = { &__type_info__90f4407b5a6d5f8 };
+TypeInfo * __tinfo_111[1] = { &__type_info__90f4407b5a6d5f8 };
+TypeInfo * __tinfo_112[1] = { &__type_info__90f4407b5a6d5f8 };
+TypeInfo * __tinfo_113[1] = { &__type_info__90f4407b5a6d5f8 };
+TypeInfo * __tinfo_114[1] = { &__type_info__90f4407b5a6d5f8 };
+TypeInfo * __tinfo_115[1] = { &__type_info__90f4407b5a6d5f8 };
+TypeInfo * __tinfo_116[1] = { &__type_info__90f4407b5a6d5f8 };
+TypeInfo * __tinfo_117[1] = { &__type_info__90f4407b5a6d5f8 };
+TypeInfo * __tinfo_118[1] = { &__type_info__90f4407b5a6d5f8 };
+
+inline void _Func_0x60_test_vec2_4f3b48a29213cc63 ( Context * __context__, float2 __a_rename_at_6, bool __isRange_rename_at_6 );
+inline void _Func_0x60_test_vec3_58750926b80a2e1c ( Context * __context__, float3 __a_rename_at_32 );
+inline void _Func_0x60_test_vec4_d48ad944a27c2576 ( Context * __context__, float4 __a_rename_at_52 );
+inline void _Func_0x60_test_vec2_84bf552ba84fcdd6 ( Context * __context__, int2 __a_rename_at_6, bool __isRange_rename_at_6 );
+inline void _Func_0x60_test_vec3_f2ff25c70ccec3c9 ( Context * __context__, int3 __a_rename_at_32 );
+inline void _Func_0x60_test_vec4_b0ca6907bc110283 ( Context * __context__, int4 __a_rename_at_52 );
+inline void _Func_0x60_test_vec2_baa8fa364c6b4971 ( Context * __context__, uint2 __a_rename_at_6, bool __isRange_rename_at_6 );
+inline void _Func_0x60_test_vec3_6afb294787761954 ( Context * __context__, uint3 __a_rename_at_32 );
+inline void _Func_0x60_test_vec4_12d247a0c797684 ( Context * __context__, uint4 __a_rename_at_52 );
+inline void _Func_0x60_test_vec2_a809bc1b194a5600 ( Context * __context__, range __a_rename_at_6, bool __isRange_rename_at_6 );
+inline void _Func_0x60_test_vec2_5ae4be65d8c31757 ( Context * __context__, urange __a_rename_at_6, bool __isRange_rename_at_6 );
+inline void test_cvt_b1c4b2cf8e077f42 ( Context * __context__, int32_t __a_rename_at_73, int32_t __b_rename_at_73, int32_t __c_rename_at_73, int32_t __d_rename_at_73 );
+inline bool test_d3f425db6546ae08 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Func_0x60_test_vec2_4f3b48a29213cc63 ( Context * __context__, float2 __a_rename_at_6, bool __isRange_rename_at_6 )
+{
+	float2 __f2_0_rename_at_7 = ((float2)v_zero());
+	float2 __f2_x_rename_at_8 = ((float2)v_make_vec4f(1.f,2.f,0.f,0.f));
+	float2 __f2_y_rename_at_9 = ((float2)v_make_vec4f(1.f,2.f,0.f,0.f));
+	float2 __f2_z_rename_at_10 = ((float2)v_make_vec4f(1.f,2.f,0.f,0.f));
+	float2 __f2_w_rename_at_11 = ((float2)v_make_vec4f(1.f,2.f,0.f,0.f));
+	float2 __f2_xx_rename_at_12 = ((float2)v_splats(1.f));
+	float2 __f2_yy_rename_at_13 = ((float2)v_splats(1.f));
+	float2 __f2_zz_rename_at_14 = ((float2)v_splats(1.f));
+	float2 __f2_ww_rename_at_15 = ((float2)v_splats(1.f));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<float2>::from(__f2_0_rename_at_7)))),cast<char *>::from(((char *) "0,0")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_1, cast<float2>::from(__f2_x_rename_at_8)))),cast<char *>::from(((char *) "1,2")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_2, cast<float2>::from(__f2_y_rename_at_9)))),cast<char *>::from(((char *) "1,2")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_3, cast<float2>::from(__f2_z_rename_at_10)))),cast<char *>::from(((char *) "1,2")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_4, cast<float2>::from(__f2_w_rename_at_11)))),cast<char *>::from(((char *) "1,2")),*__context__,nullptr)));
+	if ( __isRange_rename_at_6 )
+	{
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_5, cast<float2>::from(__f2_xx_rename_at_12)))),cast<char *>::from(((char *) "0,1")),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_6, cast<float2>::from(__f2_yy_rename_at_13)))),cast<char *>::from(((char *) "0,1")),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_7, cast<float2>::from(__f2_zz_rename_at_14)))),cast<char *>::from(((char *) "0,1")),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_8, cast<float2>::from(__f2_ww_rename_at_15)))),cast<char *>::from(((char *) "0,1")),*__context__,nullptr)));
+	} else {
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_9, cast<float2>::from(__f2_xx_rename_at_12)))),cast<char *>::from(((char *) "1,1")),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_10, cast<float2>::from(__f2_yy_rename_at_13)))),cast<char *>::from(((char *) "1,1")),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_11, cast<float2>::from(__f2_zz_rename_at_14)))),cast<char *>::from(((char *) "1,1")),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_12, cast<float2>::from(__f2_ww_rename_at_15)))),cast<char *>::from(((char *) "1,1")),*__context__,nullptr)));
+	};
+}
+
+inline void _Func_0x60_test_vec3_58750926b80a2e1c ( Context * __context__, float3 __a_rename_at_32 )
+{
+	float3 __f3_0_rename_at_33 = ((float3)v_zero());
+	float3 __f3_x_rename_at_34 = ((float3)v_make_vec4f(1.f,2.f,3.f,0.f));
+	float3 __f3_y_rename_at_35 = ((float3)v_make_vec4f(1.f,2.f,3.f,0.f));
+	float3 __f3_z_rename_at_36 = ((float3)v_make_vec4f(1.f,2.f,3.f,0.f));
+	float3 __f3_w_rename_at_37 = ((float3)v_make_vec4f(1.f,2.f,3.f,0.f));
+	float3 __f3_xx_rename_at_38 = ((float3)v_splats(1.f));
+	float3 __f3_yy_rename_at_39 = ((float3)v_splats(1.f));
+	float3 __f3_zz_rename_at_40 = ((float3)v_splats(1.f));
+	float3 __f3_ww_rename_at_41 = ((float3)v_splats(1.f));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_13, cast<float3>::from(__f3_0_rename_at_33)))),cast<char *>::from(((char *) "0,0,0")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_14, cast<float3>::from(__f3_x_rename_at_34)))),cast<char *>::from(((char *) "1,2,3")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_15, cast<float3>::from(__f3_y_rename_at_35)))),cast<char *>::from(((char *) "1,2,3")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_16, cast<float3>::from(__f3_z_rename_at_36)))),cast<char *>::from(((char *) "1,2,3")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_17, cast<float3>::from(__f3_w_rename_at_37)))),cast<char *>::from(((char *) "1,2,3")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_18, cast<float3>::from(__f3_xx_rename_at_38)))),cast<char *>::from(((char *) "1,1,1")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_19, cast<float3>::from(__f3_yy_rename_at_39)))),cast<char *>::from(((char *) "1,1,1")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_20, cast<float3>::from(__f3_zz_rename_at_40)))),cast<char *>::from(((char *) "1,1,1")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_21, cast<float3>::from(__f3_ww_rename_at_41)))),cast<char *>::from(((char *) "1,1,1")),*__context__,nullptr)));
+}
+
+inline void _Func_0x60_test_vec4_d48ad944a27c2576 ( Context * __context__, float4 __a_rename_at_52 )
+{
+	float4 __f4_0_rename_at_53 = ((float4)v_zero());
+	float4 __f4_x_rename_at_54 = ((float4)v_make_vec4f(1.f,2.f,3.f,4.f));
+	float4 __f4_y_rename_at_55 = ((float4)v_make_vec4f(1.f,2.f,3.f,4.f));
+	float4 __f4_z_rename_at_56 = ((float4)v_make_vec4f(1.f,2.f,3.f,4.f));
+	float4 __f4_w_rename_at_57 = ((float4)v_make_vec4f(1.f,2.f,3.f,4.f));
+	float4 __f4_xx_rename_at_58 = ((float4)v_splats(1.f));
+	float4 __f4_yy_rename_at_59 = ((float4)v_splats(1.f));
+	float4 __f4_zz_rename_at_60 = ((float4)v_splats(1.f));
+	float4 __f4_ww_rename_at_61 = ((float4)v_splats(1.f));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_22, cast<float4>::from(__f4_0_rename_at_53)))),cast<char *>::from(((char *) "0,0,0,0")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_23, cast<float4>::from(__f4_x_rename_at_54)))),cast<char *>::from(((char *) "1,2,3,4")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_24, cast<float4>::from(__f4_y_rename_at_55)))),cast<char *>::from(((char *) "1,2,3,4")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_25, cast<float4>::from(__f4_z_rename_at_56)))),cast<char *>::from(((char *) "1,2,3,4")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_26, cast<float4>::from(__f4_w_rename_at_57)))),cast<char *>::from(((char *) "1,2,3,4")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_27, cast<float4>::from(__f4_xx_rename_at_58)))),cast<char *>::from(((char *) "1,1,1,1")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_28, cast<float4>::from(__f4_yy_rename_at_59)))),cast<char *>::from(((char *) "1,1,1,1")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_29, cast<float4>::from(__f4_zz_rename_at_60)))),cast<char *>::from(((char *) "1,1,1,1")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_30, cast<float4>::from(__f4_ww_rename_at_61)))),cast<char *>::from(((char *) "1,1,1,1")),*__context__,nullptr)));
+}
+
+inline void _Func_0x60_test_vec2_84bf552ba84fcdd6 ( Context * __context__, int2 __a_rename_at_6, bool __isRange_rename_at_6 )
+{
+	int2 __f2_0_rename_at_7 = ((int2)int2(0,0));
+	int2 __f2_x_rename_at_8 = ((int2)int2(1,2));
+	int2 __f2_y_rename_at_9 = ((int2)int2(1,2));
+	int2 __f2_z_rename_at_10 = ((int2)int2(1,2));
+	int2 __f2_w_rename_at_11 = ((int2)int2(1,2));
+	int2 __f2_xx_rename_at_12 = ((int2)int2(1,1));
+	int2 __f2_yy_rename_at_13 = ((int2)int2(1,1));
+	int2 __f2_zz_rename_at_14 = ((int2)int2(1,1));
+	int2 __f2_ww_rename_at_15 = ((int2)int2(1,1));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_31, cast<int2>::from(__f2_0_rename_at_7)))),cast<char *>::from(((char *) "0,0")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_32, cast<int2>::from(__f2_x_rename_at_8)))),cast<char *>::from(((char *) "1,2")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_33, cast<int2>::from(__f2_y_rename_at_9)))),cast<char *>::from(((char *) "1,2")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_34, cast<int2>::from(__f2_z_rename_at_10)))),cast<char *>::from(((char *) "1,2")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_35, cast<int2>::from(__f2_w_rename_at_11)))),cast<char *>::from(((char *) "1,2")),*__context__,nullptr)));
+	if ( __isRange_rename_at_6 )
+	{
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_36, cast<int2>::from(__f2_xx_rename_at_12)))),cast<char *>::from(((char *) "0,1")),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_37, cast<int2>::from(__f2_yy_rename_at_13)))),cast<char *>::from(((char *) "0,1")),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_38, cast<int2>::from(__f2_zz_rename_at_14)))),cast<char *>::from(((char *) "0,1")),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_39, cast<int2>::from(__f2_ww_rename_at_15)))),cast<char *>::from(((char *) "0,1")),*__context__,nullptr)));
+	} else {
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_40, cast<int2>::from(__f2_xx_rename_at_12)))),cast<char *>::from(((char *) "1,1")),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_41, cast<int2>::from(__f2_yy_rename_at_13)))),cast<char *>::from(((char *) "1,1")),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_42, cast<int2>::from(__f2_zz_rename_at_14)))),cast<char *>::from(((char *) "1,1")),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_43, cast<int2>::from(__f2_ww_rename_at_15)))),cast<char *>::from(((char *) "1,1")),*__context__,nullptr)));
+	};
+}
+
+inline void _Func_0x60_test_vec3_f2ff25c70ccec3c9 ( Context * __context__, int3 __a_rename_at_32 )
+{
+	int3 __f3_0_rename_at_33 = ((int3)int3(0,0,0));
+	int3 __f3_x_rename_at_34 = ((int3)int3(1,2,3));
+	int3 __f3_y_rename_at_35 = ((int3)int3(1,2,3));
+	int3 __f3_z_rename_at_36 = ((int3)int3(1,2,3));
+	int3 __f3_w_rename_at_37 = ((int3)int3(1,2,3));
+	int3 __f3_xx_rename_at_38 = ((int3)int3(1,1,1));
+	int3 __f3_yy_rename_at_39 = ((int3)int3(1,1,1));
+	int3 __f3_zz_rename_at_40 = ((int3)int3(1,1,1));
+	int3 __f3_ww_rename_at_41 = ((int3)int3(1,1,1));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_44, cast<int3>::from(__f3_0_rename_at_33)))),cast<char *>::from(((char *) "0,0,0")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_45, cast<int3>::from(__f3_x_rename_at_34)))),cast<char *>::from(((char *) "1,2,3")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_46, cast<int3>::from(__f3_y_rename_at_35)))),cast<char *>::from(((char *) "1,2,3")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_47, cast<int3>::from(__f3_z_rename_at_36)))),cast<char *>::from(((char *) "1,2,3")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_48, cast<int3>::from(__f3_w_rename_at_37)))),cast<char *>::from(((char *) "1,2,3")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_49, cast<int3>::from(__f3_xx_rename_at_38)))),cast<char *>::from(((char *) "1,1,1")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_50, cast<int3>::from(__f3_yy_rename_at_39)))),cast<char *>::from(((char *) "1,1,1")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_51, cast<int3>::from(__f3_zz_rename_at_40)))),cast<char *>::from(((char *) "1,1,1")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_52, cast<int3>::from(__f3_ww_rename_at_41)))),cast<char *>::from(((char *) "1,1,1")),*__context__,nullptr)));
+}
+
+inline void _Func_0x60_test_vec4_b0ca6907bc110283 ( Context * __context__, int4 __a_rename_at_52 )
+{
+	int4 __f4_0_rename_at_53 = ((int4)int4(0,0,0,0));
+	int4 __f4_x_rename_at_54 = ((int4)int4(1,2,3,4));
+	int4 __f4_y_rename_at_55 = ((int4)int4(1,2,3,4));
+	int4 __f4_z_rename_at_56 = ((int4)int4(1,2,3,4));
+	int4 __f4_w_rename_at_57 = ((int4)int4(1,2,3,4));
+	int4 __f4_xx_rename_at_58 = ((int4)int4(1,1,1,1));
+	int4 __f4_yy_rename_at_59 = ((int4)int4(1,1,1,1));
+	int4 __f4_zz_rename_at_60 = ((int4)int4(1,1,1,1));
+	int4 __f4_ww_rename_at_61 = ((int4)int4(1,1,1,1));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_53, cast<int4>::from(__f4_0_rename_at_53)))),cast<char *>::from(((char *) "0,0,0,0")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_54, cast<int4>::from(__f4_x_rename_at_54)))),cast<char *>::from(((char *) "1,2,3,4")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_55, cast<int4>::from(__f4_y_rename_at_55)))),cast<char *>::from(((char *) "1,2,3,4")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_56, cast<int4>::from(__f4_z_rename_at_56)))),cast<char *>::from(((char *) "1,2,3,4")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_57, cast<int4>::from(__f4_w_rename_at_57)))),cast<char *>::from(((char *) "1,2,3,4")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_58, cast<int4>::from(__f4_xx_rename_at_58)))),cast<char *>::from(((char *) "1,1,1,1")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_59, cast<int4>::from(__f4_yy_rename_at_59)))),cast<char *>::from(((char *) "1,1,1,1")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_60, cast<int4>::from(__f4_zz_rename_at_60)))),cast<char *>::from(((char *) "1,1,1,1")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_61, cast<int4>::from(__f4_ww_rename_at_61)))),cast<char *>::from(((char *) "1,1,1,1")),*__context__,nullptr)));
+}
+
+inline void _Func_0x60_test_vec2_baa8fa364c6b4971 ( Context * __context__, uint2 __a_rename_at_6, bool __isRange_rename_at_6 )
+{
+	uint2 __f2_0_rename_at_7 = ((uint2)uint2(0,0));
+	uint2 __f2_x_rename_at_8 = ((uint2)uint2(1,2));
+	uint2 __f2_y_rename_at_9 = ((uint2)uint2(1,2));
+	uint2 __f2_z_rename_at_10 = ((uint2)uint2(1,2));
+	uint2 __f2_w_rename_at_11 = ((uint2)uint2(1,2));
+	uint2 __f2_xx_rename_at_12 = ((uint2)uint2(1,1));
+	uint2 __f2_yy_rename_at_13 = ((uint2)uint2(1,1));
+	uint2 __f2_zz_rename_at_14 = ((uint2)uint2(1,1));
+	uint2 __f2_ww_rename_at_15 = ((uint2)uint2(1,1));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_62, cast<uint2>::from(__f2_0_rename_at_7)))),cast<char *>::from(((char *) "0,0")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_63, cast<uint2>::from(__f2_x_rename_at_8)))),cast<char *>::from(((char *) "1,2")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_64, cast<uint2>::from(__f2_y_rename_at_9)))),cast<char *>::from(((char *) "1,2")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_65, cast<uint2>::from(__f2_z_rename_at_10)))),cast<char *>::from(((char *) "1,2")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_66, cast<uint2>::from(__f2_w_rename_at_11)))),cast<char *>::from(((char *) "1,2")),*__context__,nullptr)));
+	if ( __isRange_rename_at_6 )
+	{
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_67, cast<uint2>::from(__f2_xx_rename_at_12)))),cast<char *>::from(((char *) "0,1")),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_68, cast<uint2>::from(__f2_yy_rename_at_13)))),cast<char *>::from(((char *) "0,1")),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_69, cast<uint2>::from(__f2_zz_rename_at_14)))),cast<char *>::from(((char *) "0,1")),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_70, cast<uint2>::from(__f2_ww_rename_at_15)))),cast<char *>::from(((char *) "0,1")),*__context__,nullptr)));
+	} else {
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_71, cast<uint2>::from(__f2_xx_rename_at_12)))),cast<char *>::from(((char *) "1,1")),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_72, cast<uint2>::from(__f2_yy_rename_at_13)))),cast<char *>::from(((char *) "1,1")),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_73, cast<uint2>::from(__f2_zz_rename_at_14)))),cast<char *>::from(((char *) "1,1")),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_74, cast<uint2>::from(__f2_ww_rename_at_15)))),cast<char *>::from(((char *) "1,1")),*__context__,nullptr)));
+	};
+}
+
+inline void _Func_0x60_test_vec3_6afb294787761954 ( Context * __context__, uint3 __a_rename_at_32 )
+{
+	uint3 __f3_0_rename_at_33 = ((uint3)uint3(0,0,0));
+	uint3 __f3_x_rename_at_34 = ((uint3)uint3(1,2,3));
+	uint3 __f3_y_rename_at_35 = ((uint3)uint3(1,2,3));
+	uint3 __f3_z_rename_at_36 = ((uint3)uint3(1,2,3));
+	uint3 __f3_w_rename_at_37 = ((uint3)uint3(1,2,3));
+	uint3 __f3_xx_rename_at_38 = ((uint3)uint3(1,1,1));
+	uint3 __f3_yy_rename_at_39 = ((uint3)uint3(1,1,1));
+	uint3 __f3_zz_rename_at_40 = ((uint3)uint3(1,1,1));
+	uint3 __f3_ww_rename_at_41 = ((uint3)uint3(1,1,1));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_75, cast<uint3>::from(__f3_0_rename_at_33)))),cast<char *>::from(((char *) "0,0,0")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_76, cast<uint3>::from(__f3_x_rename_at_34)))),cast<char *>::from(((char *) "1,2,3")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_77, cast<uint3>::from(__f3_y_rename_at_35)))),cast<char *>::from(((char *) "1,2,3")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_78, cast<uint3>::from(__f3_z_rename_at_36)))),cast<char *>::from(((char *) "1,2,3")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_79, cast<uint3>::from(__f3_w_rename_at_37)))),cast<char *>::from(((char *) "1,2,3")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_80, cast<uint3>::from(__f3_xx_rename_at_38)))),cast<char *>::from(((char *) "1,1,1")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_81, cast<uint3>::from(__f3_yy_rename_at_39)))),cast<char *>::from(((char *) "1,1,1")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_82, cast<uint3>::from(__f3_zz_rename_at_40)))),cast<char *>::from(((char *) "1,1,1")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_83, cast<uint3>::from(__f3_ww_rename_at_41)))),cast<char *>::from(((char *) "1,1,1")),*__context__,nullptr)));
+}
+
+inline void _Func_0x60_test_vec4_12d247a0c797684 ( Context * __context__, uint4 __a_rename_at_52 )
+{
+	uint4 __f4_0_rename_at_53 = ((uint4)uint4(0,0,0,0));
+	uint4 __f4_x_rename_at_54 = ((uint4)uint4(1,2,3,4));
+	uint4 __f4_y_rename_at_55 = ((uint4)uint4(1,2,3,4));
+	uint4 __f4_z_rename_at_56 = ((uint4)uint4(1,2,3,4));
+	uint4 __f4_w_rename_at_57 = ((uint4)uint4(1,2,3,4));
+	uint4 __f4_xx_rename_at_58 = ((uint4)uint4(1,1,1,1));
+	uint4 __f4_yy_rename_at_59 = ((uint4)uint4(1,1,1,1));
+	uint4 __f4_zz_rename_at_60 = ((uint4)uint4(1,1,1,1));
+	uint4 __f4_ww_rename_at_61 = ((uint4)uint4(1,1,1,1));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_84, cast<uint4>::from(__f4_0_rename_at_53)))),cast<char *>::from(((char *) "0,0,0,0")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_85, cast<uint4>::from(__f4_x_rename_at_54)))),cast<char *>::from(((char *) "1,2,3,4")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_86, cast<uint4>::from(__f4_y_rename_at_55)))),cast<char *>::from(((char *) "1,2,3,4")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_87, cast<uint4>::from(__f4_z_rename_at_56)))),cast<char *>::from(((char *) "1,2,3,4")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_88, cast<uint4>::from(__f4_w_rename_at_57)))),cast<char *>::from(((char *) "1,2,3,4")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_89, cast<uint4>::from(__f4_xx_rename_at_58)))),cast<char *>::from(((char *) "1,1,1,1")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_90, cast<uint4>::from(__f4_yy_rename_at_59)))),cast<char *>::from(((char *) "1,1,1,1")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_91, cast<uint4>::from(__f4_zz_rename_at_60)))),cast<char *>::from(((char *) "1,1,1,1")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_92, cast<uint4>::from(__f4_ww_rename_at_61)))),cast<char *>::from(((char *) "1,1,1,1")),*__context__,nullptr)));
+}
+
+inline void _Func_0x60_test_vec2_a809bc1b194a5600 ( Context * __context__, range __a_rename_at_6, bool __isRange_rename_at_6 )
+{
+	range __f2_0_rename_at_7 = ((range)range(0,0));
+	range __f2_x_rename_at_8 = ((range)range(1,2));
+	range __f2_y_rename_at_9 = ((range)range(1,2));
+	range __f2_z_rename_at_10 = ((range)range(1,2));
+	range __f2_w_rename_at_11 = ((range)range(1,2));
+	range __f2_xx_rename_at_12 = ((range)range(0,1));
+	range __f2_yy_rename_at_13 = ((range)range(0,1));
+	range __f2_zz_rename_at_14 = ((range)range(0,1));
+	range __f2_ww_rename_at_15 = ((range)range(0,1));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_93, cast<range>::from(__f2_0_rename_at_7)))),cast<char *>::from(((char *) "0,0")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_94, cast<range>::from(__f2_x_rename_at_8)))),cast<char *>::from(((char *) "1,2")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_95, cast<range>::from(__f2_y_rename_at_9)))),cast<char *>::from(((char *) "1,2")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_96, cast<range>::from(__f2_z_rename_at_10)))),cast<char *>::from(((char *) "1,2")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_97, cast<range>::from(__f2_w_rename_at_11)))),cast<char *>::from(((char *) "1,2")),*__context__,nullptr)));
+	if ( __isRange_rename_at_6 )
+	{
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_98, cast<range>::from(__f2_xx_rename_at_12)))),cast<char *>::from(((char *) "0,1")),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_99, cast<range>::from(__f2_yy_rename_at_13)))),cast<char *>::from(((char *) "0,1")),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_100, cast<range>::from(__f2_zz_rename_at_14)))),cast<char *>::from(((char *) "0,1")),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_101, cast<range>::from(__f2_ww_rename_at_15)))),cast<char *>::from(((char *) "0,1")),*__context__,nullptr)));
+	} else {
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_102, cast<range>::from(__f2_xx_rename_at_12)))),cast<char *>::from(((char *) "1,1")),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_103, cast<range>::from(__f2_yy_rename_at_13)))),cast<char *>::from(((char *) "1,1")),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_104, cast<range>::from(__f2_zz_rename_at_14)))),cast<char *>::from(((char *) "1,1")),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_105, cast<range>::from(__f2_ww_rename_at_15)))),cast<char *>::from(((char *) "1,1")),*__context__,nullptr)));
+	};
+}
+
+inline void _Func_0x60_test_vec2_5ae4be65d8c31757 ( Context * __context__, urange __a_rename_at_6, bool __isRange_rename_at_6 )
+{
+	urange __f2_0_rename_at_7 = ((urange)urange(0,0));
+	urange __f2_x_rename_at_8 = ((urange)urange(1,2));
+	urange __f2_y_rename_at_9 = ((urange)urange(1,2));
+	urange __f2_z_rename_at_10 = ((urange)urange(1,2));
+	urange __f2_w_rename_at_11 = ((urange)urange(1,2));
+	urange __f2_xx_rename_at_12 = ((urange)urange(0,1));
+	urange __f2_yy_rename_at_13 = ((urange)urange(0,1));
+	urange __f2_zz_rename_at_14 = ((urange)urange(0,1));
+	urange __f2_ww_rename_at_15 = ((urange)urange(0,1));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_106, cast<urange>::from(__f2_0_rename_at_7)))),cast<char *>::from(((char *) "0,0")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_107, cast<urange>::from(__f2_x_rename_at_8)))),cast<char *>::from(((char *) "1,2")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_108, cast<urange>::from(__f2_y_rename_at_9)))),cast<char *>::from(((char *) "1,2")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_109, cast<urange>::from(__f2_z_rename_at_10)))),cast<char *>::from(((char *) "1,2")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_110, cast<urange>::from(__f2_w_rename_at_11)))),cast<char *>::from(((char *) "1,2")),*__context__,nullptr)));
+	if ( __isRange_rename_at_6 )
+	{
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_111, cast<urange>::from(__f2_xx_rename_at_12)))),cast<char *>::from(((char *) "0,1")),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_112, cast<urange>::from(__f2_yy_rename_at_13)))),cast<char *>::from(((char *) "0,1")),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_113, cast<urange>::from(__f2_zz_rename_at_14)))),cast<char *>::from(((char *) "0,1")),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_114, cast<urange>::from(__f2_ww_rename_at_15)))),cast<char *>::from(((char *) "0,1")),*__context__,nullptr)));
+	} else {
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_115, cast<urange>::from(__f2_xx_rename_at_12)))),cast<char *>::from(((char *) "1,1")),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_116, cast<urange>::from(__f2_yy_rename_at_13)))),cast<char *>::from(((char *) "1,1")),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_117, cast<urange>::from(__f2_zz_rename_at_14)))),cast<char *>::from(((char *) "1,1")),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_118, cast<urange>::from(__f2_ww_rename_at_15)))),cast<char *>::from(((char *) "1,1")),*__context__,nullptr)));
+	};
+}
+
+inline void test_cvt_b1c4b2cf8e077f42 ( Context * __context__, int32_t __a_rename_at_73, int32_t __b_rename_at_73, int32_t __c_rename_at_73, int32_t __d_rename_at_73 )
+{
+	DAS_ASSERT((SimPolicy<float2>::Equ(cvt_ifloat2(int2(__a_rename_at_73,__b_rename_at_73)),float2(__a_rename_at_73,__b_rename_at_73),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<float3>::Equ(cvt_ifloat3(int3(__a_rename_at_73,__b_rename_at_73,__c_rename_at_73)),float3(__a_rename_at_73,__b_rename_at_73,__c_rename_at_73),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<float4>::Equ(cvt_ifloat4(int4(__a_rename_at_73,__b_rename_at_73,__c_rename_at_73,__d_rename_at_73)),float4(__a_rename_at_73,__b_rename_at_73,__c_rename_at_73,__d_rename_at_73),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<float2>::Equ(cvt_ufloat2(uint2(__a_rename_at_73,__b_rename_at_73)),float2(__a_rename_at_73,__b_rename_at_73),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<float3>::Equ(cvt_ufloat3(uint3(__a_rename_at_73,__b_rename_at_73,__c_rename_at_73)),float3(__a_rename_at_73,__b_rename_at_73,__c_rename_at_73),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<float4>::Equ(cvt_ufloat4(uint4(__a_rename_at_73,__b_rename_at_73,__c_rename_at_73,__d_rename_at_73)),float4(__a_rename_at_73,__b_rename_at_73,__c_rename_at_73,__d_rename_at_73),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<int2>::Equ(cvt_int2(float2(__a_rename_at_73,__b_rename_at_73)),int2(__a_rename_at_73,__b_rename_at_73),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<int3>::Equ(cvt_int3(float3(__a_rename_at_73,__b_rename_at_73,__c_rename_at_73)),int3(__a_rename_at_73,__b_rename_at_73,__c_rename_at_73),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<int4>::Equ(cvt_int4(float4(__a_rename_at_73,__b_rename_at_73,__c_rename_at_73,__d_rename_at_73)),int4(__a_rename_at_73,__b_rename_at_73,__c_rename_at_73,__d_rename_at_73),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<uint2>::Equ(cvt_uint2(float2(__a_rename_at_73,__b_rename_at_73)),uint2(__a_rename_at_73,__b_rename_at_73),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<uint3>::Equ(cvt_uint3(float3(__a_rename_at_73,__b_rename_at_73,__c_rename_at_73)),uint3(__a_rename_at_73,__b_rename_at_73,__c_rename_at_73),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<uint4>::Equ(cvt_uint4(float4(__a_rename_at_73,__b_rename_at_73,__c_rename_at_73,__d_rename_at_73)),uint4(__a_rename_at_73,__b_rename_at_73,__c_rename_at_73,__d_rename_at_73),*__context__,nullptr)));
+}
+
+inline bool test_d3f425db6546ae08 ( Context * __context__ )
+{
+	_Func_0x60_test_vec2_4f3b48a29213cc63(__context__,v_zero(),false);
+	_Func_0x60_test_vec3_58750926b80a2e1c(__context__,v_zero());
+	_Func_0x60_test_vec4_d48ad944a27c2576(__context__,v_zero());
+	_Func_0x60_test_vec2_84bf552ba84fcdd6(__context__,int2(0,0),false);
+	_Func_0x60_test_vec3_f2ff25c70ccec3c9(__context__,int3(0,0,0));
+	_Func_0x60_test_vec4_b0ca6907bc110283(__context__,int4(0,0,0,0));
+	_Func_0x60_test_vec2_baa8fa364c6b4971(__context__,uint2(0,0),false);
+	_Func_0x60_test_vec3_6afb294787761954(__context__,uint3(0,0,0));
+	_Func_0x60_test_vec4_12d247a0c797684(__context__,uint4(0,0,0,0));
+	_Func_0x60_test_vec2_a809bc1b194a5600(__context__,range(0,0),true);
+	_Func_0x60_test_vec2_5ae4be65d8c31757(__context__,urange(0,0),true);
+	test_cvt_b1c4b2cf8e077f42(__context__,1,2,3,4);
+	return das_auto_cast<bool>::cast(true);
+}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Func_0x60_test_vec2_4f3b48a29213cc63
+	aotLib[0xc240f4093a455369] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, float2 , bool  ),&_Func_0x60_test_vec2_4f3b48a29213cc63>>();
+	};
+	// _Func_0x60_test_vec3_58750926b80a2e1c
+	aotLib[0xe06b4c764d5be5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, float3  ),&_Func_0x60_test_vec3_58750926b80a2e1c>>();
+	};
+	// _Func_0x60_test_vec4_d48ad944a27c2576
+	aotLib[0x1b7ff740f79b5345] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, float4  ),&_Func_0x60_test_vec4_d48ad944a27c2576>>();
+	};
+	// _Func_0x60_test_vec2_84bf552ba84fcdd6
+	aotLib[0x6c3b6a4353f1c5d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int2 , bool  ),&_Func_0x60_test_vec2_84bf552ba84fcdd6>>();
+	};
+	// _Func_0x60_test_vec3_f2ff25c70ccec3c9
+	aotLib[0xb4ade788b6e1562d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int3  ),&_Func_0x60_test_vec3_f2ff25c70ccec3c9>>();
+	};
+	// _Func_0x60_test_vec4_b0ca6907bc110283
+	aotLib[0xea628a1efa224309] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int4  ),&_Func_0x60_test_vec4_b0ca6907bc110283>>();
+	};
+	// _Func_0x60_test_vec2_baa8fa364c6b4971
+	aotLib[0xf5788d1d805acce5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, uint2 , bool  ),&_Func_0x60_test_vec2_baa8fa364c6b4971>>();
+	};
+	// _Func_0x60_test_vec3_6afb294787761954
+	aotLib[0xbfe67263e9c70851] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, uint3  ),&_Func_0x60_test_vec3_6afb294787761954>>();
+	};
+	// _Func_0x60_test_vec4_12d247a0c797684
+	aotLib[0xfdbd3a25ab80b219] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, uint4  ),&_Func_0x60_test_vec4_12d247a0c797684>>();
+	};
+	// _Func_0x60_test_vec2_a809bc1b194a5600
+	aotLib[0x612ac4d355bf51d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, range , bool  ),&_Func_0x60_test_vec2_a809bc1b194a5600>>();
+	};
+	// _Func_0x60_test_vec2_5ae4be65d8c31757
+	aotLib[0x5740ab6933e14265] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, urange , bool  ),&_Func_0x60_test_vec2_5ae4be65d8c31757>>();
+	};
+	// test_cvt_b1c4b2cf8e077f42
+	aotLib[0xa0419919432420a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , int32_t , int32_t , int32_t  ),&test_cvt_b1c4b2cf8e077f42>>();
+	};
+	// test_d3f425db6546ae08
+	aotLib[0x7e1159cdda77e51d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_d3f425db6546ae08>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
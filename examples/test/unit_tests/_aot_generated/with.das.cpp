@@ -0,0 +1,107 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_14667002905948549444 {
+
+
+
+namespace  { struct Point; };
+namespace  {
+
+struct Point {
+	int32_t x;
+	int32_t y;
+};
+static_assert(sizeof(Point)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Point,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Point,y)==4,"structure field offset mismatch with DAS");
+}
+
+inline bool test_73d3349e844bda7f ( Context * __context__ );
+inline Point Point_c70ec3a519e25005 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool test_73d3349e844bda7f ( Context * __context__ )
+{
+	Point __p_rename_at_6 = Point_c70ec3a519e25005(__context__);
+	das_copy(__p_rename_at_6.x,1);
+	das_copy(__p_rename_at_6.y,2);
+	DAS_ASSERT(((__p_rename_at_6.x == 1) && (__p_rename_at_6.y == 2)));
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline Point Point_c70ec3a519e25005 ( Context * __context__ )
+{
+	return das_auto_cast_ref<Point>::cast((([&]() -> Point {
+		Point __mks_1;
+		das_copy((__mks_1.x),(0));
+		das_copy((__mks_1.y),(0));
+		return __mks_1;
+	})()));
+}
+	static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// test_73d3349e844bda7f
+	aotLib[0xe58ed70c1113018e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_73d3349e844bda7f>>();
+	};
+	// Point_c70ec3a519e25005
+	aotLib[0xccbe7f29a4af236d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Point (*) ( Context * __context__ ),&Point_c70ec3a519e25005>>();
+	};
+	};
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+AotSharedListBase impl(registerAotFunctions);
+#else
+AotListBase impl(registerAotFunctions);
+#endif
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -758,6 +758,7 @@ namespace das
                 bool    macroFunction : 1;
                 bool    needStringCast : 1;
                 bool    aotHashDeppendsOnArguments : 1;
+                bool    hasTailCall : 1;
             };
             uint32_t moreFlags = 0;
 
@@ -1119,8 +1120,10 @@ namespace das
     struct CodeOfPolicies {
         bool        aot = false;                        // enable AOT
         bool        aot_module = false;                 // this is how AOT tool knows module is module, and not an entry point
+        string      aot_lib;                            // link AOT from this shared library, instead of the global AOT library
     // memory
         uint32_t    stack = 16*1024;                    // 0 for unique stack
+        uint32_t    max_stack = 0;                      // if bigger than stack, stack grows in 'stack' sized segments up to max_stack
         bool        intern_strings = false;             // use string interning lookup for regular string heap
         bool        persistent_heap = false;
         bool        multiple_contexts = false;          // code supports context safety
@@ -1180,10 +1183,13 @@ namespace das
         virtual void afterAlias ( const char * name, const LineInfo & at ) = 0;
     };
 
+    struct InferWorklist;
+
     class Program : public ptr_ref_count {
     public:
         Program();
         int getContextStackSize() const;
+        int getContextMaxStackSize() const;
         friend TextWriter& operator<< (TextWriter& stream, const Program & program);
         vector<StructurePtr> findStructure ( const string & name ) const;
         vector<AnnotationPtr> findAnnotation ( const string & name ) const;
@@ -1242,6 +1248,7 @@ namespace das
         void aotCpp ( Context & context, TextWriter & logs );
         void registerAotCpp ( TextWriter & logs, Context & context, bool headers = true );
         void validateAotCpp ( TextWriter & logs, Context & context );
+        void selectAotFromProfile ( const FunctionProfiler::Profile & profile, double coverage, TextWriter & logs );
         void buildMNLookup ( Context & context, const vector<FunctionPtr> & lookupFunctions, TextWriter & logs );
         void buildGMNLookup ( Context & context, TextWriter & logs );
         void buildADLookup ( Context & context, TextWriter & logs );
@@ -1253,6 +1260,7 @@ namespace das
         // this is no longer the way to link AOT
         //  set CodeOfPolicies::aot instead
         void linkCppAot ( Context & context, AotLibrary & aotLib, TextWriter & logs );
+        void linkCppAotLibrary ( Context & context, AotLibrary & aotLib, TextWriter & logs );
         void linkError ( const string & str, const string & extra );
     public:
         template <typename TT>
@@ -1277,6 +1285,9 @@ namespace das
         int                         totalFunctions = 0;
         int                         totalVariables = 0;
         int                         newLambdaIndex = 1;
+        shared_ptr<InferWorklist>   inferWorklist;      // what type inference can skip on the next pass
+        shared_ptr<AotLibrary>      aotLibrary;         // when set, AOT links from here and not from the global AOT library
+        das_set<Function *>         aotInterpreted;     // left to the interpreter by selectAotFromProfile
         vector<Error>               errors;
         vector<Error>               aotErrors;
         uint32_t                    globalInitStackSize = 0;
@@ -1137,6 +1137,7 @@ namespace das
         static SimNode_CallBase * simulateCall (const FunctionPtr & func, const ExprLooksLikeCall * expr,
             Context & context, SimNode_CallBase * pCall);
         bool            doesNotNeedSp = false;
+        bool            tailCall = false;           // return f(...), lowered to argument rewrite and jump
     };
 
     struct ExprIfThenElse : Expression {
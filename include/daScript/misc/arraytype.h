@@ -76,6 +76,7 @@ namespace das
         TLambda()  {}
         TLambda( const TLambda & ) = default;
         TLambda( const Lambda & that ) { *(Lambda *)this = that; }
+        TLambda( void * ptr ) : Lambda(ptr) {}
     };
 
     struct Tuple {
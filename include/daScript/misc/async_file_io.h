@@ -0,0 +1,70 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <thread>
+#include <atomic>
+
+namespace das {
+
+    enum class AsyncFileOp : int32_t {
+        read,
+        write,
+        append,
+        stat
+    };
+
+    struct AsyncFileResult {
+        uint64_t    id = 0;
+        int32_t     op = 0;
+        int32_t     error = 0;          // errno of the failed operation, 0 on success
+        uint64_t    size = 0;           // bytes read or written, file size for stat
+        int64_t     mtime = 0;          // stat only
+        bool        is_dir = false;     // stat only
+    };
+
+    struct AsyncFileCompletion {
+        AsyncFileResult result;
+        vector<char>    data;           // file contents for read
+    };
+
+    // file requests are queued by the owner, handed to the worker threads in batches on submit,
+    // and their completions are collected back by the owner (usually once per frame or tick)
+    class AsyncFileIO {
+    public:
+        AsyncFileIO ( int32_t threadCount = 0 );
+        AsyncFileIO ( const AsyncFileIO & ) = delete;
+        AsyncFileIO & operator = ( const AsyncFileIO & ) = delete;
+        ~AsyncFileIO();
+        uint64_t read ( const char * name );
+        uint64_t write ( const char * name, const char * data, uint32_t size, bool append );
+        uint64_t stat ( const char * name );
+        int32_t submit();                                                   // returns number of submitted requests
+        int32_t complete ( vector<AsyncFileCompletion> & done, int32_t timeoutMs );   // -1 waits for at least one completion
+        int32_t pending() const { return int32_t(queued.size()); }          // queued, but not submitted
+        int32_t in_flight() const { return inFlight; }                      // submitted, but not completed
+        int32_t threads() const { return int32_t(workers.size()); }
+    protected:
+        struct Request {
+            uint64_t        id = 0;
+            AsyncFileOp     op = AsyncFileOp::read;
+            string          name;
+            vector<char>    data;
+        };
+        uint64_t queue ( AsyncFileOp op, const char * name );
+        void worker();
+        void execute ( Request & req, AsyncFileCompletion & res );
+    protected:
+        vector<Request>             queued;
+        uint64_t                    nextId = 1;
+        atomic<int32_t>             inFlight;
+        vector<thread>              workers;
+        mutex                       requestMutex;
+        condition_variable          requestCond;
+        deque<Request>              requests;
+        bool                        shutdown = false;
+        mutex                       doneMutex;
+        condition_variable          doneCond;
+        vector<AsyncFileCompletion> completions;
+    };
+}
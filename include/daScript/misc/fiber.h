@@ -0,0 +1,15 @@
+#pragma once
+
+namespace das {
+
+    // native execution context with its own machine stack
+    // used by stackful coroutines to suspend in the middle of the interpreter (or AOT) call chain
+    struct Fiber;
+
+    typedef void (* FiberEntry) ( void * arg );
+
+    Fiber * fiberCreate ( size_t stackSize, FiberEntry entry, void * arg );  // stackSize==0 creates an empty slot, which can only be switched from
+    void fiberDestroy ( Fiber * fiber );
+    void fiberSwitch ( Fiber * from, Fiber * to );                          // saves current state into 'from', continues 'to'
+    size_t fiberStackSize ( Fiber * fiber );
+}
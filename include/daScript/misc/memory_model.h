@@ -294,9 +294,17 @@ namespace das {
             size = s;
             offset = 0;
             next = n;
+            external = false;
+        }
+        __forceinline HeapChunk ( char * d, uint32_t s, HeapChunk * n ) {
+            data = d;
+            size = s;
+            offset = 0;
+            next = n;
+            external = true;
         }
         ~HeapChunk() {
-            das_aligned_free16(data);
+            if ( !external ) das_aligned_free16(data);
             while (next) {
                 HeapChunk * toDelete = next;
                 next = toDelete->next;
@@ -322,6 +330,52 @@ namespace das {
         uint32_t    size;
         uint32_t    offset;
         HeapChunk * next;
+        bool        external;      // data is owned by the chunk region
+    };
+
+    // reserved address range, which chunk allocators carve their chunks from instead of the heap
+    // chunks are never returned to the region. reserved region is a private anonymous mapping: its pages are not mixed
+    // with the heap, so after fork the pages, which nobody writes to, stay physically shared between the parent and its
+    // children, but unrelated processes never share them.
+    // region, which maps the file (i.e. the context image), is already fully allocated. it is mapped copy on write,
+    // so the pages nobody writes to are shared with the file cache by every process, which maps the same file.
+    // node links and debug info links are absolute pointers, and are patched on load. so between unrelated processes
+    // only constant strings (and the pages of debug info without pointers) stay shared. node trees are not
+    class ChunkRegion {
+    public:
+        ChunkRegion ( uint64_t reserve );
+        ChunkRegion ( const string & fileName );
+        ChunkRegion ( const ChunkRegion & ) = delete;
+        ChunkRegion & operator = ( const ChunkRegion & ) = delete;
+        ~ChunkRegion();
+        char * allocate ( uint32_t size );      // zeroed memory, or nullptr once the region is exhausted
+        __forceinline bool isOwnPtr ( const char * ptr ) const {
+            return (ptr>=data) && (ptr<data+reserved);
+        }
+        uint64_t bytesAllocated() const { return offset; }
+        uint64_t bytesCommitted() const { return committed; }
+        uint64_t bytesReserved() const { return reserved; }
+        __forceinline char * base() const { return data; }
+        __forceinline bool isMapped() const { return mapped; }
+    protected:
+        char *      data = nullptr;
+        uint64_t    reserved = 0;
+        uint64_t    committed = 0;
+        uint64_t    offset = 0;
+        uint64_t    pageSize = 4096;
+        bool        mapped = false;
+        mutex       lock;
+    };
+    typedef shared_ptr<ChunkRegion> ChunkRegionPtr;
+
+    // chunk list head and the used part of every chunk, enough to rewind allocator to the exact same state
+    // generation and chunk sizes tell the same chain from the new one, which reuses the addresses after reset
+    struct LinearChunkSnapshot {
+        HeapChunk *         chunk = nullptr;
+        uint64_t            generation = 0;
+        vector<uint32_t>    sizes;
+        vector<uint32_t>    offsets;
+        vector<char>        data;
     };
 
     class LinearChunkAllocator : public ptr_ref_count {
@@ -350,13 +404,19 @@ namespace das {
             initialSize = size;
         }
         virtual uint32_t grow ( uint32_t si );
+        HeapChunk * newChunk ( uint32_t size, HeapChunk * next );
+        void snapshot ( LinearChunkSnapshot & snap ) const;
+        bool restore ( const LinearChunkSnapshot & snap );
     protected:
         void getStats ( uint32_t & depth, uint64_t & bytes, uint64_t & total ) const;
     public:
         CustomGrowFunction  customGrow;
         uint32_t    initialSize = 0;
         uint32_t    alignMask = 15;
+        bool        zeroChunks = false;     // padding and alignment gaps are zero, not garbage
+        ChunkRegionPtr  region;             // chunks come from the region first, and from the heap once it is exhausted
         HeapChunk * chunk = nullptr;
+        uint64_t    generation = 0;         // bumped every time the chunks are freed, i.e. snapshots of the old chain are stale
     };
 
 }
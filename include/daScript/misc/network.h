@@ -33,4 +33,64 @@ namespace das {
         socket_t server_fd = 0;
         socket_t client_fd = 0;
     };
+
+    // any number of connections, accepted or outgoing, driven by one event loop
+    // epoll on linux, poll (WSAPoll) everywhere else
+    // each connection is identified by id. ids increase, and wrap around to 1 after INT32_MAX, skipping the ones still in use
+    // so an id is only reused after ~2^31 connections, and never while its connection is open
+    class MultiServer : public ptr_ref_count {
+    public:
+        enum {
+            recv_buffer_size = 16384,               // single recv, onData never gets more than that
+            max_events = 256                        // events per epoll_wait
+        };
+        struct Connection {
+            socket_t        fd = 0;
+            int32_t         id = 0;
+            vector<char>    out;                    // queued by send_msg, written by flush
+            uint32_t        outOffset = 0;          // bytes of 'out' already written
+            bool            dirty = false;          // in the dirty list
+            bool            wantWrite = false;      // waiting for the socket to become writable
+            bool            connecting = false;     // outgoing connection, which is not established yet
+        };
+    public:
+        MultiServer ();
+        virtual ~MultiServer();
+        bool init ( int port = 9000 );                          // listen on port
+        int32_t connect ( const char * host, int port );        // outgoing connection, returns id or -1
+        bool is_open() const;                                   // listening
+        int32_t tick ( int32_t timeoutMs = 0 );                 // process pending events, returns number of them
+        bool send_msg ( int32_t id, const char * data, int size );  // queued, written at the end of tick
+        void flush();                                           // write queued data of all connections
+        void close ( int32_t id );                              // flush and close, calls onDisconnect
+        int32_t connections() const { return int32_t(conns.size()); }
+        int32_t pooled_buffers() const { return int32_t(bufferPool.size()); }
+    protected:
+        virtual void onConnect ( int32_t id );
+        virtual void onDisconnect ( int32_t id );
+        virtual void onData ( int32_t id, char * buf, int size );
+        virtual void onError ( int32_t id, const char * msg, int code );
+        virtual void onLog ( const char * msg );
+    protected:
+        bool initPoll();
+        int32_t allocateId();
+        Connection * addConnection ( socket_t fd );
+        void dropConnection ( Connection * conn );
+        void removeConnection ( Connection * conn, int code );
+        void onEvent ( int32_t id, bool readable, bool writable );
+        void acceptAll();
+        void readAll ( Connection * conn );
+        bool writeQueued ( Connection * conn );
+        void watchWrite ( Connection * conn, bool write );
+        char * allocateBuffer();
+        void freeBuffer ( char * buf );
+    protected:
+        socket_t                            server_fd = 0;
+        int                                 poll_fd = -1;       // epoll instance, -1 with the poll fallback
+        int32_t                             nextId = 1;
+        das_hash_map<int32_t,Connection *>  conns;
+        vector<int32_t>                     dirty;              // ids of connections with queued data
+        vector<Connection *>                connectionPool;
+        vector<char *>                      bufferPool;
+    };
 }
\ No newline at end of file
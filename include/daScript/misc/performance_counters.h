@@ -0,0 +1,35 @@
+#pragma once
+
+namespace das {
+
+    enum class PerfCounter {
+        cycles,
+        instructions,
+        branchMisses,
+        l1dMisses,
+        llcMisses,
+        total
+    };
+
+    // hardware performance counters of the current thread (perf_event_open on linux)
+    // counters are opened once, as a single group, and scaled when the kernel multiplexes them
+    // counters which can't be opened (other platforms, containers, perf_event_paranoid) are not available
+    class PerfCounters {
+    public:
+        PerfCounters();
+        ~PerfCounters();
+        PerfCounters ( const PerfCounters & ) = delete;
+        PerfCounters & operator = ( const PerfCounters & ) = delete;
+        bool available ( PerfCounter cnt ) const { return fd[int(cnt)] != -1; }
+        bool any () const;
+        void start ();
+        // adds counted values since start() to the values
+        void stop ( uint64_t * values );
+        static const char * name ( PerfCounter cnt );
+    private:
+        int fd[int(PerfCounter::total)];
+        int slot[int(PerfCounter::total)];     // group member index to counter
+        int leader;
+        int members;
+    };
+}
@@ -105,8 +105,20 @@
         _BitScanReverse(&r, x);
         return uint32_t(31 - r);
     }
+    __forceinline uint32_t das_ctz(uint32_t x) {
+        unsigned long r = 0;
+        _BitScanForward(&r, x);
+        return uint32_t(r);
+    }
+    __forceinline uint32_t das_popcount(uint32_t x) {
+        x = x - ((x >> 1) & 0x55555555u);
+        x = (x & 0x33333333u) + ((x >> 2) & 0x33333333u);
+        return (((x + (x >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24;
+    }
 #else
     #define das_clz __builtin_clz
+    #define das_ctz __builtin_ctz
+    #define das_popcount __builtin_popcount
 #endif
 
 #ifdef _MSC_VER
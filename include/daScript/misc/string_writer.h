@@ -61,7 +61,58 @@ namespace das {
         vector<char> data;
     };
 
-    // todo: support hex
+    // first DAS_INLINE_BUFFER_SIZE bytes are stored in the writer itself, after that buffer grows geometrically on the heap
+    // short strings are built without any allocations at all
+    #define DAS_INLINE_BUFFER_SIZE  256
+
+    class InlineBufferPolicy {
+    public:
+        InlineBufferPolicy() {}
+        InlineBufferPolicy ( const InlineBufferPolicy & ) = delete;
+        InlineBufferPolicy & operator = ( const InlineBufferPolicy & ) = delete;
+        virtual ~InlineBufferPolicy() {
+            if ( data!=inlineData ) das_aligned_free16(data);
+        }
+        string str() const {
+            return string(data, size);
+        }
+        int tellp() const {
+            return size;
+        }
+    protected:
+        __forceinline void append(const char * s, int l) {
+            if ( l ) memcpy(allocate(l), s, l);
+        }
+        __forceinline char * allocate (int l) {
+            if ( size + l > capacity ) grow(size + l);
+            char * res = data + size;
+            size += l;
+            return res;
+        }
+        void grow ( int newSize ) {
+            int newCapacity = das::max(capacity * 2, (newSize + 15) & ~15);
+            char * newData = (char *) das_aligned_alloc16(newCapacity);
+            memcpy(newData, data, size);
+            if ( data!=inlineData ) das_aligned_free16(data);
+            data = newData;
+            capacity = newCapacity;
+        }
+        virtual void output() {}
+    protected:
+        char *  data = inlineData;
+        int32_t size = 0;
+        int32_t capacity = DAS_INLINE_BUFFER_SIZE;
+        char    inlineData[DAS_INLINE_BUFFER_SIZE];
+    };
+
+    // number to text conversion without printf. output is exactly the same as of the printf format in the comment
+    // buffer has to fit the result, which is at most 64 characters. returns number of characters written
+    int das_fmt_int ( int64_t value, char * buf );                  // %lld
+    int das_fmt_uint ( uint64_t value, char * buf );                // %llu
+    int das_fmt_hex ( uint64_t value, char * buf );                 // %llx
+    int das_fmt_fixed ( double value, int precision, char * buf );  // %.*f, 0 if value is not supported (huge, denormal, nan or inf)
+    int das_fmt_general ( double value, char * buf );               // %g, 0 if value is not an integer below 1e6
+
     struct StringWriterTag {};
     extern StringWriterTag HEX;
     extern StringWriterTag DEC;
@@ -76,12 +127,37 @@ namespace das {
         StringWriter & write(const char * format, TT value) {
             char buf[128];
             int realL = snprintf(buf, sizeof(buf), format, value);
-            if ( auto at = this->allocate(realL) ) {
-                memcpy(at, buf, realL);
-                this->output();
+            if ( realL<0 ) return *this;
+            if ( realL<int(sizeof(buf)) ) {
+                if ( auto at = this->allocate(realL) ) {
+                    memcpy(at, buf, realL);
+                    this->output();
+                }
+            } else {
+                vector<char> big(realL + 1);
+                snprintf(big.data(), big.size(), format, value);
+                writeStr(big.data(), realL);
             }
             return *this;
         }
+        StringWriter & writeInt ( int64_t v ) {
+            char buf[32];
+            return writeStr(buf, das_fmt_int(v, buf));
+        }
+        StringWriter & writeUInt ( uint64_t v ) {
+            char buf[32];
+            return writeStr(buf, hex ? das_fmt_hex(v, buf) : das_fmt_uint(v, buf));
+        }
+        StringWriter & writeFloat ( double v, int precision ) {
+            char buf[64];
+            if ( fixed ) {
+                if ( int len = das_fmt_fixed(v, precision, buf) ) return writeStr(buf, len);
+                return write(precision==9 ? "%.9f" : "%.17f", v);
+            } else {
+                if ( int len = das_fmt_general(v, buf) ) return writeStr(buf, len);
+                return write("%g", v);
+            }
+        }
         StringWriter & writeStr(const char * st, size_t len) {
             this->append(st, int(len));
             this->output();
@@ -108,17 +184,17 @@ namespace das {
             else if (&v == &SCIENTIFIC) fixed = false;
             return *this;
         }
-        StringWriter & operator << (char v)                 { return write("%c", v); }
-        StringWriter & operator << (unsigned char v)        { return write("%c", v); }
+        StringWriter & operator << (char v)                 { return writeStr((const char *)&v, 1); }
+        StringWriter & operator << (unsigned char v)        { return writeStr((const char *)&v, 1); }
         StringWriter & operator << (bool v)                 { return write(v ? "true" : "false"); }
-        StringWriter & operator << (int v)                  { return write(hex ? "%x" : "%d", v); }
-        StringWriter & operator << (long v)                 { return write(hex ? "%lx" : "%ld", v); }
-        StringWriter & operator << (long long v)            { return write(hex ? "%llx" : "%lld", v); }
-        StringWriter & operator << (unsigned v)             { return write(hex ? "%x" : "%u", v); }
-        StringWriter & operator << (unsigned long v)        { return write(hex ? "%lx" : "%lu", v); }
-        StringWriter & operator << (unsigned long long v)   { return write(hex ? "%llx" : "%llu", v); }
-        StringWriter & operator << (float v)                { return write(fixed ? "%.9f" : "%g", v); }
-        StringWriter & operator << (double v)               { return write(fixed ? "%.17f" : "%g", v); }
+        StringWriter & operator << (int v)                  { return hex ? writeUInt((unsigned)v) : writeInt(v); }
+        StringWriter & operator << (long v)                 { return hex ? writeUInt((unsigned long)v) : writeInt(v); }
+        StringWriter & operator << (long long v)            { return hex ? writeUInt((unsigned long long)v) : writeInt(v); }
+        StringWriter & operator << (unsigned v)             { return writeUInt(v); }
+        StringWriter & operator << (unsigned long v)        { return writeUInt(v); }
+        StringWriter & operator << (unsigned long long v)   { return writeUInt(v); }
+        StringWriter & operator << (float v)                { return writeFloat(v, 9); }
+        StringWriter & operator << (double v)               { return writeFloat(v, 17); }
         StringWriter & operator << (char * v)               { return write(v ? (const char*)v : ""); }
         StringWriter & operator << (const char * v)         { return write(v ? v : ""); }
         StringWriter & operator << (const string & v)       { return v.length() ? writeStr(v.c_str(), v.length()) : *this; }
@@ -30,6 +30,17 @@ namespace das {
     void * getFunctionAddress ( void * module, const char * func );
     void * getLibraryHandle ( const char * moduleName );
 
+    // reserved address space, which is committed (and decommitted) page by page
+    size_t getVirtualMemoryPageSize ( void );
+    void * reserveVirtualMemory ( size_t size );
+    bool commitVirtualMemory ( void * ptr, size_t size );
+    void decommitVirtualMemory ( void * ptr, size_t size );
+    void releaseVirtualMemory ( void * ptr, size_t size );
+
+    // private (copy on write) mapping of the whole file. pages, which are never written to, are shared with the file cache
+    void * mapFileCopyOnWrite ( const char * fileName, size_t & size );
+    void unmapFile ( void * ptr, size_t size );
+
     void hwSetBreakpointHandler ( void (* handler ) ( int, void * ) );
     int hwBreakpointSet ( void * address, int len, int when );
     bool hwBreakpointClear ( int bp_index );
@@ -989,12 +989,22 @@ namespace das {
     template <typename TT>
     struct das_iterator;
 
+    // ranges, arrays and fixed arrays know the trip count up front. AOT emits a plain counted loop over them,
+    // which steps the loop variables with ++ and lets the C++ compiler vectorize it
+    __forceinline uint64_t das_loop_count ( uint64_t a, uint64_t b ) { return a < b ? a : b; }
+
     template <typename TT>
     struct das_iterator <const RangeType<TT>> {
         __forceinline das_iterator(const RangeType<TT> & r) : that(r) {}
         __forceinline bool first ( Context *, TT & i ) { i = that.from; return i < that.to; }
         __forceinline bool next  ( Context *, TT & i ) { i++; return i!=that.to; }
         __forceinline void close ( Context *, TT &   ) {}
+        // counted loop, see das_loop_count
+        __forceinline uint64_t loop_begin ( Context *, TT & i ) {
+            i = that.from;
+            return that.from < that.to ? uint64_t(that.to) - uint64_t(that.from) : 0;
+        }
+        __forceinline void loop_end ( Context *, TT & ) {}
         RangeType<TT> that;
     };
 
@@ -1048,6 +1058,18 @@ namespace das {
             context = nullptr;
             i = nullptr;
         }
+        template <typename QQ>
+        __forceinline uint64_t loop_begin(Context * __context__, QQ & i) {
+            context = __context__;
+            array_lock(*__context__, *that);
+            i = (QQ)that->data;
+            return that->size;
+        }
+        template <typename QQ>
+        __forceinline void loop_end(Context * __context__, QQ &) {
+            array_unlock(*__context__, *that);
+            context = nullptr;
+        }
         ~das_iterator() {
             TT * dummy = nullptr;
             if (context) close(context, dummy);
@@ -1081,6 +1103,18 @@ namespace das {
             context = nullptr;
             i = nullptr;
         }
+        template <typename QQ>
+        __forceinline uint64_t loop_begin ( Context * __context__, QQ & i ) {
+            context = __context__;
+            array_lock(*__context__, *(Array *)(that));
+            i = (QQ) that->data;
+            return that->size;
+        }
+        template <typename QQ>
+        __forceinline void loop_end ( Context * __context__, QQ & ) {
+            array_unlock(*__context__, *(Array *)(that));
+            context = nullptr;
+        }
         ~das_iterator() {
             const TT * dummy = nullptr;
             if (context) close(context, dummy);
@@ -1106,6 +1140,13 @@ namespace das {
         __forceinline void close ( Context *, TT * & i ) {
             i = nullptr;
         }
+        template <typename QQ>
+        __forceinline uint64_t loop_begin ( Context *, QQ & i ) {
+            i = (QQ) that->data;
+            return size;
+        }
+        template <typename QQ>
+        __forceinline void loop_end ( Context *, QQ & ) {}
         TDim<TT,size> * that;
         TT *            array_end;
     };
@@ -1126,6 +1167,13 @@ namespace das {
         __forceinline void close ( Context *, const TT * & i ) {
             i = nullptr;
         }
+        template <typename QQ>
+        __forceinline uint64_t loop_begin ( Context *, QQ & i ) {
+            i = (QQ) that->data;
+            return size;
+        }
+        template <typename QQ>
+        __forceinline void loop_end ( Context *, QQ & ) {}
         const TDim<TT,size> * that;
         const TT *            array_end;
     };
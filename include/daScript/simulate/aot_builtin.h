@@ -28,11 +28,21 @@ namespace das {
     int32_t heap_depth ( Context * context );
     uint64_t string_heap_bytes_allocated ( Context * context );
     int32_t string_heap_depth ( Context * context );
+    uint64_t stack_bytes_committed ( Context * context );
+    uint64_t stack_peak_bytes_committed ( Context * context );
+    uint64_t stack_segments_allocated ( Context * context );
     void string_heap_collect ( bool validate, Context * context, LineInfoArg * info );
     void string_heap_report ( Context * context, LineInfoArg * info );
     void heap_collect ( bool stringHeap, bool validate, Context * context, LineInfoArg * info );
     void heap_report ( Context * context, LineInfoArg * info );
     void memory_report ( bool errorsOnly, Context * context, LineInfoArg * info );
+    void allocation_profiler ( bool enable, int32_t sampleInterval, Context * context );
+    void allocation_profiler_report ( int32_t top, Context * context );
+    void allocation_profiler_sites ( const TBlock<void,const char *,int32_t,bool,uint64_t,uint64_t,uint64_t,uint64_t> & block,
+        Context * context, LineInfoArg * at );
+    void function_profiler ( bool enable, Context * context );
+    void function_profiler_report ( int32_t top, Context * context );
+    bool function_profiler_save ( const char * fileName, Context * context );
     void builtin_table_lock ( const Table & arr, Context * context );
     void builtin_table_unlock ( const Table & arr, Context * context );
     void builtin_table_clear_lock ( const Table & arr, Context * context );
@@ -2,6 +2,17 @@
 
 namespace das {
     struct FStat;
+    struct FileMap;
+    class AsyncFileIO;
+    struct AsyncFileResult;
+
+    struct DirWalkEntry {
+        char *      path;       // only valid inside the block
+        uint64_t    size;       // walk_stat or walk_hash
+        int64_t     mtime;      // walk_stat
+        uint64_t    hash;       // walk_hash, 64-bit fnv of the contents
+        bool        is_dir;
+    };
     class Context;
     struct Block;
     struct SimNode_CallBase;
@@ -20,11 +31,29 @@ namespace das {
     vec4f builtin_write ( Context &, SimNode_CallBase * call, vec4f * args );
     vec4f builtin_load ( Context & context, SimNode_CallBase *, vec4f * args );
     void builtin_map_file ( const FILE* _f, const TBlock<void, TTemporary<TArray<uint8_t>>>& blk, Context*, LineInfoArg * at );
+    const FileMap * builtin_fmap_open ( const char * name );
+    void builtin_fmap_close ( const FileMap * fm, Context * context, LineInfoArg * at );
+    uint64_t builtin_fmap_size ( const FileMap * fm, Context * context, LineInfoArg * at );
+    bool builtin_fmap_advise ( const FileMap * fm, int32_t advice, Context * context, LineInfoArg * at );
+    void builtin_fmap_view ( const FileMap * fm, uint64_t offset, uint64_t length, const TBlock<void,TTemporary<TArray<uint8_t>>> & blk, Context * context, LineInfoArg * at );
+    uint64_t builtin_fmap_lines ( const FileMap * fm, const TBlock<void,TTemporary<TArray<uint8_t>>> & blk, Context * context, LineInfoArg * at );
+    uint64_t builtin_fmap_records ( const FileMap * fm, int32_t delimiter, const TBlock<void,TTemporary<TArray<uint8_t>>> & blk, Context * context, LineInfoArg * at );
+    AsyncFileIO * builtin_async_io_create ( int32_t threads );
+    void builtin_async_io_destroy ( AsyncFileIO * io, Context * context, LineInfoArg * at );
+    uint64_t builtin_async_io_read ( AsyncFileIO * io, const char * name, Context * context, LineInfoArg * at );
+    uint64_t builtin_async_io_write ( AsyncFileIO * io, const char * name, const char * text, bool append, Context * context, LineInfoArg * at );
+    uint64_t builtin_async_io_write_bytes ( AsyncFileIO * io, const char * name, const TArray<uint8_t> & data, bool append, Context * context, LineInfoArg * at );
+    uint64_t builtin_async_io_stat ( AsyncFileIO * io, const char * name, Context * context, LineInfoArg * at );
+    int32_t builtin_async_io_submit ( AsyncFileIO * io, Context * context, LineInfoArg * at );
+    int32_t builtin_async_io_pending ( const AsyncFileIO * io, Context * context, LineInfoArg * at );
+    int32_t builtin_async_io_in_flight ( const AsyncFileIO * io, Context * context, LineInfoArg * at );
+    int32_t builtin_async_io_poll ( AsyncFileIO * io, int32_t timeoutMs, const TBlock<void,const AsyncFileResult,TTemporary<TArray<uint8_t>>> & blk, Context * context, LineInfoArg * at );
     char * builtin_dirname ( const char * name, Context * context, LineInfoArg * at );
     char * builtin_basename ( const char * name, Context * context, LineInfoArg * at );
     bool builtin_fstat ( const FILE * f, FStat & fs, Context * context, LineInfoArg * at );
     bool builtin_stat ( const char * filename, FStat & fs );
     void builtin_dir ( const char * path, const Block & fblk, Context * context, LineInfoArg * at );
+    uint64_t builtin_dir_walk ( const char * path, const char * pattern, uint32_t flags, int32_t batchSize, const TBlock<void,TTemporary<TArray<DirWalkEntry>>> & blk, Context * context, LineInfoArg * at );
     bool builtin_mkdir ( const char * path );
     const FILE * builtin_stdin();
     const FILE * builtin_stdout();
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "daScript/misc/job_que.h"
+#include "daScript/misc/fiber.h"
 #include "daScript/simulate/simulate.h"
 
 #include <queue>
@@ -45,10 +46,98 @@ namespace das {
         Context *           owner = nullptr;
     };
 
+    class CoroutineScheduler;
+
+    // native stack and script stack, which can host one coroutine at a time
+    // finished coroutines return their frames to the scheduler for reuse
+    struct CoroutineFrames {
+        CoroutineFrames ( uint32_t stackSize, uint32_t nativeStackSize );
+        ~CoroutineFrames();
+        Fiber *             fiber = nullptr;
+        StackAllocator      stack;
+        class Coroutine *   owner = nullptr;
+    };
+
+    // stackful coroutine. runs lambda on the same context, but with its own stack
+    // suspends anywhere in the call chain via coroutine_yield or await
+    class Coroutine {
+        friend class CoroutineScheduler;
+        friend struct CoroutineFrames;
+    public:
+        enum class Status : int32_t { created, suspended, running, finished, failed };
+        Coroutine ( Context * ctx, const Lambda & lmb, const LineInfo & at );
+        ~Coroutine();
+        Coroutine ( const Coroutine & ) = delete;
+        Coroutine & operator = ( const Coroutine & ) = delete;
+        bool resume ( LineInfoArg * at );       // returns true, if coroutine can be resumed again
+        void suspend ();
+        bool isFinished() const { return status==Status::finished || status==Status::failed; }
+        bool isSuspended() const { return status==Status::created || status==Status::suspended; }
+        static Coroutine * getCurrent() { return current; }
+    protected:
+        static void entry ( void * arg );
+        void swapRegisters();
+        void body();
+    protected:
+        Context *           context = nullptr;
+        Lambda              lambda;
+        LineInfo            at;
+        Status              status = Status::created;
+        CoroutineFrames *   frames = nullptr;
+        CoroutineScheduler * scheduler = nullptr;
+        Fiber *             caller = nullptr;
+        Coroutine *         prev = nullptr;
+        vec4f *             abiArg = nullptr;
+        vec4f *             abiThisBlockArg = nullptr;
+        void *              abiCMRES = nullptr;
+#if !DAS_ENABLE_EXCEPTIONS
+        jmp_buf *           throwBuf = nullptr;
+#endif
+        static DAS_THREAD_LOCAL Coroutine * current;
+    };
+
+    // multiplexes coroutines of one context. frames of finished coroutines are pooled,
+    // so memory is proportional to the number of suspended coroutines, not the total
+    class CoroutineScheduler {
+    public:
+        CoroutineScheduler ( Context * ctx, uint32_t stackSize, uint32_t nativeStackSize );
+        ~CoroutineScheduler();
+        Coroutine * spawn ( const Lambda & lambda, LineInfoArg * at );
+        int32_t step ( LineInfoArg * at );      // resumes each suspended coroutine once, returns how many are still alive
+        void run ( LineInfoArg * at );          // resumes until all coroutines are finished
+        int32_t size() const { return int32_t(alive.size()); }
+        int32_t pooled() const { return int32_t(pool.size()); }
+        int32_t suspended() const;              // how many alive coroutines were started, and are suspended midway
+        CoroutineFrames * acquireFrames();
+        void releaseFrames ( CoroutineFrames * frames );
+    protected:
+        Context *                   context = nullptr;
+        uint32_t                    stackSize = 0;
+        uint32_t                    nativeStackSize = 0;
+        vector<Coroutine *>         alive;
+        vector<Coroutine *>         done;
+        vector<CoroutineFrames *>   pool;
+    };
+
+    void withCoroutines ( const TBlock<void,CoroutineScheduler *> & block, Context * context, LineInfoArg * at );
+    void withCoroutinesEx ( int32_t stackSize, int32_t nativeStackSize, const TBlock<void,CoroutineScheduler *> & block, Context * context, LineInfoArg * at );
+    Coroutine * coroutineSpawn ( CoroutineScheduler * sched, TLambda<void> lambda, Context * context, LineInfoArg * at );
+    bool coroutineResume ( Coroutine * co, Context * context, LineInfoArg * at );
+    int32_t coroutineStep ( CoroutineScheduler * sched, Context * context, LineInfoArg * at );
+    void coroutineRun ( CoroutineScheduler * sched, Context * context, LineInfoArg * at );
+    void coroutineYield ( Context * context, LineInfoArg * at );
+    bool isInCoroutine ();
+    void awaitCoroutine ( Coroutine * co, Context * context, LineInfoArg * at );
+    void awaitJob ( JobStatus * status, Context * context, LineInfoArg * at );
+    void awaitChannel ( Channel * ch, Context * context, LineInfoArg * at );
+
     bool is_job_que_shutting_down();
     void new_job_invoke ( Lambda lambda, Func fn, int32_t lambdaSize, Context * context, LineInfoArg * lineinfo );
     void new_thread_invoke ( Lambda lambda, Func fn, int32_t lambdaSize, Context * context, LineInfoArg * lineinfo );
     void withJobQue ( const TBlock<void> & block, Context * context, LineInfoArg * lineInfo );
+    // job que of with_job_que, created by the first user and destroyed after the last one releases it
+    shared_ptr<JobQue> acquireJobQue();
+    void releaseJobQue ( shared_ptr<JobQue> & jq );
     int getTotalHwJobs( Context * context, LineInfoArg * at );
     int getTotalHwThreads ();
     void withJobStatus ( int32_t total, const TBlock<void,JobStatus *> & block, Context * context, LineInfoArg * lineInfo );
@@ -10,4 +10,14 @@ namespace das {
     bool server_is_connected ( smart_ptr_raw<Server> server, Context * context );
     bool server_send ( smart_ptr_raw<Server> server, uint8_t * data, int32_t size, Context * context );
     void server_tick ( smart_ptr_raw<Server> server, Context * context );
+    bool makeMultiServer ( const void * pClass, const StructInfo * info, Context * context );
+    bool multi_server_init ( smart_ptr_raw<MultiServer> server, int port, Context * context );
+    int32_t multi_server_connect ( smart_ptr_raw<MultiServer> server, const char * host, int port, Context * context );
+    bool multi_server_is_open ( smart_ptr_raw<MultiServer> server, Context * context );
+    int32_t multi_server_tick ( smart_ptr_raw<MultiServer> server, int32_t timeoutMs, Context * context );
+    bool multi_server_send ( smart_ptr_raw<MultiServer> server, int32_t id, uint8_t * data, int32_t size, Context * context );
+    void multi_server_flush ( smart_ptr_raw<MultiServer> server, Context * context );
+    void multi_server_close ( smart_ptr_raw<MultiServer> server, int32_t id, Context * context );
+    int32_t multi_server_connections ( smart_ptr_raw<MultiServer> server, Context * context );
+    int32_t multi_server_pooled_buffers ( smart_ptr_raw<MultiServer> server, Context * context );
 }
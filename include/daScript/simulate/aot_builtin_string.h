@@ -3,6 +3,18 @@
 #include "daScript/ast/ast_typefactory.h"
 
 namespace das {
+    // interned string. there is exactly one atom per distinct text for the lifetime of the process,
+    // so atoms compare by pointer, and tables keyed by StringAtom? never touch the characters
+    struct StringAtom {
+        uint64_t    hash;       // hash of the text, computed once, same as hash(text)
+        uint32_t    length;
+        char *      text;       // stored right after the atom, never null
+    };
+
+    const StringAtom * builtin_string_atom ( const char * str );
+    const StringAtom * builtin_find_string_atom ( const char * str );
+    uint64_t builtin_string_atom_count ();
+
     void delete_string ( char * & str, Context * context );
 
     char * builtin_build_string ( const TBlock<void,StringBuilderWriter> & block, Context * context, LineInfoArg * lineinfo );
@@ -19,5 +19,74 @@ namespace das {
 
     AotLibrary & getGlobalAotLibrary();
     void clearGlobalAotLibrary();
+
+    // AOT, which is compiled into a shared library and loaded at runtime
+    //  generated code is built with DAS_AOT_SHARED_LIBRARY defined, and registers with the library itself
+    //  the library exports DAS_AOT_LIBRARY_ENTRY and DAS_AOT_LIBRARY_VERSION_FN, which loadAotLibrary looks up
+    //  DAS_AOT_LIB in CMakeLists.txt builds one out of a script
+
+    #define DAS_AOT_LIBRARY_ENTRY       "das_aot_register_library"
+    #define DAS_AOT_LIBRARY_VERSION_FN  "das_aot_library_version"
+
+    // bump when generated AOT code stops being compatible with the runtime it was built against
+    #define DAS_AOT_LIBRARY_VERSION     1
+
+    // both sides of the library have to agree on every field
+    struct AotLibraryVersion {
+        uint32_t    version;            // DAS_AOT_LIBRARY_VERSION
+        uint32_t    fusion;             // DAS_FUSION
+        uint32_t    contextSize;        // sizeof(Context)
+        uint32_t    simFunctionSize;    // sizeof(SimFunction)
+        static AotLibraryVersion current() {
+            return { DAS_AOT_LIBRARY_VERSION, DAS_FUSION, uint32_t(sizeof(Context)), uint32_t(sizeof(SimFunction)) };
+        }
+    };
+
+    typedef void ( * AotLibraryEntry ) ( AotLibrary & );
+    typedef void ( * AotLibraryVersionFn ) ( AotLibraryVersion & );
+
+    bool loadAotLibrary ( const string & fileName, AotLibrary & lib, TextWriter & logs );
+}
+
+#ifdef DAS_AOT_SHARED_LIBRARY
+
+#if defined(_MSC_VER)
+#define DAS_AOT_LIBRARY_LOCAL
+#define DAS_AOT_LIBRARY_EXPORT  __declspec(dllexport)
+#else
+#define DAS_AOT_LIBRARY_LOCAL   __attribute__((visibility("hidden")))
+#define DAS_AOT_LIBRARY_EXPORT  __attribute__((visibility("default"),used))
+#endif
+
+namespace das {
+    // same as AotListBase, only the list is private to the shared library, and not the host
+    struct DAS_AOT_LIBRARY_LOCAL AotSharedListBase {
+        AotSharedListBase ( RegisterAotFunctions prfn ) {
+            tail = head();
+            head() = this;
+            regFn = prfn;
+        }
+        static AotSharedListBase * & head() {
+            static AotSharedListBase * list = nullptr;
+            return list;
+        }
+        static void registerAot ( AotLibrary & lib ) {
+            for ( auto it = head(); it; it = it->tail ) {
+                (*it->regFn)(lib);
+            }
+        }
+        AotSharedListBase * tail = nullptr;
+        RegisterAotFunctions regFn;
+    };
+}
+
+// every generated file brings the same inline entry points, linker keeps one of each
+extern "C" DAS_AOT_LIBRARY_EXPORT inline void das_aot_register_library ( das::AotLibrary & lib ) {
+    das::AotSharedListBase::registerAot(lib);
+}
+
+extern "C" DAS_AOT_LIBRARY_EXPORT inline void das_aot_library_version ( das::AotLibraryVersion & ver ) {
+    ver = das::AotLibraryVersion::current();
 }
 
+#endif
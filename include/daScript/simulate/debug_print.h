@@ -7,11 +7,11 @@
 
 namespace das {
 
-    class StringBuilderWriter : public StringWriter<VectorAllocationPolicy> {
+    class StringBuilderWriter : public StringWriter<InlineBufferPolicy> {
     public:
         StringBuilderWriter() { }
         __forceinline char * c_str() const {
-            return (char *) data.data();
+            return (char *) data;
         }
     };
 
@@ -3,6 +3,7 @@
 #include "daScript/misc/memory_model.h"
 #include "daScript/misc/fnv.h"
 #include "daScript/misc/callable.h"
+#include "daScript/misc/string_writer.h"
 
 namespace das {
 
@@ -14,16 +15,31 @@ namespace das {
         StackAllocator(uint32_t size) {
             stackSize = size;
             stack = stackSize ? (char*)das_aligned_alloc16(stackSize) : nullptr;
+            limit = stack;
             reset();
         }
 
         void strip () {
             if ( stack ) {
-                das_aligned_free16(stack);
+                if ( segmentSize ) {
+                    releaseReserved();
+                } else {
+                    das_aligned_free16(stack);
+                }
                 stack = nullptr;
             }
         }
 
+        // growable stack. address space for maxSize is reserved once, memory is committed in segments
+        // the stack stays contiguous, so offsets from the bottom (blocks, AOT) remain valid as it grows
+        void makeGrowable ( uint32_t segment, uint32_t maxSize );
+        void shrink();                                      // decommit segments below the one in use
+        __forceinline bool isGrowable() const { return segmentSize!=0; }
+        __forceinline uint32_t segment() const { return segmentSize; }
+        __forceinline uint64_t bytesCommitted() const { return segmentSize ? uint64_t(stack + stackSize - limit) : stackSize; }
+        __forceinline uint64_t peakBytesCommitted() const { return segmentSize ? peakCommitted : stackSize; }
+        __forceinline uint64_t segmentAllocations() const { return segmentsAllocated; }
+
         virtual ~StackAllocator() {
             strip();
         }
@@ -37,6 +53,10 @@ namespace das {
             evalTop = src.evalTop;
             stackTop = src.stackTop;
             stackSize = src.stackSize;
+            limit = src.limit;
+            segmentSize = src.segmentSize;
+            peakCommitted = src.peakCommitted;
+            segmentsAllocated = src.segmentsAllocated;
         }
 
         __forceinline uint32_t size() const {
@@ -53,7 +73,7 @@ namespace das {
 
         __forceinline bool push(uint32_t size, char * & EP, char * & SP ) {        // stack watermark
             DAS_ASSERTF(stack,"can't push on null stack");
-            if (stackTop - size < stack ) {
+            if (stackTop - size < limit && !grow(size) ) {
                 return false;
             }
             EP = evalTop;
@@ -81,7 +101,7 @@ namespace das {
 
         __forceinline bool push_invoke(uint32_t size, uint32_t et, char * & EP, char * & SP ) {
             DAS_ASSERTF(stack,"can't push on null stack");
-            if (stackTop - size < stack ) {
+            if (stackTop - size < limit && !grow(size) ) {
                 return false;
             }
             EP = evalTop;
@@ -117,11 +137,72 @@ namespace das {
         __forceinline bool is_stack_ptr ( char * p ) const {
             return (stack<=p) && (p<=(stack + stackSize));
         }
+    protected:
+        bool grow ( uint32_t size );
+        void releaseReserved();
     protected:
         char *      stack = nullptr;
         char *      evalTop = nullptr;
         char *      stackTop = nullptr;
         uint32_t    stackSize = 0;
+        char *      limit = nullptr;            // lowest committed address, same as stack for the fixed size stack
+        uint32_t    segmentSize = 0;            // 0 for the fixed size stack
+        uint64_t    peakCommitted = 0;
+        uint64_t    segmentsAllocated = 0;
+    };
+
+    struct FuncInfo;
+    class Context;
+    class AnyHeapAllocator;
+
+    // counts heap allocations per function (and per line, where the allocation site is marked)
+    // installed on the context heaps at runtime, costs a single check per allocation when off
+    // only every sampleInterval-th allocation (on average) is looked at and tracked, and stands for sampleInterval of them.
+    // the rest cost a counter decrement, so the profiled program allocates the same way it does without the profiler
+    class AllocationProfiler {
+    public:
+        struct Site {
+            FuncInfo *  func = nullptr;
+            LineInfo *  at = nullptr;
+            bool        strings = false;
+            uint64_t    count = 0;
+            uint64_t    bytes = 0;
+            uint64_t    liveCount = 0;
+            uint64_t    liveBytes = 0;
+        };
+        static constexpr uint32_t defaultSampleInterval = 64;
+        AllocationProfiler ( Context * ctx, uint32_t interval = defaultSampleInterval );
+        __forceinline void allocated ( AnyHeapAllocator * heap, char * ptr, uint32_t size, bool strings ) {
+            if ( --untilSample == 0 ) sampled(heap, ptr, size, strings);
+        }
+        void reallocated ( AnyHeapAllocator * heap, char * ptr, char * newPtr, uint32_t newSize, bool strings );
+        void freed ( char * ptr );
+        void located ( void * ptr, LineInfo * at );
+        void swept ( AnyHeapAllocator * heap );
+        void reset ( AnyHeapAllocator * heap );
+        void report ( TextWriter & tw, int32_t top ) const;
+        const vector<Site> & getSites() const { return sites; }
+        uint32_t getSampleInterval() const { return sampleInterval; }
+    protected:
+        void sampled ( AnyHeapAllocator * heap, char * ptr, uint32_t size, bool strings );
+        void track ( AnyHeapAllocator * heap, char * ptr, uint32_t size, uint32_t site, uint32_t weight );
+        uint32_t nextSample();
+        uint32_t getSite ( FuncInfo * func, LineInfo * at, bool strings );
+        FuncInfo * currentFunction() const;
+    protected:
+        struct LiveAllocation {
+            AnyHeapAllocator *  heap;
+            uint32_t            size;
+            uint32_t            site;
+            uint32_t            weight;     // how many allocations this sample stands for
+        };
+        Context *                               context = nullptr;
+        uint32_t                                sampleInterval = 1;
+        uint32_t                                untilSample = 1;
+        uint32_t                                seed = 0x2545F491u;
+        vector<Site>                            sites;
+        das_hash_map<uint64_t,uint32_t>         siteIndex;
+        das_hash_map<void *,LiveAllocation>     live;   // note: not char *, same as bigStuff
     };
 
     class AnyHeapAllocator : public ptr_ref_count {
@@ -142,16 +223,22 @@ namespace das {
         virtual void setInitialSize ( uint32_t size ) = 0;
         virtual int32_t getInitialSize() const = 0;
         virtual void setGrowFunction ( CustomGrowFunction && fun ) = 0;
+        // remember current state of the heap, so that it can be restored later at the same addresses
+        virtual bool snapshot() { return false; }
+        virtual bool restore() { return false; }
+        virtual void dropSnapshot() {}
     public:
 #if DAS_TRACK_ALLOCATIONS
-        virtual void mark_location ( void *, LineInfo * )  {}
+        virtual void mark_location ( void * ptr, LineInfo * at )  { if ( profiler ) profiler->located(ptr,at); }
         virtual  void mark_comment ( void *, const char * ) {}
 #else
-        __forceinline void mark_location ( void *, LineInfo * ) {}
+        __forceinline void mark_location ( void * ptr, LineInfo * at ) { if ( profiler ) profiler->located(ptr,at); }
         __forceinline void mark_comment ( void *, const char * ) {}
 #endif
     public:
         char * allocateName ( const string & name );
+    public:
+        AllocationProfiler * profiler = nullptr;
     };
 
     struct StrHashEntry {
@@ -197,24 +284,44 @@ namespace das {
     class PersistentHeapAllocator : public AnyHeapAllocator {
     public:
         PersistentHeapAllocator() {}
-        virtual char * allocate ( uint32_t size ) override { return model.allocate(size); }
-        virtual void free ( char * ptr, uint32_t size ) override { model.free(ptr,size); }
-        virtual char * reallocate ( char * ptr, uint32_t oldSize, uint32_t newSize ) override { return model.reallocate(ptr,oldSize,newSize); }
+        virtual char * allocate ( uint32_t size ) override {
+            auto ptr = model.allocate(size);
+            if ( profiler ) profiler->allocated(this,ptr,size,false);
+            return ptr;
+        }
+        virtual void free ( char * ptr, uint32_t size ) override {
+            if ( profiler ) profiler->freed(ptr);
+            model.free(ptr,size);
+        }
+        virtual char * reallocate ( char * ptr, uint32_t oldSize, uint32_t newSize ) override {
+            auto newPtr = model.reallocate(ptr,oldSize,newSize);
+            if ( profiler ) profiler->reallocated(this,ptr,newPtr,newSize,false);
+            return newPtr;
+        }
         virtual int depth() const override { return model.depth(); }
         virtual uint64_t bytesAllocated() const override { return model.bytesAllocated(); }
         virtual uint64_t totalAlignedMemoryAllocated() const override { return model.totalAlignedMemoryAllocated(); }
-        virtual void reset() override { model.reset(); }
+        virtual void reset() override {
+            if ( profiler ) profiler->reset(this);
+            model.reset();
+        }
         virtual void report() override;
         virtual bool mark() override;
         virtual void mark ( char * ptr, uint32_t size ) override;
-        virtual void sweep() override { model.sweep(); }
+        virtual void sweep() override {
+            model.sweep();
+            if ( profiler ) profiler->swept(this);
+        }
         virtual bool isOwnPtr ( char * ptr, uint32_t size ) override { return model.isOwnPtr(ptr,size); }
         virtual bool isValidPtr ( char * ptr, uint32_t size ) override { return model.isAllocatedPtr(ptr,size); }
         virtual void setInitialSize ( uint32_t size ) override { model.setInitialSize(size); }
         virtual int32_t getInitialSize() const override { return model.initialSize; }
         virtual void setGrowFunction ( CustomGrowFunction && fun ) override { model.customGrow = fun; };
 #if DAS_TRACK_ALLOCATIONS
-        virtual void mark_location ( void * ptr, LineInfo * at ) override  { model.mark_location(ptr,at); };
+        virtual void mark_location ( void * ptr, LineInfo * at ) override  {
+            model.mark_location(ptr,at);
+            if ( profiler ) profiler->located(ptr,at);
+        };
         virtual  void mark_comment ( void * ptr, const char * what ) override { model.mark_comment(ptr,what); };
 #endif
     protected:
@@ -224,13 +331,27 @@ namespace das {
     class LinearHeapAllocator : public AnyHeapAllocator {
     public:
         LinearHeapAllocator() {}
-        virtual char * allocate ( uint32_t size ) override { return model.allocate(size); }
-        virtual void free ( char * ptr, uint32_t size ) override { model.free(ptr,size); }
-        virtual char * reallocate ( char * ptr, uint32_t oldSize, uint32_t newSize ) override { return model.reallocate(ptr,oldSize,newSize); }
+        virtual char * allocate ( uint32_t size ) override {
+            auto ptr = model.allocate(size);
+            if ( profiler ) profiler->allocated(this,ptr,size,false);
+            return ptr;
+        }
+        virtual void free ( char * ptr, uint32_t size ) override {
+            if ( profiler ) profiler->freed(ptr);
+            model.free(ptr,size);
+        }
+        virtual char * reallocate ( char * ptr, uint32_t oldSize, uint32_t newSize ) override {
+            auto newPtr = model.reallocate(ptr,oldSize,newSize);
+            if ( profiler ) profiler->reallocated(this,ptr,newPtr,newSize,false);
+            return newPtr;
+        }
         virtual int depth() const override { return model.depth(); }
         virtual uint64_t bytesAllocated() const override { return model.bytesAllocated(); }
         virtual uint64_t totalAlignedMemoryAllocated() const override { return model.totalAlignedMemoryAllocated(); }
-        virtual void reset() override { model.reset(); }
+        virtual void reset() override {
+            if ( profiler ) profiler->reset(this);
+            model.reset();
+        }
         virtual void report() override;
         virtual bool mark() override { return false; }
         virtual void mark ( char *, uint32_t ) override { DAS_ASSERT(0 && "not supported"); }
@@ -240,8 +361,12 @@ namespace das {
         virtual void setInitialSize ( uint32_t size ) override { model.setInitialSize(size); }
         virtual int32_t getInitialSize() const override { return model.initialSize; }
         virtual void setGrowFunction ( CustomGrowFunction && fun ) override { model.customGrow = fun; };
+        virtual bool snapshot() override;
+        virtual bool restore() override;
+        virtual void dropSnapshot() override { snap.reset(); }
     protected:
         LinearChunkAllocator model;
+        unique_ptr<LinearChunkSnapshot> snap;
     };
 
 #if DAS_TRACK_ALLOCATIONS
@@ -266,13 +391,27 @@ namespace das {
     class PersistentStringAllocator : public StringHeapAllocator {
     public:
         PersistentStringAllocator() { model.alignMask = 3; }
-        virtual char * allocate ( uint32_t size ) override { return model.allocate(size); }
-        virtual void free ( char * ptr, uint32_t size ) override { model.free(ptr,size); }
-        virtual char * reallocate ( char * ptr, uint32_t oldSize, uint32_t newSize ) override { return model.reallocate(ptr,oldSize,newSize); }
+        virtual char * allocate ( uint32_t size ) override {
+            auto ptr = model.allocate(size);
+            if ( profiler ) profiler->allocated(this,ptr,size,true);
+            return ptr;
+        }
+        virtual void free ( char * ptr, uint32_t size ) override {
+            if ( profiler ) profiler->freed(ptr);
+            model.free(ptr,size);
+        }
+        virtual char * reallocate ( char * ptr, uint32_t oldSize, uint32_t newSize ) override {
+            auto newPtr = model.reallocate(ptr,oldSize,newSize);
+            if ( profiler ) profiler->reallocated(this,ptr,newPtr,newSize,true);
+            return newPtr;
+        }
         virtual int depth() const override { return model.depth(); }
         virtual uint64_t bytesAllocated() const override { return model.bytesAllocated(); }
         virtual uint64_t totalAlignedMemoryAllocated() const override { return model.totalAlignedMemoryAllocated(); }
-        virtual void reset() override { model.reset(); }
+        virtual void reset() override {
+            if ( profiler ) profiler->reset(this);
+            model.reset();
+        }
         virtual void forEachString ( const callable<void (const char *)> & fn ) override ;
         virtual void report() override;
         virtual bool mark() override;
@@ -284,7 +423,10 @@ namespace das {
         virtual int32_t getInitialSize() const override { return model.initialSize; }
         virtual void setGrowFunction ( CustomGrowFunction && fun ) override { model.customGrow = fun; };
 #if DAS_TRACK_ALLOCATIONS
-        virtual void mark_location ( void * ptr, LineInfo * at ) override { model.mark_location(ptr,at); };
+        virtual void mark_location ( void * ptr, LineInfo * at ) override {
+            model.mark_location(ptr,at);
+            if ( profiler ) profiler->located(ptr,at);
+        };
         virtual  void mark_comment ( void * ptr, const char * what ) override { model.mark_comment(ptr,what); };
 #endif
     protected:
@@ -294,13 +436,27 @@ namespace das {
     class LinearStringAllocator : public StringHeapAllocator {
     public:
         LinearStringAllocator() { model.alignMask = 3; }
-        virtual char * allocate ( uint32_t size ) override { return model.allocate(size); }
-        virtual void free ( char * ptr, uint32_t size ) override { model.free(ptr,size); }
-        virtual char * reallocate ( char * ptr, uint32_t oldSize, uint32_t newSize ) override { return model.reallocate(ptr,oldSize,newSize); }
+        virtual char * allocate ( uint32_t size ) override {
+            auto ptr = model.allocate(size);
+            if ( profiler ) profiler->allocated(this,ptr,size,true);
+            return ptr;
+        }
+        virtual void free ( char * ptr, uint32_t size ) override {
+            if ( profiler ) profiler->freed(ptr);
+            model.free(ptr,size);
+        }
+        virtual char * reallocate ( char * ptr, uint32_t oldSize, uint32_t newSize ) override {
+            auto newPtr = model.reallocate(ptr,oldSize,newSize);
+            if ( profiler ) profiler->reallocated(this,ptr,newPtr,newSize,true);
+            return newPtr;
+        }
         virtual int depth() const override { return model.depth(); }
         virtual uint64_t bytesAllocated() const override { return model.bytesAllocated(); }
         virtual uint64_t totalAlignedMemoryAllocated() const override { return model.totalAlignedMemoryAllocated(); }
-        virtual void reset() override { model.reset(); }
+        virtual void reset() override {
+            if ( profiler ) profiler->reset(this);
+            model.reset();
+        }
         virtual void forEachString ( const callable<void (const char *)> & fn ) override;
         virtual void report() override;
         virtual bool mark() override { return false; }
@@ -311,8 +467,13 @@ namespace das {
         virtual void setInitialSize ( uint32_t size ) override { model.setInitialSize(size); }
         virtual int32_t getInitialSize() const override { return model.initialSize; }
         virtual void setGrowFunction ( CustomGrowFunction && fun ) override { model.customGrow = fun; };
+        virtual bool snapshot() override;
+        virtual bool restore() override;
+        virtual void dropSnapshot() override;
     protected:
         LinearChunkAllocator model;
+        unique_ptr<LinearChunkSnapshot> snap;
+        das_string_set snapInternMap;
     };
 
     struct NodePrefix {
@@ -332,7 +493,7 @@ namespace das {
         bool prefixWithHeader = true;
         uint32_t totalNodesAllocated = 0;
     public:
-        NodeAllocator() {}
+        NodeAllocator() { zeroChunks = true; }    // simulated image stores code and debug info word by word
 
         /*
         * GCC really likes the version with separate if. CLANG \ MSVC strongly prefer the one bellow with __forceinline.
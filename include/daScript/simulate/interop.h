@@ -197,6 +197,7 @@ namespace das
             V_BEGIN();
             vis.op(extFnName);
             V_CALL();
+            V_FIELD(extFnName);
             V_END();
         }
     };
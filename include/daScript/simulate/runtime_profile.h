@@ -1,10 +1,41 @@
 #pragma once
 
 #include "daScript/simulate/simulate.h"
+#include "daScript/misc/performance_counters.h"
 
 namespace das
 {
+    template <typename TT> struct TArray;
+
+    // result of the single profile(count,category,block) call
+    struct ProfileResult {
+        const char *    category = nullptr;
+        int32_t         count = 0;
+        double          minT = 0.;          // seconds
+        double          medianT = 0.;
+        double          p99T = 0.;
+        uint64_t        heapBytes = 0;      // bytes allocated on the context heap, per run (max)
+        uint64_t        stringBytes = 0;    // bytes allocated on the context string heap, per run (max)
+        uint64_t        counters[int(PerfCounter::total)] = {};   // hardware counters, per run (average)
+        bool            countersAvailable[int(PerfCounter::total)] = {};
+    };
+
+    // receives every profile result on the current thread
+    class ProfileCollector {
+    public:
+        virtual ~ProfileCollector() {}
+        virtual void onProfile ( Context * context, const ProfileResult & res ) = 0;
+    };
+
+    // installs collector for the current thread, returns previous one
+    ProfileCollector * setProfileCollector ( ProfileCollector * collector );
+
     // profile(count,category,block) -> float time in sec
     float builtin_profile ( int32_t count, const char * category, const Block & block, Context * context, LineInfoArg * at );
+
+    // profile_counters(count,category,counters,block) -> float time in sec
+    // counters are cycles, instructions, branch misses, L1D misses, LLC misses per run, -1 if not available
+    float builtin_profile_counters ( int32_t count, const char * category, TArray<int64_t> & counters,
+        const Block & block, Context * context, LineInfoArg * at );
 }
 
@@ -105,7 +105,9 @@ namespace das
         virtual bool rtti_node_isBlock() const { return false; }
         virtual bool rtti_node_isInstrument() const { return false; }
         virtual bool rtti_node_isInstrumentFunction() const { return false; }
+        virtual bool rtti_node_isProfileFunction() const { return false; }
         virtual bool rtti_node_isJit() const { return false; }
+        virtual bool rtti_node_isTailCallLoop() const { return false; }
     protected:
         virtual ~SimNode() {}
     };
@@ -139,6 +141,7 @@ namespace das
     ,   stopForContinue     = 1 << 2
     ,   jumpToLabel         = 1 << 3
     ,   yield               = 1 << 4
+    ,   tailCall            = 1 << 5
     };
 
 #define DAS_PROCESS_LOOP_FLAGS(howtocontinue) \
@@ -192,8 +195,28 @@ namespace das
         virtual void sub ( SimNode ** nodes, uint32_t count, const char * );
         virtual SimNode * sub ( SimNode * node, const char * /* opN */ = "subexpr" ) { return node->visit(*this); }
         virtual SimNode * visit ( SimNode * node ) { return node; }
+        // address of the pointer field of the node, i.e. for the image, which patches those when loaded
+        virtual void field ( void * /* at */, const char * /* name */ ) { }
+        virtual void field ( TypeInfo ** at, const char * name ) { field((void *)at, name); }
+        virtual void field ( FuncInfo ** at, const char * name ) { field((void *)at, name); }
     };
 
+    template <typename TT>
+    __forceinline void visitArg ( SimVisitor & vis, const TT & value, const char * name ) {
+        vis.arg(value, name);
+    }
+
+    template <typename TT>
+    __forceinline void visitArg ( SimVisitor & vis, TT * & ptr, const char * name ) {
+        vis.arg(ptr, name);
+        vis.field(&ptr, name);
+    }
+
+    __forceinline void visitSub ( SimVisitor & vis, SimNode * & node, const char * name ) {
+        node = vis.sub(node, name);
+        vis.field(&node, name);
+    }
+
     void printSimNode ( TextWriter & ss, Context * context, SimNode * node, bool debugHash=false );
     class Function;
     void printSimFunction ( TextWriter & ss, Context * context, Function * fun, SimNode * node, bool debugHash=false );
@@ -240,6 +263,36 @@ namespace das
 
     typedef shared_ptr<Context> ContextPtr;
 
+    // counts calls, self and total time of each interpreted SimFunction
+    // installed by wrapping function code at runtime, costs nothing when off
+    // saved profile is keyed by mangled name, which is what daScript -aot -profile reads back
+    class FunctionProfiler {
+    public:
+        struct Entry {
+            uint64_t    calls = 0;
+            int64_t     selfTicks = 0;
+            int64_t     totalTicks = 0;
+        };
+        typedef das_hash_map<string,Entry> Profile;
+        FunctionProfiler ( Context * ctx );
+        void enter ( SimFunction * fn );
+        void leave ( SimFunction * fn );
+        void report ( TextWriter & tw, int32_t top ) const;
+        void collect ( Profile & profile ) const;
+        bool save ( const string & fileName ) const;
+        static bool load ( const string & fileName, Profile & profile, TextWriter & logs );
+        const vector<Entry> & getEntries() const { return entries; }
+    protected:
+        struct Frame {
+            int32_t     index;
+            int64_t     start;
+            int64_t     children;
+        };
+        Context *           context = nullptr;
+        vector<Entry>       entries;
+        vector<Frame>       frames;
+    };
+
     class Context : public ptr_ref_count, public enable_shared_from_this<Context> {
         template <typename TT> friend struct SimNode_GetGlobalR2V;
         friend struct SimNode_GetGlobal;
@@ -249,6 +302,7 @@ namespace das
         friend struct SimNode_FuncConstValue;
         friend class Program;
         friend class Module;
+        friend class FunctionProfiler;
     public:
         Context(uint32_t stackSize = 16*1024, bool ph = false);
         Context(const Context &, uint32_t category_);
@@ -298,8 +352,35 @@ namespace das
             DAS_ASSERTF(insideContext==0,"can't reset heaps in locked context");
             heap->reset();
             stringHeap->reset();
+            stack.shrink();
         }
 
+        // snapshot of the initialized context, i.e. globals and heaps
+        // restoring rewinds them in place, so that every request starts from the same state without running init again
+        // both copy all of the globals and the used part of every heap chunk, i.e. cost is O(heap), not O(pages touched)
+        // persistent heaps (policies.persistent_heap) can't be rewound, snapshot of such context fails with an error
+        // shared globals are not part of the snapshot
+        bool takeSnapshot ( string & errors );
+        bool restoreSnapshot();
+        void dropSnapshot();
+        __forceinline bool hasSnapshot() const { return snapshotTaken; }
+
+        // relocatable image of the simulated context, i.e. code, constant strings, debug info and global layout
+        // loading the image into the new context replaces simulation, and then runs the init script
+        // image is only valid for the same executable, with the same modules and shared libraries loaded
+        // loadImage copies the image into the new chunks. loadImageFile maps the file copy on write, and uses it in place:
+        // constant strings stay shared with the file cache, while pages with the relocated pointers (i.e. node trees and most
+        // of the debug info) become private copies once patched, unless their targets are at the same addresses as when saved
+        bool saveImage ( vector<char> & image, string & errors ) const;
+        bool loadImage ( const char * image, size_t imageSize, string & errors );
+        bool loadImageFile ( const string & fileName, string & errors );
+
+        // code, constant strings and debug info are placed in the region, instead of the heap
+        // has to be set before simulation (or image load); clones share the region along with the code
+        // pages of the reserved region are only shared with the processes forked after the simulation.
+        // between unrelated processes loadImageFile shares constant strings, but not the node trees
+        void setChunkRegion ( const ChunkRegionPtr & region );
+
         __forceinline uint32_t tryRestartAndLock() {
             if (insideContext == 0) {
                 restart();
@@ -586,6 +667,10 @@ namespace das
         void collectStringHeap(LineInfo * at, bool validate);
         void collectHeap(LineInfo * at, bool stringHeap, bool validate);
         void reportAnyHeap(LineInfo * at, bool sth, bool rgh, bool rghOnly, bool errorsOnly);
+        void setAllocationProfiler ( bool enable, uint32_t sampleInterval = AllocationProfiler::defaultSampleInterval );
+        AllocationProfiler * getAllocationProfiler() const { return allocationProfiler.get(); }
+        void setFunctionProfiler ( bool enable );
+        FunctionProfiler * getFunctionProfiler() const { return functionProfiler.get(); }
         void instrumentFunction ( SimFunction * , bool isInstrumenting );
         void instrumentContextNode ( const Block & blk, bool isInstrumenting, Context * context, LineInfo * line );
         void clearInstruments();
@@ -629,6 +714,8 @@ namespace das
         uint64_t *                      annotationData = nullptr;
         smart_ptr<StringHeapAllocator>  stringHeap;
         smart_ptr<AnyHeapAllocator>     heap;
+        unique_ptr<AllocationProfiler>  allocationProfiler;
+        unique_ptr<FunctionProfiler>    functionProfiler;
         bool                            persistent = false;
         char *                          globals = nullptr;
         char *                          shared = nullptr;
@@ -667,6 +754,10 @@ namespace das
         int totalVariables = 0;
         int totalFunctions = 0;
         SimNode * aotInitScript = nullptr;
+        vector<char> globalsSnapshot;
+        bool snapshotTaken = false;
+        vector<FileInfoPtr> imageFiles;
+        bool loadImageData ( const char * image, size_t imageSize, const ChunkRegionPtr & mapping, string & errors );
     protected:
         bool            debugger = false;
         volatile bool   singleStepMode = false;
@@ -683,6 +774,7 @@ namespace das
     public:
         uint32_t stopFlags = 0;
         uint32_t gotoLabel = 0;
+        const SimFunction * tailCallTarget = nullptr;
         vec4f result;
     public:
 #if DAS_ENABLE_SMART_PTR_TRACKING
@@ -772,6 +772,90 @@ SIM_NODE_AT_VECTOR(Float, float)
 #undef  EVAL_NODE
     };
 
+    // FUNCTION PROFILER, installed by Context::setFunctionProfiler
+    struct SimNode_ProfileFunction : SimNode {
+        SimNode_ProfileFunction ( const LineInfo & at, SimFunction * simF, SimNode * se )
+            : SimNode(at), func(simF), subexpr(se) {}
+        virtual bool rtti_node_isProfileFunction() const override { return true; }
+        virtual SimNode * visit ( SimVisitor & vis ) override;
+        virtual vec4f eval ( Context & context ) override {
+            DAS_PROFILE_NODE
+            context.functionProfiler->enter(func);
+            auto res = subexpr->eval(context);
+            context.functionProfiler->leave(func);
+            return res;
+        }
+#define EVAL_NODE(TYPE,CTYPE) \
+        virtual CTYPE eval##TYPE ( Context & context ) override { \
+                DAS_PROFILE_NODE \
+                context.functionProfiler->enter(func); \
+                auto res = subexpr->eval##TYPE(context); \
+                context.functionProfiler->leave(func); \
+                return res; \
+            }
+        DAS_EVAL_NODE
+#undef EVAL_NODE
+        SimFunction *   func;
+        SimNode *       subexpr;
+    };
+
+    // TAIL CALL
+    //  return f(...) where f is the same function, or a function with the same stack frame
+    //  arguments are rewritten in place, and SimNode_TailCallLoop of the calling function jumps to f
+
+    struct SimNode_TailCall : SimNode_CallBase {
+        SimNode_TailCall ( const LineInfo & at ) : SimNode_CallBase(at) {}
+        virtual SimNode * visit ( SimVisitor & vis ) override;
+        virtual vec4f eval ( Context & context ) override {
+            DAS_PROFILE_NODE
+            vec4f argValues[32];
+            evalArgs(context, argValues);
+            for ( int32_t i=0; i!=nArguments; ++i ) {
+                context.abiArg[i] = argValues[i];
+            }
+            context.tailCallTarget = fnPtr;
+            context.stopFlags |= EvalFlags::stopForReturn | EvalFlags::tailCall;
+            return v_zero();
+        }
+    };
+
+    struct SimNode_TailCallLoop : SimNode {
+        SimNode_TailCallLoop ( const LineInfo & at, SimNode * b ) : SimNode(at), body(b) {}
+        virtual SimNode * visit ( SimVisitor & vis ) override;
+        virtual bool rtti_node_isTailCallLoop() const override { return true; }
+        __forceinline SimNode * next ( Context & context ) const {
+            context.stopFlags &= ~(EvalFlags::stopForReturn | EvalFlags::tailCall);
+            auto fn = context.tailCallTarget;
+#if DAS_ENABLE_STACK_WALK
+            if ( !fn->fastcall ) {
+                ((Prologue *)context.stack.sp())->info = fn->debugInfo;
+            }
+#endif
+            auto code = fn->code;
+            // profiled function is entered once, the jumps which follow are its own time
+            if ( code->rtti_node_isProfileFunction() ) code = ((SimNode_ProfileFunction *)code)->subexpr;
+            return code->rtti_node_isTailCallLoop() ? ((SimNode_TailCallLoop *)code)->body : code;
+        }
+        virtual vec4f eval ( Context & context ) override {
+            DAS_PROFILE_NODE
+            for ( auto code = body; ; code = next(context) ) {
+                auto res = code->eval(context);
+                if ( !(context.stopFlags & EvalFlags::tailCall) ) return res;
+            }
+        }
+#define EVAL_NODE(TYPE,CTYPE)\
+        virtual CTYPE eval##TYPE ( Context & context ) override {           \
+            DAS_PROFILE_NODE                                                \
+            for ( auto code = body; ; code = next(context) ) {              \
+                auto res = EvalTT<CTYPE>::eval(context, code);              \
+                if ( !(context.stopFlags & EvalFlags::tailCall) ) return res; \
+            }                                                               \
+        }
+        DAS_EVAL_NODE
+#undef  EVAL_NODE
+        SimNode * body;
+    };
+
     // FUNCTION CALL with copy-or-move-on-return
 
     struct SimNode_CallAndCopyOrMoveAny : SimNode_CallBase {
@@ -1223,6 +1307,13 @@ SIM_NODE_AT_VECTOR(Float, float)
     };
 
     // LEXICAL CAST
+    // same text as to_string, without the temporary string. 0 means value needs to_string after all
+    __forceinline int lexical_cast_chars ( int32_t value, char * buf ) { return das_fmt_int(value, buf); }
+    __forceinline int lexical_cast_chars ( uint32_t value, char * buf ) { return das_fmt_uint(value, buf); }
+    __forceinline int lexical_cast_chars ( int64_t value, char * buf ) { return das_fmt_int(value, buf); }
+    __forceinline int lexical_cast_chars ( uint64_t value, char * buf ) { return das_fmt_uint(value, buf); }
+    __forceinline int lexical_cast_chars ( float value, char * buf ) { return das_fmt_fixed(value, 6, buf); }
+
     template <typename CastFrom>
     struct SimNode_LexicalCast : SimNode_CallBase {
         SimNode_LexicalCast ( const LineInfo & at ) : SimNode_CallBase(at) {}
@@ -1230,8 +1321,14 @@ SIM_NODE_AT_VECTOR(Float, float)
         virtual vec4f eval ( Context & context ) override {
             DAS_PROFILE_NODE
             vec4f res = arguments[0]->eval(context);
-            auto str = to_string ( cast<CastFrom>::to(res) );
-            auto cpy = context.stringHeap->allocateString(str);
+            auto value = cast<CastFrom>::to(res);
+            char buf[64];
+            char * cpy;
+            if ( int len = lexical_cast_chars(value, buf) ) {
+                cpy = context.stringHeap->allocateString(buf, uint32_t(len));
+            } else {
+                cpy = context.stringHeap->allocateString(to_string(value));
+            }
             if ( !cpy ) {
                 context.throw_error_at(debugInfo,"can't cast to string, out of heap");
                 return v_zero();
@@ -67,6 +67,7 @@ namespace das {
         string opName = string("Cast_to_") + typeName<CastTo>::name();
         vis.op(opName.c_str(), sizeof(CastFrom), typeName<CastFrom>::name());
         V_SUB(arguments[0]);
+        V_FIELD(arguments);
         V_END();
     }
 
@@ -74,7 +75,7 @@ namespace das {
     SimNode * SimNode_LexicalCast<TT>::visit ( SimVisitor & vis ) {
         V_BEGIN();
         V_OP_TT(LexicalCast);
-        V_SUB(arguments[0]);
+        V_CALL();
         V_END();
     }
 
@@ -7,11 +7,12 @@
 #define V_OP_TT(x)          vis.op(#x, sizeof(TT), typeName<TT>::name());
 #define V_SP(x)             vis.sp(x);
 #define V_SP_EX(x)          vis.sp(x,#x);
-#define V_ARG(x)            vis.arg(x,#x);
-#define V_SUB(x)            x = vis.sub(x,#x);
-#define V_ARG_THIS(x)       vis.arg(this->x,#x);
-#define V_SUB_THIS(x)       this->x = vis.sub(this->x,#x);
-#define V_SUB_OPT(x)        x = x ? vis.sub(x,#x) : nullptr;
+#define V_ARG(x)            visitArg(vis,x,#x);
+#define V_SUB(x)            visitSub(vis,x,#x);
+#define V_ARG_THIS(x)       visitArg(vis,this->x,#x);
+#define V_SUB_THIS(x)       visitSub(vis,this->x,#x);
+#define V_SUB_OPT(x)        if ( x ) visitSub(vis,x,#x);
+#define V_FIELD(x)          vis.field(&x,#x);
 #define V_CALL()            visitCall(vis);
 #define V_FINAL()           visitFinal(vis);
 #define V_BLOCK()           visitBlock(vis);
@@ -8,6 +8,7 @@
 #undef V_ARG
 #undef V_SUB
 #undef V_SUB_OPT
+#undef V_FIELD
 #undef V_CALL
 #undef V_FINAL
 #undef V_BLOCK
@@ -2,6 +2,7 @@
 
 #include "daScript/ast/ast.h"
 #include "daScript/ast/ast_visitor.h"
+#include "daScript/misc/sysos.h"
 
 namespace das {
 
@@ -64,6 +65,39 @@ namespace das {
         g_AOT_lib.reset();
     }
 
+    // shared aot library
+
+    bool loadAotLibrary ( const string & fileName, AotLibrary & lib, TextWriter & logs ) {
+        // note: library is never unloaded, factories and aot functions live in it
+        auto handle = loadDynamicLibrary(fileName.c_str());
+        if ( !handle ) {
+            logs << "can't load AOT library " << fileName << "\n";
+            return false;
+        }
+        auto versionFn = (AotLibraryVersionFn) getFunctionAddress(handle, DAS_AOT_LIBRARY_VERSION_FN);
+        auto entryFn = (AotLibraryEntry) getFunctionAddress(handle, DAS_AOT_LIBRARY_ENTRY);
+        if ( !versionFn || !entryFn ) {
+            logs << fileName << " is not an AOT library, " << DAS_AOT_LIBRARY_ENTRY << " is missing\n";
+            return false;
+        }
+        AotLibraryVersion ver;
+        memset(&ver, 0, sizeof(ver));
+        (*versionFn)(ver);
+        auto cur = AotLibraryVersion::current();
+        if ( ver.version!=cur.version ) {
+            logs << "AOT library " << fileName << " is version " << ver.version << ", expecting " << cur.version << "\n";
+            return false;
+        }
+        if ( ver.fusion!=cur.fusion || ver.contextSize!=cur.contextSize || ver.simFunctionSize!=cur.simFunctionSize ) {
+            logs << "AOT library " << fileName << " is built with a different runtime configuration ("
+                << "fusion " << ver.fusion << ", Context " << ver.contextSize << " bytes, SimFunction " << ver.simFunctionSize << " bytes), expecting ("
+                << "fusion " << cur.fusion << ", Context " << cur.contextSize << " bytes, SimFunction " << cur.simFunctionSize << " bytes)\n";
+            return false;
+        }
+        (*entryFn)(lib);
+        return true;
+    }
+
     // annotations
 
     string Annotation::getMangledName() const {
@@ -2560,6 +2594,10 @@ namespace das {
         return options.getIntOption("stack", policies.stack);
     }
 
+    int Program::getContextMaxStackSize() const {
+        return options.getIntOption("max_stack", policies.max_stack);
+    }
+
     vector<EnumerationPtr> Program::findEnum ( const string & name ) const {
         return library.findEnum(name,thisModule.get());
     }
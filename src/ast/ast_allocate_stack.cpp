@@ -551,6 +551,110 @@ namespace das {
 
     // program
 
+    // return f(...), or return cond ? a : f(...), where f is the same function or has the same stack frame,
+    // becomes in-place argument rewrite and jump. arguments are values and result is workhorse, so nothing
+    // on the stack of the caller outlives the call. pointers could point into the frame, which the callee
+    // reuses, so there are no pointer arguments, and no address of anything is taken in the caller.
+    // finally sections, try-recover and iterator loops need the frame of the caller after the call,
+    // so functions with those are left alone
+    class TailCallMarker : public Visitor {
+    public:
+        TailCallMarker( const ProgramPtr & prog, TextWriter & ls ) : logs(ls) {
+            program = prog;
+            log = program->options.getBoolOption("log_stack");
+        }
+    protected:
+        ProgramPtr              program;
+        TextWriter &            logs;
+        Function *              func = nullptr;
+        vector<ExprCall *>      calls;
+        int32_t                 forDepth = 0;
+        bool                    blocked = false;
+        bool                    log = false;
+    protected:
+        static bool canTailCall ( Function * fn ) {
+            if ( fn->builtIn || fn->generator || fn->copyOnReturn || fn->moveOnReturn ) return false;
+            if ( fn->result->isRef() || fn->result->isRefType() ) return false;
+            if ( fn->arguments.size() > 32 ) return false;
+            for ( auto & arg : fn->arguments ) {
+                if ( arg->type->isRef() || arg->type->isRefType() || arg->type->isPointer() || arg->type->baseType==Type::tBlock ) return false;
+            }
+            return true;
+        }
+        bool isTailCall ( ExprCall * call ) const {
+            auto fn = call->func;
+            if ( !fn || !canTailCall(fn) ) return false;
+            if ( fn == func ) return true;
+            return fn->totalStackSize==func->totalStackSize && fn->fastCall==func->fastCall
+                && fn->arguments.size()==func->arguments.size();
+        }
+        void collect ( Expression * expr ) {
+            if ( expr->rtti_isCall() ) {
+                auto call = static_cast<ExprCall *>(expr);
+                if ( isTailCall(call) ) calls.push_back(call);
+            } else if ( expr->rtti_isOp3() ) {
+                auto op3 = static_cast<ExprOp3 *>(expr);
+                collect(op3->left.get());
+                collect(op3->right.get());
+            }
+        }
+    // function
+        virtual void preVisit ( Function * f ) override {
+            Visitor::preVisit(f);
+            func = f;
+            func->hasTailCall = false;
+            blocked = !canTailCall(func);
+        }
+        virtual FunctionPtr visit ( Function * that ) override {
+            if ( !blocked && calls.size() ) {
+                for ( auto call : calls ) {
+                    call->tailCall = true;
+                    if ( log ) {
+                        logs << "tail call " << func->getMangledName() << " -> " << call->func->getMangledName()
+                            << ", line " << call->at.line << "\n";
+                    }
+                }
+                func->hasTailCall = true;
+            }
+            calls.clear();
+            forDepth = 0;
+            func = nullptr;
+            return Visitor::visit(that);
+        }
+    // blockers
+        virtual void preVisit ( ExprBlock * block ) override {
+            Visitor::preVisit(block);
+            if ( block->finalList.size() ) blocked = true;
+        }
+        virtual void preVisit ( ExprTryCatch * expr ) override {
+            Visitor::preVisit(expr);
+            blocked = true;
+        }
+        virtual void preVisit ( ExprRef2Ptr * expr ) override {
+            Visitor::preVisit(expr);
+            blocked = true;
+        }
+        virtual void preVisit ( ExprFor * expr ) override {
+            Visitor::preVisit(expr);
+            forDepth ++;
+        }
+        virtual ExpressionPtr visit ( ExprFor * expr ) override {
+            forDepth --;
+            return Visitor::visit(expr);
+        }
+    // calls
+        virtual void preVisit ( ExprCall * call ) override {
+            Visitor::preVisit(call);
+            call->tailCall = false;
+        }
+        virtual void preVisit ( ExprReturn * expr ) override {
+            Visitor::preVisit(expr);
+            if ( func && !forDepth && expr->subexpr && !expr->returnInBlock && !expr->returnReference ) {
+                collect(expr->subexpr.get());
+            }
+        }
+    };
+
     void Program::allocateStack(TextWriter & logs) {
         // string heap
         AllocateConstString vstr;
@@ -602,6 +706,11 @@ namespace das {
                 }
             }
         }
+        // tail calls need final stack sizes
+        if ( !getDebugger() && options.getBoolOption("tail_calls", true) ) {
+            TailCallMarker tcm(this, logs);
+            visit(tcm);
+        }
         if ( log ) {
             logs << "VARIABLE TABLE:\n";
         }
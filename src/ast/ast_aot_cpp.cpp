@@ -892,6 +892,67 @@ namespace das {
         return ss.str();
     }
 
+    // variables, which are referenced from inside a closure or an unsafe expression (or anywhere, when 'anywhere' is set),
+    // from the initializer of a local reference (var b & = a), or whose address is taken
+    // pointers into those can't be proven to be the only way to reach their data
+    class AotAliasCollector : public Visitor {
+    public:
+        AotAliasCollector ( bool any ) : anywhere(any) {}
+        das_hash_set<const Variable *> aliased;
+    protected:
+        bool anywhere = false;
+        int  depth = 0;
+        virtual void preVisit ( ExprMakeBlock * expr ) override { Visitor::preVisit(expr); depth ++; }
+        virtual ExpressionPtr visit ( ExprMakeBlock * expr ) override { depth --; return Visitor::visit(expr); }
+        virtual void preVisit ( ExprUnsafe * expr ) override { Visitor::preVisit(expr); depth ++; }
+        virtual ExpressionPtr visit ( ExprUnsafe * expr ) override { depth --; return Visitor::visit(expr); }
+        virtual void preVisit ( ExprRef2Ptr * expr ) override { Visitor::preVisit(expr); depth ++; }
+        virtual ExpressionPtr visit ( ExprRef2Ptr * expr ) override { depth --; return Visitor::visit(expr); }
+        virtual void preVisitLetInit ( ExprLet * let, const VariablePtr & var, Expression * init ) override {
+            Visitor::preVisitLetInit(let, var, init);
+            if ( var->type->ref ) depth ++;
+        }
+        virtual ExpressionPtr visitLetInit ( ExprLet * let, const VariablePtr & var, Expression * init ) override {
+            if ( var->type->ref ) depth --;
+            return Visitor::visitLetInit(let, var, init);
+        }
+        virtual void preVisit ( ExprVar * expr ) override {
+            Visitor::preVisit(expr);
+            if ( anywhere || depth ) aliased.insert(expr->variable.get());
+        }
+    };
+
+    // return f(...), or return cond ? a : f(...), of the function itself, which was marked as tail call,
+    // is emitted as statements - if-else for the ternaries, argument rewrite and goto for the call
+    // tail calls to other functions are left to the c++ compiler
+    static bool collectAotTailCalls ( Function * fn, Expression * expr, das_hash_set<Expression *> & stmt ) {
+        if ( expr->rtti_isCall() ) {
+            auto call = static_cast<ExprCall *>(expr);
+            if ( !call->tailCall || call->func!=fn ) return false;
+        } else if ( expr->rtti_isOp3() ) {
+            auto op3 = static_cast<ExprOp3 *>(expr);
+            bool l = collectAotTailCalls(fn, op3->left.get(), stmt);
+            bool r = collectAotTailCalls(fn, op3->right.get(), stmt);
+            if ( !l && !r ) return false;
+        } else {
+            return false;
+        }
+        stmt.insert(expr);
+        return true;
+    }
+
+    class AotTailCallCollector : public Visitor {
+    public:
+        AotTailCallCollector ( Function * fn ) : func(fn) {}
+        das_hash_set<Expression *> stmt;
+    protected:
+        Function * func = nullptr;
+        virtual void preVisit ( ExprReturn * expr ) override {
+            Visitor::preVisit(expr);
+            if ( expr->subexpr ) collectAotTailCalls(func, expr->subexpr.get(), stmt);
+        }
+    };
+
     class CppAot : public Visitor {
     public:
         CppAot ( const ProgramPtr & prog, BlockVariableCollector & cl ) : program(prog), collector(cl) {
@@ -914,6 +975,11 @@ namespace das {
         das_set<string>       aotPrefix;
         vector<ExprBlock *>         scopes;
         bool                        prologue = false;
+        Function *                  thisFunc = nullptr;
+        das_hash_set<const Variable *> funcAliased;
+        das_hash_map<ExprFor *,uint64_t> countedFor;     // counted loop -> mask of sources, which can be __restrict
+        das_hash_set<Expression *>  tailStmt;                   // tail calls and ternaries around them, emitted as statements
+        bool                        tailCallLabel = false;      // __tail_call label goes to the top of the function body
     protected:
         void newLine () {
             auto nlPos = ss.tellp();
@@ -1090,6 +1156,20 @@ namespace das {
         }
         virtual void preVisit ( Function * fn) override {
             Visitor::preVisit(fn);
+            thisFunc = fn;
+            funcAliased.clear();
+            if ( fn->body ) {
+                AotAliasCollector aliases(false);
+                fn->body->visit(aliases);
+                funcAliased = move(aliases.aliased);
+                tailStmt.clear();
+                if ( fn->hasTailCall ) {
+                    AotTailCallCollector tails(fn);
+                    fn->body->visit(tails);
+                    tailStmt = move(tails.stmt);
+                    tailCallLabel = !tailStmt.empty();
+                }
+            }
             ss << "\ninline ";
             describeLocalCppType(ss,fn->result,CpptSubstitureRef::no);
             ss << " " << aotFuncName(fn) << " ( Context * __context__";
@@ -1109,6 +1189,9 @@ namespace das {
             ss << ", ";
             if (isLocalVec(arg->type)) {
                 describeLocalCppType(ss, arg->type);
+            } else if ( !tailStmt.empty() ) {
+                // tail call rewrites arguments in place
+                ss << describeCppType(arg->type,CpptSubstitureRef::no,CpptSkipRef::no,CpptSkipConst::yes);
             } else {
                 ss << describeCppType(arg->type);
             }
@@ -1154,6 +1237,10 @@ namespace das {
             block->finallyBeforeBody = true;
             block->finallyDisabled = block->inTheLoop;
             ss << "{\n";
+            if ( tailCallLabel ) {
+                ss << "__tail_call:\n";
+                tailCallLabel = false;
+            }
             tab ++;
             // pre-declare variables
             auto & vars = collector.variables[block];
@@ -1570,12 +1657,35 @@ namespace das {
             return Visitor::visit(that);
         }
     // op3
+        void tailBranchBegin ( Expression * expr ) {
+            if ( !tailStmt.count(expr) ) {
+                ss << "return das_auto_cast<" << describeCppType(thisFunc->result, CpptSubstitureRef::no, CpptSkipRef::no) << ">::cast(";
+            } else if ( expr->rtti_isCall() ) {
+                ss << "/* tail call */ ";
+            }
+        }
+        void tailBranchEnd ( Expression * expr ) {
+            if ( !tailStmt.count(expr) ) {
+                ss << ");";
+            } else if ( expr->rtti_isCall() ) {
+                ss << "goto __tail_call;";
+            }
+        }
         virtual void preVisit ( ExprOp3 * that ) override {
             Visitor::preVisit(that);
+            if ( tailStmt.count(that) ) {
+                ss << "if ( ";
+                return;
+            }
             if ( !noBracket(that) ) ss << "(";
         }
         virtual void preVisitLeft  ( ExprOp3 * that, Expression * left ) override {
             Visitor::preVisitLeft(that,left);
+            if ( tailStmt.count(that) ) {
+                ss << " ) { ";
+                tailBranchBegin(left);
+                return;
+            }
             ss << " ? ";
             auto argT = left->type;
             if ( isLocalVec(argT) ) {
@@ -1590,6 +1700,12 @@ namespace das {
         }
         virtual void preVisitRight ( ExprOp3 * that, Expression * right ) override {
             Visitor::preVisitRight(that,right);
+            if ( tailStmt.count(that) ) {
+                tailBranchEnd(that->left.get());
+                ss << " } else { ";
+                tailBranchBegin(right);
+                return;
+            }
             ss << ") : ";
             auto argT = right->type;
             if ( isLocalVec(argT) ) {
@@ -1603,6 +1719,11 @@ namespace das {
             ss << describeCppType(that->type, CpptSubstitureRef::no, CpptSkipRef::no) << ">::cast(";
         }
         virtual ExpressionPtr visit ( ExprOp3 * that ) override {
+            if ( tailStmt.count(that) ) {
+                tailBranchEnd(that->right.get());
+                ss << " }";
+                return Visitor::visit(that);
+            }
             ss << ")";
             if ( !noBracket(that) ) ss << ")";
             return Visitor::visit(that);
@@ -1610,6 +1731,11 @@ namespace das {
     // return
         virtual void preVisit ( ExprReturn * expr ) override {
             Visitor::preVisit(expr);
+            if ( expr->subexpr && tailStmt.count(expr->subexpr.get()) ) {
+                ss << "{ ";
+                tailBranchBegin(expr->subexpr.get());
+                return;
+            }
             ss << "return ";
             if ( expr->moveSemantics ) ss << "/* <- */ ";
             auto retT = expr->returnFunc ? expr->returnFunc->result : expr->block->returnType;
@@ -1627,6 +1753,11 @@ namespace das {
             }
         }
         virtual ExpressionPtr visit(ExprReturn* expr) override {
+            if ( expr->subexpr && tailStmt.count(expr->subexpr.get()) ) {
+                tailBranchEnd(expr->subexpr.get());
+                ss << " }";
+                return Visitor::visit(expr);
+            }
             auto retT = expr->returnFunc ? expr->returnFunc->result : expr->block->returnType;
             if (!retT->isVoid()) ss << ")";
             return Visitor::visit(expr);
@@ -3140,20 +3271,46 @@ namespace das {
                 ss << "))";
             }
         }
+        size_t tailCallArgIndex ( ExprCall * call, Expression * arg ) const {
+            auto it = find_if(call->arguments.begin(), call->arguments.end(), [&](const ExpressionPtr & a){ return a.get()==arg; });
+            DAS_ASSERT(it != call->arguments.end());
+            return size_t(it - call->arguments.begin());
+        }
         virtual void preVisit ( ExprCall * call ) override {
             Visitor::preVisit(call);
-            CallFunc_preVisit(call);
+            if ( !tailStmt.count(call) ) CallFunc_preVisit(call);
         }
         virtual void preVisitCallArg ( ExprCall * call, Expression * arg, bool last ) override {
             Visitor::preVisitCallArg(call, arg, last);
+            if ( tailStmt.count(call) ) {
+                auto argIndex = tailCallArgIndex(call, arg);
+                auto & argT = call->func->arguments[argIndex]->type;
+                if ( isLocalVec(argT) ) {
+                    describeLocalCppType(ss, argT);
+                } else {
+                    ss << describeCppType(argT,CpptSubstitureRef::no,CpptSkipRef::no,CpptSkipConst::yes);
+                }
+                ss << " __tail_arg_" << argIndex << " = ";
+            }
             CallFunc_preVisitCallArg(call, arg, last);
         }
         virtual ExpressionPtr visitCallArg ( ExprCall * call, Expression * arg, bool last ) override {
-            CallFunc_visitCallArg(call, arg, last);
+            if ( tailStmt.count(call) ) {
+                CallFunc_visitCallArg(call, arg, true);
+                ss << "; ";
+            } else {
+                CallFunc_visitCallArg(call, arg, last);
+            }
             return Visitor::visitCallArg(call, arg, last);
         }
         virtual ExpressionPtr visit ( ExprCall * call ) override {
-            CallFunc_visit(call);
+            if ( tailStmt.count(call) ) {
+                for ( size_t i=0, is=call->arguments.size(); i!=is; ++i ) {
+                    ss << collector.getVarName(thisFunc->arguments[i]) << " = __tail_arg_" << i << "; ";
+                }
+            } else {
+                CallFunc_visit(call);
+            }
             return Visitor::visit(call);
         }
     // for
@@ -3163,12 +3320,59 @@ namespace das {
         string needLoopName ( ExprFor * ffor ) const {
             return "__need_loop_" + to_string(ffor->at.line);
         }
+        string loopCountName ( ExprFor * ffor ) const {
+            return "__loop_count_" + to_string(ffor->at.line);
+        }
+        // ranges, arrays and fixed arrays are counted loops, everything else goes through das_iterator first and next
+        // iterating over a local array, which is not reachable any other way in this function, gets __restrict
+        uint64_t countedForSources ( ExprFor * ffor, bool & counted ) {
+            counted = ffor->sources.size() <= 64;
+            for ( auto & src : ffor->sources ) {
+                auto & st = src->type;
+                if ( !(st->isRange() || st->isGoodArrayType() || st->dim.size()) ) {
+                    counted = false;
+                }
+            }
+            if ( !counted ) return 0;
+            AotAliasCollector inBody(true);
+            ffor->body->visit(inBody);
+            uint64_t mask = 0;
+            das_hash_set<const Variable *> seen;
+            for ( size_t idx=0; idx!=ffor->sources.size(); ++idx ) {
+                auto & src = ffor->sources[idx];
+                if ( src->type->isRange() || !src->rtti_isVar() ) continue;
+                auto evar = (ExprVar *) src.get();
+                auto pvar = evar->variable.get();
+                if ( !evar->local || pvar->type->ref || !seen.insert(pvar).second ) continue;
+                if ( funcAliased.count(pvar) || inBody.aliased.count(pvar) ) continue;
+                mask |= 1ull << idx;
+            }
+            // same array in two sources
+            for ( size_t idx=0; idx!=ffor->sources.size(); ++idx ) {
+                auto & src = ffor->sources[idx];
+                if ( !src->rtti_isVar() ) continue;
+                auto pvar = ((ExprVar *) src.get())->variable.get();
+                for ( size_t jdx=0; jdx!=ffor->sources.size(); ++jdx ) {
+                    if ( idx!=jdx && ffor->sources[jdx]->rtti_isVar() && ((ExprVar *)ffor->sources[jdx].get())->variable.get()==pvar ) {
+                        mask &= ~(1ull << idx);
+                    }
+                }
+            }
+            return mask;
+        }
         virtual void preVisit ( ExprFor * ffor ) override {
             Visitor::preVisit(ffor);
             ss << "{\n";
             tab ++;
-            auto nl = needLoopName(ffor);
-            ss << string(tab,'\t') << "bool " << nl << " = true;\n";
+            bool counted = false;
+            auto mask = countedForSources(ffor, counted);
+            if ( counted ) {
+                countedFor[ffor] = mask;
+                ss << string(tab,'\t') << "uint64_t " << loopCountName(ffor) << " = UINT64_MAX;\n";
+            } else {
+                auto nl = needLoopName(ffor);
+                ss << string(tab,'\t') << "bool " << nl << " = true;\n";
+            }
         }
         virtual void preVisitForBody ( ExprFor * ffor, Expression * body ) override {
             Visitor::preVisitForBody(ffor, body);
@@ -3179,6 +3383,16 @@ namespace das {
                     block->visitFinally(*this);
                 }
             }
+            if ( countedFor.find(ffor)!=countedFor.end() ) {
+                auto lc = loopCountName(ffor);
+                ss << string(tab,'\t') << "for ( ; " << lc << " ; --" << lc;
+                for ( auto & var : ffor->iteratorVariables ) {
+                    ss << ", ++" << collector.getVarName(var);
+                }
+                ss << " )\n";
+                ss << string(tab,'\t');
+                return;
+            }
             ss << string(tab,'\t') << "for ( ; " << nl << " ; " << nl << " = ";
             for ( auto & var : ffor->iteratorVariables ) {
                 if (var != ffor->iteratorVariables.front()) {
@@ -3216,20 +3430,31 @@ namespace das {
             // source
             bool skipTC = var->type->isString() && !var->type->ref;
             ss << string(tab,'\t') << describeCppType(var->type,CpptSubstitureRef::yes,CpptSkipRef::no,
-                                                      skipTC ? CpptSkipConst::yes : CpptSkipConst::no)
-                << " " << collector.getVarName(var) << ";\n";
+                                                      skipTC ? CpptSkipConst::yes : CpptSkipConst::no);
+            auto itc = countedFor.find(ffor);
+            if ( itc!=countedFor.end() && (itc->second & (1ull<<idx)) && var->type->ref ) {
+                ss << " __restrict";
+            }
+            ss << " " << collector.getVarName(var) << ";\n";
             // loop
-            auto nl = needLoopName(ffor);
-            ss << string(tab, '\t') << nl << " = " << forSrcName(var->name)
-                << ".first(__context__,";
-            ss << "(" << collector.getVarName(var) << ")";
-            ss << ") && " << nl << ";\n";
+            if ( itc!=countedFor.end() ) {
+                auto lc = loopCountName(ffor);
+                ss << string(tab, '\t') << lc << " = das_loop_count(" << lc << "," << forSrcName(var->name)
+                    << ".loop_begin(__context__,(" << collector.getVarName(var) << ")));\n";
+            } else {
+                auto nl = needLoopName(ffor);
+                ss << string(tab, '\t') << nl << " = " << forSrcName(var->name)
+                    << ".first(__context__,";
+                ss << "(" << collector.getVarName(var) << ")";
+                ss << ") && " << nl << ";\n";
+            }
             return Visitor::visitForSource(ffor, that, last);
         }
         virtual ExpressionPtr visit ( ExprFor * ffor ) override {
             ss << "\n";
+            bool counted = countedFor.find(ffor)!=countedFor.end();
             for ( auto & var : ffor->iteratorVariables ) {
-                ss << string(tab, '\t') << forSrcName(var->name) << ".close(__context__,";
+                ss << string(tab, '\t') << forSrcName(var->name) << (counted ? ".loop_end(__context__," : ".close(__context__,");
                 ss << "(" << collector.getVarName(var) << "));\n";
             }
             tab --;
@@ -3271,6 +3496,11 @@ namespace das {
             if ( fnn[i]->init ) {
                 funInit = true;
             }
+            if ( aotInterpreted.find(fnn[i])!=aotInterpreted.end() ) {
+                logs << "\t// " << fnn[i]->getMangledName() << " is interpreted, its not in the profile hot set\n";
+                logs << "\taotLib[0x" << HEX << fnn[i]->aotHash << DEC << "] = nullptr;\n";
+                continue;
+            }
             if ( fnn[i]->noAot )
                 continue;
             // SimFunction * fn = context.getFunction(i);
@@ -3298,6 +3528,70 @@ namespace das {
         }
     }
 
+    // hot set is the smallest set of functions of this module, which covers 'coverage' of its interpreted self time
+    // plus everything they call. the rest goes to aotInterpreted, aotCpp marks it noAot once AOT hashes are known
+    void Program::selectAotFromProfile ( const FunctionProfiler::Profile & profile, double coverage, TextWriter & logs ) {
+        vector<pair<Function *,int64_t>> candidates;
+        int64_t moduleTicks = 0, allTicks = 0;
+        for ( auto & it : profile ) {
+            allTicks += it.second.selfTicks;
+        }
+        uint32_t totalCandidates = 0;
+        thisModule->functions.foreach([&](auto pfun){
+            if ( pfun->index<0 || !pfun->used || pfun->builtIn || pfun->noAot ) return;
+            totalCandidates ++;
+            auto it = profile.find(pfun->getMangledName());
+            if ( it==profile.end() || it->second.selfTicks<=0 ) return;
+            candidates.emplace_back(pfun.get(), it->second.selfTicks);
+            moduleTicks += it->second.selfTicks;
+        });
+        sort(candidates.begin(), candidates.end(), [](const pair<Function *,int64_t> & a, const pair<Function *,int64_t> & b) {
+            return a.second > b.second;
+        });
+        das_set<Function *> hot;
+        vector<Function *> work;
+        int64_t covered = 0;
+        for ( auto & cand : candidates ) {
+            if ( covered >= int64_t(moduleTicks*coverage) ) break;
+            covered += cand.second;
+            if ( hot.insert(cand.first).second ) work.push_back(cand.first);
+        }
+        uint32_t hotCount = uint32_t(hot.size());
+        // callees of the hot set stay native, otherwise each call goes back through the interpreter
+        while ( !work.empty() ) {
+            auto fn = work.back();
+            work.pop_back();
+            for ( auto callee : fn->useFunctions ) {
+                if ( callee->module!=thisModule.get() || callee->builtIn || callee->noAot || !callee->used ) continue;
+                if ( hot.insert(callee).second ) work.push_back(callee);
+            }
+        }
+        int64_t hotTicks = 0;
+        for ( auto fn : hot ) {
+            auto it = profile.find(fn->getMangledName());
+            if ( it!=profile.end() ) hotTicks += it->second.selfTicks;
+        }
+        thisModule->functions.foreach([&](auto pfun){
+            if ( pfun->index<0 || !pfun->used || pfun->builtIn || pfun->noAot ) return;
+            if ( hot.find(pfun.get())==hot.end() ) aotInterpreted.insert(pfun.get());
+        });
+        auto percent = [](int64_t part, int64_t whole) { return whole ? part*100.0/double(whole) : 0.0; };
+        char buf[256];
+        snprintf(buf, sizeof(buf), "AOT profile: %u of %u functions (%u hot, %u callees), %.1f%% of module time, %.1f%% of all interpreted time\n",
+            uint32_t(hot.size()), totalCandidates, hotCount, uint32_t(hot.size())-hotCount, percent(hotTicks,moduleTicks), percent(hotTicks,allTicks));
+        logs << buf;
+        if ( allTicks && hotTicks<allTicks ) {
+            // Amdahl's law, native code taken as free. this is the upper bound of what AOT can give
+            snprintf(buf, sizeof(buf), "estimated speedup is at most %.2fx\n", double(allTicks)/double(allTicks-hotTicks));
+            logs << buf;
+        }
+        for ( auto & cand : candidates ) {
+            if ( hot.find(cand.first)==hot.end() ) continue;
+            snprintf(buf, sizeof(buf), "\t%6.2f%%\t", percent(cand.second,allTicks));
+            logs << buf << cand.first->getMangledName() << "\n";
+        }
+    }
+
     void Program::aotCpp ( Context & context, TextWriter & logs ) {
         // run no-aot marker
         NoAotMarker marker;
@@ -3326,6 +3620,10 @@ namespace das {
                 fni++;
             });
         }
+        // hashes include noAot of the dependencies, and at runtime profile does not exist
+        for ( auto fn : aotInterpreted ) {
+            fn->noAot = true;
+        }
         // now, for that AOT
         setPrintFlags();
         BlockVariableCollector collector;
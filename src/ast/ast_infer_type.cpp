@@ -32,6 +32,253 @@ namespace das {
         bool                        fail = false;
     };
 
+// incremental inference
+
+    // verifies that the function is completely inferred, and collects what it depends on
+    class InferStableCheck : public Visitor {
+    public:
+        bool                typed = true;
+        bool                usesGlobals = false;
+        vector<FunctionPtr> calls;
+    protected:
+        virtual void preVisit ( Function * fn ) override {
+            Visitor::preVisit(fn);
+            if ( !fn->result || fn->result->isAuto() || fn->result->isAlias() ) typed = false;
+        }
+        virtual void preVisitArgument ( Function * fn, const VariablePtr & var, bool lastArg ) override {
+            Visitor::preVisitArgument(fn, var, lastArg);
+            if ( !var->type || var->type->isAuto() || var->type->isAlias() ) typed = false;
+        }
+        virtual void preVisitBlockArgument ( ExprBlock * block, const VariablePtr & var, bool lastArg ) override {
+            Visitor::preVisitBlockArgument(block, var, lastArg);
+            if ( !var->type || var->type->isAuto() || var->type->isAlias() ) typed = false;
+        }
+        virtual void preVisitLet ( ExprLet * let, const VariablePtr & var, bool last ) override {
+            Visitor::preVisitLet(let, var, last);
+            if ( !var->type || var->type->isAuto() || var->type->isAlias() ) typed = false;
+        }
+        virtual bool canVisitIfSubexpr ( ExprIfThenElse * expr ) override {
+            return !expr->isStatic;
+        }
+        // statements have no type, even when inferred
+        virtual void preVisit ( ExprBlock * ) override {}
+        virtual void preVisit ( ExprLet * ) override {}
+        virtual void preVisit ( ExprIfThenElse * ) override {}
+        virtual void preVisit ( ExprFor * ) override {}
+        virtual void preVisit ( ExprWhile * ) override {}
+        virtual void preVisit ( ExprWith * ) override {}
+        virtual void preVisit ( ExprAssume * ) override {}
+        virtual void preVisit ( ExprUnsafe * ) override {}
+        virtual void preVisit ( ExprDelete * ) override {}
+        virtual void preVisit ( ExprReturn * ) override {}
+        virtual void preVisit ( ExprBreak * ) override {}
+        virtual void preVisit ( ExprContinue * ) override {}
+        virtual void preVisit ( ExprLabel * ) override {}
+        virtual void preVisit ( ExprGoto * ) override {}
+        virtual void preVisit ( ExprTryCatch * ) override {}
+        virtual void preVisit ( ExprLooksLikeCall * ) override {}
+        virtual void preVisitExpression ( Expression * expr ) override {
+            Visitor::preVisitExpression(expr);
+            if ( !expr->type ) typed = false;
+            if ( expr->rtti_isCallFunc() ) {
+                if ( auto fn = static_cast<ExprCallFunc *>(expr)->func ) calls.push_back(fn);
+            } else if ( expr->rtti_isAddr() ) {
+                if ( auto fn = static_cast<ExprAddr *>(expr)->func ) calls.push_back(fn);
+            } else if ( expr->rtti_isVar() ) {
+                if ( static_cast<ExprVar *>(expr)->isGlobalVariable() ) usesGlobals = true;
+            }
+        }
+    };
+
+    // functions which were completely inferred, and can be skipped until something they depend on changes
+    struct InferWorklist {
+        struct StableFunction {
+            FunctionPtr         func;
+            vector<FunctionPtr> calls;
+            bool                usesGlobals = false;
+            uint64_t            signature = 0;
+        };
+        das_hash_map<Function *,StableFunction> stable;
+        das_hash_set<FunctionPtr>               known;              // functions, which were already there
+        das_hash_map<Function *,pair<FunctionPtr,uint64_t>> signatures;
+        das_hash_set<Function *>                changedPrev;        // signature changed on the previous pass
+        das_hash_set<Function *>                visitedNow;
+        vector<Function *>                      cleanNow;           // visited without restarts or errors
+        uint64_t                                layoutFingerprint = 0;
+        uint64_t                                globalsFingerprint = 0;
+        bool                                    outsideChangedPrev = false;
+        bool                                    outsideChangedNow = false;
+        int32_t                                 visitedFunctions = 0;
+        int32_t                                 skippedFunctions = 0;
+
+        static uint64_t signatureOf ( Function * fn ) {
+            auto sig = fn->getMangledName() + "->" + (fn->result ? fn->result->getMangledName() : "");
+            return hash_blockz64((const uint8_t *)sig.c_str());
+        }
+        // inference modifies types in place (auto and alias resolution, dimensions, nested types),
+        // so the whole type is hashed via its mangled name, not just the identity and the top level
+        static void hashType ( vector<uint64_t> & hv, const TypeDeclPtr & td ) {
+            hv.push_back(uint64_t(intptr_t(td.get())));
+            if ( !td ) return;
+            auto mn = td->getMangledName();
+            hv.push_back(hash_blockz64((const uint8_t *)mn.c_str()));
+        }
+        static uint64_t hashOf ( const vector<uint64_t> & hv ) {
+            return hash_block64((const uint8_t *)hv.data(), hv.size()*sizeof(uint64_t));
+        }
+        // structures, enumerations and aliases of the module
+        static uint64_t layoutFingerprintOf ( Program * prog ) {
+            vector<uint64_t> hv;
+            auto mod = prog->thisModule.get();
+            mod->structures.foreach([&](auto & st){
+                hv.push_back(uint64_t(intptr_t(st.get())));
+                hv.push_back(st->fields.size());
+                for ( auto & fd : st->fields ) hashType(hv, fd.type);
+            });
+            mod->enumerations.foreach([&](auto & en){
+                hv.push_back(uint64_t(intptr_t(en.get())));
+                hv.push_back(en->list.size());
+            });
+            mod->aliasTypes.foreach([&](auto & td){
+                hashType(hv, td);
+            });
+            return hashOf(hv);
+        }
+        // global variables of the module
+        static uint64_t globalsFingerprintOf ( Program * prog ) {
+            vector<uint64_t> hv;
+            prog->thisModule->globals.foreach([&](auto & var){
+                hv.push_back(uint64_t(intptr_t(var.get())));
+                hashType(hv, var->type);
+            });
+            return hashOf(hv);
+        }
+        // field lookups point into the structure, so when lambda or generator captures grow nothing is stable
+        // functions which use globals are only affected by changes to the globals
+        void checkFingerprints ( Program * prog ) {
+            auto lfp = layoutFingerprintOf(prog);
+            auto gfp = globalsFingerprintOf(prog);
+            if ( lfp != layoutFingerprint ) {
+                stable.clear();
+            } else if ( gfp != globalsFingerprint ) {
+                for ( auto it = stable.begin(); it != stable.end(); ) {
+                    if ( it->second.usesGlobals ) it = stable.erase(it); else ++it;
+                }
+            }
+            layoutFingerprint = lfp;
+            globalsFingerprint = gfp;
+        }
+        bool mustVisit ( Function * fn ) {
+            if ( !outsideChangedPrev ) {
+                auto it = stable.find(fn);
+                if ( it != stable.end() ) {
+                    bool depChanged = false;
+                    for ( auto & cfn : it->second.calls ) {
+                        if ( changedPrev.find(cfn.get()) != changedPrev.end() ) {
+                            depChanged = true;
+                            break;
+                        }
+                    }
+                    if ( !depChanged ) {
+                        skippedFunctions ++;
+                        return false;
+                    }
+                }
+            }
+            visitedFunctions ++;
+            visitedNow.insert(fn);
+            return true;
+        }
+        // stable functions which call something, which is about to be re-inferred
+        void dropDependents ( const das_hash_set<Function *> & changed, const das_hash_set<string> & names ) {
+            if ( changed.empty() && names.empty() ) return;
+            for ( auto it = stable.begin(); it != stable.end(); ) {
+                bool drop = false;
+                for ( auto & cfn : it->second.calls ) {
+                    if ( changed.find(cfn.get())!=changed.end() || names.find(cfn->name)!=names.end() ) {
+                        drop = true;
+                        break;
+                    }
+                }
+                if ( drop ) it = stable.erase(it); else ++it;
+            }
+        }
+        // new function can be a better overload for the existing call
+        void checkNewFunctions ( Program * prog ) {
+            das_hash_set<string> names;
+            prog->thisModule->functions.foreach([&](auto & fn){
+                if ( known.insert(fn).second ) names.insert(fn->name);
+            });
+            dropDependents(das_hash_set<Function *>(), names);
+        }
+        // before the first pass, i.e. after macros did something to the program
+        void revalidate ( Program * prog ) {
+            checkFingerprints(prog);
+            checkNewFunctions(prog);
+            das_hash_set<Function *> changed;
+            for ( auto it = stable.begin(); it != stable.end(); ) {
+                auto fn = it->second.func.get();
+                bool keep = prog->thisModule->functions.find(fn->getMangledName()).get()==fn
+                    && signatureOf(fn)==it->second.signature;
+                if ( keep ) {
+                    InferStableCheck check;
+                    fn->visit(check);
+                    keep = check.typed;
+                }
+                if ( keep ) {
+                    ++it;
+                } else {
+                    changed.insert(fn);
+                    it = stable.erase(it);
+                }
+            }
+            dropDependents(changed, das_hash_set<string>());
+            changedPrev.clear();
+            outsideChangedPrev = false;
+        }
+        void beginPass() {
+            visitedNow.clear();
+            cleanNow.clear();
+            outsideChangedNow = false;
+            visitedFunctions = 0;
+            skippedFunctions = 0;
+        }
+        void endPass ( Program * prog ) {
+            checkFingerprints(prog);
+            for ( auto fn : visitedNow ) {
+                stable.erase(fn);
+            }
+            for ( auto fn : cleanNow ) {
+                InferStableCheck check;
+                fn->visit(check);
+                if ( check.typed ) {
+                    auto & sf = stable[fn];
+                    sf.func = fn;
+                    sf.calls = move(check.calls);
+                    sf.usesGlobals = check.usesGlobals;
+                    sf.signature = signatureOf(fn);
+                }
+            }
+            checkNewFunctions(prog);
+            // callers only care about the signature, so re-inferring the body alone does not invalidate them
+            changedPrev.clear();
+            for ( auto fn : visitedNow ) {
+                auto sig = signatureOf(fn);
+                auto & ps = signatures[fn];
+                if ( !ps.first || ps.second != sig ) {
+                    ps.first = fn;
+                    ps.second = sig;
+                    changedPrev.insert(fn);
+                }
+            }
+            outsideChangedPrev = outsideChangedNow;
+        }
+        void finish ( Program * prog ) {
+            layoutFingerprint = layoutFingerprintOf(prog);
+            globalsFingerprint = globalsFingerprintOf(prog);
+        }
+    };
+
 // type inference
 
     class InferTypes : public FoldingVisitor {
@@ -44,8 +291,12 @@ namespace das {
         }
         bool finished() const { return !needRestart; }
         bool verbose = true;
+        InferWorklist *         worklist = nullptr;
+        int32_t                 visitedNodes = 0;
     protected:
         FunctionPtr             func;
+        bool                    funcRestartAtStart = false;
+        size_t                  funcErrorsAtStart = 0;
         vector<VariablePtr>     local;
         vector<ExpressionPtr>   loop;
         vector<ExprBlock *>     blocks;
@@ -104,10 +355,12 @@ namespace das {
         }
         void reportAstChanged() {
             needRestart = true;
+            if ( worklist && !func ) worklist->outsideChangedNow = true;
         }
         virtual void reportFolding() override {
             FoldingVisitor::reportFolding();
             needRestart = true;
+            if ( worklist && !func ) worklist->outsideChangedNow = true;
         }
         string describeType ( const TypeDeclPtr & decl ) const {
             return verbose ? decl->describe() : "";
@@ -1619,10 +1872,16 @@ namespace das {
             if ( expr->alwaysSafe ) return true;
             return false;
         }
+        virtual bool canVisitFunction ( Function * fun ) override {
+            return worklist ? worklist->mustVisit(fun) : true;
+        }
         virtual void preVisit ( Function * f ) override {
             Visitor::preVisit(f);
             unsafeDepth = 0;
             func = f;
+            funcRestartAtStart = needRestart;
+            funcErrorsAtStart = program->errors.size();
+            needRestart = false;
             func->hasReturn = false;
             func->noAot |= disableAot;
         }
@@ -1734,12 +1993,17 @@ namespace das {
             DAS_ASSERT(with.size()==0);
             labels.clear();
             func.reset();
+            if ( worklist && !needRestart && program->errors.size()==funcErrorsAtStart ) {
+                worklist->cleanNow.push_back(that);
+            }
+            needRestart |= funcRestartAtStart;
             return Visitor::visit(that);
         }
     // any expression
         virtual void preVisitExpression ( Expression * expr ) override {
             Visitor::preVisitExpression(expr);
             expr->type.reset();
+            visitedNodes ++;
         }
     // const
         vec4f getEnumerationValue( ExprConstEnumeration * expr, bool & inferred ) const {
@@ -7355,15 +7619,24 @@ namespace das {
         if ( log ) {
             logs << "INITIAL CODE:\n" << *this;
         }
+        InferWorklist * worklist = nullptr;
+        if ( options.getBoolOption("infer_worklist",true) ) {
+            if ( !inferWorklist ) inferWorklist = make_shared<InferWorklist>();
+            worklist = inferWorklist.get();
+            worklist->revalidate(this);
+        }
         for ( pass = 0; pass < maxPasses; ++pass ) {
             failToCompile = false;
             errors.clear();
             InferTypes context(this);
             context.verbose = verbose || log;
+            context.worklist = worklist;
+            if ( worklist ) worklist->beginPass();
             visit(context);
             for ( auto efn : context.extraFunctions ) {
                 addFunction(efn);
             }
+            if ( worklist ) worklist->endPass(this);
             bool anyMacrosDidWork = false;
             auto modMacro = [&](Module * mod) -> bool {
                 if ( thisModule->isVisibleDirectly(mod) && mod!=thisModule.get() ) {
@@ -7375,8 +7648,15 @@ namespace das {
             };
             Module::foreach(modMacro);
             library.foreach(modMacro, "*");
+            if ( worklist && anyMacrosDidWork ) worklist->revalidate(this);
             if ( log ) {
                 logs << "PASS " << pass << ":\n" << *this;
+                if ( worklist ) {
+                    logs << "// pass " << pass << " visited " << worklist->visitedFunctions << " functions, skipped "
+                        << worklist->skippedFunctions << ", " << context.visitedNodes << " nodes\n";
+                } else {
+                    logs << "// pass " << pass << " visited " << context.visitedNodes << " nodes\n";
+                }
                 sort(errors.begin(), errors.end());
                 for (auto & err : errors) {
                     logs << reportError(err.at, err.what, err.extra, err.fixme, err.cerr);
@@ -7385,6 +7665,7 @@ namespace das {
             if ( anyMacrosDidWork ) continue;
             if ( context.finished() ) break;
         }
+        if ( worklist ) worklist->finish(this);
         if (pass == maxPasses) {
             error("type inference exceeded maximum allowed number of passes ("+to_string(maxPasses)+")\n"
                     "this is likely due to a loop in the type system", "", "",
@@ -7392,4 +7673,3 @@ namespace das {
         }
     }
 }
-
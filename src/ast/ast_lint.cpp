@@ -466,6 +466,7 @@ namespace das {
         "no_unused_block_arguments",    Type::tBool,
     // memory
         "stack",                        Type::tInt,
+        "max_stack",                    Type::tInt,
         "intern_strings",               Type::tBool,
         "multiple_contexts",            Type::tBool,
         "persistent_heap",              Type::tBool,
@@ -505,9 +506,11 @@ namespace das {
         "optimize",                     Type::tBool,
         "fusion",                       Type::tBool,
         "remove_unused_symbols",        Type::tBool,
+        "tail_calls",                   Type::tBool,
     // language
         "always_export_initializer",    Type::tBool,
         "infer_time_folding",           Type::tBool,
+        "infer_worklist",               Type::tBool,
         "disable_run",                  Type::tBool,
         "max_infer_passes",             Type::tInt,
         "indenting",                    Type::tInt,
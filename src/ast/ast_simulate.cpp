@@ -2169,6 +2169,10 @@ namespace das
                 return context.code->makeNode<SimNode_ReturnConstString>(at, str);
             }
         }
+        // tail call rewrites arguments, and stops for return on its own
+        if ( subexpr && subexpr->rtti_isCall() && static_pointer_cast<ExprCall>(subexpr)->tailCall ) {
+            return subexpr->simulate(context);
+        }
         // now, lets do the standard everything
         bool skipIt = false;
         if ( subexpr && subexpr->rtti_isMakeLocal() ) {
@@ -2715,6 +2719,9 @@ namespace das
     }
 
     SimNode * ExprCall::simulate (Context & context) const {
+        if ( tailCall ) {
+            return simulateCall(func, this, context, context.code->makeNode<SimNode_TailCall>(at));
+        }
         auto pCall = static_cast<SimNode_CallBase *>(func->makeSimNode(context,arguments));
         simulateCall(func, this, context, pCall);
         if ( !doesNotNeedSp && stackTop ) {
@@ -2878,6 +2885,9 @@ namespace das
                         gfun.builtin = true;
                     }
                     gfun.code = pfun->simulate(context);
+                    if ( pfun->hasTailCall && gfun.code ) {
+                        gfun.code = context.code->makeNode<SimNode_TailCallLoop>(pfun->at, gfun.code);
+                    }
                     lookupFunctionTable.push_back(pfun);
                 });
             }
@@ -2986,10 +2996,29 @@ namespace das
         }
         // now relocate before we run that init script
         if ( aot_hint ) {
-            linkCppAot(context, getGlobalAotLibrary(), logs);
+            if ( !policies.aot_lib.empty() && !aotLibrary ) {
+                TextWriter tw;
+                auto lib = make_shared<AotLibrary>();
+                if ( loadAotLibrary(policies.aot_lib, *lib, tw) ) {
+                    aotLibrary = lib;
+                } else {
+                    linkError("library " + policies.aot_lib, tw.str());
+                }
+            }
+            if ( aotLibrary ) {
+                linkCppAotLibrary(context, *aotLibrary, logs);
+            } else if ( policies.aot_lib.empty() ) {
+                linkCppAot(context, getGlobalAotLibrary(), logs);
+            }
             context.relocateCode(true);
             context.relocateCode();
         }
+        // growable stack
+        auto maxStack = getContextMaxStackSize();
+        if ( maxStack>0 && context.stack.size() && uint32_t(maxStack)>context.stack.size()
+                && !context.stack.isGrowable() && context.stack.empty() ) {
+            context.stack.makeGrowable(context.stack.size(), uint32_t(maxStack));
+        }
         // run init script and restart
         if ( !folding ) {
             auto time1 = ref_time_ticks();
@@ -3085,6 +3114,28 @@ namespace das
         return res;
     }
 
+    void Program::linkCppAotLibrary ( Context & context, AotLibrary & aotLib, TextWriter & logs ) {
+        // per-program library is built for this exact script set, stale library is rejected as a whole
+        bool anyInit = false;
+        for (auto & pm : library.modules) {
+            pm->functions.foreach([&](auto pfun){
+                if ( pfun->index>=0 && pfun->used && pfun->init && pfun->module==thisModule.get() ) {
+                    anyInit = true;
+                }
+            });
+        }
+        if ( context.totalVariables || anyInit ) {
+            uint64_t semH = getInitSemanticHashWithDep(context.getInitSemanticHash());
+            if ( aotLib.find(semH)==aotLib.end() ) {
+                TextWriter tp;
+                tp << "init script semantic hash is " << HEX << semH << DEC << ", AOT library is out of date\n";
+                linkError("[[ init script ]]", tp.str());
+                return;
+            }
+        }
+        linkCppAot(context, aotLib, logs);
+    }
+
     void Program::linkCppAot ( Context & context, AotLibrary & aotLib, TextWriter & logs ) {
         bool logIt = options.getBoolOption("log_aot",false);
         // make list of functions
@@ -3109,7 +3160,10 @@ namespace das
                 SimFunction & fn = context.functions[fni];
                 uint64_t semHash = fnn[fni]->aotHash = getFunctionAotHash(fnn[fni]);
                 auto it = aotLib.find(semHash);
-                if ( it != aotLib.end() ) {
+                if ( it != aotLib.end() && !it->second ) {
+                    // profile guided AOT left this one to the interpreter
+                    if ( logIt ) logs << "INTERPRETED " << fn.mangledName << " AOT=0x" << HEX << semHash << DEC << "\n";
+                } else if ( it != aotLib.end() ) {
                     fn.code = (it->second)(context);
                     fn.aot = true;
                     if ( logIt ) logs << fn.mangledName << " AOT=0x" << HEX << semHash << DEC << "\n";
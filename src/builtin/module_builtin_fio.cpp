@@ -12,6 +12,10 @@
 
 #include "daScript/misc/performance_time.h"
 #include "daScript/misc/sysos.h"
+#include "daScript/misc/async_file_io.h"
+#include "daScript/misc/job_que.h"
+#include "daScript/simulate/aot_builtin_jobque.h"
+#include "daScript/misc/fnv.h"
 
 MAKE_TYPE_FACTORY(clock, das::Time)// use MAKE_TYPE_FACTORY out of namespace. Some compilers not happy otherwise
 
@@ -94,6 +98,11 @@ namespace das {
 #endif
 
 namespace das {
+    struct FileMap {
+        char *      data = nullptr;
+        uint64_t    size = 0;
+    };
+
     struct FStat {
         struct stat stats;
         bool        is_valid;
@@ -119,6 +128,10 @@ namespace das {
 
 MAKE_TYPE_FACTORY(FStat, das::FStat)
 MAKE_TYPE_FACTORY(FILE,FILE)
+MAKE_TYPE_FACTORY(FileMap,das::FileMap)
+MAKE_TYPE_FACTORY(AsyncFileIO,das::AsyncFileIO)
+MAKE_TYPE_FACTORY(AsyncFileResult,das::AsyncFileResult)
+MAKE_TYPE_FACTORY(DirWalkEntry,das::DirWalkEntry)
 
 namespace das {
     void builtin_sleep ( uint32_t msec ) {
@@ -152,6 +165,38 @@ namespace das {
         }
     };
 
+    struct FileMapAnnotation : ManagedStructureAnnotation <FileMap,false> {
+        FileMapAnnotation(ModuleLibrary & ml) : ManagedStructureAnnotation ("FileMap", ml) {
+        }
+    };
+
+    struct AsyncFileIOAnnotation : ManagedStructureAnnotation <AsyncFileIO,false> {
+        AsyncFileIOAnnotation(ModuleLibrary & ml) : ManagedStructureAnnotation ("AsyncFileIO", ml) {
+        }
+    };
+
+    struct DirWalkEntryAnnotation : ManagedStructureAnnotation <DirWalkEntry,false> {
+        DirWalkEntryAnnotation(ModuleLibrary & ml) : ManagedStructureAnnotation ("DirWalkEntry", ml) {
+            // path lives in the batch storage, which is gone after the block. hence string#, clone_string to keep it
+            addField<DAS_BIND_MANAGED_FIELD(path)>("path").decl->temporary = true;
+            addField<DAS_BIND_MANAGED_FIELD(size)>("size");
+            addField<DAS_BIND_MANAGED_FIELD(mtime)>("mtime");
+            addField<DAS_BIND_MANAGED_FIELD(hash)>("hash");
+            addField<DAS_BIND_MANAGED_FIELD(is_dir)>("is_dir");
+        }
+    };
+
+    struct AsyncFileResultAnnotation : ManagedStructureAnnotation <AsyncFileResult,false> {
+        AsyncFileResultAnnotation(ModuleLibrary & ml) : ManagedStructureAnnotation ("AsyncFileResult", ml) {
+            addField<DAS_BIND_MANAGED_FIELD(id)>("id");
+            addField<DAS_BIND_MANAGED_FIELD(op)>("op");
+            addField<DAS_BIND_MANAGED_FIELD(error)>("error");
+            addField<DAS_BIND_MANAGED_FIELD(size)>("size");
+            addField<DAS_BIND_MANAGED_FIELD(mtime)>("mtime");
+            addField<DAS_BIND_MANAGED_FIELD(is_dir)>("is_dir");
+        }
+    };
+
 
     void builtin_fprint ( const FILE * f, const char * text, Context * context, LineInfoArg * at ) {
         if ( !f ) context->throw_error_at(*at, "can't fprint NULL");
@@ -195,15 +240,180 @@ namespace das {
         struct stat st;
         int fd = fileno((FILE *)f);
         fstat(fd, &st);
-        void* data = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
-        Array arr;
+        void* data = st.st_size ? mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0) : nullptr;
+        if ( data==MAP_FAILED ) context->throw_error_at(*at, "can't map file");
+        Array arr = {};
         arr.data = (char *) data;
         arr.capacity = arr.size = uint32_t(st.st_size);
         arr.lock = 1;
         vec4f args[1];
         args[0] = cast<Array *>::from(&arr);
         context->invoke(blk, args, nullptr, at);
-        munmap(data, 0);
+        if ( data ) munmap(data, st.st_size);
+    }
+
+    const FileMap * builtin_fmap_open ( const char * name ) {
+        if ( !name ) return nullptr;
+        FILE * f = fopen(name, "rb");
+        if ( !f ) return nullptr;
+        struct stat st;
+        int fd = fileno(f);
+        if ( fstat(fd, &st)!=0 ) {
+            fclose(f);
+            return nullptr;
+        }
+        auto fm = new FileMap();
+        fm->size = uint64_t(st.st_size);
+        if ( fm->size ) {
+            void * data = mmap(nullptr, size_t(fm->size), PROT_READ, MAP_SHARED, fd, 0);
+            if ( data==MAP_FAILED ) {
+                fclose(f);
+                delete fm;
+                return nullptr;
+            }
+            fm->data = (char *) data;
+        }
+        fclose(f);  // mapping outlives the descriptor
+        return fm;
+    }
+
+    void builtin_fmap_close ( const FileMap * fm, Context * context, LineInfoArg * at ) {
+        if ( !fm ) context->throw_error_at(*at, "can't close NULL file map");
+        if ( fm->data ) munmap(fm->data, size_t(fm->size));
+        delete fm;
+    }
+
+    uint64_t builtin_fmap_size ( const FileMap * fm, Context * context, LineInfoArg * at ) {
+        if ( !fm ) context->throw_error_at(*at, "can't get size of NULL file map");
+        return fm->size;
+    }
+
+    bool builtin_fmap_advise ( const FileMap * fm, int32_t advice, Context * context, LineInfoArg * at ) {
+        if ( !fm ) context->throw_error_at(*at, "can't advise NULL file map");
+        if ( !fm->data ) return true;
+#if defined(_WIN32)
+        (void) advice;
+        return false;
+#else
+        int madv;
+        switch ( advice ) {
+            case 0:     madv = MADV_NORMAL; break;
+            case 1:     madv = MADV_SEQUENTIAL; break;
+            case 2:     madv = MADV_RANDOM; break;
+            case 3:     madv = MADV_WILLNEED; break;
+            case 4:     madv = MADV_DONTNEED; break;
+            default:    context->throw_error_at(*at, "unsupported file map advice %i", advice); return false;
+        }
+        return madvise(fm->data, size_t(fm->size), madv)==0;
+#endif
+    }
+
+    static void fmap_invoke_view ( const char * data, uint64_t size, const TBlock<void,TTemporary<TArray<uint8_t>>> & blk, Context * context, LineInfoArg * at ) {
+        if ( size > UINT32_MAX ) context->throw_error_at(*at, "file map view is too big, %llu bytes", (unsigned long long) size);
+        Array arr = {};
+        arr.data = (char *) data;
+        arr.capacity = arr.size = uint32_t(size);
+        arr.lock = 1;
+        vec4f args[1];
+        args[0] = cast<Array *>::from(&arr);
+        context->invoke(blk, args, nullptr, at);
+    }
+
+    void builtin_fmap_view ( const FileMap * fm, uint64_t offset, uint64_t length, const TBlock<void,TTemporary<TArray<uint8_t>>> & blk, Context * context, LineInfoArg * at ) {
+        if ( !fm ) context->throw_error_at(*at, "can't view NULL file map");
+        if ( offset > fm->size || length > fm->size - offset ) {
+            context->throw_error_at(*at, "file map view [%llu,%llu) is out of range, size is %llu",
+                (unsigned long long) offset, (unsigned long long) (offset + length), (unsigned long long) fm->size);
+        }
+        fmap_invoke_view(fm->data + offset, length, blk, context, at);
+    }
+
+    static uint64_t fmap_split ( const FileMap * fm, char delimiter, bool trimCR, const TBlock<void,TTemporary<TArray<uint8_t>>> & blk, Context * context, LineInfoArg * at ) {
+        uint64_t count = 0;
+        const char * cur = fm->data;
+        const char * end = cur + fm->size;
+        while ( cur < end ) {
+            auto tail = (const char *) memchr(cur, delimiter, size_t(end - cur));
+            auto next = tail ? tail + 1 : end;
+            if ( !tail ) tail = end;
+            if ( trimCR && tail!=cur && tail[-1]=='\r' ) tail --;
+            fmap_invoke_view(cur, uint64_t(tail - cur), blk, context, at);
+            cur = next;
+            count ++;
+        }
+        return count;
+    }
+
+    uint64_t builtin_fmap_lines ( const FileMap * fm, const TBlock<void,TTemporary<TArray<uint8_t>>> & blk, Context * context, LineInfoArg * at ) {
+        if ( !fm ) context->throw_error_at(*at, "can't iterate lines of NULL file map");
+        return fmap_split(fm, '\n', true, blk, context, at);
+    }
+
+    uint64_t builtin_fmap_records ( const FileMap * fm, int32_t delimiter, const TBlock<void,TTemporary<TArray<uint8_t>>> & blk, Context * context, LineInfoArg * at ) {
+        if ( !fm ) context->throw_error_at(*at, "can't iterate records of NULL file map");
+        if ( delimiter<0 || delimiter>255 ) context->throw_error_at(*at, "record delimiter %i is not a byte", delimiter);
+        return fmap_split(fm, char(delimiter), false, blk, context, at);
+    }
+
+    AsyncFileIO * builtin_async_io_create ( int32_t threads ) {
+        return new AsyncFileIO(threads);
+    }
+
+    void builtin_async_io_destroy ( AsyncFileIO * io, Context * context, LineInfoArg * at ) {
+        if ( !io ) context->throw_error_at(*at, "can't destroy NULL async io");
+        delete io;
+    }
+
+    uint64_t builtin_async_io_read ( AsyncFileIO * io, const char * name, Context * context, LineInfoArg * at ) {
+        if ( !io ) context->throw_error_at(*at, "can't read with NULL async io");
+        return io->read(name);
+    }
+
+    uint64_t builtin_async_io_write ( AsyncFileIO * io, const char * name, const char * text, bool append, Context * context, LineInfoArg * at ) {
+        if ( !io ) context->throw_error_at(*at, "can't write with NULL async io");
+        return io->write(name, text, text ? stringLength(*context, text) : 0, append);
+    }
+
+    uint64_t builtin_async_io_write_bytes ( AsyncFileIO * io, const char * name, const TArray<uint8_t> & data, bool append, Context * context, LineInfoArg * at ) {
+        if ( !io ) context->throw_error_at(*at, "can't write with NULL async io");
+        return io->write(name, data.data, data.size, append);
+    }
+
+    uint64_t builtin_async_io_stat ( AsyncFileIO * io, const char * name, Context * context, LineInfoArg * at ) {
+        if ( !io ) context->throw_error_at(*at, "can't stat with NULL async io");
+        return io->stat(name);
+    }
+
+    int32_t builtin_async_io_submit ( AsyncFileIO * io, Context * context, LineInfoArg * at ) {
+        if ( !io ) context->throw_error_at(*at, "can't submit to NULL async io");
+        return io->submit();
+    }
+
+    int32_t builtin_async_io_pending ( const AsyncFileIO * io, Context * context, LineInfoArg * at ) {
+        if ( !io ) context->throw_error_at(*at, "can't query NULL async io");
+        return io->pending();
+    }
+
+    int32_t builtin_async_io_in_flight ( const AsyncFileIO * io, Context * context, LineInfoArg * at ) {
+        if ( !io ) context->throw_error_at(*at, "can't query NULL async io");
+        return io->in_flight();
+    }
+
+    int32_t builtin_async_io_poll ( AsyncFileIO * io, int32_t timeoutMs, const TBlock<void,const AsyncFileResult,TTemporary<TArray<uint8_t>>> & blk, Context * context, LineInfoArg * at ) {
+        if ( !io ) context->throw_error_at(*at, "can't poll NULL async io");
+        vector<AsyncFileCompletion> done;
+        int32_t count = io->complete(done, timeoutMs);
+        for ( auto & c : done ) {
+            Array arr = {};
+            arr.data = c.data.data();
+            arr.capacity = arr.size = uint32_t(c.data.size());
+            arr.lock = 1;
+            vec4f args[2];
+            args[0] = cast<const AsyncFileResult &>::from(c.result);
+            args[1] = cast<Array *>::from(&arr);
+            context->invoke(blk, args, nullptr, at);
+        }
+        return count;
     }
 
     int64_t builtin_ftell ( const FILE * f, Context * context, LineInfoArg * at ) {
@@ -401,6 +611,262 @@ namespace das {
  #endif
     }
 
+    enum DirWalkFlags : uint32_t {
+        walk_recursive  = 1<<0,
+        walk_stat       = 1<<1,
+        walk_hash       = 1<<2,
+        walk_dirs       = 1<<3,
+    };
+
+    // '*' and '?' wildcards, several patterns can be separated with ';'
+    static bool glob_match_one ( const char * pat, const char * patEnd, const char * name ) {
+        const char * star = nullptr;
+        const char * starName = nullptr;
+        while ( *name ) {
+            if ( pat!=patEnd && (*pat=='?' || *pat==*name) ) {
+                pat ++;
+                name ++;
+            } else if ( pat!=patEnd && *pat=='*' ) {
+                star = pat ++;
+                starName = name;
+            } else if ( star ) {
+                pat = star + 1;
+                name = ++ starName;
+            } else {
+                return false;
+            }
+        }
+        while ( pat!=patEnd && *pat=='*' ) pat ++;
+        return pat==patEnd;
+    }
+
+    static bool glob_match ( const char * pattern, const char * name ) {
+        if ( !pattern || !*pattern ) return true;
+        for ( ;; ) {
+            const char * patEnd = strchr(pattern, ';');
+            if ( !patEnd ) patEnd = pattern + strlen(pattern);
+            if ( glob_match_one(pattern, patEnd, name) ) return true;
+            if ( !*patEnd ) return false;
+            pattern = patEnd + 1;
+        }
+    }
+
+    struct DirWalkBatch {
+        vector<DirWalkEntry>    entries;
+        vector<uint32_t>        names;      // offset of the path in the text, entry paths are patched on delivery
+        vector<char>            text;
+        void add ( const string & path, const DirWalkEntry & entry ) {
+            entries.push_back(entry);
+            names.push_back(uint32_t(text.size()));
+            text.insert(text.end(), path.c_str(), path.c_str() + path.size() + 1);
+        }
+        void append ( DirWalkBatch & batch ) {
+            uint32_t base = uint32_t(text.size());
+            entries.insert(entries.end(), batch.entries.begin(), batch.entries.end());
+            for ( auto ofs : batch.names ) names.push_back(base + ofs);
+            text.insert(text.end(), batch.text.begin(), batch.text.end());
+        }
+    };
+
+    // directories are listed on the shared job que, one job per directory
+    // matching files are hashed in separate jobs, so that one big directory does not serialize the walk
+    // the walker does not go away before its last job is done. builtin_dir_walk catches the panic in the block for that
+    struct DirWalker {
+        shared_ptr<JobQue>  jobs;
+        string              pattern;
+        uint32_t            flags = 0;
+        mutex               readyMutex;
+        condition_variable  readyCond;
+        deque<DirWalkBatch> ready;
+        size_t              readyCount = 0;
+        atomic<int32_t>     outstanding{0};
+        atomic<bool>        cancel{false};
+        enum { hash_chunk = 32 };
+        DirWalker() {
+            jobs = acquireJobQue();
+        }
+        ~DirWalker() {
+            cancel = true;
+            {
+                unique_lock<mutex> lock(readyMutex);
+                readyCond.wait(lock, [&]() { return outstanding==0; });
+            }
+            releaseJobQue(jobs);
+        }
+        void push ( Job && job ) {
+            outstanding ++;
+            jobs->push(das::move(job), 0, JobPriority::Default);
+        }
+        void done ( DirWalkBatch & batch ) {
+            // notified under the lock, once outstanding is 0 the walker can be gone
+            lock_guard<mutex> guard(readyMutex);
+            if ( !batch.entries.empty() && !cancel ) {
+                readyCount += batch.entries.size();
+                ready.emplace_back(das::move(batch));
+            }
+            outstanding --;
+            readyCond.notify_all();
+        }
+        static void fill_stat ( const string & path, DirWalkEntry & entry ) {
+            struct stat st;
+            if ( stat(path.c_str(), &st)==0 ) {
+                entry.size = uint64_t(st.st_size);
+                entry.mtime = int64_t(st.st_mtime);
+            }
+        }
+        static void fill_hash ( const string & path, DirWalkEntry & entry ) {
+            HashBlock hb;
+            uint64_t total = 0;
+            if ( FILE * f = fopen(path.c_str(), "rb") ) {
+                char buffer[65536];
+                while ( auto bytes = fread(buffer, 1, sizeof(buffer), f) ) {
+                    hb.write(buffer, bytes);
+                    total += bytes;
+                }
+                fclose(f);
+            }
+            entry.hash = hb.getHash();
+            entry.size = total;
+        }
+        void hash_files ( vector<pair<string,DirWalkEntry>> files ) {
+            DirWalkBatch batch;
+            for ( auto & it : files ) {
+                if ( cancel ) break;
+                if ( flags & walk_stat ) fill_stat(it.first, it.second);
+                fill_hash(it.first, it.second);
+                batch.add(it.first, it.second);
+            }
+            done(batch);
+        }
+        void add_file ( const string & path, DirWalkBatch & batch, vector<pair<string,DirWalkEntry>> & toHash ) {
+            DirWalkEntry entry = {};
+            if ( flags & walk_hash ) {
+                toHash.emplace_back(path, entry);
+                if ( toHash.size()==hash_chunk ) {
+                    auto chunk = das::move(toHash);
+                    toHash.clear();
+                    push([this,chunk]() mutable { hash_files(das::move(chunk)); });
+                }
+            } else {
+                if ( flags & walk_stat ) fill_stat(path, entry);
+                batch.add(path, entry);
+            }
+        }
+        void add_dir ( const string & path, const char * name, DirWalkBatch & batch ) {
+            if ( (flags & walk_dirs) && glob_match(pattern.c_str(), name) ) {
+                DirWalkEntry entry = {};
+                entry.is_dir = true;
+                if ( flags & walk_stat ) fill_stat(path, entry);
+                batch.add(path, entry);
+            }
+            if ( flags & walk_recursive ) {
+                push([this,path]() { walk(path); });
+            }
+        }
+        void walk ( const string & dirPath ) {
+            DirWalkBatch batch;
+            vector<pair<string,DirWalkEntry>> toHash;
+            if ( cancel ) {
+                done(batch);
+                return;
+            }
+#if defined(_MSC_VER)
+            _finddata_t c_file;
+            intptr_t hFile;
+            string findPath = dirPath + "/*";
+            if ((hFile = _findfirst(findPath.c_str(), &c_file)) != -1L) {
+                do {
+                    if ( strcmp(c_file.name,".")==0 || strcmp(c_file.name,"..")==0 ) continue;
+                    string path = dirPath + "/" + c_file.name;
+                    if ( c_file.attrib & _A_SUBDIR ) {
+                        add_dir(path, c_file.name, batch);
+                    } else if ( glob_match(pattern.c_str(), c_file.name) ) {
+                        add_file(path, batch, toHash);
+                    }
+                } while (_findnext(hFile, &c_file) == 0);
+                _findclose(hFile);
+            }
+#else
+            if ( DIR * dir = opendir(dirPath.c_str()) ) {
+                while ( struct dirent * ent = readdir(dir) ) {
+                    if ( strcmp(ent->d_name,".")==0 || strcmp(ent->d_name,"..")==0 ) continue;
+                    string path = dirPath + "/" + ent->d_name;
+                    bool isDir = ent->d_type==DT_DIR;
+                    if ( ent->d_type==DT_UNKNOWN ) {
+                        struct stat st;
+                        isDir = lstat(path.c_str(), &st)==0 && S_ISDIR(st.st_mode);
+                    } else if ( ent->d_type==DT_LNK ) {
+                        // linked directories are not followed, to avoid cycles
+                        struct stat st;
+                        if ( stat(path.c_str(), &st)!=0 || S_ISDIR(st.st_mode) ) continue;
+                    }
+                    if ( isDir ) {
+                        add_dir(path, ent->d_name, batch);
+                    } else if ( glob_match(pattern.c_str(), ent->d_name) ) {
+                        add_file(path, batch, toHash);
+                    }
+                }
+                closedir(dir);
+            }
+#endif
+            if ( !toHash.empty() ) {
+                push([this,toHash]() mutable { hash_files(das::move(toHash)); });
+            }
+            done(batch);
+        }
+    };
+
+    // blocks until the walk is done, so it must not be called from a job on the with_job_que que
+    uint64_t builtin_dir_walk ( const char * path, const char * pattern, uint32_t flags, int32_t batchSize, const TBlock<void,TTemporary<TArray<DirWalkEntry>>> & blk, Context * context, LineInfoArg * at ) {
+        if ( !path ) context->throw_error_at(*at, "can't walk NULL path");
+        if ( batchSize<=0 ) batchSize = 1024;
+        uint64_t total = 0;
+        bool ok;
+        {
+            DirWalker walker;
+            walker.pattern = pattern ? pattern : "";
+            walker.flags = flags;
+            string root = path;
+            while ( root.size()>1 && (root.back()=='/' || root.back()=='\\') ) root.pop_back();
+            walker.push([&walker,root]() { walker.walk(root); });
+            // panic in the block unwinds (or longjmps) past this frame. so it is caught here,
+            // the walker is cancelled and destroyed once its jobs are done, and only then the panic goes on
+            ok = context->runWithCatch([&]() {
+                for ( ;; ) {
+                    DirWalkBatch batch;
+                    {
+                        unique_lock<mutex> lock(walker.readyMutex);
+                        walker.readyCond.wait(lock, [&]() { return walker.readyCount>=size_t(batchSize) || walker.outstanding==0; });
+                        if ( walker.ready.empty() ) break;
+                        // coalesce small per-directory batches, until the batch is full
+                        batch = das::move(walker.ready.front());
+                        walker.ready.pop_front();
+                        while ( !walker.ready.empty() && batch.entries.size() + walker.ready.front().entries.size() <= size_t(batchSize) ) {
+                            batch.append(walker.ready.front());
+                            walker.ready.pop_front();
+                        }
+                        walker.readyCount -= batch.entries.size();
+                    }
+                    for ( size_t i=0, is=batch.entries.size(); i!=is; ++i ) {
+                        batch.entries[i].path = batch.text.data() + batch.names[i];
+                    }
+                    for ( size_t ofs=0, is=batch.entries.size(); ofs<is; ofs+=batchSize ) {
+                        Array arr = {};
+                        arr.data = (char *) (batch.entries.data() + ofs);
+                        arr.capacity = arr.size = uint32_t(min(is - ofs, size_t(batchSize)));
+                        arr.lock = 1;
+                        vec4f args[1];
+                        args[0] = cast<Array *>::from(&arr);
+                        context->invoke(blk, args, nullptr, at);
+                        total += arr.size;
+                    }
+                }
+            });
+        }
+        if ( !ok ) context->rethrow();
+        return total;
+    }
+
     bool builtin_mkdir ( const char * path ) {
         if ( path ) {
 #if defined(_MSC_VER)
@@ -453,10 +919,30 @@ namespace das {
             // type
             addAnnotation(make_smart<FileAnnotation>(lib));
             addAnnotation(make_smart<FStatAnnotation>(lib));
+            addAnnotation(make_smart<FileMapAnnotation>(lib));
+            addAnnotation(make_smart<AsyncFileIOAnnotation>(lib));
+            addAnnotation(make_smart<AsyncFileResultAnnotation>(lib));
+            addAnnotation(make_smart<DirWalkEntryAnnotation>(lib));
             // seek constants
             addConstant<int32_t>(*this, "seek_set", SEEK_SET);
             addConstant<int32_t>(*this, "seek_cur", SEEK_CUR);
             addConstant<int32_t>(*this, "seek_end", SEEK_END);
+            // file map advice
+            addConstant<int32_t>(*this, "madv_normal", 0);
+            addConstant<int32_t>(*this, "madv_sequential", 1);
+            addConstant<int32_t>(*this, "madv_random", 2);
+            addConstant<int32_t>(*this, "madv_willneed", 3);
+            addConstant<int32_t>(*this, "madv_dontneed", 4);
+            // dir walk flags
+            addConstant<uint32_t>(*this, "walk_recursive", walk_recursive);
+            addConstant<uint32_t>(*this, "walk_stat", walk_stat);
+            addConstant<uint32_t>(*this, "walk_hash", walk_hash);
+            addConstant<uint32_t>(*this, "walk_dirs", walk_dirs);
+            // async io operations
+            addConstant<int32_t>(*this, "async_read", int32_t(AsyncFileOp::read));
+            addConstant<int32_t>(*this, "async_write", int32_t(AsyncFileOp::write));
+            addConstant<int32_t>(*this, "async_append", int32_t(AsyncFileOp::append));
+            addConstant<int32_t>(*this, "async_stat", int32_t(AsyncFileOp::stat));
             // file io
             addExtern<DAS_BIND_FUN(builtin_fopen)>(*this, lib, "fopen",
                 SideEffects::modifyExternal, "builtin_fopen")
@@ -473,6 +959,62 @@ namespace das {
             addExtern<DAS_BIND_FUN(builtin_map_file)>(*this, lib, "fmap",
                 SideEffects::modifyExternal, "builtin_map_file")
                     ->args({"file","block","context","line"});
+            // memory mapped files
+            addExtern<DAS_BIND_FUN(builtin_fmap_open)>(*this, lib, "fmap_open",
+                SideEffects::modifyExternal, "builtin_fmap_open")
+                    ->arg("name");
+            addExtern<DAS_BIND_FUN(builtin_fmap_close)>(*this, lib, "fmap_close",
+                SideEffects::modifyExternal, "builtin_fmap_close")
+                    ->args({"map","context","line"});
+            addExtern<DAS_BIND_FUN(builtin_fmap_size)>(*this, lib, "fmap_size",
+                SideEffects::none, "builtin_fmap_size")
+                    ->args({"map","context","line"});
+            addExtern<DAS_BIND_FUN(builtin_fmap_advise)>(*this, lib, "fmap_advise",
+                SideEffects::modifyExternal, "builtin_fmap_advise")
+                    ->args({"map","advice","context","line"});
+            addExtern<DAS_BIND_FUN(builtin_fmap_view)>(*this, lib, "fmap_view",
+                SideEffects::modifyExternal, "builtin_fmap_view")
+                    ->args({"map","offset","length","block","context","line"});
+            addExtern<DAS_BIND_FUN(builtin_fmap_lines)>(*this, lib, "fmap_lines",
+                SideEffects::modifyExternal, "builtin_fmap_lines")
+                    ->args({"map","block","context","line"});
+            addExtern<DAS_BIND_FUN(builtin_fmap_records)>(*this, lib, "fmap_records",
+                SideEffects::modifyExternal, "builtin_fmap_records")
+                    ->args({"map","delimiter","block","context","line"});
+            // async file io
+            addExtern<DAS_BIND_FUN(builtin_async_io_create)>(*this, lib, "async_io_create",
+                SideEffects::modifyExternal, "builtin_async_io_create")
+                    ->arg("threads")
+                        ->arg_init(0, make_smart<ExprConstInt>(0));
+            addExtern<DAS_BIND_FUN(builtin_async_io_destroy)>(*this, lib, "async_io_destroy",
+                SideEffects::modifyExternal, "builtin_async_io_destroy")
+                    ->args({"io","context","line"});
+            addExtern<DAS_BIND_FUN(builtin_async_io_read)>(*this, lib, "async_io_read",
+                SideEffects::modifyExternal, "builtin_async_io_read")
+                    ->args({"io","name","context","line"});
+            addExtern<DAS_BIND_FUN(builtin_async_io_write)>(*this, lib, "async_io_write",
+                SideEffects::modifyExternal, "builtin_async_io_write")
+                    ->args({"io","name","text","append","context","line"})
+                        ->arg_init(3, make_smart<ExprConstBool>(false));
+            addExtern<DAS_BIND_FUN(builtin_async_io_write_bytes)>(*this, lib, "async_io_write",
+                SideEffects::modifyExternal, "builtin_async_io_write_bytes")
+                    ->args({"io","name","data","append","context","line"})
+                        ->arg_init(3, make_smart<ExprConstBool>(false));
+            addExtern<DAS_BIND_FUN(builtin_async_io_stat)>(*this, lib, "async_io_stat",
+                SideEffects::modifyExternal, "builtin_async_io_stat")
+                    ->args({"io","name","context","line"});
+            addExtern<DAS_BIND_FUN(builtin_async_io_submit)>(*this, lib, "async_io_submit",
+                SideEffects::modifyExternal, "builtin_async_io_submit")
+                    ->args({"io","context","line"});
+            addExtern<DAS_BIND_FUN(builtin_async_io_pending)>(*this, lib, "async_io_pending",
+                SideEffects::accessExternal, "builtin_async_io_pending")
+                    ->args({"io","context","line"});
+            addExtern<DAS_BIND_FUN(builtin_async_io_in_flight)>(*this, lib, "async_io_in_flight",
+                SideEffects::accessExternal, "builtin_async_io_in_flight")
+                    ->args({"io","context","line"});
+            addExtern<DAS_BIND_FUN(builtin_async_io_poll)>(*this, lib, "async_io_poll",
+                SideEffects::modifyExternal, "builtin_async_io_poll")
+                    ->args({"io","timeout","block","context","line"});
             addExtern<DAS_BIND_FUN(builtin_fgets)>(*this, lib, "fgets",
                 SideEffects::modifyExternal, "builtin_fgets")
                     ->args({"file","context","line"});
@@ -513,6 +1055,9 @@ namespace das {
             addExtern<DAS_BIND_FUN(builtin_dir)>(*this, lib, "builtin_dir",
                 SideEffects::modifyExternal, "builtin_dir")
                     ->args({"path","block","context","line"});
+            addExtern<DAS_BIND_FUN(builtin_dir_walk)>(*this, lib, "builtin_dir_walk",
+                SideEffects::modifyExternal, "builtin_dir_walk")
+                    ->args({"path","pattern","flags","batch","block","context","line"});
             addExtern<DAS_BIND_FUN(builtin_mkdir)>(*this, lib, "mkdir",
                 SideEffects::modifyExternal, "builtin_mkdir")
                     ->arg("path");
@@ -547,6 +1092,7 @@ namespace das {
         }
         virtual ModuleAotType aotRequire ( TextWriter & tw ) const override {
             tw << "#include \"daScript/misc/performance_time.h\"\n";
+            tw << "#include \"daScript/misc/async_file_io.h\"\n";
             tw << "#include \"daScript/simulate/aot_builtin_fio.h\"\n";
             return ModuleAotType::cpp;
         }
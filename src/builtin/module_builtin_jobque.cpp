@@ -7,6 +7,8 @@
 
 MAKE_TYPE_FACTORY(JobStatus, JobStatus)
 MAKE_TYPE_FACTORY(Channel, Channel)
+MAKE_TYPE_FACTORY(Coroutine, Coroutine)
+MAKE_TYPE_FACTORY(CoroutineScheduler, CoroutineScheduler)
 
 namespace das {
 
@@ -128,6 +130,253 @@ namespace das {
         }
     };
 
+    // coroutines
+
+    #define DAS_COROUTINE_STACK_SIZE        (4*1024)
+    #define DAS_COROUTINE_NATIVE_STACK_SIZE (64*1024)
+
+    DAS_THREAD_LOCAL Coroutine * Coroutine::current = nullptr;
+
+    CoroutineFrames::CoroutineFrames ( uint32_t stackSize, uint32_t nativeStackSize ) : stack(stackSize) {
+        fiber = fiberCreate(nativeStackSize, &Coroutine::entry, this);
+    }
+
+    CoroutineFrames::~CoroutineFrames() {
+        fiberDestroy(fiber);
+    }
+
+    Coroutine::Coroutine ( Context * ctx, const Lambda & lmb, const LineInfo & a ) : context(ctx), lambda(lmb), at(a) {
+        caller = fiberCreate(0, nullptr, nullptr);
+    }
+
+    Coroutine::~Coroutine() {
+        // suspended coroutine is abandoned with whatever is on its stack. its frames can't be reused
+        if ( frames ) delete frames;
+        if ( lambda.capture ) {
+            context->runWithCatch([&](){
+                das_delete<Lambda>::clear(context, lambda);
+            });
+        }
+        fiberDestroy(caller);
+    }
+
+    void Coroutine::entry ( void * arg ) {
+        auto fr = (CoroutineFrames *) arg;
+        for ( ;; ) {
+            auto co = fr->owner;
+            co->body();
+            fiberSwitch(fr->fiber, co->caller);
+        }
+    }
+
+    void Coroutine::body() {
+        bool ok = context->runWithCatch([&](){
+            das_invoke_lambda<void>::invoke(context, &at, lambda);
+            das_delete<Lambda>::clear(context, lambda);
+        });
+        status = ok ? Status::finished : Status::failed;
+    }
+
+    void Coroutine::swapRegisters() {
+        StackAllocator tmp(0);
+        tmp.copy(context->stack);
+        context->stack.copy(frames->stack);
+        frames->stack.copy(tmp);
+        tmp.letGo();
+        swap(abiArg, context->abiArg);
+        swap(abiThisBlockArg, context->abiThisBlockArg);
+        swap(abiCMRES, context->abiCMRES);
+#if !DAS_ENABLE_EXCEPTIONS
+        swap(throwBuf, context->throwBuf);
+#endif
+    }
+
+    bool Coroutine::resume ( LineInfoArg * lineAt ) {
+        if ( isFinished() ) return false;
+        if ( status==Status::running ) context->throw_error_at(lineAt ? *lineAt : at, "coroutine is already running");
+        if ( !frames ) {
+            frames = scheduler->acquireFrames();
+            if ( !frames->fiber ) {
+                scheduler->releaseFrames(frames);
+                frames = nullptr;
+                context->throw_error_at(lineAt ? *lineAt : at, "can't allocate coroutine stack");
+            }
+            frames->owner = this;
+            frames->stack.reset();
+        }
+        swapRegisters();
+        status = Status::running;
+        prev = current;
+        current = this;
+        fiberSwitch(caller, frames->fiber);
+        current = prev;
+        prev = nullptr;
+        swapRegisters();
+        if ( !isFinished() ) return true;
+        frames->owner = nullptr;
+        scheduler->releaseFrames(frames);
+        frames = nullptr;
+        if ( status==Status::failed ) context->rethrow();
+        return false;
+    }
+
+    void Coroutine::suspend () {
+        status = Status::suspended;
+        fiberSwitch(frames->fiber, caller);
+    }
+
+    CoroutineScheduler::CoroutineScheduler ( Context * ctx, uint32_t ss, uint32_t nss )
+        : context(ctx), stackSize(ss), nativeStackSize(nss) {
+    }
+
+    CoroutineScheduler::~CoroutineScheduler() {
+        for ( auto co : alive ) delete co;
+        for ( auto co : done ) delete co;
+        for ( auto fr : pool ) delete fr;
+    }
+
+    CoroutineFrames * CoroutineScheduler::acquireFrames() {
+        if ( pool.empty() ) return new CoroutineFrames(stackSize, nativeStackSize);
+        auto fr = pool.back();
+        pool.pop_back();
+        return fr;
+    }
+
+    void CoroutineScheduler::releaseFrames ( CoroutineFrames * fr ) {
+        pool.push_back(fr);
+    }
+
+    Coroutine * CoroutineScheduler::spawn ( const Lambda & lambda, LineInfoArg * at ) {
+        auto co = new Coroutine(context, lambda, at ? *at : LineInfo());
+        co->scheduler = this;
+        alive.push_back(co);
+        return co;
+    }
+
+    int32_t CoroutineScheduler::step ( LineInfoArg * at ) {
+        // coroutines, spawned during this step, start on the next one
+        for ( size_t i=0, n=alive.size(); i!=n; ++i ) {
+            if ( alive[i]->isSuspended() ) alive[i]->resume(at);
+        }
+        size_t j = 0;
+        for ( auto co : alive ) {
+            if ( co->isFinished() ) {
+                done.push_back(co);
+            } else {
+                alive[j++] = co;
+            }
+        }
+        alive.resize(j);
+        return int32_t(alive.size());
+    }
+
+    void CoroutineScheduler::run ( LineInfoArg * at ) {
+        while ( step(at) ) {}
+    }
+
+    int32_t CoroutineScheduler::suspended() const {
+        int32_t count = 0;
+        for ( auto co : alive ) {
+            if ( co->frames ) count ++;
+        }
+        return count;
+    }
+
+    void withCoroutines ( const TBlock<void,CoroutineScheduler *> & block, Context * context, LineInfoArg * at ) {
+        withCoroutinesEx(DAS_COROUTINE_STACK_SIZE, DAS_COROUTINE_NATIVE_STACK_SIZE, block, context, at);
+    }
+
+    void withCoroutinesEx ( int32_t stackSize, int32_t nativeStackSize, const TBlock<void,CoroutineScheduler *> & block, Context * context, LineInfoArg * at ) {
+        if ( stackSize<=0 || nativeStackSize<=0 ) context->throw_error_at(*at, "coroutine stack size must be positive");
+        bool ok;
+        int32_t abandoned;
+        {
+            CoroutineScheduler sched(context, uint32_t(stackSize), uint32_t(nativeStackSize));
+            vec4f args[1];
+            args[0] = cast<CoroutineScheduler *>::from(&sched);
+            ok = context->runWithCatch([&]() {
+                context->invoke(block, args, nullptr, at);
+            });
+            abandoned = sched.suspended();
+        }
+        if ( !ok ) context->rethrow();
+        // suspended coroutine is destroyed without unwinding, so whatever it holds (array or table locks, etc) stays held
+        if ( abandoned ) context->throw_error_at(*at, "with_coroutines exits with %i suspended coroutine(s), run the scheduler until they are finished", abandoned);
+    }
+
+    Coroutine * coroutineSpawn ( CoroutineScheduler * sched, TLambda<void> lambda, Context * context, LineInfoArg * at ) {
+        if ( !sched ) context->throw_error_at(*at, "expecting coroutine scheduler");
+        if ( !lambda.capture ) context->throw_error_at(*at, "can't spawn null lambda");
+        return sched->spawn(lambda, at);
+    }
+
+    bool coroutineResume ( Coroutine * co, Context * context, LineInfoArg * at ) {
+        if ( !co ) context->throw_error_at(*at, "can't resume null coroutine");
+        return co->resume(at);
+    }
+
+    int32_t coroutineStep ( CoroutineScheduler * sched, Context * context, LineInfoArg * at ) {
+        if ( !sched ) context->throw_error_at(*at, "expecting coroutine scheduler");
+        return sched->step(at);
+    }
+
+    void coroutineRun ( CoroutineScheduler * sched, Context * context, LineInfoArg * at ) {
+        if ( !sched ) context->throw_error_at(*at, "expecting coroutine scheduler");
+        sched->run(at);
+    }
+
+    void coroutineYield ( Context * context, LineInfoArg * at ) {
+        auto co = Coroutine::getCurrent();
+        if ( !co ) context->throw_error_at(*at, "coroutine_yield outside of coroutine");
+        co->suspend();
+    }
+
+    bool isInCoroutine () {
+        return Coroutine::getCurrent()!=nullptr;
+    }
+
+    void awaitCoroutine ( Coroutine * co, Context * context, LineInfoArg * at ) {
+        if ( !co ) return;
+        if ( co==Coroutine::getCurrent() ) context->throw_error_at(*at, "coroutine can't await itself");
+        if ( Coroutine::getCurrent() ) {
+            while ( !co->isFinished() ) Coroutine::getCurrent()->suspend();
+        } else {
+            while ( co->resume(at) ) {}
+        }
+    }
+
+    void awaitJob ( JobStatus * status, Context *, LineInfoArg * ) {
+        if ( !status ) return;
+        if ( auto co = Coroutine::getCurrent() ) {
+            while ( !status->isReady() ) co->suspend();
+        } else {
+            status->Wait();
+        }
+    }
+
+    void awaitChannel ( Channel * ch, Context *, LineInfoArg * ) {
+        if ( !ch ) return;
+        if ( auto co = Coroutine::getCurrent() ) {
+            while ( !ch->isReady() ) co->suspend();
+        } else {
+            ch->wait();
+        }
+    }
+
+    struct CoroutineAnnotation : ManagedStructureAnnotation<Coroutine,false> {
+        CoroutineAnnotation(ModuleLibrary & ml) : ManagedStructureAnnotation ("Coroutine", ml) {
+            addProperty<DAS_BIND_MANAGED_PROP(isFinished)>("isFinished");
+            addProperty<DAS_BIND_MANAGED_PROP(isSuspended)>("isSuspended");
+        }
+    };
+
+    struct CoroutineSchedulerAnnotation : ManagedStructureAnnotation<CoroutineScheduler,false> {
+        CoroutineSchedulerAnnotation(ModuleLibrary & ml) : ManagedStructureAnnotation ("CoroutineScheduler", ml) {
+            addProperty<DAS_BIND_MANAGED_PROP(size)>("size");
+            addProperty<DAS_BIND_MANAGED_PROP(pooled)>("pooled");
+        }
+    };
+
     mutex              g_jobQueMutex;
     shared_ptr<JobQue> g_jobQue;
 
@@ -183,19 +432,22 @@ namespace das {
         }).detach();
     }
 
+    shared_ptr<JobQue> acquireJobQue() {
+        lock_guard<mutex> guard(g_jobQueMutex);
+        if ( !g_jobQue ) g_jobQue = make_shared<JobQue>();
+        return g_jobQue;
+    }
+
+    void releaseJobQue ( shared_ptr<JobQue> & jq ) {
+        lock_guard<mutex> guard(g_jobQueMutex);
+        jq.reset();
+        if ( g_jobQue.use_count()==1 ) g_jobQue.reset();
+    }
+
     void withJobQue ( const TBlock<void> & block, Context * context, LineInfoArg * lineInfo ) {
-        if ( !g_jobQue ) {
-            lock_guard<mutex> guard(g_jobQueMutex);
-            g_jobQue = make_shared<JobQue>();
-        }
-        {
-            shared_ptr<JobQue> jq = g_jobQue;
-            context->invoke(block, nullptr, nullptr, lineInfo);
-        }
-        {
-            lock_guard<mutex> guard(g_jobQueMutex);
-            if ( g_jobQue.use_count()==1 ) g_jobQue.reset();
-        }
+        auto jq = acquireJobQue();
+        context->invoke(block, nullptr, nullptr, lineInfo);
+        releaseJobQue(jq);
     }
 
     void withJobStatus ( int32_t total, const TBlock<void,JobStatus *> & block, Context * context, LineInfoArg * lineInfo ) {
@@ -285,6 +537,41 @@ namespace das {
                     ->args({"lambda","function","lambdaSize","context","line"});
             addExtern<DAS_BIND_FUN(is_job_que_shutting_down)>(*this, lib,  "is_job_que_shutting_down",
                 SideEffects::modifyExternal, "is_job_que_shutting_down");
+            // coroutines
+            addAnnotation(make_smart<CoroutineAnnotation>(lib));
+            addAnnotation(make_smart<CoroutineSchedulerAnnotation>(lib));
+            addExtern<DAS_BIND_FUN(withCoroutines)>(*this, lib,  "with_coroutines",
+                SideEffects::invoke, "withCoroutines")
+                    ->args({"block","context","line"});
+            addExtern<DAS_BIND_FUN(withCoroutinesEx)>(*this, lib,  "with_coroutines",
+                SideEffects::invoke, "withCoroutinesEx")
+                    ->args({"stackSize","nativeStackSize","block","context","line"});
+            addExtern<DAS_BIND_FUN(coroutineSpawn)>(*this, lib,  "spawn",
+                SideEffects::modifyArgumentAndExternal, "coroutineSpawn")
+                    ->args({"scheduler","lambda","context","line"});
+            addExtern<DAS_BIND_FUN(coroutineResume)>(*this, lib,  "resume",
+                SideEffects::modifyArgumentAndExternal, "coroutineResume")
+                    ->args({"coroutine","context","line"});
+            addExtern<DAS_BIND_FUN(coroutineStep)>(*this, lib,  "step",
+                SideEffects::modifyArgumentAndExternal, "coroutineStep")
+                    ->args({"scheduler","context","line"});
+            addExtern<DAS_BIND_FUN(coroutineRun)>(*this, lib,  "run",
+                SideEffects::modifyArgumentAndExternal, "coroutineRun")
+                    ->args({"scheduler","context","line"});
+            addExtern<DAS_BIND_FUN(coroutineYield)>(*this, lib,  "coroutine_yield",
+                SideEffects::modifyExternal, "coroutineYield")
+                    ->args({"context","line"});
+            addExtern<DAS_BIND_FUN(isInCoroutine)>(*this, lib,  "is_in_coroutine",
+                SideEffects::accessExternal, "isInCoroutine");
+            addExtern<DAS_BIND_FUN(awaitCoroutine)>(*this, lib,  "await",
+                SideEffects::modifyArgumentAndExternal, "awaitCoroutine")
+                    ->args({"coroutine","context","line"});
+            addExtern<DAS_BIND_FUN(awaitJob)>(*this, lib,  "await",
+                SideEffects::modifyExternal, "awaitJob")
+                    ->args({"job","context","line"});
+            addExtern<DAS_BIND_FUN(awaitChannel)>(*this, lib,  "await",
+                SideEffects::modifyExternal, "awaitChannel")
+                    ->args({"channel","context","line"});
         }
         virtual ModuleAotType aotRequire ( TextWriter & tw ) const override {
             tw << "#include \"daScript/simulate/aot_builtin_jobque.h\"\n";
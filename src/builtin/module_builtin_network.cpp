@@ -7,6 +7,7 @@
 #include "module_builtin_rtti.h"
 
 MAKE_TYPE_FACTORY(NetworkServer,Server)
+MAKE_TYPE_FACTORY(NetworkMultiServer,MultiServer)
 
 namespace das {
 
@@ -70,12 +71,77 @@ namespace das {
         Context *   context;
     };
 
+    class MultiServerAdapter : public MultiServer {
+    public:
+        MultiServerAdapter(char * pClass, const StructInfo * info, Context * ctx ) {
+            update(pClass,info,ctx);
+        }
+        void update ( char * pClass, const StructInfo * info, Context * ctx ) {
+            context = ctx;
+            classPtr = pClass;
+            pServer = (void **) adapt_field("_server",pClass,info);
+            if ( pServer ) *pServer = this;
+            fnOnConnect = adapt("onConnect",pClass,info);
+            fnOnDisconnect = adapt("onDisconnect",pClass,info);
+            fnOnData = adapt("onData",pClass,info);
+            fnOnError = adapt("onError",pClass,info);
+            fnOnLog = adapt("onLog",pClass,info);
+        }
+        virtual void onConnect ( int32_t id ) override {
+            if ( fnOnConnect ) {
+                return das_invoke_function<void>::invoke<void *,int32_t>
+                    (context,nullptr,fnOnConnect,classPtr,id);
+            }
+        }
+        virtual void onDisconnect ( int32_t id ) override {
+            if ( fnOnDisconnect ) {
+                return das_invoke_function<void>::invoke<void *,int32_t>
+                    (context,nullptr,fnOnDisconnect,classPtr,id);
+            }
+        }
+        virtual void onData ( int32_t id, char * buf, int size ) override {
+            if ( fnOnData ) {
+                return das_invoke_function<void>::invoke<void *,int32_t,char *,int32_t>
+                    (context,nullptr,fnOnData,classPtr,id,buf,size);
+            }
+        }
+        virtual void onError ( int32_t id, const char * msg, int code ) override {
+            if ( fnOnError ) {
+                return das_invoke_function<void>::invoke<void *,int32_t,const char *,int32_t>
+                    (context,nullptr,fnOnError,classPtr,id,msg,code);
+            }
+        }
+        virtual void onLog ( const char * msg ) override {
+            if ( fnOnLog ) {
+                return das_invoke_function<void>::invoke<void *,const char *>
+                    (context,nullptr,fnOnLog,classPtr,msg);
+            }
+        }
+        bool isValid() const { return pServer != nullptr; }
+    protected:
+        void ** pServer = nullptr;
+        Func    fnOnConnect;
+        Func    fnOnDisconnect;
+        Func    fnOnData;
+        Func    fnOnError;
+        Func    fnOnLog;
+    protected:
+        void *      classPtr;
+        Context *   context;
+    };
+
     struct ServerAnnotation : ManagedStructureAnnotation<Server> {
         ServerAnnotation(ModuleLibrary & ml)
             : ManagedStructureAnnotation ("NetworkServer", ml, "Server") {
         }
     };
 
+    struct MultiServerAnnotation : ManagedStructureAnnotation<MultiServer> {
+        MultiServerAnnotation(ModuleLibrary & ml)
+            : ManagedStructureAnnotation ("NetworkMultiServer", ml, "MultiServer") {
+        }
+    };
+
     #include "network.das.inc"
 
     bool makeServer ( const void * pClass, const StructInfo * info, Context * context ) {
@@ -117,6 +183,59 @@ namespace das {
         adapter->update((char *)pClass,info,context);
     }
 
+    bool makeMultiServer ( const void * pClass, const StructInfo * info, Context * context ) {
+        needShutdown = needShutdown || Server::startup();
+        auto server = make_smart<MultiServerAdapter>((char *)pClass,info,context);
+        if ( !server->isValid() ) return false;
+        server.orphan();
+        return true;
+    }
+
+    bool multi_server_init ( smart_ptr_raw<MultiServer> server, int port, Context * context ) {
+        if ( !server ) context->throw_error("null server");
+        return server->init(port);
+    }
+
+    int32_t multi_server_connect ( smart_ptr_raw<MultiServer> server, const char * host, int port, Context * context ) {
+        if ( !server ) context->throw_error("null server");
+        return server->connect(host ? host : "127.0.0.1", port);
+    }
+
+    bool multi_server_is_open ( smart_ptr_raw<MultiServer> server, Context * context ) {
+        if ( !server ) context->throw_error("null server");
+        return server->is_open();
+    }
+
+    int32_t multi_server_tick ( smart_ptr_raw<MultiServer> server, int32_t timeoutMs, Context * context ) {
+        if ( !server ) context->throw_error("null server");
+        return server->tick(timeoutMs);
+    }
+
+    bool multi_server_send ( smart_ptr_raw<MultiServer> server, int32_t id, uint8_t * data, int32_t size, Context * context ) {
+        if ( !server ) context->throw_error("null server");
+        return server->send_msg(id, (char *)data, size);
+    }
+
+    void multi_server_flush ( smart_ptr_raw<MultiServer> server, Context * context ) {
+        if ( !server ) context->throw_error("null server");
+        server->flush();
+    }
+
+    void multi_server_close ( smart_ptr_raw<MultiServer> server, int32_t id, Context * context ) {
+        if ( !server ) context->throw_error("null server");
+        server->close(id);
+    }
+
+    int32_t multi_server_connections ( smart_ptr_raw<MultiServer> server, Context * context ) {
+        if ( !server ) context->throw_error("null server");
+        return server->connections();
+    }
+
+    int32_t multi_server_pooled_buffers ( smart_ptr_raw<MultiServer> server, Context * context ) {
+        if ( !server ) context->throw_error("null server");
+        return server->pooled_buffers();
+    }
+
     class Module_Network : public Module {
     public:
         Module_Network() : Module("network") {
@@ -148,6 +267,38 @@ namespace das {
             addExtern<DAS_BIND_FUN(server_restore)>(*this, lib,  "server_restore",
                 SideEffects::modifyArgumentAndExternal, "server_restore")
                     ->args({"server","class","info","context"});
+            // multi-connection server
+            addAnnotation(make_smart<MultiServerAnnotation>(lib));
+            addExtern<DAS_BIND_FUN(makeMultiServer)>(*this, lib,  "make_multi_server",
+                SideEffects::modifyArgumentAndExternal, "makeMultiServer")
+                    ->args({"class","info","context"});
+            addExtern<DAS_BIND_FUN(multi_server_init)>(*this, lib,  "multi_server_init",
+                SideEffects::modifyArgumentAndExternal, "multi_server_init")
+                    ->args({"server","port","context"});
+            addExtern<DAS_BIND_FUN(multi_server_connect)>(*this, lib,  "multi_server_connect",
+                SideEffects::modifyArgumentAndExternal, "multi_server_connect")
+                    ->args({"server","host","port","context"});
+            addExtern<DAS_BIND_FUN(multi_server_is_open)>(*this, lib,  "multi_server_is_open",
+                SideEffects::modifyArgumentAndExternal, "multi_server_is_open")
+                    ->args({"server","context"});
+            addExtern<DAS_BIND_FUN(multi_server_tick)>(*this, lib,  "multi_server_tick",
+                SideEffects::modifyArgumentAndExternal, "multi_server_tick")
+                    ->args({"server","timeout","context"});
+            addExtern<DAS_BIND_FUN(multi_server_send)>(*this, lib,  "multi_server_send",
+                SideEffects::modifyArgumentAndExternal, "multi_server_send")
+                    ->args({"server","id","data","size","context"});
+            addExtern<DAS_BIND_FUN(multi_server_flush)>(*this, lib,  "multi_server_flush",
+                SideEffects::modifyArgumentAndExternal, "multi_server_flush")
+                    ->args({"server","context"});
+            addExtern<DAS_BIND_FUN(multi_server_close)>(*this, lib,  "multi_server_close",
+                SideEffects::modifyArgumentAndExternal, "multi_server_close")
+                    ->args({"server","id","context"});
+            addExtern<DAS_BIND_FUN(multi_server_connections)>(*this, lib,  "multi_server_connections",
+                SideEffects::modifyArgumentAndExternal, "multi_server_connections")
+                    ->args({"server","context"});
+            addExtern<DAS_BIND_FUN(multi_server_pooled_buffers)>(*this, lib,  "multi_server_pooled_buffers",
+                SideEffects::modifyArgumentAndExternal, "multi_server_pooled_buffers")
+                    ->args({"server","context"});
             // add builtin module
             compileBuiltinModule("network.das",network_das,sizeof(network_das));
         }
@@ -593,8 +593,10 @@ namespace das {
         // aot
             addField<DAS_BIND_MANAGED_FIELD(aot)>("aot");
             addField<DAS_BIND_MANAGED_FIELD(aot_module)>("aot_module");
+            addField<DAS_BIND_MANAGED_FIELD(aot_lib)>("aot_lib");
         // memory
             addField<DAS_BIND_MANAGED_FIELD(stack)>("stack");
+            addField<DAS_BIND_MANAGED_FIELD(max_stack)>("max_stack");
             addField<DAS_BIND_MANAGED_FIELD(intern_strings)>("intern_strings");
             addField<DAS_BIND_MANAGED_FIELD(persistent_heap)>("persistent_heap");
             addField<DAS_BIND_MANAGED_FIELD(multiple_contexts)>("multiple_contexts");
@@ -433,6 +433,18 @@ namespace das
         return (int32_t) context->stringHeap->depth();
     }
 
+    uint64_t stack_bytes_committed ( Context * context ) {
+        return context->stack.bytesCommitted();
+    }
+
+    uint64_t stack_peak_bytes_committed ( Context * context ) {
+        return context->stack.peakBytesCommitted();
+    }
+
+    uint64_t stack_segments_allocated ( Context * context ) {
+        return context->stack.segmentAllocations();
+    }
+
     void string_heap_collect ( bool validate, Context * context, LineInfoArg * info ) {
         context->collectStringHeap(info,validate);
     }
@@ -462,9 +474,59 @@ namespace das
         context->heap->report();
         */
         context->reportAnyHeap(info,true,true,false,errOnly);
+        if ( auto profiler = context->getAllocationProfiler() ) {
+            LOG tp(LogLevel::debug);
+            profiler->report(tp, 32);
+        }
         multiline_log = true;
     }
 
+    void allocation_profiler ( bool enable, int32_t sampleInterval, Context * context ) {
+        context->setAllocationProfiler(enable, uint32_t(das::max(sampleInterval, 1)));
+    }
+
+    void allocation_profiler_report ( int32_t top, Context * context ) {
+        if ( auto profiler = context->getAllocationProfiler() ) {
+            TextWriter tw;
+            profiler->report(tw, top);
+            context->to_out(tw.str().c_str());
+        } else {
+            context->to_out("allocation profiler is not enabled\n");
+        }
+    }
+
+    void allocation_profiler_sites ( const TBlock<void,const char *,int32_t,bool,uint64_t,uint64_t,uint64_t,uint64_t> & block,
+            Context * context, LineInfoArg * at ) {
+        auto profiler = context->getAllocationProfiler();
+        if ( !profiler ) return;
+        auto sites = profiler->getSites();  // copy, block can allocate
+        for ( auto & site : sites ) {
+            if ( !site.count ) continue;
+            das_invoke<void>::invoke<const char *,int32_t,bool,uint64_t,uint64_t,uint64_t,uint64_t>(context, at, block,
+                site.func ? site.func->name : nullptr, site.at ? int32_t(site.at->line) : 0, site.strings,
+                site.count, site.bytes, site.liveCount, site.liveBytes);
+        }
+    }
+
+    void function_profiler ( bool enable, Context * context ) {
+        context->setFunctionProfiler(enable);
+    }
+
+    void function_profiler_report ( int32_t top, Context * context ) {
+        if ( auto profiler = context->getFunctionProfiler() ) {
+            TextWriter tw;
+            profiler->report(tw, top);
+            context->to_out(tw.str().c_str());
+        } else {
+            context->to_out("function profiler is not enabled\n");
+        }
+    }
+
+    bool function_profiler_save ( const char * fileName, Context * context ) {
+        auto profiler = context->getFunctionProfiler();
+        return profiler && fileName && profiler->save(fileName);
+    }
+
     void builtin_table_lock ( const Table & arr, Context * context ) {
         table_lock(*context, const_cast<Table&>(arr));
     }
@@ -1086,6 +1148,15 @@ namespace das
         addExtern<DAS_BIND_FUN(string_heap_depth)>(*this, lib, "string_heap_depth",
             SideEffects::modifyExternal, "string_heap_depth")
                 ->arg("context");
+        addExtern<DAS_BIND_FUN(stack_bytes_committed)>(*this, lib, "stack_bytes_committed",
+            SideEffects::modifyExternal, "stack_bytes_committed")
+                ->arg("context");
+        addExtern<DAS_BIND_FUN(stack_peak_bytes_committed)>(*this, lib, "stack_peak_bytes_committed",
+            SideEffects::modifyExternal, "stack_peak_bytes_committed")
+                ->arg("context");
+        addExtern<DAS_BIND_FUN(stack_segments_allocated)>(*this, lib, "stack_segments_allocated",
+            SideEffects::modifyExternal, "stack_segments_allocated")
+                ->arg("context");
         auto shcol = addExtern<DAS_BIND_FUN(string_heap_collect)>(*this, lib, "string_heap_collect",
             SideEffects::modifyExternal, "string_heap_collect")
                 ->args({"validate","context","at"});
@@ -1106,6 +1177,27 @@ namespace das
         addExtern<DAS_BIND_FUN(memory_report)>(*this, lib, "memory_report",
             SideEffects::modifyExternal, "memory_report")
                 ->args({"errorsOnly","context","lineinfo"});
+        auto apf = addExtern<DAS_BIND_FUN(allocation_profiler)>(*this, lib, "allocation_profiler",
+            SideEffects::modifyExternal, "allocation_profiler")
+                ->args({"enable","sample_interval","context"});
+        apf->arguments[1]->init = make_smart<ExprConstInt>(int32_t(AllocationProfiler::defaultSampleInterval));
+        auto apr = addExtern<DAS_BIND_FUN(allocation_profiler_report)>(*this, lib, "allocation_profiler_report",
+            SideEffects::modifyExternal, "allocation_profiler_report")
+                ->args({"top","context"});
+        apr->arguments[0]->init = make_smart<ExprConstInt>(32);
+        addExtern<DAS_BIND_FUN(allocation_profiler_sites)>(*this, lib, "allocation_profiler_sites",
+            SideEffects::modifyExternal, "allocation_profiler_sites")
+                ->args({"block","context","at"});
+        addExtern<DAS_BIND_FUN(function_profiler)>(*this, lib, "function_profiler",
+            SideEffects::modifyExternal, "function_profiler")
+                ->args({"enable","context"});
+        auto fpr = addExtern<DAS_BIND_FUN(function_profiler_report)>(*this, lib, "function_profiler_report",
+            SideEffects::modifyExternal, "function_profiler_report")
+                ->args({"top","context"});
+        fpr->arguments[0]->init = make_smart<ExprConstInt>(32);
+        addExtern<DAS_BIND_FUN(function_profiler_save)>(*this, lib, "function_profiler_save",
+            SideEffects::modifyExternal, "function_profiler_save")
+                ->args({"fileName","context"});
         // binary serializer
         addInterop<_builtin_binary_load,void,vec4f,const Array &>(*this,lib,"_builtin_binary_load",
             SideEffects::modifyArgumentAndExternal, "_builtin_binary_load")
@@ -1237,6 +1329,9 @@ namespace das
         addExtern<DAS_BIND_FUN(builtin_profile)>(*this,lib,"profile",
             SideEffects::modifyExternal, "builtin_profile")
                 ->args({"count","category","block","context","line"});
+        addExtern<DAS_BIND_FUN(builtin_profile_counters)>(*this,lib,"profile_counters",
+            SideEffects::modifyArgumentAndExternal, "builtin_profile_counters")
+                ->args({"count","category","counters","block","context","line"});
         // das string binding
         addAnnotation(make_smart<DasStringTypeAnnotation>());
         addExtern<DAS_BIND_FUN(to_das_string)>(*this, lib, "string",
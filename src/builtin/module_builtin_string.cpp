@@ -11,7 +11,15 @@
 
 #include <inttypes.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP>=2)
+    #include <emmintrin.h>
+    #define DAS_STRING_SSE2     1
+#else
+    #define DAS_STRING_SSE2     0
+#endif
+
 MAKE_TYPE_FACTORY(StringBuilderWriter, StringBuilderWriter)
+MAKE_TYPE_FACTORY(StringAtom, das::StringAtom)
 
 namespace das
 {
@@ -21,6 +29,155 @@ namespace das
         }
     };
 
+    struct StringAtomAnnotation : ManagedStructureAnnotation <StringAtom,false> {
+        StringAtomAnnotation(ModuleLibrary & ml)
+            : ManagedStructureAnnotation ("StringAtom", ml) {
+            addField<DAS_BIND_MANAGED_FIELD(hash)>("hash");
+            addField<DAS_BIND_MANAGED_FIELD(length)>("length");
+            addField<DAS_BIND_MANAGED_FIELD(text)>("text");
+        }
+    };
+
+    // atoms are shared by all contexts and threads, and are never freed
+    struct StringAtomTable {
+        mutex                   lock;
+        das_string_set          atoms;      // text of the atom, atom itself is right in front of it
+        LinearChunkAllocator    memory;
+    };
+
+    static StringAtomTable & string_atom_table() {
+        static StringAtomTable * table = new StringAtomTable();
+        return *table;
+    }
+
+    static __forceinline const StringAtom * text_to_atom ( const char * text ) {
+        return (const StringAtom *)(text - sizeof(StringAtom));
+    }
+
+    const StringAtom * builtin_string_atom ( const char * str ) {
+        if ( !str ) str = "";
+        auto length = uint32_t(strlen(str));
+        auto & table = string_atom_table();
+        lock_guard<mutex> guard(table.lock);
+        auto it = table.atoms.find(StrHashEntry(str,length));
+        if ( it!=table.atoms.end() ) return text_to_atom(it->ptr);
+        auto atom = (StringAtom *) table.memory.allocate(uint32_t(sizeof(StringAtom)) + length + 1);
+        atom->text = (char *)(atom + 1);
+        memcpy(atom->text, str, length);
+        atom->text[length] = 0;
+        atom->length = length;
+        atom->hash = hash_blockz64((const uint8_t *)atom->text);
+        table.atoms.insert(StrHashEntry(atom->text,length));
+        return atom;
+    }
+
+    const StringAtom * builtin_find_string_atom ( const char * str ) {
+        if ( !str ) str = "";
+        auto & table = string_atom_table();
+        lock_guard<mutex> guard(table.lock);
+        auto it = table.atoms.find(StrHashEntry(str,uint32_t(strlen(str))));
+        return it!=table.atoms.end() ? text_to_atom(it->ptr) : nullptr;
+    }
+
+    uint64_t builtin_string_atom_count () {
+        auto & table = string_atom_table();
+        lock_guard<mutex> guard(table.lock);
+        return table.atoms.size();
+    }
+
+    // first occurrence of the needle, or nullptr. hay has to be zero terminated
+    // candidates are positions, where both first and last character of the needle match, 16 at a time
+    static const char * find_substring ( const char * hay, uint32_t hayLen, const char * needle, uint32_t needleLen ) {
+        if ( needleLen==0 ) return hay;
+        if ( needleLen>hayLen ) return nullptr;
+        if ( needleLen==1 ) return (const char *) memchr(hay, needle[0], hayLen);
+        const char * last = hay + hayLen - needleLen;
+        const char * ptr = hay;
+#if DAS_STRING_SSE2
+        const __m128i head = _mm_set1_epi8(needle[0]);
+        const __m128i tail = _mm_set1_epi8(needle[needleLen-1]);
+        uint32_t budget = hayLen/4 + 64;    // too many false candidates, i.e. 'aaaa' in 'aaaaaaa'
+        while ( last - ptr >= 15 ) {
+            __m128i a = _mm_loadu_si128((const __m128i *)ptr);
+            __m128i b = _mm_loadu_si128((const __m128i *)(ptr + needleLen - 1));
+            uint32_t mask = uint32_t(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a,head),_mm_cmpeq_epi8(b,tail))));
+            while ( mask ) {
+                uint32_t index = das_ctz(mask);
+                if ( memcmp(ptr + index + 1, needle + 1, needleLen - 2)==0 ) return ptr + index;
+                if ( !budget-- ) return strstr(ptr + index + 1, needle);   // strstr is linear in the worst case
+                mask &= mask - 1;
+            }
+            ptr += 16;
+        }
+#endif
+        for ( ; ptr<=last; ++ptr ) {
+            if ( ptr[0]==needle[0] && memcmp(ptr + 1, needle + 1, needleLen - 1)==0 ) return ptr;
+        }
+        return nullptr;
+    }
+
+    // set of delimiter characters. up to 4 characters are also compared 16 at a time
+    struct StringCharSet {
+        uint32_t    bits[8];
+        uint32_t    count = 0;
+#if DAS_STRING_SSE2
+        __m128i     chars[4];
+#endif
+        StringCharSet ( const char * set ) {
+            memset(bits, 0, sizeof(bits));
+            for ( ; *set; ++set ) {
+                uint8_t ch = uint8_t(*set);
+                if ( has(ch) ) continue;
+                bits[ch>>5] |= 1u << (ch & 31);
+#if DAS_STRING_SSE2
+                if ( count<4 ) chars[count] = _mm_set1_epi8(char(ch));
+#endif
+                count ++;
+            }
+        }
+        __forceinline bool has ( uint8_t ch ) const {
+            return (bits[ch>>5] & (1u << (ch & 31)))!=0;
+        }
+        // first character at or after ptr, which is (or is not) in the set, or end
+        const char * find ( const char * ptr, const char * end, bool inSet ) const {
+#if DAS_STRING_SSE2
+            if ( count<=4 ) {
+                uint32_t flip = inSet ? 0 : 0xffffu;
+                while ( end - ptr >= 16 ) {
+                    __m128i c = _mm_loadu_si128((const __m128i *)ptr);
+                    __m128i m = _mm_cmpeq_epi8(c, chars[0]);
+                    for ( uint32_t i=1; i<count; ++i ) m = _mm_or_si128(m, _mm_cmpeq_epi8(c, chars[i]));
+                    uint32_t mask = uint32_t(_mm_movemask_epi8(m)) ^ flip;
+                    if ( mask ) return ptr + das_ctz(mask);
+                    ptr += 16;
+                }
+            }
+#endif
+            while ( ptr!=end && has(uint8_t(*ptr))!=inSet ) ptr ++;
+            return ptr;
+        }
+    };
+
+    // flips case of the characters in the [lo,hi] range, 16 at a time
+    static void flip_case ( char * str, uint32_t length, char lo, char hi ) {
+        char * ptr = str;
+        char * end = str + length;
+#if DAS_STRING_SSE2
+        const __m128i below = _mm_set1_epi8(char(lo - 1));
+        const __m128i above = _mm_set1_epi8(char(hi + 1));
+        const __m128i flip = _mm_set1_epi8(0x20);
+        while ( end - ptr >= 16 ) {
+            __m128i c = _mm_loadu_si128((const __m128i *)ptr);
+            __m128i m = _mm_and_si128(_mm_cmpgt_epi8(c, below), _mm_cmplt_epi8(c, above));
+            _mm_storeu_si128((__m128i *)ptr, _mm_xor_si128(c, _mm_and_si128(m, flip)));
+            ptr += 16;
+        }
+#endif
+        for ( ; ptr!=end; ++ptr ) {
+            if ( *ptr>=lo && *ptr<=hi ) *ptr ^= 0x20;
+        }
+    }
+
     int32_t get_character_at ( const char * str, int32_t index, Context * context ) {
         const uint32_t strLen = stringLengthSafe ( *context, str );
         if ( uint32_t(index)>=strLen ) {
@@ -96,14 +253,17 @@ namespace das
         const uint32_t strLen = stringLengthSafe ( *context, str );
         if (!strLen)
             return -1;
-        const char *ret = strstr(&str[clamp_int(start, 0, strLen)], substr);
+        start = clamp_int(start, 0, strLen);
+        const char *ret = find_substring(str + start, strLen - start, substr ? substr : "", stringLengthSafe(*context, substr));
         return ret ? int(ret-str) : -1;
     }
 
     int builtin_string_find2 (const char *str, const char *substr) {
         if (!str)
             return -1;
-        const char *ret = strstr(str, substr);
+        if (!substr)
+            substr = "";
+        const char *ret = find_substring(str, uint32_t(strlen(str)), substr, uint32_t(strlen(substr)));
         return ret ? int(ret-str) : -1;
     }
 
@@ -144,55 +304,35 @@ namespace das
         return ret;
     }
 
-    __forceinline char to_lower(char ch) {
-        return (ch >= 'A' && ch <= 'Z') ? (ch - 'A' + 'a') : ch;
-    }
-
     char* builtin_string_tolower ( const char *str, Context * context ) {
         const uint32_t strLen = stringLengthSafe ( *context, str );
         if (!strLen)
             return nullptr;
-        char * ret = context->stringHeap->allocateString(str, strLen);
-        for (char *d = ret, *end = ret + strLen; d != end; ++str, ++d)
-          *d = (char)to_lower(*str);
+        char * ret = context->stringHeap->allocateString(nullptr, strLen);
+        memcpy(ret, str, strLen);
+        flip_case(ret, strLen, 'A', 'Z');
         return ret;
     }
 
     char* builtin_string_tolower_in_place(char* str) {
         if (!str) return nullptr;
-        char* pch = str;
-        for (;;) {
-            char ch = *pch;
-            if (ch == 0) break;
-            else if (ch >= 'A' && ch <= 'Z') *pch = ch - 'A' + 'a';
-            pch++;
-        }
+        flip_case(str, uint32_t(strlen(str)), 'A', 'Z');
         return str;
     }
 
-    __forceinline char to_upper(char ch) {
-        return (ch >= 'a' && ch <= 'z') ? (ch - 'a' + 'A') : ch;
-    }
-
     char* builtin_string_toupper ( const char *str, Context * context ) {
         const uint32_t strLen = stringLengthSafe ( *context, str );
         if (!strLen)
             return nullptr;
-        char * ret = context->stringHeap->allocateString(str, strLen);
-        for (char *d = ret, *end = ret + strLen; d != end; ++str, ++d)
-          *d = (char)to_upper(*str);
+        char * ret = context->stringHeap->allocateString(nullptr, strLen);
+        memcpy(ret, str, strLen);
+        flip_case(ret, strLen, 'a', 'z');
         return ret;
     }
 
     char* builtin_string_toupper_in_place ( char* str ) {
         if (!str) return nullptr;
-        char* pch = str;
-        for (;;) {
-            char ch = *pch;
-            if (ch == 0) break;
-            else if (ch >= 'a' && ch <= 'z') *pch = ch - 'a' + 'A';
-            pch++;
-        }
+        flip_case(str, uint32_t(strlen(str)), 'a', 'z');
         return str;
     }
 
@@ -431,35 +571,25 @@ namespace das
         return words;
     }
 
-    void builtin_string_split_by_char ( const char * str, const char * delim, const Block & block, Context * context, LineInfoArg * at ) {
-        if ( !str ) str = "";
-        if ( !delim ) delim = "";
+    // all parts live in one buffer, each one zero terminated, and the block gets a temporary array of pointers into it
+    static void invoke_split_block ( const vector<pair<uint32_t,uint32_t>> & parts, const char * str, const Block & block, Context * context, LineInfoArg * at ) {
+        vector<char> buffer;
         vector<const char *> tokens;
-        vector<string> words;
-        const char * ch = str;
-        auto delimLen = stringLengthSafe(*context,delim);
-        if ( delimLen ) {
-            while ( *ch ) {
-                const char * tok = ch;
-                while ( *ch && !strchr(delim,*ch) ) ch++;
-                words.push_back(string(tok,ch-tok));
-                if ( !*ch ) break;
-                while ( *ch && strchr(delim,*ch) ) ch++;
-                if ( !*ch ) words.push_back("");
-            }
+        if ( parts.empty() ) {
+            tokens.push_back("");
         } else {
-            auto len = stringLengthSafe(*context,str);
-            words.reserve(len);
-            while ( *ch ) {
-                words.push_back(string(1,*ch));
-                ch ++;
+            size_t total = 0;
+            for ( auto & part : parts ) total += part.second + 1;
+            buffer.resize(total);
+            tokens.reserve(parts.size());
+            char * out = buffer.data();
+            for ( auto & part : parts ) {
+                memcpy(out, str + part.first, part.second);
+                out[part.second] = 0;
+                tokens.push_back(out);
+                out += part.second + 1;
             }
         }
-        tokens.reserve(words.size());
-        for ( auto & tok : words ) {
-            tokens.push_back(tok.c_str());
-        }
-        if ( tokens.empty() ) tokens.push_back("");
         Array arr;
         arr.data = (char *) tokens.data();
         arr.capacity = arr.size = uint32_t(tokens.size());
@@ -469,57 +599,87 @@ namespace das
         context->invoke(block, args, nullptr, at);
     }
 
+    static void split_into_characters ( const char * str, uint32_t strLen, vector<pair<uint32_t,uint32_t>> & parts ) {
+        parts.reserve(strLen);
+        for ( uint32_t i=0; i!=strLen; ++i ) {
+            parts.emplace_back(i, 1);
+        }
+    }
+
+    void builtin_string_split_by_char ( const char * str, const char * delim, const Block & block, Context * context, LineInfoArg * at ) {
+        if ( !str ) str = "";
+        if ( !delim ) delim = "";
+        vector<pair<uint32_t,uint32_t>> parts;
+        auto strLen = stringLengthSafe(*context,str);
+        if ( *delim ) {
+            StringCharSet set(delim);
+            const char * ch = str;
+            const char * end = str + strLen;
+            while ( ch!=end ) {
+                const char * tok = ch;
+                ch = set.find(ch, end, true);
+                parts.emplace_back(uint32_t(tok-str), uint32_t(ch-tok));
+                if ( ch==end ) break;
+                ch = set.find(ch, end, false);
+                if ( ch==end ) parts.emplace_back(strLen, 0);
+            }
+        } else {
+            split_into_characters(str, strLen, parts);
+        }
+        invoke_split_block(parts, str, block, context, at);
+    }
+
     void builtin_string_split ( const char * str, const char * delim, const Block & block, Context * context, LineInfoArg * at ) {
         if ( !str ) str = "";
         if ( !delim ) delim = "";
-        vector<const char *> tokens;
-        vector<string> words;
-        const char * ch = str;
+        vector<pair<uint32_t,uint32_t>> parts;
+        auto strLen = stringLengthSafe(*context,str);
         auto delimLen = stringLengthSafe(*context,delim);
         if ( delimLen ) {
-            while ( *ch ) {
+            const char * ch = str;
+            const char * end = str + strLen;
+            while ( ch!=end ) {
                 const char * tok = ch;
-                while ( *ch && strncmp(delim,ch,delimLen)!=0 ) ch++;
-                words.push_back(string(tok,ch-tok));
-                if ( !*ch ) break;
-                while ( *ch && strncmp(delim,ch,delimLen)==0 ) ch+=delimLen;
-                if ( !*ch ) words.push_back("");
+                ch = find_substring(ch, uint32_t(end-ch), delim, delimLen);
+                if ( !ch ) ch = end;
+                parts.emplace_back(uint32_t(tok-str), uint32_t(ch-tok));
+                if ( ch==end ) break;
+                while ( uint32_t(end-ch)>=delimLen && memcmp(ch,delim,delimLen)==0 ) ch += delimLen;
+                if ( ch==end ) parts.emplace_back(strLen, 0);
             }
         } else {
-            auto len = stringLengthSafe(*context,str);
-            words.reserve(len);
-            while ( *ch ) {
-                words.push_back(string(1,*ch));
-                ch ++;
-            }
+            split_into_characters(str, strLen, parts);
         }
-        tokens.reserve(words.size());
-        for ( auto & tok : words ) {
-            tokens.push_back(tok.c_str());
-        }
-        if ( tokens.empty() ) tokens.push_back("");
-        Array arr;
-        arr.data = (char *) tokens.data();
-        arr.capacity = arr.size = uint32_t(tokens.size());
-        arr.lock = 1;
-        vec4f args[1];
-        args[0] = cast<Array *>::from(&arr);
-        context->invoke(block, args, nullptr, at);
+        invoke_split_block(parts, str, block, context, at);
     }
 
     char * builtin_string_replace ( const char * str, const char * toSearch, const char * replaceStr, Context * context ) {
         auto toSearchSize = stringLengthSafe(*context, toSearch);
         if ( !toSearchSize ) return (char *) str;
-        string data = str ? str : "";
+        auto strLen = stringLengthSafe(*context, str);
+        if ( !strLen ) return nullptr;
         auto replaceStrSize = stringLengthSafe(*context,replaceStr);
-        const char * repl = replaceStr ? replaceStr : "";
-        const char * toss = toSearch ? toSearch : "";
-        size_t pos = data.find(toss);
-        while ( pos != string::npos ) {
-            data.replace(pos, toSearchSize, repl);
-            pos = data.find(toss, pos + replaceStrSize);
-        }
-        return context->stringHeap->allocateString(data);
+        // matches are found once, so that the result is allocated and written in one go
+        vector<uint32_t> matches;
+        for ( const char * pos = str; (pos = find_substring(pos, strLen - uint32_t(pos-str), toSearch, toSearchSize)); pos += toSearchSize ) {
+            matches.push_back(uint32_t(pos-str));
+        }
+        uint64_t resLen = uint64_t(strLen) + uint64_t(matches.size()) * replaceStrSize - uint64_t(matches.size()) * toSearchSize;
+        if ( !resLen ) return nullptr;
+        if ( resLen>UINT32_MAX ) context->throw_error("replace result is too long");
+        char * res = context->stringHeap->allocateString(nullptr, uint32_t(resLen));
+        if ( !res ) context->throw_error("can't replace, out of heap");
+        char * out = res;
+        uint32_t from = 0;
+        for ( auto at : matches ) {
+            memcpy(out, str + from, at - from);
+            out += at - from;
+            memcpy(out, replaceStr, replaceStrSize);
+            out += replaceStrSize;
+            from = at + toSearchSize;
+        }
+        memcpy(out, str + from, strLen - from);
+        return res;
     }
 
     class StrdupDataWalker : public DataWalker {
@@ -549,23 +709,17 @@ namespace das
 
     int builtin_find_first_char_of ( const char * str, int Ch, Context * context ) {
         uint32_t strlen = stringLengthSafe ( *context, str );
-        for ( uint32_t o=0; o!=strlen; ++o ) {
-            if ( str[o]==Ch ) {
-                return o;
-            }
-        }
-        return -1;
+        if ( int(char(Ch))!=Ch ) return -1;     // characters are compared as char
+        auto ret = (const char *) memchr(str, Ch, strlen);
+        return ret ? int(ret-str) : -1;
     }
 
     int builtin_find_first_char_of2 ( const char * str, int Ch, int start, Context * context ) {
         uint32_t strlen = stringLengthSafe ( *context, str );
         start = clamp_int((start < 0) ? (strlen + start) : start, 0, strlen);
-        for ( uint32_t o=start; o!=strlen; ++o ) {
-            if ( str[o]==Ch ) {
-                return o;
-            }
-        }
-        return -1;
+        if ( int(char(Ch))!=Ch ) return -1;
+        auto ret = (const char *) memchr(str + start, Ch, strlen - start);
+        return ret ? int(ret-str) : -1;
     }
 
     char * builtin_string_from_array ( const TArray<uint8_t> & bytes, Context * context ) {
@@ -666,6 +820,14 @@ namespace das
             lib.addBuiltInModule();
             // string builder writer
             addAnnotation(make_smart<StringBuilderWriterAnnotation>(lib));
+            // atoms
+            addAnnotation(make_smart<StringAtomAnnotation>(lib));
+            addExtern<DAS_BIND_FUN(builtin_string_atom)>(*this, lib, "atom",
+                SideEffects::accessExternal,"builtin_string_atom")->arg("str");
+            addExtern<DAS_BIND_FUN(builtin_find_string_atom)>(*this, lib, "find_atom",
+                SideEffects::accessExternal,"builtin_find_string_atom")->arg("str");
+            addExtern<DAS_BIND_FUN(builtin_string_atom_count)>(*this, lib, "atom_count",
+                SideEffects::accessExternal,"builtin_string_atom_count");
             addExtern<DAS_BIND_FUN(delete_string)>(*this, lib, "delete_string",
                 SideEffects::modifyArgumentAndExternal,"delete_string")->args({"str","context"})->unsafeOperation = true;
             addExtern<DAS_BIND_FUN(builtin_build_string)>(*this, lib, "build_string",
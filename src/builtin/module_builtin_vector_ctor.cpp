@@ -26,6 +26,7 @@ namespace das
             V_BEGIN();
             V_OP(VecCtor_1);
             V_SUB(arguments[0]);
+            V_FIELD(arguments);
             V_END();
         }
         virtual vec4f eval(Context & context) override {
@@ -44,6 +45,7 @@ namespace das
             V_OP(VecCtor_2);
             V_SUB(arguments[0]);
             V_SUB(arguments[1]);
+            V_FIELD(arguments);
             V_END();
         }
         virtual vec4f eval(Context & context) override {
@@ -66,6 +68,7 @@ namespace das
             V_SUB(arguments[0]);
             V_SUB(arguments[1]);
             V_SUB(arguments[2]);
+            V_FIELD(arguments);
             V_END();
         }
         virtual vec4f eval(Context & context) override {
@@ -91,6 +94,7 @@ namespace das
             V_SUB(arguments[1]);
             V_SUB(arguments[2]);
             V_SUB(arguments[3]);
+            V_FIELD(arguments);
             V_END();
         }
         virtual vec4f eval(Context & context) override {
@@ -113,6 +117,7 @@ namespace das
             V_BEGIN();
             V_OP(Range1Ctor);
             V_SUB(arguments[0]);
+            V_FIELD(arguments);
             V_END();
         }
         virtual vec4f eval(Context & context) override {
@@ -167,6 +172,7 @@ addFunction ( make_smart<BuiltInFn<SimNode_VecCtor<uint32_t,SimPolicy<VTYPE>,4>,
             V_BEGIN();
             V_OP(Int4ToFloat4);
             V_SUB(arguments[0]);
+            V_FIELD(arguments);
             V_END();
         }
         virtual vec4f eval(Context & context) override {
@@ -182,6 +188,7 @@ addFunction ( make_smart<BuiltInFn<SimNode_VecCtor<uint32_t,SimPolicy<VTYPE>,4>,
             V_BEGIN();
             V_OP(UInt4ToFloat4);
             V_SUB(arguments[0]);
+            V_FIELD(arguments);
             V_END();
         }
         virtual vec4f eval(Context & context) override {
@@ -197,6 +204,7 @@ addFunction ( make_smart<BuiltInFn<SimNode_VecCtor<uint32_t,SimPolicy<VTYPE>,4>,
             V_BEGIN();
             V_OP(Float4ToInt4);
             V_SUB(arguments[0]);
+            V_FIELD(arguments);
             V_END();
         }
         virtual vec4f eval(Context & context) override {
@@ -212,6 +220,7 @@ addFunction ( make_smart<BuiltInFn<SimNode_VecCtor<uint32_t,SimPolicy<VTYPE>,4>,
             V_BEGIN();
             V_OP(Float4ToUInt4);
             V_SUB(arguments[0]);
+            V_FIELD(arguments);
             V_END();
         }
         virtual vec4f eval(Context & context) override {
@@ -227,6 +236,7 @@ addFunction ( make_smart<BuiltInFn<SimNode_VecCtor<uint32_t,SimPolicy<VTYPE>,4>,
             V_BEGIN();
             V_OP(AnyIntToAnyInt);
             V_SUB(arguments[0]);
+            V_FIELD(arguments);
             V_END();
         }
         virtual vec4f eval(Context & context) override {
@@ -0,0 +1,115 @@
+#include "daScript/misc/platform.h"
+#include "daScript/misc/performance_counters.h"
+
+#if defined(__linux__) && !defined(__ANDROID__)
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace das {
+
+    // all counters are opened as one group, so that they are scheduled on the PMU together
+    // if the kernel multiplexes the group, values are scaled by time_enabled / time_running
+    static int perf_open ( uint32_t type, uint64_t config, int groupFd ) {
+        perf_event_attr pe;
+        memset(&pe, 0, sizeof(pe));
+        pe.type = type;
+        pe.size = sizeof(pe);
+        pe.config = config;
+        pe.disabled = groupFd==-1 ? 1 : 0;
+        pe.exclude_kernel = 1;
+        pe.exclude_hv = 1;
+        pe.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        return int(syscall(__NR_perf_event_open, &pe, 0, -1, groupFd, 0));
+    }
+
+    PerfCounters::PerfCounters() {
+        const uint64_t l1dMiss = PERF_COUNT_HW_CACHE_L1D
+            | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+            | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        struct { uint32_t type; uint64_t config; } events[int(PerfCounter::total)] = {
+            { PERF_TYPE_HARDWARE,   PERF_COUNT_HW_CPU_CYCLES },
+            { PERF_TYPE_HARDWARE,   PERF_COUNT_HW_INSTRUCTIONS },
+            { PERF_TYPE_HARDWARE,   PERF_COUNT_HW_BRANCH_MISSES },
+            { PERF_TYPE_HW_CACHE,   l1dMiss },
+            { PERF_TYPE_HARDWARE,   PERF_COUNT_HW_CACHE_MISSES },
+        };
+        leader = -1;
+        members = 0;
+        for ( int i = 0; i != int(PerfCounter::total); ++i ) {
+            fd[i] = perf_open(events[i].type, events[i].config, leader);
+            if ( fd[i] < 0 ) {
+                fd[i] = -1;
+                continue;
+            }
+            if ( leader == -1 ) leader = fd[i];
+            slot[members++] = i;
+        }
+    }
+
+    PerfCounters::~PerfCounters() {
+        for ( auto f : fd ) {
+            if ( f != -1 ) close(f);
+        }
+    }
+
+    void PerfCounters::start() {
+        if ( leader == -1 ) return;
+        ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+
+    void PerfCounters::stop ( uint64_t * values ) {
+        if ( leader == -1 ) return;
+        ioctl(leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+        // nr, time_enabled, time_running, value[nr]
+        uint64_t data[3 + int(PerfCounter::total)];
+        auto bytes = read(leader, data, sizeof(data));
+        if ( bytes < ssize_t(3*sizeof(uint64_t)) ) return;
+        uint64_t nr = das::min(data[0], uint64_t(members));
+        uint64_t enabled = data[1], running = data[2];
+        if ( running == 0 ) return;     // group was never scheduled, there is nothing to report
+        for ( uint64_t i = 0; i != nr; ++i ) {
+            uint64_t value = data[3 + i];
+            if ( running < enabled ) value = uint64_t(double(value) * double(enabled) / double(running));
+            values[slot[i]] += value;
+        }
+    }
+}
+
+#else
+
+namespace das {
+    PerfCounters::PerfCounters() {
+        for ( auto & f : fd ) f = -1;
+        leader = -1;
+        members = 0;
+    }
+    PerfCounters::~PerfCounters() {}
+    void PerfCounters::start() {}
+    void PerfCounters::stop ( uint64_t * ) {}
+}
+
+#endif
+
+namespace das {
+    bool PerfCounters::any() const {
+        for ( auto f : fd ) {
+            if ( f != -1 ) return true;
+        }
+        return false;
+    }
+
+    const char * PerfCounters::name ( PerfCounter cnt ) {
+        switch ( cnt ) {
+        case PerfCounter::cycles:       return "cycles";
+        case PerfCounter::instructions: return "instructions";
+        case PerfCounter::branchMisses: return "branch_misses";
+        case PerfCounter::l1dMisses:    return "l1d_misses";
+        case PerfCounter::llcMisses:    return "llc_misses";
+        default:                        return "";
+        }
+    }
+}
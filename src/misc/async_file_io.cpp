@@ -0,0 +1,174 @@
+#include "daScript/misc/platform.h"
+
+#if !DAS_NO_FILEIO
+
+#include "daScript/misc/async_file_io.h"
+#include "daScript/misc/job_que.h"
+
+#include <sys/stat.h>
+#include <errno.h>
+
+namespace das {
+
+    AsyncFileIO::AsyncFileIO ( int32_t threadCount ) : inFlight(0) {
+        // requests are latency bound, so there are more workers than cores on small machines
+        if ( threadCount<=0 ) threadCount = max(4, int32_t(thread::hardware_concurrency()));
+        for ( int32_t i=0; i!=threadCount; ++i ) {
+            workers.emplace_back([this,i]() {
+                SetCurrentThreadName("AsyncFileIO_" + to_string(i));
+                worker();
+            });
+        }
+    }
+
+    AsyncFileIO::~AsyncFileIO() {
+        {
+            lock_guard<mutex> guard(requestMutex);
+            shutdown = true;
+            requests.clear();
+        }
+        requestCond.notify_all();
+        for ( auto & w : workers ) w.join();
+    }
+
+    uint64_t AsyncFileIO::queue ( AsyncFileOp op, const char * name ) {
+        Request req;
+        req.id = nextId ++;
+        req.op = op;
+        req.name = name ? name : "";
+        queued.emplace_back(das::move(req));
+        return queued.back().id;
+    }
+
+    uint64_t AsyncFileIO::read ( const char * name ) {
+        return queue(AsyncFileOp::read, name);
+    }
+
+    uint64_t AsyncFileIO::write ( const char * name, const char * data, uint32_t size, bool append ) {
+        auto id = queue(append ? AsyncFileOp::append : AsyncFileOp::write, name);
+        if ( size ) queued.back().data.assign(data, data + size);
+        return id;
+    }
+
+    uint64_t AsyncFileIO::stat ( const char * name ) {
+        return queue(AsyncFileOp::stat, name);
+    }
+
+    int32_t AsyncFileIO::submit() {
+        int32_t count = int32_t(queued.size());
+        if ( !count ) return 0;
+        inFlight += count;
+        {
+            lock_guard<mutex> guard(requestMutex);
+            for ( auto & req : queued ) requests.emplace_back(das::move(req));
+        }
+        queued.clear();
+        if ( count==1 ) {
+            requestCond.notify_one();
+        } else {
+            requestCond.notify_all();
+        }
+        return count;
+    }
+
+    int32_t AsyncFileIO::complete ( vector<AsyncFileCompletion> & done, int32_t timeoutMs ) {
+        unique_lock<mutex> lock(doneMutex);
+        if ( completions.empty() && timeoutMs!=0 && inFlight ) {
+            auto ready = [&]() { return !completions.empty(); };
+            if ( timeoutMs<0 ) {
+                doneCond.wait(lock, ready);
+            } else {
+                doneCond.wait_for(lock, chrono::milliseconds(timeoutMs), ready);
+            }
+        }
+        int32_t count = int32_t(completions.size());
+        if ( done.empty() ) {
+            swap(done, completions);
+        } else {
+            for ( auto & c : completions ) done.emplace_back(das::move(c));
+            completions.clear();
+        }
+        inFlight -= count;
+        return count;
+    }
+
+    void AsyncFileIO::worker() {
+        for ( ;; ) {
+            Request req;
+            {
+                unique_lock<mutex> lock(requestMutex);
+                requestCond.wait(lock, [&]() { return shutdown || !requests.empty(); });
+                if ( shutdown ) return;
+                req = das::move(requests.front());
+                requests.pop_front();
+            }
+            AsyncFileCompletion res;
+            res.result.id = req.id;
+            res.result.op = int32_t(req.op);
+            execute(req, res);
+            {
+                lock_guard<mutex> guard(doneMutex);
+                completions.emplace_back(das::move(res));
+            }
+            doneCond.notify_one();
+        }
+    }
+
+    void AsyncFileIO::execute ( Request & req, AsyncFileCompletion & res ) {
+        switch ( req.op ) {
+        case AsyncFileOp::read: {
+                FILE * f = fopen(req.name.c_str(), "rb");
+                if ( !f ) {
+                    res.result.error = errno;
+                    break;
+                }
+                struct stat st;
+                if ( fstat(fileno(f), &st)!=0 ) {
+                    res.result.error = errno;
+                } else if ( uint64_t(st.st_size) > UINT32_MAX ) {
+                    res.result.error = EFBIG;
+                } else {
+                    res.data.resize(size_t(st.st_size));
+                    auto bytes = st.st_size ? fread(res.data.data(), 1, res.data.size(), f) : 0;
+                    if ( bytes!=res.data.size() ) {
+                        res.result.error = ferror(f) ? errno : EIO;
+                        res.data.resize(bytes);
+                    }
+                    res.result.size = res.data.size();
+                }
+                fclose(f);
+            }
+            break;
+        case AsyncFileOp::write:
+        case AsyncFileOp::append: {
+                FILE * f = fopen(req.name.c_str(), req.op==AsyncFileOp::append ? "ab" : "wb");
+                if ( !f ) {
+                    res.result.error = errno;
+                    break;
+                }
+                auto bytes = req.data.size() ? fwrite(req.data.data(), 1, req.data.size(), f) : 0;
+                if ( bytes!=req.data.size() ) res.result.error = errno ? errno : EIO;
+                if ( fclose(f)!=0 && !res.result.error ) res.result.error = errno;
+                res.result.size = bytes;
+            }
+            break;
+        case AsyncFileOp::stat: {
+                struct stat st;
+                if ( ::stat(req.name.c_str(), &st)!=0 ) {
+                    res.result.error = errno;
+                    break;
+                }
+                res.result.size = uint64_t(st.st_size);
+                res.result.mtime = int64_t(st.st_mtime);
+#if defined(_MSC_VER)
+                res.result.is_dir = (st.st_mode & _S_IFDIR)!=0;
+#else
+                res.result.is_dir = S_ISDIR(st.st_mode);
+#endif
+            }
+            break;
+        }
+    }
+}
+
+#endif
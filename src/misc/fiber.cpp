@@ -0,0 +1,120 @@
+#if defined(__APPLE__) && !defined(_XOPEN_SOURCE)
+    #define _XOPEN_SOURCE 600       // ucontext is deprecated, but still available on OSX
+#endif
+
+#include "daScript/misc/platform.h"
+
+#include "daScript/misc/fiber.h"
+
+#if defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+    namespace das {
+        struct Fiber {
+            LPVOID      handle = nullptr;
+            bool        owner = false;
+            size_t      stackSize = 0;
+            FiberEntry  entry = nullptr;
+            void *      arg = nullptr;
+        };
+
+        static VOID CALLBACK fiberProc ( LPVOID param ) {
+            auto fiber = (Fiber *) param;
+            fiber->entry(fiber->arg);
+        }
+
+        Fiber * fiberCreate ( size_t stackSize, FiberEntry entry, void * arg ) {
+            auto fiber = new Fiber();
+            if ( stackSize ) {
+                fiber->entry = entry;
+                fiber->arg = arg;
+                fiber->stackSize = stackSize;
+                fiber->handle = CreateFiber(stackSize, fiberProc, fiber);
+                fiber->owner = true;
+                if ( !fiber->handle ) {
+                    delete fiber;
+                    return nullptr;
+                }
+            }
+            return fiber;
+        }
+
+        void fiberDestroy ( Fiber * fiber ) {
+            if ( !fiber ) return;
+            if ( fiber->owner ) DeleteFiber(fiber->handle);
+            delete fiber;
+        }
+
+        void fiberSwitch ( Fiber * from, Fiber * to ) {
+            if ( !IsThreadAFiber() ) ConvertThreadToFiber(nullptr);
+            from->handle = GetCurrentFiber();
+            SwitchToFiber(to->handle);
+        }
+
+        size_t fiberStackSize ( Fiber * fiber ) {
+            return fiber->stackSize;
+        }
+    }
+#else
+    #include <ucontext.h>
+    #include <sys/mman.h>
+    #include <unistd.h>
+    namespace das {
+        struct Fiber {
+            ucontext_t  uc;
+            char *      stack = nullptr;
+            size_t      stackSize = 0;
+            FiberEntry  entry = nullptr;
+            void *      arg = nullptr;
+        };
+
+        // makecontext only passes int arguments
+        static void fiberProc ( uint32_t lo, uint32_t hi ) {
+            auto fiber = (Fiber *) ((uintptr_t(hi) << 32) | uintptr_t(lo));
+            fiber->entry(fiber->arg);
+        }
+
+        Fiber * fiberCreate ( size_t stackSize, FiberEntry entry, void * arg ) {
+            auto fiber = new Fiber();
+            if ( stackSize ) {
+                // reserve, but don't commit. guard page at the bottom
+                size_t page = size_t(sysconf(_SC_PAGESIZE));
+                stackSize = (stackSize + page - 1) & ~(page - 1);
+                void * mem = mmap(nullptr, stackSize + page, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if ( mem==MAP_FAILED ) {
+                    delete fiber;
+                    return nullptr;
+                }
+                mprotect(mem, page, PROT_NONE);
+                fiber->stack = (char *) mem;
+                fiber->stackSize = stackSize;
+                fiber->entry = entry;
+                fiber->arg = arg;
+                getcontext(&fiber->uc);
+                fiber->uc.uc_stack.ss_sp = fiber->stack + page;
+                fiber->uc.uc_stack.ss_size = stackSize;
+                fiber->uc.uc_link = nullptr;
+                auto ptr = uintptr_t(fiber);
+                makecontext(&fiber->uc, (void (*)()) fiberProc, 2, uint32_t(ptr), uint32_t(uint64_t(ptr) >> 32));
+            }
+            return fiber;
+        }
+
+        void fiberDestroy ( Fiber * fiber ) {
+            if ( !fiber ) return;
+            if ( fiber->stack ) {
+                size_t page = size_t(sysconf(_SC_PAGESIZE));
+                munmap(fiber->stack, fiber->stackSize + page);
+            }
+            delete fiber;
+        }
+
+        void fiberSwitch ( Fiber * from, Fiber * to ) {
+            swapcontext(&from->uc, &to->uc);
+        }
+
+        size_t fiberStackSize ( Fiber * fiber ) {
+            return fiber->stackSize;
+        }
+    }
+#endif
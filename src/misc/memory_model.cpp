@@ -2,6 +2,7 @@
 
 #include "daScript/misc/memory_model.h"
 #include "daScript/misc/debug_break.h"
+#include "daScript/misc/sysos.h"
 
 namespace das {
 
@@ -234,6 +235,18 @@ namespace das {
         return customGrow ? customGrow(size) : size * 2;
     }
 
+    HeapChunk * LinearChunkAllocator::newChunk ( uint32_t size, HeapChunk * next ) {
+        if ( region ) {
+            size = (size + 15) & ~15;
+            if ( char * data = region->allocate(size) ) {
+                return new HeapChunk(data, size, next);     // region memory is never reused, hence already zero
+            }
+        }
+        auto ch = new HeapChunk(size, next);
+        if ( zeroChunks ) memset(ch->data, 0, ch->size);
+        return ch;
+    }
+
     char * LinearChunkAllocator::allocate ( uint32_t s ) {
         if ( !s ) return nullptr;
         s = (s + alignMask) & ~alignMask;
@@ -241,7 +254,7 @@ namespace das {
             if ( !initialSize ) {
                 initialSize = default_initial_size;
             }
-            chunk = new HeapChunk ( das::max(initialSize, s), nullptr );
+            chunk = newChunk ( das::max(initialSize, s), nullptr );
             // printf("[HC] %i\n", chunk->size);
         }
         for ( ;; ) {
@@ -249,22 +262,100 @@ namespace das {
                 // printf("[A] %i bytes, offs=%i\n", int(s), int(res-chunk->data));
                 return res;
             }
-            chunk = new HeapChunk ( das::max(grow(chunk->size), s), chunk);
+            chunk = newChunk ( das::max(grow(chunk->size), s), chunk);
             // printf("[HC] %i bytes\n", chunk->size);
         }
     }
 
+    ChunkRegion::ChunkRegion ( uint64_t reserve ) {
+        pageSize = getVirtualMemoryPageSize();
+        reserve = (reserve + pageSize - 1) & ~(pageSize - 1);
+        data = (char *) reserveVirtualMemory(size_t(reserve));
+        reserved = data ? reserve : 0;
+    }
+
+    ChunkRegion::ChunkRegion ( const string & fileName ) {
+        pageSize = getVirtualMemoryPageSize();
+        size_t size = 0;
+        data = (char *) mapFileCopyOnWrite(fileName.c_str(), size);
+        reserved = committed = offset = data ? size : 0;
+        mapped = data!=nullptr;
+    }
+
+    ChunkRegion::~ChunkRegion() {
+        if ( !data ) return;
+        if ( mapped ) {
+            unmapFile(data, size_t(reserved));
+        } else {
+            releaseVirtualMemory(data, size_t(reserved));
+        }
+    }
+
+    char * ChunkRegion::allocate ( uint32_t size ) {
+        lock_guard<mutex> guard(lock);
+        if ( offset + size > reserved ) return nullptr;
+        if ( offset + size > committed ) {
+            auto upTo = (offset + size + pageSize - 1) & ~(pageSize - 1);
+            if ( !commitVirtualMemory(data + committed, size_t(upTo - committed)) ) return nullptr;
+            committed = upTo;
+        }
+        char * res = data + offset;
+        offset += size;
+        return res;
+    }
+
     void LinearChunkAllocator::reset() {
         if ( chunk && chunk->next ) {
             auto maxAllocated = (uint32_t(bytesAllocated())+1023) & ~1023;
             initialSize = das::max(initialSize, maxAllocated);
             delete chunk;
             chunk = nullptr;
+            generation ++;
         } else if ( chunk ) {
             chunk->offset = 0;
         }
     }
 
+    void LinearChunkAllocator::snapshot ( LinearChunkSnapshot & snap ) const {
+        snap.chunk = chunk;
+        snap.generation = generation;
+        snap.sizes.clear();
+        snap.offsets.clear();
+        snap.data.clear();
+        for ( auto ch=chunk; ch; ch=ch->next ) {
+            snap.sizes.push_back(ch->size);
+            snap.offsets.push_back(ch->offset);
+            snap.data.insert(snap.data.end(), ch->data, ch->data + ch->offset);
+        }
+    }
+
+    bool LinearChunkAllocator::restore ( const LinearChunkSnapshot & snap ) {
+        // chunks are only ever added to the head, unless allocator was reset since the snapshot
+        if ( snap.generation!=generation ) return false;
+        auto ch = chunk;
+        while ( ch && ch!=snap.chunk ) ch = ch->next;
+        if ( ch!=snap.chunk ) return false;
+        // the rest of the chain has to be exactly the one in the snapshot
+        size_t index = 0, total = 0;
+        for ( ch=snap.chunk; ch; ch=ch->next, ++index ) {
+            if ( index>=snap.offsets.size() || ch->size!=snap.sizes[index] || ch->size<snap.offsets[index] ) return false;
+            total += snap.offsets[index];
+        }
+        if ( index!=snap.offsets.size() || total!=snap.data.size() ) return false;
+        // chunks, which were added since the snapshot, are kept empty for the next run
+        for ( ch=chunk; ch!=snap.chunk; ch=ch->next ) {
+            ch->offset = 0;
+        }
+        const char * src = snap.data.data();
+        index = 0;
+        for ( ch=snap.chunk; ch; ch=ch->next, ++index ) {
+            ch->offset = snap.offsets[index];
+            memcpy(ch->data, src, ch->offset);
+            src += ch->offset;
+        }
+        return true;
+    }
+
     char * LinearChunkAllocator::allocateName ( const string & name ) {
         if (!name.empty()) {
             auto length = uint32_t(name.length());
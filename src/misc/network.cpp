@@ -21,9 +21,17 @@
 
 #include <sys/socket.h>
 #include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <netdb.h>
 #include <unistd.h>
 #include <errno.h>
 #include <fcntl.h>
+#include <poll.h>
+
+#if defined(__linux__)
+#include <sys/epoll.h>
+#define DAS_NETWORK_EPOLL   1
+#endif
 
 #define closesocket close
 
@@ -209,4 +217,451 @@ namespace das {
     bool Server::is_connected() const {
         return client_fd > 0;
     }
+
+    // MultiServer
+
+#ifdef _WIN32
+    typedef WSAPOLLFD   das_pollfd;
+    #define das_poll    WSAPoll
+    #define DAS_MSG_NOSIGNAL    0
+    static int socket_error() { return WSAGetLastError(); }
+    static bool would_block ( int err ) { return err==WSAEWOULDBLOCK || err==WSAEINPROGRESS; }
+#else
+    typedef pollfd      das_pollfd;
+    #define das_poll    poll
+    #ifdef MSG_NOSIGNAL
+    #define DAS_MSG_NOSIGNAL    MSG_NOSIGNAL
+    #else
+    #define DAS_MSG_NOSIGNAL    0
+    #endif
+    static int socket_error() { return errno; }
+    static bool would_block ( int err ) { return err==EAGAIN || err==EWOULDBLOCK || err==EINPROGRESS; }
+#endif
+
+    static void set_socket_options ( socket_t fd ) {
+        int val = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, (const char *)&val, sizeof(val));   // batching is done by flush
+#ifdef SO_NOSIGPIPE
+        setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &val, sizeof(val));
+#endif
+    }
+
+    MultiServer::MultiServer() {
+    }
+
+    MultiServer::~MultiServer() {
+        for ( auto & it : conns ) {
+            closesocket(it.second->fd);
+            delete it.second;
+        }
+        for ( auto conn : connectionPool ) {
+            delete conn;
+        }
+        for ( auto buf : bufferPool ) {
+            delete [] buf;
+        }
+        if ( server_fd ) {
+            closesocket(server_fd);
+        }
+#if DAS_NETWORK_EPOLL
+        if ( poll_fd!=-1 ) {
+            ::close(poll_fd);
+        }
+#endif
+    }
+
+    bool MultiServer::initPoll() {
+#if DAS_NETWORK_EPOLL
+        if ( poll_fd==-1 ) {
+            poll_fd = epoll_create1(EPOLL_CLOEXEC);
+            if ( poll_fd==-1 ) {
+                onError(0, "can't epoll_create", socket_error());
+                return false;
+            }
+        }
+#endif
+        return true;
+    }
+
+    bool MultiServer::init ( int port ) {
+        if ( !initPoll() ) return false;
+        socket_t fd = socket(AF_INET, SOCK_STREAM, 0);
+        if ( invalid_socket(fd) ) {
+            onError(0, "can't socket", socket_error());
+            return false;
+        }
+        int val = 1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, (const char *)&val, sizeof(val));
+        struct sockaddr_in address;
+        memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = INADDR_ANY;
+        address.sin_port = htons(uint16_t(port));
+        if ( ::bind(fd, (struct sockaddr *)&address, sizeof(address))<0 ) {
+            onError(0, "can't bind", socket_error());
+            closesocket(fd);
+            return false;
+        }
+        if ( listen(fd, SOMAXCONN)<0 ) {
+            onError(0, "can't listen", socket_error());
+            closesocket(fd);
+            return false;
+        }
+        if ( !set_socket_blocking(fd,false) ) {
+            onError(0, "can't set nbio", socket_error());
+            closesocket(fd);
+            return false;
+        }
+#if DAS_NETWORK_EPOLL
+        epoll_event ev;
+        ev.events = EPOLLIN;
+        ev.data.u64 = 0;                    // id 0 is the listener
+        if ( epoll_ctl(poll_fd, EPOLL_CTL_ADD, fd, &ev)!=0 ) {
+            onError(0, "can't epoll_ctl", socket_error());
+            closesocket(fd);
+            return false;
+        }
+#endif
+        server_fd = fd;
+        return true;
+    }
+
+    int32_t MultiServer::connect ( const char * host, int port ) {
+        if ( !initPoll() ) return -1;
+        struct addrinfo hints, * res = nullptr;
+        memset(&hints, 0, sizeof(hints));
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_STREAM;
+        char portName[16];
+        snprintf(portName, sizeof(portName), "%i", port);
+        if ( getaddrinfo(host ? host : "127.0.0.1", portName, &hints, &res)!=0 || !res ) {
+            onError(0, "can't resolve host", socket_error());
+            return -1;
+        }
+        socket_t fd = socket(res->ai_family, res->ai_socktype, res->ai_protocol);
+        if ( invalid_socket(fd) ) {
+            onError(0, "can't socket", socket_error());
+            freeaddrinfo(res);
+            return -1;
+        }
+        if ( !set_socket_blocking(fd,false) ) {
+            onError(0, "can't set nbio", socket_error());
+            closesocket(fd);
+            freeaddrinfo(res);
+            return -1;
+        }
+        set_socket_options(fd);
+        int cres = ::connect(fd, res->ai_addr, int(res->ai_addrlen));
+        int err = cres<0 ? socket_error() : 0;
+        freeaddrinfo(res);
+        if ( cres<0 && !would_block(err) ) {
+            onError(0, "can't connect", err);
+            closesocket(fd);
+            return -1;
+        }
+        auto conn = addConnection(fd);
+        if ( !conn ) return -1;
+        conn->connecting = true;            // onConnect once the socket is writable
+        watchWrite(conn, true);
+        return conn->id;
+    }
+
+    bool MultiServer::is_open() const {
+        return server_fd != 0;
+    }
+
+    // ids wrap around, long lived connections keep theirs, so those are skipped
+    int32_t MultiServer::allocateId() {
+        int32_t id;
+        do {
+            id = nextId;
+            nextId = nextId==INT32_MAX ? 1 : nextId + 1;
+        } while ( conns.find(id)!=conns.end() );
+        return id;
+    }
+
+    MultiServer::Connection * MultiServer::addConnection ( socket_t fd ) {
+        Connection * conn;
+        if ( connectionPool.size() ) {
+            conn = connectionPool.back();
+            connectionPool.pop_back();
+        } else {
+            conn = new Connection();
+        }
+        conn->fd = fd;
+        conn->id = allocateId();
+#if DAS_NETWORK_EPOLL
+        epoll_event ev;
+        ev.events = EPOLLIN;
+        ev.data.u64 = uint64_t(conn->id);
+        if ( epoll_ctl(poll_fd, EPOLL_CTL_ADD, fd, &ev)!=0 ) {
+            onError(conn->id, "can't epoll_ctl", socket_error());
+            closesocket(fd);
+            connectionPool.push_back(conn);
+            return nullptr;
+        }
+#endif
+        conns[conn->id] = conn;
+        return conn;
+    }
+
+    void MultiServer::dropConnection ( Connection * conn ) {
+        conns.erase(conn->id);
+        if ( conn->dirty ) {
+            dirty.erase(find(dirty.begin(), dirty.end(), conn->id));
+        }
+        closesocket(conn->fd);              // which also removes it from epoll
+        conn->fd = 0;
+        conn->id = 0;
+        conn->out.clear();
+        conn->outOffset = 0;
+        conn->dirty = conn->wantWrite = conn->connecting = false;
+        connectionPool.push_back(conn);
+    }
+
+    void MultiServer::removeConnection ( Connection * conn, int code ) {
+        int32_t id = conn->id;
+        dropConnection(conn);
+        if ( code ) {
+            onError(id, "connection closed on error", code);
+        } else {
+            onLog("connection closed");
+        }
+        onDisconnect(id);
+    }
+
+    void MultiServer::close ( int32_t id ) {
+        auto it = conns.find(id);
+        if ( it==conns.end() ) return;
+        auto conn = it->second;
+        if ( !conn->connecting ) {
+            writeQueued(conn);              // best effort, whatever does not fit into the socket buffer is lost
+        }
+        removeConnection(conn, 0);
+    }
+
+    void MultiServer::watchWrite ( Connection * conn, bool write ) {
+        if ( conn->wantWrite==write ) return;
+        conn->wantWrite = write;
+#if DAS_NETWORK_EPOLL
+        epoll_event ev;
+        ev.events = EPOLLIN | (write ? EPOLLOUT : 0);
+        ev.data.u64 = uint64_t(conn->id);
+        epoll_ctl(poll_fd, EPOLL_CTL_MOD, conn->fd, &ev);
+#endif
+    }
+
+    char * MultiServer::allocateBuffer() {
+        if ( bufferPool.size() ) {
+            auto buf = bufferPool.back();
+            bufferPool.pop_back();
+            return buf;
+        }
+        return new char[recv_buffer_size + 1];
+    }
+
+    void MultiServer::freeBuffer ( char * buf ) {
+        bufferPool.push_back(buf);
+    }
+
+    bool MultiServer::send_msg ( int32_t id, const char * data, int size ) {
+        auto it = conns.find(id);
+        if ( it==conns.end() ) {
+            onError(id, "can't send, not connected", -1);
+            return false;
+        }
+        auto conn = it->second;
+        conn->out.insert(conn->out.end(), data, data + size);
+        if ( !conn->dirty ) {
+            conn->dirty = true;
+            dirty.push_back(id);
+        }
+        return true;
+    }
+
+    bool MultiServer::writeQueued ( Connection * conn ) {
+        while ( conn->outOffset < conn->out.size() ) {
+            auto res = ::send(conn->fd, conn->out.data() + conn->outOffset,
+                int(conn->out.size() - conn->outOffset), DAS_MSG_NOSIGNAL);
+            if ( res>0 ) {
+                conn->outOffset += uint32_t(res);
+            } else {
+                int err = socket_error();
+                if ( !would_block(err) ) {
+                    removeConnection(conn, err);
+                    return false;
+                }
+                watchWrite(conn, true);     // the rest goes when the socket is writable
+                return true;
+            }
+        }
+        conn->out.clear();
+        conn->outOffset = 0;
+        watchWrite(conn, false);
+        return true;
+    }
+
+    void MultiServer::flush() {
+        if ( dirty.empty() ) return;
+        vector<int32_t> ids;
+        swap(ids, dirty);
+        for ( auto id : ids ) {
+            auto it = conns.find(id);
+            if ( it==conns.end() ) continue;
+            auto conn = it->second;
+            conn->dirty = false;
+            if ( !conn->wantWrite ) {       // otherwise its already waiting for the socket
+                writeQueued(conn);
+            }
+        }
+    }
+
+    void MultiServer::acceptAll() {
+        for ( ;; ) {
+            struct sockaddr_in address;
+            socklen_t addrlen = sizeof(address);
+#if DAS_NETWORK_EPOLL
+            socket_t fd = accept4(server_fd, (struct sockaddr *)&address, &addrlen, SOCK_NONBLOCK | SOCK_CLOEXEC);
+#else
+            socket_t fd = accept(server_fd, (struct sockaddr *)&address, &addrlen);
+#endif
+            if ( invalid_socket(fd) ) {
+                int err = socket_error();
+                if ( !would_block(err) ) {
+                    onError(0, "can't accept", err);
+                }
+                return;
+            }
+#if !DAS_NETWORK_EPOLL
+            if ( !set_socket_blocking(fd,false) ) {
+                onError(0, "can't set client nbio", socket_error());
+                closesocket(fd);
+                continue;
+            }
+#endif
+            set_socket_options(fd);
+            if ( auto conn = addConnection(fd) ) {
+                onLog("connection accepted");
+                onConnect(conn->id);
+            }
+        }
+    }
+
+    void MultiServer::readAll ( Connection * conn ) {
+        int32_t id = conn->id;
+        for ( ;; ) {
+            char * buf = allocateBuffer();
+            auto res = recv(conn->fd, buf, recv_buffer_size, 0);
+            if ( res>0 ) {
+                buf[res] = 0;
+                onData(id, buf, int(res));
+                freeBuffer(buf);
+                if ( res<recv_buffer_size ) return;     // drained
+                if ( conns.find(id)==conns.end() ) return;  // closed from onData
+            } else {
+                freeBuffer(buf);
+                int err = res==0 ? 0 : socket_error();
+                if ( res<0 && would_block(err) ) return;
+                removeConnection(conn, err);
+                return;
+            }
+        }
+    }
+
+    void MultiServer::onEvent ( int32_t id, bool readable, bool writable ) {
+        if ( id==0 ) {
+            acceptAll();
+            return;
+        }
+        auto it = conns.find(id);
+        if ( it==conns.end() ) return;      // closed by one of the earlier events
+        auto conn = it->second;
+        if ( conn->connecting ) {
+            if ( !writable && !readable ) return;
+            int err = 0;
+            socklen_t errlen = sizeof(err);
+            getsockopt(conn->fd, SOL_SOCKET, SO_ERROR, (char *)&err, &errlen);
+            if ( err ) {
+                dropConnection(conn);
+                onError(id, "can't connect", err);
+                return;
+            }
+            conn->connecting = false;
+            onConnect(id);
+            if ( conns.find(id)==conns.end() ) return;
+            if ( !writeQueued(conn) ) return;
+            writable = false;
+        }
+        if ( writable ) {
+            if ( !writeQueued(conn) ) return;
+        }
+        if ( readable ) {
+            readAll(conn);
+        }
+    }
+
+    int32_t MultiServer::tick ( int32_t timeoutMs ) {
+        flush();
+        int32_t total = 0;
+#if DAS_NETWORK_EPOLL
+        if ( poll_fd==-1 ) return 0;
+        epoll_event events[max_events];
+        int n = epoll_wait(poll_fd, events, max_events, timeoutMs);
+        for ( int i=0; i<n; ++i ) {
+            auto ev = events[i].events;
+            bool readable = (ev & (EPOLLIN | EPOLLHUP | EPOLLERR)) != 0;     // hangup and error are reported by recv
+            bool writable = (ev & EPOLLOUT) != 0;
+            onEvent(int32_t(events[i].data.u64), readable, writable);
+        }
+        total = n>0 ? n : 0;
+#else
+        vector<das_pollfd> fds;
+        vector<int32_t> ids;
+        fds.reserve(conns.size() + 1);
+        ids.reserve(conns.size() + 1);
+        if ( server_fd ) {
+            das_pollfd pfd;
+            pfd.fd = server_fd;
+            pfd.events = POLLIN;
+            pfd.revents = 0;
+            fds.push_back(pfd);
+            ids.push_back(0);
+        }
+        for ( auto & it : conns ) {
+            das_pollfd pfd;
+            pfd.fd = it.second->fd;
+            pfd.events = POLLIN | (it.second->wantWrite ? POLLOUT : 0);
+            pfd.revents = 0;
+            fds.push_back(pfd);
+            ids.push_back(it.first);
+        }
+        if ( fds.empty() ) return 0;
+        int n = das_poll(fds.data(), (unsigned long) fds.size(), timeoutMs);
+        if ( n>0 ) {
+            for ( size_t i=0, is=fds.size(); i!=is; ++i ) {
+                auto ev = fds[i].revents;
+                if ( !ev ) continue;
+                onEvent(ids[i], (ev & (POLLIN | POLLHUP | POLLERR))!=0, (ev & POLLOUT)!=0);
+                total ++;
+            }
+        }
+#endif
+        flush();
+        return total;
+    }
+
+    void MultiServer::onConnect ( int32_t ) {
+    }
+
+    void MultiServer::onDisconnect ( int32_t ) {
+    }
+
+    void MultiServer::onData ( int32_t, char *, int ) {
+    }
+
+    void MultiServer::onError ( int32_t, const char *, int ) {
+    }
+
+    void MultiServer::onLog ( const char * ) {
+    }
 }
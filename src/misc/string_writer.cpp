@@ -10,6 +10,143 @@ namespace das {
 
     mutex TextPrinter::pmut;
 
+    static const char g_digitPairs[201] =
+        "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+        "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+
+    static const uint64_t g_pow10[20] = {
+        1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull,
+        1000000000ull, 10000000000ull, 100000000000ull, 1000000000000ull, 10000000000000ull,
+        100000000000000ull, 1000000000000000ull, 10000000000000000ull, 100000000000000000ull,
+        1000000000000000000ull, 10000000000000000000ull
+    };
+
+    // digits are written back to front, two at a time
+    static __forceinline char * fmt_digits_backwards ( uint64_t value, char * end ) {
+        while ( value>=100 ) {
+            auto pair = uint32_t(value % 100) * 2;
+            value /= 100;
+            *--end = g_digitPairs[pair + 1];
+            *--end = g_digitPairs[pair];
+        }
+        if ( value>=10 ) {
+            auto pair = uint32_t(value) * 2;
+            *--end = g_digitPairs[pair + 1];
+            *--end = g_digitPairs[pair];
+        } else {
+            *--end = char('0' + value);
+        }
+        return end;
+    }
+
+    int das_fmt_uint ( uint64_t value, char * buf ) {
+        char temp[24];
+        char * end = temp + sizeof(temp);
+        char * beg = fmt_digits_backwards(value, end);
+        int len = int(end - beg);
+        memcpy(buf, beg, len);
+        return len;
+    }
+
+    int das_fmt_int ( int64_t value, char * buf ) {
+        if ( value<0 ) {
+            *buf = '-';
+            return das_fmt_uint(0ull - uint64_t(value), buf + 1) + 1;
+        }
+        return das_fmt_uint(uint64_t(value), buf);
+    }
+
+    int das_fmt_hex ( uint64_t value, char * buf ) {
+        char temp[16];
+        char * end = temp + sizeof(temp);
+        char * beg = end;
+        do {
+            *--beg = "0123456789abcdef"[value & 15];
+            value >>= 4;
+        } while ( value );
+        int len = int(end - beg);
+        memcpy(buf, beg, len);
+        return len;
+    }
+
+    // exact binary value is split into integer part and fraction, then fraction is scaled by 10^precision
+    // and rounded half to even, just like printf does
+    int das_fmt_fixed ( double value, int precision, char * buf ) {
+        if ( !(value>-1e18 && value<1e18) || precision<0 || precision>17 ) return 0;
+        uint64_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        bool negative = (bits >> 63)!=0;
+        int exponent = int((bits >> 52) & 0x7ff);
+        uint64_t mantissa = bits & ((1ull << 52) - 1);
+        uint64_t ipart = 0, fraction = 0;
+        int shift = 0;      // value is ipart + fraction / 2^shift
+        if ( exponent==0 ) {
+            if ( mantissa ) return 0;   // denormal
+        } else {
+            mantissa |= 1ull << 52;
+            shift = 1075 - exponent;
+            if ( shift<=0 ) {
+                ipart = mantissa << -shift;
+                shift = 0;
+            } else if ( shift<64 ) {
+                ipart = mantissa >> shift;
+                fraction = mantissa & ((1ull << shift) - 1);
+            } else {
+                fraction = mantissa;
+            }
+        }
+        uint64_t scale = g_pow10[precision];
+        uint64_t digits = 0;
+        if ( fraction ) {
+#if defined(__SIZEOF_INT128__)
+            if ( shift>112 ) {
+                digits = 0;     // less than half of the last digit
+            } else {
+                unsigned __int128 product = (unsigned __int128)fraction * scale;
+                unsigned __int128 half = (unsigned __int128)1 << (shift - 1);
+                unsigned __int128 rem = product & ((half << 1) - 1);
+                digits = uint64_t(product >> shift);
+                if ( rem>half || (rem==half && ((precision ? digits : ipart) & 1)) ) digits ++;
+            }
+#else
+            if ( shift>=64 || fraction>UINT64_MAX/scale ) return 0;
+            uint64_t product = fraction * scale;
+            uint64_t half = 1ull << (shift - 1);
+            uint64_t rem = product & ((half << 1) - 1);
+            digits = product >> shift;
+            if ( rem>half || (rem==half && ((precision ? digits : ipart) & 1)) ) digits ++;
+#endif
+            if ( digits==scale ) {
+                digits = 0;
+                ipart ++;
+            }
+        }
+        char * out = buf;
+        if ( negative ) *out++ = '-';
+        out += das_fmt_uint(ipart, out);
+        if ( precision ) {
+            *out++ = '.';
+            char * end = out + precision;
+            char * beg = fmt_digits_backwards(digits, end);
+            while ( beg>out ) *--beg = '0';
+            out = end;
+        }
+        return int(out - buf);
+    }
+
+    int das_fmt_general ( double value, char * buf ) {
+        if ( !(value>-1e6 && value<1e6) ) return 0;
+        auto ivalue = int64_t(value);
+        if ( double(ivalue)!=value ) return 0;
+        if ( ivalue==0 && signbit(value) ) {
+            buf[0] = '-';
+            buf[1] = '0';
+            return 2;
+        }
+        return das_fmt_int(ivalue, buf);
+    }
+
     void TextPrinter::output() {
         lock_guard<mutex> guard(pmut);
         int newPos = tellp();
@@ -472,3 +472,91 @@ namespace das {
         return g_dasRoot;
     }
 }
+
+#if defined(_WIN32)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+    namespace das {
+        size_t getVirtualMemoryPageSize ( void ) {
+            SYSTEM_INFO si;
+            GetSystemInfo(&si);
+            return size_t(si.dwPageSize);
+        }
+        void * reserveVirtualMemory ( size_t size ) {
+            return VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS);
+        }
+        bool commitVirtualMemory ( void * ptr, size_t size ) {
+            return VirtualAlloc(ptr, size, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+        }
+        void decommitVirtualMemory ( void * ptr, size_t size ) {
+            VirtualFree(ptr, size, MEM_DECOMMIT);
+        }
+        void releaseVirtualMemory ( void * ptr, size_t ) {
+            VirtualFree(ptr, 0, MEM_RELEASE);
+        }
+        void * mapFileCopyOnWrite ( const char * fileName, size_t & size ) {
+            size = 0;
+            HANDLE file = CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if ( file==INVALID_HANDLE_VALUE ) return nullptr;
+            LARGE_INTEGER fileSize;
+            if ( !GetFileSizeEx(file, &fileSize) || fileSize.QuadPart==0 ) {
+                CloseHandle(file);
+                return nullptr;
+            }
+            HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+            CloseHandle(file);
+            if ( !mapping ) return nullptr;
+            void * ptr = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+            CloseHandle(mapping);   // view keeps the mapping alive
+            if ( ptr ) size = size_t(fileSize.QuadPart);
+            return ptr;
+        }
+        void unmapFile ( void * ptr, size_t ) {
+            UnmapViewOfFile(ptr);
+        }
+    }
+#else
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+    namespace das {
+        size_t getVirtualMemoryPageSize ( void ) {
+            return size_t(sysconf(_SC_PAGESIZE));
+        }
+        void * reserveVirtualMemory ( size_t size ) {
+            void * ptr = mmap(nullptr, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+            return ptr==MAP_FAILED ? nullptr : ptr;
+        }
+        bool commitVirtualMemory ( void * ptr, size_t size ) {
+            return mprotect(ptr, size, PROT_READ | PROT_WRITE) == 0;
+        }
+        void decommitVirtualMemory ( void * ptr, size_t size ) {
+            madvise(ptr, size, MADV_DONTNEED);
+            mprotect(ptr, size, PROT_NONE);
+        }
+        void releaseVirtualMemory ( void * ptr, size_t size ) {
+            munmap(ptr, size);
+        }
+        void * mapFileCopyOnWrite ( const char * fileName, size_t & size ) {
+            size = 0;
+            int fd = open(fileName, O_RDONLY);
+            if ( fd==-1 ) return nullptr;
+            struct stat st;
+            if ( fstat(fd, &st)!=0 || st.st_size==0 ) {
+                close(fd);
+                return nullptr;
+            }
+            void * ptr = mmap(nullptr, size_t(st.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            close(fd);      // mapping keeps the file alive
+            if ( ptr==MAP_FAILED ) return nullptr;
+            size = size_t(st.st_size);
+            return ptr;
+        }
+        void unmapFile ( void * ptr, size_t size ) {
+            munmap(ptr, size);
+        }
+    }
+#endif
@@ -0,0 +1,1402 @@
+#include "daScript/misc/platform.h"
+#include <inttypes.h>
+#include "daScript/ast/ast.h"
+
+#include "parser_state.h"
+#include "parser_impl.h"
+
+#include "ds_parser.hpp"
+
+// the token comparison test (examples/test/lexer) links this scanner next to the flex generated lexer
+#if DAS_SCANNER_RENAME
+    #define das_yylex               das_scanner_yylex
+    #define das_yylex_init_extra    das_scanner_yylex_init_extra
+    #define das_yylex_destroy       das_scanner_yylex_destroy
+    #define das_yybegin             das_scanner_yybegin
+    #define das_yybegin_reader      das_scanner_yybegin_reader
+    #define das_yyend_reader        das_scanner_yyend_reader
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP>=2)
+    #include <emmintrin.h>
+    #define DAS_SCANNER_SSE2    1
+#else
+    #define DAS_SCANNER_SSE2    0
+#endif
+
+#ifndef SCNi64
+  #define SCNi64       "lli"
+#endif
+#ifndef SCNu64
+  #define SCNu64       "llu"
+#endif
+#ifndef SCNx64
+  #define SCNx64       "llx"
+#endif
+
+/*
+    Hand written scanner. It is a drop-in replacement for the flex generated one (ds_lexer.lpp),
+    and produces exactly the same tokens, values, and locations. Every state and rule of ds_lexer.lpp
+    has a counterpart here, in the same order, with the same longest match and first rule wins policy.
+    When changing the syntax, change both. daScriptLexerTest compares the two.
+*/
+
+using namespace das;
+
+void das_yyfatalerror ( DAS_YYLTYPE * lloc, yyscan_t scanner, const string & error, CompilationError cerr = CompilationError::syntax_error );
+LineInfo tokAt ( yyscan_t scanner, const struct DAS_YYLTYPE & li );
+
+namespace das {
+
+    enum class ScannerState {
+        normal,
+        indent,
+        strb,
+        c_comment,
+        cpp_comment,
+        include,
+        reader,
+    };
+
+    struct ScannerBuffer {
+        const char *    cur = nullptr;
+        const char *    end = nullptr;
+        unique_ptr<string>  storage;    // only when characters were pushed back in front of the source
+    };
+
+    struct DasScanner {
+        DasParserState *        extra = nullptr;    // has to be first, parser accesses it via (*((DasParserState **)(scanner)))
+        const char *            cur = nullptr;
+        const char *            end = nullptr;
+        const char *            text = nullptr;     // last match, not zero terminated
+        int32_t                 leng = 0;
+        int32_t                 lineno = 1;
+        ScannerState            state = ScannerState::normal;
+        DAS_YYLTYPE *           lloc = nullptr;
+        vector<ScannerBuffer>   buffers;            // include stack, top is the one being scanned
+        vector<unique_ptr<string>>  retired;        // storage, replaced by unput during the current token
+    };
+
+    __forceinline bool isIdentStart ( char ch ) {
+        return uint32_t((ch|32)-'a')<26u || ch=='_';
+    }
+
+    __forceinline bool isIdentChar ( char ch ) {
+        return uint32_t((ch|32)-'a')<26u || uint32_t(ch-'0')<10u || ch=='_' || ch=='`';
+    }
+
+    __forceinline bool isDigit ( char ch ) {
+        return uint32_t(ch-'0')<10u;
+    }
+
+    __forceinline bool isHexDigit ( char ch ) {
+        return uint32_t(ch-'0')<10u || uint32_t((ch|32)-'a')<6u;
+    }
+
+    // first '\n' at or after ptr, or end
+    __forceinline const char * findNewLine ( const char * ptr, const char * end ) {
+        auto nl = (const char *) memchr(ptr, '\n', end - ptr);
+        return nl ? nl : end;
+    }
+
+    // first character of the c-style comment, which is not a plain comment body ('/', '*'), or end
+    // counts new lines along the way
+    __forceinline const char * skipCommentBody ( const char * ptr, const char * end, int32_t & lines ) {
+#if DAS_SCANNER_SSE2
+        const __m128i star = _mm_set1_epi8('*');
+        const __m128i slash = _mm_set1_epi8('/');
+        const __m128i nl = _mm_set1_epi8('\n');
+        while ( end - ptr >= 16 ) {
+            __m128i chunk = _mm_loadu_si128((const __m128i *)ptr);
+            uint32_t stop = uint32_t(_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chunk,star),_mm_cmpeq_epi8(chunk,slash))));
+            uint32_t newLines = uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk,nl)));
+            if ( stop ) {
+                uint32_t index = das_ctz(stop);
+                lines += das_popcount(newLines & ((1u<<index)-1));
+                return ptr + index;
+            }
+            lines += das_popcount(newLines);
+            ptr += 16;
+        }
+#endif
+        for ( ; ptr!=end; ++ptr ) {
+            char ch = *ptr;
+            if ( ch=='*' || ch=='/' ) break;
+            if ( ch=='\n' ) lines ++;
+        }
+        return ptr;
+    }
+
+    // number of spaces, tabs and carriage returns at ptr
+    __forceinline int32_t whiteSpaceRun ( const char * ptr, const char * end ) {
+        auto head = ptr;
+#if DAS_SCANNER_SSE2
+        const __m128i space = _mm_set1_epi8(' ');
+        const __m128i tab = _mm_set1_epi8('\t');
+        const __m128i cr = _mm_set1_epi8('\r');
+        while ( end - ptr >= 16 ) {
+            __m128i chunk = _mm_loadu_si128((const __m128i *)ptr);
+            __m128i ws = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk,space),_mm_cmpeq_epi8(chunk,tab)),_mm_cmpeq_epi8(chunk,cr));
+            uint32_t notWs = uint32_t(_mm_movemask_epi8(ws)) ^ 0xffffu;
+            if ( notWs ) return int32_t(ptr - head) + int32_t(das_ctz(notWs));
+            ptr += 16;
+        }
+#endif
+        while ( ptr!=end && (*ptr==' ' || *ptr=='\t' || *ptr=='\r') ) ptr ++;
+        return int32_t(ptr - head);
+    }
+
+    enum { SCANNER_INCLUDE = -2 };  // 'include' switches to the include state, its not a token
+
+    struct ScannerKeyword {
+        const char *    name;
+        int32_t         token;
+        bool            block;      // resets oxford comma, i.e. opens the indented block
+    };
+
+    static const ScannerKeyword g_scannerKeywords[] = {
+        { "include",    SCANNER_INCLUDE,    false },
+        { "for",        DAS_FOR,            false },
+        { "while",      DAS_WHILE,          true },
+        { "if",         DAS_IF,             true },
+        { "static_if",  DAS_STATIC_IF,      true },
+        { "elif",       DAS_ELIF,           true },
+        { "static_elif",DAS_STATIC_ELIF,    true },
+        { "else",       DAS_ELSE,           true },
+        { "finally",    DAS_FINALLY,        true },
+        { "def",        DAS_DEF,            true },
+        { "with",       DAS_WITH,           true },
+        { "aka",        DAS_AKA,            false },
+        { "assume",     DAS_ASSUME,         false },
+        { "let",        DAS_LET,            false },
+        { "var",        DAS_VAR,            false },
+        { "struct",     DAS_STRUCT,         true },
+        { "class",      DAS_CLASS,          true },
+        { "enum",       DAS_ENUM,           true },
+        { "try",        DAS_TRY,            true },
+        { "recover",    DAS_CATCH,          true },
+        { "typedef",    DAS_TYPEDEF,        true },
+        { "label",      DAS_LABEL,          false },
+        { "goto",       DAS_GOTO,           false },
+        { "module",     DAS_MODULE,         false },
+        { "public",     DAS_PUBLIC,         false },
+        { "options",    DAS_OPTIONS,        false },
+        { "operator",   DAS_OPERATOR,       false },
+        { "require",    DAS_REQUIRE,        false },
+        { "block",      DAS_TBLOCK,         false },
+        { "function",   DAS_TFUNCTION,      false },
+        { "lambda",     DAS_TLAMBDA,        false },
+        { "generator",  DAS_GENERATOR,      false },
+        { "tuple",      DAS_TTUPLE,         false },
+        { "variant",    DAS_TVARIANT,       false },
+        { "const",      DAS_CONST,          false },
+        { "continue",   DAS_CONTINUE,       false },
+        { "where",      DAS_WHERE,          false },
+        { "cast",       DAS_CAST,           false },
+        { "upcast",     DAS_UPCAST,         false },
+        { "pass",       DAS_PASS,           false },
+        { "reinterpret",DAS_REINTERPRET,    false },
+        { "override",   DAS_OVERRIDE,       false },
+        { "sealed",     DAS_SEALED,         false },
+        { "abstract",   DAS_ABSTRACT,       false },
+        { "expect",     DAS_EXPECT,         false },
+        { "table",      DAS_TABLE,          false },
+        { "array",      DAS_ARRAY,          false },
+        { "iterator",   DAS_ITERATOR,       false },
+        { "in",         DAS_IN,             false },
+        { "implicit",   DAS_IMPLICIT,       false },
+        { "explicit",   DAS_EXPLICIT,       false },
+        { "shared",     DAS_SHARED,         false },
+        { "private",    DAS_PRIVATE,        false },
+        { "smart_ptr",  DAS_SMART_PTR,      false },
+        { "unsafe",     DAS_UNSAFE,         true },
+        { "as",         DAS_AS,             false },
+        { "is",         DAS_IS,             false },
+        { "deref",      DAS_DEREF,          false },
+        { "addr",       DAS_ADDR,           false },
+        { "null",       DAS_NULL,           false },
+        { "return",     DAS_RETURN,         false },
+        { "yield",      DAS_YIELD,          false },
+        { "break",      DAS_BREAK,          false },
+        { "typeinfo",   DAS_TYPEINFO,       false },
+        { "type",       DAS_TYPE,           false },
+        { "new",        DAS_NEWT,           false },
+        { "delete",     DAS_DELETE,         false },
+        { "true",       DAS_TRUE,           false },
+        { "false",      DAS_FALSE,          false },
+        { "auto",       DAS_TAUTO,          false },
+        { "bool",       DAS_TBOOL,          false },
+        { "void",       DAS_TVOID,          false },
+        { "string",     DAS_TSTRING,        false },
+        { "range",      DAS_TRANGE,         false },
+        { "urange",     DAS_TURANGE,        false },
+        { "int",        DAS_TINT,           false },
+        { "int8",       DAS_TINT8,          false },
+        { "int16",      DAS_TINT16,         false },
+        { "int64",      DAS_TINT64,         false },
+        { "int2",       DAS_TINT2,          false },
+        { "int3",       DAS_TINT3,          false },
+        { "int4",       DAS_TINT4,          false },
+        { "uint",       DAS_TUINT,          false },
+        { "bitfield",   DAS_TBITFIELD,      false },
+        { "uint8",      DAS_TUINT8,         false },
+        { "uint16",     DAS_TUINT16,        false },
+        { "uint64",     DAS_TUINT64,        false },
+        { "uint2",      DAS_TUINT2,         false },
+        { "uint3",      DAS_TUINT3,         false },
+        { "uint4",      DAS_TUINT4,         false },
+        { "double",     DAS_TDOUBLE,        false },
+        { "float",      DAS_TFLOAT,         false },
+        { "float2",     DAS_TFLOAT2,        false },
+        { "float3",     DAS_TFLOAT3,        false },
+        { "float4",     DAS_TFLOAT4,        false },
+    };
+
+    // open addressing table over the keywords above, built once
+    class ScannerKeywordTable {
+        enum { tableSize = 512 };
+        const ScannerKeyword *  table[tableSize];
+        static __forceinline uint32_t hashOf ( const char * name, int32_t len ) {
+            uint32_t hash = uint32_t(len) * 0x9E3779B1u;
+            for ( int32_t i=0; i!=len; ++i ) hash = (hash ^ uint8_t(name[i])) * 0x01000193u;
+            return hash;
+        }
+    public:
+        ScannerKeywordTable() {
+            memset(table, 0, sizeof(table));
+            for ( const auto & kw : g_scannerKeywords ) {
+                auto index = hashOf(kw.name, int32_t(strlen(kw.name))) & (tableSize-1);
+                while ( table[index] ) index = (index + 1) & (tableSize-1);
+                table[index] = &kw;
+            }
+        }
+        __forceinline const ScannerKeyword * find ( const char * name, int32_t len ) const {
+            if ( len>11 ) return nullptr;   // longest keyword is 'static_elif'
+            auto index = hashOf(name, len) & (tableSize-1);
+            while ( auto kw = table[index] ) {
+                if ( strncmp(kw->name, name, len)==0 && kw->name[len]==0 ) return kw;
+                index = (index + 1) & (tableSize-1);
+            }
+            return nullptr;
+        }
+    };
+
+    static const ScannerKeywordTable g_scannerKeywordTable;
+
+    class Scanner {
+    public:
+        Scanner ( DasScanner * s, DAS_YYSTYPE * lval, DAS_YYLTYPE * lloc ) : scan(s), yylval(lval) {
+            scan->lloc = lloc;
+            scan->retired.clear();
+        }
+        int lex();
+    protected:
+        DasScanner *    scan;
+        DAS_YYSTYPE *   yylval;
+    protected:
+        __forceinline DasParserState * extra() const { return scan->extra; }
+        __forceinline yyscan_t scanner() const { return (yyscan_t) scan; }
+        __forceinline int32_t avail() const { return int32_t(scan->end - scan->cur); }
+        __forceinline char at ( int32_t i ) const { return (scan->cur + i) < scan->end ? scan->cur[i] : 0; }
+        __forceinline bool eof() const { return scan->cur==scan->end; }
+        // YY_USER_ACTION, after the line count
+        __forceinline void match ( int32_t len, bool countLines = true ) {
+            auto lloc = scan->lloc;
+            scan->text = scan->cur;
+            scan->leng = len;
+            if ( countLines ) {
+                for ( int32_t i=0; i!=len; ++i ) {
+                    if ( scan->cur[i]=='\n' ) scan->lineno ++;
+                }
+            }
+            scan->cur += len;
+            auto & col = extra()->das_yycolumn;
+            lloc->first_line = lloc->last_line = scan->lineno;
+            lloc->first_column = col;
+            lloc->last_column = col + len - 1;
+            col += len;
+        }
+        // same as a sequence of single character matches, for the runs of whitespace and comment body
+        __forceinline void matchRun ( int32_t len, int32_t lines ) {
+            if ( !len ) return;
+            auto lloc = scan->lloc;
+            scan->text = scan->cur + len - 1;
+            scan->leng = 1;
+            scan->lineno += lines;
+            scan->cur += len;
+            auto & col = extra()->das_yycolumn;
+            lloc->first_line = lloc->last_line = scan->lineno;
+            lloc->first_column = lloc->last_column = col + len - 1;
+            col += len;
+        }
+        __forceinline string yytext() const {
+            return string(scan->text, scan->leng);
+        }
+        void unput ( char ch );
+        void begin ( ScannerState st ) { scan->state = st; }
+        void popBuffer();
+        void newLine() { extra()->das_yycolumn = 0; }
+        int32_t numberLength ( int32_t & rule ) const;
+        int numberToken ( int32_t rule );
+        int32_t lineDirectiveLength() const;
+        bool lineDirective();
+        void acceptCppComment ( const char * txt );
+        int lexNormal();
+        int lexIndent();
+        int lexString();
+        int lexCComment();
+        int lexCppComment();
+        int lexInclude();
+        int lexReader();
+    };
+
+    enum {
+        NUMBER_NONE = -1,
+        NUMBER_ULL,         // [0-9]+(u|U)(l|L)
+        NUMBER_LL,          // [0-9]+(l|L)
+        NUMBER_U,           // [0-9]+(u|U)
+        NUMBER_RANGE,       // [0-9]+\.\.
+        NUMBER_INT,         // [0-9]+
+        NUMBER_HEX_ULL,     // 0[xX][0-9a-fA-F]+(u|U)(l|L)
+        NUMBER_HEX_LL,      // 0[xX][0-9a-fA-F]+(l|L)
+        NUMBER_HEX_U,       // 0[xX][0-9a-fA-F]+(u|U)
+        NUMBER_HEX,         // 0[xX][0-9a-fA-F]+
+        NUMBER_FLOAT,       // all 4 float forms, they share the action
+        NUMBER_DOUBLE,      // all 4 double forms, they share the action
+    };
+
+    // characters pushed back are read before the rest of the buffer
+    void Scanner::unput ( char ch ) {
+        auto & buf = scan->buffers.back();
+        bool atHead = buf.storage && scan->cur==buf.storage->data();
+        if ( !atHead && scan->cur[-1]==ch ) {
+            scan->cur --;                   // putting back what we just read, source stays as is
+        } else {
+            auto pushed = make_unique<string>();
+            pushed->reserve(1 + (scan->end - scan->cur));
+            *pushed += ch;
+            pushed->append(scan->cur, scan->end);
+            if ( buf.storage ) scan->retired.emplace_back(move(buf.storage));
+            buf.storage = move(pushed);
+            scan->cur = buf.storage->data();
+            scan->end = buf.storage->data() + buf.storage->size();
+        }
+        if ( ch=='\n' ) {
+            scan->lineno --;
+        }
+    }
+
+    void Scanner::popBuffer() {
+        if ( scan->buffers.back().storage ) {
+            scan->retired.emplace_back(move(scan->buffers.back().storage));
+        }
+        scan->buffers.pop_back();
+        if ( !scan->buffers.empty() ) {
+            auto & buf = scan->buffers.back();
+            scan->cur = buf.cur;
+            scan->end = buf.end;
+        } else {
+            scan->cur = scan->end = nullptr;
+        }
+    }
+
+    void Scanner::acceptCppComment ( const char * txt ) {
+        auto & crdi = extra()->g_CommentReaders;
+        if ( crdi.empty() ) return;
+        while ( !(txt[0]=='/' && txt[1]=='/') && *txt!='\n' ) txt ++;
+        if ( *txt=='\n' ) return;
+        auto tak = tokAt(scanner(),*scan->lloc);
+        for ( auto & crd : crdi ) crd->open(false, tak);
+        for ( auto ch = txt + 2; *ch!='\n'; ++ch ) {
+            if ( *ch!='\r' ) {
+                for ( auto & crd : crdi ) crd->accept(*ch, tak);
+            }
+        }
+        for ( auto & crd : crdi ) crd->close(tak);
+    }
+
+    // \#[0-9]+,[0-9]+,\"[^\"]+\"\#
+    int32_t Scanner::lineDirectiveLength() const {
+        int32_t i = 1;
+        auto digits = [&]() { int32_t s = i; while ( isDigit(at(i)) ) i++; return i!=s; };
+        if ( !digits() || at(i)!=',' ) return 0;
+        i ++;
+        if ( !digits() || at(i)!=',' ) return 0;
+        i ++;
+        if ( at(i)!='"' ) return 0;
+        i ++;
+        int32_t s = i;
+        while ( i<avail() && scan->cur[i]!='"' ) i ++;
+        if ( i==s || i>=avail() ) return 0;
+        i ++;
+        if ( at(i)!='#' ) return 0;
+        return i + 1;
+    }
+
+    bool Scanner::lineDirective() {
+        string txt = yytext();
+        int lRow, lCol;
+        char lFile[256];
+        if ( sscanf ( txt.c_str(), "#%i,%i,\"%255s\"#", &lRow, &lCol, lFile )==3 ) {
+            lFile[strlen(lFile)-2] = 0;
+            auto cfi = extra()->g_FileAccessStack.back();
+            string incFileName = extra()->g_Access->getIncludeFileName(cfi->name,lFile);
+            auto info = extra()->g_Access->getFileInfo(incFileName);
+            if ( !info ) {
+                das_yyfatalerror(scan->lloc,scanner(),"can't open "+incFileName);
+            } else {
+                extra()->g_FileAccessStack.pop_back();
+                extra()->g_FileAccessStack.push_back(info);
+                scan->lineno = lRow;
+                extra()->das_yycolumn = lCol;
+            }
+            return true;
+        } else {
+            das_yyfatalerror(scan->lloc,scanner(),"can't process line directive " + txt,
+                CompilationError::invalid_line_directive);
+            return false;
+        }
+    }
+
+    // longest of the numeric rules at the current position, rule is the first one of that length
+    int32_t Scanner::numberLength ( int32_t & rule ) const {
+        int32_t best = 0;
+        rule = NUMBER_NONE;
+        auto candidate = [&]( int32_t len, int32_t r ) {
+            if ( len > best ) { best = len; rule = r; }
+        };
+        auto digitsAt = [&]( int32_t i ) { int32_t s = i; while ( isDigit(at(i)) ) i++; return i - s; };
+        auto isU = [&]( int32_t i ) { char ch = at(i); return ch=='u' || ch=='U'; };
+        auto isL = [&]( int32_t i ) { char ch = at(i); return ch=='l' || ch=='L'; };
+        auto isF = [&]( int32_t i ) { char ch = at(i); return ch=='f' || ch=='F'; };
+        auto isLF = [&]( int32_t i ) { return at(i)=='l' && at(i+1)=='f'; };
+        // [eE][+\-]?[0-9]+
+        auto exponentAt = [&]( int32_t i ) -> int32_t {
+            char ch = at(i);
+            if ( ch!='e' && ch!='E' ) return 0;
+            int32_t j = i + 1;
+            if ( at(j)=='+' || at(j)=='-' ) j ++;
+            int32_t nd = digitsAt(j);
+            return nd ? (j + nd - i) : 0;
+        };
+        int32_t nd = digitsAt(0);
+        if ( nd ) {
+            if ( isU(nd) && isL(nd+1) ) candidate(nd+2, NUMBER_ULL);
+            if ( isL(nd) ) candidate(nd+1, NUMBER_LL);
+            if ( isU(nd) ) candidate(nd+1, NUMBER_U);
+            if ( at(nd)=='.' && at(nd+1)=='.' ) candidate(nd+2, NUMBER_RANGE);
+            candidate(nd, NUMBER_INT);
+            if ( at(0)=='0' && (at(1)=='x' || at(1)=='X') ) {
+                int32_t nh = 0;
+                while ( isHexDigit(at(2+nh)) ) nh ++;
+                if ( nh ) {
+                    int32_t hl = 2 + nh;
+                    if ( isU(hl) && isL(hl+1) ) candidate(hl+2, NUMBER_HEX_ULL);
+                    if ( isL(hl) ) candidate(hl+1, NUMBER_HEX_LL);
+                    if ( isU(hl) ) candidate(hl+1, NUMBER_HEX_U);
+                    candidate(hl, NUMBER_HEX);
+                }
+            }
+        }
+        // ([0-9]*)?\.[0-9]+([eE][+\-]?[0-9]+)?   and   [0-9][0-9]*\.[0-9]+?([eE][+\-]?[0-9]+)?
+        int32_t mantissa = 0;
+        if ( at(nd)=='.' ) {
+            int32_t nf = digitsAt(nd+1);
+            if ( nf || nd ) {
+                mantissa = nd + 1 + nf;
+                mantissa += exponentAt(mantissa);
+            }
+        }
+        // [0-9]+[eE][+\-]?[0-9]+
+        int32_t scientific = 0;
+        if ( nd ) {
+            int32_t ne = exponentAt(nd);
+            if ( ne ) scientific = nd + ne;
+        }
+        if ( mantissa ) candidate(isF(mantissa) ? mantissa+1 : mantissa, NUMBER_FLOAT);
+        if ( nd && isF(nd) ) candidate(nd+1, NUMBER_FLOAT);
+        if ( scientific ) candidate(isF(scientific) ? scientific+1 : scientific, NUMBER_FLOAT);
+        if ( mantissa && isLF(mantissa) ) candidate(mantissa+2, NUMBER_DOUBLE);
+        if ( nd && isLF(nd) ) candidate(nd+2, NUMBER_DOUBLE);
+        if ( scientific && isLF(scientific) ) candidate(scientific+2, NUMBER_DOUBLE);
+        return best;
+    }
+
+    int Scanner::numberToken ( int32_t rule ) {
+        char buffer[128];
+        string longText;
+        const char * yytext;
+        if ( scan->leng < int32_t(sizeof(buffer)) ) {
+            memcpy(buffer, scan->text, scan->leng);
+            buffer[scan->leng] = 0;
+            yytext = buffer;
+        } else {
+            longText = this->yytext();
+            yytext = longText.c_str();
+        }
+        switch ( rule ) {
+        case NUMBER_ULL: {
+                char * endtext = nullptr;
+                yylval->ui64 = strtoull(yytext,&endtext,10);
+                return ( endtext!=(yytext+strlen(yytext)-2) ) ? LEXER_ERROR : UNSIGNED_LONG_INTEGER;
+            }
+        case NUMBER_LL: {
+                char * endtext = nullptr;
+                yylval->i64 = strtoll(yytext,&endtext,10);
+                return ( endtext!=(yytext+strlen(yytext)-1) ) ? LEXER_ERROR : LONG_INTEGER;
+            }
+        case NUMBER_U: {
+                char * endtext = nullptr;
+                uint64_t uint_const = strtoull(yytext,&endtext,10);
+                if ( endtext!=(yytext+strlen(yytext)-1) ) {
+                    return LEXER_ERROR;
+                } else {
+                    if ( uint_const>UINT32_MAX ) {
+                        das_yyfatalerror(scan->lloc,scanner(),"integer constant out of range", CompilationError::integer_constant_out_of_range);
+                    }
+                    yylval->ui = uint32_t(uint_const);
+                    return UNSIGNED_INTEGER;
+                }
+            }
+        case NUMBER_RANGE: {
+                char * endtext = nullptr;
+                int64_t int_const = strtoll(yytext,&endtext,10);
+                if ( endtext!=(yytext+strlen(yytext)-2) ) {
+                    return LEXER_ERROR;
+                } else {
+                    if ( int_const<INT32_MIN || int_const>INT32_MAX ) {
+                        das_yyfatalerror(scan->lloc,scanner(),"integer constant out of range", CompilationError::integer_constant_out_of_range);
+                    }
+                    yylval->i = int32_t(int_const);
+                    unput('.');
+                    extra()->das_yycolumn--;
+                    unput('.');
+                    extra()->das_yycolumn--;
+                    return INTEGER;
+                }
+            }
+        case NUMBER_INT: {
+                char * endtext = nullptr;
+                int64_t int_const = strtoll(yytext,&endtext,10);
+                if ( endtext!=(yytext+strlen(yytext)) ) {
+                    return LEXER_ERROR;
+                } else {
+                    if ( int_const<INT32_MIN || int_const>INT32_MAX ) {
+                        das_yyfatalerror(scan->lloc,scanner(),"integer constant out of range", CompilationError::integer_constant_out_of_range);
+                    }
+                    yylval->i = int32_t(int_const);
+                    return INTEGER;
+                }
+            }
+        case NUMBER_HEX_ULL:
+        case NUMBER_HEX_LL:
+            return sscanf(yytext, "%" SCNx64, &yylval->ui64)!=1 ? LEXER_ERROR : UNSIGNED_LONG_INTEGER;
+        case NUMBER_HEX_U:
+        case NUMBER_HEX: {
+                uint64_t int_const;
+                if ( sscanf(yytext, "%" SCNx64,  &int_const)!=1 ) {
+                    return LEXER_ERROR;
+                } else {
+                    if ( int_const>UINT32_MAX ) {
+                        das_yyfatalerror(scan->lloc,scanner(),"integer constant out of range", CompilationError::integer_constant_out_of_range);
+                    }
+                    yylval->ui = uint32_t(int_const);
+                    return UNSIGNED_INTEGER;
+                }
+            }
+        case NUMBER_FLOAT:
+            return sscanf(yytext, "%lf", &yylval->fd)!=1 ? LEXER_ERROR : FLOAT;
+        case NUMBER_DOUBLE:
+            return sscanf(yytext, "%lf", &yylval->d)!=1 ? LEXER_ERROR : DOUBLE;
+        default:
+            DAS_ASSERTF(0, "unexpected number rule");
+            return LEXER_ERROR;
+        }
+    }
+
+    int Scanner::lexNormal() {
+        auto ex = extra();
+        for ( ;; ) {
+            if ( eof() ) {
+                if ( ex->g_FileAccessStack.size()==1 ) {
+                    ex->das_yycolumn = 0;
+                    if  ( !ex->das_nested_parentheses && !ex->das_nested_curly_braces && !ex->das_nested_square_braces ) {
+                        bool ns = (ex->das_current_line_indent!=0) && ex->das_need_oxford_comma;
+                        ex->das_current_line_indent = 0;
+                        ex->das_need_oxford_comma = true;
+                        begin(ScannerState::indent);
+                        if ( ns ) {
+                            return ';';
+                        }
+                        return -1;
+                    } else {
+                        return 0;
+                    }
+                } else {
+                    popBuffer();
+                    ex->g_FileAccessStack.pop_back();
+                    scan->lineno = ex->das_line_no.back();
+                    ex->das_line_no.pop_back();
+                    continue;
+                }
+            }
+            const char * p = scan->cur;
+            char ch = *p;
+            char next = at(1);
+            switch ( ch ) {
+            case ' ':
+            case '\r':
+            case '\t':
+                matchRun(whiteSpaceRun(p, scan->end), 0);
+                continue;
+            case '\n':
+                match(1);
+            newLineRule:
+                // (\/\/.*)*\n
+                ex->das_yycolumn = 0;
+                acceptCppComment(scan->text);
+                if  ( !ex->das_nested_parentheses && !ex->das_nested_curly_braces && !ex->das_nested_square_braces ) {
+                    bool ns = ((ex->das_current_line_indent!=0) && ex->das_need_oxford_comma) || ex->das_force_oxford_comma;
+                    ex->das_force_oxford_comma = false;
+                    ex->das_current_line_indent = 0;
+                    ex->das_need_oxford_comma = true;
+                    begin(ScannerState::indent);
+                    if ( ns ) {
+                        return ';';
+                    }
+                    return -1;
+                }
+                continue;
+            case '#':
+                if ( int32_t len = lineDirectiveLength() ) {
+                    match(len);
+                    if ( !lineDirective() ) return LEXER_ERROR;
+                    continue;
+                }
+                break;
+            case '*':
+                if ( next=='/' ) {
+                    match(2);
+                    das_yyfatalerror(scan->lloc,scanner(),"Unexpected */", CompilationError::unexpected_close_comment);
+                    return LEXER_ERROR;
+                } else if ( next=='=' ) {
+                    match(2); return MULEQU;
+                }
+                break;
+            case '/':
+                if ( next=='*' ) {
+                    match(2);
+                    begin(ScannerState::c_comment);
+                    ex->das_c_style_depth = 1;
+                    ex->das_in_normal = true;
+                    if ( !ex->g_CommentReaders.empty() ) {
+                        auto tak = tokAt(scanner(),*scan->lloc);
+                        for ( auto & crd : ex->g_CommentReaders ) crd->open(false, tak);
+                    }
+                    return -1;
+                } else if ( next=='/' ) {
+                    auto nl = findNewLine(p + 2, scan->end);
+                    if ( nl!=scan->end ) {
+                        match(int32_t(nl - p) + 1);
+                        goto newLineRule;
+                    }
+                    match(2);
+                    begin(ScannerState::cpp_comment);
+                    if ( !ex->g_CommentReaders.empty() ) {
+                        auto tak = tokAt(scanner(),*scan->lloc);
+                        for ( auto & crd : ex->g_CommentReaders ) crd->open(true, tak);
+                    }
+                    return -1;
+                } else if ( next=='=' ) {
+                    match(2); return DIVEQU;
+                }
+                break;
+            case '"':
+                match(1);
+                begin(ScannerState::strb);
+                return BEGIN_STRING;
+            case '\'':
+                if ( next=='\\' && at(3)=='\'' ) {
+                    switch ( at(2) ) {
+                        case 'b':   match(4); yylval->i = 8; return INTEGER;
+                        case 't':   match(4); yylval->i = 9; return INTEGER;
+                        case 'n':   match(4); yylval->i = 10; return INTEGER;
+                        case 'f':   match(4); yylval->i = 12; return INTEGER;
+                        case 'r':   match(4); yylval->i = 13; return INTEGER;
+                        case '\\':  match(4); yylval->i = '\\'; return INTEGER;
+                        default:    break;
+                    }
+                }
+                if ( avail()>=3 && next!='\n' && at(2)=='\'' ) {
+                    match(3);
+                    yylval->i = int32_t(scan->text[1]);
+                    return INTEGER;
+                }
+                break;
+            case '.':
+                if ( isDigit(next) ) {
+                    int32_t rule;
+                    int32_t len = numberLength(rule);
+                    match(len);
+                    return numberToken(rule);
+                } else if ( next=='.' ) {
+                    match(2); return DOTDOT;
+                }
+                break;
+            case '(':
+                match(1);
+                ex->das_nested_parentheses ++;
+                return '(';
+            case ')':
+                match(1);
+                if ( !ex->das_nested_parentheses ) {
+                    das_yyfatalerror(scan->lloc,scanner(),"mismatching parentheses", CompilationError::mismatching_parentheses);
+                    return LEXER_ERROR;
+                }
+                ex->das_nested_parentheses --;
+                return ')';
+            case '[':
+                if ( next=='[' ) {
+                    match(2);
+                    ex->das_nested_square_braces ++;
+                    ex->das_nested_square_braces ++;
+                    return BRABRAB;
+                } else if ( next=='{' ) {
+                    match(2);
+                    ex->das_nested_square_braces ++;
+                    ex->das_nested_curly_braces ++;
+                    return BRACBRB;
+                }
+                match(1);
+                ex->das_nested_square_braces ++;
+                return '[';
+            case ']':
+                match(1);
+                if ( !ex->das_nested_square_braces ) {
+                    das_yyfatalerror(scan->lloc,scanner(),"mismatching square braces", CompilationError::mismatching_parentheses);
+                    return LEXER_ERROR;
+                }
+                ex->das_nested_square_braces --;
+                return ']';
+            case '{':
+                if ( next=='{' ) {
+                    match(2);
+                    ex->das_nested_curly_braces ++;
+                    ex->das_nested_curly_braces ++;
+                    return CBRCBRB;
+                }
+                match(1);
+                if ( ex->das_nested_sb ) {
+                    ex->das_nested_sb ++;
+                } else {
+                    ex->das_nested_curly_braces ++;
+                }
+                return '{';
+            case '}':
+                match(1);
+                if ( ex->das_nested_sb ) {
+                    ex->das_nested_sb --;
+                    if ( !ex->das_nested_sb ) {
+                        begin(ScannerState::strb);
+                        return END_STRING_EXPR;
+                    } else {
+                        return '}';
+                    }
+                } else {
+                    if ( !ex->das_nested_curly_braces ) {
+                        das_yyfatalerror(scan->lloc,scanner(),"mismatching curly braces", CompilationError::mismatching_curly_bracers);
+                        return LEXER_ERROR;
+                    }
+                    ex->das_nested_curly_braces --;
+                    return '}';
+                }
+            case ':':
+                if ( next==':' ) { match(2); return COLCOL; }
+                if ( next=='=' ) { match(2); return CLONEEQU; }
+                break;
+            case '|':
+                if ( next=='>' ) { match(2); return RPIPE; }
+                if ( next=='|' ) {
+                    if ( at(2)=='=' ) { match(3); return OROREQU; }
+                    match(2); return OROR;
+                }
+                if ( next=='=' ) { match(2); return OREQU; }
+                break;
+            case '<':
+                if ( next=='|' ) {
+                    int32_t ws = 2;
+                    while ( at(ws)==' ' || at(ws)=='\t' || at(ws)=='\r' ) ws ++;
+                    if ( at(ws)=='/' && at(ws+1)=='/' ) {
+                        auto nl = findNewLine(p + ws + 2, scan->end);
+                        if ( nl!=scan->end ) {
+                            match(int32_t(nl - p) + 1);
+                            ex->das_need_oxford_comma = false;
+                            unput('\n');
+                            acceptCppComment(scan->text);
+                            return LBPIPE;
+                        }
+                    } else if ( at(ws)=='\n' && ws<avail() ) {
+                        match(ws + 1);
+                        ex->das_need_oxford_comma = false;
+                        unput('\n');
+                        return LBPIPE;
+                    }
+                    if ( (at(2)==' ' || at(2)=='\t') && (at(3)=='$' || at(3)=='@') ) {
+                        char unp = at(3);
+                        match(4);
+                        unput(unp);
+                        ex->das_yycolumn--;
+                        if ( ex->das_nested_parentheses ) {
+                            return LPIPE;
+                        } else {
+                            ex->das_need_oxford_comma = false;
+                            return LBPIPE;
+                        }
+                    }
+                    match(2); return LPIPE;
+                }
+                if ( next=='<' ) {
+                    if ( at(2)=='<' ) {
+                        if ( at(3)=='=' ) { match(4); return ROTLEQU; }
+                        match(3); return ROTL;
+                    }
+                    if ( at(2)=='=' ) { match(3); return SHLEQU; }
+                    match(2); return SHL;
+                }
+                if ( next=='=' ) { match(2); return LEEQU; }
+                if ( next=='-' ) { match(2); return LARROW; }
+                break;
+            case '>':
+                if ( next=='>' ) {
+                    if ( at(2)=='>' ) {
+                        if ( at(3)=='=' ) { match(4); return ROTREQU; }
+                        match(3);
+                        if ( ex->das_arrow_depth ) {
+                            unput('>');
+                            unput('>');
+                            ex->das_yycolumn-=2;
+                            return '>';
+                        } else {
+                            return ROTR;
+                        }
+                    }
+                    if ( at(2)=='=' ) { match(3); return SHREQU; }
+                    match(2);
+                    if ( ex->das_arrow_depth ) {
+                        unput('>');
+                        ex->das_yycolumn--;
+                        return '>';
+                    } else {
+                        return SHR;
+                    }
+                }
+                if ( next=='=' ) { match(2); return GREQU; }
+                break;
+            case '@': {
+                    int32_t i = (next=='@') ? 2 : 1;
+                    int32_t ws = i;
+                    while ( at(ws)==' ' || at(ws)=='\t' ) ws ++;
+                    if ( at(ws)=='<' && at(ws+1)=='|' ) {
+                        match(ws + 2);
+                        if ( i==2 ) {
+                            unput('@');
+                            unput('@');
+                            ex->das_yycolumn-=2;
+                        } else {
+                            unput('@');
+                            ex->das_yycolumn--;
+                        }
+                        if ( !ex->das_nested_parentheses ) {
+                            ex->das_need_oxford_comma = false;
+                        }
+                        return i==2 ? LFPIPE : LAPIPE;
+                    }
+                }
+                break;
+            case '?':
+                if ( next=='?' ) { match(2); return QQ; }
+                if ( next=='[' ) {
+                    match(2);
+                    ex->das_nested_square_braces ++;
+                    return QBRA;
+                }
+                if ( next=='.' ) { match(2); return QDOT; }
+                break;
+            case '-':
+                if ( next=='>' ) { match(2); return RARROW; }
+                if ( next=='=' ) { match(2); return SUBEQU; }
+                if ( next=='-' ) { match(2); return SUBSUB; }
+                break;
+            case '+':
+                if ( next=='=' ) { match(2); return ADDEQU; }
+                if ( next=='+' ) { match(2); return ADDADD; }
+                break;
+            case '%':
+                if ( next=='=' ) { match(2); return MODEQU; }
+                break;
+            case '&':
+                if ( next=='&' ) {
+                    if ( at(2)=='=' ) { match(3); return ANDANDEQU; }
+                    match(2); return ANDAND;
+                }
+                if ( next=='=' ) { match(2); return ANDEQU; }
+                break;
+            case '^':
+                if ( next=='^' ) {
+                    if ( at(2)=='=' ) { match(3); return XORXOREQU; }
+                    match(2); return XORXOR;
+                }
+                if ( next=='=' ) { match(2); return XOREQU; }
+                break;
+            case '=':
+                if ( next=='=' ) { match(2); return EQUEQU; }
+                if ( next=='>' ) { match(2); return MAPTO; }
+                break;
+            case '!':
+                if ( next=='=' ) { match(2); return NOTEQU; }
+                break;
+            default:
+                if ( isDigit(ch) ) {
+                    int32_t rule;
+                    int32_t len = numberLength(rule);
+                    match(len);
+                    return numberToken(rule);
+                } else if ( isIdentStart(ch) ) {
+                    int32_t len = 1;
+                    int32_t left = avail();
+                    while ( len<left && isIdentChar(p[len]) ) len ++;
+                    if ( auto kw = g_scannerKeywordTable.find(p, len) ) {
+                        switch ( kw->token ) {
+                        case DAS_LET:
+                        case DAS_VAR: {
+                                // "let"[ \t\r]*\/\/.*\n
+                                int32_t ws = len;
+                                while ( at(ws)==' ' || at(ws)=='\t' || at(ws)=='\r' ) ws ++;
+                                if ( at(ws)=='/' && at(ws+1)=='/' ) {
+                                    auto nl = findNewLine(p + ws + 2, scan->end);
+                                    if ( nl!=scan->end ) {
+                                        match(int32_t(nl - p) + 1);
+                                        ex->das_need_oxford_comma = false;
+                                        unput('\n');
+                                        acceptCppComment(scan->text);
+                                        return kw->token;
+                                    }
+                                }
+                            }
+                            break;
+                        case DAS_UNSAFE: {
+                                // unsafe[ \t\r]*\(
+                                int32_t ws = len;
+                                while ( at(ws)==' ' || at(ws)=='\t' || at(ws)=='\r' ) ws ++;
+                                if ( at(ws)=='(' && ws<avail() ) {
+                                    match(ws + 1);
+                                    unput('(');
+                                    ex->das_yycolumn--;
+                                    return DAS_UNSAFE;
+                                }
+                            }
+                            break;
+                        case SCANNER_INCLUDE:
+                            match(len);
+                            begin(ScannerState::include);
+                            return -1;
+                        default:
+                            break;
+                        }
+                        match(len);
+                        if ( kw->block ) ex->das_need_oxford_comma = false;
+                        return kw->token;
+                    }
+                    match(len);
+                    yylval->s = new string(p, len);
+                    return NAME;
+                }
+                break;
+            }
+            // <normal>.
+            match(1);
+            return *scan->text;
+        }
+    }
+
+    int Scanner::lexIndent() {
+        auto ex = extra();
+        for ( ;; ) {
+            if ( eof() ) {
+                if ( ex->g_FileAccessStack.size()==1 ) {
+                    if ( ex->das_indent_level ) {
+                        ex->das_indent_level--;
+                        unput('\r');
+                        return '}';
+                    } else {
+                        return 0;
+                    }
+                } else {
+                    popBuffer();
+                    ex->g_FileAccessStack.pop_back();
+                    scan->lineno = ex->das_line_no.back();
+                    ex->das_line_no.pop_back();
+                    continue;
+                }
+            }
+            const char * p = scan->cur;
+            char ch = *p;
+            char next = at(1);
+            switch ( ch ) {
+            case '#':
+                if ( int32_t len = lineDirectiveLength() ) {
+                    match(len);
+                    if ( !lineDirective() ) return LEXER_ERROR;
+                    continue;
+                }
+                break;
+            case '*':
+                if ( next=='/' ) {
+                    match(2);
+                    das_yyfatalerror(scan->lloc,scanner(),"Unexpected */", CompilationError::unexpected_close_comment);
+                    return LEXER_ERROR;
+                }
+                break;
+            case '/':
+                if ( next=='*' ) {
+                    match(2);
+                    begin(ScannerState::c_comment);
+                    ex->das_c_style_depth = 1;
+                    ex->das_in_normal = false;
+                    if ( !ex->g_CommentReaders.empty() ) {
+                        auto tak = tokAt(scanner(),*scan->lloc);
+                        for ( auto & crd : ex->g_CommentReaders ) crd->open(false, tak);
+                    }
+                    return -1;
+                } else if ( next=='/' ) {
+                    auto nl = findNewLine(p + 2, scan->end);
+                    if ( nl!=scan->end ) {
+                        // (\/\/.*)*\n
+                        match(int32_t(nl - p) + 1);
+                        ex->das_current_line_indent = 0;
+                        ex->das_need_oxford_comma = true;
+                        newLine();
+                        acceptCppComment(scan->text);
+                        continue;
+                    }
+                    match(2);
+                    begin(ScannerState::cpp_comment);
+                    if ( !ex->g_CommentReaders.empty() ) {
+                        auto tak = tokAt(scanner(),*scan->lloc);
+                        for ( auto & crd : ex->g_CommentReaders ) crd->open(true, tak);
+                    }
+                    return -1;
+                }
+                break;
+            case '\n':
+            case ' ':
+            case '\t':
+            case '\r': {
+                    // [ \t\r]*\n skips empty line
+                    int32_t ws = whiteSpaceRun(p, scan->end);
+                    if ( ws<avail() && p[ws]=='\n' ) {
+                        match(ws + 1);
+                        ex->das_current_line_indent = 0;
+                        newLine();
+                        continue;
+                    }
+                    if ( ch==' ' ) {
+                        int32_t spaces = 1;
+                        while ( spaces<avail() && p[spaces]==' ' ) spaces ++;
+                        matchRun(spaces, 0);
+                        ex->das_current_line_indent += spaces;
+                        continue;
+                    } else if ( ch=='\t' ) {
+                        match(1);
+                        ex->das_current_line_indent = (ex->das_current_line_indent + ex->das_tab_size) & ~(ex->das_tab_size-1);
+                        continue;
+                    }
+                }
+                break;
+            default:
+                break;
+            }
+            // <indent>.
+            match(1);
+            unput(*scan->text);
+            ex->das_yycolumn--;
+            if (ex->das_current_line_indent > ex->das_indent_level*ex->das_tab_size ) {
+                if ( ex->das_current_line_indent % ex->das_tab_size ) {
+                    das_yyfatalerror(scan->lloc,scanner(),"invalid indentation"); // pretend tab was pressed
+                    ex->das_current_line_indent = (ex->das_current_line_indent + ex->das_tab_size) & ~(ex->das_tab_size-1);
+                }
+                ex->das_indent_level++;
+                return '{';
+            } else if (ex->das_current_line_indent < ex->das_indent_level*ex->das_tab_size ) {
+                ex->das_indent_level--;
+                return '}';
+            } else {
+                begin(ScannerState::normal);
+                return -1;
+            }
+        }
+    }
+
+    int Scanner::lexString() {
+        auto ex = extra();
+        for ( ;; ) {
+            if ( eof() ) {
+                das_yyfatalerror(scan->lloc,scanner(),"string constant exceeds file", CompilationError::string_constant_exceeds_file);
+                begin(ScannerState::normal);
+                return END_STRING;
+            }
+            char ch = *scan->cur;
+            switch ( ch ) {
+            case '"':
+                match(1);
+                begin(ScannerState::normal);
+                return END_STRING;
+            case '{':
+                match(1);
+                DAS_ASSERT(ex->das_nested_sb==0);
+                ex->das_nested_sb ++;
+                begin(ScannerState::normal);
+                return BEGIN_STRING_EXPR;
+            case '\\': {
+                    char next = at(1);
+                    if ( next=='\\' ) {
+                        match(2);
+                        return STRING_CHARACTER_ESC;
+                    } else if ( next=='{' || next=='"' || next=='}' ) {
+                        match(2);
+                        yylval->ch = next;
+                        return STRING_CHARACTER;
+                    }
+                }
+                break;
+            case '\r':
+                match(1);
+                continue;
+            case '\n':
+                match(1);
+                yylval->ch = ch;
+                newLine();
+                return STRING_CHARACTER;
+            default:
+                break;
+            }
+            match(1);
+            yylval->ch = ch;
+            return STRING_CHARACTER;
+        }
+    }
+
+    int Scanner::lexCComment() {
+        auto ex = extra();
+        for ( ;; ) {
+            if ( eof() ) {
+                das_yyfatalerror(scan->lloc,scanner(),"end of file encountered inside c-style comment", CompilationError::comment_contains_eof);
+                begin(ScannerState::normal);
+                return -1;
+            }
+            const char * p = scan->cur;
+            char ch = *p;
+            char next = at(1);
+            if ( ch=='/' && next=='*' ) {
+                match(2);
+                ex->das_c_style_depth ++;
+                continue;
+            } else if ( ch=='*' && next=='/' ) {
+                match(2);
+                ex->das_c_style_depth --;
+                if ( ex->das_c_style_depth==0 ) {
+                    if ( !ex->g_CommentReaders.empty() ) {
+                        auto tak = tokAt(scanner(),*scan->lloc);
+                        for ( auto & crd : ex->g_CommentReaders ) crd->close(tak);
+                    }
+                    begin(ex->das_in_normal ? ScannerState::normal : ScannerState::indent);
+                    return -1;
+                }
+                continue;
+            }
+            if ( ex->g_CommentReaders.empty() ) {
+                // comment body goes in bulk, up to the next '/' or '*'
+                int32_t lines = 0;
+                auto stop = skipCommentBody(p + 1, scan->end, lines);
+                if ( ch=='\n' ) lines ++;
+                matchRun(int32_t(stop - p), lines);
+            } else {
+                match(1);
+                auto tak = tokAt(scanner(),*scan->lloc);
+                for ( auto & crd : ex->g_CommentReaders ) crd->accept(ch, tak);
+            }
+        }
+    }
+
+    int Scanner::lexCppComment() {
+        auto ex = extra();
+        for ( ;; ) {
+            if ( eof() ) {
+                begin(ScannerState::normal);
+                return -1;
+            }
+            char ch = *scan->cur;
+            match(1);
+            if ( ch=='\n' ) {
+                begin(ScannerState::normal);
+                unput('\n');
+                if ( !ex->g_CommentReaders.empty() ) {
+                    auto tak = tokAt(scanner(),*scan->lloc);
+                    for ( auto & crd : ex->g_CommentReaders ) crd->close(tak);
+                }
+                return -1;
+            }
+            if ( !ex->g_CommentReaders.empty() ) {
+                auto tak = tokAt(scanner(),*scan->lloc);
+                for ( auto & crd : ex->g_CommentReaders ) crd->accept(ch, tak);
+            }
+        }
+    }
+
+    int Scanner::lexInclude() {
+        auto ex = extra();
+        for ( ;; ) {
+            if ( eof() ) {
+                return 0;
+            }
+            const char * p = scan->cur;
+            char ch = *p;
+            if ( ch==' ' ) {
+                int32_t spaces = 1;
+                while ( spaces<avail() && p[spaces]==' ' ) spaces ++;
+                match(spaces);
+                continue;
+            } else if ( ch=='\t' ) {
+                match(1);
+                continue;
+            } else if ( ch=='\r' || ch=='\n' ) {
+                match(1, false);    // no rule for it, the default one does not count lines
+                continue;
+            }
+            int32_t len = 1;
+            while ( len<avail() && p[len]!=' ' && p[len]!='\t' && p[len]!='\r' && p[len]!='\n' ) len ++;
+            match(len);
+            auto cfi = ex->g_FileAccessStack.back();
+            string incFileName = ex->g_Access->getIncludeFileName(cfi->name,yytext());
+            auto info = ex->g_Access->getFileInfo(incFileName);
+            if ( !info ) {
+                das_yyfatalerror(scan->lloc,scanner(),"can't open "+incFileName);
+            } else {
+                if ( ex->das_already_include.find(incFileName) == ex->das_already_include.end() ) {
+                    ex->das_already_include.insert(incFileName);
+                    ex->g_FileAccessStack.push_back(info);
+                    ex->das_line_no.push_back(scan->lineno);
+                    scan->lineno = 1;
+                    const char * src = nullptr;
+                    uint32_t slen = 0;
+                    info->getSourceAndLength(src, slen);
+                    scan->buffers.back().cur = scan->cur;
+                    scan->buffers.back().end = scan->end;
+                    scan->buffers.emplace_back();
+                    auto & buf = scan->buffers.back();
+                    buf.cur = scan->cur = src;
+                    buf.end = scan->end = src + slen;
+                }
+            }
+            begin(ScannerState::normal);
+            return -1;
+        }
+    }
+
+    int Scanner::lexReader() {
+        if ( eof() ) {
+            das_yyfatalerror(scan->lloc,scanner(),"reader constant exceeds file", CompilationError::string_constant_exceeds_file);
+            begin(ScannerState::normal);
+            return END_OF_READ;
+        }
+        char ch = *scan->cur;
+        match(1);
+        if ( ch=='\n' ) {
+            newLine();
+        }
+        yylval->ch = ch;
+        return STRING_CHARACTER;
+    }
+
+    // -1 means 'rule did not return a token, keep scanning'
+    int Scanner::lex() {
+        for ( ;; ) {
+            int token;
+            switch ( scan->state ) {
+                case ScannerState::normal:      token = lexNormal(); break;
+                case ScannerState::indent:      token = lexIndent(); break;
+                case ScannerState::strb:        token = lexString(); break;
+                case ScannerState::c_comment:   token = lexCComment(); break;
+                case ScannerState::cpp_comment: token = lexCppComment(); break;
+                case ScannerState::include:     token = lexInclude(); break;
+                case ScannerState::reader:      token = lexReader(); break;
+                default:                        DAS_ASSERTF(0, "unknown scanner state"); return 0;
+            }
+            if ( token!=-1 ) return token;
+        }
+    }
+}
+
+int das_yylex ( DAS_YYSTYPE * yylval_param, DAS_YYLTYPE * yylloc_param, yyscan_t yyscanner ) {
+    auto scan = (DasScanner *) yyscanner;
+    Scanner scanner(scan, yylval_param, yylloc_param);
+    int token = scanner.lex();
+    if ( !scan->buffers.empty() ) {
+        scan->buffers.back().cur = scan->cur;
+        scan->buffers.back().end = scan->end;
+    }
+    return token;
+}
+
+int das_yylex_init_extra ( das::DasParserState * user_defined, yyscan_t * ptr_yy_globals ) {
+    auto scan = new DasScanner();
+    scan->extra = user_defined;
+    *ptr_yy_globals = scan;
+    return 0;
+}
+
+int das_yylex_destroy ( yyscan_t yyscanner ) {
+    delete (DasScanner *) yyscanner;
+    return 0;
+}
+
+void das_yybegin_reader ( yyscan_t yyscanner ) {
+    ((DasScanner *) yyscanner)->state = ScannerState::reader;
+}
+
+void das_yyend_reader ( yyscan_t yyscanner ) {
+    ((DasScanner *) yyscanner)->state = ScannerState::normal;
+}
+
+void das_yybegin ( const char * str, uint32_t len, yyscan_t yyscanner ) {
+    auto scan = (DasScanner *) yyscanner;
+    auto yyextra = scan->extra;
+    yyextra->g_thisStructure = nullptr;
+    yyextra->das_module_alias.clear();
+    yyextra->das_already_include.clear();
+    yyextra->das_tab_size = yyextra->das_def_tab_size;
+    yyextra->das_line_no.clear();
+    yyextra->das_yycolumn = 0;
+    yyextra->das_current_line_indent = 0;
+    yyextra->das_indent_level = 0;
+    yyextra->das_nested_parentheses = 0;
+    yyextra->das_nested_curly_braces = 0;
+    yyextra->das_nested_square_braces = 0;
+    yyextra->das_nested_sb = 0;
+    yyextra->das_need_oxford_comma = true;
+    yyextra->das_force_oxford_comma = false;
+    yyextra->das_c_style_depth = 0;
+    yyextra->das_arrow_depth = 0;
+    yyextra->g_CommentReaders.clear();
+    yyextra->g_ReaderMacro = nullptr;
+    yyextra->g_ReaderExpr = nullptr;
+    scan->state = ScannerState::normal;
+    scan->buffers.clear();
+    scan->buffers.emplace_back();
+    auto & buf = scan->buffers.back();
+    buf.cur = scan->cur = str;
+    buf.end = scan->end = str + len;
+    scan->text = nullptr;
+    scan->leng = 0;
+    scan->lineno = 1;
+}
@@ -3,6 +3,7 @@
 #include "daScript/simulate/simulate.h"
 #include "daScript/simulate/heap.h"
 #include "daScript/misc/debug_break.h"
+#include "daScript/misc/sysos.h"
 
 namespace das {
 
@@ -27,6 +28,221 @@ namespace das {
         return nullptr;
     }
 
+    void StackAllocator::makeGrowable ( uint32_t segment, uint32_t maxSize ) {
+        DAS_ASSERTF(empty(),"can't make stack growable while it's in use");
+        uint32_t page = uint32_t(getVirtualMemoryPageSize());
+        segment = (max(segment, page) + page - 1) & ~(page - 1);
+        maxSize = (max(maxSize, segment) + segment - 1) / segment * segment;
+        auto mem = (char *) reserveVirtualMemory(maxSize);
+        if ( !mem ) return;                             // stays fixed size
+        if ( !commitVirtualMemory(mem + maxSize - segment, segment) ) {
+            releaseVirtualMemory(mem, maxSize);
+            return;
+        }
+        strip();
+        stack = mem;
+        stackSize = maxSize;
+        segmentSize = segment;
+        limit = stack + stackSize - segment;
+        peakCommitted = segment;
+        segmentsAllocated = 1;
+        reset();
+    }
+
+    bool StackAllocator::grow ( uint32_t size ) {
+        if ( !segmentSize ) return false;
+        char * top = stack + stackSize;
+        uint64_t need = uint64_t(top - stackTop) + size;
+        uint64_t total = (need + segmentSize - 1) / segmentSize * segmentSize;
+        if ( total > stackSize ) return false;
+        char * newLimit = top - total;
+        if ( newLimit < limit ) {
+            if ( !commitVirtualMemory(newLimit, size_t(limit - newLimit)) ) return false;
+            segmentsAllocated += uint64_t(limit - newLimit) / segmentSize;
+            limit = newLimit;
+            peakCommitted = max(peakCommitted, total);
+        }
+        return true;
+    }
+
+    void StackAllocator::shrink() {
+        if ( !segmentSize ) return;
+        char * top = stack + stackSize;
+        uint64_t used = uint64_t(top - stackTop);
+        uint64_t keep = (used + segmentSize - 1) / segmentSize * segmentSize + segmentSize;  // one spare segment
+        if ( keep >= uint64_t(top - limit) ) return;
+        char * newLimit = top - keep;
+        decommitVirtualMemory(limit, size_t(newLimit - limit));
+        limit = newLimit;
+    }
+
+    void StackAllocator::releaseReserved() {
+        releaseVirtualMemory(stack, stackSize);
+    }
+
+    FuncInfo * AllocationProfiler::currentFunction() const {
+#if DAS_ENABLE_STACK_WALK
+        char * sp = context->stack.ap();
+        if ( sp < context->stack.top() ) {
+            Prologue * pp = (Prologue *) sp;
+            intptr_t iblock = intptr_t(pp->block);
+            if ( iblock & 1 ) {
+                return ((Block *) (iblock & ~1))->info;
+            }
+            return pp->info;    // null for AOT functions
+        }
+#endif
+        return nullptr;
+    }
+
+    AllocationProfiler::AllocationProfiler ( Context * ctx, uint32_t interval ) : context(ctx) {
+        sampleInterval = das::max(interval, 1u);
+        untilSample = nextSample();
+    }
+
+    // gaps between samples are random, with sampleInterval on average. fixed gaps would line up with the loops
+    uint32_t AllocationProfiler::nextSample() {
+        if ( sampleInterval==1 ) return 1;
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        return uint32_t(1 + seed % (2ull*sampleInterval - 1));
+    }
+
+    uint32_t AllocationProfiler::getSite ( FuncInfo * func, LineInfo * at, bool strings ) {
+        uint64_t key = (uint64_t(intptr_t(func)) * 0x9E3779B97F4A7C15ull) ^ uint64_t(intptr_t(at)) ^ (strings ? 1 : 0);
+        for ( ;; ) {    // linear probing on the (unlikely) key collision
+            auto it = siteIndex.find(key);
+            if ( it == siteIndex.end() ) break;
+            auto & site = sites[it->second];
+            if ( site.func==func && site.at==at && site.strings==strings ) return it->second;
+            key ++;
+        }
+        Site site;
+        site.func = func;
+        site.at = at;
+        site.strings = strings;
+        uint32_t index = uint32_t(sites.size());
+        sites.push_back(site);
+        siteIndex[key] = index;
+        return index;
+    }
+
+    void AllocationProfiler::track ( AnyHeapAllocator * heap, char * ptr, uint32_t size, uint32_t index, uint32_t weight ) {
+        auto & site = sites[index];
+        site.count += weight;
+        site.bytes += uint64_t(size) * weight;
+        site.liveCount += weight;
+        site.liveBytes += uint64_t(size) * weight;
+        live[ptr] = { heap, size, index, weight };
+    }
+
+    void AllocationProfiler::sampled ( AnyHeapAllocator * heap, char * ptr, uint32_t size, bool strings ) {
+        untilSample = nextSample();
+        if ( !ptr || !size ) return;
+        track(heap, ptr, size, getSite(currentFunction(), nullptr, strings), sampleInterval);
+    }
+
+    void AllocationProfiler::reallocated ( AnyHeapAllocator * heap, char * ptr, char * newPtr, uint32_t newSize, bool strings ) {
+        auto it = live.empty() ? live.end() : live.find(ptr);
+        if ( it == live.end() ) {
+            allocated(heap, newPtr, newSize, strings);
+            return;
+        }
+        auto prev = it->second;
+        live.erase(it);
+        auto & site = sites[prev.site];
+        site.liveBytes -= uint64_t(prev.size) * prev.weight;
+        if ( newPtr && newSize ) {
+            site.liveBytes += uint64_t(newSize) * prev.weight;
+            if ( newSize > prev.size ) site.bytes += uint64_t(newSize - prev.size) * prev.weight;
+            live[newPtr] = { heap, newSize, prev.site, prev.weight };
+        } else {
+            site.liveCount -= prev.weight;
+        }
+    }
+
+    void AllocationProfiler::freed ( char * ptr ) {
+        if ( live.empty() ) return;
+        auto it = live.find(ptr);
+        if ( it == live.end() ) return;     // not sampled, or allocated before the profiler was installed
+        auto & la = it->second;
+        auto & site = sites[la.site];
+        site.liveCount -= la.weight;
+        site.liveBytes -= uint64_t(la.size) * la.weight;
+        live.erase(it);
+    }
+
+    void AllocationProfiler::located ( void * ptr, LineInfo * at ) {
+        if ( live.empty() ) return;
+        auto it = live.find(ptr);
+        if ( it == live.end() ) return;
+        auto & la = it->second;
+        auto & prev = sites[la.site];
+        if ( prev.at ) return;              // already has the precise location
+        uint64_t bytes = uint64_t(la.size) * la.weight;
+        prev.count -= la.weight;
+        prev.bytes -= bytes;
+        prev.liveCount -= la.weight;
+        prev.liveBytes -= bytes;
+        la.site = getSite(prev.func, at, prev.strings);
+        auto & site = sites[la.site];
+        site.count += la.weight;
+        site.bytes += bytes;
+        site.liveCount += la.weight;
+        site.liveBytes += bytes;
+    }
+
+    void AllocationProfiler::swept ( AnyHeapAllocator * heap ) {
+        for ( auto it = live.begin(); it != live.end(); ) {
+            auto & la = it->second;
+            // same alignment as the gc uses when validating pointers
+            if ( la.heap==heap && !heap->isValidPtr((char *)it->first, (la.size + 15) & ~15) ) {
+                auto & site = sites[la.site];
+                site.liveCount -= la.weight;
+                site.liveBytes -= uint64_t(la.size) * la.weight;
+                it = live.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    void AllocationProfiler::reset ( AnyHeapAllocator * heap ) {
+        for ( auto it = live.begin(); it != live.end(); ) {
+            auto & la = it->second;
+            if ( la.heap==heap ) {
+                auto & site = sites[la.site];
+                site.liveCount -= la.weight;
+                site.liveBytes -= uint64_t(la.size) * la.weight;
+                it = live.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    void AllocationProfiler::report ( TextWriter & tw, int32_t top ) const {
+        vector<const Site *> order;
+        for ( auto & site : sites ) {
+            if ( site.count ) order.push_back(&site);
+        }
+        sort(order.begin(), order.end(), [](const Site * a, const Site * b) {
+            return a->bytes > b->bytes;
+        });
+        if ( top > 0 && int32_t(order.size()) > top ) order.resize(top);
+        tw << "allocations by site (bytes, count, live bytes, live count)";
+        if ( sampleInterval > 1 ) tw << ", estimated from every " << sampleInterval << "th allocation on average";
+        tw << ":\n";
+        for ( auto site : order ) {
+            tw << "\t" << site->bytes << "\t" << site->count << "\t" << site->liveBytes << "\t" << site->liveCount
+                << "\t" << (site->strings ? "string " : "heap ")
+                << (site->func ? site->func->name : "(aot or no function)");
+            if ( site->at ) tw << " at " << site->at->describe();
+            tw << "\n";
+        }
+    }
+
     char * StringHeapAllocator::allocateString ( const string & str ) {
         return allocateString ( str.c_str(), uint32_t(str.length()) );
     }
@@ -139,6 +355,18 @@ namespace das {
         }
     }
 
+    bool LinearHeapAllocator::snapshot() {
+        if ( !snap ) snap.reset(new LinearChunkSnapshot());
+        model.snapshot(*snap);
+        return true;
+    }
+
+    bool LinearHeapAllocator::restore() {
+        if ( !snap ) return false;
+        if ( profiler ) profiler->reset(this);
+        return model.restore(*snap);
+    }
+
     void StringHeapAllocator::setIntern(bool on) {
         needIntern = on;
         if ( !needIntern ) {
@@ -256,6 +484,7 @@ namespace das {
 
     void PersistentStringAllocator::sweep() {
         model.sweep();
+        if ( profiler ) profiler->swept(this);
         if ( needIntern ) {
             das_string_set empty;
             swap ( internMap, empty );
@@ -304,6 +533,26 @@ namespace das {
         }
     }
 
+    bool LinearStringAllocator::snapshot() {
+        if ( !snap ) snap.reset(new LinearChunkSnapshot());
+        model.snapshot(*snap);
+        snapInternMap = internMap;
+        return true;
+    }
+
+    bool LinearStringAllocator::restore() {
+        if ( !snap ) return false;
+        if ( profiler ) profiler->reset(this);
+        if ( !model.restore(*snap) ) return false;
+        internMap = snapInternMap;
+        return true;
+    }
+
+    void LinearStringAllocator::dropSnapshot() {
+        snap.reset();
+        snapInternMap.clear();
+    }
+
     void LinearStringAllocator::report() {
         LOG tout(LogLevel::debug);
         char buf[33];
@@ -1,27 +1,117 @@
 #include "daScript/misc/platform.h"
 
 #include "daScript/simulate/runtime_range.h"
+#include "daScript/simulate/runtime_profile.h"
+#include "daScript/simulate/aot.h"
 
 extern "C" int64_t ref_time_ticks ();
 extern "C" int get_time_usec (int64_t reft);
 
 namespace das
 {
-    float builtin_profile ( int32_t count, const char * category, const Block & block, Context * context, LineInfoArg * at ) {
-        count = das::max(count, 1);
-        int minT = INT32_MAX;
+    static DAS_THREAD_LOCAL ProfileCollector * g_profileCollector = nullptr;
+
+    ProfileCollector * setProfileCollector ( ProfileCollector * collector ) {
+        auto prev = g_profileCollector;
+        g_profileCollector = collector;
+        return prev;
+    }
+
+    // counters are opened once per thread, and only when someone is going to read them
+    static DAS_THREAD_LOCAL unique_ptr<PerfCounters> g_perfCounters;
+
+    static PerfCounters * threadPerfCounters() {
+        if ( !g_perfCounters ) g_perfCounters = make_unique<PerfCounters>();
+        return g_perfCounters->any() ? g_perfCounters.get() : nullptr;
+    }
+
+    static double run_profile ( int32_t count, const Block & block, Context * context, LineInfoArg * at,
+            PerfCounters * perf, ProfileResult & res ) {
+        vector<int> samples;
+        samples.reserve(count);
+        uint64_t heapBytes = 0, stringBytes = 0;
+        uint64_t totals[int(PerfCounter::total)] = {};
         for ( int32_t i = 0; i != count; ++i ) {
+            uint64_t heapBefore = context->heap->bytesAllocated();
+            uint64_t stringBefore = context->stringHeap->bytesAllocated();
+            if ( perf ) perf->start();
             int64_t reft = ref_time_ticks();
             context->invoke(block, nullptr, nullptr, at);
-            minT = das::min(get_time_usec(reft), minT);
+            samples.push_back(get_time_usec(reft));
+            if ( perf ) perf->stop(totals);
+            uint64_t heapAfter = context->heap->bytesAllocated();
+            uint64_t stringAfter = context->stringHeap->bytesAllocated();
+            // heaps can be collected in the middle of the run, in which case there is nothing to report
+            if ( heapAfter > heapBefore ) heapBytes = das::max(heapBytes, heapAfter - heapBefore);
+            if ( stringAfter > stringBefore ) stringBytes = das::max(stringBytes, stringAfter - stringBefore);
+        }
+        sort(samples.begin(), samples.end());
+        res.count = count;
+        res.minT = samples[0]/1000000.;
+        res.medianT = samples[count/2]/1000000.;
+        res.p99T = samples[das::min(count-1, (count*99)/100)]/1000000.;
+        res.heapBytes = heapBytes;
+        res.stringBytes = stringBytes;
+        if ( perf ) {
+            for ( int i = 0; i != int(PerfCounter::total); ++i ) {
+                res.countersAvailable[i] = perf->available(PerfCounter(i));
+                res.counters[i] = totals[i] / count;
+            }
+        }
+        return res.minT;
+    }
+
+    static void counters_to_values ( const ProfileResult & res, int64_t * values ) {
+        for ( int i = 0; i != int(PerfCounter::total); ++i ) {
+            values[i] = res.countersAvailable[i] ? int64_t(res.counters[i]) : -1;
+        }
+    }
+
+    // "category", min time, count, and then counters when at least one of them is open. unavailable ones are -1
+    static void print_profile ( const char * category, double tSec, int32_t count, const ProfileResult & res, Context * context ) {
+        TextWriter ss;
+        ss << "\"" << category << "\", " << tSec << ", " << count;
+        bool any = false;
+        for ( int i = 0; i != int(PerfCounter::total); ++i ) any |= res.countersAvailable[i];
+        if ( any ) {
+            int64_t values[int(PerfCounter::total)];
+            counters_to_values(res, values);
+            for ( int i = 0; i != int(PerfCounter::total); ++i ) {
+                ss << ", " << values[i];
+            }
+        }
+        ss << "\n";
+        context->to_out(ss.str().c_str());
+    }
+
+    float builtin_profile ( int32_t count, const char * category, const Block & block, Context * context, LineInfoArg * at ) {
+        count = das::max(count, 1);
+        ProfileResult res;
+        res.category = category;
+        double tSec = run_profile(count, block, context, at, threadPerfCounters(), res);
+        if ( g_profileCollector ) {
+            g_profileCollector->onProfile(context, res);
         }
-        double tSec = minT/1000000.;
         if ( category ) {
-            TextWriter ss;
-            ss << "\"" << category << "\", " << tSec << ", " << count << "\n";
-            context->to_out(ss.str().c_str());
+            print_profile(category, tSec, count, res, context);
         }
         return (float) tSec;
     }
-}
 
+    float builtin_profile_counters ( int32_t count, const char * category, TArray<int64_t> & counters,
+            const Block & block, Context * context, LineInfoArg * at ) {
+        count = das::max(count, 1);
+        ProfileResult res;
+        res.category = category;
+        double tSec = run_profile(count, block, context, at, threadPerfCounters(), res);
+        if ( g_profileCollector ) {
+            g_profileCollector->onProfile(context, res);
+        }
+        array_resize(*context, counters, uint32_t(PerfCounter::total), sizeof(int64_t), false);
+        counters_to_values(res, (int64_t *) counters.data);
+        if ( category ) {
+            print_profile(category, tSec, count, res, context);
+        }
+        return (float) tSec;
+    }
+}
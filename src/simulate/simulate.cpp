@@ -6,6 +6,7 @@
 #include "daScript/simulate/debug_print.h"
 #include "daScript/misc/fpe.h"
 #include "daScript/misc/debug_break.h"
+#include "daScript/misc/performance_time.h"
 
 #include <stdarg.h>
 
@@ -1004,9 +1005,14 @@ namespace das
         }
     // stack
         if ( stack.bottom() ) {
-            tw << "\tstack: " << stack.size() << "\n";
-            bytesTotal += stack.size();
-            bytesUsed += stack.size();
+            if ( stack.isGrowable() ) {
+                tw << "\tstack: " << stack.bytesCommitted() << " of " << stack.size()
+                    << ", peak = " << stack.peakBytesCommitted() << ", segments allocated = " << stack.segmentAllocations() << "\n";
+            } else {
+                tw << "\tstack: " << stack.size() << "\n";
+            }
+            bytesTotal += stack.bytesCommitted();
+            bytesUsed += stack.bytesCommitted();
         }
     // functions
         //tw << "\functions table: " << totalFunctions*sizeof(SimFunction) << "\n";
@@ -1082,14 +1088,17 @@ namespace das
     uint64_t Context::getUniqueMemorySize() const {
         uint64_t mem = 0;
         mem += globalsSize;
-        mem += stack.size();
+        mem += stack.bytesCommitted();
         mem += heap ? heap->totalAlignedMemoryAllocated() : 0;
         mem += stringHeap ? stringHeap->totalAlignedMemoryAllocated() : 0;
         return mem;
     }
 
 
-    Context::Context(const Context & ctx, uint32_t category_): stack(ctx.stack.size()) {
+    Context::Context(const Context & ctx, uint32_t category_): stack(ctx.stack.isGrowable() ? ctx.stack.segment() : ctx.stack.size()) {
+        if ( ctx.stack.isGrowable() ) {
+            stack.makeGrowable(ctx.stack.segment(), ctx.stack.size());
+        }
         persistent = ctx.persistent;
         code = ctx.code;
         constStringHeap = ctx.constStringHeap;
@@ -1156,6 +1165,7 @@ namespace das
         });
         // shutdown
         runShutdownScript();
+        setAllocationProfiler(false);
         // and free memory
         if ( globals && globalsOwner ) {
             das_aligned_free16(globals);
@@ -1165,6 +1175,142 @@ namespace das
         }
     }
 
+    // enabling starts over, disabling stops collecting but keeps what was collected so far
+    void Context::setAllocationProfiler ( bool enable, uint32_t sampleInterval ) {
+        if ( enable ) allocationProfiler.reset(new AllocationProfiler(this, sampleInterval));
+        auto profiler = enable ? allocationProfiler.get() : nullptr;
+        if ( heap ) heap->profiler = profiler;
+        if ( stringHeap ) stringHeap->profiler = profiler;
+    }
+
+    // enabling starts over, disabling restores function code but keeps what was collected so far
+    void Context::setFunctionProfiler ( bool enable ) {
+        for ( int fni=0; fni!=totalFunctions; ++fni ) {
+            auto & fn = functions[fni];
+            if ( fn.code && fn.code->rtti_node_isProfileFunction() ) {
+                fn.code = ((SimNode_ProfileFunction *)fn.code)->subexpr;
+            }
+        }
+        if ( !enable ) return;
+        functionProfiler.reset(new FunctionProfiler(this));
+        for ( int fni=0; fni!=totalFunctions; ++fni ) {
+            auto & fn = functions[fni];
+            if ( fn.code && !fn.aot ) {    // only the interpreter is of interest
+                fn.code = code->makeNode<SimNode_ProfileFunction>(fn.code->debugInfo, &fn, fn.code);
+            }
+        }
+    }
+
+    FunctionProfiler::FunctionProfiler ( Context * ctx ) : context(ctx) {
+        entries.resize(ctx->totalFunctions);
+    }
+
+    void FunctionProfiler::enter ( SimFunction * fn ) {
+        frames.push_back({int32_t(fn - context->functions), ref_time_ticks(), 0});
+    }
+
+    void FunctionProfiler::leave ( SimFunction * fn ) {
+        int32_t index = int32_t(fn - context->functions);
+        auto now = ref_time_ticks();
+        // frames abandoned by an exception are dropped on the way out
+        while ( !frames.empty() ) {
+            auto frame = frames.back();
+            frames.pop_back();
+            if ( frame.index!=index ) continue;
+            auto total = now - frame.start;
+            auto & entry = entries[index];
+            entry.calls ++;
+            entry.selfTicks += total - frame.children;
+            // recursive calls are already in the total of the outermost one
+            bool recursive = false;
+            for ( auto & fr : frames ) {
+                if ( fr.index==index ) { recursive = true; break; }
+            }
+            if ( !recursive ) entry.totalTicks += total;
+            if ( !frames.empty() ) frames.back().children += total;
+            break;
+        }
+    }
+
+    void FunctionProfiler::collect ( Profile & profile ) const {
+        for ( int32_t fni=0, fnis=int32_t(entries.size()); fni!=fnis; ++fni ) {
+            auto & entry = entries[fni];
+            if ( !entry.calls ) continue;
+            auto & pe = profile[context->functions[fni].mangledName];
+            pe.calls += entry.calls;
+            pe.selfTicks += entry.selfTicks;
+            pe.totalTicks += entry.totalTicks;
+        }
+    }
+
+    void FunctionProfiler::report ( TextWriter & tw, int32_t top ) const {
+        vector<int32_t> order;
+        int64_t totalSelf = 0;
+        for ( int32_t fni=0, fnis=int32_t(entries.size()); fni!=fnis; ++fni ) {
+            if ( entries[fni].calls ) order.push_back(fni);
+            totalSelf += entries[fni].selfTicks;
+        }
+        sort(order.begin(), order.end(), [&](int32_t a, int32_t b) {
+            return entries[a].selfTicks > entries[b].selfTicks;
+        });
+        if ( top > 0 && int32_t(order.size()) > top ) order.resize(top);
+        tw << "functions by self time (self %, total %, calls):\n";
+        char buf[64];
+        for ( auto fni : order ) {
+            auto & entry = entries[fni];
+            snprintf(buf, sizeof(buf), "\t%6.2f\t%6.2f\t", entry.selfTicks*100.0/max(totalSelf,int64_t(1)),
+                entry.totalTicks*100.0/max(totalSelf,int64_t(1)));
+            tw << buf << entry.calls << "\t" << context->functions[fni].mangledName << "\n";
+        }
+    }
+
+    // one function per line - calls, self ticks, total ticks, mangled name (which has spaces in it)
+    bool FunctionProfiler::save ( const string & fileName ) const {
+        Profile profile;
+        collect(profile);
+        FILE * f = fopen(fileName.c_str(), "w");
+        if ( !f ) return false;
+        fprintf(f, "# daScript function profile\n");
+        for ( auto & it : profile ) {
+            fprintf(f, "%llu %lld %lld %s\n", (unsigned long long) it.second.calls, (long long) it.second.selfTicks,
+                (long long) it.second.totalTicks, it.first.c_str());
+        }
+        fclose(f);
+        return true;
+    }
+
+    // loading adds to what is already in the profile, so that several runs can be combined
+    bool FunctionProfiler::load ( const string & fileName, Profile & profile, TextWriter & logs ) {
+        FILE * f = fopen(fileName.c_str(), "r");
+        if ( !f ) {
+            logs << "can't open function profile " << fileName << "\n";
+            return false;
+        }
+        char line[4096];
+        int lineNo = 0;
+        bool ok = true;
+        while ( fgets(line, sizeof(line), f) ) {
+            lineNo ++;
+            if ( line[0]=='#' || line[0]=='\n' ) continue;
+            unsigned long long calls = 0;
+            long long selfTicks = 0, totalTicks = 0;
+            int nameAt = 0;
+            if ( sscanf(line, "%llu %lld %lld %n", &calls, &selfTicks, &totalTicks, &nameAt)!=3 || !nameAt ) {
+                logs << fileName << "(" << lineNo << "): malformed function profile entry\n";
+                ok = false;
+                break;
+            }
+            string name = line + nameAt;
+            while ( !name.empty() && (name.back()=='\n' || name.back()=='\r') ) name.pop_back();
+            auto & pe = profile[name];
+            pe.calls += calls;
+            pe.selfTicks += selfTicks;
+            pe.totalTicks += totalTicks;
+        }
+        fclose(f);
+        return ok;
+    }
+
     struct SimNodeRelocator : SimVisitor {
         shared_ptr<NodeAllocator>   newCode;
         Context * context = nullptr;
@@ -1175,10 +1321,17 @@ namespace das
         }
     };
 
+    void Context::setChunkRegion ( const ChunkRegionPtr & region ) {
+        code->region = region;
+        constStringHeap->region = region;
+        debugInfo->region = region;
+    }
+
     void Context::relocateCode( bool pwh ) {
         SimNodeRelocator rel;
         rel.context = this;
         rel.newCode = make_shared<NodeAllocator>();
+        rel.newCode->region = code->region;
         rel.newCode->customGrow = [&](int ) { return 4000; };   // because SimNode_Aot is 80 bytes
         uint32_t codeSize = uint32_t(code->bytesAllocated());
         if ( code->prefixWithHeader && !pwh ) {
@@ -1259,6 +1412,39 @@ namespace das
         }
     };
 
+    bool Context::takeSnapshot ( string & errors ) {
+        DAS_ASSERTF(insideContext==0,"can't snapshot locked context");
+        if ( persistent ) {
+            errors = "can't snapshot context with the persistent heap";
+            return false;
+        }
+        if ( !heap->snapshot() || !stringHeap->snapshot() ) {
+            dropSnapshot();
+            errors = "heap does not support snapshots";
+            return false;
+        }
+        globalsSnapshot.assign(globals, globals + globalsSize);
+        snapshotTaken = true;
+        return true;
+    }
+
+    bool Context::restoreSnapshot() {
+        DAS_ASSERTF(insideContext==0,"can't restore locked context");
+        if ( !snapshotTaken ) return false;
+        restart();
+        if ( !heap->restore() || !stringHeap->restore() ) return false;
+        if ( globalsSize ) memcpy(globals, globalsSnapshot.data(), globalsSize);
+        return true;
+    }
+
+    void Context::dropSnapshot() {
+        heap->dropSnapshot();
+        stringHeap->dropSnapshot();
+        vector<char> empty;
+        swap(globalsSnapshot, empty);
+        snapshotTaken = false;
+    }
+
     void Context::runInitScript ( ) {
         DAS_ASSERTF(insideContext==0,"can't run init script on the locked context");
         char * EP, *SP;
@@ -41,6 +41,7 @@ namespace das {
             vis.op(name.c_str());
         }
         subexpr.visit(vis);
+        V_FIELD(op);
         V_END();
     }
 
@@ -56,6 +57,7 @@ namespace das {
         }
         l.visit(vis);
         r.visit(vis);
+        V_FIELD(op);
         V_END();
     }
 
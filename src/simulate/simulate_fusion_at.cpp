@@ -30,6 +30,7 @@ namespace das {
             V_ARG(stride);
             V_ARG(offset);
             V_ARG(range);
+            V_FIELD(op);
             V_END();
         }
         uint32_t  stride, offset, range;
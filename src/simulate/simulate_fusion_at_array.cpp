@@ -30,6 +30,7 @@ namespace das {
             r.visit(vis);
             V_ARG(stride);
             V_ARG(offset);
+            V_FIELD(op);
             V_END();
         }
         uint32_t  stride, offset;
@@ -34,6 +34,8 @@ namespace das {
                 V_SUB(cmresEval);
             }
             subexpr.visit(vis);
+            V_FIELD(op);
+            V_FIELD(fnPtr);
             V_END();
         }
         virtual SimNode * copyNode ( Context & context, NodeAllocator * code ) override {
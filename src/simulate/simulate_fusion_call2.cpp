@@ -31,6 +31,8 @@ namespace das {
             }
             l.visit(vis);
             r.visit(vis);
+            V_FIELD(op);
+            V_FIELD(fnPtr);
             V_END();
         }
         virtual SimNode * copyNode ( Context & context, NodeAllocator * code ) override {
@@ -30,6 +30,7 @@ namespace das {
             if ( if_false ) {
                 V_SUB(if_false);
             }
+            V_FIELD(op);
             V_END();
         }
         SimNode * if_true, * if_false;
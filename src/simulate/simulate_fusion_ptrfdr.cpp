@@ -27,6 +27,7 @@ namespace das {
             }
             subexpr.visit(vis);
             V_ARG(offset);
+            V_FIELD(op);
             V_END();
         }
         uint32_t  offset;
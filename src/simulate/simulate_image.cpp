@@ -0,0 +1,803 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/ast/ast.h"
+
+#if defined(__linux__)
+#include <link.h>
+#include <elf.h>
+#endif
+
+namespace das {
+
+    /*
+        Simulated context image is a copy of the used part of every chunk of the code, constant string and debug info allocators,
+        followed by the relocation table. Relocations are the pointer fields, which node visitors report (SimVisitor::field),
+        the fields of the function and variable tables, and the fields of the debug info, which is walked by its layout.
+        Target of the relocation is one of
+            the chunk of the image
+            the FileInfo of the program (file table of the image has names only)
+            the handled type annotation (resolved by name, when loaded)
+            the loaded executable or shared library (vtables, interop and AOT functions)
+        Field, which points anywhere else (i.e. heap object of the program or module) makes the context unsuitable for the image.
+        So does the pointer, which is not reported by the visitor of its node. The rest of the words are checked for those,
+        so that a node with the incomplete visitor fails to save, instead of loading with the dangling pointer.
+        Loading allocates the same chunks, and patches every relocated word with the new address of its target.
+        Chunk data is 16 byte aligned within the image, so that the mapped image file is used in place (see loadImageFile).
+        Then the chunks are external to the mapping, and only the words, which change, are written to.
+    */
+
+    static constexpr uint64_t image_magic = 0x474d49534144ull;     // DASIMG
+    static constexpr uint32_t image_version = 2;
+    static constexpr uint32_t image_null_chunk = 0xffffffffu;
+
+    enum class ImageAllocator : uint32_t {
+        code,
+        constStrings,
+        debugInfo,
+        total
+    };
+
+    enum class ImageTarget : uint32_t {
+        chunk,
+        file,
+        object,
+        annotation,
+    };
+
+    struct ImageHeader {
+        uint64_t    magic;
+        uint32_t    version;
+        uint32_t    pointerSize;
+        uint32_t    persistent;
+        uint32_t    internStrings;
+        uint32_t    debugger;
+        int32_t     heapInitialSize;
+        int32_t     stringHeapInitialSize;
+        uint32_t    globalsSize;
+        uint32_t    sharedSize;
+        uint32_t    globalInitStackSize;
+        int32_t     totalVariables;
+        int32_t     totalFunctions;
+        uint32_t    totalNodes;
+        uint32_t    prefixWithHeader;
+        uint32_t    functionsChunk;
+        uint32_t    functionsOffset;
+        uint32_t    variablesChunk;
+        uint32_t    variablesOffset;
+    };
+
+    struct ImageRelocation {
+        uint32_t    chunk;      // where
+        uint32_t    offset;
+        uint32_t    target;     // ImageTarget
+        uint32_t    index;      // chunk, file, object, or annotation index
+        uint64_t    delta;      // offset from the start of the target
+    };
+
+    struct ImageObject {
+        string      name;
+        uintptr_t   base = 0;
+        uint64_t    fingerprint = 0;
+        vector<pair<uintptr_t,uintptr_t>> segments;
+    };
+
+    struct ImageRange {
+        uintptr_t   from;
+        uintptr_t   to;         // inclusive
+        uint32_t    index;
+        bool operator < ( const ImageRange & r ) const { return from < r.from; }
+    };
+
+    static const ImageRange * findImageRange ( const vector<ImageRange> & ranges, uintptr_t ptr ) {
+        ImageRange key = { ptr, ptr, 0 };
+        auto it = upper_bound(ranges.begin(), ranges.end(), key);
+        if ( it==ranges.begin() ) return nullptr;
+        --it;
+        return ptr<=it->to ? &*it : nullptr;
+    }
+
+    // collects the addresses of the pointer fields of the code and debug info
+    struct ImageFieldCollector : SimVisitor {
+        using SimVisitor::field;
+        das_hash_map<uintptr_t,const char *>   fields;
+        das_hash_set<uintptr_t>                 nodes;
+        das_hash_set<uintptr_t>                 infos;
+        das_safe_map<uintptr_t,string>          nodeNames;  // node, and its op. for the errors
+        uintptr_t                               thisNode = 0;
+        virtual void preVisit ( SimNode * node ) override {
+            thisNode = uintptr_t(node);
+            nodeNames[thisNode] = "node";
+            field((void *)node, "vtable");
+            field(&node->debugInfo.fileInfo, "debugInfo");
+        }
+        virtual void op ( const char * name, uint32_t, const string & TT ) override {
+            nodeNames[thisNode] = TT.empty() ? string(name) : (string(name) + "_" + TT);
+        }
+        virtual SimNode * sub ( SimNode * node, const char * ) override {
+            if ( node && nodes.insert(uintptr_t(node)).second ) {
+                node->visit(*this);
+            }
+            return node;
+        }
+        virtual void sub ( SimNode ** list, uint32_t count, const char * name ) override {
+            for ( uint32_t t=0; t!=count; ++t ) {
+                sub(list[t], name);
+                field(list + t, name);
+            }
+        }
+        virtual void field ( void * at, const char * name ) override {
+            fields.insert(make_pair(uintptr_t(at), name));
+        }
+        virtual void field ( TypeInfo ** at, const char * name ) override {
+            field((void *)at, name);
+            type(*at);
+        }
+        virtual void field ( FuncInfo ** at, const char * name ) override {
+            field((void *)at, name);
+            func(*at);
+        }
+        template <typename TT>
+        void array ( TT ** & list, uint32_t count, const char * name ) {
+            field(&list, name);
+            for ( uint32_t i=0; list && i!=count; ++i ) field(list + i, name);
+        }
+        void typeFields ( TypeInfo * info ) {
+            field(&info->structType, "structType");
+            if ( info->type==Type::tStructure ) {
+                structure(info->structType);
+            } else if ( info->type==Type::tEnumeration || info->type==Type::tEnumeration8 || info->type==Type::tEnumeration16 ) {
+                enumeration(info->enumType);
+            }
+            field(&info->firstType, "firstType");
+            field(&info->secondType, "secondType");
+            array(info->argTypes, info->argCount, "argTypes");
+            array(info->argNames, info->argCount, "argNames");
+            field(&info->dim, "dim");
+        }
+        void type ( TypeInfo * info ) {
+            if ( info && infos.insert(uintptr_t(info)).second ) typeFields(info);
+        }
+        void variable ( VarInfo * info ) {
+            if ( !info || !infos.insert(uintptr_t(info)).second ) return;
+            typeFields(info);
+            if ( info->type==Type::tString && (info->flags & TypeInfo::flag_hasInitValue) ) field(&info->sValue, "sValue");
+            field(&info->name, "name");
+            field(&info->annotation_arguments, "annotation_arguments");
+        }
+        void structure ( StructInfo * info ) {
+            if ( !info || !infos.insert(uintptr_t(info)).second ) return;
+            field(&info->name, "name");
+            field(&info->module_name, "module_name");
+            array(info->fields, info->count, "fields");
+            for ( uint32_t i=0; info->fields && i!=info->count; ++i ) variable(info->fields[i]);
+            field(&info->annotation_list, "annotation_list");
+        }
+        void enumeration ( EnumInfo * info ) {
+            if ( !info || !infos.insert(uintptr_t(info)).second ) return;
+            field(&info->name, "name");
+            field(&info->module_name, "module_name");
+            array(info->fields, info->count, "fields");
+            for ( uint32_t i=0; info->fields && i!=info->count; ++i ) {
+                if ( info->fields[i] ) field(&info->fields[i]->name, "name");
+            }
+        }
+        void func ( FuncInfo * info ) {
+            if ( !info || !infos.insert(uintptr_t(info)).second ) return;
+            field(&info->name, "name");
+            field(&info->cppName, "cppName");
+            array(info->fields, info->count, "fields");
+            for ( uint32_t i=0; info->fields && i!=info->count; ++i ) variable(info->fields[i]);
+            field(&info->result, "result");
+            array(info->locals, info->localCount, "locals");
+            for ( uint32_t i=0; info->locals && i!=info->localCount; ++i ) {
+                auto local = info->locals[i];
+                if ( !local || !infos.insert(uintptr_t(local)).second ) continue;
+                typeFields(local);
+                field(&local->visibility.fileInfo, "visibility");
+                field(&local->name, "name");
+            }
+        }
+        void code ( SimNode * & node, const char * name ) {
+            sub(node, name);
+            field(&node, name);
+        }
+        // node, which the code address belongs to. nodes do not overlap, so it is the closest one from below
+        string describe ( uintptr_t at ) const {
+            auto it = nodeNames.upper_bound(at);
+            if ( it==nodeNames.begin() ) return "code";
+            --it;
+            return it->second + " at offset " + to_string(uint64_t(at - it->first));
+        }
+    };
+
+    struct ImageWriter {
+        vector<char> & data;
+        void write ( const void * ptr, size_t size ) {
+            auto at = data.size();
+            data.resize(at + size);
+            if ( size ) memcpy(data.data() + at, ptr, size);
+        }
+        template <typename TT>
+        void write ( const TT & value ) {
+            write(&value, sizeof(TT));
+        }
+        void writeString ( const string & str ) {
+            write(uint32_t(str.size()));
+            write(str.data(), str.size());
+        }
+        void align ( size_t alignment ) {
+            data.resize((data.size() + alignment - 1) & ~(alignment - 1), 0);
+        }
+    };
+
+    struct ImageReader {
+        const char *    data;
+        size_t          size;
+        size_t          at = 0;
+        bool            failed = false;
+        const char * skip ( size_t bytes ) {
+            if ( failed || size-at<bytes ) {
+                failed = true;
+                return nullptr;
+            }
+            auto res = data + at;
+            at += bytes;
+            return res;
+        }
+        template <typename TT>
+        TT read() {
+            TT value;
+            memset(&value, 0, sizeof(TT));
+            if ( auto src = skip(sizeof(TT)) ) memcpy(&value, src, sizeof(TT));
+            return value;
+        }
+        string readString() {
+            auto len = read<uint32_t>();
+            auto src = skip(len);
+            return src ? string(src, len) : string();
+        }
+        void align ( size_t alignment ) {
+            skip(((at + alignment - 1) & ~(alignment - 1)) - at);
+        }
+    };
+
+#if defined(__linux__)
+    static int collectImageObject ( struct dl_phdr_info * info, size_t, void * data ) {
+        auto & objects = *(vector<ImageObject> *) data;
+        ImageObject obj;
+        obj.name = info->dlpi_name ? info->dlpi_name : "";
+        obj.base = uintptr_t(info->dlpi_addr);
+        uint64_t fp = 14695981039346656037ul;
+        auto mix = [&]( uint64_t value ) { fp = (fp ^ value) * 1099511628211ul; };
+        for ( int i=0; i!=int(info->dlpi_phnum); ++i ) {
+            const auto & ph = info->dlpi_phdr[i];
+            if ( ph.p_type==PT_LOAD ) {
+                obj.segments.emplace_back(obj.base + ph.p_vaddr, obj.base + ph.p_vaddr + ph.p_memsz);
+                mix(ph.p_vaddr);
+                mix(ph.p_memsz);
+                mix(ph.p_flags);
+            } else if ( ph.p_type==PT_NOTE ) {
+                // build id differs between builds, even if the layout of the segments does not
+                uintptr_t align = ph.p_align==8 ? 7 : 3;
+                auto note = (const char *)(obj.base + ph.p_vaddr);
+                auto end = note + ph.p_memsz;
+                while ( note + sizeof(ElfW(Nhdr)) <= end ) {
+                    auto nh = (const ElfW(Nhdr) *) note;
+                    auto desc = note + sizeof(ElfW(Nhdr)) + ((nh->n_namesz + align) & ~align);
+                    if ( desc + nh->n_descsz > end ) break;
+                    if ( nh->n_type==NT_GNU_BUILD_ID ) {
+                        for ( uint32_t j=0; j!=nh->n_descsz; ++j ) mix(uint8_t(desc[j]));
+                    }
+                    note = desc + ((nh->n_descsz + align) & ~align);
+                }
+            }
+        }
+        obj.fingerprint = fp;
+        objects.emplace_back(das::move(obj));
+        return 0;
+    }
+
+    static bool collectImageObjects ( vector<ImageObject> & objects, string & errors ) {
+        dl_iterate_phdr(&collectImageObject, &objects);
+        if ( objects.empty() ) {
+            errors = "can't enumerate loaded executable and shared libraries";
+            return false;
+        }
+        return true;
+    }
+
+    static bool collectMappedRanges ( vector<ImageRange> & ranges, string & errors ) {
+        FILE * f = fopen("/proc/self/maps", "r");
+        if ( !f ) {
+            errors = "can't read /proc/self/maps";
+            return false;
+        }
+        char line[4096];
+        bool lineStart = true;
+        while ( fgets(line, sizeof(line), f) ) {
+            unsigned long long from = 0, to = 0;
+            if ( lineStart && sscanf(line, "%llx-%llx", &from, &to)==2 && to>from ) {
+                ranges.push_back({uintptr_t(from), uintptr_t(to-1), 0});
+            }
+            lineStart = strchr(line, '\n')!=nullptr;
+        }
+        fclose(f);
+        sort(ranges.begin(), ranges.end());
+        return true;
+    }
+#else
+    static bool collectImageObjects ( vector<ImageObject> &, string & errors ) {
+        errors = "simulated context image is not supported on this platform";
+        return false;
+    }
+
+    static bool collectMappedRanges ( vector<ImageRange> &, string & errors ) {
+        errors = "simulated context image is not supported on this platform";
+        return false;
+    }
+#endif
+
+    bool Context::saveImage ( vector<char> & image, string & errors ) const {
+        if ( !code || !constStringHeap || !debugInfo || !heap || !stringHeap ) {
+            errors = "context is not simulated";
+            return false;
+        }
+        // chunks, tail first. that way allocator chain is restored by pushing them in order
+        shared_ptr<LinearChunkAllocator> allocators[uint32_t(ImageAllocator::total)] = { code, constStringHeap, debugInfo };
+        vector<pair<uint32_t,HeapChunk *>> chunks;
+        vector<ImageRange> chunkRanges;
+        for ( uint32_t a=0; a!=uint32_t(ImageAllocator::total); ++a ) {
+            vector<HeapChunk *> list;
+            for ( auto ch=allocators[a]->chunk; ch; ch=ch->next ) list.push_back(ch);
+            for ( auto it=list.rbegin(); it!=list.rend(); ++it ) {
+                auto ch = *it;
+                chunkRanges.push_back({uintptr_t(ch->data), uintptr_t(ch->data + ch->offset), uint32_t(chunks.size())});
+                chunks.emplace_back(a, ch);
+            }
+        }
+        sort(chunkRanges.begin(), chunkRanges.end());
+        // files
+        auto files = getAllFiles();
+        das_hash_map<FileInfo *,uint32_t> fileIndex;
+        for ( auto fi : files ) fileIndex[fi] = uint32_t(fileIndex.size());
+        for ( int i=0; i!=totalFunctions; ++i ) {
+            auto info = functions[i].debugInfo;
+            for ( uint32_t j=0; info && j!=info->localCount; ++j ) {
+                auto fi = info->locals[j]->visibility.fileInfo;
+                if ( fi && fileIndex.find(fi)==fileIndex.end() ) {
+                    fileIndex[fi] = uint32_t(files.size());
+                    files.push_back(fi);
+                }
+            }
+        }
+        // handled types, i.e. type info annotations which were resolved after the simulation
+        das_hash_map<uintptr_t,uint32_t> annotationIndex;
+        vector<string> annotations;
+        Module::foreach([&]( Module * pm ) -> bool {
+            pm->handleTypes.foreach([&]( const AnnotationPtr & ann ){
+                annotationIndex[uintptr_t(ann.get())] = uint32_t(annotations.size());
+                annotations.push_back(pm->name + "::" + ann->name);
+            });
+            return true;
+        });
+        // executable and shared libraries
+        vector<ImageObject> objects;
+        vector<ImageRange> mapped;
+        if ( !collectImageObjects(objects, errors) || !collectMappedRanges(mapped, errors) ) {
+            return false;
+        }
+        vector<ImageRange> objectRanges;
+        for ( uint32_t i=0; i!=uint32_t(objects.size()); ++i ) {
+            for ( auto & seg : objects[i].segments ) {
+                objectRanges.push_back({seg.first, seg.second-1, i});
+            }
+        }
+        sort(objectRanges.begin(), objectRanges.end());
+        // target of the pointer, which is stored in the code or debug info
+        vector<ImageRelocation> relocations;
+        auto locate = [&]( uintptr_t ptr, ImageRelocation & rel ) -> bool {
+            if ( auto cr = findImageRange(chunkRanges, ptr) ) {
+                rel.target = uint32_t(ImageTarget::chunk);
+                rel.index = cr->index;
+                rel.delta = ptr - cr->from;
+                return true;
+            }
+            auto fit = fileIndex.find((FileInfo *)ptr);
+            if ( fit!=fileIndex.end() ) {
+                rel.target = uint32_t(ImageTarget::file);
+                rel.index = fit->second;
+                rel.delta = 0;
+                return true;
+            }
+            auto ait = annotationIndex.find(ptr);
+            if ( ait!=annotationIndex.end() ) {
+                rel.target = uint32_t(ImageTarget::annotation);
+                rel.index = ait->second;
+                rel.delta = 0;
+                return true;
+            }
+            if ( auto orng = findImageRange(objectRanges, ptr) ) {
+                rel.target = uint32_t(ImageTarget::object);
+                rel.index = orng->index;
+                rel.delta = ptr - objects[orng->index].base;
+                return true;
+            }
+            return false;
+        };
+        // pointer fields of the tables, the code, and the debug info
+        ImageFieldCollector collector;
+        for ( int i=0; i!=totalFunctions; ++i ) {
+            auto & fn = functions[i];
+            collector.field(&fn.name, "name");
+            collector.field(&fn.mangledName, "mangledName");
+            collector.code(fn.code, "code");
+            collector.field(&fn.debugInfo, "debugInfo");
+            collector.field(&fn.aotFunction, "aotFunction");
+        }
+        for ( int i=0; i!=totalVariables; ++i ) {
+            auto & var = globalVariables[i];
+            collector.field(&var.name, "name");
+            collector.variable(var.debugInfo);
+            collector.field(&var.debugInfo, "debugInfo");
+            if ( var.init ) collector.code(var.init, "init");
+        }
+        for ( auto & kv : debugInfo->lookup ) {
+            collector.type(kv.second);
+        }
+        vector<bool> usedObjects(objects.size(), false);
+        vector<bool> usedAnnotations(annotations.size(), false);
+        vector<uintptr_t> fieldAddresses;
+        for ( auto & fv : collector.fields ) fieldAddresses.push_back(fv.first);
+        sort(fieldAddresses.begin(), fieldAddresses.end());
+        for ( auto at : fieldAddresses ) {
+            auto cr = findImageRange(chunkRanges, at);
+            if ( !cr || at+sizeof(void *)>cr->to ) continue;    // i.e. reported field of a local variable
+            uintptr_t ptr;
+            memcpy(&ptr, (void *) at, sizeof(void *));
+            if ( !ptr ) continue;
+            ImageRelocation rel;
+            rel.chunk = cr->index;
+            rel.offset = uint32_t(at - cr->from);
+            if ( !locate(ptr, rel) ) {
+                auto alloc = ImageAllocator(chunks[cr->index].first);
+                errors = string(collector.fields[at]) + " of "
+                    + (alloc==ImageAllocator::code ? collector.describe(at) : string("debug info"))
+                    + " points to the memory, which is not part of the image (" + to_string(uint64_t(ptr)) + ")";
+                return false;
+            }
+            if ( rel.target==uint32_t(ImageTarget::object) ) usedObjects[rel.index] = true;
+            if ( rel.target==uint32_t(ImageTarget::annotation) ) usedAnnotations[rel.index] = true;
+            relocations.push_back(rel);
+        }
+        // the rest of the code and debug info is data. pointer there means that its node does not report the field
+        for ( uint32_t ci=0; ci!=uint32_t(chunks.size()); ++ci ) {
+            auto alloc = ImageAllocator(chunks[ci].first);
+            if ( alloc==ImageAllocator::constStrings ) continue;    // characters only
+            auto ch = chunks[ci].second;
+            for ( uint32_t ofs=0; ofs+sizeof(void *)<=ch->offset; ofs+=uint32_t(sizeof(void *)) ) {
+                auto at = uintptr_t(ch->data + ofs);
+                if ( collector.fields.find(at)!=collector.fields.end() ) continue;
+                uintptr_t ptr;
+                memcpy(&ptr, (void *) at, sizeof(void *));
+                ImageRelocation rel;
+                if ( ptr && (locate(ptr, rel) || findImageRange(mapped, ptr)) ) {
+                    errors = (alloc==ImageAllocator::code ? collector.describe(at) : string("debug info at offset ") + to_string(ofs))
+                        + " has a pointer, which its visitor does not report (" + to_string(uint64_t(ptr)) + ")";
+                    return false;
+                }
+            }
+        }
+        // header
+        ImageHeader header;
+        memset(&header, 0, sizeof(header));
+        header.magic = image_magic;
+        header.version = image_version;
+        header.pointerSize = uint32_t(sizeof(void *));
+        header.persistent = persistent;
+        header.internStrings = stringHeap->isIntern();
+        header.debugger = debugger;
+        header.heapInitialSize = heap->getInitialSize();
+        header.stringHeapInitialSize = stringHeap->getInitialSize();
+        header.globalsSize = globalsSize;
+        header.sharedSize = sharedSize;
+        header.globalInitStackSize = globalInitStackSize;
+        header.totalVariables = totalVariables;
+        header.totalFunctions = totalFunctions;
+        header.totalNodes = code->totalNodesAllocated;
+        header.prefixWithHeader = code->prefixWithHeader;
+        header.functionsChunk = header.variablesChunk = image_null_chunk;
+        ImageRelocation rel;
+        if ( functions && totalFunctions ) {
+            if ( !locate(uintptr_t(functions), rel) || rel.target!=uint32_t(ImageTarget::chunk) ) {
+                errors = "functions are not part of the code";
+                return false;
+            }
+            header.functionsChunk = rel.index;
+            header.functionsOffset = uint32_t(rel.delta);
+        }
+        if ( globalVariables && totalVariables ) {
+            if ( !locate(uintptr_t(globalVariables), rel) || rel.target!=uint32_t(ImageTarget::chunk) ) {
+                errors = "global variables are not part of the code";
+                return false;
+            }
+            header.variablesChunk = rel.index;
+            header.variablesOffset = uint32_t(rel.delta);
+        }
+        image.clear();
+        ImageWriter writer { image };
+        writer.write(header);
+        // lookup tables
+        writer.write(uint32_t(tabMnLookup.size()));
+        for ( auto & kv : tabMnLookup ) {
+            writer.write(kv.first);
+            writer.write(uint32_t(kv.second - functions));
+        }
+        writer.write(uint32_t(tabGMnLookup.size()));
+        for ( auto & kv : tabGMnLookup ) {
+            writer.write(kv.first);
+            writer.write(kv.second);
+        }
+        writer.write(uint32_t(tabAdLookup.size()));
+        for ( auto & kv : tabAdLookup ) {
+            writer.write(kv.first);
+            writer.write(kv.second);
+        }
+        writer.write(uint32_t(debugInfo->lookup.size()));
+        for ( auto & kv : debugInfo->lookup ) {
+            if ( !locate(uintptr_t(kv.second), rel) || rel.target!=uint32_t(ImageTarget::chunk) ) {
+                errors = "type info is not part of the debug info";
+                return false;
+            }
+            writer.write(kv.first);
+            writer.write(rel.index);
+            writer.write(uint32_t(rel.delta));
+        }
+        // files and objects
+        writer.write(uint32_t(files.size()));
+        for ( auto fi : files ) writer.writeString(fi->name);
+        writer.write(uint32_t(annotations.size()));
+        for ( uint32_t i=0; i!=uint32_t(annotations.size()); ++i ) {
+            writer.writeString(usedAnnotations[i] ? annotations[i] : string());
+        }
+        writer.write(uint32_t(objects.size()));
+        for ( uint32_t i=0; i!=uint32_t(objects.size()); ++i ) {
+            writer.write(uint32_t(usedObjects[i]));
+            writer.writeString(objects[i].name);
+            writer.write(objects[i].fingerprint);
+        }
+        // chunks and relocations
+        writer.write(uint32_t(chunks.size()));
+        for ( auto & ch : chunks ) {
+            writer.write(ch.first);
+            writer.write(ch.second->offset);
+            writer.align(16);
+            writer.write(ch.second->data, ch.second->offset);
+        }
+        writer.write(uint32_t(relocations.size()));
+        writer.write(relocations.data(), relocations.size()*sizeof(ImageRelocation));
+        return true;
+    }
+
+    bool Context::loadImage ( const char * image, size_t imageSize, string & errors ) {
+        return loadImageData(image, imageSize, nullptr, errors);
+    }
+
+    bool Context::loadImageFile ( const string & fileName, string & errors ) {
+        auto mapping = make_shared<ChunkRegion>(fileName);
+        if ( !mapping->isMapped() ) {
+            errors = "can't map " + fileName;
+            return false;
+        }
+        if ( (uintptr_t(mapping->base()) & 15)!=0 ) {
+            errors = "mapped image is not aligned";
+            return false;
+        }
+        return loadImageData(mapping->base(), size_t(mapping->bytesReserved()), mapping, errors);
+    }
+
+    // with the mapping, image is writable (copy on write), and its chunk data is used in place
+    bool Context::loadImageData ( const char * image, size_t imageSize, const ChunkRegionPtr & mapping, string & errors ) {
+        ImageReader reader { image, imageSize };
+        auto header = reader.read<ImageHeader>();
+        if ( reader.failed || header.magic!=image_magic || header.version!=image_version || header.pointerSize!=sizeof(void *) ) {
+            errors = "not a simulated context image, or image of the different version";
+            return false;
+        }
+        // lookup tables
+        vector<pair<uint64_t,uint32_t>> mnLookup(reader.read<uint32_t>());
+        for ( auto & kv : mnLookup ) {
+            kv.first = reader.read<uint64_t>();
+            kv.second = reader.read<uint32_t>();
+            if ( kv.second>=uint32_t(header.totalFunctions) ) reader.failed = true;
+        }
+        das_hash_map<uint64_t,uint32_t> gmnLookup;
+        for ( uint32_t i=0, n=reader.read<uint32_t>(); i!=n && !reader.failed; ++i ) {
+            auto mnh = reader.read<uint64_t>();
+            gmnLookup[mnh] = reader.read<uint32_t>();
+        }
+        das_hash_map<uint64_t,uint64_t> adLookup;
+        for ( uint32_t i=0, n=reader.read<uint32_t>(); i!=n && !reader.failed; ++i ) {
+            auto sid = reader.read<uint64_t>();
+            adLookup[sid] = reader.read<uint64_t>();
+        }
+        struct TypeInfoRef { uint64_t hash; uint32_t chunk, offset; };
+        vector<TypeInfoRef> typeLookup(reader.read<uint32_t>());
+        for ( auto & ti : typeLookup ) {
+            ti.hash = reader.read<uint64_t>();
+            ti.chunk = reader.read<uint32_t>();
+            ti.offset = reader.read<uint32_t>();
+        }
+        // files
+        vector<FileInfoPtr> files(reader.read<uint32_t>());
+        for ( auto & fi : files ) {
+            fi = make_unique<FileInfo>();
+            fi->name = reader.readString();
+        }
+        // annotations
+        vector<uintptr_t> annotations(reader.read<uint32_t>(), 0);
+        for ( auto & ann : annotations ) {
+            auto name = reader.readString();
+            if ( reader.failed || name.empty() ) continue;
+            string moduleName, annName;
+            splitTypeName(name, moduleName, annName);
+            auto pm = Module::require(moduleName);
+            auto pa = pm ? pm->findAnnotation(annName) : nullptr;
+            if ( !pa ) {
+                errors = "image requires annotation " + name + ", which is not available";
+                return false;
+            }
+            ann = uintptr_t(pa.get());
+        }
+        // objects. those must be exactly the same, and loaded
+        vector<ImageObject> objects;
+        if ( !collectImageObjects(objects, errors) ) return false;
+        vector<uintptr_t> objectBase(reader.read<uint32_t>(), 0);
+        for ( auto & base : objectBase ) {
+            auto used = reader.read<uint32_t>();
+            auto name = reader.readString();
+            auto fingerprint = reader.read<uint64_t>();
+            if ( reader.failed || !used ) continue;
+            auto it = find_if(objects.begin(), objects.end(), [&]( const ImageObject & obj ) { return obj.name==name; });
+            if ( it==objects.end() ) {
+                errors = "image requires " + (name.empty() ? string("executable") : name) + ", which is not loaded";
+                return false;
+            }
+            if ( it->fingerprint!=fingerprint ) {
+                errors = "image was made by the different build of the " + (name.empty() ? string("executable") : name);
+                return false;
+            }
+            base = it->base;
+        }
+        // chunks
+        shared_ptr<NodeAllocator> newCode = make_shared<NodeAllocator>();
+        shared_ptr<ConstStringAllocator> newStrings = make_shared<ConstStringAllocator>();
+        shared_ptr<DebugInfoAllocator> newDebugInfo = make_shared<DebugInfoAllocator>();
+        // mapping is fully allocated, so the chunks, which are added later, come from the heap
+        newCode->region = mapping ? mapping : code->region;
+        newStrings->region = mapping ? mapping : constStringHeap->region;
+        newDebugInfo->region = mapping ? mapping : debugInfo->region;
+        LinearChunkAllocator * allocators[uint32_t(ImageAllocator::total)] = { newCode.get(), newStrings.get(), newDebugInfo.get() };
+        vector<HeapChunk *> chunks(reader.read<uint32_t>(), nullptr);
+        for ( auto & ch : chunks ) {
+            auto alloc = reader.read<uint32_t>();
+            auto used = reader.read<uint32_t>();
+            reader.align(16);
+            auto src = reader.skip(used);
+            if ( reader.failed || alloc>=uint32_t(ImageAllocator::total) ) {
+                reader.failed = true;
+                break;
+            }
+            auto allocator = allocators[alloc];
+            if ( mapping && used ) {
+                ch = allocator->chunk = new HeapChunk(const_cast<char *>(src), used, allocator->chunk);
+            } else {
+                ch = allocator->chunk = allocator->newChunk(max(used, 16u), allocator->chunk);
+                memcpy(ch->data, src, used);
+            }
+            ch->offset = used;
+        }
+        // relocations
+        auto totalRelocations = reader.read<uint32_t>();
+        auto relocations = (const ImageRelocation *) reader.skip(size_t(totalRelocations)*sizeof(ImageRelocation));
+        if ( reader.failed ) {
+            errors = "simulated context image is truncated";
+            return false;
+        }
+        for ( uint32_t i=0; i!=totalRelocations; ++i ) {
+            ImageRelocation rel;
+            memcpy(&rel, relocations + i, sizeof(ImageRelocation));
+            if ( rel.chunk>=chunks.size() || uint64_t(rel.offset)+sizeof(void *)>chunks[rel.chunk]->offset ) {
+                errors = "invalid relocation";
+                return false;
+            }
+            uintptr_t ptr = 0;
+            if ( rel.target==uint32_t(ImageTarget::chunk) && rel.index<chunks.size() && rel.delta<=chunks[rel.index]->offset ) {
+                ptr = uintptr_t(chunks[rel.index]->data + rel.delta);
+            } else if ( rel.target==uint32_t(ImageTarget::file) && rel.index<files.size() ) {
+                ptr = uintptr_t(files[rel.index].get());
+            } else if ( rel.target==uint32_t(ImageTarget::annotation) && rel.index<annotations.size() && annotations[rel.index] ) {
+                ptr = annotations[rel.index];
+            } else if ( rel.target==uint32_t(ImageTarget::object) && rel.index<objectBase.size() && objectBase[rel.index] ) {
+                ptr = objectBase[rel.index] + uintptr_t(rel.delta);
+            } else {
+                errors = "invalid relocation";
+                return false;
+            }
+            // unchanged words are not written to, so that their pages of the mapped image stay shared
+            auto at = chunks[rel.chunk]->data + rel.offset;
+            if ( memcmp(at, &ptr, sizeof(void *))!=0 ) memcpy(at, &ptr, sizeof(void *));
+        }
+        auto chunkPtr = [&]( uint32_t index, uint32_t offset ) -> char * {
+            return index<chunks.size() && offset<chunks[index]->offset ? chunks[index]->data + offset : nullptr;
+        };
+        auto newFunctions = (SimFunction *) chunkPtr(header.functionsChunk, header.functionsOffset);
+        auto newVariables = (GlobalVariable *) chunkPtr(header.variablesChunk, header.variablesOffset);
+        if ( (header.totalFunctions && !newFunctions) || (header.totalVariables && !newVariables) ) {
+            errors = "invalid function or global variable table";
+            return false;
+        }
+        for ( auto & ti : typeLookup ) {
+            auto info = (TypeInfo *) chunkPtr(ti.chunk, ti.offset);
+            if ( !info ) {
+                errors = "invalid type info lookup";
+                return false;
+            }
+            newDebugInfo->lookup[ti.hash] = info;
+        }
+        // now, the context
+        newCode->totalNodesAllocated = header.totalNodes;
+        newCode->prefixWithHeader = header.prefixWithHeader!=0;
+        code = newCode;
+        constStringHeap = newStrings;
+        debugInfo = newDebugInfo;
+        imageFiles = das::move(files);
+        thisProgram = nullptr;
+        debugger = header.debugger!=0;
+        persistent = header.persistent!=0;
+        if ( persistent ) {
+            heap = make_smart<PersistentHeapAllocator>();
+            stringHeap = make_smart<PersistentStringAllocator>();
+        } else {
+            heap = make_smart<LinearHeapAllocator>();
+            stringHeap = make_smart<LinearStringAllocator>();
+        }
+        heap->setInitialSize(header.heapInitialSize);
+        stringHeap->setInitialSize(header.stringHeapInitialSize);
+        stringHeap->setIntern(header.internStrings!=0);
+        functions = newFunctions;
+        totalFunctions = header.totalFunctions;
+        globalVariables = newVariables;
+        totalVariables = header.totalVariables;
+        globalInitStackSize = header.globalInitStackSize;
+        if ( globals && globalsOwner ) das_aligned_free16(globals);
+        if ( shared && sharedOwner ) das_aligned_free16(shared);
+        globalsSize = header.globalsSize;
+        globals = (char *) das_aligned_alloc16(globalsSize);
+        globalsOwner = true;
+        sharedSize = header.sharedSize;
+        shared = (char *) das_aligned_alloc16(sharedSize);
+        sharedOwner = true;
+        tabMnLookup.clear();
+        for ( auto & kv : mnLookup ) tabMnLookup[kv.first] = functions + kv.second;
+        tabGMnLookup = das::move(gmnLookup);
+        tabAdLookup = das::move(adLookup);
+        // run init script and restart
+        restart();
+        if ( !runWithCatch([&]() {
+            if ( stack.size() && stack.size()>globalInitStackSize ) {
+                runInitScript();
+            } else {
+                auto ssz = max ( int(stack.size()), 16384 ) + globalInitStackSize;
+                StackAllocator init_stack(ssz);
+                SharedStackGuard guard(*this, init_stack);
+                runInitScript();
+            }
+        }) ) {
+            errors = string("exception during init script: ") + (getException() ? getException() : "");
+            return false;
+        }
+        restart();
+        return true;
+    }
+}
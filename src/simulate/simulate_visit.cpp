@@ -70,9 +70,10 @@ namespace das {
         V_END();
     }
 
-    void SimVisitor::sub ( SimNode ** nodes, uint32_t count, const char * ) {
+    void SimVisitor::sub ( SimNode ** nodes, uint32_t count, const char * name ) {
         for ( uint32_t t=0; t!=count; ++t ) {
             nodes[t] = nodes[t]->visit(*this);
+            field(nodes + t, name);
         }
     }
 
@@ -85,6 +86,13 @@ namespace das {
             V_SUB(cmresEval);
         }
         vis.sub(arguments, nArguments, "arguments");
+        V_FIELD(arguments);
+        V_FIELD(types);
+        for ( int32_t i=0; types && i!=nArguments; ++i ) {
+            vis.field(types + i, "types");
+        }
+        V_FIELD(fnPtr);
+        V_FIELD(aotFunction);
     }
 
     SimNode* SimNode_FastCallAny::visit(SimVisitor& vis) {
@@ -101,6 +109,20 @@ namespace das {
         V_END();
     }
 
+    SimNode * SimNode_TailCall::visit(SimVisitor& vis) {
+        V_BEGIN();
+        V_OP(TailCall);
+        V_CALL();
+        V_END();
+    }
+
+    SimNode * SimNode_TailCallLoop::visit(SimVisitor& vis) {
+        V_BEGIN();
+        V_OP(TailCallLoop);
+        V_SUB(body);
+        V_END();
+    }
+
     SimNode* SimNode_CallAndCopyOrMoveAny::visit(SimVisitor& vis) {
         V_BEGIN();
         V_OP(CallAndCopyOrMove);
@@ -207,6 +229,7 @@ namespace das {
         V_SUB(subexpr);
         V_SP(stackTop);
         V_SP_EX(argStackTop);
+        V_FIELD(info);
         V_END();
     }
 
@@ -332,6 +355,7 @@ namespace das {
         string dt = debug_type(typeInfo);
         V_ARG(dt.c_str());
         V_ARG(message);
+        V_FIELD(typeInfo);
         V_END();
     }
 
@@ -340,6 +364,7 @@ namespace das {
         V_OP(TypeInfo);
         string dt = debug_type(typeInfo);
         V_ARG(dt.c_str());
+        V_FIELD(typeInfo);
         V_END();
     }
 
@@ -654,6 +679,7 @@ namespace das {
         V_ARG(typeInfo ? typeInfo->hash : 0);
         V_ARG(persistent);
         V_SP(stackTop);
+        V_FIELD(typeInfo);
         V_END();
     }
 
@@ -747,6 +773,7 @@ namespace das {
 
     void SimNode_Final::visitFinal ( SimVisitor & vis ) {
         vis.sub(finalList, totalFinal, "final");
+        V_FIELD(finalList);
     }
 
     SimNode * SimNode_Final::visit ( SimVisitor & vis ) {
@@ -758,6 +785,8 @@ namespace das {
 
     void SimNode_Block::visitBlock ( SimVisitor & vis ) {
         vis.sub(list, total, "block");
+        V_FIELD(list);
+        V_FIELD(labels);
     }
 
     void SimNode_Block::visitLabels ( SimVisitor & vis ) {
@@ -851,6 +880,14 @@ namespace das {
     }
 #endif
 
+    SimNode * SimNode_ProfileFunction::visit ( SimVisitor & vis ) {
+        V_BEGIN();
+        V_OP(ProfileFunction);
+        vis.arg(func->name,"fnPtr");
+        V_SUB(subexpr);
+        V_END();
+    }
+
     SimNode * SimNode_IfThenElse::visit ( SimVisitor & vis ) {
         V_BEGIN_CR();
         V_OP(IfThenElse);
@@ -873,6 +910,8 @@ namespace das {
         V_OP(While);
         V_SUB(cond);
         vis.sub(list,total,"list");
+        V_FIELD(list);
+        V_FIELD(labels);
         V_FINAL();
         V_END();
     }
@@ -888,8 +927,14 @@ namespace das {
             snprintf(nbuf, sizeof(nbuf), "strides[%i]", t );
             vis.arg(strides[t],nbuf);
             sources[t] = vis.sub(sources[t]);
+            vis.field(sources+t,"sources");
         }
         vis.sub(list,total,"list");
+        V_FIELD(sources);
+        V_FIELD(strides);
+        V_FIELD(stackTop);
+        V_FIELD(list);
+        V_FIELD(labels);
         V_FINAL();
         V_END();
     }
@@ -903,8 +948,13 @@ namespace das {
             snprintf(nbuf, sizeof(nbuf), "stackTop[%i]", t );
             vis.sp(stackTop[t],nbuf);
             source_iterators[t] = vis.sub(source_iterators[t]);
+            vis.field(source_iterators+t,"source_iterators");
         }
         vis.sub(list,total,"list");
+        V_FIELD(source_iterators);
+        V_FIELD(stackTop);
+        V_FIELD(list);
+        V_FIELD(labels);
         V_FINAL();
         V_END();
     }
@@ -932,6 +982,7 @@ namespace das {
         V_BEGIN();
         vis.op(op, typeSize, typeName);
         V_SUB(arguments[0]);
+        V_FIELD(arguments);
         V_END();
     }
 
@@ -940,6 +991,7 @@ namespace das {
         vis.op(op, typeSize, typeName);
         V_SUB(arguments[0]);
         V_SUB(arguments[1]);
+        V_FIELD(arguments);
         V_END();
     }
 
@@ -949,6 +1001,7 @@ namespace das {
         V_SUB(arguments[0]);
         V_SUB(arguments[1]);
         V_SUB(arguments[2]);
+        V_FIELD(arguments);
         V_END();
     }
 
@@ -981,6 +1034,11 @@ namespace das {
         V_SP(stackTop[0]);
         V_SUB(sources[0]);
         vis.sub(list,total,"list");
+        V_FIELD(sources);
+        V_FIELD(strides);
+        V_FIELD(stackTop);
+        V_FIELD(list);
+        V_FIELD(labels);
         V_FINAL();
         V_END();
     }
@@ -995,6 +1053,11 @@ namespace das {
         V_SP(stackTop[0]);
         V_SUB(sources[0]);
         vis.sub(list,total,"list");
+        V_FIELD(sources);
+        V_FIELD(strides);
+        V_FIELD(stackTop);
+        V_FIELD(list);
+        V_FIELD(labels);
         V_FINAL();
         V_END();
     }
@@ -1009,6 +1072,11 @@ namespace das {
         V_SP(stackTop[0]);
         V_SUB(sources[0]);
         V_SUB(list[0]);
+        V_FIELD(sources);
+        V_FIELD(strides);
+        V_FIELD(stackTop);
+        V_FIELD(list);
+        V_FIELD(labels);
         V_FINAL();
         V_END();
     }
@@ -1023,6 +1091,11 @@ namespace das {
         V_SP(stackTop[0]);
         V_SUB(sources[0]);
         V_SUB(list[0]);
+        V_FIELD(sources);
+        V_FIELD(strides);
+        V_FIELD(stackTop);
+        V_FIELD(list);
+        V_FIELD(labels);
         V_FINAL();
         V_END();
     }
@@ -12,6 +12,12 @@ static bool debuggerRequired = false;
 static bool pauseAfterErrors = false;
 static bool quiet = false;
 static bool paranoid_validation = false;
+static string aotLibrary;
+static string profileFile;
+static string saveImageFile;
+static bool runImages = false;
+static vector<string> aotProfiles;
+static double aotCoverage = 0.95;
 
 das::Context * get_context ( int stackSize=0 );
 
@@ -52,6 +58,20 @@ bool compile ( const string & fn, const string & cppFn, bool dryRun ) {
                 }
                 return false;
             }
+            // profile guided AOT
+            if ( !aotProfiles.empty() ) {
+                FunctionProfiler::Profile profile;
+                for ( auto & pf : aotProfiles ) {
+                    if ( !FunctionProfiler::load(pf, profile, tout) ) {
+                        return false;
+                    }
+                }
+                TextWriter report;
+                program->selectAotFromProfile(profile, aotCoverage, report);
+                if ( !quiet ) {
+                    tout << report.str();
+                }
+            }
             // AOT time
             TextWriter tw;
             bool noAotOption = program->options.getBoolOption("no_aot",false);
@@ -140,7 +160,11 @@ bool compile ( const string & fn, const string & cppFn, bool dryRun ) {
                 program->registerAotCpp(tw, *pctx, false);
                 tw << "\t};\n";
                 tw << "\n";
+                tw << "#ifdef DAS_AOT_SHARED_LIBRARY\n";
+                tw << "AotSharedListBase impl(registerAotFunctions);\n";
+                tw << "#else\n";
                 tw << "AotListBase impl(registerAotFunctions);\n";
+                tw << "#endif\n";
                 // validation stuff
                 if ( paranoid_validation ) {
                     program->validateAotCpp(tw,*pctx);
@@ -174,7 +198,7 @@ int das_aot_main ( int argc, char * argv[] ) {
     _set_abort_behavior(0, _WRITE_ABORT_MSG | _CALL_REPORTFAULT);
     #endif
     if ( argc<=3 ) {
-        tout << "daScript -aot <in_script.das> <out_script.das.cpp> [-q] [-j] [-dry-run]\n";
+        tout << "daScript -aot <in_script.das> <out_script.das.cpp> [-q] [-j] [-dry-run] [-profile <profile>] [-hot <percent>]\n";
         return -1;
     }
     bool dryRun = false;
@@ -187,6 +211,10 @@ int das_aot_main ( int argc, char * argv[] ) {
                 paranoid_validation = true;
             } else if ( strcmp(argv[ai],"-dry-run")==0 ) {
                 dryRun = true;
+            } else if ( strcmp(argv[ai],"-profile")==0 && ai+1<argc ) {
+                aotProfiles.push_back(argv[++ai]);
+            } else if ( strcmp(argv[ai],"-hot")==0 && ai+1<argc ) {
+                aotCoverage = min(max(atof(argv[++ai]),0.0),100.0) / 100.0;
             } else if ( strcmp(argv[ai],"--")==0 ) {
                 scriptArgs = true;
             } else if ( !scriptArgs ) {
@@ -238,6 +266,53 @@ int das_aot_main ( int argc, char * argv[] ) {
     return compiled ? 0 : -1;
 }
 
+void run_main ( Context * pctx, const string & mainFnName, ModuleGroup & dummyGroup ) {
+    auto fnVec = pctx->findFunctions(mainFnName.c_str());
+    das::vector<SimFunction *> fnMVec;
+    for ( auto fnAS : fnVec ) {
+        if ( verifyCall<void>(fnAS->debugInfo, dummyGroup) || verifyCall<bool>(fnAS->debugInfo, dummyGroup) ) {
+            fnMVec.push_back(fnAS);
+        }
+    }
+    if ( fnMVec.size()==0 ) {
+        tout << "function '"  << mainFnName << "' not found\n";
+    } else if ( fnMVec.size()>1 ) {
+        tout << "too many options for '" << mainFnName << "'\ncandidates are:\n";
+        for ( auto fnAS : fnMVec ) {
+            tout << "\t" << fnAS->mangledName << "\n";
+        }
+    } else {
+        auto fnTest = fnMVec.back();
+        pctx->restart();
+        if ( !profileFile.empty() ) {
+            pctx->setFunctionProfiler(true);
+        }
+        pctx->eval(fnTest, nullptr);
+        if ( !profileFile.empty() ) {
+            if ( !pctx->getFunctionProfiler()->save(profileFile) ) {
+                tout << "can't write function profile " << profileFile << "\n";
+            }
+            pctx->setFunctionProfiler(false);
+        }
+    }
+}
+
+void save_image ( Context * pctx, const string & fname ) {
+    vector<char> image;
+    string errors;
+    if ( !pctx->saveImage(image, errors) ) {
+        tout << "can't save image, " << errors << "\n";
+        return;
+    }
+    FILE * f = fopen(fname.c_str(), "wb");
+    if ( !f ) {
+        tout << "can't open " << fname << "\n";
+        return;
+    }
+    fwrite(image.data(), 1, image.size(), f);
+    fclose(f);
+}
+
 void compile_and_run ( const string & fn, const string & mainFnName, bool outputProgramCode, const char * introFile = nullptr ) {
     auto access = get_file_access(nullptr);
     if ( introFile ) {
@@ -252,6 +327,10 @@ void compile_and_run ( const string & fn, const string & mainFnName, bool output
     }
     policies.fail_on_no_aot = false;
     policies.fail_on_lack_of_aot_export = false;
+    if ( !aotLibrary.empty() ) {
+        policies.aot = true;
+        policies.aot_lib = aotLibrary;
+    }
     if ( auto program = compileDaScript(fn,access,tout,dummyGroup,false,policies) ) {
         if ( program->failed() ) {
             for ( auto & err : program->errors ) {
@@ -270,33 +349,33 @@ void compile_and_run ( const string & fn, const string & mainFnName, bool output
                     tout << reportError(err.at, err.what, err.extra, err.fixme, err.cerr );
                 }
             } else {
+                for ( auto & err : program->aotErrors ) {
+                    tout << reportError(err.at, err.what, err.extra, err.fixme, err.cerr );
+                }
                 if ( program->thisModule->isModule ) {
                     tout<< "WARNING: program is setup as both module, and endpoint.\n";
                 }
-                auto fnVec = pctx->findFunctions(mainFnName.c_str());
-                das::vector<SimFunction *> fnMVec;
-                for ( auto fnAS : fnVec ) {
-                    if ( verifyCall<void>(fnAS->debugInfo, dummyGroup) || verifyCall<bool>(fnAS->debugInfo, dummyGroup) ) {
-                        fnMVec.push_back(fnAS);
-                    }
-                }
-                if ( fnMVec.size()==0 ) {
-                    tout << "function '"  << mainFnName << "' not found\n";
-                } else if ( fnMVec.size()>1 ) {
-                    tout << "too many options for '" << mainFnName << "'\ncandidates are:\n";
-                    for ( auto fnAS : fnMVec ) {
-                        tout << "\t" << fnAS->mangledName << "\n";
-                    }
+                if ( !saveImageFile.empty() ) {
+                    save_image(pctx.get(), saveImageFile);
                 } else {
-                    auto fnTest = fnMVec.back();
-                    pctx->restart();
-                    pctx->eval(fnTest, nullptr);
+                    run_main(pctx.get(), mainFnName, dummyGroup);
                 }
             }
         }
     }
 }
 
+void run_image ( const string & fn, const string & mainFnName ) {
+    string errors;
+    smart_ptr<Context> pctx ( get_context(CodeOfPolicies().stack) );
+    if ( !pctx->loadImageFile(fn, errors) ) {
+        tout << "failed to load image " << fn << ", " << errors << "\n";
+        return;
+    }
+    ModuleGroup dummyGroup;
+    run_main(pctx.get(), mainFnName, dummyGroup);
+}
+
 void replace( string& str, const string& from, const string& to ) {
     size_t it = str.find(from);
     if( it != string::npos ) {
@@ -306,13 +385,19 @@ void replace( string& str, const string& from, const string& to ) {
 
 void print_help() {
     tout
-        << "daScript scriptName1 {scriptName2} .. {-main mainFnName} {-log} {-pause} -- {script arguments}\n"
+        << "daScript scriptName1 {scriptName2} .. {-main mainFnName} {-log} {-pause} {-aot-lib libName} {-profile profileName} {-save-image imageName} {-image} -- {script arguments}\n"
         << "    -log        output program code\n"
         << "    -pause      pause after errors and pause again before exiting program\n"
-        << "daScript -aot <in_script.das> <out_script.das.cpp> {-q} {-p}\n"
+        << "    -aot-lib    link AOT from the shared library, built from the AOT output with DAS_AOT_SHARED_LIBRARY (see DAS_AOT_LIB)\n"
+        << "    -profile    save calls and time of each interpreted function, for daScript -aot -profile\n"
+        << "    -save-image save simulated program image instead of running it\n"
+        << "    -image      scripts are simulated program images, made by -save-image with the same executable\n"
+        << "daScript -aot <in_script.das> <out_script.das.cpp> {-q} {-p} {-profile profileName} {-hot percent}\n"
         << "    -p          paranoid validation of CPP AOT\n"
         << "    -q          supress all output\n"
         << "    -dry-run    no changes will be written\n"
+        << "    -profile    only compile functions, which are hot in this function profile (can be repeated)\n"
+        << "    -hot        percent of the profiled time the hot functions should cover, 95 by default\n"
     ;
 }
 
@@ -353,6 +438,29 @@ int MAIN_FUNC_NAME ( int argc, char * argv[] ) {
                     return -1;
                 }
                 setDasRoot(argv[i+1]);
+            } else if ( cmd=="profile" ) {
+                if ( i+1 >= argc ) {
+                    print_help();
+                    return -1;
+                }
+                profileFile = argv[i+1];
+                i += 1;
+            } else if ( cmd=="aot-lib" ) {
+                if ( i+1 >= argc ) {
+                    print_help();
+                    return -1;
+                }
+                aotLibrary = argv[i+1];
+                i += 1;
+            } else if ( cmd=="save-image" ) {
+                if ( i+1 >= argc ) {
+                    print_help();
+                    return -1;
+                }
+                saveImageFile = argv[i+1];
+                i += 1;
+            } else if ( cmd=="image" ) {
+                runImages = true;
             } else if ( cmd=="log" ) {
                 outputProgramCode = true;
             } else if ( cmd=="args" ) {
@@ -405,7 +513,11 @@ int MAIN_FUNC_NAME ( int argc, char * argv[] ) {
     // compile and run
     for ( auto & fn : files ) {
         replace(fn, "_dasroot_", getDasRoot());
-        compile_and_run(fn, mainName, outputProgramCode);
+        if ( runImages ) {
+            run_image(fn, mainName);
+        } else {
+            compile_and_run(fn, mainName, outputProgramCode);
+        }
     }
     // and done
     if ( pauseAfterDone ) getchar();